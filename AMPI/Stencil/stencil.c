@@ -41,7 +41,16 @@ PURPOSE: This program tests the efficiency with which a space-invariant,
 USAGE:   The program takes as input the linear dimension of the grid,
          and the number of iterations on the grid
 
-               <progname> <# iterations> <grid size>
+               <progname> <# iterations> <grid size> [<sweep phases>]
+
+         The optional third parameter turns on a virtualization ratio
+         sweep. The number of AMPI virtual processes is fixed at job
+         launch (+vp), so the sweep instead halves the number of active
+         ranks in each successive phase, which doubles the effective
+         virtualization ratio of the remaining ranks. Before each phase
+         the AMPI load balancer is invoked to spread the active ranks
+         over the physical processors, and the migration time and the
+         post-migration rate are reported per phase.
 
          The output consists of diagnostics to make sure the
          algorithm worked, and of timing statistics.
@@ -125,9 +134,15 @@ int main(int argc, char ** argv) {
   DTYPE  f_active_points; /* interior of grid with respect to stencil            */
   DTYPE  flops;           /* floating point ops per iteration                    */
   int    iterations;      /* number of times to run the algorithm                */
+  int    sweep_phases=1;  /* number of virtualization ratio sweep phases         */
+  int    phase;           /* phase of the virtualization ratio sweep             */
+  int    active;          /* number of ranks doing work in the current phase     */
   double local_stencil_time,/* timing parameters                                 */
          stencil_time,
          avgtime;
+  double local_migration_time, /* time spent in the load balancer                */
+         migration_time;
+  MPI_Comm comm;          /* communicator containing the active ranks            */
   int    stencil_size;    /* number of points in stencil                         */
   DTYPE  * RESTRICT in;   /* input grid values                                   */
   DTYPE  * RESTRICT out;  /* output grid values                                  */
@@ -157,8 +172,8 @@ int main(int argc, char ** argv) {
     goto ENDOFTESTS;
 #endif
 
-    if (argc != 3){
-      printf("Usage: %s <# iterations> <array dimension> \n",
+    if (argc < 3 || argc > 4){
+      printf("Usage: %s <# iterations> <array dimension> [<sweep phases>]\n",
              *argv);
       error = 1;
       goto ENDOFTESTS;
@@ -180,6 +195,16 @@ int main(int argc, char ** argv) {
       goto ENDOFTESTS;
     }
 
+    if (argc == 4) {
+      sweep_phases = atoi(*++argv);
+      if (sweep_phases < 1 || (Num_procs>>(sweep_phases-1)) < 1) {
+        printf("ERROR: sweep phases %d must be >= 1 and leave at least one active rank\n",
+               sweep_phases);
+        error = 1;
+        goto ENDOFTESTS;
+      }
+    }
+
     if (RADIUS < 0) {
       printf("ERROR: Stencil radius %d should be non-negative\n", RADIUS);
       error = 1;
@@ -196,22 +221,10 @@ int main(int argc, char ** argv) {
   }
   bail_out(error);
 
-  /* determine best way to create a 2D grid of ranks (closest to square)     */
-  factor(Num_procs, &Num_procsx, &Num_procsy);
-
-  my_IDx = my_ID%Num_procsx;
-  my_IDy = my_ID/Num_procsx;
-  /* compute neighbors; don't worry about dropping off the edges of the grid */
-  right_nbr  = my_ID+1;
-  left_nbr   = my_ID-1;
-  top_nbr    = my_ID+Num_procsx;
-  bottom_nbr = my_ID-Num_procsx;
-
   if (my_ID == root) {
     printf("Number of ranks        = %d\n", Num_procs);
     printf("Grid size              = %d\n", n);
     printf("Radius of stencil      = %d\n", RADIUS);
-    printf("Tiles in x/y-direction = %d/%d\n", Num_procsx, Num_procsy);
     printf("Type of stencil        = star\n");
 #if DOUBLE
     printf("Data type              = double precision\n");
@@ -224,67 +237,14 @@ int main(int argc, char ** argv) {
     printf("Compact representation of stencil loop body\n");
 #endif
     printf("Number of iterations   = %d\n", iterations);
+    if (sweep_phases > 1)
+    printf("Sweep phases           = %d (active ranks halved per phase)\n",
+           sweep_phases);
   }
 
-  MPI_Bcast(&n,          1, MPI_INT, root, MPI_COMM_WORLD);
-  MPI_Bcast(&iterations, 1, MPI_INT, root, MPI_COMM_WORLD);
-
-  /* compute amount of space required for input and solution arrays             */
-
-  width = n/Num_procsx;
-  leftover = n%Num_procsx;
-  if (my_IDx<leftover) {
-    istart = (width+1) * my_IDx;
-    iend = istart + width;
-  }
-  else {
-    istart = (width+1) * leftover + width * (my_IDx-leftover);
-    iend = istart + width - 1;
-  }
-
-  width = iend - istart + 1;
-  if (width == 0) {
-    printf("ERROR: rank %d has no work to do\n", my_ID);
-    error = 1;
-  }
-  bail_out(error);
-
-  height = n/Num_procsy;
-  leftover = n%Num_procsy;
-  if (my_IDy<leftover) {
-    jstart = (height+1) * my_IDy;
-    jend = jstart + height;
-  }
-  else {
-    jstart = (height+1) * leftover + height * (my_IDy-leftover);
-    jend = jstart + height - 1;
-  }
-
-  height = jend - jstart + 1;
-  if (height == 0) {
-    printf("ERROR: rank %d has no work to do\n", my_ID);
-    error = 1;
-  }
-  bail_out(error);
-
-  if (width < RADIUS || height < RADIUS) {
-    printf("ERROR: rank %d has work tile smaller then stencil radius\n",
-           my_ID);
-    error = 1;
-  }
-  bail_out(error);
-
-  total_length_in  = (long) (width+2*RADIUS)*(long) (height+2*RADIUS)*sizeof(DTYPE);
-  total_length_out = (long) width* (long) height*sizeof(DTYPE);
-
-  in  = (DTYPE *) prk_malloc(total_length_in);
-  out = (DTYPE *) prk_malloc(total_length_out);
-  if (!in || !out) {
-    printf("ERROR: rank %d could not allocate space for input/output array\n",
-            my_ID);
-    error = 1;
-  }
-  bail_out(error);
+  MPI_Bcast(&n,            1, MPI_INT, root, MPI_COMM_WORLD);
+  MPI_Bcast(&iterations,   1, MPI_INT, root, MPI_COMM_WORLD);
+  MPI_Bcast(&sweep_phases, 1, MPI_INT, root, MPI_COMM_WORLD);
 
   /* fill the stencil weights to reflect a discrete divergence operator         */
   for (jj=-RADIUS; jj<=RADIUS; jj++) for (ii=-RADIUS; ii<=RADIUS; ii++)
@@ -296,181 +256,306 @@ int main(int argc, char ** argv) {
     WEIGHT(0,-ii) = WEIGHT(-ii,0) = -(DTYPE) (1.0/(2.0*ii*RADIUS));
   }
 
-  norm = (DTYPE) 0.0;
   f_active_points = (DTYPE) (n-2*RADIUS)*(DTYPE) (n-2*RADIUS);
-  /* intialize the input and output arrays                                     */
-  for (j=jstart; j<=jend; j++) for (i=istart; i<=iend; i++) {
-    IN(i,j)  = COEFX*i+COEFY*j;
-    OUT(i,j) = (DTYPE)0.0;
-  }
 
-  if (Num_procs > 1) {
-    /* allocate communication buffers for halo values                          */
-    top_buf_out = (DTYPE *) prk_malloc(4*sizeof(DTYPE)*RADIUS*width);
-    if (!top_buf_out) {
-      printf("ERROR: Rank %d could not allocated comm buffers for y-direction\n", my_ID);
-      error = 1;
-    }
-    bail_out(error);
-    top_buf_in     = top_buf_out +   RADIUS*width;
-    bottom_buf_out = top_buf_out + 2*RADIUS*width;
-    bottom_buf_in  = top_buf_out + 3*RADIUS*width;
-
-    right_buf_out  = (DTYPE *) prk_malloc(4*sizeof(DTYPE)*RADIUS*height);
-    if (!right_buf_out) {
-      printf("ERROR: Rank %d could not allocated comm buffers for x-direction\n", my_ID);
-      error = 1;
-    }
-    bail_out(error);
-    right_buf_in   = right_buf_out +   RADIUS*height;
-    left_buf_out   = right_buf_out + 2*RADIUS*height;
-    left_buf_in    = right_buf_out + 3*RADIUS*height;
-  }
+  for (phase = 0; phase < sweep_phases; phase++) {
 
-  for (iter = 0; iter<=iterations; iter++){
+    /* halving the number of active ranks doubles the work per remaining rank,
+       which doubles the effective virtualization ratio                        */
+    active = Num_procs>>phase;
 
-    /* start timer after a warmup iteration */
-    if (iter == 1) {
+    if (sweep_phases > 1) {
+      /* ask the load balancer to redistribute the virtual processes before
+         the work distribution changes; all ranks must participate            */
       MPI_Barrier(MPI_COMM_WORLD);
-      local_stencil_time = wtime();
+      local_migration_time = wtime();
+#if ADAPTIVE_MPI
+      AMPI_Migrate(AMPI_INFO_LB_SYNC);
+#endif
+      local_migration_time = wtime() - local_migration_time;
+      MPI_Reduce(&local_migration_time, &migration_time, 1, MPI_DOUBLE,
+                 MPI_MAX, root, MPI_COMM_WORLD);
+      if (my_ID == root) {
+        printf("Sweep phase            = %d\n", phase+1);
+        printf("Active ranks           = %d\n", active);
+        printf("Migration time (s):      %lf\n", migration_time);
+      }
     }
 
-    /* need to fetch ghost point data from neighbors in y-direction                 */
-    if (my_IDy < Num_procsy-1) {
-      MPI_Irecv(top_buf_in, RADIUS*width, MPI_DTYPE, top_nbr, 101,
-                MPI_COMM_WORLD, &(request[1]));
-      for (kk=0,j=jend-RADIUS+1; j<=jend; j++) for (i=istart; i<=iend; i++) {
-          top_buf_out[kk++]= IN(i,j);
+    /* put the active ranks in their own communicator; rank order is
+       preserved, so within comm each rank keeps its MPI_COMM_WORLD ID       */
+    MPI_Comm_split(MPI_COMM_WORLD, my_ID<active, my_ID, &comm);
+
+    error = 0;
+    if (my_ID < active) {
+
+      /* determine best way to create a 2D grid of ranks (closest to square) */
+      factor(active, &Num_procsx, &Num_procsy);
+
+      my_IDx = my_ID%Num_procsx;
+      my_IDy = my_ID/Num_procsx;
+      /* compute neighbors; don't worry about dropping off the edges of the grid */
+      right_nbr  = my_ID+1;
+      left_nbr   = my_ID-1;
+      top_nbr    = my_ID+Num_procsx;
+      bottom_nbr = my_ID-Num_procsx;
+
+      if (my_ID == root && phase == 0) {
+        printf("Tiles in x/y-direction = %d/%d\n", Num_procsx, Num_procsy);
       }
-      MPI_Isend(top_buf_out, RADIUS*width,MPI_DTYPE, top_nbr, 99,
-                MPI_COMM_WORLD, &(request[0]));
-    }
-    if (my_IDy > 0) {
-      MPI_Irecv(bottom_buf_in,RADIUS*width, MPI_DTYPE, bottom_nbr, 99,
-                MPI_COMM_WORLD, &(request[3]));
-      for (kk=0,j=jstart; j<=jstart+RADIUS-1; j++) for (i=istart; i<=iend; i++) {
-          bottom_buf_out[kk++]= IN(i,j);
+
+      /* compute amount of space required for input and solution arrays         */
+
+      width = n/Num_procsx;
+      leftover = n%Num_procsx;
+      if (my_IDx<leftover) {
+        istart = (width+1) * my_IDx;
+        iend = istart + width;
       }
-      MPI_Isend(bottom_buf_out, RADIUS*width,MPI_DTYPE, bottom_nbr, 101,
-                MPI_COMM_WORLD, &(request[2]));
-    }
-    if (my_IDy < Num_procsy-1) {
-      MPI_Wait(&(request[0]), MPI_STATUS_IGNORE);
-      MPI_Wait(&(request[1]), MPI_STATUS_IGNORE);
-      for (kk=0,j=jend+1; j<=jend+RADIUS; j++) for (i=istart; i<=iend; i++) {
-          IN(i,j) = top_buf_in[kk++];
+      else {
+        istart = (width+1) * leftover + width * (my_IDx-leftover);
+        iend = istart + width - 1;
       }
-    }
-    if (my_IDy > 0) {
-      MPI_Wait(&(request[2]), MPI_STATUS_IGNORE);
-      MPI_Wait(&(request[3]), MPI_STATUS_IGNORE);
-      for (kk=0,j=jstart-RADIUS; j<=jstart-1; j++) for (i=istart; i<=iend; i++) {
-          IN(i,j) = bottom_buf_in[kk++];
+
+      width = iend - istart + 1;
+      if (width == 0) {
+        printf("ERROR: rank %d has no work to do\n", my_ID);
+        error = 1;
       }
-    }
 
-    /* need to fetch ghost point data from neighbors in x-direction                 */
-    if (my_IDx < Num_procsx-1) {
-      MPI_Irecv(right_buf_in, RADIUS*height, MPI_DTYPE, right_nbr, 1010,
-                MPI_COMM_WORLD, &(request[1+4]));
-      for (kk=0,j=jstart; j<=jend; j++) for (i=iend-RADIUS+1; i<=iend; i++) {
-          right_buf_out[kk++]= IN(i,j);
+      height = n/Num_procsy;
+      leftover = n%Num_procsy;
+      if (my_IDy<leftover) {
+        jstart = (height+1) * my_IDy;
+        jend = jstart + height;
       }
-      MPI_Isend(right_buf_out, RADIUS*height, MPI_DTYPE, right_nbr, 990,
-              MPI_COMM_WORLD, &(request[0+4]));
-    }
-    if (my_IDx > 0) {
-      MPI_Irecv(left_buf_in, RADIUS*height, MPI_DTYPE, left_nbr, 990,
-                MPI_COMM_WORLD, &(request[3+4]));
-      for (kk=0,j=jstart; j<=jend; j++) for (i=istart; i<=istart+RADIUS-1; i++) {
-          left_buf_out[kk++]= IN(i,j);
+      else {
+        jstart = (height+1) * leftover + height * (my_IDy-leftover);
+        jend = jstart + height - 1;
       }
-      MPI_Isend(left_buf_out, RADIUS*height, MPI_DTYPE, left_nbr, 1010,
-                MPI_COMM_WORLD, &(request[2+4]));
-    }
-    if (my_IDx < Num_procsx-1) {
-      MPI_Wait(&(request[0+4]), MPI_STATUSES_IGNORE);
-      MPI_Wait(&(request[1+4]), MPI_STATUSES_IGNORE);
-      for (kk=0,j=jstart; j<=jend; j++) for (i=iend+1; i<=iend+RADIUS; i++) {
-          IN(i,j) = right_buf_in[kk++];
+
+      height = jend - jstart + 1;
+      if (height == 0) {
+        printf("ERROR: rank %d has no work to do\n", my_ID);
+        error = 1;
       }
-    }
-    if (my_IDx > 0) {
-      MPI_Wait(&(request[2+4]), MPI_STATUSES_IGNORE);
-      MPI_Wait(&(request[3+4]), MPI_STATUSES_IGNORE);
-      for (kk=0,j=jstart; j<=jend; j++) for (i=istart-RADIUS; i<=istart-1; i++) {
-          IN(i,j) = left_buf_in[kk++];
+
+      if (width < RADIUS || height < RADIUS) {
+        printf("ERROR: rank %d has work tile smaller then stencil radius\n",
+               my_ID);
+        error = 1;
       }
-    }
 
-    /* Apply the stencil operator */
-    for (j=MAX(jstart,RADIUS); j<=MIN(n-RADIUS-1,jend); j++) {
-      for (i=MAX(istart,RADIUS); i<=MIN(n-RADIUS-1,iend); i++) {
-        #if LOOPGEN
-          #include "loop_body_star.incl"
-        #else
-          for (jj=-RADIUS; jj<=RADIUS; jj++) OUT(i,j) += WEIGHT(0,jj)*IN(i,j+jj);
-          for (ii=-RADIUS; ii<0; ii++)       OUT(i,j) += WEIGHT(ii,0)*IN(i+ii,j);
-          for (ii=1; ii<=RADIUS; ii++)       OUT(i,j) += WEIGHT(ii,0)*IN(i+ii,j);
-        #endif
+      if (!error) {
+        total_length_in  = (long) (width+2*RADIUS)*(long) (height+2*RADIUS)*sizeof(DTYPE);
+        total_length_out = (long) width* (long) height*sizeof(DTYPE);
+
+        in  = (DTYPE *) prk_malloc(total_length_in);
+        out = (DTYPE *) prk_malloc(total_length_out);
+        if (!in || !out) {
+          printf("ERROR: rank %d could not allocate space for input/output array\n",
+                  my_ID);
+          error = 1;
+        }
       }
     }
+    bail_out(error);
 
-    /* add constant to solution to force refresh of neighbor data, if any */
-    for (j=jstart; j<=jend; j++) for (i=istart; i<=iend; i++) IN(i,j)+= 1.0;
-
-  } /* end of iterations                                                   */
-
-  local_stencil_time = wtime() - local_stencil_time;
-  MPI_Reduce(&local_stencil_time, &stencil_time, 1, MPI_DOUBLE, MPI_MAX, root,
-             MPI_COMM_WORLD);
+    if (my_ID < active) {
+      /* intialize the input and output arrays                                 */
+      for (j=jstart; j<=jend; j++) for (i=istart; i<=iend; i++) {
+        IN(i,j)  = COEFX*i+COEFY*j;
+        OUT(i,j) = (DTYPE)0.0;
+      }
 
-  /* compute L1 norm in parallel                                                */
-  local_norm = (DTYPE) 0.0;
-  for (j=MAX(jstart,RADIUS); j<=MIN(n-RADIUS-1,jend); j++) {
-    for (i=MAX(istart,RADIUS); i<=MIN(n-RADIUS-1,iend); i++) {
-      local_norm += (DTYPE)ABS(OUT(i,j));
+      if (active > 1) {
+        /* allocate communication buffers for halo values                      */
+        top_buf_out = (DTYPE *) prk_malloc(4*sizeof(DTYPE)*RADIUS*width);
+        if (!top_buf_out) {
+          printf("ERROR: Rank %d could not allocated comm buffers for y-direction\n", my_ID);
+          error = 1;
+        }
+        else {
+          top_buf_in     = top_buf_out +   RADIUS*width;
+          bottom_buf_out = top_buf_out + 2*RADIUS*width;
+          bottom_buf_in  = top_buf_out + 3*RADIUS*width;
+
+          right_buf_out  = (DTYPE *) prk_malloc(4*sizeof(DTYPE)*RADIUS*height);
+          if (!right_buf_out) {
+            printf("ERROR: Rank %d could not allocated comm buffers for x-direction\n", my_ID);
+            error = 1;
+          }
+          else {
+            right_buf_in   = right_buf_out +   RADIUS*height;
+            left_buf_out   = right_buf_out + 2*RADIUS*height;
+            left_buf_in    = right_buf_out + 3*RADIUS*height;
+          }
+        }
+      }
     }
-  }
-
-  MPI_Reduce(&local_norm, &norm, 1, MPI_DTYPE, MPI_SUM, root, MPI_COMM_WORLD);
+    bail_out(error);
 
-  /*******************************************************************************
-  ** Analyze and output results.
-  ********************************************************************************/
+    if (my_ID < active) {
+
+      for (iter = 0; iter<=iterations; iter++){
+
+        /* start timer after a warmup iteration */
+        if (iter == 1) {
+          MPI_Barrier(comm);
+          local_stencil_time = wtime();
+        }
+
+        /* need to fetch ghost point data from neighbors in y-direction               */
+        if (my_IDy < Num_procsy-1) {
+          MPI_Irecv(top_buf_in, RADIUS*width, MPI_DTYPE, top_nbr, 101,
+                    comm, &(request[1]));
+          for (kk=0,j=jend-RADIUS+1; j<=jend; j++) for (i=istart; i<=iend; i++) {
+              top_buf_out[kk++]= IN(i,j);
+          }
+          MPI_Isend(top_buf_out, RADIUS*width,MPI_DTYPE, top_nbr, 99,
+                    comm, &(request[0]));
+        }
+        if (my_IDy > 0) {
+          MPI_Irecv(bottom_buf_in,RADIUS*width, MPI_DTYPE, bottom_nbr, 99,
+                    comm, &(request[3]));
+          for (kk=0,j=jstart; j<=jstart+RADIUS-1; j++) for (i=istart; i<=iend; i++) {
+              bottom_buf_out[kk++]= IN(i,j);
+          }
+          MPI_Isend(bottom_buf_out, RADIUS*width,MPI_DTYPE, bottom_nbr, 101,
+                    comm, &(request[2]));
+        }
+        if (my_IDy < Num_procsy-1) {
+          MPI_Wait(&(request[0]), MPI_STATUS_IGNORE);
+          MPI_Wait(&(request[1]), MPI_STATUS_IGNORE);
+          for (kk=0,j=jend+1; j<=jend+RADIUS; j++) for (i=istart; i<=iend; i++) {
+              IN(i,j) = top_buf_in[kk++];
+          }
+        }
+        if (my_IDy > 0) {
+          MPI_Wait(&(request[2]), MPI_STATUS_IGNORE);
+          MPI_Wait(&(request[3]), MPI_STATUS_IGNORE);
+          for (kk=0,j=jstart-RADIUS; j<=jstart-1; j++) for (i=istart; i<=iend; i++) {
+              IN(i,j) = bottom_buf_in[kk++];
+          }
+        }
+
+        /* need to fetch ghost point data from neighbors in x-direction               */
+        if (my_IDx < Num_procsx-1) {
+          MPI_Irecv(right_buf_in, RADIUS*height, MPI_DTYPE, right_nbr, 1010,
+                    comm, &(request[1+4]));
+          for (kk=0,j=jstart; j<=jend; j++) for (i=iend-RADIUS+1; i<=iend; i++) {
+              right_buf_out[kk++]= IN(i,j);
+          }
+          MPI_Isend(right_buf_out, RADIUS*height, MPI_DTYPE, right_nbr, 990,
+                  comm, &(request[0+4]));
+        }
+        if (my_IDx > 0) {
+          MPI_Irecv(left_buf_in, RADIUS*height, MPI_DTYPE, left_nbr, 990,
+                    comm, &(request[3+4]));
+          for (kk=0,j=jstart; j<=jend; j++) for (i=istart; i<=istart+RADIUS-1; i++) {
+              left_buf_out[kk++]= IN(i,j);
+          }
+          MPI_Isend(left_buf_out, RADIUS*height, MPI_DTYPE, left_nbr, 1010,
+                    comm, &(request[2+4]));
+        }
+        if (my_IDx < Num_procsx-1) {
+          MPI_Wait(&(request[0+4]), MPI_STATUSES_IGNORE);
+          MPI_Wait(&(request[1+4]), MPI_STATUSES_IGNORE);
+          for (kk=0,j=jstart; j<=jend; j++) for (i=iend+1; i<=iend+RADIUS; i++) {
+              IN(i,j) = right_buf_in[kk++];
+          }
+        }
+        if (my_IDx > 0) {
+          MPI_Wait(&(request[2+4]), MPI_STATUSES_IGNORE);
+          MPI_Wait(&(request[3+4]), MPI_STATUSES_IGNORE);
+          for (kk=0,j=jstart; j<=jend; j++) for (i=istart-RADIUS; i<=istart-1; i++) {
+              IN(i,j) = left_buf_in[kk++];
+          }
+        }
+
+        /* Apply the stencil operator */
+        for (j=MAX(jstart,RADIUS); j<=MIN(n-RADIUS-1,jend); j++) {
+          for (i=MAX(istart,RADIUS); i<=MIN(n-RADIUS-1,iend); i++) {
+            #if LOOPGEN
+              #include "loop_body_star.incl"
+            #else
+              for (jj=-RADIUS; jj<=RADIUS; jj++) OUT(i,j) += WEIGHT(0,jj)*IN(i,j+jj);
+              for (ii=-RADIUS; ii<0; ii++)       OUT(i,j) += WEIGHT(ii,0)*IN(i+ii,j);
+              for (ii=1; ii<=RADIUS; ii++)       OUT(i,j) += WEIGHT(ii,0)*IN(i+ii,j);
+            #endif
+          }
+        }
+
+        /* add constant to solution to force refresh of neighbor data, if any */
+        for (j=jstart; j<=jend; j++) for (i=istart; i<=iend; i++) IN(i,j)+= 1.0;
+
+      } /* end of iterations                                                   */
+
+      local_stencil_time = wtime() - local_stencil_time;
+      MPI_Reduce(&local_stencil_time, &stencil_time, 1, MPI_DOUBLE, MPI_MAX, root,
+                 comm);
+
+      /* compute L1 norm in parallel                                           */
+      local_norm = (DTYPE) 0.0;
+      for (j=MAX(jstart,RADIUS); j<=MIN(n-RADIUS-1,jend); j++) {
+        for (i=MAX(istart,RADIUS); i<=MIN(n-RADIUS-1,iend); i++) {
+          local_norm += (DTYPE)ABS(OUT(i,j));
+        }
+      }
 
-/* verify correctness                                                            */
-  if (my_ID == root) {
-    norm /= f_active_points;
-    if (RADIUS > 0) {
-      reference_norm = (DTYPE) (iterations+1) * (COEFX + COEFY);
-    }
-    else {
-      reference_norm = (DTYPE) 0.0;
-    }
-    if (ABS(norm-reference_norm) > EPSILON) {
-      printf("ERROR: L1 norm = "FSTR", Reference L1 norm = "FSTR"\n",
-             norm, reference_norm);
-      error = 1;
-    }
-    else {
-      printf("Solution validates\n");
+      MPI_Reduce(&local_norm, &norm, 1, MPI_DTYPE, MPI_SUM, root, comm);
+
+      /*****************************************************************************
+      ** Analyze and output results.
+      ******************************************************************************/
+
+      /* verify correctness                                                     */
+      if (my_ID == root) {
+        norm /= f_active_points;
+        if (RADIUS > 0) {
+          reference_norm = (DTYPE) (iterations+1) * (COEFX + COEFY);
+        }
+        else {
+          reference_norm = (DTYPE) 0.0;
+        }
+        if (ABS(norm-reference_norm) > EPSILON) {
+          printf("ERROR: L1 norm = "FSTR", Reference L1 norm = "FSTR"\n",
+                 norm, reference_norm);
+          error = 1;
+        }
+        else {
+          printf("Solution validates\n");
 #if VERBOSE
-      printf("Reference L1 norm = "FSTR", L1 norm = "FSTR"\n",
-             reference_norm, norm);
+          printf("Reference L1 norm = "FSTR", L1 norm = "FSTR"\n",
+                 reference_norm, norm);
 #endif
+        }
+      }
     }
-  }
-  bail_out(error);
+    bail_out(error);
 
-  if (my_ID == root) {
-    /* flops/stencil: 2 flops (fma) for each point in the stencil,
-       plus one flop for the update of the input of the array        */
-    flops = (DTYPE) (2*stencil_size+1) * f_active_points;
-    avgtime = stencil_time/iterations;
-    printf("Rate (MFlops/s): "FSTR"  Avg time (s): %lf\n",
-           1.0E-06 * flops/avgtime, avgtime);
-  }
+    if (my_ID < active) {
+      if (my_ID == root) {
+        /* flops/stencil: 2 flops (fma) for each point in the stencil,
+           plus one flop for the update of the input of the array        */
+        flops = (DTYPE) (2*stencil_size+1) * f_active_points;
+        avgtime = stencil_time/iterations;
+        printf("Rate (MFlops/s): "FSTR"  Avg time (s): %lf\n",
+               1.0E-06 * flops/avgtime, avgtime);
+      }
+
+      /* release grid and communication buffers before the next phase changes
+         the work distribution                                                 */
+      prk_free(in);
+      prk_free(out);
+      if (active > 1) {
+        prk_free(top_buf_out);
+        prk_free(right_buf_out);
+      }
+    }
+    MPI_Comm_free(&comm);
+
+  } /* end of sweep phases                                                     */
 
   MPI_Finalize();
   exit(EXIT_SUCCESS);
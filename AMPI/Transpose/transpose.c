@@ -38,15 +38,24 @@ PURPOSE: This program tests the efficiency with which a square matrix
          can be transposed and stored in another matrix. The matrices
          are distributed identically.
   
-USAGE:   Program inputs are the matrix order, the number of times to 
+USAGE:   Program inputs are the matrix order, the number of times to
          repeat the operation, and the communication mode
 
-         transpose <# iterations> <matrix order> [tile size]
+         transpose <# iterations> <matrix order> [<tile size> [<sweep phases>]]
 
-         An optional parameter specifies the tile size used to divide the 
-         individual matrix blocks for improved cache and TLB performance. 
-  
-         The output consists of diagnostics to make sure the 
+         An optional parameter specifies the tile size used to divide the
+         individual matrix blocks for improved cache and TLB performance.
+
+         A second optional parameter turns on a virtualization ratio
+         sweep. The number of AMPI virtual processes is fixed at job
+         launch (+vp), so the sweep instead halves the number of active
+         ranks in each successive phase, which doubles the effective
+         virtualization ratio of the remaining ranks. Before each phase
+         the AMPI load balancer is invoked to spread the active ranks
+         over the physical processors, and the migration time and the
+         post-migration rate are reported per phase.
+
+         The output consists of diagnostics to make sure the
          transpose worked and timing statistics.
 
 FUNCTIONS CALLED:
@@ -148,6 +157,10 @@ int main(int argc, char ** argv)
   int i, j, it, jt, istart;/* dummies                               */
   int iter;                /* index of iteration                    */
   int phase;               /* phase inside staged communication     */
+  int sweep_phases=1;      /* number of virtualization sweep phases */
+  int sweep;               /* phase of the virtualization sweep     */
+  int active;              /* number of working ranks in this phase */
+  MPI_Comm comm;           /* communicator of the active ranks      */
   int colstart;            /* starting column for owning rank       */
   int error;               /* error flag                            */
   double * RESTRICT A_p;   /* original matrix column block          */
@@ -160,6 +173,8 @@ int main(int argc, char ** argv)
   double local_trans_time, /* timing parameters                     */
          trans_time,
          avgtime;
+  double local_migration_time, /* time spent in the load balancer   */
+         migration_time;
 
 /*********************************************************************
 ** Initialize the MPI environment
@@ -176,8 +191,8 @@ int main(int argc, char ** argv)
     printf("Parallel Research Kernels version %s\n", PRKVERSION);
     printf("Adaptive MPI matrix transpose: B = A^T\n");
 
-    if (argc != 3 && argc != 4){
-      printf("Usage: %s <# iterations> <matrix order> [Tile size]\n",
+    if (argc < 3 || argc > 5){
+      printf("Usage: %s <# iterations> <matrix order> [<Tile size> [<sweep phases>]]\n",
                                                                *argv);
       error = 1; goto ENDOFTESTS;
     }
@@ -200,7 +215,16 @@ int main(int argc, char ** argv)
       error = 1; goto ENDOFTESTS;
     }
 
-    if (argc == 4) Tile_order = atoi(*++argv);
+    if (argc >= 4) Tile_order = atoi(*++argv);
+
+    if (argc == 5) {
+      sweep_phases = atoi(*++argv);
+      if (sweep_phases < 1 || (Num_procs>>(sweep_phases-1)) < 1) {
+        printf("ERROR: sweep phases %d must be >= 1 and leave at least one active rank\n",
+               sweep_phases);
+        error = 1; goto ENDOFTESTS;
+      }
+    }
 
     ENDOFTESTS:;
   }
@@ -217,55 +241,99 @@ int main(int argc, char ** argv)
     printf("Non-");
 #endif
     printf("Blocking messages\n");
+    if (sweep_phases > 1)
+    printf("Sweep phases         = %d (active ranks halved per phase)\n",
+           sweep_phases);
   }
 
   /*  Broadcast input data to all ranks */
-  MPI_Bcast (&order,      1, MPI_LONG, root, MPI_COMM_WORLD);
-  MPI_Bcast (&iterations, 1, MPI_INT,  root, MPI_COMM_WORLD);
-  MPI_Bcast (&Tile_order, 1, MPI_INT,  root, MPI_COMM_WORLD);
+  MPI_Bcast (&order,        1, MPI_LONG, root, MPI_COMM_WORLD);
+  MPI_Bcast (&iterations,   1, MPI_INT,  root, MPI_COMM_WORLD);
+  MPI_Bcast (&Tile_order,   1, MPI_INT,  root, MPI_COMM_WORLD);
+  MPI_Bcast (&sweep_phases, 1, MPI_INT,  root, MPI_COMM_WORLD);
 
   /* a non-positive tile size means no tiling of the local transpose */
   tiling = (Tile_order > 0) && (Tile_order < order);
   bytes = 2 * sizeof(double) * order * order;
 
+  for (sweep = 0; sweep < sweep_phases; sweep++) {
+
+  /* halving the number of active ranks doubles the work per remaining rank,
+     which doubles the effective virtualization ratio                        */
+  active = Num_procs>>sweep;
+
+  if (sweep_phases > 1) {
+    if (my_ID == root) {
+      printf("Sweep phase          = %d\n", sweep+1);
+      printf("Active ranks         = %d\n", active);
+    }
+    if (order%active) {
+      if (my_ID == root)
+        printf("Skipping phase: matrix order %ld not divisible by %d active ranks\n",
+               order, active);
+      continue;
+    }
+    /* ask the load balancer to redistribute the virtual processes before
+       the work distribution changes; all ranks must participate            */
+    MPI_Barrier(MPI_COMM_WORLD);
+    local_migration_time = wtime();
+#if ADAPTIVE_MPI
+    AMPI_Migrate(AMPI_INFO_LB_SYNC);
+#endif
+    local_migration_time = wtime() - local_migration_time;
+    MPI_Reduce(&local_migration_time, &migration_time, 1, MPI_DOUBLE,
+               MPI_MAX, root, MPI_COMM_WORLD);
+    if (my_ID == root) {
+      printf("Migration time (s):    %lf\n", migration_time);
+    }
+  }
+
+  /* put the active ranks in their own communicator; rank order is
+     preserved, so within comm each rank keeps its MPI_COMM_WORLD ID         */
+  MPI_Comm_split(MPI_COMM_WORLD, my_ID<active, my_ID, &comm);
+
+  error = 0;
+  if (my_ID < active) {
+
 /*********************************************************************
 ** The matrix is broken up into column blocks that are mapped one to a
 ** rank.  Each column block is made up of Num_procs smaller square
 ** blocks of order block_order.
 *********************************************************************/
 
-  Block_order    = order/Num_procs;
+  Block_order    = order/active;
   colstart       = Block_order * my_ID;
   Colblock_size  = order * Block_order;
   Block_size     = Block_order * Block_order;
 
 /*********************************************************************
 ** Create the column block of the test matrix, the row block of the
-** transposed matrix, and workspace (workspace only if #procs>1)
+** transposed matrix, and workspace (workspace only if #active ranks>1)
 *********************************************************************/
   A_p = (double *)prk_malloc(Colblock_size*sizeof(double));
   if (A_p == NULL){
     printf(" Error allocating space for original matrix on node %d\n",my_ID);
     error = 1;
   }
-  bail_out(error);
 
   B_p = (double *)prk_malloc(Colblock_size*sizeof(double));
   if (B_p == NULL){
     printf(" Error allocating space for transpose matrix on node %d\n",my_ID);
     error = 1;
   }
-  bail_out(error);
 
-  if (Num_procs>1) {
+  if (active>1) {
     Work_in_p   = (double *)prk_malloc(2*Block_size*sizeof(double));
     if (Work_in_p == NULL){
       printf(" Error allocating space for work on node %d\n",my_ID);
       error = 1;
     }
-    bail_out(error);
-    Work_out_p = Work_in_p + Block_size;
+    else Work_out_p = Work_in_p + Block_size;
   }
+  } /* end of active rank allocation */
+  bail_out(error);
+
+  if (my_ID < active) {
 
   /* Fill the original column matrix                                                */
   istart = 0;
@@ -279,7 +347,7 @@ int main(int argc, char ** argv)
 
     /* start timer after a warmup iteration                                        */
     if (iter == 1) {
-      MPI_Barrier(MPI_COMM_WORLD);
+      MPI_Barrier(comm);
       local_trans_time = wtime();
     }
 
@@ -302,13 +370,13 @@ int main(int argc, char ** argv)
 	    }
     }
 
-    for (phase=1; phase<Num_procs; phase++){
-      recv_from = (my_ID + phase            )%Num_procs;
-      send_to   = (my_ID - phase + Num_procs)%Num_procs;
+    for (phase=1; phase<active; phase++){
+      recv_from = (my_ID + phase         )%active;
+      send_to   = (my_ID - phase + active)%active;
 
 #if !SYNCHRONOUS
       MPI_Irecv(Work_in_p, Block_size, MPI_DOUBLE,
-                recv_from, phase, MPI_COMM_WORLD, &recv_req);
+                recv_from, phase, comm, &recv_req);
 #endif
 
       istart = send_to*Block_order;
@@ -331,13 +399,13 @@ int main(int argc, char ** argv)
 
 #if !SYNCHRONOUS
       MPI_Isend(Work_out_p, Block_size, MPI_DOUBLE, send_to,
-                phase, MPI_COMM_WORLD, &send_req);
+                phase, comm, &send_req);
       MPI_Wait(&recv_req, MPI_STATUS_IGNORE);
       MPI_Wait(&send_req, MPI_STATUS_IGNORE);
 #else
       MPI_Sendrecv(Work_out_p, Block_size, MPI_DOUBLE, send_to, phase,
                    Work_in_p, Block_size, MPI_DOUBLE,
-	           recv_from, phase, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+	           recv_from, phase, comm, MPI_STATUS_IGNORE);
 #endif
 
       istart = recv_from*Block_order;
@@ -351,7 +419,7 @@ int main(int argc, char ** argv)
 
   local_trans_time = wtime() - local_trans_time;
   MPI_Reduce(&local_trans_time, &trans_time, 1, MPI_DOUBLE, MPI_MAX, root,
-             MPI_COMM_WORLD);
+             comm);
 
   abserr = 0.0;
   istart = 0;
@@ -360,7 +428,7 @@ int main(int argc, char ** argv)
       abserr += ABS(B(i,j) - (double)((order*i + j+colstart)*(iterations+1)+addit));
   }
 
-  MPI_Reduce(&abserr, &abserr_tot, 1, MPI_DOUBLE, MPI_SUM, root, MPI_COMM_WORLD);
+  MPI_Reduce(&abserr, &abserr_tot, 1, MPI_DOUBLE, MPI_SUM, root, comm);
 
   if (my_ID == root) {
     if (abserr_tot < epsilon) {
@@ -377,7 +445,18 @@ int main(int argc, char ** argv)
     }
   }
 
+  /* release matrices and workspace before the next phase changes the
+     work distribution                                                         */
+  prk_free(A_p);
+  prk_free(B_p);
+  if (active>1) prk_free(Work_in_p);
+
+  } /* end of active ranks */
+
   bail_out(error);
+  MPI_Comm_free(&comm);
+
+  } /* end of sweep phases */
 
   MPI_Finalize();
   exit(EXIT_SUCCESS);
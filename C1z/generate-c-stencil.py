@@ -23,6 +23,11 @@ def codegen(src,pattern,stencil_size,radius,W,model):
         src.write('    for (int i='+str(radius)+'; i<n-'+str(radius)+'; i++) {\n')
         src.write('      OMP_SIMD\n')
         src.write('      for (int j='+str(radius)+'; j<n-'+str(radius)+'; j++) {\n')
+    elif (model=='thread'):
+        src.write('void '+pattern+str(radius)+'(const int n, const int istart, const int iend, const double * restrict in, double * restrict out) {\n')
+        src.write('    for (int i=MAX(istart,'+str(radius)+'); i<MIN(iend,n-'+str(radius)+'); i++) {\n')
+        src.write('      PRAGMA_SIMD\n')
+        src.write('      for (int j='+str(radius)+'; j<n-'+str(radius)+'; j++) {\n')
     elif (model=='cilk'):
         src.write('void '+pattern+str(radius)+'(const int n, const double * restrict in, double * restrict out) {\n')
         src.write('    _Cilk_for (int i='+str(radius)+'; i<n-'+str(radius)+'; i++) {\n')
@@ -74,7 +79,7 @@ def instance(src,model,pattern,r):
     codegen(src,pattern,stencil_size,r,W,model)
 
 def main():
-    for model in ['seq','openmp','target','cilk','taskloop']:
+    for model in ['seq','openmp','target','cilk','taskloop','thread']:
       src = open('stencil_'+model+'.h','w')
       if (model=='target'):
           src.write('OMP( declare target )\n')
@@ -0,0 +1,172 @@
+///
+/// Copyright (c) 2019, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    latency
+///
+/// PURPOSE: To measure pure load-to-use memory latency with a randomized
+///          pointer chase.  The slots of an array are linked into a single
+///          random cycle and traversed; every load depends on the previous
+///          one, so no memory-level parallelism hides the latency.
+///
+/// USAGE:   The program takes as input the number of times the chain is
+///          traversed, the number of slots (= loads per traversal), and
+///          optionally the slot size in bytes
+///
+///          <progname> <# iterations> <# loads> [<slot bytes>]
+///
+///          The slot size defaults to one cache line (64); a slot size of
+///          4096 touches a different page on every load, exposing TLB and
+///          page-walk latency.  The working set is #loads * slot bytes;
+///          build with PRK_USE_MMAP to change the backing of prk_malloc.
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// NOTES:   The chain is a single cycle by construction (a shuffled visit
+///          order), so a traversal of #loads steps must return to the
+///          start; that is the validation.
+///
+/// HISTORY: Written loosely after the memory-latency part of lmbench
+///          (lat_mem_rd), with the PRK iteration and validation
+///          discipline.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+
+int main(int argc, char * argv[])
+{
+  printf("Parallel Research Kernels version %.2f\n", PRKVERSION );
+  printf("C11 memory latency pointer chase\n");
+
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  if (argc < 3) {
+    printf("Usage: <# iterations> <# loads> [<slot bytes>]\n");
+    return 1;
+  }
+
+  int iterations = atoi(argv[1]);
+  if (iterations < 1) {
+    printf("ERROR: iterations must be >= 1\n");
+    return 1;
+  }
+
+  size_t length = atol(argv[2]);
+  if (length < 2) {
+    printf("ERROR: chain length must be at least 2\n");
+    return 1;
+  }
+
+  size_t slot_bytes = (argc>3) ? atol(argv[3]) : 64;
+  if (slot_bytes < sizeof(size_t) || slot_bytes % sizeof(size_t) != 0) {
+    printf("ERROR: slot bytes must be a positive multiple of the pointer size\n");
+    return 1;
+  }
+
+  printf("Number of iterations = %d\n", iterations);
+  printf("Chain length         = %zu\n", length);
+  printf("Slot size (B)        = %zu\n", slot_bytes);
+  printf("Working set (KiB)    = %zu\n", length*slot_bytes/1024);
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  double latency_time = 0.0;
+
+  const size_t stride = slot_bytes / sizeof(size_t);
+
+  // slot i holds, in its first word, the element index of the next slot
+  size_t * restrict chain = prk_malloc(length*slot_bytes);
+  // a shuffled visit order makes the chain one random cycle, so every
+  // slot is visited exactly once per traversal
+  size_t * restrict order = prk_malloc(length*sizeof(size_t));
+  if (chain == NULL || order == NULL) {
+    printf("ERROR: could not allocate %zu bytes\n", length*slot_bytes);
+    return 1;
+  }
+
+  for (size_t k=0; k<length; k++) {
+    order[k] = k;
+  }
+  // 64-bit LCG (Knuth constants); self-contained so -std=c11 suffices
+  uint64_t prng = 42;
+  for (size_t k=length-1; k>0; k--) {
+    prng = prng * 6364136223846793005ULL + 1442695040888963407ULL;
+    size_t j = (size_t)((prng >> 33) % (k+1));
+    size_t t = order[k];
+    order[k] = order[j];
+    order[j] = t;
+  }
+  for (size_t k=0; k<length; k++) {
+    chain[order[k]*stride] = order[(k+1)%length]*stride;
+  }
+
+  size_t pos = order[0]*stride;
+  const size_t start = pos;
+
+  prk_free(order);
+
+  for (int iter = 0; iter<=iterations; iter++) {
+
+    if (iter==1) latency_time = prk_wtime();
+
+    // every load depends on the previous one
+    for (size_t k=0; k<length; k++) {
+      pos = chain[pos];
+    }
+  }
+  latency_time = prk_wtime() - latency_time;
+
+  prk_free(chain);
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  // each traversal is one full cycle, so the chase must end where it began
+  if (pos != start) {
+    printf("ERROR: chain of %zu loads ended at %zu instead of %zu\n", length, pos, start);
+    printf("ERROR: solution did not validate\n");
+    return 1;
+  }
+
+  printf("Solution validates\n");
+  double avgtime = latency_time/iterations;
+  printf("Latency (ns/load): %lf Avg time (s): %lf\n", 1.e9*avgtime/length, avgtime);
+
+  return 0;
+}
@@ -97,11 +97,16 @@ int main(int argc, char * argv[])
     return 1;
   }
 
+  // distance (in doubles) for the explicit-prefetch variant of the kernel;
+  // 0 leaves the hardware prefetchers on their own
+  const int prefetch_distance = prk_get_prefetch_distance();
+
 #ifdef _OPENMP
   printf("Number of threads    = %d\n", omp_get_max_threads());
 #endif
   printf("Number of iterations = %d\n", iterations);
   printf("Vector length        = %zu\n", length);
+  printf("Prefetch distance    = %d\n", prefetch_distance);
   //printf("Offset               = %d\n", offset);
 
   //////////////////////////////////////////////////////////////////////
@@ -134,9 +139,29 @@ int main(int argc, char * argv[])
           nstream_time = prk_wtime();
       }
 
-      OMP_FOR_SIMD()
-      for (size_t i=0; i<length; i++) {
-          A[i] += B[i] + scalar * C[i];
+      if (prefetch_distance > 0) {
+        // walk the vectors a cache line at a time so each line is
+        // prefetched once, not once per element
+        const size_t dist = (size_t)prefetch_distance;
+        const size_t line = 64/sizeof(double);
+        OMP_FOR()
+        for (size_t ii=0; ii<length; ii+=line) {
+            if (ii+dist < length) {
+                prk_prefetch_write(&A[ii+dist]);
+                prk_prefetch_read(&B[ii+dist]);
+                prk_prefetch_read(&C[ii+dist]);
+            }
+            const size_t end = (ii+line < length) ? ii+line : length;
+            OMP_SIMD
+            for (size_t i=ii; i<end; i++) {
+                A[i] += B[i] + scalar * C[i];
+            }
+        }
+      } else {
+        OMP_FOR_SIMD()
+        for (size_t i=0; i<length; i++) {
+            A[i] += B[i] + scalar * C[i];
+        }
       }
     }
     OMP_BARRIER
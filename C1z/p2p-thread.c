@@ -0,0 +1,282 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    Pipeline
+///
+/// PURPOSE: This program tests the efficiency with which point-to-point
+///          synchronization can be carried out. It does so by executing
+///          a pipelined algorithm on an m*n grid. The second array
+///          dimension is distributed among the threads (columnwise
+///          decomposition).
+///
+/// USAGE:   The program takes as input the
+///          dimensions of the grid, and the number of iterations on the grid
+///
+///                <progname> <iterations> <m> <n> [<threads>]
+///
+///          This variant parallelizes with raw C11 threads (or Pthreads
+///          where <threads.h> is unavailable), so it runs in parallel on
+///          minimal images that ship no OpenMP runtime.  A static
+///          scheduler gives each of a persistent pool of workers a
+///          contiguous block of columns; per-row completion flags
+///          (C11 atomics) carry the pipelined dependence from each
+///          worker to its right neighbor.
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// FUNCTIONS CALLED:
+///
+///          Other than standard C functions, the following
+///          functions are used in this program:
+///
+///          wtime()
+///
+/// HISTORY: - Written by Rob Van der Wijngaart, February 2009.
+///          - C99-ification by Jeff Hammond, February 2016.
+///          - C11-ification by Jeff Hammond, June 2017.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+
+#include <stdatomic.h>
+
+typedef struct {
+    int me;
+    int num_threads;
+    int iterations;
+    int m;
+    int n;
+    int colstart;            // this worker's block is [colstart,colend)
+    int colend;
+    double * restrict grid;
+    atomic_long * flags;     // last (iteration,row) finished per worker
+    prk_barrier_s * barrier;
+    double * pipeline_time;  // written by worker 0 only
+} args_s;
+
+#if defined(HAVE_C11_THREADS)
+int sweep_block(void * pa)
+#elif defined(HAVE_PTHREADS)
+void * sweep_block(void * pa)
+#endif
+{
+  args_s * a = (args_s*)pa;
+
+  const int me        = a->me;
+  const int m         = a->m;
+  const int n         = a->n;
+  const int colstart  = a->colstart;
+  const int colend    = a->colend;
+  double * restrict grid = a->grid;
+
+  for (int iter = 0; iter<=a->iterations; iter++) {
+
+    // entry barrier: the previous sweep and the corner update are complete
+    prk_barrier_wait(a->barrier);
+    if (iter==1 && me==0) *(a->pipeline_time) = prk_wtime();
+
+    for (int i=1; i<m; i++) {
+      // rows are tagged monotonically across iterations, so the flags
+      // never have to be reset
+      const long tag = (long)iter*(m-1) + i;
+      if (me > 0) {
+        while (atomic_load_explicit(&a->flags[me-1], memory_order_acquire) < tag) ;
+      }
+      for (int j=colstart; j<colend; j++) {
+        grid[i*n+j] = grid[(i-1)*n+j] + grid[i*n+(j-1)] - grid[(i-1)*n+(j-1)];
+      }
+      atomic_store_explicit(&a->flags[me], tag, memory_order_release);
+    }
+
+    // the corner update feeds the next iteration, so the whole sweep
+    // must be complete before it is applied
+    prk_barrier_wait(a->barrier);
+    if (me==0) grid[0*n+0] = -grid[(m-1)*n+(n-1)];
+  }
+  prk_barrier_wait(a->barrier);
+  if (me==0) *(a->pipeline_time) = prk_wtime() - *(a->pipeline_time);
+
+#if defined(HAVE_C11_THREADS)
+  thrd_exit(0);
+  return 0;
+#elif defined(HAVE_PTHREADS)
+  pthread_exit(NULL);
+  return NULL;
+#endif
+}
+
+int main(int argc, char * argv[])
+{
+  printf("Parallel Research Kernels version %.2f\n", PRKVERSION);
+#ifdef HAVE_C11_THREADS
+  printf("C11 Threads pipeline execution on 2D grid\n");
+#else
+  printf("C99/Pthreads pipeline execution on 2D grid\n");
+#endif
+
+  //////////////////////////////////////////////////////////////////////
+  // Process and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  if (argc < 4) {
+    printf("Usage: <# iterations> <first array dimension> <second array dimension>"
+           " [<# threads>]\n");
+    return 1;
+  }
+
+  // number of times to run the pipeline algorithm
+  int iterations = atoi(argv[1]);
+  if (iterations < 1) {
+    printf("ERROR: iterations must be >= 1\n");
+    return 1;
+  }
+
+  // grid dimensions
+  int m = atol(argv[2]);
+  int n = atol(argv[3]);
+  if (m < 1 || n < 1) {
+    printf("ERROR: grid dimensions must be positive: %d,%d\n", m, n);
+    return 1;
+  }
+
+  // number of worker threads; never more than the n-1 computed columns
+  int num_threads = (argc > 4) ? atoi(argv[4]) : 0;
+  if (num_threads < 1) num_threads = 2;
+  if (num_threads > n-1) num_threads = MAX(n-1,1);
+
+  printf("Number of threads         = %d\n", num_threads);
+  printf("Number of iterations      = %d\n", iterations);
+  printf("Grid sizes                = %d,%d\n", m, n);
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  double pipeline_time = 0.0; // silence compiler warning
+
+  size_t bytes = m*n*sizeof(double);
+  double * restrict grid = prk_malloc(bytes);
+
+#if defined(HAVE_C11_THREADS)
+  thrd_t * pool = malloc(num_threads * sizeof(thrd_t));
+#elif defined(HAVE_PTHREADS)
+  pthread_t * pool = malloc(num_threads * sizeof(pthread_t));
+#endif
+  args_s * args = malloc(num_threads * sizeof(args_s));
+  atomic_long * flags = malloc(num_threads * sizeof(atomic_long));
+
+  prk_barrier_s barrier;
+  prk_barrier_init(&barrier, num_threads);
+
+  {
+    for (int i=0; i<m; i++) {
+      for (int j=0; j<n; j++) {
+        grid[i*n+j] = 0.0;
+      }
+    }
+    for (int j=0; j<n; j++) {
+      grid[0*n+j] = (double)j;
+    }
+    for (int i=0; i<m; i++) {
+      grid[i*n+0] = (double)i;
+    }
+
+    // static schedule: contiguous blocks of the n-1 computed columns,
+    // remainder spread over the leading workers
+    const int cols_per_thread = (n-1)/num_threads;
+    const int leftover        = (n-1)%num_threads;
+    int col = 1;
+    for (int t=0; t<num_threads; t++) {
+      atomic_init(&flags[t], 0);
+      args[t].me            = t;
+      args[t].num_threads   = num_threads;
+      args[t].iterations    = iterations;
+      args[t].m             = m;
+      args[t].n             = n;
+      args[t].colstart      = col;
+      col                  += cols_per_thread + (t<leftover ? 1 : 0);
+      args[t].colend        = col;
+      args[t].grid          = grid;
+      args[t].flags         = flags;
+      args[t].barrier       = &barrier;
+      args[t].pipeline_time = &pipeline_time;
+#if defined(HAVE_C11_THREADS)
+      int rc = thrd_create(&pool[t], sweep_block, &args[t]);
+      assert(rc==thrd_success);
+#elif defined(HAVE_PTHREADS)
+      int rc = pthread_create(&pool[t], NULL, sweep_block, &args[t]);
+      assert(rc==0);
+#endif
+    }
+    for (int t=0; t<num_threads; t++) {
+#if defined(HAVE_C11_THREADS)
+      int rc = thrd_join(pool[t],NULL);
+      assert(rc==thrd_success);
+#elif defined(HAVE_PTHREADS)
+      int rc = pthread_join(pool[t],NULL);
+      assert(rc==0);
+#endif
+    }
+  }
+
+  prk_barrier_destroy(&barrier);
+
+  //////////////////////////////////////////////////////////////////////
+  // Analyze and output results.
+  //////////////////////////////////////////////////////////////////////
+
+  const double epsilon = 1.e-8;
+  const double corner_val = ((iterations+1.)*(n+m-2.));
+  if ( (fabs(grid[(m-1)*n+(n-1)] - corner_val)/corner_val) > epsilon) {
+    printf("ERROR: checksum %lf does not match verification value %lf\n", grid[(m-1)*n+(n-1)], corner_val);
+    return 1;
+  }
+
+  prk_free(grid);
+
+  free(flags);
+  free(args);
+  free(pool);
+
+#ifdef VERBOSE
+  printf("Solution validates; verification value = %lf\n", corner_val );
+#else
+  printf("Solution validates\n" );
+#endif
+  double avgtime = pipeline_time/iterations;
+  printf("Rate (MFlops/s): %lf Avg time (s): %lf\n", 2.0e-6 * ( (m-1)*(n-1) )/avgtime, avgtime );
+
+  return 0;
+}
@@ -146,6 +146,75 @@ int __cilkrts_get_nworkers(void);
 # include <pthread.h>
 #endif
 
+// Condition-variable barrier for the explicitly threaded kernel variants,
+// usable with both C11 threads and Pthreads.  C11 threads do not provide
+// a barrier, and pthread_barrier_t is an optional POSIX extension that
+// MUSL-era toolchains have not always shipped.
+typedef struct {
+#if defined(HAVE_C11_THREADS)
+    mtx_t lock;
+    cnd_t cond;
+#elif defined(HAVE_PTHREADS)
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+#endif
+    int parties;
+    int arrived;
+    int phase;
+} prk_barrier_s;
+
+static inline void prk_barrier_init(prk_barrier_s * b, int parties)
+{
+    b->parties = parties;
+    b->arrived = 0;
+    b->phase   = 0;
+#if defined(HAVE_C11_THREADS)
+    mtx_init(&b->lock, mtx_plain);
+    cnd_init(&b->cond);
+#elif defined(HAVE_PTHREADS)
+    pthread_mutex_init(&b->lock, NULL);
+    pthread_cond_init(&b->cond, NULL);
+#endif
+}
+
+static inline void prk_barrier_wait(prk_barrier_s * b)
+{
+#if defined(HAVE_C11_THREADS)
+    mtx_lock(&b->lock);
+    const int phase = b->phase;
+    if (++b->arrived == b->parties) {
+        b->arrived = 0;
+        b->phase   = 1-phase;
+        cnd_broadcast(&b->cond);
+    } else {
+        while (b->phase == phase) cnd_wait(&b->cond, &b->lock);
+    }
+    mtx_unlock(&b->lock);
+#elif defined(HAVE_PTHREADS)
+    pthread_mutex_lock(&b->lock);
+    const int phase = b->phase;
+    if (++b->arrived == b->parties) {
+        b->arrived = 0;
+        b->phase   = 1-phase;
+        pthread_cond_broadcast(&b->cond);
+    } else {
+        while (b->phase == phase) pthread_cond_wait(&b->cond, &b->lock);
+    }
+    pthread_mutex_unlock(&b->lock);
+#endif
+}
+
+static inline void prk_barrier_destroy(prk_barrier_s * b)
+{
+#if defined(HAVE_C11_THREADS)
+    mtx_destroy(&b->lock);
+    cnd_destroy(&b->cond);
+#elif defined(HAVE_PTHREADS)
+    pthread_mutex_destroy(&b->lock);
+    pthread_cond_destroy(&b->cond);
+#endif
+}
+
 #if defined(_OPENMP)
 
 #include <omp.h>
@@ -244,6 +313,36 @@ static inline int prk_get_alignment(void)
     return a;
 }
 
+/* Software-prefetch distance, in elements of double, used by the
+   explicit-prefetch kernel variants; 0 (the default) disables them.
+   Like PRK_ALIGNMENT, it can be baked in at build time with
+   -DPRK_PREFETCH_DISTANCE=<d> or set at run time via the environment. */
+static inline int prk_get_prefetch_distance(void)
+{
+#ifdef PRK_PREFETCH_DISTANCE
+    int d = PRK_PREFETCH_DISTANCE;
+#else
+    char* temp = getenv("PRK_PREFETCH_DISTANCE");
+    int d = (temp!=NULL) ? atoi(temp) : 0;
+#endif
+    if (d < 0) d = 0;
+    return d;
+}
+
+static inline void prk_prefetch_read(const void * p)
+{
+#if defined(__GNUC__)
+    __builtin_prefetch(p, 0);
+#endif
+}
+
+static inline void prk_prefetch_write(const void * p)
+{
+#if defined(__GNUC__)
+    __builtin_prefetch(p, 1);
+#endif
+}
+
 void * prk_malloc(size_t bytes)
 {
     int alignment = prk_get_alignment();
@@ -0,0 +1,293 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    dgemm
+///
+/// PURPOSE: This program tests the efficiency with which a dense matrix
+///          dense multiplication is carried out, using a cache-blocked
+///          packing scheme and a register-tiled micro-kernel in the
+///          style of Goto/BLIS, without linking a vendor BLAS.
+///
+/// USAGE:   The program takes as input the matrix order, the number of
+///          times the matrix-matrix multiplication is carried out, and
+///          optionally the micro-kernel register-tile dimensions.
+///
+///          <progname> <# iterations> <matrix order> [<MR> <NR>]
+///
+///          MR/NR are template parameters of the micro-kernel, so each
+///          supported shape is compiled and specialized separately
+///          (compare the radius specialization in stencil_seq.hpp);
+///          the command line selects among the instantiations.
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// HISTORY: Written by Rob Van der Wijngaart, February 2009.
+///          Converted to C++11 by Jeff Hammond, December, 2017.
+///          Blocked/packed variant added 2020.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+
+// cache blocking parameters: KC*MR doubles of A and KC*NR of B stay hot
+// in L1 while a micro-tile of C is updated; MC*KC panels of A live in L2
+const int MC = 96;
+const int KC = 256;
+const int NC = 2048;
+
+// Register-tiled micro-kernel: C[MR x NR] += Apanel[k,MR] * Bpanel[k,NR].
+// The accumulator array maps to registers for sensible MR/NR choices.
+template <int MR, int NR>
+static inline void micro_kernel(const int kc,
+                                const double * RESTRICT a,
+                                const double * RESTRICT b,
+                                double * RESTRICT c, const int ldc)
+{
+    double acc[MR][NR] = {};
+    for (int k=0; k<kc; ++k) {
+      for (int i=0; i<MR; ++i) {
+        PRAGMA_SIMD
+        for (int j=0; j<NR; ++j) {
+          acc[i][j] += a[k*MR+i] * b[k*NR+j];
+        }
+      }
+    }
+    for (int i=0; i<MR; ++i) {
+      PRAGMA_SIMD
+      for (int j=0; j<NR; ++j) {
+        c[i*ldc+j] += acc[i][j];
+      }
+    }
+}
+
+// pack an mc x kc block of A into micro-panels of MR rows, zero-padded
+template <int MR>
+static void pack_A(const int mc, const int kc, const int order,
+                   const double * RESTRICT A, double * RESTRICT buffer)
+{
+    for (int ir=0; ir<mc; ir+=MR) {
+      const int mr = std::min(MR, mc-ir);
+      for (int k=0; k<kc; ++k) {
+        for (int i=0; i<mr; ++i) {
+          buffer[k*MR+i] = A[(ir+i)*order+k];
+        }
+        for (int i=mr; i<MR; ++i) {
+          buffer[k*MR+i] = 0.0;
+        }
+      }
+      buffer += KC*MR;
+    }
+}
+
+// pack a kc x nc block of B into micro-panels of NR columns, zero-padded
+template <int NR>
+static void pack_B(const int kc, const int nc, const int order,
+                   const double * RESTRICT B, double * RESTRICT buffer)
+{
+    for (int jr=0; jr<nc; jr+=NR) {
+      const int nr = std::min(NR, nc-jr);
+      for (int k=0; k<kc; ++k) {
+        for (int j=0; j<nr; ++j) {
+          buffer[k*NR+j] = B[k*order+jr+j];
+        }
+        for (int j=nr; j<NR; ++j) {
+          buffer[k*NR+j] = 0.0;
+        }
+      }
+      buffer += KC*NR;
+    }
+}
+
+template <int MR, int NR>
+static void prk_dgemm(const int order,
+                      const prk::vector<double> & A,
+                      const prk::vector<double> & B,
+                            prk::vector<double> & C,
+                      prk::vector<double> & Apacked,
+                      prk::vector<double> & Bpacked)
+{
+    for (int jc=0; jc<order; jc+=NC) {
+      const int nc = std::min(NC, order-jc);
+      for (int pc=0; pc<order; pc+=KC) {
+        const int kc = std::min(KC, order-pc);
+        pack_B<NR>(kc, nc, order, &B[pc*order+jc], Bpacked.data());
+        for (int ic=0; ic<order; ic+=MC) {
+          const int mc = std::min(MC, order-ic);
+          pack_A<MR>(mc, kc, order, &A[ic*order+pc], Apacked.data());
+          for (int jr=0; jr<nc; jr+=NR) {
+            const int nr = std::min(NR, nc-jr);
+            for (int ir=0; ir<mc; ir+=MR) {
+              const int mr = std::min(MR, mc-ir);
+              const double * a = &Apacked[(ir/MR)*KC*MR];
+              const double * b = &Bpacked[(jr/NR)*KC*NR];
+              if (mr==MR && nr==NR) {
+                micro_kernel<MR,NR>(kc, a, b, &C[(ic+ir)*order+jc+jr], order);
+              } else {
+                // ragged edge: accumulate into a full tile, copy out the
+                // valid part
+                double ctile[MR*NR] = {};
+                micro_kernel<MR,NR>(kc, a, b, ctile, NR);
+                for (int i=0; i<mr; ++i) {
+                  for (int j=0; j<nr; ++j) {
+                    C[(ic+ir+i)*order+jc+jr+j] += ctile[i*NR+j];
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+}
+
+int main(int argc, char * argv[])
+{
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11 Dense matrix-matrix multiplication: C += A x B (blocked/packed)" << std::endl;
+
+  int iterations;
+  int order;
+  int mr, nr;
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <matrix order> [<MR> <NR>]";
+      }
+
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      order = std::atoi(argv[2]);
+      if (order <= 0) {
+        throw "ERROR: Matrix Order must be greater than 0";
+      } else if (order > std::floor(std::sqrt(INT_MAX))) {
+        throw "ERROR: matrix dimension too large - overflow risk";
+      }
+
+      mr = (argc>3) ? std::atoi(argv[3]) : 4;
+      nr = (argc>4) ? std::atoi(argv[4]) : 8;
+      if ( !((mr==4 || mr==8) && (nr==4 || nr==8)) ) {
+        throw "ERROR: micro-kernel shape must be one of 4x4, 4x8, 8x4, 8x8";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Matrix order         = " << order << std::endl;
+  std::cout << "Micro-kernel         = " << mr << "x" << nr << std::endl;
+  std::cout << "Cache blocking       = " << MC << "/" << KC << "/" << NC << " (MC/KC/NC)" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  /// Allocate space for matrices
+  //////////////////////////////////////////////////////////////////////
+
+  double dgemm_time(0);
+  double setup_time = prk::wtime();
+
+  prk::vector<double> A(order*order);
+  prk::vector<double> B(order*order);
+  prk::vector<double> C(order*order,0.0);
+  // initialize row by row across the hardware threads; at large orders
+  // a serial fill takes longer than the timed GEMMs
+  prk::parallel_for((size_t)order, [&](size_t first, size_t last) {
+    for (size_t i=first; i<last; ++i) {
+      for (auto j=0; j<order; ++j) {
+         A[i*order+j] = i;
+         B[i*order+j] = i;
+      }
+    }
+  });
+
+  // packing buffers are padded up to full micro-panels
+  prk::vector<double> Apacked(prk::divceil(MC,4)*4*KC + 8*KC, 0.0);
+  prk::vector<double> Bpacked(prk::divceil(NC,4)*4*KC + 8*KC, 0.0);
+  setup_time = prk::wtime() - setup_time;
+
+  {
+    for (auto iter = 0; iter<=iterations; iter++) {
+
+      if (iter==1) dgemm_time = prk::wtime();
+
+      switch (mr*10+nr) {
+          case 44: prk_dgemm<4,4>(order, A, B, C, Apacked, Bpacked); break;
+          case 48: prk_dgemm<4,8>(order, A, B, C, Apacked, Bpacked); break;
+          case 84: prk_dgemm<8,4>(order, A, B, C, Apacked, Bpacked); break;
+          case 88: prk_dgemm<8,8>(order, A, B, C, Apacked, Bpacked); break;
+      }
+    }
+    dgemm_time = prk::wtime() - dgemm_time;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  double verify_time = prk::wtime();
+
+  const auto forder = static_cast<double>(order);
+  const auto reference = 0.25 * std::pow(forder,3) * std::pow(forder-1.0,2) * (iterations+1);
+  const auto checksum = prk::reduce(C.begin(), C.end(), 0.0);
+
+  const auto epsilon = 1.0e-8;
+  const auto residuum = std::abs(checksum-reference)/reference;
+  verify_time = prk::wtime() - verify_time;
+  if (residuum < epsilon) {
+#if VERBOSE
+    std::cout << "Reference checksum = " << reference << "\n"
+              << "Actual checksum = " << checksum << std::endl;
+#endif
+    std::cout << "Solution validates" << std::endl;
+    auto avgtime = dgemm_time/iterations;
+    auto nflops = 2.0 * std::pow(forder,3);
+    std::cout << "Rate (MF/s): " << 1.0e-6 * nflops/avgtime
+              << " Avg time (s): " << avgtime << std::endl;
+    std::cout << "Setup time (s): " << setup_time
+              << " Compute time (s): " << dgemm_time
+              << " Verify time (s): " << verify_time << std::endl;
+  } else {
+    std::cout << "Reference checksum = " << reference << "\n"
+              << "Actual checksum = " << checksum << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
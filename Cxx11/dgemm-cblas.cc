@@ -196,9 +196,10 @@ int main(int argc, char * argv[])
   int order;
   int batches = 0;
   int batch_threads = 1;
+  int instances = 0;
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <matrix order> [<batches> <batch threads>]";
+        throw "Usage: <# iterations> <matrix order> [<batches> <batch threads> <instances>]";
       }
 
       iterations  = std::atoi(argv[1]);
@@ -224,6 +225,14 @@ int main(int argc, char * argv[])
         batch_threads = omp_get_max_threads();
 #endif
       }
+
+      // concurrent independent GEMM instances on disjoint core sets
+      if (argc>5) {
+        instances = std::atoi(argv[5]);
+        if (instances > 1 && batches != 0) {
+          throw "ERROR: instance mode does not combine with batching";
+        }
+      }
   }
   catch (const char * e) {
     std::cout << e << std::endl;
@@ -247,28 +256,39 @@ int main(int argc, char * argv[])
           std::cout << "Batch size           = " << std::abs(batches) << " (loop over legacy BLAS sequentially)" << std::endl;
       }
   }
+  if (instances > 1) {
+      const int ncores = static_cast<int>(std::thread::hardware_concurrency());
+      std::cout << "GEMM instances       = " << instances
+                << " (" << ncores/instances << " of " << ncores
+                << " hardware threads each)" << std::endl;
+  }
 
   //////////////////////////////////////////////////////////////////////
   /// Allocate space for matrices
   //////////////////////////////////////////////////////////////////////
 
   double dgemm_time(0);
+  double setup_time = prk::wtime();
 
-  const int matrices = (batches==0 ? 1 : abs(batches));
+  const int matrices = (instances > 1 ? instances : (batches==0 ? 1 : abs(batches)));
 
   std::vector<double> const M(order*order,0);
   std::vector<std::vector<double>> A(matrices,M);
   std::vector<std::vector<double>> B(matrices,M);
   std::vector<std::vector<double>> C(matrices,M);
-  for (int b=0; b<matrices; ++b) {
-    for (int i=0; i<order; ++i) {
+  // initialize row by row across the hardware threads; at large orders
+  // a serial fill takes longer than the timed GEMMs
+  prk::parallel_for((size_t)matrices*order, [&](size_t first, size_t last) {
+    for (size_t r=first; r<last; ++r) {
+      const size_t b = r/order;
+      const size_t i = r%order;
       for (int j=0; j<order; ++j) {
          A[b][i*order+j] = i;
          B[b][i*order+j] = i;
          C[b][i*order+j] = 0;
       }
     }
-  }
+  });
 
   double ** pA = new double*[matrices];
   double ** pB = new double*[matrices];
@@ -279,8 +299,44 @@ int main(int argc, char * argv[])
      pB[b] = B[b].data();
      pC[b] = C[b].data();
   }
-
-  {
+  setup_time = prk::wtime() - setup_time;
+
+  std::vector<double> inst_time;
+  if (instances > 1) {
+    // one thread per instance, each running its own GEMM stream; on Linux
+    // every instance is pinned to a contiguous slice of the hardware
+    // threads, the way serving workloads partition a node.  A threaded
+    // BLAS must be told the slice size (e.g. OPENBLAS_NUM_THREADS or
+    // MKL_NUM_THREADS), or its pool will fight the partitioning.
+    const int ncores = static_cast<int>(std::thread::hardware_concurrency());
+    const int slice  = ncores/instances;
+    inst_time.resize(instances);
+    std::atomic<int> warm(0);
+    auto worker = [&](int id) {
+#if defined(__linux__)
+        if (slice > 0) {
+          cpu_set_t cpus;
+          CPU_ZERO(&cpus);
+          for (int c=id*slice; c<(id+1)*slice; ++c) CPU_SET(c, &cpus);
+          pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+        }
+#endif
+        prk_dgemm(order, A[id], B[id], C[id]);           // warmup
+        warm++;
+        while (warm.load() < instances) { /* start all instances together */ }
+        double t = prk::wtime();
+        for (int iter = 0; iter<iterations; iter++) {
+          prk_dgemm(order, A[id], B[id], C[id]);
+        }
+        inst_time[id] = prk::wtime() - t;
+    };
+    std::vector<std::thread> pool;
+    for (int id=0; id<instances; ++id) pool.emplace_back(worker, id);
+    for (auto & t : pool) t.join();
+    // the slowest instance determines what the partition sustains together
+    dgemm_time = *std::max_element(inst_time.begin(), inst_time.end());
+  }
+  else {
     for (int iter = 0; iter<=iterations; iter++) {
 
       if (iter==1) dgemm_time = prk::wtime();
@@ -300,6 +356,8 @@ int main(int argc, char * argv[])
   /// Analyze and output results
   //////////////////////////////////////////////////////////////////////
 
+  double verify_time = prk::wtime();
+
   const double epsilon = 1.0e-8;
   const double forder = static_cast<double>(order);
   const double reference = 0.25 * std::pow(forder,3) * std::pow(forder-1.0,2) * (iterations+1);
@@ -309,6 +367,7 @@ int main(int argc, char * argv[])
       residuum += std::abs(checksum-reference)/reference;
   }
   residuum/=matrices;
+  verify_time = prk::wtime() - verify_time;
 
   if (residuum < epsilon) {
 #if VERBOSE
@@ -320,6 +379,18 @@ int main(int argc, char * argv[])
     auto nflops = 2.0 * std::pow(forder,3);
     std::cout << "Rate (MF/s): " << 1.0e-6 * nflops/avgtime
               << " Avg time (s): " << avgtime << std::endl;
+    if (instances > 1) {
+      // with instances the Rate line is the aggregate (slowest instance,
+      // all streams); the spread below shows how evenly the partition ran
+      double tmin = *std::min_element(inst_time.begin(), inst_time.end());
+      double tmax = *std::max_element(inst_time.begin(), inst_time.end());
+      std::cout << "Instance rate (MF/s): min " << 1.0e-6 * nflops/(tmax/iterations)
+                << " max " << 1.0e-6 * nflops/(tmin/iterations)
+                << " (aggregate above)" << std::endl;
+    }
+    std::cout << "Setup time (s): " << setup_time
+              << " Compute time (s): " << dgemm_time
+              << " Verify time (s): " << verify_time << std::endl;
   } else {
     std::cout << "Reference checksum = " << reference << "\n"
               << "Residuum           = " << residuum << std::endl;
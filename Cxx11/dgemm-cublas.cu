@@ -42,6 +42,17 @@
 ///          blocking
 ///
 ///          <progname> <# iterations> <matrix order> [<batches>]
+///                     [<copy input every iteration [0/1]>]
+///                     [<fp64|fp32|tf32|bf16|fp16>]
+///
+///          The optional precision argument selects the storage type of
+///          A and B and the arithmetic used by cuBLAS: fp64 and fp32
+///          are the classic (D/S)gemm paths, tf32 runs the fp32 path
+///          with TF32 tensor cores enabled, and bf16/fp16 store the
+///          inputs in 16 bits and accumulate in fp32 through the tensor
+///          cores.  The validation threshold is relaxed to match the
+///          input rounding of each mode, so every mode uses the same
+///          checksum logic.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
@@ -51,8 +62,10 @@
 ///          Other than OpenMP or standard C functions, the following
 ///          functions are used in this program:
 ///
-///          cblasDgemm()
+///          cublasDgemm()
 ///          cublasDgemmStridedBatched()
+///          cublasGemmEx()
+///          cublasGemmStridedBatchedEx()
 ///
 /// HISTORY: Written by Rob Van der Wijngaart, February 2009.
 ///          Converted to C++11 by Jeff Hammond, December, 2017.
@@ -62,151 +75,186 @@
 #include "prk_util.h"
 #include "prk_cuda.h"
 
-__global__ void init(int order, const int matrices, double * A, double * B, double * C)
+#include <cuda_fp16.h>
+#if defined(__CUDACC_VER_MAJOR__) && (__CUDACC_VER_MAJOR__ >= 11)
+#define PRK_HAVE_BF16
+#include <cuda_bf16.h>
+#endif
+
+// TA is the storage type of the inputs A and B, TC the type in which
+// cuBLAS accumulates and stores C (fp32 for the 16-bit input modes)
+template <typename TA, typename TC>
+__global__ void init(int order, const int matrices, TA * A, TA * B, TC * C)
 {
     int i = blockIdx.x * blockDim.x + threadIdx.x;
     int j = blockIdx.y * blockDim.y + threadIdx.y;
 
     for (int b=0; b<matrices; ++b) {
       if ((i<order) && (j<order)) {
-        A[b*order*order+i*order+j] = i;
-        B[b*order*order+i*order+j] = i;
-        C[b*order*order+i*order+j] = 0;
+        A[b*order*order+i*order+j] = static_cast<TA>(static_cast<float>(i));
+        B[b*order*order+i*order+j] = static_cast<TA>(static_cast<float>(i));
+        C[b*order*order+i*order+j] = static_cast<TC>(0.0f);
       }
     }
 }
 
-__global__ void init(int order, const int matrices, double * C)
+template <typename TC>
+__global__ void init(int order, const int matrices, TC * C)
 {
     int i = blockIdx.x * blockDim.x + threadIdx.x;
     int j = blockIdx.y * blockDim.y + threadIdx.y;
 
     for (int b=0; b<matrices; ++b) {
       if ((i<order) && (j<order)) {
-        C[b*order*order+i*order+j] = 0;
+        C[b*order*order+i*order+j] = static_cast<TC>(0.0f);
       }
     }
 }
 
-void prk_dgemm(const cublasHandle_t & h,
-               const int order,
-               const int batches,
-               double * A,
-               double * B,
-               double * C)
+// one overload per precision mode; the template harness below picks the
+// right one from the storage types
+
+void prk_gemm(const cublasHandle_t & h, const int order,
+              const double * A, const double * B, double * C)
 {
     const double alpha = 1.0;
     const double beta  = 1.0;
+    prk::CUDA::check( cublasDgemm(h,
+                                  CUBLAS_OP_N, CUBLAS_OP_N, // opA, opB
+                                  order, order, order,      // m, n, k
+                                  &alpha,                   // alpha
+                                  A, order,                 // A, lda
+                                  B, order,                 // B, ldb
+                                  &beta,                    // beta
+                                  C, order) );              // C, ldc
+}
 
-    for (int b=0; b<batches; ++b) {
-        double * pA = &(A[b*order*order]);
-        double * pB = &(B[b*order*order]);
-        double * pC = &(C[b*order*order]);
-        prk::CUDA::check( cublasDgemm(h,
-                                      CUBLAS_OP_N, CUBLAS_OP_N, // opA, opB
-                                      order, order, order,      // m, n, k
-                                      &alpha,                   // alpha
-                                      pA, order,                // A, lda
-                                      pB, order,                // B, ldb
-                                      &beta,                    // beta
-                                      pC, order) );             // C, ldc
-    }
-    prk::CUDA::check( cudaDeviceSynchronize() );
+void prk_gemm(const cublasHandle_t & h, const int order,
+              const float * A, const float * B, float * C)
+{
+    const float alpha = 1.0f;
+    const float beta  = 1.0f;
+    prk::CUDA::check( cublasSgemm(h,
+                                  CUBLAS_OP_N, CUBLAS_OP_N,
+                                  order, order, order,
+                                  &alpha,
+                                  A, order,
+                                  B, order,
+                                  &beta,
+                                  C, order) );
+}
+
+void prk_gemm(const cublasHandle_t & h, const int order,
+              const __half * A, const __half * B, float * C)
+{
+    const float alpha = 1.0f;
+    const float beta  = 1.0f;
+    prk::CUDA::check( cublasGemmEx(h,
+                                   CUBLAS_OP_N, CUBLAS_OP_N,
+                                   order, order, order,
+                                   &alpha,
+                                   A, CUDA_R_16F, order,
+                                   B, CUDA_R_16F, order,
+                                   &beta,
+                                   C, CUDA_R_32F, order,
+                                   CUDA_R_32F,
+                                   CUBLAS_GEMM_DEFAULT_TENSOR_OP) );
 }
 
-void prk_bgemm(const cublasHandle_t & h,
-               const int order,
-               const int batches,
-               double * A,
-               double * B,
-               double * C)
+#ifdef PRK_HAVE_BF16
+void prk_gemm(const cublasHandle_t & h, const int order,
+              const __nv_bfloat16 * A, const __nv_bfloat16 * B, float * C)
+{
+    const float alpha = 1.0f;
+    const float beta  = 1.0f;
+    prk::CUDA::check( cublasGemmEx(h,
+                                   CUBLAS_OP_N, CUBLAS_OP_N,
+                                   order, order, order,
+                                   &alpha,
+                                   A, CUDA_R_16BF, order,
+                                   B, CUDA_R_16BF, order,
+                                   &beta,
+                                   C, CUDA_R_32F, order,
+                                   CUDA_R_32F,
+                                   CUBLAS_GEMM_DEFAULT_TENSOR_OP) );
+}
+#endif
+
+void prk_bgemm(const cublasHandle_t & h, const int order, const int batches,
+               const double * A, const double * B, double * C)
 {
     const double alpha = 1.0;
     const double beta  = 1.0;
-
     prk::CUDA::check( cublasDgemmStridedBatched(h,
                                                 CUBLAS_OP_N, CUBLAS_OP_N,
                                                 order, order, order,
                                                 &alpha,
-                                                (const double *)A, order, order*order,
-                                                (const double *)B, order, order*order,
+                                                A, order, order*order,
+                                                B, order, order*order,
                                                 &beta,
                                                 C, order, order*order,
                                                 batches) );
-    prk::CUDA::check( cudaDeviceSynchronize() );
-
-    //  cublasStatus_t cublasDgemmBatched(cublasHandle_t handle,
-    //                                    cublasOperation_t transa,
-    //                                    cublasOperation_t transb,
-    //                                    int m, int n, int k,
-    //                                    const double          *alpha,
-    //                                    const double          *Aarray[], int lda,
-    //                                    const double          *Barray[], int ldb,
-    //                                    const double          *beta,
-    //                                    double          *Carray[], int ldc,
-    //                                    int batchCount)
 }
 
-int main(int argc, char * argv[])
+void prk_bgemm(const cublasHandle_t & h, const int order, const int batches,
+               const float * A, const float * B, float * C)
 {
-  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
-  std::cout << "C++11/CUBLAS Dense matrix-matrix multiplication: C += A x B" << std::endl;
-
-  prk::CUDA::info info;
-  info.print();
-
-  //////////////////////////////////////////////////////////////////////
-  /// Read and test input parameters
-  //////////////////////////////////////////////////////////////////////
-
-  int iterations;
-  int order;
-  int batches = 0;
-  int input_copy = 0;
-  try {
-      if (argc < 2) {
-        throw "Usage: <# iterations> <matrix order> [<batches>] [<copy input every iteration [0/1]>]";
-      }
-
-      iterations  = std::atoi(argv[1]);
-      if (iterations < 1) {
-        throw "ERROR: iterations must be >= 1";
-      }
-
-      order = std::atoi(argv[2]);
-      if (order <= 0) {
-        throw "ERROR: Matrix Order must be greater than 0";
-      } else if (order > std::floor(std::sqrt(INT_MAX))) {
-        throw "ERROR: matrix dimension too large - overflow risk";
-      }
-
-      if (argc>3) {
-        batches = std::atoi(argv[3]);
-      }
-
-      if (argc > 4) {
-        input_copy = std::atoi(argv[3]);
-      }
-  }
-  catch (const char * e) {
-    std::cout << e << std::endl;
-    return 1;
-  }
+    const float alpha = 1.0f;
+    const float beta  = 1.0f;
+    prk::CUDA::check( cublasSgemmStridedBatched(h,
+                                                CUBLAS_OP_N, CUBLAS_OP_N,
+                                                order, order, order,
+                                                &alpha,
+                                                A, order, order*order,
+                                                B, order, order*order,
+                                                &beta,
+                                                C, order, order*order,
+                                                batches) );
+}
 
-  std::cout << "Number of iterations = " << iterations << std::endl;
-  std::cout << "Matrix order         = " << order << std::endl;
-  if (batches == 0) {
-      std::cout << "No batching" << std::endl;
-  } else if (batches < 0) {
-      std::cout << "Batch size           = " << -batches << " (loop over legacy BLAS)" << std::endl;
-  } else if (batches > 0) {
-      std::cout << "Batch size           = " <<  batches << " (batched BLAS)" << std::endl;
-  }
-  std::cout << "Input copy           = " << (input_copy ? "yes" : "no") << std::endl;
+void prk_bgemm(const cublasHandle_t & h, const int order, const int batches,
+               const __half * A, const __half * B, float * C)
+{
+    const float alpha = 1.0f;
+    const float beta  = 1.0f;
+    prk::CUDA::check( cublasGemmStridedBatchedEx(h,
+                                                 CUBLAS_OP_N, CUBLAS_OP_N,
+                                                 order, order, order,
+                                                 &alpha,
+                                                 A, CUDA_R_16F, order, order*order,
+                                                 B, CUDA_R_16F, order, order*order,
+                                                 &beta,
+                                                 C, CUDA_R_32F, order, order*order,
+                                                 batches,
+                                                 CUDA_R_32F,
+                                                 CUBLAS_GEMM_DEFAULT_TENSOR_OP) );
+}
 
-  cublasHandle_t h;
-  prk::CUDA::check( cublasCreate(&h) );
+#ifdef PRK_HAVE_BF16
+void prk_bgemm(const cublasHandle_t & h, const int order, const int batches,
+               const __nv_bfloat16 * A, const __nv_bfloat16 * B, float * C)
+{
+    const float alpha = 1.0f;
+    const float beta  = 1.0f;
+    prk::CUDA::check( cublasGemmStridedBatchedEx(h,
+                                                 CUBLAS_OP_N, CUBLAS_OP_N,
+                                                 order, order, order,
+                                                 &alpha,
+                                                 A, CUDA_R_16BF, order, order*order,
+                                                 B, CUDA_R_16BF, order, order*order,
+                                                 &beta,
+                                                 C, CUDA_R_32F, order, order*order,
+                                                 batches,
+                                                 CUDA_R_32F,
+                                                 CUBLAS_GEMM_DEFAULT_TENSOR_OP) );
+}
+#endif
 
+template <typename TA, typename TC>
+int run(prk::CUDA::info & info, const cublasHandle_t & h,
+        const int iterations, const int order, const int batches,
+        const int input_copy, const double epsilon)
+{
   const int tile_size = 32;
   dim3 dimGrid(prk::divceil(order,tile_size),prk::divceil(order,tile_size),1);
   dim3 dimBlock(tile_size, tile_size, 1);
@@ -218,39 +266,41 @@ int main(int argc, char * argv[])
   //////////////////////////////////////////////////////////////////////
 
   double dgemm_time(0);
+  double setup_time = prk::wtime();
 
   const int matrices = (batches==0 ? 1 : abs(batches));
   const size_t nelems = (size_t)order * (size_t)order;
-  const size_t bytes = nelems * sizeof(double);
+  const size_t a_bytes = nelems * sizeof(TA);
+  const size_t c_bytes = nelems * sizeof(TC);
 
   // host buffers
-  double * h_a;
-  double * h_b;
-  double * h_c;
-  prk::CUDA::check( cudaMallocHost((void**)&h_a, bytes) );
-  prk::CUDA::check( cudaMallocHost((void**)&h_b, bytes) );
-  prk::CUDA::check( cudaMallocHost((void**)&h_c, matrices*bytes) );
+  TA * h_a;
+  TA * h_b;
+  TC * h_c;
+  prk::CUDA::check( cudaMallocHost((void**)&h_a, a_bytes) );
+  prk::CUDA::check( cudaMallocHost((void**)&h_b, a_bytes) );
+  prk::CUDA::check( cudaMallocHost((void**)&h_c, matrices*c_bytes) );
 
   // device buffers
-  double * d_a;
-  double * d_b;
-  double * d_c;
-  prk::CUDA::check( cudaMalloc((void**)&d_a, matrices*bytes) );
-  prk::CUDA::check( cudaMalloc((void**)&d_b, matrices*bytes) );
-  prk::CUDA::check( cudaMalloc((void**)&d_c, matrices*bytes) );
+  TA * d_a;
+  TA * d_b;
+  TC * d_c;
+  prk::CUDA::check( cudaMalloc((void**)&d_a, matrices*a_bytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_b, matrices*a_bytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_c, matrices*c_bytes) );
 
   if (input_copy) {
 
     for (int i=0; i<order; ++i) {
       for (int j=0; j<order; ++j) {
-         h_a[i*order+j] = i;
-         h_b[i*order+j] = i;
+         h_a[i*order+j] = static_cast<TA>(static_cast<float>(i));
+         h_b[i*order+j] = static_cast<TA>(static_cast<float>(i));
       }
     }
 
     for (int b=0; b<matrices; ++b) {
-      prk::CUDA::check( cudaMemcpyAsync(&(d_a[b*order*order]), h_a, bytes, cudaMemcpyHostToDevice) );
-      prk::CUDA::check( cudaMemcpyAsync(&(d_b[b*order*order]), h_b, bytes, cudaMemcpyHostToDevice) );
+      prk::CUDA::check( cudaMemcpyAsync(&(d_a[b*nelems]), h_a, a_bytes, cudaMemcpyHostToDevice) );
+      prk::CUDA::check( cudaMemcpyAsync(&(d_b[b*nelems]), h_b, a_bytes, cudaMemcpyHostToDevice) );
     }
     prk::CUDA::check( cudaDeviceSynchronize() );
 
@@ -261,33 +311,36 @@ int main(int argc, char * argv[])
     init<<<dimGrid, dimBlock>>>(order, matrices, d_a, d_b, d_c);
 
   }
+  prk::CUDA::check( cudaDeviceSynchronize() );
+  setup_time = prk::wtime() - setup_time;
 
   {
-    for (auto iter = 0; iter<=iterations; iter++) {
+    for (int iter = 0; iter<=iterations; iter++) {
 
       if (iter==1) dgemm_time = prk::wtime();
 
       if (input_copy) {
         for (int b=0; b<matrices; ++b) {
-          prk::CUDA::check( cudaMemcpyAsync(&(d_a[b*order*order]), h_a, bytes, cudaMemcpyHostToDevice) );
-          prk::CUDA::check( cudaMemcpyAsync(&(d_b[b*order*order]), h_b, bytes, cudaMemcpyHostToDevice) );
+          prk::CUDA::check( cudaMemcpyAsync(&(d_a[b*nelems]), h_a, a_bytes, cudaMemcpyHostToDevice) );
+          prk::CUDA::check( cudaMemcpyAsync(&(d_b[b*nelems]), h_b, a_bytes, cudaMemcpyHostToDevice) );
         }
         prk::CUDA::check( cudaDeviceSynchronize() );
       }
 
-      if (batches == 0) {
-        prk_dgemm(h, order, matrices, d_a, d_b, d_c);
-      } else if (batches < 0) {
-        prk_dgemm(h, order, matrices, d_a, d_b, d_c);
-      } else if (batches > 0) {
+      if (batches > 0) {
         prk_bgemm(h, order, matrices, d_a, d_b, d_c);
+      } else {
+        for (int b=0; b<matrices; ++b) {
+          prk_gemm(h, order, &(d_a[b*nelems]), &(d_b[b*nelems]), &(d_c[b*nelems]));
+        }
       }
+      prk::CUDA::check( cudaDeviceSynchronize() );
     }
     dgemm_time = prk::wtime() - dgemm_time;
   }
 
   // copy output back to host
-  prk::CUDA::check( cudaMemcpyAsync(&(h_c[0]), d_c, matrices*bytes, cudaMemcpyDeviceToHost) );
+  prk::CUDA::check( cudaMemcpyAsync(&(h_c[0]), d_c, matrices*c_bytes, cudaMemcpyDeviceToHost) );
 
   prk::CUDA::check( cudaFree(d_c) );
   prk::CUDA::check( cudaFree(d_b) );
@@ -296,34 +349,36 @@ int main(int argc, char * argv[])
   prk::CUDA::check( cudaFreeHost(h_a) );
   prk::CUDA::check( cudaFreeHost(h_b) );
 
-  prk::CUDA::check( cublasDestroy(h) );
-
   prk::CUDA::check( cudaDeviceSynchronize() );
 
   //////////////////////////////////////////////////////////////////////
   /// Analyze and output results
   //////////////////////////////////////////////////////////////////////
 
-  const double epsilon = 1.0e-8;
+  double verify_time = prk::wtime();
+
   const double forder = static_cast<double>(order);
   const double reference = 0.25 * std::pow(forder,3) * std::pow(forder-1.0,2) * (iterations+1);
   double residuum(0);
   for (int b=0; b<matrices; ++b) {
-      const auto checksum = prk::reduce( &(h_c[b*order*order+0]), &(h_c[b*order*order+nelems]), 0.0);
+      double checksum(0);
+      for (size_t i=0; i<nelems; ++i) {
+          checksum += static_cast<double>(h_c[b*nelems+i]);
+      }
       residuum += std::abs(checksum-reference)/reference;
   }
   residuum/=matrices;
+  verify_time = prk::wtime() - verify_time;
 
   if (residuum < epsilon) {
-#if VERBOSE
-    std::cout << "Reference checksum = " << reference << "\n"
-              << "Actual checksum = " << checksum << std::endl;
-#endif
     std::cout << "Solution validates" << std::endl;
     auto avgtime = dgemm_time/iterations/matrices;
     auto nflops = 2.0 * std::pow(forder,3);
     std::cout << "Rate (MF/s): " << 1.0e-6 * nflops/avgtime
               << " Avg time (s): " << avgtime << std::endl;
+    std::cout << "Setup time (s): " << setup_time
+              << " Compute time (s): " << dgemm_time
+              << " Verify time (s): " << verify_time << std::endl;
   } else {
     std::cout << "Reference checksum = " << reference << "\n"
               << "Residuum           = " << residuum << std::endl;
@@ -335,4 +390,104 @@ int main(int argc, char * argv[])
   return 0;
 }
 
+int main(int argc, char * argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11/CUBLAS Dense matrix-matrix multiplication: C += A x B" << std::endl;
+
+  prk::CUDA::info info;
+  // enumerating and printing device properties is measurable cold-start
+  // cost in launch-dominated usage, so fast start skips it
+  if (!prk::fast_start()) info.print();
+
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations;
+  int order;
+  int batches = 0;
+  int input_copy = 0;
+  std::string precision = "fp64";
+  try {
+      if (argc < 2) {
+        throw "Usage: <# iterations> <matrix order> [<batches>] [<copy input every iteration [0/1]>] [<fp64|fp32|tf32|bf16|fp16>]";
+      }
+
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
 
+      order = std::atoi(argv[2]);
+      if (order <= 0) {
+        throw "ERROR: Matrix Order must be greater than 0";
+      } else if (order > std::floor(std::sqrt(INT_MAX))) {
+        throw "ERROR: matrix dimension too large - overflow risk";
+      }
+
+      if (argc>3) {
+        batches = std::atoi(argv[3]);
+      }
+
+      if (argc > 4) {
+        input_copy = std::atoi(argv[4]);
+      }
+
+      if (argc > 5) {
+        precision = std::string(argv[5]);
+        if (precision != "fp64" && precision != "fp32" && precision != "tf32" &&
+            precision != "bf16" && precision != "fp16") {
+          throw "ERROR: precision must be one of fp64, fp32, tf32, bf16, fp16";
+        }
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Startup time (s)     = " << prk::startup_time() << std::endl;
+  std::cout << "Matrix order         = " << order << std::endl;
+  if (batches == 0) {
+      std::cout << "No batching" << std::endl;
+  } else if (batches < 0) {
+      std::cout << "Batch size           = " << -batches << " (loop over legacy BLAS)" << std::endl;
+  } else if (batches > 0) {
+      std::cout << "Batch size           = " <<  batches << " (batched BLAS)" << std::endl;
+  }
+  std::cout << "Input copy           = " << (input_copy ? "yes" : "no") << std::endl;
+  std::cout << "Precision            = " << precision << std::endl;
+
+  cublasHandle_t h;
+  prk::CUDA::check( cublasCreate(&h) );
+
+  // the threshold tracks the precision of the inputs: the 16-bit modes
+  // and TF32 round the operands before the (fp32-accumulated) multiply
+  int result(1);
+  if (precision == "fp64") {
+      result = run<double,double>(info, h, iterations, order, batches, input_copy, 1.0e-8);
+  } else if (precision == "fp32") {
+      result = run<float,float>(info, h, iterations, order, batches, input_copy, 1.0e-4);
+  } else if (precision == "tf32") {
+#if defined(CUBLAS_VER_MAJOR) && (CUBLAS_VER_MAJOR >= 11)
+      prk::CUDA::check( cublasSetMathMode(h, CUBLAS_TF32_TENSOR_OP_MATH) );
+      result = run<float,float>(info, h, iterations, order, batches, input_copy, 1.0e-3);
+#else
+      std::cout << "ERROR: TF32 requires cuBLAS 11 or later" << std::endl;
+#endif
+  } else if (precision == "bf16") {
+#ifdef PRK_HAVE_BF16
+      result = run<__nv_bfloat16,float>(info, h, iterations, order, batches, input_copy, 1.0e-1);
+#else
+      std::cout << "ERROR: BF16 requires CUDA 11 or later" << std::endl;
+#endif
+  } else if (precision == "fp16") {
+      result = run<__half,float>(info, h, iterations, order, batches, input_copy, 1.0e-2);
+  }
+
+  prk::CUDA::check( cublasDestroy(h) );
+
+  return result;
+}
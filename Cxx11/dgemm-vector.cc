@@ -155,16 +155,22 @@ int main(int argc, char * argv[])
   //////////////////////////////////////////////////////////////////////
 
   double dgemm_time(0);
+  double setup_time = prk::wtime();
 
   std::vector<double> A(order*order);
   std::vector<double> B(order*order);
   std::vector<double> C(order*order,0.0);
-  for (auto i=0; i<order; ++i) {
-    for (auto j=0; j<order; ++j) {
-       A[i*order+j] = i;
-       B[i*order+j] = i;
+  // initialize row by row across the hardware threads; at large orders
+  // a serial fill takes longer than the timed GEMMs
+  prk::parallel_for((size_t)order, [&](size_t first, size_t last) {
+    for (size_t i=first; i<last; ++i) {
+      for (auto j=0; j<order; ++j) {
+         A[i*order+j] = i;
+         B[i*order+j] = i;
+      }
     }
-  }
+  });
+  setup_time = prk::wtime() - setup_time;
 
   {
     for (auto iter = 0; iter<=iterations; iter++) {
@@ -184,12 +190,15 @@ int main(int argc, char * argv[])
   /// Analyze and output results
   //////////////////////////////////////////////////////////////////////
 
+  double verify_time = prk::wtime();
+
   const auto forder = static_cast<double>(order);
   const auto reference = 0.25 * std::pow(forder,3) * std::pow(forder-1.0,2) * (iterations+1);
   const auto checksum = prk::reduce(C.begin(), C.end(), 0.0);
 
   const auto epsilon = 1.0e-8;
   const auto residuum = std::abs(checksum-reference)/reference;
+  verify_time = prk::wtime() - verify_time;
   if (residuum < epsilon) {
 #if VERBOSE
     std::cout << "Reference checksum = " << reference << "\n"
@@ -200,6 +209,9 @@ int main(int argc, char * argv[])
     auto nflops = 2.0 * std::pow(forder,3);
     std::cout << "Rate (MF/s): " << 1.0e-6 * nflops/avgtime
               << " Avg time (s): " << avgtime << std::endl;
+    std::cout << "Setup time (s): " << setup_time
+              << " Compute time (s): " << dgemm_time
+              << " Verify time (s): " << verify_time << std::endl;
   } else {
     std::cout << "Reference checksum = " << reference << "\n"
               << "Actual checksum = " << checksum << std::endl;
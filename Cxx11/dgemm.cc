@@ -41,7 +41,16 @@
 ///          is carried out, and, optionally, a tile size for matrix
 ///          blocking
 ///
-///          <progname> <# iterations> <matrix order> [<tile size>]
+///          <progname> <# iterations> <matrix order> [<tile size>] [<batches>]
+///                     [<fp64|fp32>]
+///
+///          A positive batch count multiplies that many independent
+///          matrices of the given (small) order per iteration, stored
+///          contiguously with stride order*order, to measure small-GEMM
+///          throughput rather than single-matrix performance.  The
+///          optional precision argument selects single or double
+///          precision arithmetic (default fp64); the validation
+///          threshold is relaxed accordingly.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
@@ -60,10 +69,11 @@
 
 #include "prk_util.h"
 
+template <typename T>
 void prk_dgemm(const int order,
-               const prk::vector<double> & A,
-               const prk::vector<double> & B,
-                     prk::vector<double> & C)
+               const prk::vector<T> & A,
+               const prk::vector<T> & B,
+                     prk::vector<T> & C)
 {
     PRAGMA_SIMD
     for (auto i=0; i<order; ++i) {
@@ -77,10 +87,11 @@ void prk_dgemm(const int order,
     }
 }
 
+template <typename T>
 void prk_dgemm(const int order, const int tile_size,
-               const prk::vector<double> & A,
-               const prk::vector<double> & B,
-                     prk::vector<double> & C)
+               const prk::vector<T> & A,
+               const prk::vector<T> & B,
+                     prk::vector<T> & C)
 {
     for (auto it=0; it<order; it+=tile_size) {
       for (auto jt=0; jt<order; jt+=tile_size) {
@@ -104,92 +115,148 @@ void prk_dgemm(const int order, const int tile_size,
     }
 }
 
-int main(int argc, char * argv[])
+#if defined(__linux__)
+// out-of-core tiling: rows it..iend of A and C stay mapped for a whole
+// band while all of B streams through once, so the madvise calls follow
+// the reuse pattern of the blocked loop instead of fighting it
+template <typename T>
+void prk_dgemm_ooc(const int order, const int tile_size,
+                   prk::filemap<T> & A,
+                   prk::filemap<T> & B,
+                   prk::filemap<T> & C)
 {
-  //////////////////////////////////////////////////////////////////////
-  /// Read and test input parameters
-  //////////////////////////////////////////////////////////////////////
-
-  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
-  std::cout << "C++11 Dense matrix-matrix multiplication: C += A x B" << std::endl;
-
-  int iterations;
-  int order;
-  int tile_size;
-  try {
-      if (argc < 3) {
-        throw "Usage: <# iterations> <matrix order> [tile size]";
-      }
-
-      iterations  = std::atoi(argv[1]);
-      if (iterations < 1) {
-        throw "ERROR: iterations must be >= 1";
+    const size_t band = (size_t)tile_size*order;
+    for (auto it=0; it<order; it+=tile_size) {
+      A.will_need((size_t)it*order, band);
+      C.will_need((size_t)it*order, band);
+      for (auto jt=0; jt<order; jt+=tile_size) {
+        for (auto kt=0; kt<order; kt+=tile_size) {
+          if (jt==0) B.will_need((size_t)kt*order, band);
+          auto iend = std::min(order,it+tile_size);
+          auto jend = std::min(order,jt+tile_size);
+          auto kend = std::min(order,kt+tile_size);
+          for (auto i=it; i<iend; ++i) {
+            for (auto k=kt; k<kend; ++k) {
+              PRAGMA_SIMD
+              for (auto j=jt; j<jend; ++j) {
+                C[(size_t)i*order+j] += A[(size_t)i*order+k] * B[(size_t)k*order+j];
+              }
+            }
+          }
+        }
       }
+      // the finished bands go back to the file
+      A.done_with((size_t)it*order, band);
+      C.done_with((size_t)it*order, band);
+    }
+}
+#endif
 
-      order = std::atoi(argv[2]);
-      if (order <= 0) {
-        throw "ERROR: Matrix Order must be greater than 0";
-      } else if (order > std::floor(std::sqrt(INT_MAX))) {
-        throw "ERROR: matrix dimension too large - overflow risk";
+template <typename T>
+void prk_bgemm(const int order, const int batches,
+               const prk::vector<T> & A,
+               const prk::vector<T> & B,
+                     prk::vector<T> & C)
+{
+    for (auto b=0; b<batches; ++b) {
+      const size_t offset = (size_t)b*order*order;
+      PRAGMA_SIMD
+      for (auto i=0; i<order; ++i) {
+        PRAGMA_SIMD
+        for (auto k=0; k<order; ++k) {
+          PRAGMA_SIMD
+          for (auto j=0; j<order; ++j) {
+              C[offset+i*order+j] += A[offset+i*order+k] * B[offset+k*order+j];
+          }
+        }
       }
+    }
+}
 
-      tile_size = (argc>3) ? std::atoi(argv[3]) : 32;
-      if (tile_size <= 0) tile_size = order;
-
-  }
-  catch (const char * e) {
-    std::cout << e << std::endl;
-    return 1;
-  }
-
-  std::cout << "Number of iterations = " << iterations << std::endl;
-  std::cout << "Matrix order         = " << order << std::endl;
-  if (tile_size < order) {
-      std::cout << "Tile size            = " << tile_size << std::endl;
-  } else {
-      std::cout << "Untiled (IKJ loop order)" << std::endl;
-  }
-
+template <typename T>
+int run(const int iterations, const int order, const int tile_size, const int batches)
+{
   //////////////////////////////////////////////////////////////////////
   /// Allocate space for matrices
   //////////////////////////////////////////////////////////////////////
 
   double dgemm_time(0);
+  double setup_time = prk::wtime();
+
+  prk::counters perf;
 
-  prk::vector<double> A(order*order);
-  prk::vector<double> B(order*order);
-  prk::vector<double> C(order*order,0.0);
-  for (auto i=0; i<order; ++i) {
-    for (auto j=0; j<order; ++j) {
-       A[i*order+j] = i;
-       B[i*order+j] = i;
+  prk::energy_meter energy;
+
+  prk::timing tstats(iterations);
+
+  prk::baseline base("dgemm");
+  base.set("order", order);
+  base.set("tile_size", tile_size);
+  base.set("batches", batches);
+  base.set("bits", 8*sizeof(T));
+
+  const int matrices = (batches==0 ? 1 : batches);
+  const size_t nelems = (size_t)order * (size_t)order;
+
+  prk::vector<T> A(matrices*nelems);
+  prk::vector<T> B(matrices*nelems);
+  prk::vector<T> C(matrices*nelems,static_cast<T>(0));
+  // initialize row by row across the hardware threads; at large orders
+  // a serial fill takes longer than the timed GEMMs
+  prk::parallel_for((size_t)matrices*order, [&](size_t first, size_t last) {
+    for (size_t r=first; r<last; ++r) {
+      const size_t b = r/order;
+      const size_t i = r%order;
+      for (auto j=0; j<order; ++j) {
+         A[b*nelems+i*order+j] = i;
+         B[b*nelems+i*order+j] = i;
+      }
     }
-  }
+  });
+  setup_time = prk::wtime() - setup_time;
 
   {
     for (auto iter = 0; iter<=iterations; iter++) {
 
-      if (iter==1) dgemm_time = prk::wtime();
+      if (iter==1) { dgemm_time = prk::wtime(); perf.start(); energy.start(); }
 
-      if (tile_size < order) {
+      const double it0 = tstats.enabled() ? prk::wtime() : 0.0;
+
+      if (batches > 0) {
+          prk_bgemm(order, batches, A, B, C);
+      } else if (tile_size < order) {
           prk_dgemm(order, tile_size, A, B, C);
       } else {
           prk_dgemm(order, A, B, C);
       }
+
+      if (tstats.enabled() && iter>0) tstats.record(prk::wtime()-it0);
     }
     dgemm_time = prk::wtime() - dgemm_time;
+    energy.stop();
+    perf.stop();
   }
 
   //////////////////////////////////////////////////////////////////////
   /// Analyze and output results
   //////////////////////////////////////////////////////////////////////
 
+  double verify_time = prk::wtime();
+
   const auto forder = static_cast<double>(order);
   const auto reference = 0.25 * std::pow(forder,3) * std::pow(forder-1.0,2) * (iterations+1);
-  const auto checksum = prk::reduce(C.begin(), C.end(), 0.0);
+  const auto checksum = prk::reduce(C.begin(), C.begin()+nelems, 0.0);
 
-  const auto epsilon = 1.0e-8;
-  const auto residuum = std::abs(checksum-reference)/reference;
+  // single precision accumulates appreciable rounding error, so the
+  // validation threshold scales with the working precision
+  const double epsilon = (std::is_same<T,float>::value ? 1.0e-4 : 1.0e-8);
+  auto residuum = std::abs(checksum-reference)/reference;
+  for (auto b=1; b<matrices; ++b) {
+    const auto batchsum = prk::reduce(C.begin()+b*nelems, C.begin()+(b+1)*nelems, 0.0);
+    residuum += std::abs(batchsum-reference)/reference;
+  }
+  residuum /= matrices;
+  verify_time = prk::wtime() - verify_time;
   if (residuum < epsilon) {
 #if VERBOSE
     std::cout << "Reference checksum = " << reference << "\n"
@@ -197,9 +264,16 @@ int main(int argc, char * argv[])
 #endif
     std::cout << "Solution validates" << std::endl;
     auto avgtime = dgemm_time/iterations;
-    auto nflops = 2.0 * std::pow(forder,3);
+    auto nflops = 2.0 * std::pow(forder,3) * matrices;
+    tstats.report();
+    perf.report(dgemm_time, nflops*iterations, 3.0*matrices*forder*forder*sizeof(T)*iterations);
     std::cout << "Rate (MF/s): " << 1.0e-6 * nflops/avgtime
               << " Avg time (s): " << avgtime << std::endl;
+    base.check("rate_mfs", 1.0e-6 * nflops/avgtime);
+    std::cout << "Setup time (s): " << setup_time
+              << " Compute time (s): " << dgemm_time
+              << " Verify time (s): " << verify_time << std::endl;
+    energy.report(1.0e-6 * nflops/avgtime, "MF/s");
   } else {
     std::cout << "Reference checksum = " << reference << "\n"
               << "Actual checksum = " << checksum << std::endl;
@@ -218,7 +292,294 @@ int main(int argc, char * argv[])
     return 1;
   }
 
+  // PRK_NUMA_COMPARE=1 reruns the multiplication threaded across all
+  // NUMA domains twice - once with a single B whose pages are
+  // interleaved over the domains, once with one replica of B bound to
+  // each domain and read socket-locally - so a single run quantifies
+  // what replicating the shared operand is worth on multi-socket
+  // machines.  Threads are pinned from the sysfs topology and rows of
+  // C are partitioned, so only the placement of B differs between the
+  // two sweeps.
+  if (std::getenv("PRK_NUMA_COMPARE") != nullptr && batches == 0) {
+    auto domains = prk::numa_domains();
+    if (domains.empty()) domains.push_back(0);
+
+    // (cpu, domain index) per worker; unpinned fallback when sysfs is
+    // unavailable
+    std::vector<std::pair<int,int>> workers;
+    for (size_t di=0; di<domains.size(); di++) {
+      for (int cpu : prk::numa_domain_cpus(domains[di])) {
+        workers.emplace_back(cpu, (int)di);
+      }
+    }
+    if (workers.empty()) {
+      const int nt = std::max(1u, std::thread::hardware_concurrency());
+      for (int t=0; t<nt; t++) workers.emplace_back(-1, 0);
+    }
+    const int nt = (int)workers.size();
+
+    prk::vector<T> NA(nelems);
+    prk::vector<T> NC(nelems);
+    prk::parallel_for((size_t)order, [&](size_t first, size_t last) {
+      for (size_t i=first; i<last; ++i) {
+        for (auto j=0; j<order; ++j) NA[i*order+j] = i;
+      }
+    });
+
+    auto sweep = [&](const std::vector<const T *> & bptr) {
+      std::fill(NC.begin(), NC.end(), static_cast<T>(0));
+      std::atomic<int> arrived(0);
+      std::atomic<bool> go(false);
+      std::vector<std::thread> pool;
+      for (int t=0; t<nt; t++) {
+        pool.emplace_back([&,t] {
+          if (workers[t].first >= 0) prk::bind_thread(workers[t].first);
+          const T * RESTRICT Bp = bptr[workers[t].second];
+          const int rlo = (int)((long)order*t/nt);
+          const int rhi = (int)((long)order*(t+1)/nt);
+          auto pass = [&] {
+            for (auto i=rlo; i<rhi; ++i) {
+              for (auto k=0; k<order; ++k) {
+                const T aik = NA[(size_t)i*order+k];
+                PRAGMA_SIMD
+                for (auto j=0; j<order; ++j) {
+                  NC[(size_t)i*order+j] += aik * Bp[(size_t)k*order+j];
+                }
+              }
+            }
+          };
+          // warmup pass, then rendezvous so the timed passes start together
+          pass();
+          arrived.fetch_add(1);
+          while (!go.load()) std::this_thread::yield();
+          for (auto it=0; it<iterations; ++it) pass();
+        });
+      }
+      while (arrived.load() < nt) std::this_thread::yield();
+      const double t0 = prk::wtime();
+      go.store(true);
+      for (auto & t : pool) t.join();
+      const double t1 = prk::wtime() - t0;
+      const auto sum = prk::reduce(NC.begin(), NC.end(), 0.0);
+      if (std::abs(sum-reference)/reference > epsilon) {
+        std::cout << "WARNING: NUMA comparison sweep failed validation" << std::endl;
+      }
+      return t1;
+    };
+
+    const size_t bbytes = nelems*sizeof(T);
+
+    // one shared B, pages spread round-robin over the domains
+    prk::vector<T> BI(nelems);
+    prk::parallel_for((size_t)order, [&](size_t first, size_t last) {
+      for (size_t i=first; i<last; ++i) {
+        for (auto j=0; j<order; ++j) BI[i*order+j] = i;
+      }
+    });
+    prk::interleave_pages(BI.data(), bbytes);
+    std::vector<const T *> interleaved(domains.size(), BI.data());
+    const double t_int = sweep(interleaved);
+
+    // one replica of B per domain, bound to that domain
+    std::vector<prk::vector<T>> BR;
+    std::vector<const T *> replicated;
+    for (size_t di=0; di<domains.size(); di++) {
+      BR.emplace_back(nelems);
+      std::copy(BI.begin(), BI.end(), BR[di].begin());
+      prk::bind_pages(BR[di].data(), bbytes, domains[di]);
+      replicated.push_back(BR[di].data());
+    }
+    const double t_rep = sweep(replicated);
+
+    const auto nflops = 2.0 * std::pow(forder,3) * iterations;
+    std::cout << "NUMA comparison (" << nt << " threads, "
+              << domains.size() << " domains):" << std::endl;
+    std::cout << "  Interleaved B rate (MF/s): " << 1.0e-6 * nflops/t_int
+              << " Avg time (s): " << t_int/iterations << std::endl;
+    std::cout << "  Replicated  B rate (MF/s): " << 1.0e-6 * nflops/t_rep
+              << " Avg time (s): " << t_rep/iterations << std::endl;
+    std::cout << "  Replication speedup: " << t_int/t_rep << std::endl;
+  }
+
+  return 0;
+}
+
+#if defined(__linux__)
+// out-of-core run: the three matrices are file-backed and the blocked
+// multiplication drives madvise, so orders that exceed memory run at
+// storage bandwidth instead of dying; the reported rate is directly
+// comparable to an in-memory run of the same order
+template <typename T>
+int run_ooc(const int iterations, const int order, const int tile_size, const char * dir)
+{
+  double dgemm_time(0);
+  double setup_time = prk::wtime();
+
+  const size_t nelems = (size_t)order * (size_t)order;
+
+  std::unique_ptr<prk::filemap<T>> A, B, C;
+  try {
+    A.reset(new prk::filemap<T>(dir, "A", nelems));
+    B.reset(new prk::filemap<T>(dir, "B", nelems));
+    // file holes read as zero, so C needs no explicit fill
+    C.reset(new prk::filemap<T>(dir, "C", nelems));
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  prk::parallel_for((size_t)order, [&](size_t first, size_t last) {
+    for (size_t i=first; i<last; ++i) {
+      for (auto j=0; j<order; ++j) {
+        (*A)[i*order+j] = i;
+        (*B)[i*order+j] = i;
+      }
+    }
+  });
+  setup_time = prk::wtime() - setup_time;
+
+  {
+    for (auto iter = 0; iter<=iterations; iter++) {
+      if (iter==1) dgemm_time = prk::wtime();
+      prk_dgemm_ooc(order, std::min(tile_size,order), *A, *B, *C);
+    }
+    dgemm_time = prk::wtime() - dgemm_time;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  double verify_time = prk::wtime();
+
+  const auto forder = static_cast<double>(order);
+  const auto reference = 0.25 * std::pow(forder,3) * std::pow(forder-1.0,2) * (iterations+1);
+  const auto checksum = prk::reduce(C->begin(), C->end(), 0.0);
+
+  const double epsilon = (std::is_same<T,float>::value ? 1.0e-4 : 1.0e-8);
+  const auto residuum = std::abs(checksum-reference)/reference;
+  verify_time = prk::wtime() - verify_time;
+  if (residuum < epsilon) {
+#if VERBOSE
+    std::cout << "Reference checksum = " << reference << "\n"
+              << "Actual checksum = " << checksum << std::endl;
+#endif
+    std::cout << "Solution validates" << std::endl;
+    auto avgtime = dgemm_time/iterations;
+    auto nflops = 2.0 * std::pow(forder,3);
+    std::cout << "Rate (MF/s): " << 1.0e-6 * nflops/avgtime
+              << " Avg time (s): " << avgtime << std::endl;
+    std::cout << "Setup time (s): " << setup_time
+              << " Compute time (s): " << dgemm_time
+              << " Verify time (s): " << verify_time << std::endl;
+  } else {
+    std::cout << "Reference checksum = " << reference << "\n"
+              << "Actual checksum = " << checksum << std::endl;
+    return 1;
+  }
+
   return 0;
 }
+#endif
+
+int main(int argc, char * argv[])
+{
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11 Dense matrix-matrix multiplication: C += A x B" << std::endl;
+
+  int iterations;
+  int order;
+  int tile_size;
+  int batches = 0;
+  bool fp32 = false;
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <matrix order> [tile size] [batches] [fp64|fp32]";
+      }
+
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      const size_t order_input = prk::parse_size(argv[2]);
+      if (order_input == 0) {
+        throw "ERROR: Matrix Order must be greater than 0";
+      } else if (order_input > (size_t)std::floor(std::sqrt(INT_MAX))) {
+        throw "ERROR: matrix dimension too large - overflow risk";
+      }
+      order = (int)order_input;
+
+      tile_size = (argc>3) ? std::atoi(argv[3]) : 32;
+      if (tile_size <= 0) tile_size = order;
+
+      if (argc>4) {
+        batches = std::atoi(argv[4]);
+        if (batches < 0) {
+          throw "ERROR: batches must be >= 0";
+        }
+      }
+
+      if (argc>5) {
+        if      (std::string(argv[5]) == "fp64") fp32 = false;
+        else if (std::string(argv[5]) == "fp32") fp32 = true;
+        else throw "ERROR: precision must be 'fp64' or 'fp32'";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Startup time (s)     = " << prk::startup_time() << std::endl;
+  std::cout << "Matrix order         = " << order << std::endl;
+  if (tile_size < order) {
+      std::cout << "Tile size            = " << tile_size << std::endl;
+  } else {
+      std::cout << "Untiled (IKJ loop order)" << std::endl;
+  }
+  if (batches > 0) {
+      std::cout << "Batch size           = " << batches << " (strided layout)" << std::endl;
+  }
+  std::cout << "Precision            = " << (fp32 ? "fp32" : "fp64") << std::endl;
+
+  // PRK_OOC_DIR switches the matrices to file-backed storage, for orders
+  // that exceed memory
+  const char * ooc_path = prk::ooc_dir();
+#if !defined(__linux__)
+  if (ooc_path != nullptr) {
+    std::cout << "PRK_OOC_DIR ignored: file-backed arrays require Linux" << std::endl;
+    ooc_path = nullptr;
+  }
+#endif
+  if (ooc_path != nullptr && batches > 0) {
+    std::cout << "PRK_OOC_DIR ignored: out-of-core mode does not support batching" << std::endl;
+    ooc_path = nullptr;
+  }
+  if (ooc_path != nullptr) {
+    std::cout << "Backing store        = file-backed (" << ooc_path << ")" << std::endl;
+  }
+
+#if defined(__linux__)
+  if (ooc_path != nullptr) {
+    if (fp32) {
+        return run_ooc<float>(iterations, order, tile_size, ooc_path);
+    } else {
+        return run_ooc<double>(iterations, order, tile_size, ooc_path);
+    }
+  }
+#endif
+  if (fp32) {
+      return run<float>(iterations, order, tile_size, batches);
+  } else {
+      return run<double>(iterations, order, tile_size, batches);
+  }
+}
 
 
@@ -0,0 +1,256 @@
+///
+/// Copyright (c) 2019, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    gather
+///
+/// PURPOSE: To measure effective memory bandwidth of strided and indexed
+///          (gather/scatter) accesses.  The access pattern is a
+///          permutation of the vector indices, which fills the gap
+///          between nstream (unit stride) and Random (fully random).
+///
+/// USAGE:   The program takes as input the number of iterations, the
+///          vector length, and optionally the stride, the permutation
+///          window, and the operation
+///
+///          <progname> <# iterations> <vector length>
+///                     [<stride> [<window> [<gather|scatter>]]]
+///
+///          With window 0 (the default) the permutation visits element
+///          0, stride, 2*stride, ... before moving to the next offset.
+///          A positive window W instead shuffles the indices within
+///          each block of W consecutive elements, so W controls the
+///          locality of the accesses: W=1 is unit stride, W=length is a
+///          full random permutation.  On the device the window also
+///          governs how well gathers within a warp coalesce.
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// NOTES:   Because the index array is a permutation, every element is
+///          touched exactly once per iteration, so the checksum of the
+///          result has a closed form regardless of the pattern, and the
+///          scatter kernel is free of write conflicts between threads.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+#include "prk_cuda.h"
+
+__global__ void gather(const unsigned n, prk_float * A, const prk_float * B, const unsigned * idx)
+{
+    unsigned i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < n) {
+        A[i] += B[idx[i]];
+    }
+}
+
+__global__ void scatter(const unsigned n, prk_float * A, const prk_float * B, const unsigned * idx)
+{
+    unsigned i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < n) {
+        A[idx[i]] += B[i];
+    }
+}
+
+int main(int argc, char * argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11/CUDA strided/indexed gather-scatter" << std::endl;
+
+  prk::CUDA::info info;
+  info.print();
+
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations;
+  int length, stride, window;
+  bool do_scatter(false);
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <vector length> [<stride> [<window> [<gather|scatter>]]]";
+      }
+
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      length = std::atoi(argv[2]);
+      if (length <= 0) {
+        throw "ERROR: vector length must be positive";
+      }
+
+      stride = (argc>3) ? std::atoi(argv[3]) : 1;
+      if (stride < 1 || stride > length) {
+        throw "ERROR: stride must be in [1,length]";
+      }
+
+      window = (argc>4) ? std::atoi(argv[4]) : 0;
+      if (window < 0 || window > length) {
+        throw "ERROR: window must be in [0,length]";
+      }
+
+      if (argc > 5) {
+        if      (std::string(argv[5]) == "gather")  do_scatter = false;
+        else if (std::string(argv[5]) == "scatter") do_scatter = true;
+        else throw "ERROR: operation must be 'gather' or 'scatter'";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Vector length        = " << length << std::endl;
+  if (window > 0) {
+  std::cout << "Permutation window   = " << window << std::endl;
+  } else {
+  std::cout << "Stride               = " << stride << std::endl;
+  }
+  std::cout << "Operation            = " << (do_scatter ? "scatter" : "gather") << std::endl;
+
+  const int blockSize = 128;
+  dim3 dimBlock(blockSize, 1, 1);
+  dim3 dimGrid(prk::divceil(length,blockSize), 1, 1);
+
+  info.checkDims(dimBlock, dimGrid);
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  double gather_time(0);
+
+  // the index array is a permutation by construction: either a strided
+  // traversal or a blockwise shuffle of the identity
+  std::vector<unsigned> index(length);
+  if (window > 0) {
+    std::iota(index.begin(), index.end(), 0u);
+    std::mt19937_64 prng(42);
+    for (int w=0; w<length; w+=window) {
+      std::shuffle(index.begin()+w, index.begin()+std::min(length, w+window), prng);
+    }
+  } else {
+    int pos(0);
+    for (int o=0; o<stride; o++) {
+      for (int k=o; k<length; k+=stride) {
+        index[pos++] = static_cast<unsigned>(k);
+      }
+    }
+  }
+
+  const size_t bytes     = length * sizeof(prk_float);
+  const size_t idx_bytes = length * sizeof(unsigned);
+
+  prk_float * h_A;
+  prk_float * h_B;
+  prk::CUDA::check( cudaMallocHost((void**)&h_A, bytes) );
+  prk::CUDA::check( cudaMallocHost((void**)&h_B, bytes) );
+  for (int i=0; i<length; ++i) {
+    h_A[i] = static_cast<prk_float>(0);
+    h_B[i] = static_cast<prk_float>(i);
+  }
+
+  prk_float * d_A;
+  prk_float * d_B;
+  unsigned  * d_idx;
+  prk::CUDA::check( cudaMalloc((void**)&d_A, bytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_B, bytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_idx, idx_bytes) );
+  prk::CUDA::check( cudaMemcpy(d_A, h_A, bytes, cudaMemcpyHostToDevice) );
+  prk::CUDA::check( cudaMemcpy(d_B, h_B, bytes, cudaMemcpyHostToDevice) );
+  prk::CUDA::check( cudaMemcpy(d_idx, index.data(), idx_bytes, cudaMemcpyHostToDevice) );
+
+  {
+    for (int iter = 0; iter<=iterations; iter++) {
+
+      if (iter==1) gather_time = prk::wtime();
+
+      const unsigned n = static_cast<unsigned>(length);
+      if (do_scatter) {
+        scatter<<<dimGrid, dimBlock>>>(n, d_A, d_B, d_idx);
+      } else {
+        gather<<<dimGrid, dimBlock>>>(n, d_A, d_B, d_idx);
+      }
+#ifndef __CORIANDERCC__
+      prk::CUDA::check( cudaDeviceSynchronize() );
+#endif
+    }
+    gather_time = prk::wtime() - gather_time;
+  }
+
+  prk::CUDA::check( cudaMemcpy(h_A, d_A, bytes, cudaMemcpyDeviceToHost) );
+
+  prk::CUDA::check( cudaFree(d_idx) );
+  prk::CUDA::check( cudaFree(d_B) );
+  prk::CUDA::check( cudaFree(d_A) );
+  prk::CUDA::check( cudaFreeHost(h_B) );
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  // every element of B is added into A exactly once per iteration, so the
+  // sum of A is closed-form no matter what the permutation looks like
+  long double checksum(0);
+  for (int i=0; i<length; i++) checksum += h_A[i];
+  const long double n = static_cast<long double>(length);
+  const long double reference = (iterations+1.0L) * (n-1.0L)*n/2.0L;
+  const double abserr = static_cast<double>(std::fabs((double)(checksum-reference))/reference);
+
+  prk::CUDA::check( cudaFreeHost(h_A) );
+
+#ifdef VERBOSE
+  std::cout << "Checksum = " << static_cast<double>(checksum)
+            << "; reference = " << static_cast<double>(reference) << std::endl;
+#endif
+
+  const double epsilon(1.e-8);
+  if (abserr < epsilon) {
+    std::cout << "Solution validates" << std::endl;
+    double avgtime = gather_time/iterations;
+    // A is read and written, B and the index array are read
+    size_t moved = length * (3L*sizeof(prk_float) + sizeof(unsigned));
+    std::cout << "Rate (MB/s): " << 1.0e-6 * moved/avgtime
+              << " Avg time (s): " << avgtime << std::endl;
+  } else {
+    std::cout << "ERROR: Relative checksum error " << abserr
+              << " exceeds threshold " << epsilon << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
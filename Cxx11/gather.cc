@@ -0,0 +1,202 @@
+///
+/// Copyright (c) 2019, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    gather
+///
+/// PURPOSE: To measure effective memory bandwidth of strided and indexed
+///          (gather/scatter) accesses.  The access pattern is a
+///          permutation of the vector indices, which fills the gap
+///          between nstream (unit stride) and Random (fully random).
+///
+/// USAGE:   The program takes as input the number of iterations, the
+///          vector length, and optionally the stride, the permutation
+///          window, and the operation
+///
+///          <progname> <# iterations> <vector length>
+///                     [<stride> [<window> [<gather|scatter>]]]
+///
+///          With window 0 (the default) the permutation visits element
+///          0, stride, 2*stride, ... before moving to the next offset.
+///          A positive window W instead shuffles the indices within
+///          each block of W consecutive elements, so W controls the
+///          locality of the accesses: W=1 is unit stride, W=length is a
+///          full random permutation.  'gather' reads through the index
+///          array, 'scatter' writes through it.
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// NOTES:   Because the index array is a permutation, every element is
+///          touched exactly once per iteration, so the checksum of the
+///          result has a closed form regardless of the pattern.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+
+int main(int argc, char * argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11 strided/indexed gather-scatter" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations;
+  size_t length, stride, window;
+  bool scatter(false);
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <vector length> [<stride> [<window> [<gather|scatter>]]]";
+      }
+
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      length = prk::parse_size(argv[2]);
+      if (length <= 0) {
+        throw "ERROR: vector length must be positive";
+      }
+
+      stride = (argc>3) ? std::atol(argv[3]) : 1;
+      if (stride < 1 || stride > length) {
+        throw "ERROR: stride must be in [1,length]";
+      }
+
+      window = (argc>4) ? std::atol(argv[4]) : 0;
+      if (window > length) {
+        throw "ERROR: window must be in [0,length]";
+      }
+
+      if (argc > 5) {
+        if      (std::string(argv[5]) == "gather")  scatter = false;
+        else if (std::string(argv[5]) == "scatter") scatter = true;
+        else throw "ERROR: operation must be 'gather' or 'scatter'";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Vector length        = " << length << std::endl;
+  if (window > 0) {
+  std::cout << "Permutation window   = " << window << std::endl;
+  } else {
+  std::cout << "Stride               = " << stride << std::endl;
+  }
+  std::cout << "Operation            = " << (scatter ? "scatter" : "gather") << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  double gather_time(0);
+
+  // the index array is a permutation by construction: either a strided
+  // traversal or a blockwise shuffle of the identity
+  std::vector<size_t> idx(length);
+  if (window > 0) {
+    std::iota(idx.begin(), idx.end(), static_cast<size_t>(0));
+    std::mt19937_64 prng(42);
+    for (size_t w=0; w<length; w+=window) {
+      std::shuffle(idx.begin()+w, idx.begin()+std::min(length, w+window), prng);
+    }
+  } else {
+    size_t pos(0);
+    for (size_t o=0; o<stride; o++) {
+      for (size_t k=o; k<length; k+=stride) {
+        idx[pos++] = k;
+      }
+    }
+  }
+
+  prk::vector<double> A(length, 0.0);
+  prk::vector<double> B(length);
+  std::iota(B.begin(), B.end(), 0.0);
+
+  {
+    for (int iter = 0; iter<=iterations; iter++) {
+
+      if (iter==1) gather_time = prk::wtime();
+
+      if (scatter) {
+        for (size_t i=0; i<length; i++) {
+          A[idx[i]] += B[i];
+        }
+      } else {
+        for (size_t i=0; i<length; i++) {
+          A[i] += B[idx[i]];
+        }
+      }
+    }
+    gather_time = prk::wtime() - gather_time;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  // every element of B is added into A exactly once per iteration, so the
+  // sum of A is closed-form no matter what the permutation looks like
+  long double checksum(0);
+  for (auto & a : A) checksum += a;
+  const long double n = static_cast<long double>(length);
+  const long double reference = (iterations+1.0L) * (n-1.0L)*n/2.0L;
+  const double abserr = static_cast<double>(std::fabs(checksum-reference)/reference);
+
+#ifdef VERBOSE
+  std::cout << "Checksum = " << static_cast<double>(checksum)
+            << "; reference = " << static_cast<double>(reference) << std::endl;
+#endif
+
+  const double epsilon(1.e-8);
+  if (abserr < epsilon) {
+    std::cout << "Solution validates" << std::endl;
+    double avgtime = gather_time/iterations;
+    // A is read and written, B and the index array are read
+    size_t bytes = length * (3L*sizeof(double) + sizeof(size_t));
+    std::cout << "Rate (MB/s): " << 1.0e-6 * bytes/avgtime
+              << " Avg time (s): " << avgtime << std::endl;
+  } else {
+    std::cout << "ERROR: Relative checksum error " << abserr
+              << " exceeds threshold " << epsilon << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -38,6 +38,26 @@ def bodygen(src,pattern,stencil_size,radius,W,model):
                 if (k>0 and k<kmax): src.write('                          ')
     src.write(';\n')
 
+def simdbodygen(src,pattern,stencil_size,radius,W):
+    for j in range(0,2*radius+1):
+        if (j-radius)<0:
+            jr=str(j-radius)
+        elif (j-radius)==0:
+            jr=''
+        else:
+            jr='+'+str(j-radius)
+
+        for i in range(0,2*radius+1):
+            if (i-radius)<0:
+                ir=str(i-radius)
+            elif (i-radius)==0:
+                ir=''
+            else:
+                ir='+'+str(i-radius)
+
+            if ( W[j][i] != 0.0):
+                src.write('        acc += prk::simd::load(&in[(i'+ir+')*n+(j'+jr+')]) * '+str(W[j][i])+';\n')
+
 def codegen(src,pattern,stencil_size,radius,W,model):
     if (model=='openmp'):
         src.write('void '+pattern+str(radius)+'(const int n, const int t, const double * RESTRICT in, double * RESTRICT out) {\n')
@@ -53,18 +73,26 @@ def codegen(src,pattern,stencil_size,radius,W,model):
         src.write('       }\n')
         src.write('     }\n')
     elif (model=='taskloop'):
+        # positive gs sets the taskloop grainsize, negative gs num_tasks;
+        # the clause is compile-time, hence the duplicated loop nest
         src.write('void '+pattern+str(radius)+'(const int n, const int t, prk::vector<double> & in, prk::vector<double> & out, const int gs) {\n')
-        src.write('    OMP_TASKLOOP_COLLAPSE(2, firstprivate(n) shared(in,out) grainsize(gs) )\n')
-        src.write('    for (auto it='+str(radius)+'; it<n-'+str(radius)+'; it+=t) {\n')
-        src.write('      for (auto jt='+str(radius)+'; jt<n-'+str(radius)+'; jt+=t) {\n')
-        src.write('        for (auto i=it; i<std::min(n-'+str(radius)+',it+t); ++i) {\n')
-        src.write('          OMP_SIMD\n')
-        src.write('          for (auto j=jt; j<std::min(n-'+str(radius)+',jt+t); ++j) {\n')
-        bodygen(src,pattern,stencil_size,radius,W,model)
-        src.write('           }\n')
-        src.write('         }\n')
-        src.write('       }\n')
-        src.write('     }\n')
+        for clause in ['grainsize(gs)','num_tasks(-gs)']:
+            if clause=='grainsize(gs)':
+                src.write('    if (gs > 0) {\n')
+            else:
+                src.write('    } else {\n')
+            src.write('    OMP_TASKLOOP_COLLAPSE(2, firstprivate(n) shared(in,out) '+clause+' )\n')
+            src.write('    for (auto it='+str(radius)+'; it<n-'+str(radius)+'; it+=t) {\n')
+            src.write('      for (auto jt='+str(radius)+'; jt<n-'+str(radius)+'; jt+=t) {\n')
+            src.write('        for (auto i=it; i<std::min(n-'+str(radius)+',it+t); ++i) {\n')
+            src.write('          OMP_SIMD\n')
+            src.write('          for (auto j=jt; j<std::min(n-'+str(radius)+',jt+t); ++j) {\n')
+            bodygen(src,pattern,stencil_size,radius,W,model)
+            src.write('           }\n')
+            src.write('         }\n')
+            src.write('       }\n')
+            src.write('     }\n')
+        src.write('    }\n')
     elif (model=='target'):
         src.write('void '+pattern+str(radius)+'(const int n, const int t, const double * RESTRICT in, double * RESTRICT out) {\n')
         src.write('    OMP_TARGET( teams distribute parallel for simd collapse(2) schedule(static,1) )\n')
@@ -104,8 +132,8 @@ def codegen(src,pattern,stencil_size,radius,W,model):
     elif (model=='pstl'):
         src.write('void '+pattern+str(radius)+'(const int n, const int t, std::vector<double> & in, std::vector<double> & out) {\n')
         src.write('    auto inside = prk::range('+str(radius)+',n-'+str(radius)+');\n')
-        src.write('    std::for_each( exec::par, std::begin(inside), std::end(inside), [&] (int i) {\n')
-        src.write('      std::for_each( exec::unseq, std::begin(inside), std::end(inside), [&] (int j) {\n')
+        src.write('    prk::PSTL::for_each( prk::PSTL::outer(), std::begin(inside), std::end(inside), [&] (int i) {\n')
+        src.write('      prk::PSTL::for_each( prk::PSTL::inner(), std::begin(inside), std::end(inside), [&] (int j) {\n')
         bodygen(src,pattern,stencil_size,radius,W,model)
         src.write('      });\n')
         src.write('    });\n')
@@ -118,10 +146,11 @@ def codegen(src,pattern,stencil_size,radius,W,model):
         src.write('      });\n')
         src.write('    });\n')
     elif (model=='rajaview'):
+        src.write('template <typename kernel_policy = regular_policy>\n')
         src.write('void '+pattern+str(radius)+'(const int n, const int t, matrix & in, matrix & out) {\n')
         src.write('    RAJA::RangeSegment inner1('+str(radius)+',n-'+str(radius)+');\n')
         src.write('    auto inner2 = RAJA::make_tuple(inner1, inner1);\n')
-        src.write('    RAJA::kernel<regular_policy>(inner2, [=](int i, int j) {\n')
+        src.write('    RAJA::kernel<kernel_policy>(inner2, [=](int i, int j) {\n')
         bodygen(src,pattern,stencil_size,radius,W,model)
         src.write('    });\n')
     elif (model=='tbb'):
@@ -136,6 +165,7 @@ def codegen(src,pattern,stencil_size,radius,W,model):
         src.write('    }\n')
         src.write('  }, tbb_partitioner );\n')
     elif (model=='kokkos'):
+        src.write('template <typename matrix>\n')
         src.write('void '+pattern+str(radius)+'(const int n, const int t, matrix & in, matrix & out) {\n')
         src.write('    auto inside = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({'+str(radius)+','+str(radius)+'},{n-'+str(radius)+',n-'+str(radius)+'},{t,t});\n')
         src.write('    Kokkos::parallel_for(inside, KOKKOS_LAMBDA(int i, int j) {\n')
@@ -148,6 +178,19 @@ def codegen(src,pattern,stencil_size,radius,W,model):
         src.write('    if ( ('+str(radius)+' <= i) && (i < n-'+str(radius)+') && ('+str(radius)+' <= j) && (j < n-'+str(radius)+') ) {\n')
         bodygen(src,pattern,stencil_size,radius,W,model)
         src.write('     }\n')
+    elif (model=='simd'):
+        src.write('void '+pattern+str(radius)+'(const int n, const int t, prk::vector<double> & in, prk::vector<double> & out) {\n')
+        src.write('    for (auto i='+str(radius)+'; i<n-'+str(radius)+'; ++i) {\n')
+        src.write('      auto j='+str(radius)+';\n')
+        src.write('      for (; j+prk::simd::lanes<=n-'+str(radius)+'; j+=prk::simd::lanes) {\n')
+        src.write('        prk::simd::vdouble acc = prk::simd::load(&out[i*n+j]);\n')
+        simdbodygen(src,pattern,stencil_size,radius,W)
+        src.write('        prk::simd::store(&out[i*n+j], acc);\n')
+        src.write('      }\n')
+        src.write('      for (; j<n-'+str(radius)+'; ++j) {\n')
+        bodygen(src,pattern,stencil_size,radius,W,model)
+        src.write('      }\n')
+        src.write('    }\n')
     elif (model=='vector'):
         src.write('void '+pattern+str(radius)+'(const int n, const int t, std::vector<double> & in, std::vector<double> & out) {\n')
         src.write('    for (auto it='+str(radius)+'; it<n-'+str(radius)+'; it+=t) {\n')
@@ -199,8 +242,124 @@ def instance(src,model,pattern,r):
 
     codegen(src,pattern,stencil_size,r,W,model)
 
+def offset3d(d):
+    if d<0:  return str(d)
+    if d==0: return ''
+    return '+'+str(d)
+
+def bodygen3d(src,stencil_size,radius,W):
+    terms = []
+    for i in range(0,2*radius+1):
+        ir = offset3d(i-radius)
+        for j in range(0,2*radius+1):
+            jr = offset3d(j-radius)
+            for k in range(0,2*radius+1):
+                kr = offset3d(k-radius)
+                if ( W[i][j][k] != 0.0):
+                    terms.append('+in[((i'+ir+')*n+(j'+jr+'))*n+(k'+kr+')] * '+str(W[i][j][k]))
+    src.write('                out[(i*n+j)*n+k] += ')
+    src.write('\n                              '.join(terms))
+    src.write(';\n')
+
+def codegen3d(src,pattern,stencil_size,radius,W,model):
+    r = str(radius)
+    if (model=='openmp'):
+        src.write('void '+pattern+'3d'+r+'(const int n, const int ti, const int tj, const int tk, const double * RESTRICT in, double * RESTRICT out) {\n')
+        src.write('    OMP_FOR(collapse(3))\n')
+        src.write('    for (auto it='+r+'; it<n-'+r+'; it+=ti) {\n')
+        src.write('      for (auto jt='+r+'; jt<n-'+r+'; jt+=tj) {\n')
+        src.write('       for (auto kt='+r+'; kt<n-'+r+'; kt+=tk) {\n')
+        src.write('        for (auto i=it; i<std::min(n-'+r+',it+ti); ++i) {\n')
+        src.write('          for (auto j=jt; j<std::min(n-'+r+',jt+tj); ++j) {\n')
+        src.write('            OMP_SIMD\n')
+        src.write('            for (auto k=kt; k<std::min(n-'+r+',kt+tk); ++k) {\n')
+        bodygen3d(src,stencil_size,radius,W)
+        src.write('             }\n')
+        src.write('           }\n')
+        src.write('         }\n')
+        src.write('        }\n')
+        src.write('      }\n')
+        src.write('    }\n')
+    elif (model=='tbb'):
+        src.write('void '+pattern+'3d'+r+'(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {\n')
+        src.write('  tbb::blocked_range3d<int> range('+r+', n-'+r+', ti, '+r+', n-'+r+', tj, '+r+', n-'+r+', tk);\n')
+        src.write('  tbb::parallel_for( range, [&](decltype(range)& r ) {\n')
+        src.write('    for (auto i=r.pages().begin(); i!=r.pages().end(); ++i ) {\n')
+        src.write('      for (auto j=r.rows().begin(); j!=r.rows().end(); ++j ) {\n')
+        src.write('        PRAGMA_SIMD\n')
+        src.write('        for (auto k=r.cols().begin(); k!=r.cols().end(); ++k ) {\n')
+        bodygen3d(src,stencil_size,radius,W)
+        src.write('        }\n')
+        src.write('      }\n')
+        src.write('    }\n')
+        src.write('  }, tbb_partitioner );\n')
+    else:
+        src.write('void '+pattern+'3d'+r+'(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {\n')
+        src.write('    for (auto it='+r+'; it<n-'+r+'; it+=ti) {\n')
+        src.write('      for (auto jt='+r+'; jt<n-'+r+'; jt+=tj) {\n')
+        src.write('       for (auto kt='+r+'; kt<n-'+r+'; kt+=tk) {\n')
+        src.write('        for (auto i=it; i<std::min(n-'+r+',it+ti); ++i) {\n')
+        src.write('          for (auto j=jt; j<std::min(n-'+r+',jt+tj); ++j) {\n')
+        src.write('            PRAGMA_SIMD\n')
+        src.write('            for (auto k=kt; k<std::min(n-'+r+',kt+tk); ++k) {\n')
+        bodygen3d(src,stencil_size,radius,W)
+        src.write('             }\n')
+        src.write('           }\n')
+        src.write('         }\n')
+        src.write('        }\n')
+        src.write('      }\n')
+        src.write('    }\n')
+    src.write('}\n\n')
+
+def instance3d(src,model,pattern,r):
+
+    W = [[[0.0e0 for x in range(2*r+1)] for x in range(2*r+1)] for x in range(2*r+1)]
+    if pattern == 'star':
+        stencil_size = 6*r+1
+        for i in range(1,r+1):
+            W[r][r][r+i] = +1./(2*i*r)
+            W[r][r][r-i] = -1./(2*i*r)
+            W[r][r+i][r] = +1./(2*i*r)
+            W[r][r-i][r] = -1./(2*i*r)
+            W[r+i][r][r] = +1./(2*i*r)
+            W[r-i][r][r] = -1./(2*i*r)
+    else:
+        # the 2D grid operator applied in each of the three coordinate
+        # planes, halved: a linear field is advanced by 3 per sweep,
+        # matching the 3D star, and the nonzero count has the closed
+        # form (2r+1)^3 - (2r)^3 - 1 used by the drivers
+        stencil_size = (2*r+1)**3 - (2*r)**3 - 1
+        W2 = [[0.0e0 for x in range(2*r+1)] for x in range(2*r+1)]
+        for j in range(1,r+1):
+            for i in range(-j+1,j):
+                W2[r+i][r+j] = +1./(4*j*(2*j-1)*r)
+                W2[r+i][r-j] = -1./(4*j*(2*j-1)*r)
+                W2[r+j][r+i] = +1./(4*j*(2*j-1)*r)
+                W2[r-j][r+i] = -1./(4*j*(2*j-1)*r)
+
+            W2[r+j][r+j]    = +1./(4*j*r)
+            W2[r-j][r-j]    = -1./(4*j*r)
+        for a in range(0,2*r+1):
+            for b in range(0,2*r+1):
+                if W2[a][b] == 0.0: continue
+                W[a][b][r] += W2[a][b]/2
+                W[a][r][b] += W2[a][b]/2
+                W[r][a][b] += W2[a][b]/2
+
+    codegen3d(src,pattern,stencil_size,r,W,model)
+
+def main3d():
+    # 3D kernels live in separate headers so regenerating them leaves
+    # the 2D headers byte-identical
+    for model in ['seq','openmp','tbb']:
+      src = open('stencil_3d_'+model+'.hpp','w')
+      for pattern in ['star','grid']:
+        for r in range(1,5):
+          instance3d(src,model,pattern,r)
+      src.close()
+
 def main():
-    for model in ['seq','vector','rangefor','stl','pgnu','pstl','openmp','taskloop','target','tbb','raja','rajaview','kokkos','cuda']:
+    for model in ['seq','simd','vector','rangefor','stl','pgnu','pstl','openmp','taskloop','target','tbb','raja','rajaview','kokkos','cuda']:
       src = open('stencil_'+model+'.hpp','w')
       if (model=='target'):
           src.write('#define RESTRICT __restrict__\n\n')
@@ -215,6 +374,7 @@ def main():
       #if (model=='target'):
       #  src.write('OMP( end declare target )\n')
       src.close()
+    main3d()
 
 if __name__ == '__main__':
     main()
@@ -5,33 +5,10 @@ import fileinput
 import string
 import os
 
-def main(precision):
-
-    if len(sys.argv) < 3:
-        print('argument count = ', len(sys.argv))
-        sys.exit("Usage: <star/grid> <radius>")
-
-    if len(sys.argv) > 1:
-        pattern = sys.argv[1]
-    else:
-        pattern = 'star'
-
-    if len(sys.argv) > 2:
-        r = int(sys.argv[2])
-        if r < 1:
-            sys.exit("ERROR: Stencil radius should be positive")
-    else:
-        r = 2 # radius=2 is what other impls use right now
-
-    #if pattern == 'star':
-    #    print('Type of stencil      = ', 'star')
-    #else:
-    #    print('Type of stencil      = ', 'stencil')
-    #print('Radius of stencil    = ', r)
+def stencil_weights(pattern,r):
 
     W = [[0.0 for x in range(2*r+1)] for x in range(2*r+1)]
     if pattern == 'star':
-        stencil_size = 4*r+1
         for i in range(1,r+1):
             W[r][r+i] = +1./(2*i*r)
             W[r+i][r] = +1./(2*i*r)
@@ -39,7 +16,6 @@ def main(precision):
             W[r-i][r] = -1./(2*i*r)
 
     else:
-        stencil_size = (2*r+1)**2
         for j in range(1,r+1):
             for i in range(-j+1,j):
                 W[r+i][r+j] = +1./(4*j*(2*j-1)*r)
@@ -50,36 +26,101 @@ def main(precision):
             W[r+j][r+j]    = +1./(4*j*r)
             W[r-j][r-j]    = -1./(4*j*r)
 
-    if (precision==32):
-        t = 'float'
-        src = open(pattern+str(r)+'.cl','w')
-    else:
-        t = 'double'
-        src = open(pattern+str(r)+'.cl','a')
-        src.write('#pragma OPENCL EXTENSION cl_khr_fp64 : enable\n\n')
-    src.write('__kernel void '+pattern+str(r)+'_'+str(precision)+'(const int n, __global const '+t+' * in, __global '+t+' * out)\n')
-    src.write('{\n')
-    src.write('    const int i = get_global_id(0);\n')
-    src.write('    const int j = get_global_id(1);\n')
-    src.write('    if ( ('+str(r)+' <= i) && (i < n-'+str(r)+') && ('+str(r)+' <= j) && (j < n-'+str(r)+') ) {\n')
-    src.write('        out[i*n+j] += ')
+    return W
+
+def codegen_sum(src,W,r,precision,ref):
+    # emit the unrolled coefficient sum; ref maps the row/column index
+    # of a stencil point (0..2r) to the array reference used for it
+    stencil_size = sum(1 for j in range(0,2*r+1) for i in range(0,2*r+1) if W[j][i] != 0.0)
     k = 0
-    kmax = stencil_size-1;
     for j in range(0,2*r+1):
         for i in range(0,2*r+1):
             if ( W[j][i] != 0.0):
                 k+=1
-                #print(j-r,i-r,W[j][i])
-                src.write('+in[(i+'+str(j-r)+')*n+(j+'+str(i-r)+')] * '+str(W[j][i]))
+                src.write('+'+ref(j,i)+' * '+str(W[j][i]))
                 if (precision==32):
                     src.write('f') # make W coefficient a float
-                if (k<kmax): src.write('\n')
-                if (k>0 and k<kmax): src.write('                      ')
+                if (k<stencil_size): src.write('\n')
+                if (k>0 and k<stencil_size): src.write('                      ')
     src.write(';\n')
+
+def codegen_global(src,pattern,r,precision):
+    # one work item per grid point, operands read from global memory
+    W = stencil_weights(pattern,r)
+    t = 'float' if (precision==32) else 'double'
+    src.write('__kernel void '+pattern+str(r)+'_'+str(precision)+'(const int n, __global const '+t+' * in, __global '+t+' * out)\n')
+    src.write('{\n')
+    src.write('    const int i = get_global_id(0);\n')
+    src.write('    const int j = get_global_id(1);\n')
+    src.write('    if ( ('+str(r)+' <= i) && (i < n-'+str(r)+') && ('+str(r)+' <= j) && (j < n-'+str(r)+') ) {\n')
+    src.write('        out[i*n+j] += ')
+    codegen_sum(src,W,r,precision,
+                lambda j,i: 'in[(i+'+str(j-r)+')*n+(j+'+str(i-r)+')]')
     src.write('    }\n')
     src.write('}\n\n')
 
-if __name__ == '__main__':
-    main(32)
-    main(64)
+def codegen_tiled(src,pattern,r,precision):
+    # LSIZE x LSIZE work groups stage their tile plus halo in local
+    # memory, so each grid point is read from global memory once per
+    # work group instead of once per stencil point; LSIZE is a build
+    # option so the work-group size can be tuned without regenerating
+    W = stencil_weights(pattern,r)
+    t = 'float' if (precision==32) else 'double'
+    h = str(2*r)
+    src.write('__kernel void '+pattern+str(r)+'_'+str(precision)+'_tiled(const int n, __global const '+t+' * in, __global '+t+' * out)\n')
+    src.write('{\n')
+    src.write('    const int i  = get_global_id(0);\n')
+    src.write('    const int j  = get_global_id(1);\n')
+    src.write('    const int li = get_local_id(0);\n')
+    src.write('    const int lj = get_local_id(1);\n')
+    src.write('    __local '+t+' t_in[LSIZE+'+h+'][LSIZE+'+h+'];\n')
+    src.write('    for (int ii=li; ii<LSIZE+'+h+'; ii+=LSIZE) {\n')
+    src.write('      for (int jj=lj; jj<LSIZE+'+h+'; jj+=LSIZE) {\n')
+    src.write('        const int gi = get_group_id(0)*LSIZE + ii - '+str(r)+';\n')
+    src.write('        const int gj = get_group_id(1)*LSIZE + jj - '+str(r)+';\n')
+    src.write('        t_in[ii][jj] = ((0 <= gi) && (gi < n) && (0 <= gj) && (gj < n)) ? in[gi*n+gj] : ('+t+')0;\n')
+    src.write('      }\n')
+    src.write('    }\n')
+    src.write('    barrier(CLK_LOCAL_MEM_FENCE);\n')
+    src.write('    if ( ('+str(r)+' <= i) && (i < n-'+str(r)+') && ('+str(r)+' <= j) && (j < n-'+str(r)+') ) {\n')
+    src.write('        out[i*n+j] += ')
+    codegen_sum(src,W,r,precision,
+                lambda j,i: 't_in[li+'+str(j)+'][lj+'+str(i)+']')
+    src.write('    }\n')
+    src.write('}\n\n')
 
+def codegen(pattern,r):
+    src = open(pattern+str(r)+'.cl','w')
+    src.write('#ifndef LSIZE\n')
+    src.write('#define LSIZE 16\n')
+    src.write('#endif\n\n')
+    codegen_global(src,pattern,r,32)
+    codegen_tiled(src,pattern,r,32)
+    src.write('#pragma OPENCL EXTENSION cl_khr_fp64 : enable\n\n')
+    codegen_global(src,pattern,r,64)
+    codegen_tiled(src,pattern,r,64)
+    src.close()
+
+def main():
+
+    # without arguments, generate the full set the driver dispatches,
+    # for offline (FPGA) compilers that consume the kernels directly
+    if len(sys.argv) < 2:
+        for pattern in ['star','grid']:
+            for r in range(1,6):
+                codegen(pattern,r)
+        return
+
+    if len(sys.argv) < 3:
+        print('argument count = ', len(sys.argv))
+        sys.exit("Usage: <star/grid> <radius> (no arguments: star/grid, radii 1-5)")
+
+    pattern = sys.argv[1]
+    r = int(sys.argv[2])
+    if r < 1:
+        sys.exit("ERROR: Stencil radius should be positive")
+
+    codegen(pattern,r)
+
+if __name__ == '__main__':
+    main()
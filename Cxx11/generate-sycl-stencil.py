@@ -5,11 +5,16 @@ import fileinput
 import string
 import os
 
-def codegen(src,pattern,stencil_size,radius,model,dim):
+def codegen(src,pattern,stencil_size,radius,model,dim,ndr=False):
+    suffix = '_ndr' if ndr else ''
     src.write('// declare the kernel name used in SYCL parallel_for\n')
-    src.write('template <typename T> class '+pattern+str(radius)+'_'+str(dim)+'d;\n\n')
+    src.write('template <typename T> class '+pattern+str(radius)+'_'+str(dim)+'d'+suffix+';\n\n')
     src.write('template <typename T>\n')
     src.write('void '+pattern+str(radius)+'(cl::sycl::queue & q, const size_t n, ')
+    if ndr:
+        # explicit ND-range variant: the caller chooses the work-group shape;
+        # the global size is rounded up and the kernel guards the tail
+        src.write('cl::sycl::range<2> lws, ')
     if (dim==2):
         src.write('cl::sycl::buffer<T, 2> & d_in, ')
         src.write('cl::sycl::buffer<T, 2> & d_out)\n')
@@ -17,6 +22,9 @@ def codegen(src,pattern,stencil_size,radius,model,dim):
         src.write('cl::sycl::buffer<T> & d_in, ')
         src.write('cl::sycl::buffer<T> & d_out)\n')
     src.write('{\n')
+    if ndr:
+        src.write('  const size_t g0 = lws[0] * prk::divceil(n-'+str(2*radius)+', lws[0]);\n')
+        src.write('  const size_t g1 = lws[1] * prk::divceil(n-'+str(2*radius)+', lws[1]);\n')
     src.write('  q.submit([&](cl::sycl::handler& h) {\n')
     src.write('    auto in  = d_in.template get_access<cl::sycl::access::mode::read>(h);\n')
     src.write('    auto out = d_out.template get_access<cl::sycl::access::mode::read_write>(h);\n')
@@ -24,12 +32,24 @@ def codegen(src,pattern,stencil_size,radius,model,dim):
         for r in range(1,radius+1):
             src.write('    cl::sycl::id<2> dx'+str(r)+'(cl::sycl::range<2> {'+str(r)+',0});\n')
             src.write('    cl::sycl::id<2> dy'+str(r)+'(cl::sycl::range<2> {0,'+str(r)+'});\n')
-    src.write('    h.parallel_for<class '+pattern+str(radius)+'_'+str(dim)+'d<T>>(')
-    src.write('cl::sycl::range<2> {n-'+str(2*radius)+',n-'+str(2*radius)+'}, ')
-    src.write('cl::sycl::id<2> {'+str(radius)+','+str(radius)+'}, ')
-    src.write('[=] (cl::sycl::item<2> it) {\n')
+    src.write('    h.parallel_for<class '+pattern+str(radius)+'_'+str(dim)+'d'+suffix+'<T>>(')
+    if ndr:
+        src.write('cl::sycl::nd_range<2> {cl::sycl::range<2> {g0,g1}, lws}, ')
+        src.write('[=] (cl::sycl::nd_item<2> it) {\n')
+        src.write('        const size_t i = it.get_global_id(0) + '+str(radius)+';\n')
+        src.write('        const size_t j = it.get_global_id(1) + '+str(radius)+';\n')
+        src.write('        if ( (i<n-'+str(radius)+') && (j<n-'+str(radius)+') ) {\n')
+    else:
+        src.write('cl::sycl::range<2> {n-'+str(2*radius)+',n-'+str(2*radius)+'}, ')
+        src.write('cl::sycl::id<2> {'+str(radius)+','+str(radius)+'}, ')
+        src.write('[=] (cl::sycl::item<2> it) {\n')
+    i0 = 'i' if ndr else 'it[0]'
+    i1 = 'j' if ndr else 'it[1]'
     if (dim==2):
-        src.write('        cl::sycl::id<2> xy = it.get_id();\n')
+        if ndr:
+            src.write('        cl::sycl::id<2> xy(i,j);\n')
+        else:
+            src.write('        cl::sycl::id<2> xy = it.get_id();\n')
         src.write('        out[xy] += ')
     else:
         # 1D indexing the slow way
@@ -37,7 +57,7 @@ def codegen(src,pattern,stencil_size,radius,model,dim):
         #src.write('        auto j = it[1];\n')
         #src.write('        out[i*n+j] += ')
         # 1D indexing the fast way
-        src.write('        out[it[0]*n+it[1]] += ')
+        src.write('        out['+i0+'*n+'+i1+'] += ')
     if pattern == 'star':
         for i in range(1,radius+1):
             if (dim==2):
@@ -67,17 +87,19 @@ def codegen(src,pattern,stencil_size,radius,model,dim):
                 if i > 1:
                     src.write('\n')
                     src.write(30*' ')
-                src.write('+in[it[0]*n+(it[1]+'+str(i)+')] * static_cast<T>('+str(+1./(2.*i*radius))+')')
+                src.write('+in['+i0+'*n+('+i1+'+'+str(i)+')] * static_cast<T>('+str(+1./(2.*i*radius))+')')
                 src.write('\n'+30*' ')
-                src.write('+in[it[0]*n+(it[1]-'+str(i)+')] * static_cast<T>('+str(-1./(2.*i*radius))+')')
+                src.write('+in['+i0+'*n+('+i1+'-'+str(i)+')] * static_cast<T>('+str(-1./(2.*i*radius))+')')
                 src.write('\n'+30*' ')
-                src.write('+in[(it[0]+'+str(i)+')*n+it[1]] * static_cast<T>('+str(+1./(2.*i*radius))+')')
+                src.write('+in[('+i0+'+'+str(i)+')*n+'+i1+'] * static_cast<T>('+str(+1./(2.*i*radius))+')')
                 src.write('\n'+30*' ')
-                src.write('+in[(it[0]-'+str(i)+')*n+it[1]] * static_cast<T>('+str(-1./(2.*i*radius))+')')
+                src.write('+in[('+i0+'-'+str(i)+')*n+'+i1+'] * static_cast<T>('+str(-1./(2.*i*radius))+')')
             if i == radius:
                 src.write(';\n')
     else:
         print('grid not implemented\n')
+    if ndr:
+        src.write('        }\n')
     src.write('    });\n')
     src.write('  });\n')
     src.write('}\n\n')
@@ -89,6 +111,8 @@ def instance(src,model,pattern,r):
         stencil_size = (2*r+1)**2
     codegen(src,pattern,stencil_size,r,model,1)
     codegen(src,pattern,stencil_size,r,model,2)
+    codegen(src,pattern,stencil_size,r,model,1,ndr=True)
+    codegen(src,pattern,stencil_size,r,model,2,ndr=True)
 
 def main():
     for model in ['sycl']:
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+#
+# Generates a unity-build translation unit from a list of kernel sources.
+# All sources are concatenated (by inclusion) into one file, so the heavy
+# common headers are parsed once per programming-model group instead of
+# once per kernel. Each kernel's main() is renamed - the same trick the
+# suite target uses at the object level - and a generated driver
+# dispatches on the first argument:
+#
+#     ./unity-seq nstream 10 100000
+#
+# Sources must not define colliding file-scope symbols; the groups in the
+# Makefile are curated accordingly.
+
+import sys
+
+def symbol(stem):
+    return 'prk_' + stem.replace('-','_') + '_main'
+
+def main():
+    if len(sys.argv) < 2:
+        print('Usage: generate-unity.py <kernel1.cc> [<kernel2.cc> ...]', file=sys.stderr)
+        return 1
+
+    sources = sys.argv[1:]
+    stems = [s[:-3] for s in sources]
+
+    print('// Generated by generate-unity.py - do not edit.')
+    print('')
+    for stem, source in zip(stems, sources):
+        print('#define main {}'.format(symbol(stem)))
+        print('#include "{}"'.format(source))
+        print('#undef main')
+        print('')
+    print('#include <cstring>')
+    print('')
+    print('int main(int argc, char * argv[])')
+    print('{')
+    print('  if (argc > 1) {')
+    for stem in stems:
+        print('    if (std::strcmp(argv[1],"{}") == 0) return {}(argc-1, argv+1);'.format(stem, symbol(stem)))
+    print('  }')
+    print('  std::cout << "Usage: <kernel> <kernel arguments>" << std::endl;')
+    print('  std::cout << "Available kernels:";')
+    for stem in stems:
+        print('  std::cout << " {}";'.format(stem))
+    print('  std::cout << std::endl;')
+    print('  return 1;')
+    print('}')
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
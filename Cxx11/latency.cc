@@ -0,0 +1,192 @@
+///
+/// Copyright (c) 2017, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    latency
+///
+/// PURPOSE: To measure pure load-to-use memory latency with a randomized
+///          pointer chase.  The slots of an array are linked into a single
+///          random cycle and traversed; every load depends on the previous
+///          one, so no memory-level parallelism hides the latency.
+///
+/// USAGE:   The program takes as input the number of times the chain is
+///          traversed, the number of slots (= loads per traversal), and
+///          optionally the slot size in bytes
+///
+///          <progname> <# iterations> <# loads> [<slot bytes>]
+///
+///          The slot size defaults to one cache line (64); a slot size of
+///          4096 touches a different page on every load, exposing TLB and
+///          page-walk latency.  The working set is #loads * slot bytes;
+///          PRK_HUGEPAGES selects the backing page size (see prk::malloc)
+///          and PRK_CACHE_SWEEP=1 auto-sizes the chain to each detected
+///          cache level instead.
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// NOTES:   The chain is a single cycle by construction (a shuffled visit
+///          order), so a traversal of #loads steps must return to the
+///          start; that is the validation.
+///
+/// HISTORY: Written loosely after the memory-latency part of lmbench
+///          (lat_mem_rd), with the PRK iteration and validation
+///          discipline.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+
+#include <random>
+
+int main(int argc, char * argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11 memory latency pointer chase" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations;
+  size_t length, slot_bytes;
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <# loads> [<slot bytes>]";
+      }
+
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      length = std::atol(argv[2]);
+      if (length < 2) {
+        throw "ERROR: chain length must be at least 2";
+      }
+
+      slot_bytes = (argc>3) ? std::atol(argv[3]) : 64;
+      if (slot_bytes < sizeof(size_t) || slot_bytes % sizeof(size_t) != 0) {
+        throw "ERROR: slot bytes must be a positive multiple of the pointer size";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  const auto cache_points = prk::cache_sweep_lengths(1, slot_bytes);
+  const bool cache_sweeping = !cache_points.empty();
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Chain length         = " << length << std::endl;
+  std::cout << "Slot size (B)        = " << slot_bytes << std::endl;
+  if (cache_sweeping) {
+    std::cout << "Cache sweep:" << std::endl;
+    std::cout << std::setw(8)  << "Level"
+              << std::setw(12) << "WS (KiB)"
+              << std::setw(14) << "Loads"
+              << std::setw(16) << "ns/load" << std::endl;
+  } else {
+    std::cout << "Working set (KiB)    = " << length*slot_bytes/1024 << std::endl;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  for (size_t point=0; point < (cache_sweeping ? cache_points.size() : 1); point++) {
+
+  if (cache_sweeping) length = std::max((size_t)2, cache_points[point].second);
+
+  auto latency_time = 0.0;
+
+  const size_t stride = slot_bytes / sizeof(size_t);
+
+  // slot i holds, in its first word, the element index of the next slot
+  prk::vector<size_t> chain(length*stride, 0);
+
+  // a shuffled visit order makes the chain one random cycle, so every
+  // slot is visited exactly once per traversal
+  std::vector<size_t> order(length);
+  std::iota(order.begin(), order.end(), (size_t)0);
+  std::mt19937_64 prng(42);
+  std::shuffle(order.begin(), order.end(), prng);
+  for (size_t k=0; k<length; k++) {
+    chain[order[k]*stride] = order[(k+1)%length]*stride;
+  }
+
+  size_t pos = order[0]*stride;
+  const size_t start = pos;
+
+  for (int iter = 0; iter<=iterations; iter++) {
+
+    if (iter==1) latency_time = prk::wtime();
+
+    // every load depends on the previous one
+    for (size_t k=0; k<length; k++) {
+      pos = chain[pos];
+    }
+  }
+  latency_time = prk::wtime() - latency_time;
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  // each traversal is one full cycle, so the chase must end where it began
+  if (pos != start) {
+      std::cout << "ERROR: chain of " << length << " loads ended at " << pos
+                << " instead of " << start << std::endl;
+      std::cout << "ERROR: solution did not validate" << std::endl;
+      return 1;
+  }
+
+  const double avgtime = latency_time/iterations;
+  const double ns_per_load = 1.e9*avgtime/length;
+  if (cache_sweeping) {
+      std::cout << std::setw(8)  << cache_points[point].first
+                << std::setw(12) << length*slot_bytes/1024
+                << std::setw(14) << length
+                << std::setw(16) << ns_per_load << std::endl;
+  } else {
+      std::cout << "Solution validates" << std::endl;
+      std::cout << "Latency (ns/load): " << ns_per_load
+                << " Avg time (s): " << avgtime << std::endl;
+  }
+
+  }
+
+  if (cache_sweeping) std::cout << "Solution validates" << std::endl;
+
+  return 0;
+}
@@ -42,7 +42,16 @@
 ///          of iterations to loop over the triad vectors, the length of the
 ///          vectors, and the offset between vectors
 ///
-///          <progname> <# iterations> <vector length> <offset>
+///          <progname> <# iterations> <vector length> [<offset> <pattern>]
+///
+///          The pattern defaults to the classic 3-stream TRIAD; DOT, COPY,
+///          SCALE and TRIAD4..TRIAD8 (the digit counts total streams) are
+///          also accepted, see prk_nstream.h.
+///
+///          PRK_CUDA_SWEEP=1 runs a geometric series of lengths from an
+///          L2-resident working set up to the given length in one
+///          process, reusing the maximum-size allocation, and reports
+///          the bandwidth at every point.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
@@ -63,6 +72,7 @@
 
 #include "prk_util.h"
 #include "prk_cuda.h"
+#include "prk_nstream.h"
 
 __global__ void nstream(const unsigned n, const prk_float scalar, prk_float * A, const prk_float * B, const prk_float * C)
 {
@@ -72,13 +82,67 @@ __global__ void nstream(const unsigned n, const prk_float scalar, prk_float * A,
     }
 }
 
+// source pointers passed by value so one kernel covers every triad arity;
+// odd-numbered sources carry the scalar coefficient, as on the host
+struct nstream_sources
+{
+    const prk_float * S[7];
+};
+
+template <int NSRC>
+__global__ void nstream_triad(const unsigned n, const prk_float scalar, prk_float * A, const nstream_sources src)
+{
+    unsigned i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < n) {
+        prk_float r = A[i];
+        #pragma unroll
+        for (int s=0; s<NSRC; s++) {
+            r += (s%2) ? scalar * src.S[s][i] : src.S[s][i];
+        }
+        A[i] = r;
+    }
+}
+
+__global__ void nstream_copy(const unsigned n, prk_float * A, const prk_float * B)
+{
+    unsigned i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < n) {
+        A[i] = B[i];
+    }
+}
+
+__global__ void nstream_scale(const unsigned n, const prk_float scalar, prk_float * A, const prk_float * B)
+{
+    unsigned i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < n) {
+        A[i] = scalar * B[i];
+    }
+}
+
+// block-level tree reduction followed by one atomic per block; the shared
+// array is sized for the launch below, and double atomicAdd needs sm_60+
+__global__ void nstream_dot(const unsigned n, const prk_float * B, const prk_float * C, prk_float * R)
+{
+    __shared__ prk_float partial[128];
+    unsigned i = blockIdx.x * blockDim.x + threadIdx.x;
+    partial[threadIdx.x] = (i < n) ? B[i] * C[i] : static_cast<prk_float>(0);
+    __syncthreads();
+    for (unsigned s = blockDim.x/2; s > 0; s >>= 1) {
+        if (threadIdx.x < s) partial[threadIdx.x] += partial[threadIdx.x + s];
+        __syncthreads();
+    }
+    if (threadIdx.x == 0) atomicAdd(R, partial[0]);
+}
+
 int main(int argc, char * argv[])
 {
   std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
   std::cout << "C++11/CUDA STREAM triad: A = B + scalar * C" << std::endl;
 
   prk::CUDA::info info;
-  info.print();
+  // enumerating and printing device properties is measurable cold-start
+  // cost in launch-dominated usage, so fast start skips it
+  if (!prk::fast_start()) info.print();
 
   //////////////////////////////////////////////////////////////////////
   /// Read and test input parameters
@@ -86,9 +150,10 @@ int main(int argc, char * argv[])
 
   int iterations, offset;
   int length;
+  prk::nstream::pattern pat{prk::nstream::kind::triad,3};
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <vector length> [<offset>]";
+        throw "Usage: <# iterations> <vector length> [<offset> <pattern>]";
       }
 
       iterations  = std::atoi(argv[1]);
@@ -105,15 +170,43 @@ int main(int argc, char * argv[])
       if (length <= 0) {
         throw "ERROR: offset must be nonnegative";
       }
+
+      if (argc > 4) {
+        pat = prk::nstream::parse(argv[4]);
+      }
   }
   catch (const char * e) {
     std::cout << e << std::endl;
     return 1;
   }
 
+  const bool managed = prk::CUDA::use_managed();
+  const bool sweep   = prk::CUDA::use_sweep();
+  // the sweep relaunches with a different length at every point, which
+  // does not mix with replaying one captured graph
+  const bool graph   = sweep ? false : prk::CUDA::use_graph();
+
   std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Startup time (s)     = " << prk::startup_time() << std::endl;
   std::cout << "Vector length        = " << length << std::endl;
   std::cout << "Offset               = " << offset << std::endl;
+  std::cout << "Pattern              = " << pat.name() << std::endl;
+  std::cout << "Memory policy        = " << (managed ? "managed (unified)" : "explicit copy") << std::endl;
+  std::cout << "Iteration loop       = " << (graph ? "CUDA graph replay" : "host launches") << std::endl;
+
+  // geometric series of lengths from half the L2 capacity (or 64K
+  // elements when the device does not report one) up to the full
+  // command-line length, which is always the last point
+  std::vector<int> sweep_lengths;
+  if (sweep) {
+    const int streams = 1 + pat.sources();
+    const size_t l2 = info.l2CacheSize;
+    long len = (l2 > 0) ? (long)((l2/2) / (streams*sizeof(prk_float))) : 65536L;
+    if (len < 1024) len = 1024;
+    for (; len < length; len *= 2) sweep_lengths.push_back((int)len);
+    sweep_lengths.push_back(length);
+    std::cout << "Length sweep         = " << sweep_lengths.size() << " points" << std::endl;
+  }
 
   const int blockSize = 128;
   dim3 dimBlock(blockSize, 1, 1);
@@ -128,41 +221,214 @@ int main(int argc, char * argv[])
   auto nstream_time = 0.0;
 
   const size_t bytes = length * sizeof(prk_float);
-  prk_float * h_A;
-  prk_float * h_B;
-  prk_float * h_C;
+  const int nsrc = pat.sources();
+  prk_float * h_A = NULL;
+  prk_float * h_S[7] = {NULL};
+  prk_float * d_A;
+  prk_float * d_S[7];
+  prk_float * d_R = NULL;   // accumulated dot result
+  double h2d_time(0);
+  double d2h_time(0);
+  if (managed) {
+    // host and device share one allocation; pages migrate on demand
+    prk::CUDA::check( cudaMallocManaged((void**)&d_A, bytes) );
+    for (int s=0; s<nsrc; s++) {
+      prk::CUDA::check( cudaMallocManaged((void**)&d_S[s], bytes) );
+    }
+    for (auto i=0; i<length; ++i) {
+      d_A[i] = static_cast<prk_float>(0);
+      for (int s=0; s<nsrc; s++) {
+        d_S[s][i] = static_cast<prk_float>(2);
+      }
+    }
+    prk::CUDA::prefetch_managed(d_A, bytes);
+    for (int s=0; s<nsrc; s++) {
+      prk::CUDA::prefetch_managed(d_S[s], bytes);
+    }
+    h_A = d_A;
+  } else {
 #ifndef __CORIANDERCC__
-  prk::CUDA::check( cudaMallocHost((void**)&h_A, bytes) );
-  prk::CUDA::check( cudaMallocHost((void**)&h_B, bytes) );
-  prk::CUDA::check( cudaMallocHost((void**)&h_C, bytes) );
+    prk::CUDA::check( cudaMallocHost((void**)&h_A, bytes) );
+    for (int s=0; s<nsrc; s++) {
+      prk::CUDA::check( cudaMallocHost((void**)&h_S[s], bytes) );
+    }
 #else
-  h_A = new prk_float[length];
-  h_B = new prk_float[length];
-  h_C = new prk_float[length];
+    h_A = new prk_float[length];
+    for (int s=0; s<nsrc; s++) {
+      h_S[s] = new prk_float[length];
+    }
 #endif
-  for (auto i=0; i<length; ++i) {
-    h_A[i] = static_cast<prk_float>(0);
-    h_B[i] = static_cast<prk_float>(2);
-    h_C[i] = static_cast<prk_float>(2);
+    for (auto i=0; i<length; ++i) {
+      h_A[i] = static_cast<prk_float>(0);
+      for (int s=0; s<nsrc; s++) {
+        h_S[s][i] = static_cast<prk_float>(2);
+      }
+    }
+
+    prk::CUDA::check( cudaMalloc((void**)&d_A, bytes) );
+    for (int s=0; s<nsrc; s++) {
+      prk::CUDA::check( cudaMalloc((void**)&d_S[s], bytes) );
+    }
+    h2d_time = prk::wtime();
+    prk::CUDA::check( cudaMemcpy(d_A, &(h_A[0]), bytes, cudaMemcpyHostToDevice) );
+    for (int s=0; s<nsrc; s++) {
+      prk::CUDA::check( cudaMemcpy(d_S[s], &(h_S[s][0]), bytes, cudaMemcpyHostToDevice) );
+    }
+    h2d_time = prk::wtime() - h2d_time;
+  }
+  if (pat.k == prk::nstream::kind::dot) {
+    prk::CUDA::check( cudaMalloc((void**)&d_R, sizeof(prk_float)) );
+    prk::CUDA::check( cudaMemset(d_R, 0, sizeof(prk_float)) );
   }
 
-  prk_float * d_A;
-  prk_float * d_B;
-  prk_float * d_C;
-  prk::CUDA::check( cudaMalloc((void**)&d_A, bytes) );
-  prk::CUDA::check( cudaMalloc((void**)&d_B, bytes) );
-  prk::CUDA::check( cudaMalloc((void**)&d_C, bytes) );
-  prk::CUDA::check( cudaMemcpy(d_A, &(h_A[0]), bytes, cudaMemcpyHostToDevice) );
-  prk::CUDA::check( cudaMemcpy(d_B, &(h_B[0]), bytes, cudaMemcpyHostToDevice) );
-  prk::CUDA::check( cudaMemcpy(d_C, &(h_C[0]), bytes, cudaMemcpyHostToDevice) );
+  // the warmup iteration absorbs any migration of managed pages
+  auto first_time = prk::wtime();
+
+  double launch_time(0);
 
   prk_float scalar(3);
+
+  // one iteration of the selected pattern over the first n elements;
+  // shared between the graph capture, the host-launched loop, and the
+  // length sweep
+  auto launch = [&](cudaStream_t stream, int len) {
+    const unsigned n = static_cast<unsigned>(len);
+    dim3 dimGrid(prk::divceil(len,blockSize), 1, 1);
+    switch (pat.k) {
+      case prk::nstream::kind::dot:
+        nstream_dot<<<dimGrid, dimBlock, 0, stream>>>(n, d_S[0], d_S[1], d_R);
+        break;
+      case prk::nstream::kind::copy:
+        nstream_copy<<<dimGrid, dimBlock, 0, stream>>>(n, d_A, d_S[0]);
+        break;
+      case prk::nstream::kind::scale:
+        nstream_scale<<<dimGrid, dimBlock, 0, stream>>>(n, scalar, d_A, d_S[0]);
+        break;
+      case prk::nstream::kind::triad:
+        if (pat.streams == 3) {
+          nstream<<<dimGrid, dimBlock, 0, stream>>>(n, scalar, d_A, d_S[0], d_S[1]);
+        } else {
+          nstream_sources src{};
+          for (int s=0; s<nsrc; s++) src.S[s] = d_S[s];
+          switch (pat.streams) {
+            case 4: nstream_triad<3><<<dimGrid, dimBlock, 0, stream>>>(n, scalar, d_A, src); break;
+            case 5: nstream_triad<4><<<dimGrid, dimBlock, 0, stream>>>(n, scalar, d_A, src); break;
+            case 6: nstream_triad<5><<<dimGrid, dimBlock, 0, stream>>>(n, scalar, d_A, src); break;
+            case 7: nstream_triad<6><<<dimGrid, dimBlock, 0, stream>>>(n, scalar, d_A, src); break;
+            case 8: nstream_triad<7><<<dimGrid, dimBlock, 0, stream>>>(n, scalar, d_A, src); break;
+          }
+        }
+        break;
+    }
+  };
+
+  if (sweep) {
+    const double epsilon(1.e-8);
+    for (auto len : sweep_lengths) {
+      // every point starts from A = 0 so the per-point checksum holds;
+      // the sources are constant and keep their initial contents
+      prk::CUDA::check( cudaMemset(d_A, 0, (size_t)len*sizeof(prk_float)) );
+      if (pat.k == prk::nstream::kind::dot) {
+        prk::CUDA::check( cudaMemset(d_R, 0, sizeof(prk_float)) );
+      }
+
+      double t(0);
+      for (auto iter = 0; iter<=iterations; iter++) {
+        if (iter==1) t = prk::wtime();
+        launch(0, len);
+        prk::CUDA::check( cudaDeviceSynchronize() );
+      }
+      t = prk::wtime() - t;
+
+      double asum(0);
+      if (pat.k == prk::nstream::kind::dot) {
+        prk_float r(0);
+        prk::CUDA::check( cudaMemcpy(&r, d_R, sizeof(prk_float), cudaMemcpyDeviceToHost) );
+        asum = r;
+      } else {
+        if (!managed) {
+          prk::CUDA::check( cudaMemcpy(&(h_A[0]), d_A, (size_t)len*sizeof(prk_float), cudaMemcpyDeviceToHost) );
+        }
+        for (auto i=0; i<len; i++) {
+          asum += std::fabs(h_A[i]);
+        }
+      }
+      const double ar = prk::nstream::checksum(pat, iterations, len, scalar);
+      if (std::fabs(ar-asum)/ar > epsilon) {
+        std::cout << "Failed Validation on output array at length " << len << "\n"
+                  << "       Expected checksum: " << ar << "\n"
+                  << "       Observed checksum: " << asum << std::endl;
+        std::cout << "ERROR: solution did not validate" << std::endl;
+        return 1;
+      }
+
+      const double avgtime = t/iterations;
+      const double nbytes = prk::nstream::bytes_per_iteration(pat, len);
+      std::cout << "Length: " << len
+                << " Rate (MB/s): " << 1.e-6*nbytes/avgtime
+                << " Avg time (s): " << avgtime << std::endl;
+    }
+    std::cout << "Solution validates" << std::endl;
+
+    if (pat.k == prk::nstream::kind::dot) {
+      prk::CUDA::check( cudaFree(d_R) );
+    }
+    for (int s=nsrc-1; s>=0; s--) {
+      prk::CUDA::check( cudaFree(d_S[s]) );
+    }
+    prk::CUDA::check( cudaFree(d_A) );
+#ifndef __CORIANDERCC__
+    if (!managed) {
+      for (int s=nsrc-1; s>=0; s--) {
+        prk::CUDA::check( cudaFreeHost(h_S[s]) );
+      }
+      prk::CUDA::check( cudaFreeHost(h_A) );
+    }
+#endif
+
+    return 0;
+  }
+
+#ifndef __CORIANDERCC__
+  if (graph) {
+    // capture one iteration of the loop and replay it
+    cudaStream_t stream;
+    prk::CUDA::check( cudaStreamCreate(&stream) );
+    cudaGraph_t g;
+    cudaGraphExec_t instance;
+    prk::CUDA::check( cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal) );
+    launch(stream, length);
+    prk::CUDA::check( cudaStreamEndCapture(stream, &g) );
+    prk::CUDA::check( cudaGraphInstantiate(&instance, g, NULL, NULL, 0) );
+
+    // warmup replay, also absorbing instantiation and migration
+    prk::CUDA::check( cudaGraphLaunch(instance, stream) );
+    prk::CUDA::check( cudaStreamSynchronize(stream) );
+    first_time = prk::wtime() - first_time;
+
+    nstream_time = prk::wtime();
+    for (auto iter = 1; iter<=iterations; iter++) {
+      const double t0 = prk::wtime();
+      prk::CUDA::check( cudaGraphLaunch(instance, stream) );
+      launch_time += prk::wtime() - t0;
+    }
+    prk::CUDA::check( cudaStreamSynchronize(stream) );
+    nstream_time = prk::wtime() - nstream_time;
+
+    prk::CUDA::check( cudaGraphExecDestroy(instance) );
+    prk::CUDA::check( cudaGraphDestroy(g) );
+    prk::CUDA::check( cudaStreamDestroy(stream) );
+  } else
+#endif
   {
     for (auto iter = 0; iter<=iterations; iter++) {
 
-      if (iter==1) nstream_time = prk::wtime();
+      if (iter==1) {
+        first_time = prk::wtime() - first_time;
+        nstream_time = prk::wtime();
+      }
 
-      nstream<<<dimGrid, dimBlock>>>(static_cast<unsigned>(length), scalar, d_A, d_B, d_C);
+      launch(0, length);
 #ifndef __CORIANDERCC__
       // silence "ignoring cudaDeviceSynchronize for now" warning
       prk::CUDA::check( cudaDeviceSynchronize() );
@@ -171,41 +437,58 @@ int main(int argc, char * argv[])
     nstream_time = prk::wtime() - nstream_time;
   }
 
-  prk::CUDA::check( cudaMemcpy(&(h_A[0]), d_A, bytes, cudaMemcpyDeviceToHost) );
+  prk_float dotresult(0);
+  if (pat.k == prk::nstream::kind::dot) {
+    prk::CUDA::check( cudaMemcpy(&dotresult, d_R, sizeof(prk_float), cudaMemcpyDeviceToHost) );
+    prk::CUDA::check( cudaFree(d_R) );
+  }
 
-  prk::CUDA::check( cudaFree(d_C) );
-  prk::CUDA::check( cudaFree(d_B) );
-  prk::CUDA::check( cudaFree(d_A) );
+  if (managed) {
+    for (int s=nsrc-1; s>=0; s--) {
+      prk::CUDA::check( cudaFree(d_S[s]) );
+    }
+  } else {
+    d2h_time = prk::wtime();
+    prk::CUDA::check( cudaMemcpy(&(h_A[0]), d_A, bytes, cudaMemcpyDeviceToHost) );
+    d2h_time = prk::wtime() - d2h_time;
+
+    for (int s=nsrc-1; s>=0; s--) {
+      prk::CUDA::check( cudaFree(d_S[s]) );
+    }
+    prk::CUDA::check( cudaFree(d_A) );
 
 #ifndef __CORIANDERCC__
-  prk::CUDA::check( cudaFreeHost(h_B) );
-  prk::CUDA::check( cudaFreeHost(h_C) );
+    for (int s=nsrc-1; s>=0; s--) {
+      prk::CUDA::check( cudaFreeHost(h_S[s]) );
+    }
 #endif
+  }
 
   //////////////////////////////////////////////////////////////////////
   /// Analyze and output results
   //////////////////////////////////////////////////////////////////////
 
-  double ar(0);
-  double br(2);
-  double cr(2);
-  for (auto i=0; i<=iterations; i++) {
-      ar += br + scalar * cr;
-  }
-
-  ar *= length;
+  const double ar = prk::nstream::checksum(pat, iterations, length, scalar);
 
   double asum(0);
-  for (auto i=0; i<length; i++) {
-      asum += std::fabs(h_A[i]);
+  if (pat.k == prk::nstream::kind::dot) {
+      asum = dotresult;
+  } else {
+      for (auto i=0; i<length; i++) {
+          asum += std::fabs(h_A[i]);
+      }
   }
 
+  if (managed) {
+    prk::CUDA::check( cudaFree(d_A) );
+  } else {
 #ifndef __CORIANDERCC__
-  prk::CUDA::check( cudaFreeHost(h_A) );
+    prk::CUDA::check( cudaFreeHost(h_A) );
 #endif
+  }
 
   double epsilon=1.e-8;
-  if (std::fabs(ar-asum)/asum > epsilon) {
+  if (std::fabs(ar-asum)/ar > epsilon) {
       std::cout << "Failed Validation on output array\n"
                 << "       Expected checksum: " << ar << "\n"
                 << "       Observed checksum: " << asum << std::endl;
@@ -214,9 +497,22 @@ int main(int argc, char * argv[])
   } else {
       std::cout << "Solution validates" << std::endl;
       double avgtime = nstream_time/iterations;
-      double nbytes = 4.0 * length * sizeof(prk_float);
+      double nbytes = prk::nstream::bytes_per_iteration(pat, length);
       std::cout << "Rate (MB/s): " << 1.e-6*nbytes/avgtime
                 << " Avg time (s): " << avgtime << std::endl;
+      if (managed) {
+        // the first iteration pays for any page migration
+        std::cout << "Rate incl. migration (MB/s): "
+                  << 1.e-6*nbytes*(iterations+1)/(first_time+nstream_time)
+                  << " First iteration (s): " << first_time << std::endl;
+      }
+      if (graph) {
+        std::cout << "Graph launch overhead (us): " << 1.e6*launch_time/iterations << std::endl;
+      }
+      if (!managed && prk::CUDA::report_transfers()) {
+        std::cout << "H2D bandwidth (MB/s): " << 1.e-6*(1.0+nsrc)*bytes/h2d_time
+                  << " D2H bandwidth (MB/s): " << 1.e-6*bytes/d2h_time << std::endl;
+      }
   }
 
   return 0;
@@ -65,6 +65,9 @@
 #include "prk_util.h"
 #include "prk_cuda.h"
 
+#include <thrust/async/for_each.h>
+#include <thrust/system/cuda/execution_policy.h>
+
 int main(int argc, char * argv[])
 {
   std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
@@ -74,11 +77,11 @@ int main(int argc, char * argv[])
   /// Read and test input parameters
   //////////////////////////////////////////////////////////////////////
 
-  int iterations, offset;
+  int iterations, offset, num_streams;
   size_t length;
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <vector length>";
+        throw "Usage: <# iterations> <vector length> [<offset> <# streams>]";
       }
 
       iterations  = std::atoi(argv[1]);
@@ -95,6 +98,13 @@ int main(int argc, char * argv[])
       if (length <= 0) {
         throw "ERROR: offset must be nonnegative";
       }
+
+      // more than one stream selects the asynchronous chunked mode
+      num_streams = (argc>4) ? std::atoi(argv[4]) : 1;
+      if (num_streams < 1) {
+        throw "ERROR: number of streams must be >= 1";
+      }
+      if ((size_t)num_streams > length) num_streams = (int)length;
   }
   catch (const char * e) {
     std::cout << e << std::endl;
@@ -104,12 +114,14 @@ int main(int argc, char * argv[])
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Vector length        = " << length << std::endl;
   std::cout << "Offset               = " << offset << std::endl;
+  std::cout << "Number of streams    = " << num_streams << std::endl;
 
   //////////////////////////////////////////////////////////////////////
   // Allocate space and perform the computation
   //////////////////////////////////////////////////////////////////////
 
   auto nstream_time = 0.0;
+  float busy_ms(0);
 
   thrust::device_vector<double> A(length);
   thrust::device_vector<double> B(length);
@@ -127,17 +139,67 @@ int main(int argc, char * argv[])
         thrust::get<0>(t) +=  thrust::get<1>(t) + scalar * thrust::get<2>(t);
     };
 
-    for (auto iter = 0; iter<=iterations; iter++) {
+    if (num_streams == 1) {
 
-      if (iter==1) nstream_time = prk::wtime();
+      for (auto iter = 0; iter<=iterations; iter++) {
 
-      thrust::for_each( thrust::device,
-                        thrust::make_zip_iterator(thrust::make_tuple(A.begin(), B.begin(), C.begin())),
-                        thrust::make_zip_iterator(thrust::make_tuple(A.end()  , B.end()  , C.end())),
-                        nstream);
-      prk::CUDA::check( cudaDeviceSynchronize() );
+        if (iter==1) nstream_time = prk::wtime();
+
+        thrust::for_each( thrust::device,
+                          thrust::make_zip_iterator(thrust::make_tuple(A.begin(), B.begin(), C.begin())),
+                          thrust::make_zip_iterator(thrust::make_tuple(A.end()  , B.end()  , C.end())),
+                          nstream);
+        prk::CUDA::check( cudaDeviceSynchronize() );
+      }
+      nstream_time = prk::wtime() - nstream_time;
+
+    } else {
+
+      // asynchronous mode: the vector is split into one contiguous chunk
+      // per stream and every chunk is dispatched with the async algorithm
+      // interface on its own stream, so the launches are free to overlap.
+      // Events bracketing each chunk measure how much overlap the
+      // dispatch actually achieved.
+      std::vector<cudaStream_t> streams(num_streams);
+      std::vector<cudaEvent_t> ev0(num_streams);
+      std::vector<cudaEvent_t> ev1(num_streams);
+      for (int s=0; s<num_streams; s++) {
+        prk::CUDA::check( cudaStreamCreate(&streams[s]) );
+        prk::CUDA::check( cudaEventCreate(&ev0[s]) );
+        prk::CUDA::check( cudaEventCreate(&ev1[s]) );
+      }
+
+      for (auto iter = 0; iter<=iterations; iter++) {
+
+        if (iter==1) { busy_ms = 0; nstream_time = prk::wtime(); }
+
+        std::vector<thrust::device_event> pending;
+        for (int s=0; s<num_streams; s++) {
+          const size_t lo = length*(size_t)s/num_streams;
+          const size_t hi = length*(size_t)(s+1)/num_streams;
+          prk::CUDA::check( cudaEventRecord(ev0[s], streams[s]) );
+          pending.push_back(
+              thrust::async::for_each( thrust::cuda::par.on(streams[s]),
+                                       thrust::make_zip_iterator(thrust::make_tuple(A.begin()+lo, B.begin()+lo, C.begin()+lo)),
+                                       thrust::make_zip_iterator(thrust::make_tuple(A.begin()+hi, B.begin()+hi, C.begin()+hi)),
+                                       nstream) );
+          prk::CUDA::check( cudaEventRecord(ev1[s], streams[s]) );
+        }
+        for (auto & e : pending) e.wait();
+        for (int s=0; s<num_streams; s++) {
+          float ms(0);
+          prk::CUDA::check( cudaEventElapsedTime(&ms, ev0[s], ev1[s]) );
+          busy_ms += ms;
+        }
+      }
+      nstream_time = prk::wtime() - nstream_time;
+
+      for (int s=0; s<num_streams; s++) {
+        prk::CUDA::check( cudaEventDestroy(ev1[s]) );
+        prk::CUDA::check( cudaEventDestroy(ev0[s]) );
+        prk::CUDA::check( cudaStreamDestroy(streams[s]) );
+      }
     }
-    nstream_time = prk::wtime() - nstream_time;
   }
 
   //////////////////////////////////////////////////////////////////////
@@ -173,6 +235,12 @@ int main(int argc, char * argv[])
       double nbytes = 4.0 * length * sizeof(double);
       std::cout << "Rate (MB/s): " << 1.e-6*nbytes/avgtime
                 << " Avg time (s): " << avgtime << std::endl;
+      if (num_streams > 1) {
+          // ratio of summed per-stream busy time to wall time: 1 means the
+          // chunks serialized, num_streams means they fully overlapped
+          std::cout << "Stream overlap: " << 1.e-3*busy_ms/nstream_time
+                    << " of " << num_streams << " streams busy on average" << std::endl;
+      }
   }
 
   return 0;
@@ -40,12 +40,19 @@
 ///
 /// USAGE:   The program takes as input the number
 ///          of iterations to loop over the triad vectors, the length of the
-///          vectors, and the offset between vectors
+///          vectors, and optionally a USM touch pattern
 ///
-///          <progname> <# iterations> <vector length> <offset>
+///          <progname> <# iterations> <vector length> [<usm pattern: buffer/device/host/alternate>]
 ///
 ///          The output consists of diagnostics to make sure the
-///          algorithm worked, and of timing statistics.
+///          algorithm worked, and of timing statistics.  The default
+///          (buffer) runs the explicit-buffer path.  The other patterns
+///          place the vectors in USM shared allocations and run each
+///          triad on the device, on the host, or alternating between
+///          the two, timing the phases separately; with alternation
+///          every phase pays for migrating the working set, so the
+///          per-phase rates expose page-migration throughput and
+///          thrashing, not just steady-state bandwidth.
 ///
 /// NOTES:   Bandwidth is determined as the number of words read, plus the
 ///          number of words written, times the size of the words, divided
@@ -71,6 +78,7 @@
 #endif
 
 template <typename T> class nstream;
+template <typename T> class nstream_usm;
 
 template <typename T>
 void run(cl::sycl::queue & q, int iterations, size_t length)
@@ -196,6 +204,127 @@ void run(cl::sycl::queue & q, int iterations, size_t length)
   }
 }
 
+template <typename T>
+void run_usm(cl::sycl::queue & q, int iterations, size_t length, int pattern)
+{
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  double nstream_time(0);
+  double device_time(0), host_time(0);
+  int device_phases(0), host_phases(0);
+
+  const T scalar(3);
+
+  T * A;
+  T * B;
+  T * C;
+
+  try {
+
+    A = cl::sycl::malloc_shared<T>(length, q);
+    B = cl::sycl::malloc_shared<T>(length, q);
+    C = cl::sycl::malloc_shared<T>(length, q);
+
+    // first touch on the host; the warmup iteration absorbs the
+    // initial migration to the device
+    for (size_t i=0; i<length; ++i) {
+      A[i] = 0;
+      B[i] = 2;
+      C[i] = 2;
+    }
+
+    for (int iter = 0; iter<=iterations; ++iter) {
+
+      if (iter==1) nstream_time = prk::wtime();
+
+      // pattern 1 runs everything on the device, 2 everything on the
+      // host, 3 ping-pongs the working set between the two
+      const bool on_host = (pattern==2) || (pattern==3 && (iter%2)==1);
+
+      const double t0 = prk::wtime();
+      if (on_host) {
+        for (size_t i=0; i<length; ++i) {
+            A[i] += B[i] + scalar * C[i];
+        }
+      } else {
+        q.submit([&](cl::sycl::handler& h) {
+          h.parallel_for<class nstream_usm<T>>(
+                  cl::sycl::range<1>{length}, [=] (cl::sycl::item<1> i) {
+              A[i] += B[i] + scalar * C[i];
+          });
+        });
+        q.wait();
+      }
+      if (iter>=1) {
+        if (on_host) { host_time   += prk::wtime() - t0; host_phases++;   }
+        else         { device_time += prk::wtime() - t0; device_phases++; }
+      }
+    }
+    nstream_time = prk::wtime() - nstream_time;
+  }
+  catch (cl::sycl::exception e) {
+    std::cout << e.what() << std::endl;
+    return;
+  }
+  catch (std::exception e) {
+    std::cout << e.what() << std::endl;
+    return;
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  T ar(0);
+  T br(2);
+  T cr(2);
+  for (int i=0; i<=iterations; ++i) {
+      ar += br + scalar * cr;
+  }
+
+  ar *= length;
+
+  double asum(0);
+  for (size_t i=0; i<length; ++i) {
+      asum += std::fabs(A[i]);
+  }
+
+  cl::sycl::free(C, q);
+  cl::sycl::free(B, q);
+  cl::sycl::free(A, q);
+
+  const double epsilon(1.e-8);
+  if (std::fabs(ar-asum)/asum > epsilon) {
+      std::cout << "Failed Validation on output array\n"
+                << "       Expected checksum: " << ar << "\n"
+                << "       Observed checksum: " << asum << std::endl;
+      std::cout << "ERROR: solution did not validate" << std::endl;
+  } else {
+      std::cout << "Solution validates" << std::endl;
+      double avgtime = nstream_time/iterations;
+      double nbytes = 4.0 * length * sizeof(T);
+      std::cout << 8*sizeof(T) << "B "
+                << "Rate (MB/s): " << 1.e-6*nbytes/avgtime
+                << " Avg time (s): " << avgtime << std::endl;
+      if (device_phases > 0) {
+        std::cout << "Device phases: " << device_phases
+                  << " Rate (MB/s): " << 1.e-6*nbytes*device_phases/device_time
+                  << " Avg time (s): " << device_time/device_phases << std::endl;
+      }
+      if (host_phases > 0) {
+        std::cout << "Host phases:   " << host_phases
+                  << " Rate (MB/s): " << 1.e-6*nbytes*host_phases/host_time
+                  << " Avg time (s): " << host_time/host_phases << std::endl;
+      }
+  }
+}
+
 int main(int argc, char * argv[])
 {
   std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
@@ -205,11 +334,11 @@ int main(int argc, char * argv[])
   /// Read and test input parameters
   //////////////////////////////////////////////////////////////////////
 
-  int iterations, offset;
+  int iterations, pattern(0);
   size_t length;
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <vector length>";
+        throw "Usage: <# iterations> <vector length> [<usm pattern: buffer/device/host/alternate>]";
       }
 
       iterations  = std::atoi(argv[1]);
@@ -222,9 +351,15 @@ int main(int argc, char * argv[])
         throw "ERROR: vector length must be positive";
       }
 
-      offset = (argc>3) ? std::atoi(argv[3]) : 0;
-      if (length <= 0) {
-        throw "ERROR: offset must be nonnegative";
+      if (argc > 3) {
+          auto touch = std::string(argv[3]);
+          if      (touch == "buffer")    pattern = 0;
+          else if (touch == "device")    pattern = 1;
+          else if (touch == "host")      pattern = 2;
+          else if (touch == "alternate") pattern = 3;
+          else {
+            throw "ERROR: usm pattern must be buffer, device, host, or alternate";
+          }
       }
   }
   catch (const char * e) {
@@ -234,7 +369,11 @@ int main(int argc, char * argv[])
 
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Vector length        = " << length << std::endl;
-  std::cout << "Offset               = " << offset << std::endl;
+  if (pattern > 0) {
+    std::cout << "USM touch pattern    = "
+              << (pattern==1 ? "device" : pattern==2 ? "host" : "alternate")
+              << std::endl;
+  }
 
   //////////////////////////////////////////////////////////////////////
   /// Setup SYCL environment
@@ -253,8 +392,13 @@ int main(int argc, char * argv[])
         std::cout << "SYCL Device:   " << device.get_info<cl::sycl::info::device::name>() << std::endl;
         std::cout << "SYCL Platform: " << platform.get_info<cl::sycl::info::platform::name>() << std::endl;
 #endif
-        run<float>(host, iterations, length);
-        run<double>(host, iterations, length);
+        if (pattern > 0) {
+          run_usm<float>(host, iterations, length, pattern);
+          run_usm<double>(host, iterations, length, pattern);
+        } else {
+          run<float>(host, iterations, length);
+          run<double>(host, iterations, length);
+        }
     } else {
         std::cout << "Skipping host device since it is too slow for large problems" << std::endl;
     }
@@ -271,7 +415,10 @@ int main(int argc, char * argv[])
 #else
         bool has_spir = true; // ?
 #endif
-        if (has_spir) {
+        if (pattern > 0) {
+          run_usm<float>(cpu, iterations, length, pattern);
+          run_usm<double>(cpu, iterations, length, pattern);
+        } else if (has_spir) {
           run<float>(cpu, iterations, length);
           run<double>(cpu, iterations, length);
         }
@@ -294,7 +441,12 @@ int main(int argc, char * argv[])
         if (!has_fp64) {
           std::cout << "SYCL GPU device lacks FP64 support." << std::endl;
         }
-        if (has_spir) {
+        if (pattern > 0) {
+          run_usm<float>(gpu, iterations, length, pattern);
+          if (has_fp64) {
+            run_usm<double>(gpu, iterations, length, pattern);
+          }
+        } else if (has_spir) {
           run<float>(gpu, iterations, length);
           if (has_fp64) {
             run<double>(gpu, iterations, length);
@@ -42,7 +42,12 @@
 ///          of iterations to loop over the triad vectors, the length of the
 ///          vectors, and the offset between vectors
 ///
-///          <progname> <# iterations> <vector length> <offset>
+///          <progname> <# iterations> <vector length> <offset> [<layout>]
+///
+///          The layout is one of left, right, stride, or all (default
+///          right); "all" runs the same benchmark once per layout and
+///          reports each, as a standing check that the layout abstraction
+///          does not cost bandwidth on the configured backend.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
@@ -70,65 +75,40 @@
 #define PRK_KOKKOS_BACKEND OpenMP
 #endif
 
-int main(int argc, char * argv[])
-{
-  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
-  std::cout << "C++11/Kokkos STREAM triad: A = B + scalar * C" << std::endl;
-
-  Kokkos::initialize(argc, argv);
-  {
-
-    typedef Kokkos::PRK_KOKKOS_BACKEND Space;
-    //typedef Kokkos::TeamPolicy<Space>               team_policy;
-    //typedef Kokkos::TeamPolicy<Space>::member_type  member_type;
+typedef Kokkos::PRK_KOKKOS_BACKEND Space;
+//typedef Kokkos::TeamPolicy<Space>               team_policy;
+//typedef Kokkos::TeamPolicy<Space>::member_type  member_type;
 
-    typedef Kokkos::View<double*, Space> vector;
+typedef Kokkos::View<double*, Kokkos::LayoutRight,  Space> vector_right;
+typedef Kokkos::View<double*, Kokkos::LayoutLeft,   Space> vector_left;
+typedef Kokkos::View<double*, Kokkos::LayoutStride, Space> vector_stride;
 
-    //////////////////////////////////////////////////////////////////////
-    /// Read and test input parameters
-    //////////////////////////////////////////////////////////////////////
-
-    int iterations, offset;
-    size_t length;
-    try {
-        if (argc < 3) {
-          throw "Usage: <# iterations> <vector length>";
-        }
-
-        iterations  = std::atoi(argv[1]);
-        if (iterations < 1) {
-          throw "ERROR: iterations must be >= 1";
-        }
-
-        length = std::atol(argv[2]);
-        if (length <= 0) {
-          throw "ERROR: vector length must be positive";
-        }
-
-        offset = (argc>3) ? std::atoi(argv[3]) : 0;
-        if (length <= 0) {
-          throw "ERROR: offset must be nonnegative";
-        }
-    }
-    catch (const char * e) {
-      std::cout << e << std::endl;
-      return 1;
-    }
-
-    std::cout << "Number of iterations = " << iterations << std::endl;
-    std::cout << "Vector length        = " << length << std::endl;
-    std::cout << "Offset               = " << offset << std::endl;
-    std::cout << "Kokkos execution space: " << Kokkos::DefaultExecutionSpace::name() << std::endl;
+// LayoutStride views require the strides to be spelled out; the other
+// layouts are constructed from the extent alone
+template <typename vector> struct view_maker {
+  static vector make(const char * label, size_t length) {
+    return vector(label, length);
+  }
+};
+template <> struct view_maker<vector_stride> {
+  static vector_stride make(const char * label, size_t length) {
+    Kokkos::LayoutStride layout(length, 1);
+    return vector_stride(label, layout);
+  }
+};
 
-    //////////////////////////////////////////////////////////////////////
-    // Allocate space and perform the computation
-    //////////////////////////////////////////////////////////////////////
+// identical logic for every layout, so that any rate difference between
+// the instantiations is attributable to the layout alone
+template <typename vector>
+int run(int iterations, size_t length, const char * layout_name)
+{
+    std::cout << "Kokkos view layout   = " << layout_name << std::endl;
 
     double nstream_time(0);
 
-    vector A("A", length);
-    vector B("B", length);
-    vector C("C", length);
+    vector A = view_maker<vector>::make("A", length);
+    vector B = view_maker<vector>::make("B", length);
+    vector C = view_maker<vector>::make("C", length);
 
     const double scalar(3);
 
@@ -189,10 +169,82 @@ int main(int argc, char * argv[])
                   << " Avg time (s): " << avgtime << std::endl;
     }
 
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11/Kokkos STREAM triad: A = B + scalar * C" << std::endl;
+
+  int status = 0;
+
+  Kokkos::initialize(argc, argv);
+  {
+
+    //////////////////////////////////////////////////////////////////////
+    /// Read and test input parameters
+    //////////////////////////////////////////////////////////////////////
+
+    int iterations, offset;
+    size_t length;
+    std::string layout("right");
+    try {
+        if (argc < 3) {
+          throw "Usage: <# iterations> <vector length> [<offset>] [<layout>]";
+        }
+
+        iterations  = std::atoi(argv[1]);
+        if (iterations < 1) {
+          throw "ERROR: iterations must be >= 1";
+        }
+
+        length = std::atol(argv[2]);
+        if (length <= 0) {
+          throw "ERROR: vector length must be positive";
+        }
+
+        offset = (argc>3) ? std::atoi(argv[3]) : 0;
+        if (length <= 0) {
+          throw "ERROR: offset must be nonnegative";
+        }
+
+        if (argc > 4) {
+          layout = std::string(argv[4]);
+          if (layout != "left" && layout != "right" &&
+              layout != "stride" && layout != "all") {
+            throw "ERROR: layout must be left, right, stride, or all";
+          }
+        }
+    }
+    catch (const char * e) {
+      std::cout << e << std::endl;
+      return 1;
+    }
+
+    std::cout << "Number of iterations = " << iterations << std::endl;
+    std::cout << "Vector length        = " << length << std::endl;
+    std::cout << "Offset               = " << offset << std::endl;
+    std::cout << "Kokkos execution space: " << Kokkos::DefaultExecutionSpace::name() << std::endl;
+
+    //////////////////////////////////////////////////////////////////////
+    // Allocate space and perform the computation
+    //////////////////////////////////////////////////////////////////////
+
+    if (layout == "right" || layout == "all") {
+      status |= run<vector_right>(iterations, length, "LayoutRight");
+    }
+    if (layout == "left" || layout == "all") {
+      status |= run<vector_left>(iterations, length, "LayoutLeft");
+    }
+    if (layout == "stride" || layout == "all") {
+      status |= run<vector_stride>(iterations, length, "LayoutStride");
+    }
+
   }
   Kokkos::finalize();
 
-  return 0;
+  return status;
 }
 
 
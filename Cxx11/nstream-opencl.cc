@@ -44,6 +44,12 @@
 ///
 ///          <progname> <# iterations> <vector length> <offset>
 ///
+///          Setting environment variable PRK_OPENCL_SVM=coarse or
+///          PRK_OPENCL_SVM=fine runs with shared virtual memory
+///          instead of buffers on devices that support it; no host
+///          copies are made in that mode, matching zero-copy iGPU
+///          deployments.
+///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
 ///
@@ -69,7 +75,7 @@ void run(cl::Context context, int iterations, size_t length)
 {
   auto precision = (sizeof(T)==8) ? 64 : 32;
 
-  cl::Program program(context, prk::opencl::loadProgram("nstream.cl"), true);
+  cl::Program program = prk::opencl::buildProgram(context, prk::opencl::loadProgram("nstream.cl"));
 
   auto function = (precision==64) ? "nstream64" : "nstream32";
 
@@ -110,8 +116,10 @@ void run(cl::Context context, int iterations, size_t length)
   }
   nstream_time = prk::wtime() - nstream_time;
 
-  // copy output back to host
+#ifdef VERBOSE
+  // full readback and serial verification - debug only
   cl::copy(queue, d_a, begin(h_a), end(h_a));
+#endif
 
   //////////////////////////////////////////////////////////////////////
   /// Analyze and output results
@@ -127,9 +135,33 @@ void run(cl::Context context, int iterations, size_t length)
   ar *= length;
 
   double asum(0);
+#ifdef VERBOSE
   for (size_t i=0; i<length; i++) {
       asum += std::fabs(h_a[i]);
   }
+#else
+  {
+    // the checksum is reduced on the device so that only per-group
+    // partial sums are transferred, not the whole vector
+    auto sumfunction = (precision==64) ? "checksum64" : "checksum32";
+    auto sumkernel = cl::make_kernel<int, cl::Buffer, cl::LocalSpaceArg, cl::Buffer>(program, sumfunction, &err);
+    if(err != CL_SUCCESS){
+      std::vector<cl::Device> devices = context.getInfo<CL_CONTEXT_DEVICES>();
+      std::cout << program.getBuildInfo<CL_PROGRAM_BUILD_LOG>(devices[0]) << std::endl;
+    }
+    const size_t wgsize = 64;
+    const size_t ngroups = 64;
+    std::vector<T> h_err(ngroups, T(0));
+    cl::Buffer d_err = cl::Buffer(context, begin(h_err), end(h_err), false);
+    sumkernel(cl::EnqueueArgs(queue, cl::NDRange(wgsize*ngroups), cl::NDRange(wgsize)),
+              length, d_a, cl::Local(wgsize*sizeof(T)), d_err);
+    queue.finish();
+    cl::copy(queue, d_err, begin(h_err), end(h_err));
+    for (size_t g=0; g<ngroups; g++) {
+        asum += h_err[g];
+    }
+  }
+#endif
 
   const double epsilon = (precision==64) ? 1.0e-8 : 1.0e-4;
   if (std::fabs(ar-asum)/asum > epsilon) {
@@ -147,6 +179,151 @@ void run(cl::Context context, int iterations, size_t length)
   }
 }
 
+#ifdef CL_VERSION_2_0
+// The SVM variant allocates the three vectors with clSVMAlloc and
+// passes them straight to the kernel: there are no host-device copies
+// at all, so the timed loop matches a zero-copy iGPU deployment.
+// Coarse-grained SVM brackets host access with map/unmap; fine-grained
+// SVM touches the memory directly.
+template <typename T>
+void run_svm(cl::Context context, int iterations, size_t length, bool fine)
+{
+  auto precision = (sizeof(T)==8) ? 64 : 32;
+
+  cl::Program program = prk::opencl::buildProgram(context, prk::opencl::loadProgram("nstream.cl"));
+
+  auto function = (precision==64) ? "nstream64" : "nstream32";
+
+  cl_int err;
+  cl::Kernel kernel(program, function, &err);
+  if(err != CL_SUCCESS){
+    std::vector<cl::Device> devices = context.getInfo<CL_CONTEXT_DEVICES>();
+    std::cout << program.getBuildInfo<CL_PROGRAM_BUILD_LOG>(devices[0]) << std::endl;
+  }
+
+  cl::CommandQueue queue(context);
+
+  //////////////////////////////////////////////////////////////////////
+  /// Allocate SVM for the three vectors
+  //////////////////////////////////////////////////////////////////////
+
+  auto nstream_time = 0.0;
+
+  const size_t bytes = length*sizeof(T);
+  T * a = static_cast<T*>(prk::opencl::svmAlloc(context, bytes, fine));
+  T * b = static_cast<T*>(prk::opencl::svmAlloc(context, bytes, fine));
+  T * c = static_cast<T*>(prk::opencl::svmAlloc(context, bytes, fine));
+  if (a==NULL || b==NULL || c==NULL) {
+    std::cout << "SVM allocation failed" << std::endl;
+    prk::opencl::svmFree(context, a);
+    prk::opencl::svmFree(context, b);
+    prk::opencl::svmFree(context, c);
+    return;
+  }
+
+  if (!fine) {
+    prk::opencl::svmMap(queue, a, bytes);
+    prk::opencl::svmMap(queue, b, bytes);
+    prk::opencl::svmMap(queue, c, bytes);
+  }
+  for (size_t i=0; i<length; i++) {
+    a[i] = T(0);
+    b[i] = T(2);
+    c[i] = T(2);
+  }
+  if (!fine) {
+    prk::opencl::svmUnmap(queue, a);
+    prk::opencl::svmUnmap(queue, b);
+    prk::opencl::svmUnmap(queue, c);
+  }
+
+  double scalar = 3.0;
+
+  kernel.setArg(0, static_cast<int>(length));
+  kernel.setArg(1, static_cast<T>(scalar));
+  prk::opencl::setKernelArgSVM(kernel, 2, a);
+  prk::opencl::setKernelArgSVM(kernel, 3, b);
+  prk::opencl::setKernelArgSVM(kernel, 4, c);
+
+  for (auto iter = 0; iter<=iterations; iter++) {
+
+    if (iter==1) nstream_time = prk::wtime();
+
+    queue.enqueueNDRangeKernel(kernel, cl::NullRange, cl::NDRange(length));
+    queue.finish();
+
+  }
+  nstream_time = prk::wtime() - nstream_time;
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  T ar(0);
+  T br(2);
+  T cr(2);
+  for (auto i=0; i<=iterations; i++) {
+      ar += br + scalar * cr;
+  }
+
+  ar *= length;
+
+  // the result is already host-visible; only coarse-grained SVM needs
+  // the map before the host reads it
+  if (!fine) prk::opencl::svmMap(queue, a, bytes);
+  double asum(0);
+  for (size_t i=0; i<length; i++) {
+      asum += std::fabs(a[i]);
+  }
+  if (!fine) prk::opencl::svmUnmap(queue, a);
+
+  prk::opencl::svmFree(context, a);
+  prk::opencl::svmFree(context, b);
+  prk::opencl::svmFree(context, c);
+
+  const double epsilon = (precision==64) ? 1.0e-8 : 1.0e-4;
+  if (std::fabs(ar-asum)/asum > epsilon) {
+      std::cout << "Failed Validation on output array\n"
+                << "       Expected checksum: " << ar << "\n"
+                << "       Observed checksum: " << asum << std::endl;
+      std::cout << "ERROR: solution did not validate" << std::endl;
+  } else {
+      std::cout << "Solution validates" << std::endl;
+      double avgtime = nstream_time/iterations;
+      double nbytes = 4.0 * length * sizeof(T);
+      std::cout << precision << "B "
+                << "Rate (MB/s): " << 1.e-6*nbytes/avgtime
+                << " Avg time (s): " << avgtime << std::endl;
+  }
+}
+#endif // CL_VERSION_2_0
+
+// dispatch on the requested SVM mode, falling back to buffers when the
+// device (or the OpenCL headers) cannot do what was asked
+template <typename T>
+void dispatch(cl::Context context, int iterations, size_t length, int svm)
+{
+#ifdef CL_VERSION_2_0
+  if (svm != 0) {
+    const auto caps = prk::opencl::svmCapabilities(context);
+    const bool fine = (svm == 2);
+    const cl_device_svm_capabilities need = fine ? CL_DEVICE_SVM_FINE_GRAIN_BUFFER
+                                                 : CL_DEVICE_SVM_COARSE_GRAIN_BUFFER;
+    if (caps & need) {
+      run_svm<T>(context, iterations, length, fine);
+      return;
+    }
+    std::cout << "Device lacks " << (fine ? "fine" : "coarse")
+              << "-grained SVM; running with buffers" << std::endl;
+  }
+#else
+  if (svm != 0) {
+    std::cout << "OpenCL headers predate 2.0; running with buffers" << std::endl;
+  }
+#endif
+  run<T>(context, iterations, length);
+}
+
 int main(int argc, char* argv[])
 {
   std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
@@ -182,9 +359,24 @@ int main(int argc, char* argv[])
     return 1;
   }
 
+  // PRK_OPENCL_SVM=coarse|fine selects shared virtual memory instead
+  // of buffers on devices that support it
+  int svm = 0;
+  const char * svm_env = std::getenv("PRK_OPENCL_SVM");
+  if (svm_env != nullptr) {
+    const std::string s(svm_env);
+    if      (s == "coarse") svm = 1;
+    else if (s == "fine")   svm = 2;
+    else if (s != "0" && !s.empty()) {
+      std::cout << "PRK_OPENCL_SVM=" << s << " not recognized (coarse|fine); running with buffers" << std::endl;
+    }
+  }
+
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Vector length        = " << length << std::endl;
   std::cout << "Offset               = " << offset << std::endl;
+  std::cout << "Memory mode          = " << (svm==2 ? "fine-grained SVM" :
+                                             svm==1 ? "coarse-grained SVM" : "buffers") << std::endl;
 
   //////////////////////////////////////////////////////////////////////
   /// Setup OpenCL environment
@@ -202,9 +394,9 @@ int main(int argc, char* argv[])
     std::cout << "CPU Precision        = " << precision << "-bit" << std::endl;
 
     if (precision==64) {
-        run<double>(cpu, iterations, length);
+        dispatch<double>(cpu, iterations, length, svm);
     }
-    run<float>(cpu, iterations, length);
+    dispatch<float>(cpu, iterations, length, svm);
   } else {
     std::cerr << "No CPU" << std::endl;
   }
@@ -217,9 +409,9 @@ int main(int argc, char* argv[])
     std::cout << "GPU Precision        = " << precision << "-bit" << std::endl;
 
     if (precision==64) {
-        run<double>(gpu, iterations, length);
+        dispatch<double>(gpu, iterations, length, svm);
     }
-    run<float>(gpu, iterations, length);
+    dispatch<float>(gpu, iterations, length, svm);
   } else {
     std::cerr << "No GPU" << std::endl;
   }
@@ -233,9 +425,9 @@ int main(int argc, char* argv[])
     std::cout << "ACC Precision        = " << precision << "-bit" << std::endl;
 
     if (precision==64) {
-        run<double>(acc, iterations, length);
+        dispatch<double>(acc, iterations, length, svm);
     }
-    run<float>(acc, iterations, length);
+    dispatch<float>(acc, iterations, length, svm);
   } else {
     std::cerr << "No ACC" << std::endl;
   }
@@ -129,7 +129,55 @@ int main(int argc, char * argv[])
   }
 
   // DEVICE
-  OMP_TARGET( data map(tofrom: A[0:length], B[0:length], C[0:length]) map(from:nstream_time) )
+  double h2d_time(0), d2h_time(0);
+
+#ifdef USE_TARGET_ALLOC
+  // allocate the working set on the device and stage the host copies
+  // explicitly, bypassing the mapping tables altogether
+  const size_t bytes = length * sizeof(double);
+  const int dev  = omp_get_default_device();
+  const int host = omp_get_initial_device();
+  double * RESTRICT dA = static_cast<double*>(omp_target_alloc(bytes, dev));
+  double * RESTRICT dB = static_cast<double*>(omp_target_alloc(bytes, dev));
+  double * RESTRICT dC = static_cast<double*>(omp_target_alloc(bytes, dev));
+  if (dA==nullptr || dB==nullptr || dC==nullptr) {
+    std::cout << "ERROR: omp_target_alloc failed" << std::endl;
+    return 1;
+  }
+
+  h2d_time = prk::wtime();
+  omp_target_memcpy(dA, A, bytes, 0, 0, dev, host);
+  omp_target_memcpy(dB, B, bytes, 0, 0, dev, host);
+  omp_target_memcpy(dC, C, bytes, 0, 0, dev, host);
+  h2d_time = prk::wtime() - h2d_time;
+
+  {
+    for (auto iter = 0; iter<=iterations; iter++) {
+
+      if (iter==1) nstream_time = prk::wtime();
+
+      OMP_TARGET( teams distribute parallel for simd schedule(static,1) is_device_ptr(dA,dB,dC) )
+      for (size_t i=0; i<length; i++) {
+          dA[i] += dB[i] + scalar * dC[i];
+      }
+    }
+    nstream_time = prk::wtime() - nstream_time;
+  }
+
+  d2h_time = prk::wtime();
+  omp_target_memcpy(A, dA, bytes, 0, 0, host, dev);
+  d2h_time = prk::wtime() - d2h_time;
+
+  omp_target_free(dA, dev);
+  omp_target_free(dB, dev);
+  omp_target_free(dC, dev);
+#else
+  // map the working set once, before the timed loop; the kernel below
+  // runs map-free against the device copies
+  h2d_time = prk::wtime();
+  OMP_TARGET( enter data map(to: A[0:length], B[0:length], C[0:length]) )
+  h2d_time = prk::wtime() - h2d_time;
+
   {
     for (auto iter = 0; iter<=iterations; iter++) {
 
@@ -143,6 +191,11 @@ int main(int argc, char * argv[])
     nstream_time = prk::wtime() - nstream_time;
   }
 
+  d2h_time = prk::wtime();
+  OMP_TARGET( exit data map(from: A[0:length]) map(release: B[0:length], C[0:length]) )
+  d2h_time = prk::wtime() - d2h_time;
+#endif
+
   //////////////////////////////////////////////////////////////////////
   /// Analyze and output results
   //////////////////////////////////////////////////////////////////////
@@ -175,6 +228,10 @@ int main(int argc, char * argv[])
       double nbytes = 4.0 * length * sizeof(double);
       std::cout << "Rate (MB/s): " << 1.e-6*nbytes/avgtime
                 << " Avg time (s): " << avgtime << std::endl;
+      if (prk::OpenMP::report_transfers()) {
+        std::cout << "H2D bandwidth (MB/s): " << 1.e-6*3.0*length*sizeof(double)/h2d_time
+                  << " D2H bandwidth (MB/s): " << 1.e-6*length*sizeof(double)/d2h_time << std::endl;
+      }
   }
 
   return 0;
@@ -42,7 +42,11 @@
 ///          of iterations to loop over the triad vectors, the length of the
 ///          vectors, and the offset between vectors
 ///
-///          <progname> <# iterations> <vector length> <offset>
+///          <progname> <# iterations> <vector length> [<offset> <pattern>]
+///
+///          The pattern defaults to the classic 3-stream TRIAD; DOT, COPY,
+///          SCALE and TRIAD4..TRIAD8 (the digit counts total streams) are
+///          also accepted, see prk_nstream.h.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
@@ -63,6 +67,7 @@
 //////////////////////////////////////////////////////////////////////
 
 #include "prk_util.h"
+#include "prk_nstream.h"
 
 int main(int argc, char * argv[])
 {
@@ -79,9 +84,10 @@ int main(int argc, char * argv[])
 
   int iterations, offset;
   size_t length;
+  prk::nstream::pattern pat{prk::nstream::kind::triad,3};
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <vector length>";
+        throw "Usage: <# iterations> <vector length> [<offset> <pattern>]";
       }
 
       iterations  = std::atoi(argv[1]);
@@ -89,7 +95,7 @@ int main(int argc, char * argv[])
         throw "ERROR: iterations must be >= 1";
       }
 
-      length = std::atol(argv[2]);
+      length = prk::parse_size(argv[2]);
       if (length <= 0) {
         throw "ERROR: vector length must be positive";
       }
@@ -98,6 +104,10 @@ int main(int argc, char * argv[])
       if (length <= 0) {
         throw "ERROR: offset must be nonnegative";
       }
+
+      if (argc > 4) {
+        pat = prk::nstream::parse(argv[4]);
+      }
   }
   catch (const char * e) {
     std::cout << e << std::endl;
@@ -110,80 +120,291 @@ int main(int argc, char * argv[])
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Vector length        = " << length << std::endl;
   std::cout << "Offset               = " << offset << std::endl;
+  std::cout << "Pattern              = " << pat.name() << std::endl;
+
+  // PRK_THREAD_SWEEP=1,2,4,8 re-runs the timed region once per thread
+  // count in a single process, re-first-touching the data each point.
+  // PRK_CACHE_SWEEP=1 instead re-runs it once per cache level with the
+  // working set auto-sized from the detected capacities (prk_util.h);
+  // the two sweeps are mutually exclusive.
+  std::vector<int> sweep = prk::thread_sweep();
+  const auto cache_points = prk::cache_sweep_lengths(pat.streams, sizeof(double));
+  const bool cache_sweeping = !cache_points.empty();
+  if (cache_sweeping && !sweep.empty()) {
+    std::cout << "PRK_THREAD_SWEEP ignored in favor of PRK_CACHE_SWEEP" << std::endl;
+    sweep.clear();
+  }
+  const bool sweeping = !sweep.empty();
+
+  // PRK_NUMA_MATRIX=1 re-runs the timed region once per (thread domain,
+  // memory domain) pair: the threads are pinned to the CPUs of domain i
+  // and the array pages are bound to the memory of domain j, yielding the
+  // full initiator x target bandwidth matrix in a single run.
+  std::vector<int> domains;
+  {
+    const char * e = std::getenv("PRK_NUMA_MATRIX");
+    if (e != nullptr && std::atoi(e) != 0) {
+      if (sweeping || cache_sweeping) {
+        std::cout << "PRK_NUMA_MATRIX ignored in favor of thread/cache sweep" << std::endl;
+      } else {
+        domains = prk::numa_domains();
+        if (domains.empty()) {
+          std::cout << "PRK_NUMA_MATRIX ignored: no NUMA information in /sys" << std::endl;
+        }
+      }
+    }
+  }
+  const bool numa_matrix = !domains.empty();
+  if (numa_matrix) {
+    std::cout << "NUMA domains         = " << domains.size() << std::endl;
+  }
+  std::vector<double> matrix_rates(numa_matrix ? domains.size()*domains.size() : 0);
+  if (sweeping) {
+    std::cout << "Thread scaling:" << std::endl;
+    std::cout << std::setw(8)  << "Threads"
+              << std::setw(16) << "Rate (MB/s)"
+              << std::setw(16) << "Avg time (s)" << std::endl;
+  } else if (cache_sweeping) {
+    std::cout << "Cache sweep:" << std::endl;
+    std::cout << std::setw(8)  << "Level"
+              << std::setw(12) << "WS (KiB)"
+              << std::setw(14) << "Length"
+              << std::setw(16) << "Rate (MB/s)"
+              << std::setw(16) << "Avg time (s)" << std::endl;
+  }
 
   //////////////////////////////////////////////////////////////////////
   // Allocate space and perform the computation
   //////////////////////////////////////////////////////////////////////
 
-  auto nstream_time = 0.0;
+  double scalar = 3.0;
 
-  double * RESTRICT A = new double[length];
-  double * RESTRICT B = new double[length];
-  double * RESTRICT C = new double[length];
+  prk::energy_meter energy;
 
-  double scalar = 3.0;
+  const size_t num_points = sweeping ? sweep.size() :
+                            cache_sweeping ? cache_points.size() :
+                            numa_matrix ? domains.size()*domains.size() : 1;
 
-  OMP_PARALLEL()
-  {
-    OMP_FOR_SIMD
-    for (size_t i=0; i<length; i++) {
-      A[i] = 0.0;
-      B[i] = 2.0;
-      C[i] = 2.0;
+  for (size_t point=0; point < num_points; point++) {
+
+    std::vector<int> domain_cpus;
+    int mem_domain(-1);
+    if (numa_matrix) {
+      const int cpu_domain = domains[point / domains.size()];
+      mem_domain = domains[point % domains.size()];
+      domain_cpus = prk::numa_domain_cpus(cpu_domain);
+#ifdef _OPENMP
+      omp_set_num_threads(static_cast<int>(domain_cpus.size()));
+#endif
     }
 
-    for (auto iter = 0; iter<=iterations; iter++) {
+#ifdef _OPENMP
+    if (sweeping) omp_set_num_threads(sweep[point]);
+#endif
+    if (cache_sweeping) length = cache_points[point].second;
+
+    auto nstream_time = 0.0;
+    double dotresult(0.0);
 
-      if (iter==1) {
-          OMP_BARRIER
-          OMP_MASTER
-          nstream_time = prk::wtime();
+    // allocated fresh per sweep point so that first touch below places
+    // pages for the thread count being measured
+    double * RESTRICT A = new double[length];
+    double * S[7];
+    for (int s=0; s<pat.sources(); s++) {
+        S[s] = new double[length];
+    }
+    if (numa_matrix) {
+      // binding trumps first touch, so the initialization threads need
+      // not live on the memory domain being measured
+      prk::bind_pages(A, length*sizeof(double), mem_domain);
+      for (int s=0; s<pat.sources(); s++) {
+        prk::bind_pages(S[s], length*sizeof(double), mem_domain);
       }
+    }
 
+    OMP_PARALLEL()
+    {
+#ifdef _OPENMP
+      if (numa_matrix) {
+        prk::bind_thread(domain_cpus[omp_get_thread_num() % domain_cpus.size()]);
+      }
+#else
+      if (numa_matrix && !domain_cpus.empty()) {
+        prk::bind_thread(domain_cpus[0]);
+      }
+#endif
       OMP_FOR_SIMD
       for (size_t i=0; i<length; i++) {
-          A[i] += B[i] + scalar * C[i];
+        A[i] = 0.0;
+      }
+      for (int s=0; s<pat.sources(); s++) {
+        double * RESTRICT src = S[s];
+        OMP_FOR_SIMD
+        for (size_t i=0; i<length; i++) {
+          src[i] = 2.0;
+        }
+      }
+
+      const double * RESTRICT B = S[0];
+      const double * RESTRICT C = (pat.sources()>1) ? S[1] : nullptr;
+      const double * RESTRICT D = (pat.sources()>2) ? S[2] : nullptr;
+      const double * RESTRICT E = (pat.sources()>3) ? S[3] : nullptr;
+      const double * RESTRICT F = (pat.sources()>4) ? S[4] : nullptr;
+      const double * RESTRICT G = (pat.sources()>5) ? S[5] : nullptr;
+      const double * RESTRICT H = (pat.sources()>6) ? S[6] : nullptr;
+
+      for (auto iter = 0; iter<=iterations; iter++) {
+
+        if (iter==1) {
+            OMP_BARRIER
+            OMP_MASTER
+            {
+              energy.start();
+              nstream_time = prk::wtime();
+            }
+        }
+
+        // pat is the same on every thread, so all threads reach the same
+        // worksharing loop
+        switch (pat.k) {
+          case prk::nstream::kind::dot:
+            OMP_FOR_REDUCE( +:dotresult )
+            for (size_t i=0; i<length; i++) {
+                dotresult += B[i] * C[i];
+            }
+            break;
+          case prk::nstream::kind::copy:
+            OMP_FOR_SIMD
+            for (size_t i=0; i<length; i++) {
+                A[i] = B[i];
+            }
+            break;
+          case prk::nstream::kind::scale:
+            OMP_FOR_SIMD
+            for (size_t i=0; i<length; i++) {
+                A[i] = scalar * B[i];
+            }
+            break;
+          case prk::nstream::kind::triad:
+            switch (pat.streams) {
+              case 3:
+                OMP_FOR_SIMD
+                for (size_t i=0; i<length; i++) {
+                    A[i] += B[i] + scalar * C[i];
+                }
+                break;
+              case 4:
+                OMP_FOR_SIMD
+                for (size_t i=0; i<length; i++) {
+                    A[i] += B[i] + scalar * C[i] + D[i];
+                }
+                break;
+              case 5:
+                OMP_FOR_SIMD
+                for (size_t i=0; i<length; i++) {
+                    A[i] += B[i] + scalar * C[i] + D[i] + scalar * E[i];
+                }
+                break;
+              case 6:
+                OMP_FOR_SIMD
+                for (size_t i=0; i<length; i++) {
+                    A[i] += B[i] + scalar * C[i] + D[i] + scalar * E[i] + F[i];
+                }
+                break;
+              case 7:
+                OMP_FOR_SIMD
+                for (size_t i=0; i<length; i++) {
+                    A[i] += B[i] + scalar * C[i] + D[i] + scalar * E[i] + F[i] + scalar * G[i];
+                }
+                break;
+              case 8:
+                OMP_FOR_SIMD
+                for (size_t i=0; i<length; i++) {
+                    A[i] += B[i] + scalar * C[i] + D[i] + scalar * E[i] + F[i] + scalar * G[i] + H[i];
+                }
+                break;
+            }
+            break;
+        }
+      }
+      OMP_BARRIER
+      OMP_MASTER
+      {
+        nstream_time = prk::wtime() - nstream_time;
+        energy.stop();
       }
     }
-    OMP_BARRIER
-    OMP_MASTER
-    nstream_time = prk::wtime() - nstream_time;
-  }
 
-  //////////////////////////////////////////////////////////////////////
-  /// Analyze and output results
-  //////////////////////////////////////////////////////////////////////
+    //////////////////////////////////////////////////////////////////////
+    /// Analyze and output results
+    //////////////////////////////////////////////////////////////////////
 
-  double ar(0);
-  double br(2);
-  double cr(2);
-  for (auto i=0; i<=iterations; i++) {
-      ar += br + scalar * cr;
-  }
+    const double ar = prk::nstream::checksum(pat, iterations, length, scalar);
 
-  ar *= length;
+    double asum(0);
+    if (pat.k == prk::nstream::kind::dot) {
+        asum = dotresult;
+    } else {
+        OMP_PARALLEL_FOR_REDUCE( +:asum )
+        for (size_t i=0; i<length; i++) {
+            asum += std::fabs(A[i]);
+        }
+    }
+
+    double epsilon=1.e-8;
+    if (std::fabs(ar-asum)/ar > epsilon) {
+        std::cout << "Failed Validation on output array\n"
+                  << "       Expected checksum: " << ar << "\n"
+                  << "       Observed checksum: " << asum << std::endl;
+        std::cout << "ERROR: solution did not validate" << std::endl;
+        return 1;
+    } else {
+        double avgtime = nstream_time/iterations;
+        double nbytes = prk::nstream::bytes_per_iteration(pat, length);
+        if (sweeping) {
+          std::cout << std::setw(8)  << sweep[point]
+                    << std::setw(16) << 1.e-6*nbytes/avgtime
+                    << std::setw(16) << avgtime << std::endl;
+        } else if (cache_sweeping) {
+          std::cout << std::setw(8)  << cache_points[point].first
+                    << std::setw(12) << pat.streams*length*sizeof(double)/1024
+                    << std::setw(14) << length
+                    << std::setw(16) << 1.e-6*nbytes/avgtime
+                    << std::setw(16) << avgtime << std::endl;
+        } else if (numa_matrix) {
+          matrix_rates[point] = 1.e-6*nbytes/avgtime;
+        } else {
+          std::cout << "Solution validates" << std::endl;
+          std::cout << "Rate (MB/s): " << 1.e-6*nbytes/avgtime
+                    << " Avg time (s): " << avgtime << std::endl;
+          energy.report(1.e-6*nbytes/avgtime, "MB/s");
+        }
+    }
 
-  double asum(0);
-  OMP_PARALLEL_FOR_REDUCE( +:asum )
-  for (size_t i=0; i<length; i++) {
-      asum += std::fabs(A[i]);
+    for (int s=pat.sources()-1; s>=0; s--) {
+        delete[] S[s];
+    }
+    delete[] A;
   }
 
-  double epsilon=1.e-8;
-  if (std::fabs(ar-asum)/asum > epsilon) {
-      std::cout << "Failed Validation on output array\n"
-                << "       Expected checksum: " << ar << "\n"
-                << "       Observed checksum: " << asum << std::endl;
-      std::cout << "ERROR: solution did not validate" << std::endl;
-      return 1;
-  } else {
-      std::cout << "Solution validates" << std::endl;
-      double avgtime = nstream_time/iterations;
-      double nbytes = 4.0 * length * sizeof(double);
-      std::cout << "Rate (MB/s): " << 1.e-6*nbytes/avgtime
-                << " Avg time (s): " << avgtime << std::endl;
+  if (numa_matrix) {
+    std::cout << "Bandwidth matrix (MB/s), thread domain x memory domain:" << std::endl;
+    std::cout << std::setw(8) << " ";
+    for (size_t j=0; j<domains.size(); j++) {
+      std::cout << std::setw(12) << ("mem " + std::to_string(domains[j]));
+    }
+    std::cout << std::endl;
+    for (size_t i=0; i<domains.size(); i++) {
+      std::cout << std::setw(8) << ("cpu " + std::to_string(domains[i]));
+      for (size_t j=0; j<domains.size(); j++) {
+        std::cout << std::setw(12) << matrix_rates[i*domains.size()+j];
+      }
+      std::cout << std::endl;
+    }
   }
 
+  if (sweeping || cache_sweeping || numa_matrix) std::cout << "Solution validates" << std::endl;
+
   return 0;
 }
 
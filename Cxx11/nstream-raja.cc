@@ -42,7 +42,13 @@
 ///          of iterations to loop over the triad vectors, the length of the
 ///          vectors, and the offset between vectors
 ///
-///          <progname> <# iterations> <vector length> <offset>
+///          <progname> <# iterations> <vector length> <offset> [<policy>]
+///
+///          The policy selects one of the compiled-in RAJA execution
+///          policies (seq, simd, omp, omp_static, omp_dynamic); "all"
+///          sweeps the whole matrix and reports each, so a RAJA or
+///          compiler upgrade shows immediately which policy regressed.
+///          The default reproduces the historical thread_exec choice.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
@@ -74,49 +80,12 @@
   typedef RAJA::seq_exec thread_exec;
 #endif
 
-int main(int argc, char * argv[])
+// identical logic for every execution policy, so that any rate difference
+// between the instantiations is attributable to the policy alone
+template <typename exec_policy>
+int run(int iterations, size_t length, const char * policy_name)
 {
-  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
-  std::cout << "C++11/RAJA STREAM triad: A = B + scalar * C" << std::endl;
-
-  //////////////////////////////////////////////////////////////////////
-  /// Read and test input parameters
-  //////////////////////////////////////////////////////////////////////
-
-  int iterations, offset;
-  size_t length;
-  try {
-      if (argc < 3) {
-        throw "Usage: <# iterations> <vector length>";
-      }
-
-      iterations  = std::atoi(argv[1]);
-      if (iterations < 1) {
-        throw "ERROR: iterations must be >= 1";
-      }
-
-      length = std::atol(argv[2]);
-      if (length <= 0) {
-        throw "ERROR: vector length must be positive";
-      }
-
-      offset = (argc>3) ? std::atoi(argv[3]) : 0;
-      if (length <= 0) {
-        throw "ERROR: offset must be nonnegative";
-      }
-  }
-  catch (const char * e) {
-    std::cout << e << std::endl;
-    return 1;
-  }
-
-  std::cout << "Number of iterations = " << iterations << std::endl;
-  std::cout << "Vector length        = " << length << std::endl;
-  std::cout << "Offset               = " << offset << std::endl;
-
-  //////////////////////////////////////////////////////////////////////
-  // Allocate space and perform the computation
-  //////////////////////////////////////////////////////////////////////
+  std::cout << "RAJA execution policy = " << policy_name << std::endl;
 
   double nstream_time(0);
 
@@ -133,8 +102,7 @@ int main(int argc, char * argv[])
   double scalar(3);
 
   {
-    //RAJA::forall<thread_exec>(0, length, [=](RAJA::Index_type i) {
-    RAJA::forall<thread_exec>(range, [=](RAJA::Index_type i) {
+    RAJA::forall<exec_policy>(range, [=](RAJA::Index_type i) {
         A(i) = 0.0;
         B(i) = 2.0;
         C(i) = 2.0;
@@ -144,8 +112,7 @@ int main(int argc, char * argv[])
 
       if (iter==1) nstream_time = prk::wtime();
 
-      //RAJA::forall<thread_exec>(0, length, [=](RAJA::Index_type i) {
-      RAJA::forall<thread_exec>(range, [=](RAJA::Index_type i) {
+      RAJA::forall<exec_policy>(range, [=](RAJA::Index_type i) {
           A(i) += B(i) + scalar * C(i);
       });
     }
@@ -166,12 +133,15 @@ int main(int argc, char * argv[])
   ar *= length;
 
   RAJA::ReduceSum<RAJA::seq_reduce, double> reduced_asum(0.0);
-  //RAJA::forall<RAJA::seq_exec>(RAJA::Index_type(0), RAJA::Index_type(length), [&](RAJA::Index_type i) {
   RAJA::forall<RAJA::seq_exec>(range, [=](RAJA::Index_type i) {
       reduced_asum += std::fabs(A(i));
   });
   double asum(reduced_asum);
 
+  delete [] Cmem;
+  delete [] Bmem;
+  delete [] Amem;
+
   double epsilon=1.e-8;
   if (std::fabs(ar-asum)/asum > epsilon) {
       std::cout << "Failed Validation on output array\n"
@@ -190,4 +160,93 @@ int main(int argc, char * argv[])
   return 0;
 }
 
+int main(int argc, char * argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11/RAJA STREAM triad: A = B + scalar * C" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations, offset;
+  size_t length;
+  std::string policy("default");
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <vector length> [<offset>] [<policy>]";
+      }
+
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      length = std::atol(argv[2]);
+      if (length <= 0) {
+        throw "ERROR: vector length must be positive";
+      }
+
+      offset = (argc>3) ? std::atoi(argv[3]) : 0;
+      if (length <= 0) {
+        throw "ERROR: offset must be nonnegative";
+      }
+
+      if (argc > 4) {
+        policy = std::string(argv[4]);
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Vector length        = " << length << std::endl;
+  std::cout << "Offset               = " << offset << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  // the policy matrix is compiled in; "all" sweeps it so that a RAJA or
+  // compiler upgrade shows immediately which policy regressed
+  int status = 0;
+  bool known = false;
+  bool all = (policy == "all");
+  if (policy == "default") {
+    known = true;
+    status |= run<thread_exec>(iterations, length, "default");
+  }
+  if (all || policy == "seq") {
+    known = true;
+    status |= run<RAJA::seq_exec>(iterations, length, "seq");
+  }
+  if (all || policy == "simd") {
+    known = true;
+    status |= run<RAJA::simd_exec>(iterations, length, "simd");
+  }
+#if defined(RAJA_ENABLE_OPENMP)
+  if (all || policy == "omp") {
+    known = true;
+    status |= run<RAJA::omp_parallel_for_exec>(iterations, length, "omp");
+  }
+  if (all || policy == "omp_static") {
+    known = true;
+    status |= run<RAJA::omp_parallel_for_static_exec<32>>(iterations, length, "omp_static");
+  }
+  if (all || policy == "omp_dynamic") {
+    known = true;
+    status |= run<RAJA::omp_parallel_for_dynamic_exec<32>>(iterations, length, "omp_dynamic");
+  }
+#endif
+  if (!known) {
+    std::cout << "ERROR: unknown policy " << policy
+              << " (try seq, simd, omp, omp_static, omp_dynamic, or all)" << std::endl;
+    return 1;
+  }
+
+  return status;
+}
+
 
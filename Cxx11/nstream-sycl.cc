@@ -40,9 +40,14 @@
 ///
 /// USAGE:   The program takes as input the number
 ///          of iterations to loop over the triad vectors, the length of the
-///          vectors, and the offset between vectors
+///          vectors, and optionally the work-group size
 ///
-///          <progname> <# iterations> <vector length> <offset>
+///          <progname> <# iterations> <vector length> [<work-group size>]
+///
+///          A work-group size of 0 leaves the launch configuration to the
+///          runtime, a positive value launches with an explicit ND-range,
+///          and "auto" sweeps candidate sizes in an untimed probe phase
+///          and keeps the fastest.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
@@ -71,9 +76,10 @@
 #endif
 
 template <typename T> class nstream;
+template <typename T> class nstream_ndr;
 
 template <typename T>
-void run(cl::sycl::queue & q, int iterations, size_t length)
+void run(cl::sycl::queue & q, int iterations, size_t length, int wgsize)
 {
   //////////////////////////////////////////////////////////////////////
   // Allocate space and perform the computation
@@ -98,24 +104,85 @@ void run(cl::sycl::queue & q, int iterations, size_t length)
     cl::sycl::buffer<T,1> d_B { h_B.data(), cl::sycl::range<1>(h_B.size()) };
     cl::sycl::buffer<T,1> d_C { h_C.data(), cl::sycl::range<1>(h_C.size()) };
 
-    for (int iter = 0; iter<=iterations; ++iter) {
-
-      if (iter==1) nstream_time = prk::wtime();
-
+    // one triad with an explicit ND-range; the global size is rounded
+    // up so the tail guard makes any work-group size legal
+    auto triad_ndr = [&](size_t wg) {
+      const size_t global = wg * prk::divceil(length, wg);
       q.submit([&](cl::sycl::handler& h) {
 
         auto A = d_A.template get_access<cl::sycl::access::mode::read_write>(h);
         auto B = d_B.template get_access<cl::sycl::access::mode::read>(h);
         auto C = d_C.template get_access<cl::sycl::access::mode::read>(h);
 
-        h.parallel_for<class nstream<T>>(
+        h.parallel_for<class nstream_ndr<T>>(
+                cl::sycl::nd_range<1>{cl::sycl::range<1>{global}, cl::sycl::range<1>{wg}},
+                [=] (cl::sycl::nd_item<1> it) {
+            const size_t i = it.get_global_id(0);
+            if (i < length) {
+                A[i] += B[i] + scalar * C[i];
+            }
+        });
+      });
+    };
+
+    if (wgsize < 0) {
+      // probe phase: sweep work-group sizes and keep the fastest;
+      // none of these launches is timed
+#ifndef TRISYCL
+      const size_t max_wg = q.get_device().get_info<cl::sycl::info::device::max_work_group_size>();
+#else
+      const size_t max_wg = 1024;
+#endif
+      double best_time(1.e30);
+      for (size_t wg=32; wg<=1024; wg*=2) {
+        if (wg > max_wg || wg > length) break;
+        triad_ndr(wg);
+        q.wait();
+        double probe = prk::wtime();
+        for (int r=0; r<2; ++r) {
+          triad_ndr(wg);
+        }
+        q.wait();
+        probe = prk::wtime() - probe;
+        if (probe < best_time) {
+          best_time = probe;
+          wgsize = wg;
+        }
+      }
+      if (wgsize < 0) wgsize = 0;
+      if (wgsize > 0) {
+        std::cout << "Autotuned work-group size = " << wgsize << std::endl;
+      }
+      // the probe ran extra triads; reset the output before the timed run
+      q.submit([&](cl::sycl::handler& h) {
+        auto A = d_A.template get_access<cl::sycl::access::mode::discard_write>(h);
+        h.fill(A, static_cast<T>(0));
+      });
+      q.wait();
+    }
+
+    for (int iter = 0; iter<=iterations; ++iter) {
+
+      if (iter==1) nstream_time = prk::wtime();
+
+      if (wgsize > 0) {
+        triad_ndr(static_cast<size_t>(wgsize));
+      } else {
+        q.submit([&](cl::sycl::handler& h) {
+
+          auto A = d_A.template get_access<cl::sycl::access::mode::read_write>(h);
+          auto B = d_B.template get_access<cl::sycl::access::mode::read>(h);
+          auto C = d_C.template get_access<cl::sycl::access::mode::read>(h);
+
+          h.parallel_for<class nstream<T>>(
 #if PREBUILD_KERNEL
-                kernel.get_kernel<nstream<T>>(),
+                  kernel.get_kernel<nstream<T>>(),
 #endif
-                cl::sycl::range<1>{length}, [=] (cl::sycl::item<1> i) {
-            A[i] += B[i] + scalar * C[i];
+                  cl::sycl::range<1>{length}, [=] (cl::sycl::item<1> i) {
+              A[i] += B[i] + scalar * C[i];
+          });
         });
-      });
+      }
       q.wait();
     }
 
@@ -187,11 +254,11 @@ int main(int argc, char * argv[])
   /// Read and test input parameters
   //////////////////////////////////////////////////////////////////////
 
-  int iterations, offset;
+  int iterations, wgsize(0);
   size_t length;
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <vector length>";
+        throw "Usage: <# iterations> <vector length> [<work-group size (0=default, auto=probe)>]";
       }
 
       iterations  = std::atoi(argv[1]);
@@ -204,9 +271,8 @@ int main(int argc, char * argv[])
         throw "ERROR: vector length must be positive";
       }
 
-      offset = (argc>3) ? std::atoi(argv[3]) : 0;
-      if (length <= 0) {
-        throw "ERROR: offset must be nonnegative";
+      if (argc > 3) {
+          wgsize = (std::string(argv[3]) == "auto") ? -1 : std::atoi(argv[3]);
       }
   }
   catch (const char * e) {
@@ -216,7 +282,10 @@ int main(int argc, char * argv[])
 
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Vector length        = " << length << std::endl;
-  std::cout << "Offset               = " << offset << std::endl;
+  std::cout << "Work-group size      = ";
+  if      (wgsize < 0)  std::cout << "autotune" << std::endl;
+  else if (wgsize == 0) std::cout << "runtime default" << std::endl;
+  else                  std::cout << wgsize << std::endl;
 
   //////////////////////////////////////////////////////////////////////
   /// Setup SYCL environment
@@ -235,8 +304,8 @@ int main(int argc, char * argv[])
         std::cout << "SYCL Device:   " << device.get_info<cl::sycl::info::device::name>() << std::endl;
         std::cout << "SYCL Platform: " << platform.get_info<cl::sycl::info::platform::name>() << std::endl;
 #endif
-        run<float>(host, iterations, length);
-        run<double>(host, iterations, length);
+        run<float>(host, iterations, length, wgsize);
+        run<double>(host, iterations, length, wgsize);
     } else {
         std::cout << "Skipping host device since it is too slow for large problems" << std::endl;
     }
@@ -254,8 +323,8 @@ int main(int argc, char * argv[])
         bool has_spir = true; // ?
 #endif
         if (has_spir) {
-          run<float>(cpu, iterations, length);
-          run<double>(cpu, iterations, length);
+          run<float>(cpu, iterations, length, wgsize);
+          run<double>(cpu, iterations, length, wgsize);
         }
     }
 
@@ -277,17 +346,17 @@ int main(int argc, char * argv[])
           std::cout << "SYCL GPU device lacks FP64 support." << std::endl;
         }
         if (has_spir) {
-          run<float>(gpu, iterations, length);
+          run<float>(gpu, iterations, length, wgsize);
           if (has_fp64) {
-            run<double>(gpu, iterations, length);
+            run<double>(gpu, iterations, length, wgsize);
           }
         } else {
           std::cout << "SYCL GPU device lacks SPIR-V support." << std::endl;
 #ifdef __COMPUTECPP__
           std::cout << "You are using ComputeCpp so we will try it anyways..." << std::endl;
-          run<float>(gpu, iterations, length);
+          run<float>(gpu, iterations, length, wgsize);
           if (has_fp64) {
-            run<double>(gpu, iterations, length);
+            run<double>(gpu, iterations, length, wgsize);
           }
 #endif
         }
@@ -79,11 +79,11 @@ int main(int argc, char * argv[])
   /// Read and test input parameters
   //////////////////////////////////////////////////////////////////////
 
-  int iterations, offset;
+  int iterations, offset, async;
   size_t length;
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <vector length>";
+        throw "Usage: <# iterations> <vector length> [<offset> <async (0/1)>]";
       }
 
       iterations  = std::atoi(argv[1]);
@@ -100,6 +100,9 @@ int main(int argc, char * argv[])
       if (length <= 0) {
         throw "ERROR: offset must be nonnegative";
       }
+
+      // asynchronous mode: enqueue all iterations, wait once at the end
+      async = (argc>4) ? std::atoi(argv[4]) : 0;
   }
   catch (const char * e) {
     std::cout << e << std::endl;
@@ -112,12 +115,14 @@ int main(int argc, char * argv[])
   std::cout << "Vector length        = " << length << std::endl;
   std::cout << "Offset               = " << offset << std::endl;
   std::cout << "Boost.Compute device = " << device.name() << std::endl;
+  std::cout << "Synchronization      = " << (async ? "pipelined" : "per-iteration") << std::endl;
 
   //////////////////////////////////////////////////////////////////////
   // Allocate space and perform the computation
   //////////////////////////////////////////////////////////////////////
 
   auto nstream_time = 0.0;
+  auto enqueue_time = 0.0;
 
   std::vector<float> h_A(length);
 
@@ -137,7 +142,11 @@ int main(int argc, char * argv[])
 
     for (auto iter = 0; iter<=iterations; iter++) {
 
-      if (iter==1) nstream_time = prk::wtime();
+      if (iter==1) {
+          // drain the warmup iteration so the timer starts with an idle queue
+          if (async) queue.finish();
+          nstream_time = prk::wtime();
+      }
 
       // Aout and Ain are necessary because A += .. does not work
       auto Aout = compute::lambda::get<0>(boost::compute::_1);
@@ -155,6 +164,13 @@ int main(int argc, char * argv[])
                         ),
                         queue
                        );
+      // the in-order queue chains the iterations, so the pipelined mode
+      // only has to wait once, after everything has been enqueued
+      if (!async) queue.finish();
+    }
+
+    if (async) {
+      enqueue_time = prk::wtime() - nstream_time;
       queue.finish();
     }
 
@@ -196,6 +212,9 @@ int main(int argc, char * argv[])
       double nbytes = 4.0 * length * sizeof(float);
       std::cout << "Rate (MB/s): " << 1.e-6*nbytes/avgtime
                 << " Avg time (s): " << avgtime << std::endl;
+      if (async) {
+          std::cout << "Enqueue overhead (us/iter): " << 1.e6*enqueue_time/iterations << std::endl;
+      }
   }
 
   return 0;
@@ -92,7 +92,7 @@ int main(int argc, char * argv[])
         throw "ERROR: iterations must be >= 1";
       }
 
-      length = std::atol(argv[2]);
+      length = prk::parse_size(argv[2]);
       if (length <= 0) {
         throw "ERROR: vector length must be positive";
       }
@@ -107,9 +107,13 @@ int main(int argc, char * argv[])
     return 1;
   }
 
+  const auto policy = prk::PSTL::get_policy();
+
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Vector length        = " << length << std::endl;
   std::cout << "Offset               = " << offset << std::endl;
+  std::cout << "Execution policy     = " << prk::PSTL::policy_name(policy) << std::endl;
+  std::cout << "PSTL backend         = " << prk::PSTL::backend() << std::endl;
 
   //////////////////////////////////////////////////////////////////////
   // Allocate space and perform the computation
@@ -126,15 +130,7 @@ int main(int argc, char * argv[])
   double scalar(3);
 
   {
-#if defined(USE_PSTL) && ( defined(USE_INTEL_PSTL) || ( defined(__GNUC__) && (__GNUC__ >= 9) ) )
-    std::for_each( exec::par_unseq, std::begin(range), std::end(range), [&] (size_t i) {
-#elif defined(USE_PSTL) && defined(__GNUC__) && defined(__GNUC_MINOR__) \
-                        && ( (__GNUC__ == 8) || (__GNUC__ == 7) && (__GNUC_MINOR__ >= 2) )
-#warning GNU parallel
-    __gnu_parallel::for_each( std::begin(range), std::end(range), [&] (size_t i) {
-#else
-    std::for_each( std::begin(range), std::end(range), [&] (size_t i) {
-#endif
+    prk::PSTL::for_each( policy, std::begin(range), std::end(range), [&] (size_t i) {
         A[i] = 0;
         B[i] = 2;
         C[i] = 2;
@@ -144,14 +140,7 @@ int main(int argc, char * argv[])
 
       if (iter==1) nstream_time = prk::wtime();
 
-#if defined(USE_PSTL) && ( defined(USE_INTEL_PSTL) || ( defined(__GNUC__) && (__GNUC__ >= 9) ) )
-      std::for_each( exec::par_unseq, std::begin(range), std::end(range), [&] (size_t i) {
-#elif defined(USE_PSTL) && defined(__GNUC__) && defined(__GNUC_MINOR__) \
-                        && ( (__GNUC__ == 8) || (__GNUC__ == 7) && (__GNUC_MINOR__ >= 2) )
-      __gnu_parallel::for_each( std::begin(range), std::end(range), [&] (size_t i) {
-#else
-      std::for_each( std::begin(range), std::end(range), [&] (size_t i) {
-#endif
+      prk::PSTL::for_each( policy, std::begin(range), std::end(range), [&] (size_t i) {
           A[i] += B[i] + scalar * C[i];
       });
     }
@@ -74,10 +74,12 @@ int main(int argc, char * argv[])
   //////////////////////////////////////////////////////////////////////
 
   int iterations;
-  size_t length, gs, offset;
+  size_t length, offset;
+  long gs;
+  bool compare(false);
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <vector length>";
+        throw "Usage: <# iterations> <vector length> [<grainsize (<0: num_tasks)> <offset> <compare>]";
       }
 
       iterations  = std::atoi(argv[1]);
@@ -90,9 +92,9 @@ int main(int argc, char * argv[])
         throw "ERROR: vector length must be positive";
       }
 
-      // taskloop grainsize
-      gs = (argc > 3) ? std::atoi(argv[3]) : 1;
-      if (gs < 1 || gs > length) {
+      // taskloop granularity: positive sets grainsize, negative num_tasks
+      gs = (argc > 3) ? std::atol(argv[3]) : 1;
+      if (gs == 0 || gs > (long)length || -gs > (long)length) {
         throw "ERROR: grainsize";
       }
 
@@ -100,6 +102,13 @@ int main(int argc, char * argv[])
       if (length <= 0) {
         throw "ERROR: offset must be nonnegative";
       }
+
+      // "compare" splits the timed iterations between taskloop and plain
+      // worksharing sweeps, so the task overhead can be read off one run
+      compare = (argc > 5) && (std::string(argv[5]) == "compare");
+      if (compare && iterations < 2) {
+        throw "ERROR: compare mode needs at least 2 iterations";
+      }
   }
   catch (const char * e) {
     std::cout << e << std::endl;
@@ -108,7 +117,10 @@ int main(int argc, char * argv[])
 
 #ifdef _OPENMP
   std::cout << "Number of threads    = " << omp_get_max_threads() << std::endl;
-  std::cout << "Taskloop grainsize   = " << gs << std::endl;
+  if (gs > 0) std::cout << "Taskloop grainsize   = " << gs << std::endl;
+  else        std::cout << "Taskloop num_tasks   = " << -gs << std::endl;
+  if (compare)
+    std::cout << "Taskloop vs worksharing comparison" << std::endl;
 #endif
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Vector length        = " << length << std::endl;
@@ -126,30 +138,68 @@ int main(int argc, char * argv[])
 
   double scalar = 3.0;
 
+  // in compare mode taskloop runs the first half of the timed iterations
+  // and plain worksharing the rest; the total sweep count is unchanged
+  const int half = compare ? iterations/2 : iterations;
+  double task_time(0), ws_time(0);
+
   OMP_PARALLEL()
   OMP_MASTER
   {
-    OMP_TASKLOOP( firstprivate(length) shared(A,B,C) grainsize(gs) )
-    for (size_t i=0; i<length; i++) {
-      A[i] = 0.0;
-      B[i] = 2.0;
-      C[i] = 2.0;
+    if (gs > 0) {
+      OMP_TASKLOOP( firstprivate(length) shared(A,B,C) grainsize(gs) )
+      for (size_t i=0; i<length; i++) {
+        A[i] = 0.0;
+        B[i] = 2.0;
+        C[i] = 2.0;
+      }
+    } else {
+      OMP_TASKLOOP( firstprivate(length) shared(A,B,C) num_tasks(-gs) )
+      for (size_t i=0; i<length; i++) {
+        A[i] = 0.0;
+        B[i] = 2.0;
+        C[i] = 2.0;
+      }
     }
     OMP_TASKWAIT
 
-    for (auto iter = 0; iter<=iterations; iter++) {
+    for (auto iter = 0; iter<=half; iter++) {
 
       if (iter==1) nstream_time = prk::wtime();
 
-      OMP_TASKLOOP( firstprivate(length) shared(A,B,C) grainsize(gs) )
-      for (size_t i=0; i<length; i++) {
-          A[i] += B[i] + scalar * C[i];
+      if (gs > 0) {
+        OMP_TASKLOOP( firstprivate(length) shared(A,B,C) grainsize(gs) )
+        for (size_t i=0; i<length; i++) {
+            A[i] += B[i] + scalar * C[i];
+        }
+      } else {
+        OMP_TASKLOOP( firstprivate(length) shared(A,B,C) num_tasks(-gs) )
+        for (size_t i=0; i<length; i++) {
+            A[i] += B[i] + scalar * C[i];
+        }
       }
       OMP_TASKWAIT
     }
-    nstream_time = prk::wtime() - nstream_time;
+    task_time = prk::wtime() - nstream_time;
   }
 
+  if (compare) {
+    // identical sweeps without per-iteration task creation; the delta to
+    // the taskloop phase is what task graph reuse could amortize
+    double t1 = prk::wtime();
+    OMP_PARALLEL()
+    {
+      for (auto iter = half+1; iter<=iterations; iter++) {
+        OMP_FOR()
+        for (size_t i=0; i<length; i++) {
+            A[i] += B[i] + scalar * C[i];
+        }
+      }
+    }
+    ws_time = prk::wtime() - t1;
+  }
+  nstream_time = task_time + ws_time;
+
   //////////////////////////////////////////////////////////////////////
   /// Analyze and output results
   //////////////////////////////////////////////////////////////////////
@@ -182,6 +232,13 @@ int main(int argc, char * argv[])
       double nbytes = 4.0 * length * sizeof(double);
       std::cout << "Rate (MB/s): " << 1.e-6*nbytes/avgtime
                 << " Avg time (s): " << avgtime << std::endl;
+      if (compare) {
+        double t_task = task_time/half;
+        double t_ws   = ws_time/(iterations-half);
+        std::cout << "Sweep time/iter (s): " << t_task << " (taskloop) "
+                  << t_ws << " (worksharing), task overhead "
+                  << t_task-t_ws << std::endl;
+      }
   }
 
   return 0;
@@ -86,7 +86,7 @@ int main(int argc, char * argv[])
         throw "ERROR: iterations must be >= 1";
       }
 
-      length = std::atol(argv[2]);
+      length = prk::parse_size(argv[2]);
       if (length <= 0) {
         throw "ERROR: vector length must be positive";
       }
@@ -105,11 +105,18 @@ int main(int argc, char * argv[])
   int num_threads = (envvar!=NULL) ? std::atoi(envvar) : tbb::task_scheduler_init::default_num_threads();
   tbb::task_scheduler_init init(num_threads);
 
+  const auto part = prk::TBB::get_partitioner();
+  const size_t grainsize = prk::TBB::get_grainsize(1);
+  // all loops here traverse the same range, so one affinity state is
+  // shared: the triad then replays the placement of the initialization
+  tbb::affinity_partitioner ap;
+
   std::cout << "Number of threads    = " << num_threads << std::endl;
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Vector length        = " << length << std::endl;
   std::cout << "Offset               = " << offset << std::endl;
-  std::cout << "TBB partitioner: " << typeid(tbb_partitioner).name() << std::endl;
+  std::cout << "TBB partitioner      = " << prk::TBB::partitioner_name(part) << std::endl;
+  std::cout << "TBB grainsize        = " << grainsize << std::endl;
 
   //////////////////////////////////////////////////////////////////////
   // Allocate space and perform the computation
@@ -123,40 +130,26 @@ int main(int argc, char * argv[])
 
   double scalar(3);
 
-  tbb::blocked_range<size_t> range(0, length);
+  tbb::blocked_range<size_t> range(0, length, grainsize);
 
   {
-#if 0
-    tbb::parallel_for( range, [&](decltype(range)& r) {
+    prk::TBB::parallel_for( range, [&](decltype(range)& r) {
                        for (auto i=r.begin(); i!=r.end(); ++i ) {
                            A[i] = 0.0;
                            B[i] = 2.0;
                            C[i] = 2.0;
                        }
-                     }, tbb_partitioner);
-#else
-    tbb::parallel_for( std::begin(range), std::end(range), [&](size_t i) {
-                           A[i] = 0.0;
-                           B[i] = 2.0;
-                           C[i] = 2.0;
-                       }, tbb_partitioner);
-#endif
+                     }, part, ap);
 
     for (auto iter = 0; iter<=iterations; iter++) {
 
       if (iter==1) nstream_time = prk::wtime();
 
-#if 0
-      tbb::parallel_for( range, [&](decltype(range)& r) {
+      prk::TBB::parallel_for( range, [&](decltype(range)& r) {
                          for (auto i=r.begin(); i!=r.end(); ++i ) {
                              A[i] += B[i] + scalar * C[i];
                          }
-                       }, tbb_partitioner);
-#else
-      tbb::parallel_for( std::begin(range), std::end(range), [&](size_t i) {
-                             A[i] += B[i] + scalar * C[i];
-                         }, tbb_partitioner);
-#endif
+                       }, part, ap);
     }
     nstream_time = prk::wtime() - nstream_time;
   }
@@ -175,7 +168,7 @@ int main(int argc, char * argv[])
   ar *= length;
 
   double asum(0);
-  asum = tbb::parallel_reduce( range, double(0),
+  asum = prk::TBB::parallel_reduce( range, double(0),
                                [&](decltype(range)& r, double temp) -> double {
                                    for (auto i=r.begin(); i!=r.end(); ++i ) {
                                        temp += std::fabs(A[i]);
@@ -183,7 +176,7 @@ int main(int argc, char * argv[])
                                    return temp;
                                },
                                [] (const double x1, const double x2) { return x1+x2; },
-                               tbb_partitioner );
+                               part, ap );
 
   double epsilon(1.e-8);
   if (std::fabs(ar-asum)/asum > epsilon) {
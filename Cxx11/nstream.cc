@@ -42,7 +42,18 @@
 ///          of iterations to loop over the triad vectors, the length of the
 ///          vectors, and the offset between vectors
 ///
-///          <progname> <# iterations> <vector length> <offset>
+///          <progname> <# iterations> <vector length> [<offset> <pattern>]
+///
+///          The pattern defaults to the classic 3-stream TRIAD; DOT, COPY,
+///          SCALE and TRIAD4..TRIAD8 (the digit counts total streams) are
+///          also accepted, see prk_nstream.h.
+///
+///          The offset shifts the start of each array by the given number
+///          of elements, so a vector-register or page boundary can be
+///          deliberately missed; a comma-separated list gives each array
+///          its own offset (A first, missing entries are 0).  Combined
+///          with a non-power-of-two length this measures alignment
+///          sensitivity, which differs wildly between ISAs.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
@@ -62,6 +73,9 @@
 //////////////////////////////////////////////////////////////////////
 
 #include "prk_util.h"
+#include "prk_nstream.h"
+
+#include <deque>
 
 int main(int argc, char * argv[])
 {
@@ -72,11 +86,15 @@ int main(int argc, char * argv[])
   /// Read and test input parameters
   //////////////////////////////////////////////////////////////////////
 
-  int iterations, offset;
+  int iterations;
   size_t length;
+  std::vector<size_t> lengths;
+  std::vector<size_t> offsets;
+  prk::nstream::pattern pat{prk::nstream::kind::triad,3};
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <vector length> [<offset>]";
+        throw "Usage: <# iterations> <vector length> [<offset> <pattern>]\n"
+              "       the length accepts K/M/G suffixes and sweep syntax, e.g. 1M:1G:2x";
       }
 
       iterations  = std::atoi(argv[1]);
@@ -84,14 +102,28 @@ int main(int argc, char * argv[])
         throw "ERROR: iterations must be >= 1";
       }
 
-      length = std::atol(argv[2]);
+      lengths = prk::parse_sweep(argv[2]);
+      length = lengths.front();
       if (length <= 0) {
         throw "ERROR: vector length must be positive";
       }
 
-      offset = (argc>3) ? std::atoi(argv[3]) : 0;
-      if (length <= 0) {
-        throw "ERROR: offset must be nonnegative";
+      // start offsets in elements: one value for every array, or a
+      // comma-separated per-array list (A first)
+      if (argc > 3) {
+        std::istringstream iss{std::string(argv[3])};
+        std::string token;
+        while (std::getline(iss, token, ',')) {
+          const int o = std::atoi(token.c_str());
+          if (o < 0) {
+            throw "ERROR: offset must be nonnegative";
+          }
+          offsets.push_back(o);
+        }
+      }
+
+      if (argc > 4) {
+        pat = prk::nstream::parse(argv[4]);
       }
   }
   catch (const char * e) {
@@ -99,67 +131,355 @@ int main(int argc, char * argv[])
     return 1;
   }
 
+  // PRK_NSTREAM_MODE selects the store path for A: "classic" (default)
+  // keeps the cacheable read-for-ownership store, "nt" uses streaming
+  // stores, and "both" runs the two back to back so the 4:1 vs 3:1
+  // traffic ratio can be read off a single run.
+  const char * mode_env = std::getenv("PRK_NSTREAM_MODE");
+  std::string mode = (mode_env!=nullptr) ? mode_env : "classic";
+  const bool classic_triad = (pat.k==prk::nstream::kind::triad && pat.streams==3);
+  if (!classic_triad && mode!="classic") {
+      std::cout << "Streaming stores are implemented for the 3-stream TRIAD only; running classic" << std::endl;
+      mode = "classic";
+  }
+
+  // PRK_CACHE_SWEEP=1 re-runs the kernel once per cache level with the
+  // working set auto-sized from the detected capacities (prk_util.h),
+  // ending with a DRAM-resident point.
+  const auto cache_points = prk::cache_sweep_lengths(pat.streams, sizeof(double));
+  const bool cache_sweeping = !cache_points.empty();
+  // a length sweep on the command line reuses the cache-sweep loop and
+  // reporting, with the sizes given explicitly instead of derived from
+  // the cache capacities
+  const bool length_sweeping = !cache_sweeping && (lengths.size() > 1);
+  // PRK_OFFSET_SWEEP=<max> re-runs the kernel once per start offset
+  // 0..max elements, applied to every array, and tabulates rate vs
+  // offset; it overrides any offsets given on the command line
+  const char * osweep_env = std::getenv("PRK_OFFSET_SWEEP");
+  const int offset_sweep_max = (osweep_env!=nullptr && !cache_sweeping && !length_sweeping)
+                             ? std::atoi(osweep_env) : -1;
+  const bool offset_sweeping = (offset_sweep_max >= 0);
+  const bool sweeping = cache_sweeping || length_sweeping || offset_sweeping;
+  if (sweeping && mode!="classic") {
+      std::cout << "The sweep uses the classic store path" << std::endl;
+      mode = "classic";
+  }
+
+  const bool run_classic = (mode!="nt");
+  const bool run_nt      = (mode=="nt" || mode=="both");
+
+  // PRK_NSTREAM_NODES binds each array's pages to an explicit NUMA node:
+  // A first, then the source arrays in order, so "0,1,1" keeps A on node 0
+  // and serves B and C from node 1 — the mixed-tier layout for CPU-less
+  // (CXL/far-memory) expander nodes.  A "-" entry keeps first-touch
+  // placement for that array, as do entries beyond the list.
+  std::vector<int> array_nodes;
+  const char * nodes_env = std::getenv("PRK_NSTREAM_NODES");
+  if (nodes_env != nullptr) {
+      const auto online = prk::numa_domains();
+      std::istringstream iss{std::string(nodes_env)};
+      std::string token;
+      while (std::getline(iss, token, ',')) {
+          const int node = (token.empty() || token=="-") ? -1 : std::atoi(token.c_str());
+          if (node >= 0 && !online.empty() &&
+              std::find(online.begin(), online.end(), node) == online.end()) {
+              std::cout << "PRK_NSTREAM_NODES ignored: node " << node << " is not online" << std::endl;
+              array_nodes.clear();
+              break;
+          }
+          array_nodes.push_back(node);
+      }
+  }
+
   std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Startup time (s)     = " << prk::startup_time() << std::endl;
   std::cout << "Vector length        = " << length << std::endl;
-  std::cout << "Offset               = " << offset << std::endl;
+  std::cout << "Offset               = ";
+  if      (offset_sweeping)    std::cout << "sweep 0.." << offset_sweep_max;
+  else if (offsets.empty())    std::cout << 0;
+  else if (offsets.size()==1)  std::cout << offsets.front();
+  else {
+    for (size_t a=0; a<(size_t)pat.sources()+1; a++) {
+      std::cout << (a?" ":"") << (char)('A'+a) << ":"
+                << (a<offsets.size() ? offsets[a] : 0);
+    }
+  }
+  std::cout << std::endl;
+  std::cout << "Pattern              = " << pat.name() << std::endl;
+  std::cout << "Store mode           = " << mode << std::endl;
+  if (!array_nodes.empty()) {
+    std::cout << "Array NUMA nodes     =";
+    for (size_t a=0; a<array_nodes.size() && a<(size_t)pat.sources()+1; a++) {
+      std::cout << " " << (char)('A'+a) << ":";
+      if (array_nodes[a] < 0) std::cout << "first-touch";
+      else                    std::cout << array_nodes[a];
+    }
+    std::cout << std::endl;
+  }
+  if (sweeping) {
+    std::cout << (cache_sweeping  ? "Cache sweep:"  :
+                  length_sweeping ? "Length sweep:" : "Offset sweep:") << std::endl;
+    if (offset_sweeping) {
+      std::cout << std::setw(8)  << "Offset"
+                << std::setw(14) << "Length"
+                << std::setw(16) << "Rate (MB/s)"
+                << std::setw(16) << "Avg time (s)" << std::endl;
+    } else {
+      std::cout << std::setw(8)  << "Level"
+                << std::setw(12) << "WS (KiB)"
+                << std::setw(14) << "Length"
+                << std::setw(16) << "Rate (MB/s)"
+                << std::setw(16) << "Avg time (s)" << std::endl;
+    }
+  }
 
   //////////////////////////////////////////////////////////////////////
   // Allocate space and perform the computation
   //////////////////////////////////////////////////////////////////////
 
-  auto nstream_time = 0.0;
+  for (size_t point=0; point < (cache_sweeping  ? cache_points.size() :
+                                offset_sweeping ? (size_t)offset_sweep_max+1 :
+                                                  lengths.size()); point++) {
+
+  if (cache_sweeping)  length = cache_points[point].second;
+  if (length_sweeping) length = lengths[point];
+
+  // resolved per-array start offsets, A first; arrays are over-allocated
+  // by the largest offset so every run touches `length` live elements
+  std::vector<size_t> offs((size_t)pat.sources()+1, 0);
+  if (offset_sweeping) {
+    std::fill(offs.begin(), offs.end(), point);
+  } else if (offsets.size()==1) {
+    std::fill(offs.begin(), offs.end(), offsets.front());
+  } else {
+    for (size_t a=0; a<offs.size() && a<offsets.size(); a++) offs[a] = offsets[a];
+  }
+  const size_t max_off = *std::max_element(offs.begin(), offs.end());
 
-  prk::vector<double> A(length,0.0);
-  prk::vector<double> B(length,2.0);
-  prk::vector<double> C(length,2.0);
+  prk::counters perf;
+
+  prk::adaptive adapt;
+
+  prk::timing tstats(iterations);
+
+  prk::results res("nstream");
+  res.set("iterations", iterations);
+  res.set("length", length);
+  res.set("offset", offs[0]);
+  res.set("pattern", pat.name());
+  res.set("mode", mode);
+  if (!array_nodes.empty()) res.set("nodes", std::string(nodes_env));
+
+  prk::baseline base("nstream");
+  base.set("length", length);
+  base.set("pattern", pat.name());
+  base.set("mode", mode);
+  if (!array_nodes.empty()) base.set("nodes", std::string(nodes_env));
+
+  prk::vector<double> A(length+max_off,0.0);
+  // source arrays; a deque never relocates its elements, which matters
+  // because prk::vector is not movable
+  std::deque<prk::vector<double>> S;
+  for (int s=0; s<pat.sources(); s++) {
+      S.emplace_back(length+max_off,2.0);
+  }
+
+  // the start of each array, shifted by its offset; all loops below
+  // run over the `length` elements from here
+  double * const Ap = A.data() + offs[0];
+  std::vector<const double *> Sp;
+  for (int s=0; s<pat.sources(); s++) {
+      Sp.push_back(S[s].data() + offs[s+1]);
+  }
+
+  // migrate already-touched pages to the requested nodes; initialization
+  // above makes first-touch the fallback for unlisted arrays
+  for (size_t a=0; a<array_nodes.size() && a<(size_t)pat.sources()+1; a++) {
+      if (array_nodes[a] < 0) continue;
+      double * ptr = (a==0) ? A.data() : S[a-1].data();
+      prk::bind_pages(ptr, (length+max_off)*sizeof(double), array_nodes[a]);
+  }
 
   double scalar = 3.0;
+  double dotresult(0);
+
+  auto nstream = [&](bool nt) {
+    double t(0);
+    adapt.reset();
+    for (auto iter = 0; ; iter++) {
 
-  {
-    for (auto iter = 0; iter<=iterations; iter++) {
+      if (iter==1) { t = prk::wtime(); perf.start(); }
 
-      if (iter==1) nstream_time = prk::wtime();
+      const bool sample = res.enabled() || tstats.enabled() || adapt.enabled();
+      const double it0 = sample ? prk::wtime() : 0.0;
 
-      for (size_t i=0; i<length; i++) {
-          A[i] += B[i] + scalar * C[i];
+      if (nt) {
+        prk::nontemporal_triad(Ap, Sp[0], Sp[1], scalar, length);
+      } else {
+        switch (pat.k) {
+          case prk::nstream::kind::dot:
+            {
+              const double * B = Sp[0];
+              const double * C = Sp[1];
+              double local(0);
+              for (size_t i=0; i<length; i++) {
+                  local += B[i] * C[i];
+              }
+              dotresult += local;
+            }
+            break;
+          case prk::nstream::kind::copy:
+            {
+              const double * B = Sp[0];
+              for (size_t i=0; i<length; i++) {
+                  Ap[i] = B[i];
+              }
+            }
+            break;
+          case prk::nstream::kind::scale:
+            {
+              const double * B = Sp[0];
+              for (size_t i=0; i<length; i++) {
+                  Ap[i] = scalar * B[i];
+              }
+            }
+            break;
+          case prk::nstream::kind::triad:
+            {
+              // each arity gets its own loop so the compiler sees a fixed
+              // number of streams
+              const double * B = Sp[0];
+              const double * C = Sp[1];
+              switch (pat.streams) {
+                case 3:
+                  for (size_t i=0; i<length; i++) {
+                      Ap[i] += B[i] + scalar * C[i];
+                  }
+                  break;
+                case 4:
+                  { const double * D = Sp[2];
+                    for (size_t i=0; i<length; i++) {
+                        Ap[i] += B[i] + scalar * C[i] + D[i];
+                    } }
+                  break;
+                case 5:
+                  { const double * D = Sp[2]; const double * E = Sp[3];
+                    for (size_t i=0; i<length; i++) {
+                        Ap[i] += B[i] + scalar * C[i] + D[i] + scalar * E[i];
+                    } }
+                  break;
+                case 6:
+                  { const double * D = Sp[2]; const double * E = Sp[3]; const double * F = Sp[4];
+                    for (size_t i=0; i<length; i++) {
+                        Ap[i] += B[i] + scalar * C[i] + D[i] + scalar * E[i] + F[i];
+                    } }
+                  break;
+                case 7:
+                  { const double * D = Sp[2]; const double * E = Sp[3]; const double * F = Sp[4]; const double * G = Sp[5];
+                    for (size_t i=0; i<length; i++) {
+                        Ap[i] += B[i] + scalar * C[i] + D[i] + scalar * E[i] + F[i] + scalar * G[i];
+                    } }
+                  break;
+                case 8:
+                  { const double * D = Sp[2]; const double * E = Sp[3]; const double * F = Sp[4]; const double * G = Sp[5]; const double * H = Sp[6];
+                    for (size_t i=0; i<length; i++) {
+                        Ap[i] += B[i] + scalar * C[i] + D[i] + scalar * E[i] + F[i] + scalar * G[i] + H[i];
+                    } }
+                  break;
+              }
+            }
+            break;
+        }
+      }
+
+      double dt(0);
+      if (sample && iter>0) {
+        dt = prk::wtime()-it0;
+        res.iteration(dt);
+        tstats.record(dt);
+      }
+      if (iter>0 && adapt.done(iter, iterations, dt)) {
+        iterations = iter;
+        break;
       }
     }
-    nstream_time = prk::wtime() - nstream_time;
-  }
+    const double dt = prk::wtime() - t;
+    perf.stop();
+    return dt;
+  };
 
   //////////////////////////////////////////////////////////////////////
   /// Analyze and output results
   //////////////////////////////////////////////////////////////////////
 
-  double ar(0);
-  double br(2);
-  double cr(2);
-  for (auto i=0; i<=iterations; i++) {
-      ar += br + scalar * cr;
-  }
+  auto validate = [&](double nstream_time, const char * label) {
+    const double ar = prk::nstream::checksum(pat, iterations, length, scalar);
 
-  ar *= length;
+    double asum(0);
+    if (pat.k == prk::nstream::kind::dot) {
+        asum = dotresult;
+    } else {
+        for (size_t i=0; i<length; i++) {
+            asum += std::fabs(Ap[i]);
+        }
+    }
 
-  double asum(0);
-  for (size_t i=0; i<length; i++) {
-      asum += std::fabs(A[i]);
+    double epsilon=1.e-8;
+    if (std::fabs(ar-asum)/ar > epsilon) {
+        std::cout << "Failed Validation on output array\n"
+                  << "       Expected checksum: " << ar << "\n"
+                  << "       Observed checksum: " << asum << std::endl;
+        std::cout << "ERROR: solution did not validate" << std::endl;
+        return false;
+    } else {
+        double avgtime = nstream_time/iterations;
+        double nbytes = prk::nstream::bytes_per_iteration(pat, length);
+        double nflops = (pat.k==prk::nstream::kind::copy)  ? 0.0 :
+                        (pat.k==prk::nstream::kind::scale) ? 1.0*length :
+                        2.0*(pat.sources()-1)*length;
+        if (offset_sweeping) {
+          std::cout << std::setw(8)  << point
+                    << std::setw(14) << length
+                    << std::setw(16) << 1.e-6*nbytes/avgtime
+                    << std::setw(16) << avgtime << std::endl;
+        } else if (sweeping) {
+          std::cout << std::setw(8)  << (cache_sweeping ? cache_points[point].first : "-")
+                    << std::setw(12) << pat.streams*length*sizeof(double)/1024
+                    << std::setw(14) << length
+                    << std::setw(16) << 1.e-6*nbytes/avgtime
+                    << std::setw(16) << avgtime << std::endl;
+        } else {
+          std::cout << "Solution validates" << std::endl;
+          std::cout << label << "Rate (MB/s): " << 1.e-6*nbytes/avgtime
+                    << " Avg time (s): " << avgtime << std::endl;
+        }
+        perf.report(nstream_time, nflops*iterations, nbytes*iterations);
+        res.set(label[0]=='N' ? "nt_rate_mbs" : "rate_mbs", 1.e-6*nbytes/avgtime);
+        res.set(label[0]=='N' ? "nt_avgtime" : "avgtime", avgtime);
+        base.check(label[0]=='N' ? "nt_rate_mbs" : "rate_mbs", 1.e-6*nbytes/avgtime);
+        return true;
+    }
+  };
+
+  if (run_classic) {
+    const double t = nstream(false);
+    if (!validate(t, (run_nt ? "Classic " : ""))) return 1;
+  }
+  if (run_nt) {
+    // restart from a clean A so the checksum formula still holds
+    for (size_t i=0; i<length; i++) Ap[i] = 0.0;
+    const double t = nstream(true);
+    if (!validate(t, (run_classic ? "NT " : ""))) return 1;
   }
 
-  double epsilon=1.e-8;
-  if (std::fabs(ar-asum)/asum > epsilon) {
-      std::cout << "Failed Validation on output array\n"
-                << "       Expected checksum: " << ar << "\n"
-                << "       Observed checksum: " << asum << std::endl;
-      std::cout << "ERROR: solution did not validate" << std::endl;
-      return 1;
-  } else {
-      std::cout << "Solution validates" << std::endl;
-      double avgtime = nstream_time/iterations;
-      double nbytes = 4.0 * length * sizeof(double);
-      std::cout << "Rate (MB/s): " << 1.e-6*nbytes/avgtime
-                << " Avg time (s): " << avgtime << std::endl;
+  adapt.report();
+  tstats.report();
+  res.emit();
+
   }
 
+  if (sweeping) std::cout << "Solution validates" << std::endl;
+
   return 0;
 }
 
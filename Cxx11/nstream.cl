@@ -17,3 +17,40 @@ __kernel void nstream64(const int length, const double scalar, __global double *
         A[i] += B[i] + scalar * C[i];
     }
 }
+
+/* checksum of |A| reduced on the device; one partial sum per work-group
+   comes back to the host instead of the whole vector */
+
+__kernel void checksum32(const int length, __global const float * A, __local float * scratch, __global float * partial)
+{
+    const int lid = get_local_id(0);
+
+    float sum = 0.0f;
+    for (int i = get_global_id(0); i < length; i += get_global_size(0)) {
+        sum += fabs(A[i]);
+    }
+    scratch[lid] = sum;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for (int s = get_local_size(0)/2; s > 0; s >>= 1) {
+        if (lid < s) scratch[lid] += scratch[lid+s];
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    if (lid == 0) partial[get_group_id(0)] = scratch[0];
+}
+
+__kernel void checksum64(const int length, __global const double * A, __local double * scratch, __global double * partial)
+{
+    const int lid = get_local_id(0);
+
+    double sum = 0.0;
+    for (int i = get_global_id(0); i < length; i += get_global_size(0)) {
+        sum += fabs(A[i]);
+    }
+    scratch[lid] = sum;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for (int s = get_local_size(0)/2; s > 0; s >>= 1) {
+        if (lid < s) scratch[lid] += scratch[lid+s];
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    if (lid == 0) partial[get_group_id(0)] = scratch[0];
+}
@@ -0,0 +1,296 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    Pipeline
+///
+/// PURPOSE: This program tests the efficiency with which point-to-point
+///          synchronization can be carried out. It does so by executing
+///          a pipelined algorithm on an m*n grid. The first array dimension
+///          is distributed among the threads (stripwise decomposition).
+///
+/// USAGE:   The program takes as input the
+///          dimensions of the grid, and the number of iterations on the grid
+///
+///                <progname> <iterations> <m> <n> [<mc> <nc> <executor>]
+///
+///          Each grid block is a C++20 coroutine, created suspended and
+///          resumed once its left and top dependencies have completed.
+///          The executor is SERIAL (every coroutine resumes on the main
+///          thread, measuring pure scheduling cost) or POOL (coroutines
+///          resume on prk::thread_pool workers).
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// HISTORY: - Written by Rob Van der Wijngaart, February 2009.
+///            C99-ification by Jeff Hammond, February 2016.
+///            C++11-ification by Jeff Hammond, May 2017.
+///            Coroutine implementation after the TBB Flow Graph version.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+#include "p2p-kernel.h"
+
+#include <coroutine>
+#include <deque>
+
+// each block is one coroutine; the frame self-destructs on completion,
+// so a handle must not be resumed twice
+struct block_task {
+    struct promise_type {
+        block_task get_return_object() {
+            return {std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never  final_suspend()   noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+    std::coroutine_handle<promise_type> handle;
+};
+
+// tracks, for one sweep of the grid, how many of each block's dependencies
+// are still outstanding, and resumes blocks on the chosen executor as they
+// become ready
+struct wavefront {
+
+    int mb, nb;
+    std::vector<std::atomic<int>> deps;
+    std::vector<std::coroutine_handle<>> handles;
+    std::atomic<int> remaining;
+    prk::thread_pool * pool;                   // nullptr selects the serial executor
+    std::deque<std::coroutine_handle<>> ready; // serial executor run queue
+    std::mutex mutex;
+    std::condition_variable all_done;
+
+    wavefront(int mb_, int nb_, prk::thread_pool * pool_)
+        : mb(mb_), nb(nb_), deps(mb_*nb_), handles(mb_*nb_),
+          remaining(mb_*nb_), pool(pool_)
+    {
+        for (int i=0; i<mb; i++) {
+          for (int j=0; j<nb; j++) {
+            deps[i*nb+j].store( (i>0) + (j>0) );
+          }
+        }
+    }
+
+    void enqueue(std::coroutine_handle<> h) {
+        if (pool) {
+            pool->submit([h] { h.resume(); });
+        } else {
+            ready.push_back(h);
+        }
+    }
+
+    void complete(int i, int j) {
+        if (j+1 < nb && deps[i*nb+(j+1)].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            enqueue(handles[i*nb+(j+1)]);
+        }
+        if (i+1 < mb && deps[(i+1)*nb+j].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            enqueue(handles[(i+1)*nb+j]);
+        }
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1 && pool) {
+            std::lock_guard<std::mutex> lock(mutex);
+            all_done.notify_one();
+        }
+    }
+
+    void run(void) {
+        if (pool) {
+            std::unique_lock<std::mutex> lock(mutex);
+            all_done.wait(lock, [this] { return remaining.load() == 0; });
+        } else {
+            while (!ready.empty()) {
+                auto h = ready.front();
+                ready.pop_front();
+                h.resume();
+            }
+        }
+    }
+};
+
+static block_task block(wavefront & wf, int i, int j,
+                        int m, int n, int mc, int nc, double * grid)
+{
+    sweep_tile((i*mc)+1, std::min(m,(i*mc)+mc+1),
+               (j*nc)+1, std::min(n,(j*nc)+nc+1), n, grid);
+    wf.complete(i, j);
+    co_return;
+}
+
+int main(int argc, char* argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++20/Coroutines pipeline execution on 2D grid" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Process and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations;
+  int m, n;
+  int mc, nc;
+  bool use_pool;
+  try {
+      if (argc < 4){
+        throw " <# iterations> <first array dimension> <second array dimension> [<first chunk dimension> <second chunk dimension> <SERIAL/POOL executor>]";
+      }
+
+      // number of times to run the pipeline algorithm
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      // grid dimensions
+      m = std::atoi(argv[2]);
+      n = std::atoi(argv[3]);
+      if (m < 1 || n < 1) {
+        throw "ERROR: grid dimensions must be positive";
+      } else if ( static_cast<size_t>(m)*static_cast<size_t>(n) > INT_MAX) {
+        throw "ERROR: grid dimension too large - overflow risk";
+      }
+
+      // grid chunk dimensions
+      mc = (argc > 4) ? std::atoi(argv[4]) : m;
+      nc = (argc > 5) ? std::atoi(argv[5]) : n;
+      if (mc < 1 || mc > m || nc < 1 || nc > n) {
+        std::cout << "WARNING: grid chunk dimensions invalid: " << mc <<  nc << " (ignoring)" << std::endl;
+        mc = m;
+        nc = n;
+      }
+
+      use_pool = false;
+      if (argc > 6) {
+          auto executor = std::string(argv[6]);
+          if (executor == "POOL") {
+              use_pool = true;
+          } else if (executor != "SERIAL") {
+              throw "ERROR: executor must be SERIAL or POOL";
+          }
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  int num_threads = 1;
+  if (use_pool) {
+      num_threads = std::max(1, (int)std::thread::hardware_concurrency());
+      const char* envvar = std::getenv("PRK_NUM_THREADS");
+      if (envvar!=NULL) num_threads = std::max(1, std::atoi(envvar));
+  }
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Grid sizes           = " << m << ", " << n << std::endl;
+  std::cout << "Grid chunk sizes     = " << mc << ", " << nc << std::endl;
+  std::cout << "Executor             = " << (use_pool ? "pool" : "serial") << std::endl;
+  if (use_pool) {
+  std::cout << "Number of threads    = " << num_threads << std::endl;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  int num_blocks_m = (m / mc);
+  if (m%mc != 0) num_blocks_m++;
+  int num_blocks_n = (n / nc);
+  if (n%nc != 0) num_blocks_n++;
+
+  auto pipeline_time = 0.0; // silence compiler warning
+
+  double * grid = new double[m*n];
+
+  for (int i=0; i<m; i++) {
+    for (int j=0; j<n; j++) {
+      grid[i*n+j] = 0.0;
+    }
+  }
+  for (int j=0; j<n; j++) {
+    grid[0*n+j] = static_cast<double>(j);
+  }
+  for (int i=0; i<m; i++) {
+    grid[i*n+0] = static_cast<double>(i);
+  }
+
+  std::unique_ptr<prk::thread_pool> pool;
+  if (use_pool) pool = std::make_unique<prk::thread_pool>(num_threads);
+
+  for (int iter = 0; iter<=iterations; iter++) {
+
+    if (iter==1) pipeline_time = prk::wtime();
+
+    // one suspended coroutine per block; the wavefront resumes each one
+    // when its left and top dependencies have completed
+    wavefront wf(num_blocks_m, num_blocks_n, pool.get());
+    for (int i=0; i<num_blocks_m; i++) {
+      for (int j=0; j<num_blocks_n; j++) {
+        wf.handles[i*num_blocks_n+j] = block(wf, i, j, m, n, mc, nc, grid).handle;
+      }
+    }
+    wf.enqueue(wf.handles[0]);
+    wf.run();
+
+    grid[0*n+0] = -grid[(m-1)*n+(n-1)];
+  }
+  pipeline_time = prk::wtime() - pipeline_time;
+
+  //////////////////////////////////////////////////////////////////////
+  // Analyze and output results.
+  //////////////////////////////////////////////////////////////////////
+
+  const double epsilon = 1.e-8;
+  auto corner_val = ((iterations+1.)*(n+m-2.));
+  if ( (std::fabs(grid[(m-1)*n+(n-1)] - corner_val)/corner_val) > epsilon) {
+    std::cout << "ERROR: checksum " << grid[(m-1)*n+(n-1)]
+              << " does not match verification value " << corner_val << std::endl;
+    return 1;
+  }
+
+  delete[] grid;
+
+#ifdef VERBOSE
+  std::cout << "Solution validates; verification value = " << corner_val << std::endl;
+#else
+  std::cout << "Solution validates" << std::endl;
+#endif
+  auto avgtime = pipeline_time/iterations;
+  std::cout << "Rate (MFlops/s): "
+            << 2.0e-6 * ( (m-1.)*(n-1.) )/avgtime
+            << " Avg time (s): " << avgtime << std::endl;
+
+  return 0;
+}
@@ -147,8 +147,9 @@ int main(int argc, char* argv[])
     }
     OMP_BARRIER
 
-    int const ib = prk::divceil(m,mc);
-    int const jb = prk::divceil(n,nc);
+    p2p_blocks const blk(m, n, mc, nc);
+    int const ib = blk.ib;
+    int const jb = blk.jb;
 
     for (int iter = 0; iter<=iterations; iter++) {
 
@@ -172,7 +173,7 @@ int main(int argc, char* argv[])
         for (int i=0; i<ib; i++) {
           for (int j=0; j<jb; j++) {
             OMP_ORDERED( depend(sink: i-1,j) depend(sink: i,j-1) )
-            sweep_tile(i*mc+1, std::min(m,(i+1)*mc+1), j*nc+1, std::min(n,(j+1)*nc+1), n, grid);
+            blk.sweep(i, j, grid);
             OMP_ORDERED( depend (source) )
           }
         }
@@ -41,7 +41,14 @@
 /// USAGE:   The program takes as input the
 ///          dimensions of the grid, and the number of iterations on the grid
 ///
-///                <progname> <iterations> <n>
+///                <progname> <iterations> <n> [<hyperplanes per launch>]
+///
+///          The default launches one kernel per hyperplane.  A batch
+///          value h > 1 groups h consecutive hyperplanes into a single
+///          launch, ordered inside the kernel by work-group barriers, to
+///          amortize launch overhead on the small early/late hyperplanes.
+///          "sweep" runs the whole pipeline for a range of batch sizes
+///          and reports the rate for each.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
@@ -64,74 +71,20 @@
 #include "prk_util.h"
 #include "p2p-kernel.h"
 
-int main(int argc, char* argv[])
-{
-  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
-  std::cout << "C++11/SYCL HYPERPLANE pipeline execution on 2D grid" << std::endl;
-
-  //////////////////////////////////////////////////////////////////////
-  // Process and test input parameters
-  //////////////////////////////////////////////////////////////////////
-
-  int iterations;
-  int n;
-#if 0
-  int nc, nb;
-#endif
-  try {
-      if (argc < 3) {
-        throw " <# iterations> <array dimension> [<chunk dimension>]";
-      }
-
-      // number of times to run the pipeline algorithm
-      iterations  = std::atoi(argv[1]);
-      if (iterations < 1) {
-        throw "ERROR: iterations must be >= 1";
-      }
-
-      // grid dimensions
-      n = std::atoi(argv[2]);
-      if (n < 1) {
-        throw "ERROR: grid dimensions must be positive";
-      } else if ( static_cast<size_t>(n)*static_cast<size_t>(n) > static_cast<size_t>(INT_MAX)) {
-        throw "ERROR: grid dimension too large - overflow risk";
-      }
-
-#if 0
-      // grid chunk dimensions
-      nc = (argc > 3) ? std::atoi(argv[3]) : 1;
-      nc = std::max(1,nc);
-      nc = std::min(n,nc);
-
-      // number of grid blocks
-      nb = (n-1)/nc;
-      if ((n-1)%nc) nb++;
-#endif
-  }
-  catch (const char * e) {
-    std::cout << e << std::endl;
-    return 1;
-  }
-
-  std::cout << "Number of iterations = " << iterations << std::endl;
-  std::cout << "Grid sizes           = " << n << ", " << n << std::endl;
-#if 0
-  std::cout << "Grid chunk sizes     = " << nc << std::endl;
-#endif
-
-  //////////////////////////////////////////////////////////////////////
-  // Allocate space and perform the computation
-  //////////////////////////////////////////////////////////////////////
+// batched hyperplanes execute inside a single work-group, so that the
+// barrier between consecutive hyperplanes orders the whole batch
+const size_t batch_wg = 256;
 
+double run(cl::sycl::queue & q, int iterations, int n, int batch, std::vector<double> & h_grid)
+{
   auto pipeline_time = 0.0; // silence compiler warning
 
-  std::vector<double> h_grid(n*n,0.0);
+  std::fill(h_grid.begin(), h_grid.end(), 0.0);
   for (int j=0; j<n; j++) {
     h_grid[0*n+j] = static_cast<double>(j);
     h_grid[j*n+0] = static_cast<double>(j);
   }
 
-  cl::sycl::queue q;
   {
     cl::sycl::buffer<double> d_grid { h_grid.data(), h_grid.size() };
 
@@ -139,6 +92,37 @@ int main(int argc, char* argv[])
 
       if (iter==1) pipeline_time = prk::wtime();
 
+      if (batch > 1) {
+
+        for (int i=2; i<=2*n-2; i+=batch) {
+
+          const int last = std::min(i+batch-1, 2*n-2);
+
+          q.submit([&](cl::sycl::handler& h) {
+
+            auto grid = d_grid.get_access<cl::sycl::access::mode::read_write>(h);
+
+            h.parallel_for<class sweep_batch>(
+                cl::sycl::nd_range<1>{cl::sycl::range<1>{batch_wg}, cl::sycl::range<1>{batch_wg}},
+                [=] (cl::sycl::nd_item<1> it) {
+              for (int ii=i; ii<=last; ii++) {
+                const int begin = (2 > ii-n+2) ? 2 : ii-n+2;
+                const int end   = ((ii < n) ? ii : n)+1;
+                for (int j=begin+static_cast<int>(it.get_local_id(0)); j<end; j+=static_cast<int>(batch_wg)) {
+                  const int x = ii-j+1;
+                  const int y = j-1;
+                  grid[x*n+y] = grid[(x-1)*n+y] + grid[x*n+(y-1)] - grid[(x-1)*n+(y-1)];
+                }
+                // the next hyperplane depends on this one
+                it.barrier(cl::sycl::access::fence_space::global_space);
+              }
+            });
+          });
+          q.wait();
+        }
+
+      } else {
+
       for (int i=2; i<=2*n-2; i++) {
 
         cl::sycl::id<1> I{unsigned(i)};
@@ -168,6 +152,8 @@ int main(int argc, char* argv[])
         });
         q.wait();
       }
+
+      }
       q.submit([&](cl::sycl::handler& h) {
 
         auto grid = d_grid.get_access<cl::sycl::access::mode::read_write>(h);
@@ -182,35 +168,112 @@ int main(int argc, char* argv[])
     pipeline_time = prk::wtime() - pipeline_time;
   }
 
-#if 0
-  for (int i=0; i<n; ++i) {
-      for (int j=0; j<n; ++j) {
-          std::cout << i << "," << j << "=" << h_grid[i*n+j] << "\n";
-      }
-  }
-#endif
+  return pipeline_time;
+}
+
+int main(int argc, char* argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11/SYCL HYPERPLANE pipeline execution on 2D grid" << std::endl;
 
   //////////////////////////////////////////////////////////////////////
-  // Analyze and output results.
+  // Process and test input parameters
   //////////////////////////////////////////////////////////////////////
 
-  const double epsilon = 1.e-8;
-  auto corner_val = ((iterations+1.)*(2.*n-2.));
-  if ( (std::fabs(h_grid[(n-1)*n+(n-1)] - corner_val)/corner_val) > epsilon) {
-    std::cout << "ERROR: checksum " << h_grid[(n-1)*n+(n-1)]
-              << " does not match verification value " << corner_val << std::endl;
+  int iterations;
+  int n;
+  std::vector<int> batches;
+  try {
+      if (argc < 3) {
+        throw " <# iterations> <array dimension> [<chunk dimension>]";
+      }
+
+      // number of times to run the pipeline algorithm
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      // grid dimensions
+      n = std::atoi(argv[2]);
+      if (n < 1) {
+        throw "ERROR: grid dimensions must be positive";
+      } else if ( static_cast<size_t>(n)*static_cast<size_t>(n) > static_cast<size_t>(INT_MAX)) {
+        throw "ERROR: grid dimension too large - overflow risk";
+      }
+
+      // hyperplanes per kernel launch
+      if (argc > 3) {
+          if (std::string(argv[3]) == "sweep") {
+              for (int b=1; b<=64; b*=2) batches.push_back(b);
+          } else {
+              int b = std::atoi(argv[3]);
+              b = std::max(1,b);
+              b = std::min(2*n-3,b);
+              batches.push_back(b);
+          }
+      } else {
+          batches.push_back(1);
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
     return 1;
   }
 
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Grid sizes           = " << n << ", " << n << std::endl;
+  if (batches.size() > 1) {
+    std::cout << "Hyperplane batching  = sweep" << std::endl;
+  } else if (batches[0] > 1) {
+    std::cout << "Hyperplanes / launch = " << batches[0] << std::endl;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  std::vector<double> h_grid(n*n,0.0);
+
+  cl::sycl::queue q;
+
+  for (auto batch : batches) {
+
+    auto pipeline_time = run(q, iterations, n, batch, h_grid);
+
+#if 0
+    for (int i=0; i<n; ++i) {
+        for (int j=0; j<n; ++j) {
+            std::cout << i << "," << j << "=" << h_grid[i*n+j] << "\n";
+        }
+    }
+#endif
+
+    ////////////////////////////////////////////////////////////////////
+    // Analyze and output results.
+    ////////////////////////////////////////////////////////////////////
+
+    const double epsilon = 1.e-8;
+    auto corner_val = ((iterations+1.)*(2.*n-2.));
+    if ( (std::fabs(h_grid[(n-1)*n+(n-1)] - corner_val)/corner_val) > epsilon) {
+      std::cout << "ERROR: checksum " << h_grid[(n-1)*n+(n-1)]
+                << " does not match verification value " << corner_val << std::endl;
+      return 1;
+    }
+
+    if (batches.size() > 1) {
+      std::cout << "Hyperplanes / launch = " << batch << std::endl;
+    }
 #ifdef VERBOSE
-  std::cout << "Solution validates; verification value = " << corner_val << std::endl;
+    std::cout << "Solution validates; verification value = " << corner_val << std::endl;
 #else
-  std::cout << "Solution validates" << std::endl;
+    std::cout << "Solution validates" << std::endl;
 #endif
-  auto avgtime = pipeline_time/iterations;
-  std::cout << "Rate (MFlops/s): "
-            << 2.0e-6 * ( (n-1.)*(n-1.) )/avgtime
-            << " Avg time (s): " << avgtime << std::endl;
+    auto avgtime = pipeline_time/iterations;
+    std::cout << "Rate (MFlops/s): "
+              << 2.0e-6 * ( (n-1.)*(n-1.) )/avgtime
+              << " Avg time (s): " << avgtime << std::endl;
+  }
 
   return 0;
 }
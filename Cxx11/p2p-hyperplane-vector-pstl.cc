@@ -111,9 +111,15 @@ int main(int argc, char* argv[])
     return 1;
   }
 
+  // the hyperplanes are short and synchronization-heavy, so the kernel
+  // default stays at par rather than par_unseq
+  const auto policy = prk::PSTL::get_policy(prk::PSTL::policy::par);
+
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Grid sizes           = " << n << ", " << n << std::endl;
   std::cout << "Grid chunk sizes     = " << nc << std::endl;
+  std::cout << "Execution policy     = " << prk::PSTL::policy_name(policy) << std::endl;
+  std::cout << "PSTL backend         = " << prk::PSTL::backend() << std::endl;
 
   //////////////////////////////////////////////////////////////////////
   // Allocate space and perform the computation
@@ -138,14 +144,7 @@ int main(int argc, char* argv[])
         const auto begin = std::max(2,i-n+2);
         const auto end   = std::min(i,n)+1;
         auto range = prk::range(begin,end);
-#if defined(USE_PSTL) && defined(USE_INTEL_PSTL)
-        std::for_each( exec::par, std::begin(range), std::end(range), [&] (auto j) {
-#elif defined(USE_PSTL) && defined(__GNUC__) && defined(__GNUC_MINOR__) \
-                        && ( (__GNUC__ == 8) || (__GNUC__ == 7) && (__GNUC_MINOR__ >= 2) )
-        __gnu_parallel::for_each( std::begin(range), std::end(range), [&] (auto j) {
-#else
-        std::for_each( std::begin(range), std::end(range), [&] (auto j) {
-#endif
+        prk::PSTL::for_each( policy, std::begin(range), std::end(range), [&] (auto j) {
           const auto x = i-j+1;
           const auto y = j-1;
           grid[x*n+y] = grid[(x-1)*n+y] + grid[x*n+(y-1)] - grid[(x-1)*n+(y-1)];
@@ -156,14 +155,7 @@ int main(int argc, char* argv[])
         const auto begin = std::max(2,i-(nb+1)+2);
         const auto end   = std::min(i,nb+1)+1;
         auto range = prk::range(begin,end);
-#if defined(USE_PSTL) && ( defined(USE_INTEL_PSTL) || ( defined(__GNUC__) && (__GNUC__ >= 9) ) )
-        std::for_each( exec::par, std::begin(range), std::end(range), [&] (auto j) {
-#elif defined(USE_PSTL) && defined(__GNUC__) && defined(__GNUC_MINOR__) \
-                        && ( (__GNUC__ == 8) || (__GNUC__ == 7) && (__GNUC_MINOR__ >= 2) )
-        __gnu_parallel::for_each( std::begin(range), std::end(range), [&] (auto j) {
-#else
-        std::for_each( std::begin(range), std::end(range), [&] (auto j) {
-#endif
+        prk::PSTL::for_each( policy, std::begin(range), std::end(range), [&] (auto j) {
           const int ib = nc*(i-j)+1;
           const int jb = nc*(j-2)+1;
           sweep_tile(ib, std::min(n,ib+nc), jb, std::min(n,jb+nc), n, grid);
@@ -67,7 +67,7 @@ void run(cl::Context context, int iterations, int n)
 {
   auto precision = (sizeof(T)==8) ? 64 : 32;
 
-  cl::Program program(context, prk::opencl::loadProgram("p2p.cl"), true);
+  cl::Program program = prk::opencl::buildProgram(context, prk::opencl::loadProgram("p2p.cl"));
 
   auto function = (precision==64) ? "p2p64" : "p2p32";
 
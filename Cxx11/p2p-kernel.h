@@ -89,3 +89,29 @@ inline void sweep_tile(int startm, int endm,
 }
 
 #endif
+
+// Uniform block decomposition of the grid interior (1..m-1) x (1..n-1)
+// shared by the blocked variants (OpenMP tasks, OpenMP doacross, TBB flow
+// graph), so granularity experiments compare scheduling runtimes at
+// identical block shapes.  Dependences are tracked at block granularity:
+// block (i,j) depends on blocks (i-1,j) and (i,j-1).
+struct p2p_blocks
+{
+  int m, n;    // grid dimensions
+  int mc, nc;  // block dimensions
+  int ib, jb;  // number of blocks in each direction
+
+  p2p_blocks(int m, int n, int mc, int nc)
+    : m(m), n(n), mc(mc), nc(nc),
+      ib(prk::divceil(m-1,mc)), jb(prk::divceil(n-1,nc)) {}
+
+  int ilo(int bi) const { return bi*mc+1; }
+  int ihi(int bi) const { return std::min(m, ilo(bi)+mc); }
+  int jlo(int bj) const { return bj*nc+1; }
+  int jhi(int bj) const { return std::min(n, jlo(bj)+nc); }
+
+  template <typename G>
+  void sweep(int bi, int bj, G & grid) const {
+    sweep_tile(ilo(bi), ihi(bi), jlo(bj), jhi(bj), n, grid);
+  }
+};
@@ -0,0 +1,255 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    Pipeline
+///
+/// PURPOSE: This program tests the efficiency with which point-to-point
+///          synchronization can be carried out. It does so by executing
+///          a pipelined algorithm on an m*n grid. The second array
+///          dimension is distributed among the threads (stripwise
+///          decomposition), as in the MPI1 version of this kernel: each
+///          thread computes its segment of every grid line and hands the
+///          line off to its right neighbor through a per-thread atomic
+///          ticket counter, using acquire/release ordering only - no
+///          locks, no tasking runtime.  The waiting policy is selectable
+///          (spin or yield), so the same binary measures same-core,
+///          cross-core and cross-socket handoff latency depending on
+///          where the threads land.
+///
+/// USAGE:   The program takes as input the
+///          dimensions of the grid, and the number of iterations on the grid
+///
+///                <progname> <iterations> <m> <n> [spin|yield]
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// FUNCTIONS CALLED:
+///
+///          Other than standard C functions, the following
+///          functions are used in this program:
+///
+///          wtime()
+///
+/// HISTORY: - Written by Rob Van der Wijngaart, February 2009.
+///            C99-ification by Jeff Hammond, February 2016.
+///            C++11-ification by Jeff Hammond, May 2017.
+///            Threaded line-handoff variant added, August 2026.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+
+#include <atomic>
+#include <thread>
+
+namespace {
+
+  static inline void cpu_pause(void)
+  {
+#if defined(__SSE2__)
+      _mm_pause();
+#endif
+  }
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11 threaded line-handoff pipeline execution on 2D grid" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Process and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations;
+  int m, n;
+  bool spin = true;
+  try {
+      if (argc < 4){
+        throw " <# iterations> <first array dimension> <second array dimension> [spin|yield]";
+      }
+
+      // number of times to run the pipeline algorithm
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      // grid dimensions
+      m = std::atoi(argv[2]);
+      n = std::atoi(argv[3]);
+      if (m < 2 || n < 2) {
+        throw "ERROR: grid dimensions must be at least 2";
+      } else if ( static_cast<size_t>(m)*static_cast<size_t>(n) > INT_MAX) {
+        throw "ERROR: grid dimension too large - overflow risk";
+      }
+
+      if (argc > 4) {
+        const std::string policy(argv[4]);
+        if (policy == "yield") {
+          spin = false;
+        } else if (policy != "spin") {
+          throw "ERROR: waiting policy must be spin or yield";
+        }
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  int num_threads = std::thread::hardware_concurrency();
+  {
+    const char * temp = std::getenv("PRK_NUM_THREADS");
+    if (temp!=nullptr) num_threads = std::atoi(temp);
+    if (num_threads < 1) num_threads = 1;
+    // no thread can own an empty column strip
+    if (num_threads > n-1) num_threads = n-1;
+  }
+
+  std::cout << "Number of threads    = " << num_threads << std::endl;
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Grid sizes           = " << m << ", " << n << std::endl;
+  std::cout << "Waiting policy       = " << (spin ? "spin" : "yield") << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  auto pipeline_time = 0.0; // silence compiler warning
+
+  double * RESTRICT grid = new double[m*n];
+
+  for (int i=0; i<m; i++) {
+    for (int j=0; j<n; j++) {
+      grid[i*n+j] = 0.0;
+    }
+  }
+  for (int j=0; j<n; j++) {
+    grid[0*n+j] = static_cast<double>(j);
+  }
+  for (int i=0; i<m; i++) {
+    grid[i*n+0] = static_cast<double>(i);
+  }
+
+  // Each thread advertises the sequence number of the last line it has
+  // completed; lines are numbered contiguously across iterations, so the
+  // counters are monotone and never need resetting.  The consumer waits
+  // with an acquire load, the producer publishes with a release store -
+  // the grid elements themselves carry no synchronization.
+  const long lines = m-1;
+  std::vector<std::atomic<long>> progress(num_threads);
+  for (auto & p : progress) p.store(0, std::memory_order_relaxed);
+  // counts iterations whose corner update has been published
+  std::atomic<long> corner_ready(0);
+
+  auto wait_for = [spin](std::atomic<long> & ticket, long target) {
+      while (ticket.load(std::memory_order_acquire) < target) {
+          if (spin) cpu_pause();
+          else      std::this_thread::yield();
+      }
+  };
+
+  auto worker = [&](int me) {
+      // balanced contiguous split of columns 1..n-1, as in MPI1/Synch_p2p
+      const int width  = (n-1)/num_threads + ((n-1)%num_threads > me ? 1 : 0);
+      const int jstart = 1 + me*((n-1)/num_threads) + std::min(me, (int)((n-1)%num_threads));
+      const int jend   = jstart + width;
+
+      for (int iter = 0; iter<=iterations; iter++) {
+
+        // the corner value written at the end of the previous iteration
+        // feeds the first line of this one
+        if (me==0 && iter>0) wait_for(corner_ready, iter);
+
+        if (me==0 && iter==1) pipeline_time = prk::wtime();
+
+        for (int i=1; i<m; i++) {
+          const long seq = (long)iter*lines + i;
+          // wait for the left neighbor to hand off this line
+          if (me > 0) wait_for(progress[me-1], seq);
+          // back-pressure: do not overwrite the boundary column before the
+          // right neighbor has consumed it, one full sweep behind
+          if (me < num_threads-1) wait_for(progress[me+1], seq-lines);
+          for (int j=jstart; j<jend; j++) {
+            grid[i*n+j] = grid[(i-1)*n+j] + grid[i*n+(j-1)] - grid[(i-1)*n+(j-1)];
+          }
+          progress[me].store(seq, std::memory_order_release);
+        }
+
+        // copy top right corner value to bottom left corner to create dependency
+        if (me == num_threads-1) {
+          grid[0*n+0] = -grid[(m-1)*n+(n-1)];
+          corner_ready.store(iter+1, std::memory_order_release);
+        }
+      }
+  };
+
+  {
+    std::vector<std::thread> pool;
+    for (int t=1; t<num_threads; t++) {
+      pool.emplace_back(worker, t);
+    }
+    worker(0);
+    // the final corner update marks the end of the last iteration
+    wait_for(corner_ready, iterations+1);
+    pipeline_time = prk::wtime() - pipeline_time;
+    for (auto & t : pool) t.join();
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // Analyze and output results.
+  //////////////////////////////////////////////////////////////////////
+
+  const double epsilon = 1.e-8;
+  auto corner_val = ((iterations+1.)*(n+m-2.));
+  if ( (std::fabs(grid[(m-1)*n+(n-1)] - corner_val)/corner_val) > epsilon) {
+    std::cout << "ERROR: checksum " << grid[(m-1)*n+(n-1)]
+              << " does not match verification value " << corner_val << std::endl;
+    return 1;
+  }
+
+#ifdef VERBOSE
+  std::cout << "Solution validates; verification value = " << corner_val << std::endl;
+#else
+  std::cout << "Solution validates" << std::endl;
+#endif
+  auto avgtime = pipeline_time/iterations;
+  std::cout << "Rate (MFlops/s): "
+            << 2.0e-6 * ( (m-1.)*(n-1.) )/avgtime
+            << " Avg time (s): " << avgtime << std::endl;
+
+  return 0;
+}
@@ -42,6 +42,15 @@
 ///          dimensions of the grid, and the number of iterations on the grid
 ///
 ///                <progname> <iterations> <m> <n>
+///                           [<first chunk dimension> <second chunk dimension>
+///                            <policy>]
+///
+///          The policy selects one of the compiled-in RAJA execution
+///          policies for the antidiagonal sweeps (seq, simd, omp,
+///          omp_static, omp_dynamic); "all" sweeps the whole matrix and
+///          reports each, so a RAJA or compiler upgrade shows immediately
+///          which policy regressed. The default reproduces the historical
+///          thread_exec choice.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
@@ -62,59 +71,12 @@
 #include "prk_util.h"
 #include "prk_raja.h"
 
-int main(int argc, char* argv[])
+// identical logic for every execution policy, so that any rate difference
+// between the instantiations is attributable to the policy alone
+template <typename exec_policy>
+int run(int iterations, int m, int n, const char * policy_name)
 {
-  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
-  std::cout << "C++11/RAJA pipeline execution on 2D grid" << std::endl;
-
-  //////////////////////////////////////////////////////////////////////
-  // Process and test input parameters
-  //////////////////////////////////////////////////////////////////////
-
-  int iterations;
-  int m, n;
-  int mc, nc;
-  try {
-      if (argc < 4){
-        throw " <# iterations> <first array dimension> <second array dimension> [<first chunk dimension> <second chunk dimension>]";
-      }
-
-      // number of times to run the pipeline algorithm
-      iterations  = std::atoi(argv[1]);
-      if (iterations < 1) {
-        throw "ERROR: iterations must be >= 1";
-      }
-
-      // grid dimensions
-      m = std::atoi(argv[2]);
-      n = std::atoi(argv[3]);
-      if (m < 1 || n < 1) {
-        throw "ERROR: grid dimensions must be positive";
-      } else if ( static_cast<size_t>(m)*static_cast<size_t>(n) > INT_MAX) {
-        throw "ERROR: grid dimension too large - overflow risk";
-      }
-
-      // grid chunk dimensions
-      mc = (argc > 4) ? std::atoi(argv[4]) : m;
-      nc = (argc > 5) ? std::atoi(argv[5]) : n;
-      if (mc < 1 || mc > m || nc < 1 || nc > n) {
-        std::cout << "WARNING: grid chunk dimensions invalid: " << mc <<  nc << " (ignoring)" << std::endl;
-        mc = m;
-        nc = n;
-      }
-  }
-  catch (const char * e) {
-    std::cout << e << std::endl;
-    return 1;
-  }
-
-  std::cout << "Number of iterations = " << iterations << std::endl;
-  std::cout << "Grid sizes           = " << m << ", " << n << std::endl;
-  std::cout << "Grid chunk sizes     = " << mc << ", " << nc << std::endl;
-
-  //////////////////////////////////////////////////////////////////////
-  // Allocate space and perform the computation
-  //////////////////////////////////////////////////////////////////////
+  std::cout << "RAJA execution policy = " << policy_name << std::endl;
 
   auto pipeline_time = 0.0; // silence compiler warning
 
@@ -123,8 +85,7 @@ int main(int argc, char* argv[])
 
   {
     RAJA::RangeSegment range(0,m);
-    RAJA::forall<thread_exec>(range, [=](RAJA::Index_type i) {
-    //for (int i=0; i<m; i++) {
+    RAJA::forall<exec_policy>(range, [=](RAJA::Index_type i) {
       for (int j=0; j<n; j++) {
         grid(i,j) = 0.0;
       }
@@ -144,7 +105,7 @@ int main(int argc, char* argv[])
 
     for (int j=1; j<n; j++) {
       RAJA::RangeSegment range(1, j+1);
-      RAJA::forall<thread_exec>(range, [=](RAJA::Index_type i) {
+      RAJA::forall<exec_policy>(range, [=](RAJA::Index_type i) {
         auto x = i;
         auto y = j-i+1;
         grid(x,y) = grid(x-1,y) + grid(x,y-1) - grid(x-1,y-1);
@@ -152,7 +113,7 @@ int main(int argc, char* argv[])
     }
     for (int j=n-2; j>=1; j--) {
       RAJA::RangeSegment range(1, j+1);
-      RAJA::forall<thread_exec>(range, [=](RAJA::Index_type i) {
+      RAJA::forall<exec_policy>(range, [=](RAJA::Index_type i) {
         auto x = n+i-j-1;
         auto y = n-i;
         grid(x,y) = grid(x-1,y) + grid(x,y-1) - grid(x-1,y-1);
@@ -169,8 +130,13 @@ int main(int argc, char* argv[])
 
   const double epsilon = 1.e-8;
   auto corner_val = ((iterations+1.)*(n+m-2.));
-  if ( (std::fabs(grid(m-1,n-1) - corner_val)/corner_val) > epsilon) {
-    std::cout << "ERROR: checksum " << grid(m-1,n-1)
+  auto residuum = std::fabs(grid(m-1,n-1) - corner_val)/corner_val;
+  auto checksum = grid(m-1,n-1);
+
+  delete [] Amem;
+
+  if ( residuum > epsilon) {
+    std::cout << "ERROR: checksum " << checksum
               << " does not match verification value " << corner_val << std::endl;
     return 1;
   }
@@ -187,3 +153,102 @@ int main(int argc, char* argv[])
 
   return 0;
 }
+
+int main(int argc, char* argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11/RAJA pipeline execution on 2D grid" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Process and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations;
+  int m, n;
+  int mc, nc;
+  std::string policy("default");
+  try {
+      if (argc < 4){
+        throw " <# iterations> <first array dimension> <second array dimension> [<first chunk dimension> <second chunk dimension>]";
+      }
+
+      // number of times to run the pipeline algorithm
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      // grid dimensions
+      m = std::atoi(argv[2]);
+      n = std::atoi(argv[3]);
+      if (m < 1 || n < 1) {
+        throw "ERROR: grid dimensions must be positive";
+      } else if ( static_cast<size_t>(m)*static_cast<size_t>(n) > INT_MAX) {
+        throw "ERROR: grid dimension too large - overflow risk";
+      }
+
+      // grid chunk dimensions
+      mc = (argc > 4) ? std::atoi(argv[4]) : m;
+      nc = (argc > 5) ? std::atoi(argv[5]) : n;
+      if (mc < 1 || mc > m || nc < 1 || nc > n) {
+        std::cout << "WARNING: grid chunk dimensions invalid: " << mc <<  nc << " (ignoring)" << std::endl;
+        mc = m;
+        nc = n;
+      }
+
+      if (argc > 6) {
+        policy = std::string(argv[6]);
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Grid sizes           = " << m << ", " << n << std::endl;
+  std::cout << "Grid chunk sizes     = " << mc << ", " << nc << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  // the policy matrix is compiled in; "all" sweeps it so that a RAJA or
+  // compiler upgrade shows immediately which policy regressed
+  int status = 0;
+  bool known = false;
+  bool all = (policy == "all");
+  if (policy == "default") {
+    known = true;
+    status |= run<thread_exec>(iterations, m, n, "default");
+  }
+  if (all || policy == "seq") {
+    known = true;
+    status |= run<RAJA::seq_exec>(iterations, m, n, "seq");
+  }
+  if (all || policy == "simd") {
+    known = true;
+    status |= run<RAJA::simd_exec>(iterations, m, n, "simd");
+  }
+#if defined(RAJA_ENABLE_OPENMP)
+  if (all || policy == "omp") {
+    known = true;
+    status |= run<RAJA::omp_parallel_for_exec>(iterations, m, n, "omp");
+  }
+  if (all || policy == "omp_static") {
+    known = true;
+    status |= run<RAJA::omp_parallel_for_static_exec<32>>(iterations, m, n, "omp_static");
+  }
+  if (all || policy == "omp_dynamic") {
+    known = true;
+    status |= run<RAJA::omp_parallel_for_dynamic_exec<32>>(iterations, m, n, "omp_dynamic");
+  }
+#endif
+  if (!known) {
+    std::cout << "ERROR: unknown policy " << policy
+              << " (try seq, simd, omp, omp_static, omp_dynamic, or all)" << std::endl;
+    return 1;
+  }
+
+  return status;
+}
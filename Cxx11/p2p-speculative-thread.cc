@@ -0,0 +1,329 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    Pipeline
+///
+/// PURPOSE: This program tests the efficiency with which point-to-point
+///          synchronization can be carried out. It does so by executing
+///          a pipelined algorithm on an m*n grid. Unlike the other
+///          variants, this one does not respect the exact dependence:
+///          the column strips of the grid are computed concurrently,
+///          each strip reading a value-predicted copy of its left
+///          boundary column (linear extrapolation from the two previous
+///          sweeps) instead of waiting for its left neighbor. A
+///          sequential correction pass then compares every prediction
+///          against the freshly computed boundary and re-executes
+///          mis-speculated strips left to right. The recurrence reaches
+///          a steady state in which all interior values grow by the
+///          same constant per sweep, so predictions start failing and
+///          then become exact; the reported mis-speculation rate and
+///          the net speedup over an equally long exact sequential phase
+///          in the same run characterize when speculation pays for a
+///          given grid size and thread count.
+///
+/// USAGE:   The program takes as input the
+///          dimensions of the grid, and the number of iterations on the grid
+///
+///                <progname> <iterations> <m> <n>
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// FUNCTIONS CALLED:
+///
+///          Other than standard C functions, the following
+///          functions are used in this program:
+///
+///          wtime()
+///
+/// HISTORY: - Written by Rob Van der Wijngaart, February 2009.
+///            C99-ification by Jeff Hammond, February 2016.
+///            C++11-ification by Jeff Hammond, May 2017.
+///            Speculative strip variant added, September 2026.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+
+#include <atomic>
+#include <thread>
+
+namespace {
+
+  static inline void cpu_pause(void)
+  {
+#if defined(__SSE2__)
+      _mm_pause();
+#endif
+  }
+
+  // sense-reversing spin barrier; the sweeps are bulk-synchronous, so
+  // two of these per sweep are all the synchronization there is
+  class spin_barrier {
+      const int n_;
+      std::atomic<int>  arrived_;
+      std::atomic<long> phase_;
+    public:
+      spin_barrier(int n) : n_(n), arrived_(0), phase_(0) {}
+      void wait(void) {
+          const long p = phase_.load(std::memory_order_relaxed);
+          if (arrived_.fetch_add(1, std::memory_order_acq_rel) + 1 == n_) {
+              arrived_.store(0, std::memory_order_relaxed);
+              phase_.store(p+1, std::memory_order_release);
+          } else {
+              while (phase_.load(std::memory_order_acquire) == p) cpu_pause();
+          }
+      }
+  };
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11 speculative strip pipeline execution on 2D grid" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Process and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations;
+  int m, n;
+  try {
+      if (argc < 4){
+        throw " <# iterations> <first array dimension> <second array dimension>";
+      }
+
+      // number of times to run the pipeline algorithm
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      // grid dimensions
+      m = std::atoi(argv[2]);
+      n = std::atoi(argv[3]);
+      if (m < 2 || n < 2) {
+        throw "ERROR: grid dimensions must be at least 2";
+      } else if ( static_cast<size_t>(m)*static_cast<size_t>(n) > INT_MAX) {
+        throw "ERROR: grid dimension too large - overflow risk";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  int num_threads = std::thread::hardware_concurrency();
+  {
+    const char * temp = std::getenv("PRK_NUM_THREADS");
+    if (temp!=nullptr) num_threads = std::atoi(temp);
+    if (num_threads < 1) num_threads = 1;
+    // no thread can own an empty column strip
+    if (num_threads > n-1) num_threads = n-1;
+  }
+
+  std::cout << "Number of threads    = " << num_threads << std::endl;
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Grid sizes           = " << m << ", " << n << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  auto spec_time = 0.0; // silence compiler warning
+  auto seq_time  = 0.0;
+
+  double * RESTRICT grid = new double[m*n];
+
+  for (int i=0; i<m; i++) {
+    for (int j=0; j<n; j++) {
+      grid[i*n+j] = 0.0;
+    }
+  }
+  for (int j=0; j<n; j++) {
+    grid[0*n+j] = static_cast<double>(j);
+  }
+  for (int i=0; i<m; i++) {
+    grid[i*n+0] = static_cast<double>(i);
+  }
+
+  // strip boundaries: thread b owns columns jstart[b]..jstart[b+1]-1 and
+  // speculates on column jstart[b]-1, which belongs to its left neighbor
+  std::vector<int> jstart(num_threads+1);
+  for (int b=0; b<=num_threads; b++) {
+    jstart[b] = 1 + b*((n-1)/num_threads) + std::min(b, (n-1)%num_threads);
+  }
+
+  // per-boundary prediction state: the boundary column at the end of the
+  // previous sweep, and the prediction in use. All values are exactly
+  // representable integers, so prediction hits are detected with exact
+  // comparison.
+  std::vector<double> hist1(num_threads*(size_t)m, 0.0);
+  std::vector<double> spec (num_threads*(size_t)m, 0.0);
+
+  long misses = 0;     // mis-speculated strips over the timed sweeps
+  long checked = 0;
+
+  // the speculative sweeps (one warmup + iterations) are followed by an
+  // equally long exact sequential phase, so the net speedup of
+  // speculation can be read off a single run; the verification value
+  // accounts for the total sweep count
+  const int total_sweeps = 2*iterations;
+
+  auto exact_strip = [&](int b) {
+      for (int i=1; i<m; i++) {
+        for (int j=jstart[b]; j<jstart[b+1]; j++) {
+          grid[i*n+j] = grid[(i-1)*n+j] + grid[i*n+(j-1)] - grid[(i-1)*n+(j-1)];
+        }
+      }
+  };
+
+  spin_barrier barrier(num_threads);
+
+  auto worker = [&](int me) {
+      double * RESTRICT mycol = &spec[me*(size_t)m];
+
+      for (int sweep = 0; sweep<=total_sweeps; sweep++) {
+
+        // predictions and corrections of the previous sweep are complete
+        barrier.wait();
+
+        if (sweep <= iterations) {
+          // speculative phase: all strips in parallel, strip 0 exact
+          if (me == 0) {
+            exact_strip(0);
+          } else {
+            for (int i=1; i<m; i++) {
+              double left = mycol[i];
+              double diag = mycol[i-1];
+              for (int j=jstart[me]; j<jstart[me+1]; j++) {
+                double val = grid[(i-1)*n+j] + left - diag;
+                left = val;
+                diag = grid[(i-1)*n+j];
+                grid[i*n+j] = val;
+              }
+            }
+          }
+        } else if (me == 0) {
+          // exact sequential phase for the speedup baseline
+          for (int b=0; b<num_threads; b++) exact_strip(b);
+        }
+
+        barrier.wait();
+
+        if (me == 0) {
+          if (sweep <= iterations) {
+            // detect and correct mis-speculation left to right; a
+            // corrected strip changes its own right boundary, so later
+            // strips see post-correction values when they are checked
+            for (int b=1; b<num_threads; b++) {
+              const int jb = jstart[b]-1;
+              bool hit = true;
+              for (int i=1; i<m; i++) {
+                if (spec[b*(size_t)m+i] != grid[i*n+jb]) { hit = false; break; }
+              }
+              if (!hit) exact_strip(b);
+              if (sweep > 0) {
+                checked++;
+                if (!hit) misses++;
+              }
+            }
+          }
+
+          // copy top right corner value to bottom left corner to create dependency
+          grid[0*n+0] = -grid[(m-1)*n+(n-1)];
+
+          if (sweep <= iterations) {
+            // roll the prediction state forward: linear extrapolation
+            // from the last two sweeps, which is exact once the
+            // recurrence settles into its constant per-sweep increment
+            for (int b=1; b<num_threads; b++) {
+              const int jb = jstart[b]-1;
+              spec[b*(size_t)m] = grid[0*n+jb];
+              for (int i=1; i<m; i++) {
+                const double cur = grid[i*n+jb];
+                spec[b*(size_t)m+i] = (sweep > 0) ? 2.0*cur - hist1[b*(size_t)m+i] : cur;
+                hist1[b*(size_t)m+i] = cur;
+              }
+            }
+          }
+
+          if (sweep == 0)              spec_time = prk::wtime();
+          if (sweep == iterations)   { spec_time = prk::wtime() - spec_time;
+                                       seq_time  = prk::wtime(); }
+          if (sweep == total_sweeps)   seq_time  = prk::wtime() - seq_time;
+        }
+      }
+  };
+
+  {
+    std::vector<std::thread> pool;
+    for (int t=1; t<num_threads; t++) {
+      pool.emplace_back(worker, t);
+    }
+    worker(0);
+    for (auto & t : pool) t.join();
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // Analyze and output results.
+  //////////////////////////////////////////////////////////////////////
+
+  const double epsilon = 1.e-8;
+  auto corner_val = ((total_sweeps+1.)*(n+m-2.));
+  if ( (std::fabs(grid[(m-1)*n+(n-1)] - corner_val)/corner_val) > epsilon) {
+    std::cout << "ERROR: checksum " << grid[(m-1)*n+(n-1)]
+              << " does not match verification value " << corner_val << std::endl;
+    return 1;
+  }
+
+#ifdef VERBOSE
+  std::cout << "Solution validates; verification value = " << corner_val << std::endl;
+#else
+  std::cout << "Solution validates" << std::endl;
+#endif
+  auto avgtime = spec_time/iterations;
+  std::cout << "Rate (MFlops/s): "
+            << 2.0e-6 * ( (m-1.)*(n-1.) )/avgtime
+            << " Avg time (s): " << avgtime << std::endl;
+  if (checked > 0) {
+    std::cout << "Mis-speculation rate: " << 100.0*misses/checked
+              << "% (" << misses << " of " << checked
+              << " strips re-executed)" << std::endl;
+  }
+  std::cout << "Sequential time/iter (s): " << seq_time/iterations
+            << ", net speedup " << seq_time/spec_time << std::endl;
+
+  return 0;
+}
@@ -127,6 +127,8 @@ int main(int argc, char* argv[])
 
   double * RESTRICT grid = new double[m*n];
 
+  const p2p_blocks blk(m, n, mc, nc);
+
   OMP_PARALLEL()
   OMP_MASTER
   {
@@ -149,10 +151,12 @@ int main(int argc, char* argv[])
 
       if (iter==1) pipeline_time = prk::wtime();
 
-      for (int i=1; i<m; i+=mc) {
-        for (int j=1; j<n; j+=nc) {
-          OMP_TASK( firstprivate(m,n) shared(grid) depend(in:grid[(i-mc)*n+j],grid[i*n+(j-nc)]) depend(out:grid[i*n+j]) )
-          sweep_tile(i, std::min(m,i+mc), j, std::min(n,j+nc), n, grid);
+      for (int bi=0; bi<blk.ib; bi++) {
+        for (int bj=0; bj<blk.jb; bj++) {
+          const int i = blk.ilo(bi);
+          const int j = blk.jlo(bj);
+          OMP_TASK( firstprivate(bi,bj,i,j) shared(grid) depend(in:grid[(i-mc)*n+j],grid[i*n+(j-nc)]) depend(out:grid[i*n+j]) )
+          blk.sweep(bi, bj, grid);
         }
       }
       OMP_TASKWAIT
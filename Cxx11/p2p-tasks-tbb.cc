@@ -125,11 +125,10 @@ int main(int argc, char* argv[])
   //////////////////////////////////////////////////////////////////////
   // Create Grid and allocate space
   //////////////////////////////////////////////////////////////////////
-  // calculate number of tiles in n and m direction to create grid.
-  int num_blocks_n = (n / nc);
-  if(n%nc != 0) num_blocks_n++;
-  int num_blocks_m = (m / mc);
-  if(m%mc != 0) num_blocks_m++;
+  // block decomposition shared with the other blocked variants
+  const p2p_blocks blk(m, n, mc, nc);
+  int num_blocks_n = blk.jb;
+  int num_blocks_m = blk.ib;
 
   auto pipeline_time = 0.0; // silence compiler warning
 
@@ -155,7 +154,7 @@ int main(int argc, char* argv[])
   for (int i=0; i<num_blocks_m; i+=1) {
     for (int j=0; j<num_blocks_n; j+=1) {
         block_node_t *tmp = new block_node_t(g, [=](const tbb::flow::continue_msg &){
-            sweep_tile((i*mc)+1, std::min(m,(i*mc)+mc+1), (j*nc)+1, std::min(n,(j*nc)+nc+1), n, grid);
+            blk.sweep(i, j, grid);
         });
 #if TBB_PREVIEW_FLOW_GRAPH_TRACE
         sprintf(buffer, "block [ %d, %d ]", i, j );
@@ -0,0 +1,294 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    Pipeline
+///
+/// PURPOSE: This program tests the efficiency with which point-to-point
+///          synchronization can be carried out. It does so by executing
+///          a pipelined algorithm on an m*n grid. The first array dimension
+///          is distributed among the threads (stripwise decomposition).
+///
+/// USAGE:   The program takes as input the number of iterations, the
+///          grid sizes, and the block (chunk) dimensions:
+///
+///          <progname> <# iterations> <m> <n> [<mc> <nc>]
+///
+///          The blocks of the wavefront are scheduled by a work-stealing
+///          thread pool: each block carries a dependence counter on its
+///          left and upper neighbors and becomes runnable when both have
+///          completed, so progress is driven by the dependency graph
+///          rather than a static schedule and throughput degrades
+///          gracefully when cores are stolen by other tenants.
+///          PRK_NUM_THREADS overrides the pool size.
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// HISTORY: - Written by Rob Van der Wijngaart, February 2009.
+///            C99-ification by Jeff Hammond, February 2016.
+///            C++11-ification by Jeff Hammond, May 2017.
+///            Work-stealing pool variant added 2020.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+#include "p2p-kernel.h"
+
+#include <thread>
+#include <mutex>
+#include <deque>
+
+namespace {
+
+  // One deque per worker; owners pop from the front, thieves steal from
+  // the back.  A mutex per deque is plenty here: block bodies are large
+  // compared to the queue operations.
+  struct worker_queue {
+      std::deque<int> q;
+      std::mutex mtx;
+
+      void push(int b) {
+          std::lock_guard<std::mutex> lock(mtx);
+          q.push_front(b);
+      }
+
+      bool pop(int & b) {
+          std::lock_guard<std::mutex> lock(mtx);
+          if (q.empty()) return false;
+          b = q.front();
+          q.pop_front();
+          return true;
+      }
+
+      bool steal(int & b) {
+          std::lock_guard<std::mutex> lock(mtx);
+          if (q.empty()) return false;
+          b = q.back();
+          q.pop_back();
+          return true;
+      }
+  };
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11 work-stealing TASKS pipeline execution on 2D grid" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Process and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations;
+  int m, n;
+  int mc, nc;
+  try {
+      if (argc < 4){
+        throw " <# iterations> <first array dimension> <second array dimension> [<first chunk dimension> <second chunk dimension>]";
+      }
+
+      // number of times to run the pipeline algorithm
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      // grid dimensions
+      m = std::atoi(argv[2]);
+      n = std::atoi(argv[3]);
+      if (m < 1 || n < 1) {
+        throw "ERROR: grid dimensions must be positive";
+      } else if ( static_cast<size_t>(m)*static_cast<size_t>(n) > INT_MAX) {
+        throw "ERROR: grid dimension too large - overflow risk";
+      }
+
+      // grid chunk dimensions
+      mc = (argc > 4) ? std::atoi(argv[4]) : 64;
+      nc = (argc > 5) ? std::atoi(argv[5]) : 64;
+      if (mc < 1 || mc > m || nc < 1 || nc > n) {
+        std::cout << "WARNING: grid chunk dimensions invalid: " << mc << nc << " (ignoring)" << std::endl;
+        mc = m;
+        nc = n;
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  int num_threads = std::thread::hardware_concurrency();
+  {
+    const char * temp = std::getenv("PRK_NUM_THREADS");
+    if (temp!=nullptr) num_threads = std::atoi(temp);
+    if (num_threads < 1) num_threads = 1;
+  }
+
+  std::cout << "Number of threads    = " << num_threads << std::endl;
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Grid sizes           = " << m << ", " << n << std::endl;
+  std::cout << "Grid chunk sizes     = " << mc << ", " << nc << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  auto pipeline_time = 0.0; // silence compiler warning
+
+  double * RESTRICT grid = new double[m*n];
+
+  for (int i=0; i<m; i++) {
+    for (int j=0; j<n; j++) {
+      grid[i*n+j] = 0.0;
+    }
+  }
+  for (int j=0; j<n; j++) {
+    grid[0*n+j] = static_cast<double>(j);
+  }
+  for (int i=0; i<m; i++) {
+    grid[i*n+0] = static_cast<double>(i);
+  }
+
+  // block decomposition of the interior (i,j >= 1)
+  const int nbi = prk::divceil(m-1,mc);
+  const int nbj = prk::divceil(n-1,nc);
+  const int nblocks = nbi * nbj;
+
+  std::vector<std::atomic<int>> deps(nblocks);
+  std::vector<worker_queue> queues(num_threads);
+  std::atomic<int> remaining(0);
+  std::atomic<long> epoch(0);
+  std::atomic<bool> shutdown(false);
+
+  auto run_block = [&](int b, int me) {
+      const int bi = b / nbj;
+      const int bj = b % nbj;
+      const int ilo = 1 + bi*mc;
+      const int jlo = 1 + bj*nc;
+      sweep_tile(ilo, std::min(m,ilo+mc), jlo, std::min(n,jlo+nc), n, grid);
+      // release the right and lower neighbors when their last input retires
+      if (bj+1 < nbj) {
+          if (deps[b+1].fetch_sub(1) == 1) queues[me].push(b+1);
+      }
+      if (bi+1 < nbi) {
+          if (deps[b+nbj].fetch_sub(1) == 1) queues[me].push(b+nbj);
+      }
+      remaining.fetch_sub(1);
+  };
+
+  auto work = [&](int me, long my_epoch) {
+      // drain the wavefront of the current epoch, stealing when idle
+      while (remaining.load() > 0) {
+          int b;
+          if (queues[me].pop(b)) {
+              run_block(b, me);
+              continue;
+          }
+          bool found = false;
+          for (int v=1; v<num_threads; v++) {
+              if (queues[(me+v)%num_threads].steal(b)) {
+                  run_block(b, me);
+                  found = true;
+                  break;
+              }
+          }
+          if (!found) std::this_thread::yield();
+          if (epoch.load() != my_epoch) break; // stale epoch (spurious wakeup)
+      }
+  };
+
+  std::vector<std::thread> pool;
+  for (int t=1; t<num_threads; t++) {
+      pool.emplace_back([&,t]() {
+          long seen = 0;
+          while (!shutdown.load()) {
+              const long e = epoch.load();
+              if (e == seen) {
+                  std::this_thread::yield();
+                  continue;
+              }
+              seen = e;
+              work(t, e);
+          }
+      });
+  }
+
+  for (int iter = 0; iter<=iterations; iter++) {
+
+    if (iter==1) pipeline_time = prk::wtime();
+
+    // seed the dependence counters: one for the left and one for the
+    // upper neighbor, where present
+    for (int bi=0; bi<nbi; bi++) {
+      for (int bj=0; bj<nbj; bj++) {
+        deps[bi*nbj+bj].store( (bi>0 ? 1 : 0) + (bj>0 ? 1 : 0) );
+      }
+    }
+    remaining.store(nblocks);
+    queues[0].push(0);
+    epoch.fetch_add(1);
+
+    work(0, epoch.load());
+    while (remaining.load() > 0) std::this_thread::yield();
+
+    grid[0*n+0] = -grid[(m-1)*n+(n-1)];
+  }
+  pipeline_time = prk::wtime() - pipeline_time;
+
+  shutdown.store(true);
+  for (auto & t : pool) t.join();
+
+  //////////////////////////////////////////////////////////////////////
+  // Analyze and output results.
+  //////////////////////////////////////////////////////////////////////
+
+  const double epsilon = 1.e-8;
+  auto corner_val = ((iterations+1.)*(n+m-2.));
+  if ( (std::fabs(grid[(m-1)*n+(n-1)] - corner_val)/corner_val) > epsilon) {
+    std::cout << "ERROR: checksum " << grid[(m-1)*n+(n-1)]
+              << " does not match verification value " << corner_val << std::endl;
+    return 1;
+  }
+
+#ifdef VERBOSE
+  std::cout << "Solution validates; verification value = " << corner_val << std::endl;
+#else
+  std::cout << "Solution validates" << std::endl;
+#endif
+  auto avgtime = pipeline_time/iterations;
+  std::cout << "Rate (MFlops/s): "
+            << 2.0e-6 * ( (m-1.)*(n-1.) )/avgtime
+            << " Avg time (s): " << avgtime << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,496 @@
+///
+/// Copyright (c) 2015, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+///
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    pic
+///
+/// PURPOSE: This program tests the efficiency with which a cloud of
+///          charged particles can be moved through a spatially fixed
+///          collection of charges located at the vertices of a square
+///          equi-spaced grid. It is a proxy for a component of a
+///          particle-in-cell method
+///
+/// USAGE:   <progname> <#simulation steps> <grid size> <#particles> \
+///                     <horizontal velocity> <vertical velocity>    \
+///                     <init mode> <init parameters>
+///
+///          The PRK kernel proper only gathers forces from the static
+///          charge grid; a production PIC step also scatters particle
+///          charge back onto a density grid.  This port adds that
+///          scatter as a separately timed phase so the two canonical
+///          GPU deposition strategies can be compared on one device:
+///
+///          PRK_PIC_DEPOSITION=atomic   one global atomicAdd per
+///                                      particle (default)
+///          PRK_PIC_DEPOSITION=sort     each thread block sorts its
+///                                      particles by cell and issues
+///                                      one atomic per distinct cell
+///          PRK_PIC_DEPOSITION=none     particle push only, matching
+///                                      the other pic ports
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// HISTORY: - Written by Evangelos Georganas, August 2015.
+///          - RvdW: Refactored to make the code PRK conforming, December 2015
+///          - Converted to C++11, August 2026.
+///          - CUDA version with charge deposition, August 2026.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+#include "prk_cuda.h"
+#include "prk_pic.h"
+
+const int blockSize = 256;
+
+__device__ void dev_compute_coulomb(double x_dist, double y_dist, double q1, double q2,
+                                    double & fx, double & fy)
+{
+    const double r2 = x_dist*x_dist + y_dist*y_dist;
+    const double r  = sqrt(r2);
+    const double f_coulomb = q1*q2/r2;
+
+    fx = f_coulomb * x_dist/r;   // f_coulomb * cos_theta
+    fy = f_coulomb * y_dist/r;   // f_coulomb * sin_theta
+}
+
+/// device rendering of prk::pic::compute_total_force
+__device__ void dev_compute_total_force(double p_x, double p_y, double p_q,
+                                        unsigned L, const double * Qgrid,
+                                        double & fx, double & fy)
+{
+    const unsigned x = (unsigned) floor(p_x);
+    const unsigned y = (unsigned) floor(p_y);
+    const double rel_x = p_x - x;
+    const double rel_y = p_y - y;
+
+    double tmp_fx, tmp_fy;
+    double res_x(0), res_y(0);
+
+    // force from top-left charge
+    dev_compute_coulomb(rel_x, rel_y, p_q, Qgrid[x*(L+1)+y], tmp_fx, tmp_fy);
+    res_x += tmp_fx;
+    res_y += tmp_fy;
+
+    // force from bottom-left charge
+    dev_compute_coulomb(rel_x, 1.0-rel_y, p_q, Qgrid[x*(L+1)+y+1], tmp_fx, tmp_fy);
+    res_x += tmp_fx;
+    res_y -= tmp_fy;
+
+    // force from top-right charge
+    dev_compute_coulomb(1.0-rel_x, rel_y, p_q, Qgrid[(x+1)*(L+1)+y], tmp_fx, tmp_fy);
+    res_x -= tmp_fx;
+    res_y += tmp_fy;
+
+    // force from bottom-right charge
+    dev_compute_coulomb(1.0-rel_x, 1.0-rel_y, p_q, Qgrid[(x+1)*(L+1)+y+1], tmp_fx, tmp_fy);
+    res_x -= tmp_fx;
+    res_y -= tmp_fy;
+
+    fx = res_x;
+    fy = res_y;
+}
+
+/// gather forces and update positions and velocities, taking into
+/// account periodic boundaries; one thread per particle
+__global__ void push(const unsigned n, const unsigned L, const double * Qgrid,
+                     double * x, double * y, double * v_x, double * v_y, const double * q)
+{
+    const unsigned i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < n) {
+        const double DT       = prk::pic::DT;
+        const double MASS_INV = prk::pic::MASS_INV;
+
+        double fx(0), fy(0);
+        dev_compute_total_force(x[i], y[i], q[i], L, Qgrid, fx, fy);
+        const double ax = fx * MASS_INV;
+        const double ay = fy * MASS_INV;
+
+        x[i] = fmod(x[i] + v_x[i]*DT + 0.5*ax*DT*DT + L, (double)L);
+        y[i] = fmod(y[i] + v_y[i]*DT + 0.5*ay*DT*DT + L, (double)L);
+
+        v_x[i] += ax * DT;
+        v_y[i] += ay * DT;
+    }
+}
+
+/// scatter particle charge onto the cell containing the particle with
+/// one global atomic per particle (double atomicAdd needs sm_60+)
+__global__ void deposit_atomic(const unsigned n, const unsigned L,
+                               const double * x, const double * y, const double * q,
+                               double * rho)
+{
+    const unsigned i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < n) {
+        const unsigned cx = (unsigned) floor(x[i]);
+        const unsigned cy = (unsigned) floor(y[i]);
+        atomicAdd(&rho[cx*L+cy], q[i]);
+    }
+}
+
+/// scatter with per-block combining: the block sorts its particles by
+/// cell index (bitonic sort in shared memory), the owner of each run
+/// of equal cells sums it sequentially and issues a single atomic.
+/// With any spatial locality in the particle order this trades the
+/// per-particle global atomics for shared-memory traffic.
+template <int BS>
+__global__ void deposit_sorted(const unsigned n, const unsigned L,
+                               const double * x, const double * y, const double * q,
+                               double * rho)
+{
+    __shared__ unsigned cell[BS];
+    __shared__ double   chg[BS];
+
+    const unsigned t = threadIdx.x;
+    const unsigned i = blockIdx.x * BS + t;
+    if (i < n) {
+        const unsigned cx = (unsigned) floor(x[i]);
+        const unsigned cy = (unsigned) floor(y[i]);
+        cell[t] = cx*L+cy;
+        chg[t]  = q[i];
+    } else {
+        // sentinel sorts behind every real cell and is never deposited
+        cell[t] = 0xffffffffu;
+        chg[t]  = 0.0;
+    }
+    __syncthreads();
+
+    for (unsigned k=2; k<=BS; k<<=1) {
+        for (unsigned j=k>>1; j>0; j>>=1) {
+            const unsigned partner = t ^ j;
+            if (partner > t) {
+                const bool ascending = ((t & k) == 0);
+                if ((cell[t] > cell[partner]) == ascending) {
+                    const unsigned uc = cell[t]; cell[t] = cell[partner]; cell[partner] = uc;
+                    const double   dc = chg[t];  chg[t]  = chg[partner];  chg[partner]  = dc;
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    if (cell[t] != 0xffffffffu && (t == 0 || cell[t] != cell[t-1])) {
+        double sum = chg[t];
+        for (unsigned r=t+1; r<BS && cell[r]==cell[t]; r++) sum += chg[r];
+        atomicAdd(&rho[cell[t]], sum);
+    }
+}
+
+int main(int argc, char * argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11/CUDA Particle-in-Cell execution on 2D grid" << std::endl;
+
+  prk::CUDA::info info;
+  if (!prk::fast_start()) info.print();
+
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  uint64_t iterations, L, n;
+  int64_t k, m;
+  std::string init_mode;
+  double rho_factor(0), alpha(0), beta(0);
+  prk::pic::bbox init_patch{0,0,0,0};
+  try {
+      if (argc < 7) {
+        throw "Usage: <#simulation steps> <grid size> <#particles> <k (particle charge semi-increment)> <m (vertical particle velocity)> <init mode> <init parameters>\n"
+              "   init mode \"GEOMETRIC\"  parameters: <attenuation factor>\n"
+              "             \"SINUSOIDAL\" parameters: none\n"
+              "             \"LINEAR\"     parameters: <negative slope> <constant offset>\n"
+              "             \"PATCH\"      parameters: <xleft> <xright> <ybottom> <ytop>";
+      }
+
+      iterations = std::atol(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: Number of time steps must be positive";
+      }
+
+      L = std::atol(argv[2]);
+      if (L < 1 || L%2) {
+        throw "ERROR: Number of grid cells must be positive and even";
+      }
+
+      n = prk::parse_size(argv[3]);
+      if (n < 1) {
+        throw "ERROR: Number of particles must be positive";
+      }
+
+      k = std::atol(argv[4]);
+      if (k < 0) {
+        throw "ERROR: Particle semi-charge must be non-negative";
+      }
+      m = std::atol(argv[5]);
+
+      init_mode = argv[6];
+      if (init_mode == "GEOMETRIC") {
+        if (argc < 8) {
+          throw "ERROR: Not enough arguments for GEOMETRIC";
+        }
+        rho_factor = std::atof(argv[7]);
+      }
+      else if (init_mode == "SINUSOIDAL") {
+        // no parameters
+      }
+      else if (init_mode == "LINEAR") {
+        if (argc < 9) {
+          throw "ERROR: Not enough arguments for LINEAR initialization";
+        }
+        alpha = std::atof(argv[7]);
+        beta  = std::atof(argv[8]);
+        if (beta < 0 || beta < alpha) {
+          throw "ERROR: linear profile gives negative particle density";
+        }
+      }
+      else if (init_mode == "PATCH") {
+        if (argc < 11) {
+          throw "ERROR: Not enough arguments for PATCH initialization";
+        }
+        init_patch.left   = std::atol(argv[7]);
+        init_patch.right  = std::atol(argv[8]);
+        init_patch.bottom = std::atol(argv[9]);
+        init_patch.top    = std::atol(argv[10]);
+        if (prk::pic::bad_patch(init_patch, {0, L+1, 0, L+1})) {
+          throw "ERROR: inconsistent initial patch";
+        }
+      }
+      else {
+        throw "ERROR: Unsupported particle initializing mode";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  // the deposition strategy is chosen at run time so the comparison
+  // uses one binary; the init parameters occupy the trailing arguments
+  enum class deposition { none, atomic, sorted };
+  deposition dep = deposition::atomic;
+  {
+    const char * e = std::getenv("PRK_PIC_DEPOSITION");
+    if (e != NULL) {
+      const std::string s(e);
+      if      (s == "atomic") dep = deposition::atomic;
+      else if (s == "sort")   dep = deposition::sorted;
+      else if (s == "none")   dep = deposition::none;
+      else {
+        std::cout << "ERROR: PRK_PIC_DEPOSITION must be atomic, sort or none" << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  std::cout << "Grid size                      = " << L << std::endl;
+  std::cout << "Number of particles requested  = " << n << std::endl;
+  std::cout << "Number of time steps           = " << iterations << std::endl;
+  std::cout << "Initialization mode            = " << init_mode << std::endl;
+  if (init_mode == "GEOMETRIC") {
+    std::cout << "  Attenuation factor           = " << rho_factor << std::endl;
+  } else if (init_mode == "LINEAR") {
+    std::cout << "  Negative slope               = " << alpha << std::endl;
+    std::cout << "  Offset                       = " << beta << std::endl;
+  } else if (init_mode == "PATCH") {
+    std::cout << "  Bounding box                 = " << init_patch.left << ", " << init_patch.right
+              << ", " << init_patch.bottom << ", " << init_patch.top << std::endl;
+  }
+  std::cout << "Particle charge semi-increment = " << k << std::endl;
+  std::cout << "Vertical velocity              = " << m << std::endl;
+  std::cout << "Charge deposition              = "
+            << (dep == deposition::atomic ? "global atomics" :
+                dep == deposition::sorted ? "block sort + reduce" : "none")
+            << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Initialize grid of charges and particles
+  //////////////////////////////////////////////////////////////////////
+
+  auto grid = prk::pic::initialize_grid(L);
+
+  std::vector<prk::pic::particle> particles;
+  if      (init_mode == "GEOMETRIC")  particles = prk::pic::initialize_geometric(n, L, rho_factor, k, m);
+  else if (init_mode == "SINUSOIDAL") particles = prk::pic::initialize_sinusoidal(n, L, k, m);
+  else if (init_mode == "LINEAR")     particles = prk::pic::initialize_linear(n, L, alpha, beta, k, m);
+  else if (init_mode == "PATCH")      particles = prk::pic::initialize_patch(n, L, init_patch, k, m);
+  n = particles.size();
+
+  std::cout << "Number of particles placed     = " << n << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Copy particles and charge grid to the device
+  //////////////////////////////////////////////////////////////////////
+
+  const size_t pbytes = n * sizeof(double);
+  const size_t gbytes = (L+1)*(L+1) * sizeof(double);
+  const size_t cbytes = L*L * sizeof(double);
+
+  // structure of arrays: the push kernel touches every field, the
+  // deposition kernels only positions and charge
+  std::vector<double> h_x(n), h_y(n), h_vx(n), h_vy(n), h_q(n);
+  for (uint64_t i=0; i<n; i++) {
+    h_x[i]  = particles[i].x;
+    h_y[i]  = particles[i].y;
+    h_vx[i] = particles[i].v_x;
+    h_vy[i] = particles[i].v_y;
+    h_q[i]  = particles[i].q;
+  }
+
+  double *d_x, *d_y, *d_vx, *d_vy, *d_q, *d_Qgrid, *d_rho(NULL);
+  prk::CUDA::check( cudaMalloc((void**)&d_x,  pbytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_y,  pbytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_vx, pbytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_vy, pbytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_q,  pbytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_Qgrid, gbytes) );
+  prk::CUDA::check( cudaMemcpy(d_x,  h_x.data(),  pbytes, cudaMemcpyHostToDevice) );
+  prk::CUDA::check( cudaMemcpy(d_y,  h_y.data(),  pbytes, cudaMemcpyHostToDevice) );
+  prk::CUDA::check( cudaMemcpy(d_vx, h_vx.data(), pbytes, cudaMemcpyHostToDevice) );
+  prk::CUDA::check( cudaMemcpy(d_vy, h_vy.data(), pbytes, cudaMemcpyHostToDevice) );
+  prk::CUDA::check( cudaMemcpy(d_q,  h_q.data(),  pbytes, cudaMemcpyHostToDevice) );
+  prk::CUDA::check( cudaMemcpy(d_Qgrid, grid.data(), gbytes, cudaMemcpyHostToDevice) );
+  if (dep != deposition::none) {
+    prk::CUDA::check( cudaMalloc((void**)&d_rho, cbytes) );
+    prk::CUDA::check( cudaMemset(d_rho, 0, cbytes) );
+  }
+
+  dim3 dimBlock(blockSize, 1, 1);
+  dim3 dimGrid(prk::divceil(n,(uint64_t)blockSize), 1, 1);
+  info.checkDims(dimBlock, dimGrid);
+
+  //////////////////////////////////////////////////////////////////////
+  // Perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  double pic_time(0), push_time(0), dep_time(0);
+
+  {
+    const unsigned un = (unsigned)n;
+    const unsigned uL = (unsigned)L;
+
+    for (uint64_t iter=0; iter<=iterations; iter++) {
+
+      /* start the timers after one warm-up time step */
+      if (iter==1) {
+        push_time = dep_time = 0.0;
+        pic_time = prk::wtime();
+      }
+
+      // the two phases are synchronized and timed separately so that
+      // the deposition strategies can be compared without the (common)
+      // push cost diluting the difference
+      double t = prk::wtime();
+      push<<<dimGrid, dimBlock>>>(un, uL, d_Qgrid, d_x, d_y, d_vx, d_vy, d_q);
+      prk::CUDA::check( cudaDeviceSynchronize() );
+      push_time += prk::wtime() - t;
+
+      if (dep != deposition::none) {
+        t = prk::wtime();
+        if (dep == deposition::atomic) {
+          deposit_atomic<<<dimGrid, dimBlock>>>(un, uL, d_x, d_y, d_q, d_rho);
+        } else {
+          deposit_sorted<blockSize><<<dimGrid, dimBlock>>>(un, uL, d_x, d_y, d_q, d_rho);
+        }
+        prk::CUDA::check( cudaDeviceSynchronize() );
+        dep_time += prk::wtime() - t;
+      }
+    }
+
+    pic_time = prk::wtime() - pic_time;
+  }
+
+  // only the final positions are needed for verification
+  prk::CUDA::check( cudaMemcpy(h_x.data(), d_x, pbytes, cudaMemcpyDeviceToHost) );
+  prk::CUDA::check( cudaMemcpy(h_y.data(), d_y, pbytes, cudaMemcpyDeviceToHost) );
+  for (uint64_t i=0; i<n; i++) {
+    particles[i].x = h_x[i];
+    particles[i].y = h_y[i];
+  }
+
+  std::vector<double> h_rho;
+  if (dep != deposition::none) {
+    h_rho.resize(L*L);
+    prk::CUDA::check( cudaMemcpy(h_rho.data(), d_rho, cbytes, cudaMemcpyDeviceToHost) );
+    prk::CUDA::check( cudaFree(d_rho) );
+  }
+  prk::CUDA::check( cudaFree(d_Qgrid) );
+  prk::CUDA::check( cudaFree(d_q) );
+  prk::CUDA::check( cudaFree(d_vy) );
+  prk::CUDA::check( cudaFree(d_vx) );
+  prk::CUDA::check( cudaFree(d_y) );
+  prk::CUDA::check( cudaFree(d_x) );
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  bool correct(true);
+  for (uint64_t i=0; i<n; i++) {
+    correct &= prk::pic::verify_particle(particles[i], iterations, grid.data(), L);
+  }
+
+  if (dep != deposition::none) {
+    // charge is conserved: over iterations+1 deposits (including the
+    // warm-up step) the density grid must accumulate the total particle
+    // charge that many times, independent of where the particles moved
+    double deposited(0), total_q(0), abs_q(0);
+    for (uint64_t c=0; c<L*L; c++) deposited += h_rho[c];
+    for (uint64_t i=0; i<n; i++) {
+      total_q += h_q[i];
+      abs_q   += std::fabs(h_q[i]);
+    }
+    const double expected = (double)(iterations+1) * total_q;
+    const double scale    = (double)(iterations+1) * abs_q;
+    if (std::fabs(deposited - expected) > prk::pic::epsilon * scale) {
+      std::cout << "ERROR: deposited charge " << deposited
+                << " differs from expected " << expected << std::endl;
+      correct = false;
+    }
+  }
+
+  if (correct) {
+    std::cout << "Solution validates" << std::endl;
+#ifdef VERBOSE
+    std::cout << "Simulation time is " << pic_time << " seconds" << std::endl;
+#endif
+    std::cout << "Rate (Mparticles_moved/s): " << 1.e-6*(n*iterations/push_time) << std::endl;
+    if (dep != deposition::none) {
+      std::cout << "Rate (Mparticles_deposited/s): " << 1.e-6*(n*iterations/dep_time) << std::endl;
+    }
+  } else {
+    std::cout << "Solution does not validate" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
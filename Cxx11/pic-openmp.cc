@@ -0,0 +1,248 @@
+///
+/// Copyright (c) 2015, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+///
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    pic
+///
+/// PURPOSE: This program tests the efficiency with which a cloud of
+///          charged particles can be moved through a spatially fixed
+///          collection of charges located at the vertices of a square
+///          equi-spaced grid. It is a proxy for a component of a
+///          particle-in-cell method
+///
+/// USAGE:   <progname> <#simulation steps> <grid size> <#particles> \
+///                     <horizontal velocity> <vertical velocity>    \
+///                     <init mode> <init parameters>
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// HISTORY: - Written by Evangelos Georganas, August 2015.
+///          - RvdW: Refactored to make the code PRK conforming, December 2015
+///          - Converted to C++11/OpenMP, August 2026.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+#include "prk_pic.h"
+
+int main(int argc, char * argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+#ifdef _OPENMP
+  std::cout << "C++11/OpenMP Particle-in-Cell execution on 2D grid" << std::endl;
+#else
+  std::cout << "C++11 Particle-in-Cell execution on 2D grid" << std::endl;
+#endif
+
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  uint64_t iterations, L, n;
+  int64_t k, m;
+  std::string init_mode;
+  double rho(0), alpha(0), beta(0);
+  prk::pic::bbox init_patch{0,0,0,0};
+  try {
+      if (argc < 7) {
+        throw "Usage: <#simulation steps> <grid size> <#particles> <k (particle charge semi-increment)> <m (vertical particle velocity)> <init mode> <init parameters>\n"
+              "   init mode \"GEOMETRIC\"  parameters: <attenuation factor>\n"
+              "             \"SINUSOIDAL\" parameters: none\n"
+              "             \"LINEAR\"     parameters: <negative slope> <constant offset>\n"
+              "             \"PATCH\"      parameters: <xleft> <xright> <ybottom> <ytop>";
+      }
+
+      iterations = std::atol(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: Number of time steps must be positive";
+      }
+
+      L = std::atol(argv[2]);
+      if (L < 1 || L%2) {
+        throw "ERROR: Number of grid cells must be positive and even";
+      }
+
+      n = prk::parse_size(argv[3]);
+      if (n < 1) {
+        throw "ERROR: Number of particles must be positive";
+      }
+
+      k = std::atol(argv[4]);
+      if (k < 0) {
+        throw "ERROR: Particle semi-charge must be non-negative";
+      }
+      m = std::atol(argv[5]);
+
+      init_mode = argv[6];
+      if (init_mode == "GEOMETRIC") {
+        if (argc < 8) {
+          throw "ERROR: Not enough arguments for GEOMETRIC";
+        }
+        rho = std::atof(argv[7]);
+      }
+      else if (init_mode == "SINUSOIDAL") {
+        // no parameters
+      }
+      else if (init_mode == "LINEAR") {
+        if (argc < 9) {
+          throw "ERROR: Not enough arguments for LINEAR initialization";
+        }
+        alpha = std::atof(argv[7]);
+        beta  = std::atof(argv[8]);
+        if (beta < 0 || beta < alpha) {
+          throw "ERROR: linear profile gives negative particle density";
+        }
+      }
+      else if (init_mode == "PATCH") {
+        if (argc < 11) {
+          throw "ERROR: Not enough arguments for PATCH initialization";
+        }
+        init_patch.left   = std::atol(argv[7]);
+        init_patch.right  = std::atol(argv[8]);
+        init_patch.bottom = std::atol(argv[9]);
+        init_patch.top    = std::atol(argv[10]);
+        if (prk::pic::bad_patch(init_patch, {0, L+1, 0, L+1})) {
+          throw "ERROR: inconsistent initial patch";
+        }
+      }
+      else {
+        throw "ERROR: Unsupported particle initializing mode";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+#ifdef _OPENMP
+  std::cout << "Number of threads              = " << omp_get_max_threads() << std::endl;
+#endif
+  std::cout << "Grid size                      = " << L << std::endl;
+  std::cout << "Number of particles requested  = " << n << std::endl;
+  std::cout << "Number of time steps           = " << iterations << std::endl;
+  std::cout << "Initialization mode            = " << init_mode << std::endl;
+  if (init_mode == "GEOMETRIC") {
+    std::cout << "  Attenuation factor           = " << rho << std::endl;
+  } else if (init_mode == "LINEAR") {
+    std::cout << "  Negative slope               = " << alpha << std::endl;
+    std::cout << "  Offset                       = " << beta << std::endl;
+  } else if (init_mode == "PATCH") {
+    std::cout << "  Bounding box                 = " << init_patch.left << ", " << init_patch.right
+              << ", " << init_patch.bottom << ", " << init_patch.top << std::endl;
+  }
+  std::cout << "Particle charge semi-increment = " << k << std::endl;
+  std::cout << "Vertical velocity              = " << m << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Initialize grid of charges and particles
+  //////////////////////////////////////////////////////////////////////
+
+  auto grid = prk::pic::initialize_grid(L);
+
+  std::vector<prk::pic::particle> particles;
+  if      (init_mode == "GEOMETRIC")  particles = prk::pic::initialize_geometric(n, L, rho, k, m);
+  else if (init_mode == "SINUSOIDAL") particles = prk::pic::initialize_sinusoidal(n, L, k, m);
+  else if (init_mode == "LINEAR")     particles = prk::pic::initialize_linear(n, L, alpha, beta, k, m);
+  else if (init_mode == "PATCH")      particles = prk::pic::initialize_patch(n, L, init_patch, k, m);
+  n = particles.size();
+
+  std::cout << "Number of particles placed     = " << n << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  double pic_time(0);
+
+  {
+    prk::pic::particle * RESTRICT p = particles.data();
+    const double * RESTRICT Qgrid = grid.data();
+
+    OMP_PARALLEL()
+    {
+    for (uint64_t iter=0; iter<=iterations; iter++) {
+
+      /* start the timer after one warm-up time step */
+      if (iter==1) {
+          OMP_BARRIER
+          OMP_MASTER
+          pic_time = prk::wtime();
+      }
+
+      /* calculate forces on particles and update positions; the
+         particles are independent, only the fixed charges are shared */
+      OMP_FOR()
+      for (uint64_t i=0; i<n; i++) {
+        double fx(0), fy(0);
+        prk::pic::compute_total_force(p[i].x, p[i].y, p[i].q, L, Qgrid, fx, fy);
+        const double ax = fx * prk::pic::MASS_INV;
+        const double ay = fy * prk::pic::MASS_INV;
+
+        /* update particle positions, taking into account periodic boundaries */
+        p[i].x = std::fmod(p[i].x + p[i].v_x*prk::pic::DT + 0.5*ax*prk::pic::DT*prk::pic::DT + L, (double)L);
+        p[i].y = std::fmod(p[i].y + p[i].v_y*prk::pic::DT + 0.5*ay*prk::pic::DT*prk::pic::DT + L, (double)L);
+
+        /* update velocities */
+        p[i].v_x += ax * prk::pic::DT;
+        p[i].v_y += ay * prk::pic::DT;
+      }
+    }
+    OMP_BARRIER
+    OMP_MASTER
+    pic_time = prk::wtime() - pic_time;
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  bool correct(true);
+  for (uint64_t i=0; i<n; i++) {
+    correct &= prk::pic::verify_particle(particles[i], iterations, grid.data(), L);
+  }
+
+  if (correct) {
+    std::cout << "Solution validates" << std::endl;
+#ifdef VERBOSE
+    std::cout << "Simulation time is " << pic_time << " seconds" << std::endl;
+#endif
+    double avg_time = n*iterations/pic_time;
+    std::cout << "Rate (Mparticles_moved/s): " << 1.e-6*avg_time << std::endl;
+  } else {
+    std::cout << "Solution does not validate" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -4,9 +4,11 @@
 //#include <cstdio>
 //#include <cstdlib>
 
+#include <cstdlib>
 #include <iostream>
 #include <vector>
 #include <array>
+#include <map>
 
 #ifndef __NVCC__
 #warning Please compile CUDA code with CC=nvcc.
@@ -57,6 +59,115 @@ namespace prk
         }
 #endif
 
+        // Unified-memory execution is selected at run time with
+        // PRK_MANAGED=1 so that one binary covers both the explicit-copy
+        // and the managed policy.  PRK_MANAGED_PREFETCH=0 additionally
+        // disables the preferred-location and prefetch hints, leaving
+        // migration entirely to page faults or access counters.
+        static inline bool use_managed(void)
+        {
+#ifdef __CORIANDERCC__
+            return false;
+#else
+            const char * e = std::getenv("PRK_MANAGED");
+            return (e!=NULL && std::atoi(e)!=0);
+#endif
+        }
+
+        // PRK_CUDA_GRAPH=1 replays the iteration loop as a captured
+        // CUDA graph instead of launching kernels from the host loop,
+        // which exposes launch latency at small problem sizes.
+        static inline bool use_graph(void)
+        {
+#ifdef __CORIANDERCC__
+            return false;
+#else
+            const char * e = std::getenv("PRK_CUDA_GRAPH");
+            return (e!=NULL && std::atoi(e)!=0);
+#endif
+        }
+
+        // PRK_CUDA_SWEEP=1 runs a geometric series of lengths from an
+        // L2-resident working set up to the command-line length inside
+        // one process, reusing the maximum-size allocation, and prints
+        // the bandwidth-vs-size curve.
+        static inline bool use_sweep(void)
+        {
+#ifdef __CORIANDERCC__
+            return false;
+#else
+            const char * e = std::getenv("PRK_CUDA_SWEEP");
+            return (e!=NULL && std::atoi(e)!=0);
+#endif
+        }
+
+        static inline void prefetch_managed(void * ptr, size_t bytes)
+        {
+#ifndef __CORIANDERCC__
+            const char * e = std::getenv("PRK_MANAGED_PREFETCH");
+            if (e!=NULL && std::atoi(e)==0) return;
+            int device;
+            prk::CUDA::check( cudaGetDevice(&device) );
+            prk::CUDA::check( cudaMemAdvise(ptr, bytes, cudaMemAdviseSetPreferredLocation, device) );
+            prk::CUDA::check( cudaMemPrefetchAsync(ptr, bytes, device, 0) );
+#endif
+        }
+
+        // Pinned host memory, pooled so that repeated allocations of
+        // the same size (as in parameter sweeps) reuse an earlier
+        // registration instead of paying for cudaMallocHost each time.
+        template <typename T>
+        class host_allocator
+        {
+            private:
+                static std::map<size_t, std::vector<void*>> & pool(void)
+                {
+                    static std::map<size_t, std::vector<void*>> p;
+                    return p;
+                }
+
+            public:
+                typedef T value_type;
+
+                host_allocator(void) = default;
+                template <typename U> host_allocator(const host_allocator<U> &) {}
+
+                T * allocate(size_t n)
+                {
+                    const size_t bytes = n * sizeof(T);
+                    auto & free_list = pool()[bytes];
+                    if (!free_list.empty()) {
+                        void * p = free_list.back();
+                        free_list.pop_back();
+                        return static_cast<T*>(p);
+                    }
+                    void * p;
+                    prk::CUDA::check( cudaMallocHost(&p, bytes) );
+                    return static_cast<T*>(p);
+                }
+
+                void deallocate(T * p, size_t n)
+                {
+                    pool()[n * sizeof(T)].push_back(p);
+                }
+        };
+
+        template <typename T, typename U>
+        bool operator==(const host_allocator<T> &, const host_allocator<U> &) { return true; }
+        template <typename T, typename U>
+        bool operator!=(const host_allocator<T> &, const host_allocator<U> &) { return false; }
+
+        template <typename T>
+        using host_vector = std::vector<T, host_allocator<T>>;
+
+        // PRK_TRANSFER_REPORT=1 prints the bandwidth of the host-device
+        // staging copies alongside the kernel numbers.
+        static inline bool report_transfers(void)
+        {
+            const char * e = std::getenv("PRK_TRANSFER_REPORT");
+            return (e!=NULL && std::atoi(e)!=0);
+        }
+
         class info {
 
             private:
@@ -67,6 +178,9 @@ namespace prk
                 int maxThreadsPerBlock;
                 std::array<unsigned,3> maxThreadsDim;
                 std::array<unsigned,3> maxGridSize;
+                size_t totalGlobalMem = 0;
+                size_t l2CacheSize = 0;
+                int memoryBusWidth = 0;
 
                 info() {
                     prk::CUDA::check( cudaGetDeviceCount(&nDevices) );
@@ -79,6 +193,11 @@ namespace prk
                                 maxThreadsDim[j]   = vDevices[i].maxThreadsDim[j];
                                 maxGridSize[j]     = vDevices[i].maxGridSize[j];
                             }
+#ifndef __CORIANDERCC__
+                            totalGlobalMem = vDevices[i].totalGlobalMem;
+                            l2CacheSize    = vDevices[i].l2CacheSize;
+                            memoryBusWidth = vDevices[i].memoryBusWidth;
+#endif
                         }
                     }
                 }
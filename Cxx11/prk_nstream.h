@@ -0,0 +1,129 @@
+///
+/// Copyright (c) 2018, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+///
+
+#ifndef PRK_NSTREAM_H
+#define PRK_NSTREAM_H
+
+///
+/// Pattern selection shared by the nstream family.  Every source array is
+/// initialized to 2 and the destination to 0, so each pattern has a
+/// closed-form checksum:
+///
+///   DOT        r   += B.C                  (read-only, accumulated)
+///   COPY       A    = B
+///   SCALE      A    = scalar*B
+///   TRIAD[m]   A   += B1 + scalar*B2 + B3 + scalar*B4 + ...  (m-1 sources)
+///
+/// Plain TRIAD is TRIAD3, the classic A += B + scalar*C.
+///
+
+namespace prk {
+
+    namespace nstream {
+
+        enum class kind { dot, copy, scale, triad };
+
+        struct pattern {
+
+            kind k;
+            int streams;     // total arrays touched, including the destination
+
+            // number of source arrays
+            int sources(void) const {
+                return (k==kind::triad || k==kind::dot) ? streams-1 : 1;
+            }
+            // triad sources with unit / scalar coefficient
+            int ones(void)   const { return (sources()+1)/2; }
+            int scaled(void) const { return sources()/2; }
+
+            std::string name(void) const {
+                switch (k) {
+                    case kind::dot:   return "DOT";
+                    case kind::copy:  return "COPY";
+                    case kind::scale: return "SCALE";
+                    case kind::triad: return "TRIAD"+std::to_string(streams);
+                }
+                return "";
+            }
+        };
+
+        inline pattern parse(const std::string & s)
+        {
+            if (s=="DOT")   return {kind::dot,   3};
+            if (s=="COPY")  return {kind::copy,  2};
+            if (s=="SCALE") return {kind::scale, 2};
+            if (s=="TRIAD") return {kind::triad, 3};
+            if (s.rfind("TRIAD",0)==0) {
+                const int m = std::atoi(s.c_str()+5);
+                if (m >= 3 && m <= 8) return {kind::triad, m};
+            }
+            throw "ERROR: pattern must be DOT, COPY, SCALE or TRIAD[3-8]";
+        }
+
+        // bytes touched per iteration; stores are counted twice because a
+        // cacheable store first reads the line for ownership, matching the
+        // 4-word accounting the triad drivers have always used
+        inline double bytes_per_iteration(const pattern & p, size_t length)
+        {
+            double words(0);
+            switch (p.k) {
+                case kind::dot:   words = p.sources();     break;
+                case kind::copy:  words = 3.0;             break;
+                case kind::scale: words = 3.0;             break;
+                case kind::triad: words = p.streams + 1.0; break;
+            }
+            return words * length * sizeof(double);
+        }
+
+        // expected checksum of the destination array (or of the accumulated
+        // dot result) after a warmup plus iterations passes
+        inline double checksum(const pattern & p, int iterations, size_t length, double scalar)
+        {
+            switch (p.k) {
+                case kind::dot: {
+                    double r(1);
+                    for (int k=0; k<p.sources(); k++) r *= 2.0;
+                    return (iterations+1.0) * r * length;
+                }
+                case kind::copy:  return 2.0 * length;
+                case kind::scale: return scalar * 2.0 * length;
+                case kind::triad: return (iterations+1.0) *
+                                         (2.0*p.ones() + 2.0*scalar*p.scaled()) * length;
+            }
+            return 0.0;
+        }
+
+    } // namespace nstream
+
+} // namespace prk
+
+#endif /* PRK_NSTREAM_H */
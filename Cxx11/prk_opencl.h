@@ -14,9 +14,13 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <string>
+#include <vector>
+#include <utility>
 
 #include <cstdlib>
+#include <cstdint>
 
 #include "cl.hpp"
 
@@ -41,6 +45,67 @@ namespace prk {
                           std::istreambuf_iterator<char>() );
     }
 
+    uint64_t sourceHash(const std::string & s)
+    {
+      // FNV-1a
+      uint64_t h = UINT64_C(14695981039346656037);
+      for (size_t i=0; i<s.size(); i++) {
+        h ^= (unsigned char)s[i];
+        h *= UINT64_C(1099511628211);
+      }
+      return h;
+    }
+
+    // Build a program with a compiled-binary cache, so repeat runs skip
+    // the JIT.  The cache key hashes the source together with the device
+    // name and driver version, so a source edit or driver update
+    // invalidates the entry; cache files live beside the executables.
+    // PRK_OPENCL_CACHE=0 disables caching.
+    cl::Program buildProgram(cl::Context context, const std::string & source)
+    {
+      const char * e = std::getenv("PRK_OPENCL_CACHE");
+      const bool use_cache = (e==NULL || std::atoi(e)!=0);
+      std::vector<cl::Device> devices = context.getInfo<CL_CONTEXT_DEVICES>();
+      if (!use_cache || devices.size() != 1) {
+        return cl::Program(context, source, true);
+      }
+
+      std::string key(source);
+      key += devices[0].getInfo<CL_DEVICE_NAME>();
+      key += devices[0].getInfo<CL_DRIVER_VERSION>();
+      std::ostringstream cachefile;
+      cachefile << ".prk_ocl_" << std::hex << sourceHash(key) << ".bin";
+
+      std::ifstream in(cachefile.str().c_str(), std::ios::binary);
+      if (in.is_open()) {
+        std::vector<unsigned char> bits( (std::istreambuf_iterator<char>(in)),
+                                          std::istreambuf_iterator<char>() );
+        if (!bits.empty()) {
+          cl::Program::Binaries binaries;
+          binaries.push_back(std::make_pair((const void*)bits.data(), bits.size()));
+          cl_int err = CL_SUCCESS;
+          cl::Program program(context, devices, binaries, NULL, &err);
+          if (err == CL_SUCCESS && program.build() == CL_SUCCESS) {
+            return program;
+          }
+          // stale or foreign binary: fall through and rebuild from source
+        }
+      }
+
+      cl::Program program(context, source, true);
+      size_t nbytes(0);
+      clGetProgramInfo(program(), CL_PROGRAM_BINARY_SIZES, sizeof(size_t), &nbytes, NULL);
+      if (nbytes > 0) {
+        std::vector<unsigned char> bits(nbytes);
+        unsigned char * ptr = bits.data();
+        if (clGetProgramInfo(program(), CL_PROGRAM_BINARIES, sizeof(unsigned char *), &ptr, NULL) == CL_SUCCESS) {
+          std::ofstream out(cachefile.str().c_str(), std::ios::binary | std::ios::trunc);
+          out.write(reinterpret_cast<const char*>(bits.data()), nbytes);
+        }
+      }
+      return program;
+    }
+
     bool listPlatforms()
     {
       std::vector<cl::Platform> platforms;
@@ -98,6 +163,51 @@ namespace prk {
       return ( has64 ? 64 : 32 );
     }
 
+    // Host-accessible buffer backed by pinned allocation where the
+    // implementation supports it; the CL_MEM_ALLOC_HOST_PTR analog of
+    // cudaMallocHost staging.
+    cl::Buffer hostBuffer(cl::Context context, size_t bytes) {
+      return cl::Buffer(context, CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, bytes);
+    }
+
+#ifdef CL_VERSION_2_0
+    // Shared virtual memory (OpenCL 2.0).  Coarse-grained SVM needs
+    // map/unmap around host access; fine-grained SVM is plain
+    // zero-copy host memory.  The C++ bindings shipped here predate
+    // SVM, so these wrap the C API.
+    cl_device_svm_capabilities svmCapabilities(cl::Context context) {
+      std::vector<cl::Device> devices = context.getInfo<CL_CONTEXT_DEVICES>();
+      cl_device_svm_capabilities caps(0);
+      if (devices.size() != 1) return 0;
+      if (clGetDeviceInfo(devices[0](), CL_DEVICE_SVM_CAPABILITIES,
+                          sizeof(caps), &caps, NULL) != CL_SUCCESS) return 0;
+      return caps;
+    }
+
+    void * svmAlloc(cl::Context context, size_t bytes, bool fine) {
+      const cl_svm_mem_flags flags = CL_MEM_READ_WRITE
+                                   | (fine ? CL_MEM_SVM_FINE_GRAIN_BUFFER : 0);
+      return clSVMAlloc(context(), flags, bytes, 0);
+    }
+
+    void svmFree(cl::Context context, void * ptr) {
+      if (ptr != NULL) clSVMFree(context(), ptr);
+    }
+
+    cl_int svmMap(cl::CommandQueue queue, void * ptr, size_t bytes) {
+      return clEnqueueSVMMap(queue(), CL_TRUE, CL_MAP_READ | CL_MAP_WRITE,
+                             ptr, bytes, 0, NULL, NULL);
+    }
+
+    cl_int svmUnmap(cl::CommandQueue queue, void * ptr) {
+      return clEnqueueSVMUnmap(queue(), ptr, 0, NULL, NULL);
+    }
+
+    cl_int setKernelArgSVM(cl::Kernel kernel, cl_uint index, const void * ptr) {
+      return clSetKernelArgSVMPointer(kernel(), index, ptr);
+    }
+#endif // CL_VERSION_2_0
+
     bool available(cl::Context context) {
       std::vector<cl::Device> devices = context.getInfo<CL_CONTEXT_DEVICES>();
       if ( devices.size() == 0 ) return false;
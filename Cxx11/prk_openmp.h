@@ -91,4 +91,23 @@
 # define OMP_END_DECLARE_TARGET
 #endif
 
+#include <cstdlib>
+
+namespace prk
+{
+    namespace OpenMP
+    {
+        // same convention as prk::CUDA::report_transfers(): set
+        // PRK_TRANSFER_REPORT=1 to print host-device transfer bandwidths
+        // separately from the compute timing
+        static inline bool report_transfers(void)
+        {
+            const char * e = std::getenv("PRK_TRANSFER_REPORT");
+            return (e!=NULL && std::atoi(e)!=0);
+        }
+
+    } // OpenMP namespace
+
+} // prk namespace
+
 #endif /* PRK_OPENMP_H */
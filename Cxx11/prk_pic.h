@@ -0,0 +1,322 @@
+///
+/// Copyright (c) 2015, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef PRK_PIC_H
+#define PRK_PIC_H
+
+///
+/// Problem setup, forces and verification shared by the pic family.
+/// This is a C++ rendering of the C versions in SERIAL/PIC and
+/// common/random_draw.c: the particle distributions draw from the same
+/// LCG, so particle placement is reproducible across the ports, and
+/// verification relies only on the closed-form trajectory of each
+/// particle, not on the draw sequence.
+///
+
+namespace prk {
+
+    namespace pic {
+
+        const double Q        = 1.0;
+        const double DT       = 1.0;
+        const double MASS_INV = 1.0;
+        const double REL_X    = 0.5;
+        const double REL_Y    = 0.5;
+        const double epsilon  = 1.e-6;
+
+        struct bbox {
+            uint64_t left;
+            uint64_t right;
+            uint64_t bottom;
+            uint64_t top;
+        };
+
+        struct particle {
+            double   x;
+            double   y;
+            double   v_x;
+            double   v_y;
+            double   q;
+            // the following fields are used only for verification
+            double   x0;
+            double   y0;
+            int64_t  k;   // determines how many cells particles move per time step in x
+            int64_t  m;   // determines how many cells particles move per time step in y
+        };
+
+        /// linear congruential generator used for the particle draws;
+        /// same multiplier, increment and seed as common/random_draw.c
+        class random_draw {
+            private:
+                uint64_t seed_;
+
+                uint64_t next(uint64_t bound) {
+                    seed_ = 6364136223846793005ULL * seed_ + 1442695040888963407ULL;
+                    return seed_ % bound;
+                }
+
+            public:
+                random_draw(void) : seed_(27182818285ULL) {}
+
+                void reset(void) { seed_ = 27182818285ULL; }
+
+                /// draw an approximately normally (mu>=1) or Bernoulli (mu<1)
+                /// distributed non-negative integer with average mu
+                uint64_t operator()(double mu) {
+                    const double two_pi   = 2.0*3.14159265358979323846;
+                    const double rand_div = 1.0/ULLONG_MAX;
+
+                    if (mu >= 1.0) {
+                        // std dev equal to 15% of average ensures a positive result
+                        const double sigma = mu*0.15;
+                        const double u0 = next(ULLONG_MAX) * rand_div;
+                        const double u1 = next(ULLONG_MAX) * rand_div;
+                        const double z0 = std::sqrt(-2.0*std::log(u0)) * std::cos(two_pi*u1);
+                        return (uint64_t)(z0*sigma + mu + 0.5);
+                    } else {
+                        // pick two integers whose quotient approximates mu
+                        const uint64_t numerator = (uint32_t)(mu*(double)UINT_MAX);
+                        next(UINT_MAX);    // don't use value, but must call next twice
+                        const uint64_t i1 = next(UINT_MAX);
+                        return (uint64_t)(i1 <= numerator);
+                    }
+                }
+        };
+
+        /// grid of fixed charges: dipoles, columns alternating in sign
+        static inline prk::vector<double> initialize_grid(uint64_t L)
+        {
+            prk::vector<double> grid((L+1)*(L+1));
+            for (uint64_t x=0; x<=L; x++) {
+                for (uint64_t y=0; y<=L; y++) {
+                    grid[x*(L+1)+y] = (x%2 == 0) ? Q : -Q;
+                }
+            }
+            return grid;
+        }
+
+        /// completes particle distribution: sets charges and velocities so
+        /// that each particle moves 2*k+1 cells per time step in positive x
+        /// direction and m cells in y
+        static inline void finish_distribution(std::vector<particle> & p)
+        {
+            for (auto & part : p) {
+                const double x_coord = part.x;
+                const double y_coord = part.y;
+                const double rel_x = std::fmod(x_coord,1.0);
+                const double rel_y = std::fmod(y_coord,1.0);
+                const uint64_t x = (uint64_t) x_coord;
+                const double r1_sq = rel_y*rel_y + rel_x*rel_x;
+                const double r2_sq = rel_y*rel_y + (1.0-rel_x)*(1.0-rel_x);
+                const double cos_theta = rel_x/std::sqrt(r1_sq);
+                const double cos_phi   = (1.0-rel_x)/std::sqrt(r2_sq);
+                const double base_charge = 1.0 / ((DT*DT) * Q * (cos_theta/r1_sq + cos_phi/r2_sq));
+
+                part.v_x = 0.0;
+                part.v_y = (double)part.m / DT;
+                // this particle charge assures movement in positive x-direction
+                part.q = (x%2 == 0) ? (2*part.k+1)*base_charge : -1.0*(2*part.k+1)*base_charge;
+                part.x0 = x_coord;
+                part.y0 = y_coord;
+            }
+        }
+
+        /// places particles cell by cell; the weight function gives the
+        /// average number of particles for the cells of column x
+        template <typename WeightFunction>
+        static inline std::vector<particle> initialize_distribution(uint64_t L, int64_t k, int64_t m,
+                                                                    WeightFunction weight)
+        {
+            random_draw dice;
+            std::vector<particle> particles;
+
+            for (uint64_t x=0; x<L; x++) {
+                const double mu = weight(x);
+                for (uint64_t y=0; y<L; y++) {
+                    const uint64_t actual_particles = dice(mu);
+                    for (uint64_t p=0; p<actual_particles; p++) {
+                        particle part;
+                        part.x = x + REL_X;
+                        part.y = y + REL_Y;
+                        part.k = k;
+                        part.m = m;
+                        particles.push_back(part);
+                    }
+                }
+            }
+            finish_distribution(particles);
+            return particles;
+        }
+
+        /// geometric distribution: column x holds a share proportional to rho^x
+        static inline std::vector<particle> initialize_geometric(uint64_t n, uint64_t L, double rho,
+                                                                 int64_t k, int64_t m)
+        {
+            const double A = n * ((1.0-rho) / (1.0-std::pow(rho,(double)L))) / (double)L;
+            return initialize_distribution(L, k, m, [=](uint64_t x) { return A * std::pow(rho,(double)x); });
+        }
+
+        /// sinusoidal distribution (single period)
+        static inline std::vector<particle> initialize_sinusoidal(uint64_t n, uint64_t L,
+                                                                  int64_t k, int64_t m)
+        {
+            const double step = 3.14159265358979323846/L;
+            return initialize_distribution(L, k, m, [=](uint64_t x) {
+                       return 2.0*std::cos(x*step)*std::cos(x*step)*n/(L*L);
+                   });
+        }
+
+        /// linearly decreasing distribution f(x) = -alpha*x + beta, x in [0,1]
+        static inline std::vector<particle> initialize_linear(uint64_t n, uint64_t L,
+                                                              double alpha, double beta,
+                                                              int64_t k, int64_t m)
+        {
+            const double step = 1.0/L;
+            const double total_weight = beta*L - alpha*0.5*step*L*(L-1);
+            return initialize_distribution(L, k, m, [=](uint64_t x) {
+                       return n * ((beta - alpha*step*(double)x)/total_weight)/L;
+                   });
+        }
+
+        /// uniform distribution within a patch of the grid
+        static inline std::vector<particle> initialize_patch(uint64_t n, uint64_t L, const bbox & patch,
+                                                             int64_t k, int64_t m)
+        {
+            const uint64_t total_cells = (patch.right - patch.left+1)*(patch.top - patch.bottom+1);
+            const double particles_per_cell = (double)n/total_cells;
+
+            // draws are made for every cell to keep the generator state
+            // aligned with the C version, which does the same
+            random_draw dice;
+            std::vector<particle> particles;
+            for (uint64_t x=0; x<L; x++) {
+                for (uint64_t y=0; y<L; y++) {
+                    uint64_t actual_particles = dice(particles_per_cell);
+                    if (x<patch.left || x>patch.right || y<patch.bottom || y>patch.top) {
+                        actual_particles = 0;
+                    }
+                    for (uint64_t p=0; p<actual_particles; p++) {
+                        particle part;
+                        part.x = x + REL_X;
+                        part.y = y + REL_Y;
+                        part.k = k;
+                        part.m = m;
+                        particles.push_back(part);
+                    }
+                }
+            }
+            finish_distribution(particles);
+            return particles;
+        }
+
+        static inline bool bad_patch(const bbox & patch, const bbox & patch_contain)
+        {
+            if (patch.left >= patch.right || patch.bottom >= patch.top) return true;
+            if (patch.left   < patch_contain.left   || patch.right > patch_contain.right) return true;
+            if (patch.bottom < patch_contain.bottom || patch.top   > patch_contain.top)   return true;
+            return false;
+        }
+
+        /// Coulomb force between two charges q1 and q2
+        static inline void compute_coulomb(double x_dist, double y_dist, double q1, double q2,
+                                           double & fx, double & fy)
+        {
+            const double r2 = x_dist*x_dist + y_dist*y_dist;
+            const double r  = std::sqrt(r2);
+            const double f_coulomb = q1*q2/r2;
+
+            fx = f_coulomb * x_dist/r;   // f_coulomb * cos_theta
+            fy = f_coulomb * y_dist/r;   // f_coulomb * sin_theta
+        }
+
+        /// total Coulomb force on a particle from the four charges at the
+        /// corners of its cell
+        static inline void compute_total_force(double p_x, double p_y, double p_q,
+                                               uint64_t L, const double * RESTRICT grid,
+                                               double & fx, double & fy)
+        {
+            const uint64_t x = (uint64_t) std::floor(p_x);
+            const uint64_t y = (uint64_t) std::floor(p_y);
+            const double rel_x = p_x - x;
+            const double rel_y = p_y - y;
+
+            double tmp_fx, tmp_fy;
+            double res_x(0), res_y(0);
+
+            // force from top-left charge
+            compute_coulomb(rel_x, rel_y, p_q, grid[x*(L+1)+y], tmp_fx, tmp_fy);
+            res_x += tmp_fx;
+            res_y += tmp_fy;
+
+            // force from bottom-left charge
+            compute_coulomb(rel_x, 1.0-rel_y, p_q, grid[x*(L+1)+y+1], tmp_fx, tmp_fy);
+            res_x += tmp_fx;
+            res_y -= tmp_fy;
+
+            // force from top-right charge
+            compute_coulomb(1.0-rel_x, rel_y, p_q, grid[(x+1)*(L+1)+y], tmp_fx, tmp_fy);
+            res_x -= tmp_fx;
+            res_y += tmp_fy;
+
+            // force from bottom-right charge
+            compute_coulomb(1.0-rel_x, 1.0-rel_y, p_q, grid[(x+1)*(L+1)+y+1], tmp_fx, tmp_fy);
+            res_x -= tmp_fx;
+            res_y -= tmp_fy;
+
+            fx = res_x;
+            fy = res_y;
+        }
+
+        /// verifies the final position of a particle against its
+        /// closed-form trajectory
+        static inline bool verify_particle(const particle & p, uint64_t iterations,
+                                           const double * RESTRICT grid, uint64_t L)
+        {
+            const uint64_t x = (uint64_t) p.x0;
+            const uint64_t y = (uint64_t) p.y0;
+
+            // according to initial location and charge determine the direction of displacements
+            const double disp    = (double)(iterations+1)*(2*p.k+1);
+            const double x_final = ((p.q * grid[x*(L+1)+y]) > 0) ? p.x0+disp : p.x0-disp;
+            const double y_final = p.y0 + p.m * (double)(iterations+1);
+
+            // apply periodicity, making sure we never mod a negative value
+            const double x_periodic = std::fmod(x_final+(double)(iterations+1)*(2*p.k+1)*L, (double)L);
+            const double y_periodic = std::fmod(y_final+(double)(iterations+1)*std::llabs(p.m)*L, (double)L);
+
+            return !(std::fabs(p.x - x_periodic) > epsilon || std::fabs(p.y - y_periodic) > epsilon);
+        }
+
+    } // pic namespace
+
+} // prk namespace
+
+#endif /* PRK_PIC_H */
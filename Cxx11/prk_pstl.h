@@ -53,7 +53,145 @@ namespace exec = std::execution;
        ( (__GNUC__ >= 8) || (__GNUC__ == 7) && (__GNUC_MINOR__ >= 2) )
 #  include <parallel/algorithm>
 #  include <parallel/numeric>
+#  define PRK_PSTL_HAVE_GNU_PAR 1
 # endif
+# if defined(USE_INTEL_PSTL) || ( defined(__GNUC__) && (__GNUC__ >= 9) )
+#  define PRK_PSTL_HAVE_EXEC 1
+# endif
+#endif
+
+namespace prk {
+    namespace PSTL {
+
+        // Runtime policy surface: PRK_PSTL_POLICY=seq|unseq|par|par_unseq
+        // selects the execution policy without a rebuild, and backend()
+        // names what the parallel policies actually dispatch to, because
+        // a toolchain that silently maps them to serial otherwise produces
+        // plausible-looking slow numbers.
+        enum class policy { seq, unseq, par, par_unseq };
+
+        static inline policy get_policy(policy default_policy = policy::par_unseq)
+        {
+            const char * e = std::getenv("PRK_PSTL_POLICY");
+            if (e != nullptr) {
+                const std::string s(e);
+                if (s=="seq")       return policy::seq;
+                if (s=="unseq")     return policy::unseq;
+                if (s=="par")       return policy::par;
+                if (s=="par_unseq") return policy::par_unseq;
+                std::cout << "WARNING: unknown execution policy \"" << s
+                          << "\" (seq|unseq|par|par_unseq); using the kernel default" << std::endl;
+            }
+            return default_policy;
+        }
+
+        static inline const char * policy_name(policy p)
+        {
+            switch (p) {
+                case policy::seq:   return "seq";
+                case policy::unseq: return "unseq";
+                case policy::par:   return "par";
+                default:            return "par_unseq";
+            }
+        }
+
+        // the components of a policy for nested loops: the outer loop
+        // carries the parallelism, the inner loop the vectorization
+        static inline policy outer(policy p)
+        {
+            return (p==policy::par || p==policy::par_unseq) ? policy::par : policy::seq;
+        }
+
+        static inline policy inner(policy p)
+        {
+            return (p==policy::unseq || p==policy::par_unseq) ? policy::unseq : policy::seq;
+        }
+
+        // cached variants for generated code that cannot thread the
+        // selection through its fixed signatures
+        static inline policy outer(void)
+        {
+            static const policy p = outer(get_policy());
+            return p;
+        }
+
+        static inline policy inner(void)
+        {
+            static const policy p = inner(get_policy());
+            return p;
+        }
+
+        static inline const char * backend(void)
+        {
+#if defined(PRK_PSTL_HAVE_EXEC)
+# if defined(_GLIBCXX_USE_TBB_PAR_BACKEND)
+#  if _GLIBCXX_USE_TBB_PAR_BACKEND
+            return "TBB";
+#  else
+            return "SERIAL - parallel policies run sequentially!";
+#  endif
+# elif defined(_PSTL_PAR_BACKEND_TBB) || defined(__PSTL_PAR_BACKEND_TBB)
+            return "TBB";
+# elif defined(_PSTL_PAR_BACKEND_OPENMP)
+            return "OpenMP";
+# elif defined(_PSTL_PAR_BACKEND_SERIAL) || defined(__PSTL_PAR_BACKEND_SERIAL)
+            return "SERIAL - parallel policies run sequentially!";
+# else
+            return "unknown";
+# endif
+#elif defined(PRK_PSTL_HAVE_GNU_PAR)
+            return "GNU parallel mode (OpenMP)";
+#else
+            return "none - plain C++ STL, sequential";
+#endif
+        }
+
+        template <typename Iterator, typename Function>
+        inline void for_each(policy p, Iterator first, Iterator last, Function f)
+        {
+#if defined(PRK_PSTL_HAVE_EXEC)
+            switch (p) {
+                case policy::seq:   std::for_each(exec::seq,       first, last, f); break;
+                case policy::unseq: std::for_each(exec::unseq,     first, last, f); break;
+                case policy::par:   std::for_each(exec::par,       first, last, f); break;
+                default:            std::for_each(exec::par_unseq, first, last, f); break;
+            }
+#elif defined(PRK_PSTL_HAVE_GNU_PAR)
+            // parallel mode has no policy argument: the parallel policies
+            // dispatch to it, the rest to the sequential algorithm
+            if (p==policy::par || p==policy::par_unseq) {
+                __gnu_parallel::for_each(first, last, f);
+            } else {
+                std::for_each(first, last, f);
+            }
+#else
+            std::for_each(first, last, f);
 #endif
+        }
+
+        template <typename Iterator, typename OutputIterator, typename Function>
+        inline void transform(policy p, Iterator first, Iterator last, OutputIterator out, Function f)
+        {
+#if defined(PRK_PSTL_HAVE_EXEC)
+            switch (p) {
+                case policy::seq:   std::transform(exec::seq,       first, last, out, f); break;
+                case policy::unseq: std::transform(exec::unseq,     first, last, out, f); break;
+                case policy::par:   std::transform(exec::par,       first, last, out, f); break;
+                default:            std::transform(exec::par_unseq, first, last, out, f); break;
+            }
+#elif defined(PRK_PSTL_HAVE_GNU_PAR)
+            if (p==policy::par || p==policy::par_unseq) {
+                __gnu_parallel::transform(first, last, out, f);
+            } else {
+                std::transform(first, last, out, f);
+            }
+#else
+            std::transform(first, last, out, f);
+#endif
+        }
+
+    } // PSTL namespace
+
+} // prk namespace
 
 #endif /* PRK_PSTL_H */
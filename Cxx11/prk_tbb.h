@@ -50,6 +50,105 @@
 //#  warning AUTO
    tbb::auto_partitioner tbb_partitioner;
 # endif
+
+namespace prk {
+    namespace TBB {
+
+        // Runtime scheduling surface: PRK_TBB_PARTITIONER=auto|simple|static|affinity
+        // overrides the compile-time selection above and PRK_TBB_GRAINSIZE
+        // sets the blocked-range grainsize, so partitioner and chunk-size
+        // sweeps do not need one build per point.
+        enum class partitioner { auto_, simple, static_, affinity };
+
+        static inline partitioner get_partitioner(void)
+        {
+            const char * e = std::getenv("PRK_TBB_PARTITIONER");
+            if (e != nullptr) {
+                const std::string s(e);
+                if (s=="auto")     return partitioner::auto_;
+                if (s=="simple")   return partitioner::simple;
+                if (s=="static")   return partitioner::static_;
+                if (s=="affinity") return partitioner::affinity;
+                std::cout << "WARNING: unknown TBB partitioner \"" << s
+                          << "\" (auto|simple|static|affinity); using the built-in default" << std::endl;
+            }
+            // the compile-time selection remains the default
+# if ( PRK_TBB_PARTITIONER == 1)
+            return partitioner::static_;
+# elif ( PRK_TBB_PARTITIONER == 2)
+            return partitioner::affinity;
+# elif ( PRK_TBB_PARTITIONER == 3)
+            return partitioner::simple;
+# else
+            return partitioner::auto_;
+# endif
+        }
+
+        static inline const char * partitioner_name(partitioner p)
+        {
+            switch (p) {
+                case partitioner::simple:   return "simple";
+                case partitioner::static_:  return "static";
+                case partitioner::affinity: return "affinity";
+                default:                    return "auto";
+            }
+        }
+
+        static inline size_t get_grainsize(size_t default_grainsize)
+        {
+            const char * e = std::getenv("PRK_TBB_GRAINSIZE");
+            if (e != nullptr) {
+                const long g = std::atol(e);
+                if (g > 0) return (size_t)g;
+            }
+            return default_grainsize;
+        }
+
+        // The affinity partitioner is stateful - it replays the placement
+        // of earlier invocations - so the caller owns one per loop nest
+        // and passes it in; the other partitioners are constructed on the
+        // spot.
+        template <typename Range, typename Body>
+        inline void parallel_for(const Range & range, const Body & body,
+                                 partitioner p, tbb::affinity_partitioner & ap)
+        {
+            switch (p) {
+                case partitioner::simple:
+                    tbb::parallel_for(range, body, tbb::simple_partitioner());
+                    break;
+                case partitioner::static_:
+                    tbb::parallel_for(range, body, tbb::static_partitioner());
+                    break;
+                case partitioner::affinity:
+                    tbb::parallel_for(range, body, ap);
+                    break;
+                default:
+                    tbb::parallel_for(range, body, tbb::auto_partitioner());
+                    break;
+            }
+        }
+
+        template <typename Range, typename T, typename Body, typename Reduction>
+        inline T parallel_reduce(const Range & range, const T & identity,
+                                 const Body & body, const Reduction & reduction,
+                                 partitioner p, tbb::affinity_partitioner & ap)
+        {
+            switch (p) {
+                case partitioner::simple:
+                    return tbb::parallel_reduce(range, identity, body, reduction, tbb::simple_partitioner());
+                case partitioner::static_:
+                    return tbb::parallel_reduce(range, identity, body, reduction, tbb::static_partitioner());
+                case partitioner::affinity:
+                    return tbb::parallel_reduce(range, identity, body, reduction, ap);
+                default:
+                    return tbb::parallel_reduce(range, identity, body, reduction, tbb::auto_partitioner());
+            }
+        }
+
+    } // TBB namespace
+
+} // prk namespace
+
 #endif
 
 #endif /* PRK_TBB_H */
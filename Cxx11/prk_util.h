@@ -49,6 +49,8 @@
 #endif
 
 #include <string>
+#include <sstream>
+#include <fstream>
 #include <iostream>
 #include <iomanip> // std::setprecision
 #include <exception>
@@ -63,6 +65,19 @@
 #include <atomic>
 #include <numeric>
 #include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <cstring>
+
+// These headers are busted with NVCC and GCC 5.4.0
+// The <future> header is busted with Cray C++ 8.6.1.
+#if !defined(__NVCC__) && !defined(_CRAYC)
+#include <thread>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <queue>
+#endif
 
 #include "prk_simd.h"
 
@@ -89,9 +104,194 @@
 #define PREBUILD_KERNEL 1
 #endif
 
+#if defined(__linux__)
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sched.h>
+#if defined(__has_include)
+# if __has_include(<linux/perf_event.h>)
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <cstring>
+#  define PRK_HAVE_PERF_EVENT 1
+# endif
+#endif
+#endif
+
 namespace prk {
 
-    int get_alignment(void)
+    // Memory placement policy for benchmark arrays on NUMA systems.
+    // Default is first-touch: when compiled with OpenMP, prk::vector
+    // initializes in parallel so pages land on the socket of the thread
+    // that will use them.  Interleave spreads pages round-robin over all
+    // NUMA nodes, which is sometimes preferable for irregular kernels.
+    enum class numa_policy { firsttouch, interleave };
+
+    static inline numa_policy get_numa_policy(void)
+    {
+        const char* temp = std::getenv("PRK_NUMA_POLICY");
+        if (temp!=nullptr && (std::string(temp)=="interleave" || std::string(temp)=="INTERLEAVE")) {
+            return numa_policy::interleave;
+        }
+        return numa_policy::firsttouch;
+    }
+
+    // Apply MPOL_INTERLEAVE to [ptr,ptr+bytes) over all NUMA nodes.
+    // Uses the raw mbind syscall so that we do not depend on libnuma;
+    // silently does nothing where the syscall is unavailable.
+    static inline void interleave_pages(void * ptr, size_t bytes)
+    {
+#if defined(__linux__) && defined(SYS_mbind)
+        const int MPOL_INTERLEAVE_ = 3;
+        const unsigned long MPOL_MF_MOVE_ = 2;
+        // all-ones mask covers every node the process is allowed to use
+        unsigned long nodemask = ~0UL;
+        syscall(SYS_mbind, ptr, bytes, MPOL_INTERLEAVE_,
+                &nodemask, sizeof(nodemask)*CHAR_BIT, MPOL_MF_MOVE_);
+#endif
+    }
+
+    // Seconds from process exec to the call, from the kernel's record of
+    // the process start time, so static initialization and device or JIT
+    // context creation that ran before main are included.  Returns a
+    // negative value where /proc is not available.
+    static inline double startup_time(void)
+    {
+#if defined(__linux__)
+        std::ifstream stat("/proc/self/stat");
+        std::string line;
+        if (std::getline(stat, line)) {
+            // the comm field may contain spaces; fields resume after ')'
+            const size_t paren = line.rfind(')');
+            if (paren != std::string::npos) {
+                std::istringstream rest(line.substr(paren+1));
+                std::string field;
+                // start time since boot is field 22 of the stat line
+                for (int f=3; f<=22; f++) {
+                    if (!(rest >> field)) return -1.0;
+                }
+                const double start_ticks = std::strtod(field.c_str(), nullptr);
+                double uptime;
+                std::ifstream up("/proc/uptime");
+                if (up >> uptime) {
+                    return uptime - start_ticks / sysconf(_SC_CLK_TCK);
+                }
+            }
+        }
+#endif
+        return -1.0;
+    }
+
+    // PRK_FAST_START=1 defers non-essential setup (device diagnostics and
+    // similar cold-start work) for launch-dominated usage; the startup
+    // time line shows what it buys.
+    static inline bool fast_start(void)
+    {
+        const char * e = std::getenv("PRK_FAST_START");
+        return (e!=NULL && std::atoi(e)!=0);
+    }
+
+    // Hugepage backing for benchmark arrays, to separate TLB effects from
+    // cache effects at large problem sizes.  PRK_HUGEPAGES=transparent asks
+    // the kernel for THP via madvise; PRK_HUGEPAGES=explicit maps the arrays
+    // with MAP_HUGETLB and falls back to transparent if no hugepages are
+    // reserved.  The page size in effect is printed once so that runs are
+    // comparable.
+    enum class hugepage_mode { none, transparent, explicit_ };
+
+    static inline hugepage_mode get_hugepage_mode(void)
+    {
+        const char* temp = std::getenv("PRK_HUGEPAGES");
+        if (temp!=nullptr) {
+            const std::string s(temp);
+            if (s=="transparent" || s=="thp")  return hugepage_mode::transparent;
+            if (s=="explicit"    || s=="mmap") return hugepage_mode::explicit_;
+        }
+        return hugepage_mode::none;
+    }
+
+#if defined(__linux__)
+    // bookkeeping for explicitly mapped allocations, so prk::free can munmap
+    static inline std::list<std::pair<void*,size_t>> & mmap_allocations(void)
+    {
+        static std::list<std::pair<void*,size_t>> l;
+        return l;
+    }
+#endif
+
+    static inline void report_page_size(size_t bytes, const char * how)
+    {
+        static bool reported = false;
+        if (!reported) {
+            std::cout << "Page size            = " << bytes << " (" << how << ")" << std::endl;
+            reported = true;
+        }
+    }
+
+    // Out-of-core mode: PRK_OOC_DIR names a directory whose storage backs
+    // the benchmark arrays, for problem sizes that exceed RAM.
+    static inline const char * ooc_dir(void)
+    {
+        return std::getenv("PRK_OOC_DIR");
+    }
+
+#if defined(__linux__)
+    // File-backed array for out-of-core runs: the data lives in an
+    // unlinked scratch file and is demand-paged, so matrices larger than
+    // memory degrade into storage bandwidth instead of an OOM kill.
+    // will_need/done_with wrap madvise so a tiled kernel can prefetch the
+    // band it is about to touch and drop the one it has finished; dirty
+    // pages of the shared mapping are written back, never lost.
+    template <typename T>
+    class filemap {
+
+        private:
+            T * data_ = nullptr;
+            size_t size_ = 0;
+            int fd_ = -1;
+
+        public:
+            filemap(const std::string & dir, const char * name, size_t n) : size_(n) {
+                const std::string path = dir + "/prk." + name + "." + std::to_string(getpid());
+                fd_ = open(path.c_str(), O_RDWR|O_CREAT|O_TRUNC, 0600);
+                if (fd_ < 0) throw "ERROR: could not create backing file in PRK_OOC_DIR";
+                // the file is reclaimed even on abnormal exit
+                unlink(path.c_str());
+                if (ftruncate(fd_, n*sizeof(T)) != 0) throw "ERROR: could not size backing file";
+                void * p = mmap(nullptr, n*sizeof(T), PROT_READ|PROT_WRITE, MAP_SHARED, fd_, 0);
+                if (p == MAP_FAILED) throw "ERROR: could not map backing file";
+                data_ = static_cast<T*>(p);
+            }
+
+            ~filemap() {
+                if (data_) munmap(data_, size_*sizeof(T));
+                if (fd_ >= 0) close(fd_);
+            }
+
+            filemap(const filemap &) = delete;
+            filemap & operator=(const filemap &) = delete;
+
+            T & operator[](size_t n) { return data_[n]; }
+            const T & operator[](size_t n) const { return data_[n]; }
+            T * data(void) { return data_; }
+            T * begin(void) { return data_; }
+            T * end(void) { return data_+size_; }
+            size_t size(void) const { return size_; }
+
+            void advise(size_t lo, size_t n, int adv) const {
+                const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+                const size_t b0 = (lo*sizeof(T)) & ~(page-1);
+                const size_t b1 = std::min((lo+n)*sizeof(T), size_*sizeof(T));
+                if (b1 > b0) madvise((char *)data_+b0, b1-b0, adv);
+            }
+            void will_need(size_t lo, size_t n) const { advise(lo, n, MADV_WILLNEED); }
+            void done_with(size_t lo, size_t n) const { advise(lo, n, MADV_DONTNEED); }
+    };
+#endif
+
+    static inline int get_alignment(void)
     {
         /* a := alignment */
 #ifdef PRK_ALIGNMENT
@@ -105,6 +305,95 @@ namespace prk {
         return a;
     }
 
+    // Bump arena backed by one large reservation, enabled by setting
+    // PRK_ARENA to the reservation size (K/M/G suffixes accepted).
+    // prk::malloc serves requests from the arena while it has room and
+    // prk::free is a no-op for arena pointers, so sweep and suite runs
+    // that allocate per configuration reuse the same (hugepage-backed,
+    // when requested) pages instead of paying the allocator and page
+    // faults every time.  Kernel-visible APIs are unchanged.
+    class arena {
+
+        private:
+            char * base_ = nullptr;
+            size_t capacity_ = 0;
+            size_t offset_ = 0;
+            bool tried_ = false;
+
+            void initialize(void) {
+                tried_ = true;
+                const char * e = std::getenv("PRK_ARENA");
+                if (e == nullptr) return;
+                char * end = nullptr;
+                size_t bytes = std::strtoul(e, &end, 10);
+                if (bytes == 0) return;
+                if (end != nullptr) {
+                    if (*end=='K' || *end=='k') bytes <<= 10;
+                    if (*end=='M' || *end=='m') bytes <<= 20;
+                    if (*end=='G' || *end=='g') bytes <<= 30;
+                }
+#if defined(__linux__)
+                // same backing preference as prk::malloc: explicit
+                // hugepages when reserved, else transparent on request
+                const size_t hugepage = 2097152; /* 2 MiB */
+                const size_t mapped = ((bytes + hugepage - 1) / hugepage) * hugepage;
+                const prk::hugepage_mode hp = prk::get_hugepage_mode();
+                if (hp == prk::hugepage_mode::explicit_) {
+                    void * ptr = mmap(nullptr, mapped, PROT_READ|PROT_WRITE,
+                                      MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0);
+                    if (ptr != MAP_FAILED) {
+                        base_ = static_cast<char*>(ptr);
+                        capacity_ = mapped;
+                        prk::report_page_size(hugepage, "explicit hugepages, arena");
+                        return;
+                    }
+                    // no hugepages reserved - fall through
+                }
+                void * ptr = mmap(nullptr, mapped, PROT_READ|PROT_WRITE,
+                                  MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+                if (ptr == MAP_FAILED) return;
+#if defined(MADV_HUGEPAGE)
+                if (hp != prk::hugepage_mode::none) {
+                    madvise(ptr, mapped, MADV_HUGEPAGE);
+                }
+#endif
+                base_ = static_cast<char*>(ptr);
+                capacity_ = mapped;
+#else
+                base_ = static_cast<char*>(std::malloc(bytes));
+                if (base_ != nullptr) capacity_ = bytes;
+#endif
+            }
+
+        public:
+            static arena & instance(void) {
+                static arena a;
+                return a;
+            }
+
+            // null when the arena is disabled or exhausted; the caller
+            // falls back to a regular allocation
+            void * allocate(size_t bytes, size_t alignment) {
+                if (!tried_) initialize();
+                if (base_ == nullptr) return nullptr;
+                const size_t aligned = (offset_ + alignment - 1) & ~(alignment - 1);
+                if (aligned + bytes > capacity_) return nullptr;
+                offset_ = aligned + bytes;
+                return base_ + aligned;
+            }
+
+            bool contains(const void * p) const {
+                return (base_ != nullptr) &&
+                       (p >= base_) && (p < base_ + capacity_);
+            }
+
+            // rewind so the next configuration reuses the same pages;
+            // only valid once all arena-served buffers are dead
+            static void reset(void) {
+                instance().offset_ = 0;
+            }
+    };
+
 #if defined(__INTEL_COMPILER)
 
     template <typename T>
@@ -112,12 +401,15 @@ namespace prk {
     {
         const int alignment = prk::get_alignment();
         const size_t bytes = n * sizeof(T);
+        void * ap = prk::arena::instance().allocate(bytes, alignment);
+        if (ap != nullptr) return (T*)ap;
         return (T*)_mm_malloc( bytes, alignment);
     }
 
     template <typename T>
     void free(T * p)
     {
+        if (prk::arena::instance().contains(p)) return;
         _mm_free(p);
         p = nullptr;
     }
@@ -130,6 +422,9 @@ namespace prk {
         const int alignment = prk::get_alignment();
         const size_t bytes = n * sizeof(T);
 
+        void * ap = prk::arena::instance().allocate(bytes, alignment);
+        if (ap != nullptr) return (T*)ap;
+
         // We cannot use C11 aligned_alloc on Mac.
         // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=69680 */
         // GCC claims to be C11 without knowing if glibc is compliant...
@@ -156,9 +451,37 @@ namespace prk {
 
 #else
 
+#if defined(__linux__)
+        const prk::hugepage_mode hp = prk::get_hugepage_mode();
+        if (hp == prk::hugepage_mode::explicit_) {
+            // round up to the (default) hugepage granularity
+            const size_t hugepage = 2097152; /* 2 MiB */
+            const size_t mapped = ((bytes + hugepage - 1) / hugepage) * hugepage;
+            void * ptr = mmap(nullptr, mapped, PROT_READ|PROT_WRITE,
+                              MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0);
+            if (ptr != MAP_FAILED) {
+                prk::mmap_allocations().push_back({ptr,mapped});
+                prk::report_page_size(hugepage, "explicit hugepages");
+                return (T*)ptr;
+            }
+            // no hugepages reserved - fall through to the transparent path
+        }
+#endif
+
         T * ptr = nullptr;
         const int ret = posix_memalign((void**)&ptr,alignment,bytes);
         if (ret!=0) ptr = nullptr;
+
+#if defined(__linux__)
+        if (ptr != nullptr && hp != prk::hugepage_mode::none) {
+#if defined(MADV_HUGEPAGE)
+            madvise(ptr, bytes, MADV_HUGEPAGE);
+            prk::report_page_size(2097152, "transparent hugepages requested");
+#endif
+        } else if (ptr != nullptr) {
+            prk::report_page_size(sysconf(_SC_PAGESIZE), "base pages");
+        }
+#endif
         return ptr;
 
 #endif
@@ -168,6 +491,17 @@ namespace prk {
     template <typename T>
     void free(T * p)
     {
+        if (prk::arena::instance().contains(p)) return;
+#if defined(__linux__)
+        for (auto it = prk::mmap_allocations().begin(); it != prk::mmap_allocations().end(); ++it) {
+            if (it->first == (void*)p) {
+                munmap(it->first, it->second);
+                prk::mmap_allocations().erase(it);
+                p = nullptr;
+                return;
+            }
+        }
+#endif
         std::free(p);
         p = nullptr;
     }
@@ -190,6 +524,13 @@ namespace prk {
 #endif
     }
 
+    // Compiling with -DPRK_DEBUG turns on bounds checking in
+    // prk::vector::operator[] and poisons uninitialized allocations, so
+    // a broken new kernel variant dies at the faulting index (or fails
+    // validation with NaNs) instead of silently corrupting memory.  In
+    // regular builds the checks do not exist - operator[] is the same
+    // unchecked dereference as before, so the measured path is untouched.
+    // Raw access through data()/begin()/end() is never checked.
     template <typename T>
     class vector {
 
@@ -197,17 +538,54 @@ namespace prk {
             T * data_;
             size_t size_;
 
+#if defined(PRK_DEBUG)
+            void bounds_check(size_t n) const {
+                if (n >= this->size_) {
+                    std::cerr << "PRK_DEBUG: index " << n
+                              << " out of range [0," << this->size_ << ")"
+                              << std::endl;
+                    std::abort();
+                }
+            }
+
+            // use-before-init reads signaling NaN (floating point) or an
+            // 0xA5 byte pattern instead of whatever the allocator left
+            void poison(void) {
+                if (std::is_floating_point<T>::value) {
+                    for (size_t i=0; i<this->size_; ++i)
+                        this->data_[i] = static_cast<T>(std::numeric_limits<double>::signaling_NaN());
+                } else {
+                    std::memset(this->data_, 0xA5, this->size_*sizeof(T));
+                }
+            }
+#endif
+
         public:
 
             vector(size_t n) {
                 //this->data_ = new T[n];
                 this->data_ = prk::malloc<T>(n);
                 this->size_ = n;
+                if (prk::get_numa_policy() == prk::numa_policy::interleave) {
+                    prk::interleave_pages(this->data_, n*sizeof(T));
+                }
+#if defined(PRK_DEBUG)
+                this->poison();
+#endif
             }
 
             vector(size_t n, T v) {
                 //this->data_ = new T[n];
                 this->data_ = prk::malloc<T>(n);
+                if (prk::get_numa_policy() == prk::numa_policy::interleave) {
+                    prk::interleave_pages(this->data_, n*sizeof(T));
+                }
+                // First-touch initialization: with OpenMP the static schedule
+                // here matches the partitioning of the kernel loops, so each
+                // page faults in on the socket that will access it.
+#if defined(USE_OPENMP) && defined(_OPENMP)
+                OMP( parallel for schedule(static) )
+#endif
                 for (size_t i=0; i<n; ++i) this->data_[i] = v;
                 this->size_ = n;
             }
@@ -217,8 +595,65 @@ namespace prk {
                 prk::free<T>(this->data_);
             }
 
-            void operator~() {
-                this->~vector();
+            vector(const vector & other) {
+                this->data_ = prk::malloc<T>(other.size_);
+                this->size_ = other.size_;
+                std::copy(other.data_, other.data_+other.size_, this->data_);
+            }
+
+            vector & operator=(const vector & other) {
+                if (this != &other) {
+                    if (this->size_ != other.size_) {
+                        prk::free<T>(this->data_);
+                        this->data_ = prk::malloc<T>(other.size_);
+                        this->size_ = other.size_;
+                    }
+                    std::copy(other.data_, other.data_+other.size_, this->data_);
+                }
+                return *this;
+            }
+
+            // moved-from vectors hold no allocation; prk::free of the
+            // null pointer in the destructor is harmless
+            vector(vector && other) noexcept {
+                this->data_ = other.data_;
+                this->size_ = other.size_;
+                other.data_ = nullptr;
+                other.size_ = 0;
+            }
+
+            vector & operator=(vector && other) noexcept {
+                if (this != &other) {
+                    prk::free<T>(this->data_);
+                    this->data_ = other.data_;
+                    this->size_ = other.size_;
+                    other.data_ = nullptr;
+                    other.size_ = 0;
+                }
+                return *this;
+            }
+
+            // double-buffered kernels exchange buffers with std::swap,
+            // which costs three pointer moves instead of a deep copy
+            void swap(vector & other) noexcept {
+                std::swap(this->data_, other.data_);
+                std::swap(this->size_, other.size_);
+            }
+
+            // reallocate without initializing: the contents are
+            // indeterminate afterwards, as with the sized constructor
+            void resize(size_t n) {
+                if (n != this->size_) {
+                    prk::free<T>(this->data_);
+                    this->data_ = prk::malloc<T>(n);
+                    this->size_ = n;
+                    if (prk::get_numa_policy() == prk::numa_policy::interleave) {
+                        prk::interleave_pages(this->data_, n*sizeof(T));
+                    }
+#if defined(PRK_DEBUG)
+                    this->poison();
+#endif
+                }
             }
 
             T * data() {
@@ -240,10 +675,16 @@ namespace prk {
 #endif
 
             T const & operator[] (size_t n) const {
+#if defined(PRK_DEBUG)
+                this->bounds_check(n);
+#endif
                 return this->data_[n];
             }
 
             T & operator[] (size_t n) {
+#if defined(PRK_DEBUG)
+                this->bounds_check(n);
+#endif
                 return this->data_[n];
             }
 
@@ -266,6 +707,1017 @@ namespace prk {
 #endif
     };
 
+    // Hardware-counter sampling around the timed region, enabled by
+    // setting PRK_COUNTERS.  Counts cycles, instructions, LLC misses,
+    // dTLB load misses and page faults through perf_event_open and
+    // derives a roofline-style summary from them together with the
+    // kernel's own flop/byte counts, so one run shows whether a
+    // regression is bandwidth or compute bound, and the TLB/paging
+    // numbers show whether it would benefit from hugepages.  Counts
+    // cover the calling thread.  All methods are no-ops when disabled
+    // or unsupported.
+    class counters {
+
+        private:
+            bool enabled_;
+#if defined(PRK_HAVE_PERF_EVENT)
+            int fd_[5];
+            long long value_[5];
+
+            static int open_event(uint32_t type, uint64_t config) {
+                struct perf_event_attr pe;
+                std::memset(&pe, 0, sizeof(pe));
+                pe.type = type;
+                pe.size = sizeof(pe);
+                pe.config = config;
+                pe.disabled = 1;
+                pe.exclude_kernel = 1;
+                pe.exclude_hv = 1;
+                return syscall(SYS_perf_event_open, &pe, 0, -1, -1, 0);
+            }
+#endif
+
+        public:
+            // force enables the counters regardless of the environment,
+            // for callers that measure unconditionally (page comparison)
+            counters(bool force = false) {
+                enabled_ = force || (std::getenv("PRK_COUNTERS") != nullptr);
+#if defined(PRK_HAVE_PERF_EVENT)
+                for (int i=0; i<5; i++) { fd_[i] = -1; value_[i] = 0; }
+                if (enabled_) {
+                    fd_[0] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+                    fd_[1] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+                    fd_[2] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+                    fd_[3] = open_event(PERF_TYPE_HW_CACHE,
+                                        PERF_COUNT_HW_CACHE_DTLB |
+                                        (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+                    fd_[4] = open_event(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS);
+                    if (fd_[0] < 0 && fd_[4] < 0) {
+                        std::cout << "WARNING: perf events unavailable (check perf_event_paranoid); counters disabled" << std::endl;
+                        enabled_ = false;
+                    } else if (fd_[0] < 0) {
+                        // software events often remain permitted when the
+                        // hardware PMU is restricted, so keep those going
+                        std::cout << "WARNING: hardware perf events unavailable; reporting software events only" << std::endl;
+                    }
+                }
+#else
+                if (enabled_) {
+                    std::cout << "WARNING: PRK_COUNTERS set but perf events are not supported here" << std::endl;
+                    enabled_ = false;
+                }
+#endif
+            }
+
+            ~counters() {
+#if defined(PRK_HAVE_PERF_EVENT)
+                for (int i=0; i<5; i++) if (fd_[i] >= 0) close(fd_[i]);
+#endif
+            }
+
+            void start(void) {
+#if defined(PRK_HAVE_PERF_EVENT)
+                if (!enabled_) return;
+                for (int i=0; i<5; i++) {
+                    if (fd_[i] >= 0) {
+                        ioctl(fd_[i], PERF_EVENT_IOC_RESET, 0);
+                        ioctl(fd_[i], PERF_EVENT_IOC_ENABLE, 0);
+                    }
+                }
+#endif
+            }
+
+            void stop(void) {
+#if defined(PRK_HAVE_PERF_EVENT)
+                if (!enabled_) return;
+                for (int i=0; i<5; i++) {
+                    if (fd_[i] >= 0) {
+                        ioctl(fd_[i], PERF_EVENT_IOC_DISABLE, 0);
+                        if (read(fd_[i], &value_[i], sizeof(long long)) != sizeof(long long)) {
+                            value_[i] = 0;
+                        }
+                    }
+                }
+#endif
+            }
+
+            // counts read after the last stop(); zero when the
+            // corresponding event could not be opened
+            long long dtlb_misses(void) const {
+#if defined(PRK_HAVE_PERF_EVENT)
+                return value_[3];
+#else
+                return 0;
+#endif
+            }
+
+            long long page_faults(void) const {
+#if defined(PRK_HAVE_PERF_EVENT)
+                return value_[4];
+#else
+                return 0;
+#endif
+            }
+
+            // time is the total time of the counted region; nflops/nbytes
+            // are the kernel's nominal totals for that region (0 if n/a);
+            // a nonzero iteration count adds per-iteration TLB/paging rates
+            void report(double time, double nflops, double nbytes, long iterations = 0) {
+                if (!enabled_ || time <= 0.) return;
+#if defined(PRK_HAVE_PERF_EVENT)
+                const double cycles = static_cast<double>(value_[0]);
+                const double instrs = static_cast<double>(value_[1]);
+                const double misses = static_cast<double>(value_[2]);
+                const double line = 64.0; // bytes per cache line
+                if (fd_[0] >= 0) {
+                std::cout << "Counters: cycles = " << value_[0]
+                          << ", instructions = " << value_[1]
+                          << " (IPC " << (cycles>0. ? instrs/cycles : 0.) << ")"
+                          << ", LLC misses = " << value_[2] << std::endl;
+                std::cout << "Measured DRAM traffic (GB): " << 1.e-9*misses*line
+                          << " -> " << 1.e-9*misses*line/time << " GB/s" << std::endl;
+                }
+                if (fd_[3] >= 0 || fd_[4] >= 0) {
+                    std::cout << "TLB and paging: dTLB load misses = " << value_[3]
+                              << ", page faults = " << value_[4];
+                    if (iterations > 0) {
+                        std::cout << " (" << value_[3]/static_cast<double>(iterations)
+                                  << " and " << value_[4]/static_cast<double>(iterations)
+                                  << " per iteration)";
+                    }
+                    std::cout << std::endl;
+                }
+                if (nbytes > 0.) {
+                    std::cout << "Nominal bandwidth (GB/s): " << 1.e-9*nbytes/time;
+                    if (nflops > 0.) {
+                        std::cout << ", arithmetic intensity (F/B): " << nflops/nbytes;
+                    }
+                    std::cout << std::endl;
+                }
+                if (nflops > 0.) {
+                    std::cout << "Achieved GFlop/s: " << 1.e-9*nflops/time << std::endl;
+                }
+                // classify against machine peaks when the caller supplies them
+                const char * peak_gbs = std::getenv("PRK_PEAK_GBS");
+                const char * peak_gfs = std::getenv("PRK_PEAK_GFLOPS");
+                if (fd_[0] >= 0 && peak_gbs != nullptr && peak_gfs != nullptr && nbytes > 0.) {
+                    const double bw_frac = (1.e-9*misses*line/time) / std::atof(peak_gbs);
+                    const double fl_frac = (nflops > 0.) ? (1.e-9*nflops/time) / std::atof(peak_gfs) : 0.;
+                    std::cout << "Roofline: " << 100.*bw_frac << "% of peak bandwidth, "
+                              << 100.*fl_frac << "% of peak compute -> "
+                              << (bw_frac >= fl_frac ? "bandwidth" : "compute")
+                              << " bound" << std::endl;
+                }
+#endif
+            }
+    };
+
+    // Adaptive iteration control, enabled by PRK_AUTO_ITERATIONS=<tol>.
+    // Instead of running the requested iteration count, the kernel stops
+    // once the 95% confidence interval of the mean iteration time is
+    // within the relative tolerance, or when the hard time cap
+    // (PRK_AUTO_TIME_CAP seconds, default 30) is reached.  That handles
+    // both slow frequency ramps (one warm-up is not enough) and fast
+    // machines (thousands of fixed iterations waste fleet hours).  The
+    // kernel must rewrite its iteration count with the executed count so
+    // verification stays exact.
+    class adaptive {
+
+        private:
+            bool enabled_;
+            double tol_;
+            double cap_;
+            long n_;
+            double mean_, m2_, total_;
+            static const long min_samples_ = 10;
+
+        public:
+            adaptive() : n_(0), mean_(0.), m2_(0.), total_(0.) {
+                const char * temp = std::getenv("PRK_AUTO_ITERATIONS");
+                enabled_ = (temp != nullptr);
+                tol_ = enabled_ ? std::atof(temp) : 0.;
+                if (tol_ <= 0.) tol_ = 0.01;
+                const char * cap = std::getenv("PRK_AUTO_TIME_CAP");
+                cap_ = (cap != nullptr) ? std::atof(cap) : 30.;
+                if (cap_ <= 0.) cap_ = 30.;
+            }
+
+            bool enabled(void) const {
+                return enabled_;
+            }
+
+            // forget accumulated statistics (e.g. between measurement phases)
+            void reset(void) {
+                n_ = 0;
+                mean_ = m2_ = total_ = 0.;
+            }
+
+            // Call once per timed iteration; returns true when the loop
+            // should stop.  'completed' excludes the warm-up iteration.
+            bool done(int completed, int requested, double seconds) {
+                if (!enabled_) return (completed >= requested);
+                // Welford running mean/variance of the iteration time
+                n_++;
+                total_ += seconds;
+                const double delta = seconds - mean_;
+                mean_ += delta / n_;
+                m2_ += delta * (seconds - mean_);
+                if (total_ >= cap_) return true;
+                if (n_ < min_samples_) return false;
+                const double sem = std::sqrt( (m2_/n_) / n_ );
+                return (1.96*sem < tol_*mean_);
+            }
+
+            void report(void) const {
+                if (!enabled_ || n_ == 0) return;
+                const double sem = std::sqrt( (m2_/n_) / n_ );
+                std::cout << "Auto-iterations: " << n_ << " iterations, "
+                          << "mean " << mean_ << " s, 95% CI +/- "
+                          << 100.*1.96*sem/mean_ << "%"
+                          << (total_ >= cap_ ? " (time cap reached)" : "")
+                          << std::endl;
+            }
+    };
+
+    // Per-iteration timing statistics, enabled with PRK_TIMING_STATS.
+    // Records every iteration's duration into a preallocated buffer and
+    // reports min/p50/p99/max and the standard deviation alongside the
+    // mean, so a single OS jitter event or DVFS transition is visible
+    // instead of silently skewing the averaged rate.
+    class timing {
+
+        private:
+            bool enabled_;
+            std::vector<double> samples_;
+
+        public:
+            timing(int iterations) {
+                enabled_ = (std::getenv("PRK_TIMING_STATS") != nullptr);
+                if (enabled_ && iterations > 0) samples_.reserve(iterations);
+            }
+
+            bool enabled(void) const {
+                return enabled_;
+            }
+
+            void record(double seconds) {
+                if (enabled_) samples_.push_back(seconds);
+            }
+
+            double percentile(double p) const {
+                if (samples_.empty()) return 0.;
+                std::vector<double> sorted(samples_);
+                std::sort(sorted.begin(), sorted.end());
+                size_t i = static_cast<size_t>(p * (sorted.size()-1) + 0.5);
+                return sorted[i];
+            }
+
+            void report(void) const {
+                if (!enabled_ || samples_.empty()) return;
+                const double n = static_cast<double>(samples_.size());
+                const double mean = prk::reduce(samples_.begin(), samples_.end(), 0.0) / n;
+                double var(0);
+                for (auto s : samples_) var += (s-mean)*(s-mean);
+                var /= n;
+                std::cout << "Iteration timing (s): min " << percentile(0.)
+                          << ", p50 " << percentile(0.5)
+                          << ", p99 " << percentile(0.99)
+                          << ", max " << percentile(1.)
+                          << ", mean " << mean
+                          << ", stddev " << std::sqrt(var)
+                          << " (" << samples_.size() << " samples)" << std::endl;
+            }
+    };
+
+    // Machine-readable results, for fleet runs that should not have to
+    // parse free-text stdout.  Construct one per benchmark, set() the
+    // parameters and final figures, feed iteration() the per-iteration
+    // times, and emit() appends one JSON or CSV record.  Controlled by
+    // PRK_RESULTS=json|csv and (optionally) PRK_RESULTS_FILE; everything
+    // is a no-op when PRK_RESULTS is unset, so default output does not
+    // change.
+    class results {
+
+        private:
+            std::string kernel_;
+            std::string format_;
+            std::list<std::pair<std::string,std::string>> kv_;
+            std::vector<double> iters_;
+
+        public:
+            results(std::string kernel) : kernel_(kernel) {
+                const char * temp = std::getenv("PRK_RESULTS");
+                format_ = (temp!=nullptr) ? temp : "";
+                if (format_ != "json" && format_ != "csv") format_ = "";
+            }
+
+            bool enabled(void) const {
+                return !format_.empty();
+            }
+
+            void set(const std::string & key, const std::string & value) {
+                if (enabled()) kv_.push_back({key,value});
+            }
+
+            template <typename T>
+            void set(const std::string & key, T value) {
+                if (enabled()) {
+                    std::ostringstream os;
+                    os << std::setprecision(10) << value;
+                    kv_.push_back({key,os.str()});
+                }
+            }
+
+            void iteration(double seconds) {
+                if (enabled()) iters_.push_back(seconds);
+            }
+
+            void emit(void) {
+                if (!enabled()) return;
+                const char * path = std::getenv("PRK_RESULTS_FILE");
+                std::ofstream file;
+                if (path != nullptr) file.open(path, std::ios::app);
+                std::ostream & out = (path != nullptr) ? static_cast<std::ostream&>(file) : std::cout;
+                if (format_ == "json") {
+                    out << "{\"kernel\":\"" << kernel_ << "\"";
+                    for (auto & p : kv_) {
+                        out << ",\"" << p.first << "\":" << quote(p.second);
+                    }
+                    out << ",\"iteration_times\":[";
+                    for (size_t i=0; i<iters_.size(); i++) {
+                        out << (i ? "," : "") << std::setprecision(10) << iters_[i];
+                    }
+                    out << "]}" << std::endl;
+                } else {
+                    out << "kernel," << kernel_;
+                    for (auto & p : kv_) {
+                        out << "," << p.first << "," << p.second;
+                    }
+                    for (size_t i=0; i<iters_.size(); i++) {
+                        out << "," << std::setprecision(10) << iters_[i];
+                    }
+                    out << std::endl;
+                }
+            }
+
+        private:
+            // numbers are emitted bare in JSON, everything else quoted
+            static std::string quote(const std::string & s) {
+                char * end = nullptr;
+                std::strtod(s.c_str(), &end);
+                const bool numeric = (end != nullptr && *end == '\0' && !s.empty());
+                return numeric ? s : ("\"" + s + "\"");
+            }
+    };
+
+    // Append-only performance-baseline store with a run-time comparison
+    // mode, so driver and compiler upgrades do not have to be vetted by
+    // diffing stdout by hand.  Construct one per benchmark, set() the
+    // performance-relevant parameters, then check() the final figure of
+    // merit after the solution has validated: PRK_BASELINE=record
+    // appends one record, PRK_BASELINE=compare reads all records with
+    // the same key and flags the run if it is significantly below their
+    // mean.  Records are keyed by kernel, host, compiler, and the set()
+    // parameters, so only runs of the same configuration are compared.
+    // The store defaults to ./prk_baseline.dat and can be moved with
+    // PRK_BASELINE_FILE; everything is a no-op when PRK_BASELINE is
+    // unset.
+    class baseline {
+
+        private:
+            std::string kernel_;
+            std::string mode_;
+            std::string params_;
+
+        public:
+            baseline(std::string kernel) : kernel_(kernel) {
+                const char * temp = std::getenv("PRK_BASELINE");
+                mode_ = (temp!=nullptr) ? temp : "";
+                if (mode_ != "record" && mode_ != "compare") mode_ = "";
+            }
+
+            bool enabled(void) const {
+                return !mode_.empty();
+            }
+
+            template <typename T>
+            void set(const std::string & key, T value) {
+                if (enabled()) {
+                    std::ostringstream os;
+                    os << params_ << key << "=" << value << ";";
+                    params_ = os.str();
+                }
+            }
+
+            void check(const std::string & metric, double value) const {
+                if (!enabled()) return;
+                const char * path = std::getenv("PRK_BASELINE_FILE");
+                const std::string file = (path!=nullptr) ? path : "prk_baseline.dat";
+                const std::string k = key(metric);
+                if (mode_ == "record") {
+                    // the store is append-only; existing records are
+                    // never rewritten
+                    std::ofstream out(file, std::ios::app);
+                    if (!out) {
+                        std::cout << "Baseline: cannot append to " << file << std::endl;
+                        return;
+                    }
+                    out << k << " " << std::setprecision(10) << value << std::endl;
+                    std::cout << "Baseline: recorded " << metric << " " << value
+                              << " in " << file << std::endl;
+                } else {
+                    std::ifstream in(file);
+                    std::vector<double> samples;
+                    std::string line;
+                    while (std::getline(in,line)) {
+                        std::istringstream is(line);
+                        std::string lk;
+                        double lv;
+                        if ((is >> lk >> lv) && lk == k) samples.push_back(lv);
+                    }
+                    if (samples.empty()) {
+                        std::cout << "Baseline: no stored samples for this configuration in "
+                                  << file << std::endl;
+                        return;
+                    }
+                    const double n = static_cast<double>(samples.size());
+                    double mean(0);
+                    for (auto v : samples) mean += v;
+                    mean /= n;
+                    double var(0);
+                    for (auto v : samples) var += (v-mean)*(v-mean);
+                    const double stddev = (samples.size()>1) ? std::sqrt(var/(n-1.)) : 0.0;
+                    // three standard deviations when the spread can be
+                    // estimated, ten percent otherwise; clamped from below
+                    // so a noise-free store does not flag ordinary
+                    // run-to-run jitter
+                    double threshold = (samples.size()>1) ? 3.0*stddev : 0.10*mean;
+                    if (threshold < 0.02*mean) threshold = 0.02*mean;
+                    std::cout << "Baseline: " << metric << " mean " << mean
+                              << " over " << samples.size() << " samples";
+                    if (value < mean - threshold) {
+                        std::cout << "; REGRESSION: " << value << " is "
+                                  << 100.*(mean-value)/mean << "% below baseline" << std::endl;
+                    } else {
+                        std::cout << "; " << value << " is within baseline" << std::endl;
+                    }
+                }
+            }
+
+        private:
+            // one space-free token: kernel|host|compiler|params|metric
+            std::string key(const std::string & metric) const {
+                std::string k = kernel_ + "|" + host() + "|" + compiler()
+                              + "|" + params_ + "|" + metric;
+                for (auto & c : k) {
+                    if (c==' ' || c=='\t') c = '_';
+                }
+                return k;
+            }
+
+            static std::string host(void) {
+#if defined(__linux__)
+                char name[256];
+                if (gethostname(name, sizeof(name)) == 0) {
+                    name[sizeof(name)-1] = '\0';
+                    return std::string(name);
+                }
+#endif
+                const char * env = std::getenv("HOSTNAME");
+                return (env!=nullptr) ? std::string(env) : std::string("unknown");
+            }
+
+            static std::string compiler(void) {
+#if defined(__VERSION__)
+                return std::string(__VERSION__);
+#else
+                return std::string("unknown");
+#endif
+            }
+    };
+
+    // Golden-results store for verification scalars, the numerical
+    // counterpart of the performance baseline above.  Construct one per
+    // kernel, set() the parameters that determine the result, then
+    // check() each verification scalar after it has been computed:
+    // PRK_GOLDEN=record appends the scalar's exact bit pattern,
+    // PRK_GOLDEN=check compares bit-for-bit against the stored record
+    // and reports drift.  Records are keyed by kernel, suite version,
+    // and the set() parameters - deliberately not by host or compiler,
+    // since the point is to detect silent numerical changes from
+    // fast-math or toolchain upgrades that stdout-level validation, with
+    // its tolerance threshold, absorbs.  The store defaults to
+    // ./prk_golden.dat and can be moved with PRK_GOLDEN_FILE; everything
+    // is a no-op when PRK_GOLDEN is unset.
+    class golden {
+
+        private:
+            std::string kernel_;
+            std::string mode_;
+            std::string params_;
+
+        public:
+            golden(std::string kernel) : kernel_(kernel) {
+                const char * temp = std::getenv("PRK_GOLDEN");
+                mode_ = (temp!=nullptr) ? temp : "";
+                if (mode_ != "record" && mode_ != "check") mode_ = "";
+            }
+
+            bool enabled(void) const {
+                return !mode_.empty();
+            }
+
+            template <typename T>
+            void set(const std::string & key, T value) {
+                if (enabled()) {
+                    std::ostringstream os;
+                    os << params_ << key << "=" << value << ";";
+                    params_ = os.str();
+                }
+            }
+
+            void check(const std::string & name, double value) const {
+                if (!enabled()) return;
+                const char * path = std::getenv("PRK_GOLDEN_FILE");
+                const std::string file = (path!=nullptr) ? path : "prk_golden.dat";
+                const std::string k = key(name);
+                uint64_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                if (mode_ == "record") {
+                    std::ofstream out(file, std::ios::app);
+                    if (!out) {
+                        std::cout << "Golden: cannot append to " << file << std::endl;
+                        return;
+                    }
+                    // the bit pattern is authoritative; the decimal form
+                    // is only for human readers of the store
+                    out << k << " " << std::hex << bits << std::dec
+                        << " " << std::setprecision(17) << value << std::endl;
+                    std::cout << "Golden: recorded " << name << " = "
+                              << std::setprecision(17) << value
+                              << " in " << file << std::endl;
+                } else {
+                    std::ifstream in(file);
+                    std::string line;
+                    bool found = false;
+                    while (std::getline(in,line)) {
+                        std::istringstream is(line);
+                        std::string lk;
+                        uint64_t lbits;
+                        if ((is >> lk >> std::hex >> lbits) && lk == k) {
+                            found = true;
+                            if (lbits == bits) {
+                                std::cout << "Golden: " << name
+                                          << " matches stored value bit-for-bit" << std::endl;
+                            } else {
+                                double stored;
+                                std::memcpy(&stored, &lbits, sizeof(stored));
+                                std::cout << "Golden: DRIFT: " << name << " = "
+                                          << std::setprecision(17) << value
+                                          << " differs from stored " << stored
+                                          << " (relative "
+                                          << std::setprecision(3)
+                                          << std::abs(value-stored)/std::max(std::abs(stored),1e-300)
+                                          << ")" << std::endl;
+                            }
+                            break;
+                        }
+                    }
+                    if (!found) {
+                        std::cout << "Golden: no stored " << name
+                                  << " for this configuration in " << file << std::endl;
+                    }
+                }
+            }
+
+        private:
+            // one space-free token: kernel|version|params|name
+            std::string key(const std::string & name) const {
+                // PRKVERSION may be defined as a string or a bare number
+                std::ostringstream v;
+                v << PRKVERSION;
+                std::string k = kernel_ + "|" + v.str() + "|" + params_ + "|" + name;
+                for (auto & c : k) {
+                    if (c==' ' || c=='\t') c = '_';
+                }
+                return k;
+            }
+    };
+
+    // Comma-separated list of thread counts from PRK_THREAD_SWEEP,
+    // e.g. PRK_THREAD_SWEEP=1,2,4,8.  An empty result means no sweep
+    // was requested and the kernel runs once with the ambient setting.
+    static inline std::vector<int> thread_sweep(void)
+    {
+        std::vector<int> counts;
+        const char * e = std::getenv("PRK_THREAD_SWEEP");
+        if (e==NULL) return counts;
+        std::istringstream iss{std::string(e)};
+        std::string token;
+        while (std::getline(iss, token, ',')) {
+            const int t = std::atoi(token.c_str());
+            if (t > 0) counts.push_back(t);
+        }
+        return counts;
+    }
+
+    struct cache_level {
+        std::string name;
+        size_t bytes;
+    };
+
+    // Data and unified cache capacities of cpu0, read from sysfs and
+    // sorted smallest first.  Returns an empty vector when the
+    // information is unavailable (non-Linux systems, restricted /sys).
+    static inline std::vector<cache_level> cache_levels(void)
+    {
+        std::vector<cache_level> levels;
+        for (int index=0; index<16; index++) {
+            const std::string dir = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index);
+            std::ifstream type_file(dir + "/type");
+            if (!type_file.good()) break;
+            std::string type;
+            type_file >> type;
+            if (type == "Instruction") continue;
+            int level(0);
+            std::ifstream(dir + "/level") >> level;
+            std::string size;
+            std::ifstream(dir + "/size") >> size;
+            size_t bytes = std::atol(size.c_str());
+            if (size.find('K') != std::string::npos) bytes <<= 10;
+            if (size.find('M') != std::string::npos) bytes <<= 20;
+            if (level > 0 && bytes > 0) {
+                levels.push_back({"L"+std::to_string(level), bytes});
+            }
+        }
+        std::sort(levels.begin(), levels.end(),
+                  [](const cache_level & a, const cache_level & b) { return a.bytes < b.bytes; });
+        return levels;
+    }
+
+    // Vector lengths that target residency in each detected cache level,
+    // plus one DRAM point, for a kernel streaming `streams` arrays of
+    // `elsize`-byte elements.  Cache points use half the level's capacity
+    // so the working set stays resident; the DRAM point is eight times
+    // the last level.  Enabled by PRK_CACHE_SWEEP=1; an empty result
+    // means no sweep was requested or no cache information was found.
+    static inline std::vector<std::pair<std::string,size_t>> cache_sweep_lengths(int streams, size_t elsize)
+    {
+        std::vector<std::pair<std::string,size_t>> points;
+        const char * e = std::getenv("PRK_CACHE_SWEEP");
+        if (e==NULL || std::atoi(e)==0) return points;
+        const auto levels = cache_levels();
+        for (auto & l : levels) {
+            const size_t length = (l.bytes/2) / (streams*elsize);
+            if (length > 0) points.push_back({l.name, length});
+        }
+        if (!levels.empty()) {
+            points.push_back({"DRAM", (levels.back().bytes*8) / (streams*elsize)});
+        }
+        return points;
+    }
+
+    // Parse a 64-bit problem size with an optional K/M/G/T suffix
+    // (powers of 1024).  The kernels' hand-rolled std::atoi parsing is
+    // int-typed and overflows silently above 2^31 elements; this throws
+    // the same const char* messages the argument blocks already catch.
+    static inline size_t parse_size(const char * s)
+    {
+        char * end = nullptr;
+        const long long v = std::strtoll(s, &end, 10);
+        if (end == s || v < 0) {
+            throw "ERROR: invalid size argument";
+        }
+        long long scale = 1;
+        if (*end != '\0') {
+            switch (*end) {
+                case 'k': case 'K': scale = 1LL<<10; break;
+                case 'm': case 'M': scale = 1LL<<20; break;
+                case 'g': case 'G': scale = 1LL<<30; break;
+                case 't': case 'T': scale = 1LL<<40; break;
+                default: throw "ERROR: invalid size suffix (K/M/G/T)";
+            }
+            if (*(end+1) != '\0') {
+                throw "ERROR: invalid size suffix (K/M/G/T)";
+            }
+        }
+        if (v > (std::numeric_limits<long long>::max)()/scale) {
+            throw "ERROR: size argument overflows 64 bits";
+        }
+        return (size_t)(v*scale);
+    }
+
+    // Expand a size or sweep argument into the list of sizes to run:
+    // "1M" is a single size, "1M:1G:2x" sweeps multiplicatively from 1M
+    // to 1G doubling each step, and "1M:5M:1M" sweeps additively.
+    static inline std::vector<size_t> parse_sweep(const char * s)
+    {
+        std::vector<size_t> sizes;
+        const std::string str(s);
+        if (str.find(':') == std::string::npos) {
+            sizes.push_back(parse_size(s));
+            return sizes;
+        }
+        std::istringstream iss{str};
+        std::string lo_s, hi_s, step_s;
+        if (!std::getline(iss, lo_s, ':') || !std::getline(iss, hi_s, ':') || !std::getline(iss, step_s)) {
+            throw "ERROR: sweep syntax is <start>:<stop>:<step>[x]";
+        }
+        const size_t lo = parse_size(lo_s.c_str());
+        const size_t hi = parse_size(hi_s.c_str());
+        const bool multiplicative = (step_s.back() == 'x');
+        if (multiplicative) step_s.pop_back();
+        const size_t step = parse_size(step_s.c_str());
+        if (lo < 1 || hi < lo || (multiplicative ? (step < 2) : (step < 1))) {
+            throw "ERROR: inconsistent sweep range";
+        }
+        for (size_t n = lo; n <= hi; n = multiplicative ? n*step : n+step) {
+            sizes.push_back(n);
+        }
+        return sizes;
+    }
+
+    // Expand a sysfs id list such as "0-3,8,10-11" into explicit ids.
+    static inline std::vector<int> parse_id_list(const std::string & s)
+    {
+        std::vector<int> ids;
+        std::istringstream iss{s};
+        std::string token;
+        while (std::getline(iss, token, ',')) {
+            if (token.empty()) continue;
+            const auto dash = token.find('-');
+            if (dash == std::string::npos) {
+                ids.push_back(std::atoi(token.c_str()));
+            } else {
+                const int lo = std::atoi(token.substr(0,dash).c_str());
+                const int hi = std::atoi(token.substr(dash+1).c_str());
+                for (int i=lo; i<=hi; i++) ids.push_back(i);
+            }
+        }
+        return ids;
+    }
+
+    // Online NUMA domains and the CPUs of one domain, read from sysfs so
+    // that we do not depend on libnuma.  Returns an empty vector when the
+    // information is unavailable (non-Linux systems, restricted /sys).
+    static inline std::vector<int> numa_domains(void)
+    {
+        std::ifstream f("/sys/devices/system/node/online");
+        if (!f.good()) return std::vector<int>();
+        std::string online;
+        std::getline(f, online);
+        return parse_id_list(online);
+    }
+
+    static inline std::vector<int> numa_domain_cpus(int node)
+    {
+        std::ifstream f("/sys/devices/system/node/node"+std::to_string(node)+"/cpulist");
+        if (!f.good()) return std::vector<int>();
+        std::string list;
+        std::getline(f, list);
+        return parse_id_list(list);
+    }
+
+    // Apply MPOL_BIND for one node to [ptr,ptr+bytes), the per-domain
+    // counterpart of interleave_pages above.
+    static inline void bind_pages(void * ptr, size_t bytes, int node)
+    {
+#if defined(__linux__) && defined(SYS_mbind)
+        const int MPOL_BIND_ = 2;
+        const unsigned long MPOL_MF_MOVE_ = 2;
+        unsigned long nodemask = 1UL << node;
+        syscall(SYS_mbind, ptr, bytes, MPOL_BIND_,
+                &nodemask, sizeof(nodemask)*CHAR_BIT, MPOL_MF_MOVE_);
+#endif
+    }
+
+    // Run body(first,last) over chunks of [0,count) on the hardware
+    // threads.  Used for setup work like matrix initialization, which at
+    // large problem sizes can otherwise take longer than the timed
+    // kernel; small counts stay serial so short runs do not pay the
+    // thread-spawn overhead.
+    template <typename F>
+    static inline void parallel_for(size_t count, F body)
+    {
+        size_t nt = std::thread::hardware_concurrency();
+        if (nt < 2 || count < 4096) {
+            body(size_t(0), count);
+            return;
+        }
+        if (nt > count) nt = count;
+        const size_t chunk = count/nt + (count%nt ? 1 : 0);
+        std::vector<std::thread> pool;
+        for (size_t first=0; first<count; first+=chunk) {
+            pool.emplace_back(body, first, std::min(count, first+chunk));
+        }
+        for (auto & t : pool) t.join();
+    }
+
+    // Pin the calling thread to one CPU, used to place OpenMP threads on
+    // a chosen NUMA domain; thread-level granularity that process-level
+    // tools like numactl cannot express.
+    static inline void bind_thread(int cpu)
+    {
+#if defined(__linux__)
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        CPU_SET(cpu, &mask);
+        sched_setaffinity(0, sizeof(mask), &mask);
+#endif
+    }
+
+    // Co-runner pressure levels from PRK_INTERFERENCE, a comma-separated
+    // list of background thread counts, e.g. PRK_INTERFERENCE=0,2,4; a
+    // zero entry is the undisturbed baseline.  An empty result means no
+    // contention sweep was requested.
+    static inline std::vector<int> interference_sweep(void)
+    {
+        std::vector<int> counts;
+        const char * e = std::getenv("PRK_INTERFERENCE");
+        if (e==NULL) return counts;
+        std::istringstream iss{std::string(e)};
+        std::string token;
+        while (std::getline(iss, token, ',')) {
+            if (token.empty()) continue;
+            const int t = std::atoi(token.c_str());
+            if (t >= 0) counts.push_back(t);
+        }
+        return counts;
+    }
+
+#if !defined(__NVCC__) && !defined(_CRAYC)
+    // Background pressure generator: threads that stream through or
+    // pointer-chase a buffer much larger than the last-level cache while
+    // the foreground kernel runs, so contention sensitivity can be
+    // measured inside one process instead of with two unsynchronized
+    // jobs.  The pattern comes from PRK_INTERFERENCE_PATTERN (stream,
+    // the default, or chase) and PRK_INTERFERENCE_CPUS optionally pins
+    // the co-runners to the given cpus, cycling the list.
+    class interference {
+
+        public:
+            interference(void) : pattern_("stream"), stop_(false), sink_(0) {
+                const char * p = std::getenv("PRK_INTERFERENCE_PATTERN");
+                if (p != NULL) pattern_ = std::string(p);
+                const char * c = std::getenv("PRK_INTERFERENCE_CPUS");
+                if (c != NULL) cpus_ = parse_id_list(std::string(c));
+            }
+
+            ~interference(void) { stop(); }
+
+            interference(const interference &) = delete;
+            interference & operator=(const interference &) = delete;
+
+            const std::string & pattern(void) const { return pattern_; }
+
+            void start(int num_threads) {
+                stop_ = false;
+                for (int t=0; t<num_threads; t++) {
+                    workers_.emplace_back([this,t] {
+                        if (!cpus_.empty()) bind_thread(cpus_[t % cpus_.size()]);
+                        if (pattern_ == "chase") chase(); else stream();
+                    });
+                }
+            }
+
+            void stop(void) {
+                stop_ = true;
+                for (auto & w : workers_) w.join();
+                workers_.clear();
+            }
+
+        private:
+            // bandwidth pressure: a triad over arrays well past any LLC
+            void stream(void) {
+                const size_t n = (size_t)1 << 23;
+                std::vector<double> a(n,1.0), b(n,2.0);
+                const double scalar = 3.0;
+                while (!stop_) {
+                    for (size_t i=0; i<n; i++) {
+                        a[i] += scalar * b[i];
+                    }
+                    sink_ += (size_t)a[0];
+                }
+            }
+
+            // latency pressure: a random single-cycle chase (Sattolo)
+            // that defeats the prefetchers and occupies the miss queues
+            void chase(void) {
+                const size_t n = (size_t)1 << 22;
+                std::vector<size_t> next(n);
+                std::iota(next.begin(), next.end(), (size_t)0);
+                std::minstd_rand gen(42);
+                for (size_t i=n-1; i>0; i--) {
+                    const size_t j = gen() % i;
+                    std::swap(next[i], next[j]);
+                }
+                size_t p = 0;
+                while (!stop_) {
+                    for (size_t i=0; i<n; i++) {
+                        p = next[p];
+                    }
+                    sink_ += p;
+                }
+            }
+
+            std::string pattern_;
+            std::vector<int> cpus_;
+            std::vector<std::thread> workers_;
+            std::atomic<bool> stop_;
+            std::atomic<size_t> sink_; // keeps the loops observable
+    };
+#endif
+
+    // Package energy from the RAPL powercap sysfs interface and average
+    // core frequency from cpufreq, sampled around the timed region so
+    // that perf-per-watt shows up in the report and a thermally
+    // throttled node fails qualification visibly instead of just
+    // looking slow.  Enabled by PRK_ENERGY=1; report() is a no-op when
+    // disabled or the files are unavailable (non-Linux systems,
+    // restricted /sys).
+    class energy_meter {
+
+        public:
+            energy_meter(void) : joules_(0), seconds_(0), start_khz_(0), stop_khz_(0) {
+                const char * e = std::getenv("PRK_ENERGY");
+                if (e == nullptr || std::atoi(e) == 0) return;
+                for (int p=0; ; p++) {
+                    const std::string dir = "/sys/class/powercap/intel-rapl:" + std::to_string(p);
+                    if (read_value(dir + "/energy_uj") < 0.) break;
+                    double range(0);
+                    std::ifstream(dir + "/max_energy_range_uj") >> range;
+                    packages_.push_back({dir, range});
+                }
+                if (packages_.empty()) {
+                    std::cout << "WARNING: PRK_ENERGY set but no RAPL packages found" << std::endl;
+                }
+            }
+
+            void start(void) {
+                if (packages_.empty()) return;
+                start_uj_.clear();
+                for (auto & p : packages_) {
+                    start_uj_.push_back(read_value(p.first + "/energy_uj"));
+                }
+                start_khz_  = read_khz();
+                start_time_ = std::chrono::steady_clock::now();
+            }
+
+            void stop(void) {
+                if (packages_.empty()) return;
+                seconds_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time_).count();
+                stop_khz_ = read_khz();
+                joules_ = 0.;
+                for (size_t p=0; p<packages_.size(); p++) {
+                    double delta = read_value(packages_[p].first + "/energy_uj") - start_uj_[p];
+                    // the RAPL counter wraps at max_energy_range_uj
+                    if (delta < 0.) delta += packages_[p].second;
+                    joules_ += 1.e-6*delta;
+                }
+            }
+
+            void report(double rate, const std::string & unit) const {
+                if (packages_.empty() || seconds_ <= 0.) return;
+                std::cout << "Energy (J): " << joules_
+                          << "  Average power (W): " << joules_/seconds_;
+                const double ghz = 1.e-6*0.5*(start_khz_+stop_khz_);
+                if (ghz > 0.) std::cout << "  Average frequency (GHz): " << ghz;
+                std::cout << std::endl;
+                if (joules_ > 0.) {
+                    std::cout << unit << "/W: " << rate/(joules_/seconds_) << std::endl;
+                }
+            }
+
+        private:
+            static double read_value(const std::string & path) {
+                std::ifstream f(path);
+                if (!f.good()) return -1.;
+                double v(-1.);
+                f >> v;
+                return v;
+            }
+
+            // average scaling_cur_freq over all cpus, zero on failure
+            static double read_khz(void) {
+                double sum(0);
+                int cpus(0);
+                for (int cpu=0; ; cpu++) {
+                    const double khz = read_value("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpufreq/scaling_cur_freq");
+                    if (khz < 0.) break;
+                    sum += khz;
+                    cpus++;
+                }
+                return (cpus > 0) ? sum/cpus : 0.;
+            }
+
+            std::vector<std::pair<std::string,double>> packages_;
+            std::vector<double> start_uj_;
+            std::chrono::steady_clock::time_point start_time_;
+            double joules_, seconds_;
+            double start_khz_, stop_khz_;
+    };
+
     static inline double wtime(void)
     {
 #if defined(USE_OPENMP) && defined(_OPENMP)
@@ -285,6 +1737,66 @@ namespace prk {
         return ( numerator / denominator + (numerator % denominator > 0) );
     }
 
+#if !defined(__NVCC__) && !defined(_CRAYC)
+    // Persistent worker threads with futures-based submission, so that
+    // kernels which enqueue tasks every iteration measure the work and
+    // not pthread_create.
+    class thread_pool {
+
+        public:
+            explicit thread_pool(int num_threads) : done_(false) {
+                for (int t=0; t<num_threads; t++) {
+                    workers_.emplace_back([this] {
+                        for (;;) {
+                            std::packaged_task<void(void)> task;
+                            {
+                                std::unique_lock<std::mutex> lock(mutex_);
+                                ready_.wait(lock, [this] { return done_ || !tasks_.empty(); });
+                                if (done_ && tasks_.empty()) return;
+                                task = std::move(tasks_.front());
+                                tasks_.pop();
+                            }
+                            task();
+                        }
+                    });
+                }
+            }
+
+            ~thread_pool() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    done_ = true;
+                }
+                ready_.notify_all();
+                for (auto & w : workers_) w.join();
+            }
+
+            thread_pool(const thread_pool &) = delete;
+            thread_pool & operator=(const thread_pool &) = delete;
+
+            template <typename F>
+            std::future<void> submit(F && f) {
+                std::packaged_task<void(void)> task(std::forward<F>(f));
+                auto result = task.get_future();
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    tasks_.push(std::move(task));
+                }
+                ready_.notify_one();
+                return result;
+            }
+
+            int size(void) const { return workers_.size(); }
+
+        private:
+            std::vector<std::thread> workers_;
+            std::queue<std::packaged_task<void(void)>> tasks_;
+            std::mutex mutex_;
+            std::condition_variable ready_;
+            bool done_;
+    };
+#endif
+
 } // namespace prk
 
 #endif /* PRK_UTIL_H */
@@ -0,0 +1,307 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    RandomAccess
+///
+/// PURPOSE: This program tests the efficiency of the memory subsystem to
+///          update elements of a device-resident table with irregular
+///          stride.
+///
+/// USAGE:   The program takes as input the ratio of table size over
+///          number of updates, the 2log of the size of the table that
+///          gets updated, the total number of independent update streams
+///          (vector length), and the number of streams each device
+///          thread carries (look-ahead batches).
+///
+///          <progname> <#update ratio> <log2 tablesize> <vector length>
+///                     [<look-ahead batches>]
+///
+///          Each stream is an independent sequence of powers of 0x2
+///          modulo the primitive polynomial x^63+x^2+x+1, started with
+///          the jump-ahead function PRK_starts, exactly as in the serial
+///          and MPI1 versions.  A device thread owns <batches> streams
+///          and advances them in lockstep, so that many update requests
+///          are in flight per thread and the achievable memory-level
+///          parallelism can be dialed in from the command line.  Updates
+///          are applied with atomicXor, so concurrent updates of the
+///          same table element cannot be lost and validation tolerates
+///          zero errors.
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics: GUPS, plus the
+///          achieved atomic-update throughput per DRAM partition (the
+///          memory bus width divided by the 64-bit partition width).
+///
+/// HISTORY: Written by Rob Van der Wijngaart, February 2009.
+///          Converted to C++11/CUDA, August 2026.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+#include "prk_cuda.h"
+
+#define POLY    0x0000000000000007ULL
+#define PERIOD  1317624576693539401LL
+/* sequence number in stream of random numbers to be used as initial value */
+#define SEQSEED 834568137686317453LL
+
+typedef unsigned long long u64;
+typedef long long          s64;
+
+__global__ void init_table(s64 tablesize, u64 * table)
+{
+    s64 i = (s64)blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < tablesize) table[i] = (u64)i;
+}
+
+/* jump-ahead to the nth element of the stream of powers of 0x2; identical
+   to the host PRK_starts of the serial and MPI1 versions                  */
+__device__ u64 PRK_starts(s64 n)
+{
+    u64 m2[64];
+    u64 temp, ran;
+
+    while (n < 0) n += PERIOD;
+    while (n > PERIOD) n -= PERIOD;
+    if (n == 0) return 0x1;
+
+    temp = 0x1;
+    for (int i=0; i<64; i++) {
+        m2[i] = temp;
+        temp = (temp << 1) ^ ((s64)temp < 0 ? POLY : 0);
+        temp = (temp << 1) ^ ((s64)temp < 0 ? POLY : 0);
+    }
+
+    int i = 62;
+    for (; i>=0; i--)
+        if ((n >> i) & 1)
+            break;
+
+    ran = 0x2;
+    while (i > 0) {
+        temp = 0;
+        for (int j=0; j<64; j++)
+            if ((ran >> j) & 1)
+                temp ^= m2[j];
+        ran = temp;
+        i -= 1;
+        if ((n >> i) & 1)
+            ran = (ran << 1) ^ ((s64)ran < 0 ? POLY : 0);
+    }
+
+    return ran;
+}
+
+__global__ void seed_streams(int nstarts, s64 chunk, u64 * ran)
+{
+    int j = blockIdx.x * blockDim.x + threadIdx.x;
+    if (j < nstarts) ran[j] = PRK_starts(SEQSEED + chunk*j);
+}
+
+/* each thread carries B streams in registers and advances them in
+   lockstep, so B atomic updates are in flight per thread              */
+template <int B>
+__global__ void update_table(s64 tablesize, s64 nsteps, int nthreads,
+                             u64 * ran, u64 * table)
+{
+    int t = blockIdx.x * blockDim.x + threadIdx.x;
+    if (t >= nthreads) return;
+
+    u64 r[B];
+    #pragma unroll
+    for (int b=0; b<B; b++) r[b] = ran[t*B+b];
+
+    for (s64 i=0; i<nsteps; i++) {
+        #pragma unroll
+        for (int b=0; b<B; b++) {
+            r[b] = (r[b] << 1) ^ ((s64)r[b] < 0 ? POLY : 0);
+            atomicXor(&table[r[b] & (tablesize-1)], r[b]);
+        }
+    }
+
+    #pragma unroll
+    for (int b=0; b<B; b++) ran[t*B+b] = r[b];
+}
+
+/* utility routine that tests whether an integer is a power of two     */
+static int poweroftwo(int n)
+{
+    int log2n = 0;
+    while ((1<<log2n)<n) log2n++;
+    if (1<<log2n != n) return (-1);
+    else               return (log2n);
+}
+
+int main(int argc, char * argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11/CUDA Random Access" << std::endl;
+
+  prk::CUDA::info info;
+  // enumerating and printing device properties is measurable cold-start
+  // cost in launch-dominated usage, so fast start skips it
+  if (!prk::fast_start()) info.print();
+
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int update_ratio, log2tablesize, nstarts, batches;
+  try {
+      if (argc < 4) {
+        throw "Usage: <#update ratio> <log2 tablesize> <vector length> [<look-ahead batches>]";
+      }
+
+      update_ratio = std::atoi(argv[1]);
+      if (poweroftwo(update_ratio) < 0) {
+        throw "ERROR: update ratio must be a power of 2";
+      }
+
+      log2tablesize = std::atoi(argv[2]);
+      if (log2tablesize < 1 || log2tablesize > 62) {
+        throw "ERROR: log2 tablesize must be between 1 and 62";
+      }
+
+      nstarts = std::atoi(argv[3]);
+      if (poweroftwo(nstarts) < 0) {
+        throw "ERROR: vector length must be a power of 2";
+      }
+
+      batches = (argc > 4) ? std::atoi(argv[4]) : 1;
+      if (batches < 1 || batches > 8 || poweroftwo(batches) < 0) {
+        throw "ERROR: look-ahead batches must be 1, 2, 4, or 8";
+      }
+      if (batches > nstarts) {
+        throw "ERROR: look-ahead batches must not exceed vector length";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  const s64 tablesize = (s64)1 << log2tablesize;
+  const s64 nupdate   = (s64)update_ratio * tablesize;
+  if ((s64)poweroftwo(update_ratio) + log2tablesize < (s64)poweroftwo(nstarts) + 1) {
+    std::cout << "ERROR: table size times update ratio must be at least "
+              << "twice the vector length" << std::endl;
+    return 1;
+  }
+
+  const int nthreads = nstarts / batches;
+
+  std::cout << "Table size (shared)    = " << tablesize << std::endl;
+  std::cout << "Update ratio           = " << update_ratio << std::endl;
+  std::cout << "Number of updates      = " << nupdate << std::endl;
+  std::cout << "Vector length          = " << nstarts << std::endl;
+  std::cout << "Look-ahead batches     = " << batches << std::endl;
+  std::cout << "Startup time (s)       = " << prk::startup_time() << std::endl;
+
+  const int blockSize = 128;
+  dim3 dimBlock(blockSize, 1, 1);
+  dim3 dimGridTable(prk::divceil(tablesize,(s64)blockSize), 1, 1);
+  dim3 dimGridStreams(prk::divceil(nstarts,blockSize), 1, 1);
+  dim3 dimGridUpdate(prk::divceil(nthreads,blockSize), 1, 1);
+
+  info.checkDims(dimBlock, dimGridTable);
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  const size_t tablespace = (size_t)tablesize * sizeof(u64);
+
+  u64 * d_table;
+  u64 * d_ran;
+  prk::CUDA::check( cudaMalloc((void**)&d_table, tablespace) );
+  prk::CUDA::check( cudaMalloc((void**)&d_ran, (size_t)nstarts*sizeof(u64)) );
+
+  init_table<<<dimGridTable, dimBlock>>>(tablesize, d_table);
+  prk::CUDA::check( cudaDeviceSynchronize() );
+
+  /* because we do two rounds, we divide nupdates in two               */
+  const s64 chunk  = nupdate/nstarts;
+  const s64 nsteps = nupdate/(nstarts*2);
+
+  double random_time = prk::wtime();
+
+  /* do two identical rounds of Random Access to make sure we recover
+     the initial condition                                             */
+  for (int round=0; round<2; round++) {
+    seed_streams<<<dimGridStreams, dimBlock>>>(nstarts, chunk, d_ran);
+    switch (batches) {
+      case 1: update_table<1><<<dimGridUpdate, dimBlock>>>(tablesize, nsteps, nthreads, d_ran, d_table); break;
+      case 2: update_table<2><<<dimGridUpdate, dimBlock>>>(tablesize, nsteps, nthreads, d_ran, d_table); break;
+      case 4: update_table<4><<<dimGridUpdate, dimBlock>>>(tablesize, nsteps, nthreads, d_ran, d_table); break;
+      case 8: update_table<8><<<dimGridUpdate, dimBlock>>>(tablesize, nsteps, nthreads, d_ran, d_table); break;
+    }
+  }
+  prk::CUDA::check( cudaDeviceSynchronize() );
+
+  random_time = prk::wtime() - random_time;
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  std::vector<u64> h_table(tablesize);
+  prk::CUDA::check( cudaMemcpy(h_table.data(), d_table, tablespace, cudaMemcpyDeviceToHost) );
+  prk::CUDA::check( cudaFree(d_ran) );
+  prk::CUDA::check( cudaFree(d_table) );
+
+  /* updates are atomic, so unlike the host versions no errors at all
+     are tolerated                                                     */
+  s64 errors(0);
+  for (s64 i=0; i<tablesize; i++) {
+    if (h_table[i] != (u64)i) errors++;
+  }
+
+  if (errors != 0) {
+    std::cout << "ERROR: number of incorrect table elements = " << errors << std::endl;
+    return 1;
+  }
+  else {
+    std::cout << "Solution validates, number of errors: " << errors << std::endl;
+    std::cout << "Rate (GUPs/s): " << 1.e-9*nupdate/random_time
+              << " time (s) = " << random_time << std::endl;
+    /* one DRAM partition per 64 bits of memory bus                    */
+    const int partitions = (info.memoryBusWidth > 0) ? info.memoryBusWidth/64 : 0;
+    if (partitions > 0) {
+      std::cout << "Atomic throughput (Mupdates/s): " << 1.e-6*nupdate/random_time
+                << " total, " << 1.e-6*nupdate/random_time/partitions
+                << " per memory partition (" << partitions << " partitions)" << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,221 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+///
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    RandomAccess
+///
+/// PURPOSE: This program tests the efficiency of the memory subsystem to
+///          update elements of an array with irregular stride.
+///
+/// USAGE:   The program takes as input the ratio of table size over
+///          number of updates, the 2log of the size of the table that
+///          gets updated, and the number of independent update streams
+///          (vector length).
+///
+///          <progname> <#update ratio> <log2 tablesize> <vector length>
+///
+///          Each stream is an independent sequence of powers of 0x2
+///          modulo the primitive polynomial x^63+x^2+x+1, started with
+///          the jump-ahead function PRK_starts, exactly as in the serial
+///          and MPI1 versions.  The timed code applies the RandomAccess
+///          operator twice, so that the second pass restores the table
+///          to its initial condition and table element j must equal j.
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// HISTORY: Written by Rob Van der Wijngaart, February 2009.
+///          Converted to C++11, August 2026.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+
+#define POLY    0x0000000000000007ULL
+#define PERIOD  1317624576693539401LL
+/* sequence number in stream of random numbers to be used as initial value */
+#define SEQSEED 834568137686317453LL
+
+typedef uint64_t u64;
+typedef int64_t  s64;
+
+/* jump-ahead to the nth element of the stream of powers of 0x2 */
+static u64 PRK_starts(s64 n)
+{
+    u64 m2[64];
+    u64 temp, ran;
+
+    while (n < 0) n += PERIOD;
+    while (n > PERIOD) n -= PERIOD;
+    if (n == 0) return 0x1;
+
+    temp = 0x1;
+    for (int i=0; i<64; i++) {
+        m2[i] = temp;
+        temp = (temp << 1) ^ ((s64)temp < 0 ? POLY : 0);
+        temp = (temp << 1) ^ ((s64)temp < 0 ? POLY : 0);
+    }
+
+    int i = 62;
+    for (; i>=0; i--)
+        if ((n >> i) & 1)
+            break;
+
+    ran = 0x2;
+    while (i > 0) {
+        temp = 0;
+        for (int j=0; j<64; j++)
+            if ((ran >> j) & 1)
+                temp ^= m2[j];
+        ran = temp;
+        i -= 1;
+        if ((n >> i) & 1)
+            ran = (ran << 1) ^ ((s64)ran < 0 ? POLY : 0);
+    }
+
+    return ran;
+}
+
+/* utility routine that tests whether an integer is a power of two     */
+static int poweroftwo(int n)
+{
+    int log2n = 0;
+    while ((1<<log2n)<n) log2n++;
+    if (1<<log2n != n) return (-1);
+    else               return (log2n);
+}
+
+int main(int argc, char * argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11 Random Access" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int update_ratio, log2tablesize, nstarts;
+  try {
+      if (argc != 4) {
+        throw "Usage: <#update ratio> <log2 tablesize> <vector length>";
+      }
+
+      update_ratio = std::atoi(argv[1]);
+      if (poweroftwo(update_ratio) < 0) {
+        throw "ERROR: update ratio must be a power of 2";
+      }
+
+      log2tablesize = std::atoi(argv[2]);
+      if (log2tablesize < 1 || log2tablesize > 62) {
+        throw "ERROR: log2 tablesize must be between 1 and 62";
+      }
+
+      nstarts = std::atoi(argv[3]);
+      if (poweroftwo(nstarts) < 0) {
+        throw "ERROR: vector length must be a power of 2";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  const s64 tablesize = (s64)1 << log2tablesize;
+  const s64 nupdate   = (s64)update_ratio * tablesize;
+  if (poweroftwo(update_ratio) + log2tablesize < poweroftwo(nstarts)) {
+    std::cout << "ERROR: table size times update ratio must be at least "
+              << "equal to the vector length" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Table size (shared)    = " << tablesize << std::endl;
+  std::cout << "Update ratio           = " << update_ratio << std::endl;
+  std::cout << "Number of updates      = " << nupdate << std::endl;
+  std::cout << "Vector length          = " << nstarts << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  double random_time(0);
+
+  prk::vector<u64> Table(tablesize);
+  std::vector<u64> ran(nstarts);
+
+  for (s64 i=0; i<tablesize; i++) {
+      Table[i] = (u64)i;
+  }
+
+  {
+    random_time = prk::wtime();
+
+    /* do two identical rounds of Random Access to make sure we recover
+       the initial condition                                             */
+    for (int round=0; round<2; round++) {
+
+      for (int j=0; j<nstarts; j++) {
+        ran[j] = PRK_starts(SEQSEED+(nupdate/nstarts)*j);
+      }
+      for (int j=0; j<nstarts; j++) {
+        /* because we do two rounds, we divide nupdates in two           */
+        for (s64 i=0; i<nupdate/(nstarts*2); i++) {
+          ran[j] = (ran[j] << 1) ^ ((s64)ran[j] < 0 ? POLY : 0);
+          Table[ran[j] & (tablesize-1)] ^= ran[j];
+        }
+      }
+    }
+
+    random_time = prk::wtime() - random_time;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  s64 errors(0);
+  for (s64 i=0; i<tablesize; i++) {
+    if (Table[i] != (u64)i) {
+      errors++;
+    }
+  }
+
+  if (errors) {
+    std::cout << "ERROR: number of incorrect table elements = " << errors << std::endl;
+    return 1;
+  } else {
+    std::cout << "Solution validates, number of errors: " << errors << std::endl;
+    std::cout << "Rate (GUPs/s): " << 1.e-9*nupdate/random_time
+              << " time (s) = " << random_time << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,242 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+/// Copyright (c) 2015, NVIDIA CORPORATION.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of <COPYRIGHT HOLDER> nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    reduce
+///
+/// PURPOSE: This program tests the efficiency with which a collection
+///          of device-resident vectors, one per rank with one GPU per
+///          rank, can be added in elementwise fashion.  It is the GPU
+///          analogue of MPI1/Reduce, with the exchange carried out by
+///          NCCL (RCCL on AMD) instead of MPI_Reduce.
+///
+/// USAGE:   The program takes as input the number of iterations and
+///          the length of the vectors:
+///
+///          mpirun -n <ranks> reduce-cuda-nccl <# iterations> <vector length>
+///
+///          The output consists of diagnostics to make sure the
+///          reduction worked and timing statistics, including the bus
+///          bandwidth figure of merit used by nccl-tests so results
+///          can be compared against that suite directly.
+///
+/// HISTORY: Written by Rob Van der Wijngaart, February 2009.
+///          Converted to C++11 by Jeff Hammond, February 2016 and May 2017.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+#include "prk_cuda.h"
+
+#include <mpi.h>
+#include <nccl.h>
+
+const int block_threads = 256;
+
+namespace prk {
+    namespace NCCL {
+        void check(ncclResult_t rc)
+        {
+            if (rc==ncclSuccess) {
+                return;
+            } else {
+                std::cerr << "PRK NCCL error: " << ncclGetErrorString(rc) << std::endl;
+                std::abort();
+            }
+        }
+    }
+}
+
+/// The "local" part of the reduction: refresh this rank's contribution
+/// so every iteration pushes new data through the collective.
+__global__ void increment(size_t nelems, prk_float * in)
+{
+    for (size_t k = blockIdx.x * blockDim.x + threadIdx.x; k < nelems; k += (size_t)gridDim.x * blockDim.x) {
+        in[k] += (prk_float)1;
+    }
+}
+
+int main(int argc, char * argv[])
+{
+  MPI_Init(&argc, &argv);
+
+  int np, me;
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+
+  if (me==0) {
+    std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+    std::cout << "C++11/CUDA+NCCL Vector Reduction" << std::endl;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations;
+  size_t vector_length;
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <vector length>";
+      }
+
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      vector_length = std::atol(argv[2]);
+      if (vector_length < 1) {
+        throw "ERROR: vector length must be >= 1";
+      }
+  }
+  catch (const char * e) {
+    if (me==0) std::cout << e << std::endl;
+    MPI_Abort(MPI_COMM_WORLD, 1);
+  }
+
+  // one GPU per rank; ranks sharing a node take turns round robin
+  int ngpus;
+  prk::CUDA::check( cudaGetDeviceCount(&ngpus) );
+  prk::CUDA::check( cudaSetDevice(me % ngpus) );
+
+  // NCCL bootstraps over MPI: rank 0 mints the clique id
+  ncclUniqueId uniqueId;
+  if (me==0) prk::NCCL::check( ncclGetUniqueId(&uniqueId) );
+  MPI_Bcast(&uniqueId, sizeof(uniqueId), MPI_BYTE, 0, MPI_COMM_WORLD);
+
+  ncclComm_t nccl_comm;
+  prk::NCCL::check( ncclCommInitRank(&nccl_comm, np, uniqueId, me) );
+
+  if (me==0) {
+    std::cout << "Number of ranks       = " << np << std::endl;
+    std::cout << "Number of iterations  = " << iterations << std::endl;
+    std::cout << "Vector length         = " << vector_length << std::endl;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  /// Allocate space for the vectors
+  //////////////////////////////////////////////////////////////////////
+
+  const size_t bytes = vector_length * sizeof(prk_float);
+
+  prk_float * h_in;
+  prk_float * h_out;
+  prk::CUDA::check( cudaMallocHost((void**)&h_in,  bytes) );
+  prk::CUDA::check( cudaMallocHost((void**)&h_out, bytes) );
+
+  for (size_t i=0; i<vector_length; i++) {
+    h_in[i]  = static_cast<prk_float>(me+1);
+    h_out[i] = static_cast<prk_float>(0);
+  }
+
+  prk_float * d_in;
+  prk_float * d_out;
+  prk::CUDA::check( cudaMalloc((void**)&d_in,  bytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_out, bytes) );
+  prk::CUDA::check( cudaMemcpy(d_in, h_in, bytes, cudaMemcpyHostToDevice) );
+
+  const ncclDataType_t dtype = (sizeof(prk_float)==8) ? ncclDouble : ncclFloat;
+  const int blocks = (int)std::min((size_t)65535, (vector_length + block_threads - 1)/block_threads);
+
+  auto reduce_time = 0.0;
+
+  for (int iter = 0; iter<=iterations; iter++) {
+
+    if (iter==1) {
+      MPI_Barrier(MPI_COMM_WORLD);
+      reduce_time = prk::wtime();
+    }
+
+    // first do the "local" part
+    increment<<<blocks, block_threads>>>(vector_length, d_in);
+
+    // now do the "non-local" part; every rank receives the sum so
+    // validation does not depend on rank, as with an MPI_Allreduce
+    prk::NCCL::check( ncclAllReduce(d_in, d_out, vector_length, dtype, ncclSum, nccl_comm, 0) );
+    prk::CUDA::check( cudaDeviceSynchronize() );
+  }
+
+  reduce_time = prk::wtime() - reduce_time;
+
+  double local_time = reduce_time;
+  MPI_Reduce(&local_time, &reduce_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+
+  prk::CUDA::check( cudaMemcpy(h_out, d_out, bytes, cudaMemcpyDeviceToHost) );
+
+  prk::CUDA::check( cudaFree(d_out) );
+  prk::CUDA::check( cudaFree(d_in) );
+  prk::NCCL::check( ncclCommDestroy(nccl_comm) );
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  // after the final iteration rank r contributes (r+1) + (iterations+1),
+  // so every element of the sum is the same on every rank
+  const double element_value = (np*(np+1.))/2. + np*(iterations+1.);
+  const double epsilon = 1.0e-8;
+  double abserr(0);
+  for (size_t i=0; i<vector_length; i++) {
+    abserr += std::fabs(h_out[i] - element_value);
+  }
+
+  double total_err(0);
+  MPI_Reduce(&abserr, &total_err, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+
+  prk::CUDA::check( cudaFreeHost(h_out) );
+  prk::CUDA::check( cudaFreeHost(h_in) );
+
+  int status = 0;
+  if (me==0) {
+    if (total_err < epsilon) {
+      std::cout << "Solution validates" << std::endl;
+      auto avgtime = reduce_time/iterations;
+      std::cout << "Rate (MFlops/s): " << 1.0e-6 * (2.0*np-1.0)*vector_length/avgtime
+                << " Avg time (s): " << avgtime << std::endl;
+      // nccl-tests conventions: algbw moves the vector once; busbw
+      // scales by 2(n-1)/n, the traffic an optimal ring actually carries
+      const double algbw = 1.0e-6 * bytes / avgtime;
+      std::cout << "Algorithm bandwidth (MB/s): " << algbw << std::endl;
+      std::cout << "Bus bandwidth (MB/s): " << algbw * 2.0*(np-1.0)/np << std::endl;
+    } else {
+      std::cout << "ERROR: Aggregate absolute error " << total_err
+                << " exceeds threshold " << epsilon << std::endl;
+      status = 1;
+    }
+  }
+
+  MPI_Bcast(&status, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  MPI_Finalize();
+  return status;
+}
@@ -0,0 +1,154 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+///
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    reduce
+///
+/// PURPOSE: This program tests the efficiency with which a pair of
+///          vectors can be added in elementwise fashion.
+///
+/// USAGE:   The program takes as input the number of times the reduction
+///          is repeated and the length of the vectors.
+///
+///          <progname> <# iterations> <vector length>
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// HISTORY: Written by Rob Van der Wijngaart, February 2009.
+///          Converted to C++11/OpenMP, August 2026.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+
+int main(int argc, char * argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+#ifdef _OPENMP
+  std::cout << "C++11/OpenMP Vector Reduction" << std::endl;
+#else
+  std::cout << "C++11 Vector Reduction" << std::endl;
+#endif
+
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations;
+  size_t length;
+  try {
+      if (argc != 3) {
+        throw "Usage: <# iterations> <vector length>";
+      }
+
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      length = prk::parse_size(argv[2]);
+      if (length <= 0) {
+        throw "ERROR: vector length must be positive";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+#ifdef _OPENMP
+  std::cout << "Number of threads    = " << omp_get_max_threads() << std::endl;
+#endif
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Vector length        = " << length << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  double reduce_time(0);
+
+  double * RESTRICT vector = new double[length];
+  double * RESTRICT ones   = new double[length];
+
+  OMP_PARALLEL()
+  {
+    OMP_FOR_SIMD
+    for (size_t i=0; i<length; i++) {
+      vector[i] = 1.0;
+      ones[i]   = 1.0;
+    }
+
+    for (int iter = 0; iter<=iterations; iter++) {
+
+      if (iter==1) {
+          OMP_BARRIER
+          OMP_MASTER
+          reduce_time = prk::wtime();
+      }
+
+      OMP_FOR_SIMD
+      for (size_t i=0; i<length; i++) {
+        vector[i] += ones[i];
+      }
+    }
+    OMP_BARRIER
+    OMP_MASTER
+    reduce_time = prk::wtime() - reduce_time;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  const double epsilon(1.e-8);
+  const double element_value(iterations+2.0);
+
+  for (size_t i=0; i<length; i++) {
+    if (std::fabs(vector[i] - element_value) >= epsilon) {
+      std::cout << "First error at i=" << i << "; value: " << vector[i]
+                << "; reference value: " << element_value << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "Solution validates" << std::endl;
+#ifdef VERBOSE
+  std::cout << "Element verification value: " << element_value << std::endl;
+#endif
+  double avgtime = reduce_time/iterations;
+  std::cout << "Rate (MFlops/s): " << 1.e-6*length/avgtime
+            << " Avg time (s): " << avgtime << std::endl;
+
+  return 0;
+}
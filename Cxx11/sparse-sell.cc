@@ -0,0 +1,265 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    Sparse
+///
+/// PURPOSE: This program tests the efficiency with which a sparse matrix
+///          vector multiplication is carried out, using SELL-C-sigma
+///          (sliced ELLPACK) storage: rows are sorted by length within a
+///          window of sigma rows, grouped into slices of C rows, and each
+///          slice is stored column-major so the SpMV inner loop runs
+///          across the C rows of a slice and vectorizes cleanly.
+///
+/// USAGE:   The program takes as input the 2log of the linear size of the
+///          2D grid from which the sparse matrix is derived, the stencil
+///          radius, and the number of iterations:
+///
+///          <progname> <# iterations> <2log grid size> <stencil radius> [<slice height C> <sigma>]
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.  The checksum is
+///          identical to the CSR variant (sparse.cc), so the two formats
+///          can be compared run for run.
+///
+/// HISTORY: Written by Rob Van der Wijngaart, February 2009.
+///          C++11-ification by Jeff Hammond, May 2017.
+///          SELL-C-sigma variant added 2020.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+
+static inline size_t offset(size_t i, size_t j, size_t lsize)
+{
+    return (i+(j<<lsize));
+}
+
+int main(int argc, char* argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11 Sparse matrix-vector multiplication (SELL-C-sigma)" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Process and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations, lsize;
+  unsigned radius, stencil_size;
+  size_t size, size2, nent;
+  int slice_height, sigma;
+  double sparsity;
+  try {
+      if (argc < 4) {
+        throw "Usage: <# iterations> <2log grid size> <stencil radius> [<slice height C> <sigma>]";
+      }
+
+      // number of times to run the algorithm
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      // linear grid dimension
+      lsize  = std::atoi(argv[2]);
+      if (lsize < 1) {
+        throw "ERROR: grid dimension must be positive";
+      }
+      size = 1L<<lsize;
+      size2 = size*size;
+
+      // stencil radius
+      radius = std::atoi(argv[3]);
+      if (radius < 0) {
+        throw "ERROR: Stencil radius must be nonnegative";
+      }
+
+      stencil_size = 4*radius+1;
+      sparsity = (4.*radius+1.)/size2;
+      nent = size2 * stencil_size;
+
+      // slice height C: the SIMD width of the SpMV inner loop
+      slice_height = (argc>4) ? std::atoi(argv[4]) : 8;
+      if (slice_height < 1) {
+        throw "ERROR: slice height must be positive";
+      }
+
+      // sorting window sigma: rows are sorted by length within windows of
+      // sigma rows; must be a multiple of the slice height
+      sigma = (argc>5) ? std::atoi(argv[5]) : slice_height;
+      if (sigma < slice_height) sigma = slice_height;
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Matrix order         = " << size2 << std::endl;
+  std::cout << "Stencil diameter     = " << 2*radius+1 << std::endl;
+  std::cout << "Sparsity             = " << sparsity << std::endl;
+  std::cout << "Slice height (C)     = " << slice_height << std::endl;
+  std::cout << "Sorting window       = " << sigma << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  const size_t C = slice_height;
+  const size_t nslices = (size2 + C - 1) / C;
+
+  // per-row column indices in CSR order, used to build the slices
+  prk::vector<size_t> colIndex(nent,0);
+  prk::vector<double> vector(size2,0.0);
+  prk::vector<double> result(size2,0.0);
+
+  // row permutation from sigma-window sorting; every row of this matrix
+  // has stencil_size entries, so the sort is the identity here, but the
+  // machinery is kept so that the format matches what production codes do
+  std::vector<size_t> perm(size2);
+  std::vector<size_t> rowlen(size2, stencil_size);
+
+  // SELL-C-sigma slice pointers: prefix sum of width*C per slice
+  std::vector<size_t> slice_ptr(nslices+1, 0);
+
+  double sparse_time(0);
+
+  {
+    for (size_t row=0; row<size2; row++) {
+      size_t i = row % size;
+      size_t j = row / size;
+      size_t elm = row*stencil_size;
+      colIndex[elm] = offset(i,j,lsize);
+      for (size_t r=1; r<=radius; r++, elm+=4) {
+        colIndex[elm+1] = offset((i+r)%size,j,lsize);
+        colIndex[elm+2] = offset((i-r+size)%size,j,lsize);
+        colIndex[elm+3] = offset(i,(j+r)%size,lsize);
+        colIndex[elm+4] = offset(i,(j-r+size)%size,lsize);
+      }
+      std::sort(&(colIndex[row*stencil_size]), &(colIndex[(row+1)*stencil_size]));
+    }
+
+    // sort rows by descending length within each sigma window
+    std::iota(perm.begin(), perm.end(), 0);
+    for (size_t w=0; w<size2; w+=sigma) {
+      const size_t wend = std::min(size2, w+sigma);
+      std::stable_sort(perm.begin()+w, perm.begin()+wend,
+                       [&](size_t a, size_t b) { return rowlen[a] > rowlen[b]; });
+    }
+
+    // slice widths and prefix sum of slice storage
+    for (size_t s=0; s<nslices; s++) {
+      size_t width = 0;
+      for (size_t r=s*C; r<std::min(size2,(s+1)*C); r++) {
+        width = std::max(width, rowlen[perm[r]]);
+      }
+      slice_ptr[s+1] = slice_ptr[s] + width*C;
+    }
+  }
+
+  // SELL-C-sigma arrays: column-major slice storage
+  prk::vector<double> sell_val(slice_ptr[nslices], 0.0);
+  prk::vector<size_t> sell_idx(slice_ptr[nslices], 0);
+
+  {
+    // fill the slices column-major; padded lanes get weight 0 and a safe
+    // column index so they contribute nothing to the result
+    for (size_t s=0; s<nslices; s++) {
+      const size_t width = (slice_ptr[s+1]-slice_ptr[s])/C;
+      for (size_t r=0; r<C; r++) {
+        const size_t row = s*C+r;
+        if (row >= size2) continue;
+        const size_t src = perm[row]*stencil_size;
+        for (size_t k=0; k<width; k++) {
+          const size_t dst = slice_ptr[s] + k*C + r;
+          if (k < rowlen[perm[row]]) {
+            sell_idx[dst] = colIndex[src+k];
+            sell_val[dst] = 1.0/(colIndex[src+k]+1.);
+          }
+        }
+      }
+    }
+
+    for (auto iter = 0; iter<=iterations; iter++) {
+
+      if (iter==1) sparse_time = prk::wtime();
+
+      for (size_t row=0; row<size2; row++) {
+          vector[row] += (row+1.);
+      }
+
+      for (size_t s=0; s<nslices; s++) {
+          const size_t width = (slice_ptr[s+1]-slice_ptr[s])/C;
+          const size_t base = slice_ptr[s];
+          const size_t rows = std::min(C, size2-s*C);
+          for (size_t k=0; k<width; k++) {
+            PRAGMA_SIMD
+            for (size_t r=0; r<rows; r++) {
+              result[perm[s*C+r]] += sell_val[base+k*C+r]*vector[sell_idx[base+k*C+r]];
+            }
+          }
+      }
+
+    }
+    sparse_time = prk::wtime() - sparse_time;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // Analyze and output results.
+  //////////////////////////////////////////////////////////////////////
+
+  double reference_sum = (0.5*nent) * (iterations+1.) * (iterations+2.);
+
+  double vector_sum(0);
+  for (size_t row=0; row<size2; row++) {
+      vector_sum += result[row];
+  }
+
+  const double epsilon(1.e-8);
+
+  if (std::fabs(vector_sum-reference_sum) > epsilon) {
+    std::cout << "ERROR: Vector norm = " << vector_sum
+              << " Reference vector norm = " << reference_sum << std::endl;
+    return 1;
+  } else {
+    std::cout << "Solution validates" << std::endl;
+#ifdef VERBOSE
+    std::cout << "Reference sum = " << reference_sum
+              << ", vector sum = " << vector_sum << std::endl;
+#endif
+    double avgtime = sparse_time/iterations;
+    std::cout << "Rate (MFlops/s): " << 1.0e-6 * (2.*nent)/avgtime
+              << " Avg time (s): " << avgtime << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,308 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    Stencil
+///
+/// PURPOSE: This program tests the efficiency with which a space-invariant,
+///          linear, symmetric filter (stencil) can be applied to a square
+///          grid or image.
+///
+/// USAGE:   The program takes as input the linear
+///          dimension of the grid, and the number of iterations on the grid
+///
+///                <progname> <iterations> <grid size> [<star/grid> <radius> <probe iterations>]
+///
+///          The output consists of diagnostics to assure
+///          correctness, and of timing statistics.
+///
+///          Unlike stencil-openmp, the tile size is not an input: the
+///          harness probes the candidate tile sizes with short runs at
+///          startup and then executes the timed region with the
+///          fastest one, reporting the chosen configuration.  Loop
+///          order and unrolling inside the stencil body are fixed by
+///          the generated stencil_openmp.hpp operators.
+///
+/// HISTORY: - Written by Rob Van der Wijngaart, February 2009.
+///          - RvdW: Removed unrolling pragmas for clarity;
+///            added constant to array "in" at end of each iteration to force
+///            refreshing of neighbor data in parallel versions; August 2013
+///          - Converted to C++11 by Jeff Hammond, December, 2017.
+///          - Autotuned tile-size selection added later.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+#ifdef _OPENMP
+#include "stencil_openmp.hpp"
+#else
+#include "stencil_seq.hpp"
+#endif
+
+void nothing(const int n, const int t, const double * RESTRICT in, double * RESTRICT out)
+{
+    std::cout << "You are trying to use a stencil that does not exist.\n";
+    std::cout << "Please generate the new stencil using the code generator\n";
+    std::cout << "and add it to the case-switch in the driver." << std::endl;
+    // n will never be zero - this is to silence compiler warnings.
+    if (n==0 || t==0) std::cout << in << out << std::endl;
+    std::abort();
+}
+
+typedef void (*stencil_t)(const int, const int, const double * RESTRICT, double * RESTRICT);
+
+static void init(const int n, const int tile_size,
+                 double * RESTRICT in, double * RESTRICT out)
+{
+  OMP_PARALLEL()
+  {
+    OMP_FOR( collapse(2) )
+    for (auto it=0; it<n; it+=tile_size) {
+      for (auto jt=0; jt<n; jt+=tile_size) {
+        for (auto i=it; i<std::min(n,it+tile_size); i++) {
+          PRAGMA_SIMD
+          for (auto j=jt; j<std::min(n,jt+tile_size); j++) {
+            in[i*n+j] = static_cast<double>(i+j);
+            out[i*n+j] = 0.0;
+          }
+        }
+      }
+    }
+  }
+}
+
+// Runs the warmup iteration plus `iterations` timed ones with the
+// given tile size and returns the time of the timed part, exactly as
+// the hand-tuned kernels measure it.
+static double run(const int n, const int iterations, const int tile_size,
+                  stencil_t stencil, double * RESTRICT in, double * RESTRICT out)
+{
+  double stencil_time(0);
+
+  OMP_PARALLEL()
+  {
+    for (auto iter = 0; iter<=iterations; iter++) {
+
+      if (iter==1) {
+          OMP_BARRIER
+          OMP_MASTER
+          stencil_time = prk::wtime();
+      }
+
+      // Apply the stencil operator
+      stencil(n, tile_size, in, out);
+      // Add constant to solution to force refresh of neighbor data, if any
+      OMP_FOR( collapse(2) )
+      for (auto it=0; it<n; it+=tile_size) {
+        for (auto jt=0; jt<n; jt+=tile_size) {
+          for (auto i=it; i<std::min(n,it+tile_size); i++) {
+            PRAGMA_SIMD
+            for (auto j=jt; j<std::min(n,jt+tile_size); j++) {
+              in[i*n+j] += 1.0;
+            }
+          }
+        }
+      }
+    }
+    OMP_BARRIER
+    OMP_MASTER
+    stencil_time = prk::wtime() - stencil_time;
+  }
+  return stencil_time;
+}
+
+int main(int argc, char* argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+#ifdef _OPENMP
+  std::cout << "C++11/OpenMP Stencil execution on 2D grid (autotuned)" << std::endl;
+#else
+  std::cout << "C++11 Stencil execution on 2D grid (autotuned)" << std::endl;
+#endif
+
+  //////////////////////////////////////////////////////////////////////
+  // Process and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations, n, radius, probe_iterations;
+  bool star = true;
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <array dimension> [<star/grid> <radius> <probe iterations>]";
+      }
+
+      // number of times to run the algorithm
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      // linear grid dimension
+      n  = std::atoi(argv[2]);
+      if (n < 1) {
+        throw "ERROR: grid dimension must be positive";
+      } else if (n > std::floor(std::sqrt(INT_MAX))) {
+        throw "ERROR: grid dimension too large - overflow risk";
+      }
+
+      // stencil pattern
+      if (argc > 3) {
+          auto stencil = std::string(argv[3]);
+          auto grid = std::string("grid");
+          star = (stencil == grid) ? false : true;
+      }
+
+      // stencil radius
+      radius = 2;
+      if (argc > 4) {
+          radius = std::atoi(argv[4]);
+      }
+
+      if ( (radius < 1) || (2*radius+1 > n) ) {
+        throw "ERROR: Stencil radius negative or too large";
+      }
+
+      // timed iterations per probe run during the search
+      probe_iterations = (argc>5) ? std::atoi(argv[5]) : 2;
+      if (probe_iterations < 1) {
+        throw "ERROR: probe iterations must be >= 1";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+#ifdef _OPENMP
+  std::cout << "Number of threads    = " << omp_get_max_threads() << std::endl;
+#endif
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Grid size            = " << n << std::endl;
+  std::cout << "Type of stencil      = " << (star ? "star" : "grid") << std::endl;
+  std::cout << "Radius of stencil    = " << radius << std::endl;
+  std::cout << "Probe iterations     = " << probe_iterations << std::endl;
+
+  stencil_t stencil = nothing;
+  if (star) {
+      switch (radius) {
+          case 1: stencil = star1; break;
+          case 2: stencil = star2; break;
+          case 3: stencil = star3; break;
+          case 4: stencil = star4; break;
+          case 5: stencil = star5; break;
+      }
+  } else {
+      switch (radius) {
+          case 1: stencil = grid1; break;
+          case 2: stencil = grid2; break;
+          case 3: stencil = grid3; break;
+          case 4: stencil = grid4; break;
+          case 5: stencil = grid5; break;
+      }
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and search the candidate tile sizes
+  //////////////////////////////////////////////////////////////////////
+
+  double * RESTRICT in  = new double[n*n];
+  double * RESTRICT out = new double[n*n];
+
+  std::vector<int> candidates;
+  for (int t : {16, 32, 64, 128, 256}) {
+    if (t >= n) break;
+    candidates.push_back(t);
+  }
+  // untiled loop nest
+  candidates.push_back(n);
+
+  int best = candidates.front();
+  double best_time = -1.0;
+  for (auto t : candidates) {
+    // reinitialize so every probe touches data in the same state
+    init(n, t, in, out);
+    double pt = run(n, probe_iterations, t, stencil, in, out);
+    if (best_time < 0.0 || pt < best_time) {
+      best_time = pt;
+      best = t;
+    }
+  }
+
+  std::cout << "Variants searched    = " << candidates.size() << std::endl;
+  std::cout << "Tuned tile size      = " << best
+            << ((best >= n) ? " (untiled)" : "") << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Perform the computation with the chosen tile size
+  //////////////////////////////////////////////////////////////////////
+
+  init(n, best, in, out);
+  double stencil_time = run(n, iterations, best, stencil, in, out);
+
+  //////////////////////////////////////////////////////////////////////
+  // Analyze and output results.
+  //////////////////////////////////////////////////////////////////////
+
+  // interior of grid with respect to stencil
+  size_t active_points = static_cast<size_t>(n-2*radius)*static_cast<size_t>(n-2*radius);
+  // compute L1 norm in parallel
+  double norm = 0.0;
+  OMP_PARALLEL_FOR_REDUCE( +:norm )
+  for (auto i=radius; i<n-radius; i++) {
+    for (auto j=radius; j<n-radius; j++) {
+      norm += std::fabs(out[i*n+j]);
+    }
+  }
+  norm /= active_points;
+
+  // verify correctness
+  const double epsilon = 1.0e-8;
+  double reference_norm = 2.*(iterations+1.);
+  if (std::fabs(norm-reference_norm) > epsilon) {
+    std::cout << "ERROR: L1 norm = " << norm
+              << " Reference L1 norm = " << reference_norm << std::endl;
+    return 1;
+  } else {
+    std::cout << "Solution validates" << std::endl;
+#ifdef VERBOSE
+    std::cout << "L1 norm = " << norm
+              << " Reference L1 norm = " << reference_norm << std::endl;
+#endif
+    const int stencil_size = star ? 4*radius+1 : (2*radius+1)*(2*radius+1);
+    size_t flops = (2L*(size_t)stencil_size+1L) * active_points;
+    auto avgtime = stencil_time/iterations;
+    std::cout << "Rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops)/avgtime
+              << " Avg time (s): " << avgtime << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,271 @@
+///
+/// Copyright (c) 2018, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    Stencil
+///
+/// PURPOSE: This program tests the efficiency with which a space-invariant,
+///          linear, symmetric filter (stencil) can be applied to a square
+///          grid or image.
+///
+/// USAGE:   The program takes as input the linear
+///          dimension of the grid, and the number of iterations on the grid
+///
+///                <progname> <iterations> <grid size> [<radius>]
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// NOTES:   Unlike stencil-cuda, the whole iteration loop runs inside a
+///          single persistent kernel; iterations are separated by
+///          cooperative-groups grid synchronization rather than kernel
+///          relaunches, so no launch latency is paid per iteration and
+///          the working set can stay resident in cache.  Only the star
+///          pattern is supported.  Because there is a single launch, the
+///          reported average time includes the first iteration.
+///
+/// HISTORY: - Written by Rob Van der Wijngaart, February 2009.
+///          - RvdW: Removed unrolling pragmas for clarity;
+///            added constant to array "in" at end of each iteration to force
+///            refreshing of neighbor data in parallel versions; August 2013
+///          - Converted to C++11 by Jeff Hammond, December, 2017.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+#include "prk_cuda.h"
+
+#include <cooperative_groups.h>
+
+namespace cg = cooperative_groups;
+
+const int block_threads = 256;
+
+template <int R>
+__global__ void star_persistent(const int n, const int iterations, prk_float * in, prk_float * out)
+{
+    cg::grid_group grid = cg::this_grid();
+
+    const size_t nelems = (size_t)n*(size_t)n;
+    const size_t stride = (size_t)gridDim.x*(size_t)blockDim.x;
+    const size_t first  = (size_t)blockIdx.x*blockDim.x + threadIdx.x;
+
+    for (int iter = 0; iter<=iterations; iter++) {
+
+      // apply the stencil operator
+      for (size_t k=first; k<nelems; k+=stride) {
+        const int i = k / n;
+        const int j = k % n;
+        if ( (R <= i) && (i < n-R) && (R <= j) && (j < n-R) ) {
+          prk_float sum(0);
+          #pragma unroll
+          for (int r=1; r<=R; r++) {
+            const prk_float w = (prk_float)1 / (prk_float)(2*r*R);
+            sum += w * ( in[(size_t)i*n+(j+r)] + in[((size_t)i+r)*n+j]
+                       - in[(size_t)i*n+(j-r)] - in[((size_t)i-r)*n+j] );
+          }
+          out[k] += sum;
+        }
+      }
+      grid.sync();
+
+      // add constant to solution to force refresh of neighbor data
+      for (size_t k=first; k<nelems; k+=stride) {
+        in[k] += (prk_float)1;
+      }
+      grid.sync();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11/CUDA Stencil execution on 2D grid (persistent kernel)" << std::endl;
+
+  prk::CUDA::info info;
+  info.print();
+
+  //////////////////////////////////////////////////////////////////////
+  // Process and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations, n, radius;
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <array dimension> [<radius>]";
+      }
+
+      // number of times to run the algorithm
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      // linear grid dimension
+      n  = std::atoi(argv[2]);
+      if (n < 1) {
+        throw "ERROR: grid dimension must be positive";
+      } else if (n > std::floor(std::sqrt(INT_MAX))) {
+        throw "ERROR: grid dimension too large - overflow risk";
+      }
+
+      // stencil radius
+      radius = 2;
+      if (argc > 3) {
+          radius = std::atoi(argv[3]);
+      }
+
+      if ( (radius < 1) || (2*radius+1 > n) ) {
+        throw "ERROR: Stencil radius negative or too large";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Grid size            = " << n << std::endl;
+  std::cout << "Type of stencil      = star" << std::endl;
+  std::cout << "Radius of stencil    = " << radius << std::endl;
+
+  void * kernel = NULL;
+  switch (radius) {
+      case 1: kernel = (void*)star_persistent<1>; break;
+      case 2: kernel = (void*)star_persistent<2>; break;
+      case 3: kernel = (void*)star_persistent<3>; break;
+      case 4: kernel = (void*)star_persistent<4>; break;
+      case 5: kernel = (void*)star_persistent<5>; break;
+      default:
+          std::cout << "ERROR: Please add the requested radius." << std::endl;
+          return 1;
+  }
+
+  // a cooperative launch must not exceed what the device can keep
+  // resident, or grid.sync() deadlocks
+  int device;
+  prk::CUDA::check( cudaGetDevice(&device) );
+  cudaDeviceProp prop;
+  prk::CUDA::check( cudaGetDeviceProperties(&prop, device) );
+  if (!prop.cooperativeLaunch) {
+      std::cout << "ERROR: device does not support cooperative launch" << std::endl;
+      return 1;
+  }
+  int blocks_per_sm = 0;
+  prk::CUDA::check( cudaOccupancyMaxActiveBlocksPerMultiprocessor(&blocks_per_sm, kernel, block_threads, 0) );
+  const int blocks = prop.multiProcessorCount * blocks_per_sm;
+  std::cout << "Cooperative grid     = " << blocks << " blocks of " << block_threads << " threads" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  auto stencil_time = 0.0;
+
+  const size_t nelems = (size_t)n * (size_t)n;
+  const size_t bytes = nelems * sizeof(prk_float);
+  prk_float * h_in;
+  prk_float * h_out;
+  prk::CUDA::check( cudaMallocHost((void**)&h_in, bytes) );
+  prk::CUDA::check( cudaMallocHost((void**)&h_out, bytes) );
+
+  for (auto i=0; i<n; i++) {
+    for (auto j=0; j<n; j++) {
+      h_in[i*n+j]  = static_cast<prk_float>(i+j);
+      h_out[i*n+j] = static_cast<prk_float>(0);
+    }
+  }
+
+  // copy input from host to device
+  prk_float * d_in;
+  prk_float * d_out;
+  prk::CUDA::check( cudaMalloc((void**)&d_in, bytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_out, bytes) );
+  prk::CUDA::check( cudaMemcpy(d_in, &(h_in[0]), bytes, cudaMemcpyHostToDevice) );
+  prk::CUDA::check( cudaMemcpy(d_out, &(h_out[0]), bytes, cudaMemcpyHostToDevice) );
+
+  {
+    void * args[] = { (void*)&n, (void*)&iterations, (void*)&d_in, (void*)&d_out };
+
+    stencil_time = prk::wtime();
+    prk::CUDA::check( cudaLaunchCooperativeKernel(kernel, dim3(blocks,1,1), dim3(block_threads,1,1), args, 0, 0) );
+    prk::CUDA::check( cudaDeviceSynchronize() );
+    stencil_time = prk::wtime() - stencil_time;
+  }
+
+  // copy output back to host
+  prk::CUDA::check( cudaMemcpy(&(h_out[0]), d_out, bytes, cudaMemcpyDeviceToHost) );
+
+  prk::CUDA::check( cudaFree(d_out) );
+  prk::CUDA::check( cudaFree(d_in) );
+
+  //////////////////////////////////////////////////////////////////////
+  // Analyze and output results.
+  //////////////////////////////////////////////////////////////////////
+
+  // interior of grid with respect to stencil
+  size_t active_points = static_cast<size_t>(n-2*radius)*static_cast<size_t>(n-2*radius);
+  // compute L1 norm
+  double norm = 0.0;
+  for (auto i=radius; i<n-radius; i++) {
+    for (auto j=radius; j<n-radius; j++) {
+      norm += std::fabs(h_out[i*n+j]);
+    }
+  }
+  norm /= active_points;
+
+  prk::CUDA::check( cudaFreeHost(h_out) );
+  prk::CUDA::check( cudaFreeHost(h_in) );
+
+  // verify correctness
+  const double epsilon = 1.0e-8;
+  double reference_norm = 2.*(iterations+1.);
+  if (std::fabs(norm-reference_norm) > epsilon) {
+    std::cout << "ERROR: L1 norm = " << norm
+              << " Reference L1 norm = " << reference_norm << std::endl;
+    return 1;
+  } else {
+    std::cout << "Solution validates" << std::endl;
+#ifdef VERBOSE
+    std::cout << "L1 norm = " << norm
+              << " Reference L1 norm = " << reference_norm << std::endl;
+#endif
+    const int stencil_size = 4*radius+1;
+    size_t flops = (2L*(size_t)stencil_size+1L) * active_points;
+    // the single launch covers all iterations, including the first
+    auto avgtime = stencil_time/(iterations+1);
+    std::cout << "Rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops)/avgtime
+              << " Avg time (s): " << avgtime << std::endl;
+  }
+
+  return 0;
+}
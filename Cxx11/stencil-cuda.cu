@@ -89,7 +89,9 @@ int main(int argc, char* argv[])
   std::cout << "C++11/CUDA Stencil execution on 2D grid" << std::endl;
 
   prk::CUDA::info info;
-  info.print();
+  // enumerating and printing device properties is measurable cold-start
+  // cost in launch-dominated usage, so fast start skips it
+  if (!prk::fast_start()) info.print();
 
   //////////////////////////////////////////////////////////////////////
   // Process and test input parameters
@@ -149,8 +151,14 @@ int main(int argc, char* argv[])
     return 1;
   }
 
+  const bool managed = prk::CUDA::use_managed();
+  const bool graph   = prk::CUDA::use_graph();
+
   std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Startup time (s)     = " << prk::startup_time() << std::endl;
   std::cout << "Grid size            = " << n << std::endl;
+  std::cout << "Memory policy        = " << (managed ? "managed (unified)" : "explicit copy") << std::endl;
+  std::cout << "Iteration loop       = " << (graph ? "CUDA graph replay" : "host launches") << std::endl;
   std::cout << "Tile size            = " << tile_size << std::endl;
   std::cout << "Type of stencil      = " << (star ? "star" : "grid") << std::endl;
   std::cout << "Radius of stencil    = " << radius << std::endl;
@@ -186,34 +194,91 @@ int main(int argc, char* argv[])
 
   const size_t nelems = (size_t)n * (size_t)n;
   const size_t bytes = nelems * sizeof(prk_float);
-  prk_float * h_in;
-  prk_float * h_out;
+  prk_float * h_in = NULL;
+  prk_float * h_out = NULL;
+  prk_float * d_in;
+  prk_float * d_out;
+  if (managed) {
+    // host and device share one allocation; pages migrate on demand
+    prk::CUDA::check( cudaMallocManaged((void**)&d_in, bytes) );
+    prk::CUDA::check( cudaMallocManaged((void**)&d_out, bytes) );
+    for (auto i=0; i<n; i++) {
+      for (auto j=0; j<n; j++) {
+        d_in[i*n+j]  = static_cast<prk_float>(i+j);
+        d_out[i*n+j] = static_cast<prk_float>(0);
+      }
+    }
+    prk::CUDA::prefetch_managed(d_in, bytes);
+    prk::CUDA::prefetch_managed(d_out, bytes);
+    h_in = d_in;
+    h_out = d_out;
+  } else {
 #ifndef __CORIANDERCC__
-  prk::CUDA::check( cudaMallocHost((void**)&h_in, bytes) );
-  prk::CUDA::check( cudaMallocHost((void**)&h_out, bytes) );
+    prk::CUDA::check( cudaMallocHost((void**)&h_in, bytes) );
+    prk::CUDA::check( cudaMallocHost((void**)&h_out, bytes) );
 #else
-  h_in = new prk_float[nelems];
-  h_out = new prk_float[nelems];
+    h_in = new prk_float[nelems];
+    h_out = new prk_float[nelems];
 #endif
 
-  for (auto i=0; i<n; i++) {
-    for (auto j=0; j<n; j++) {
-      h_in[i*n+j]  = static_cast<prk_float>(i+j);
-      h_out[i*n+j] = static_cast<prk_float>(0);
+    for (auto i=0; i<n; i++) {
+      for (auto j=0; j<n; j++) {
+        h_in[i*n+j]  = static_cast<prk_float>(i+j);
+        h_out[i*n+j] = static_cast<prk_float>(0);
+      }
     }
+
+    // copy input from host to device
+    prk::CUDA::check( cudaMalloc((void**)&d_in, bytes) );
+    prk::CUDA::check( cudaMalloc((void**)&d_out, bytes) );
+    prk::CUDA::check( cudaMemcpy(d_in, &(h_in[0]), bytes, cudaMemcpyHostToDevice) );
+    prk::CUDA::check( cudaMemcpy(d_out, &(h_out[0]), bytes, cudaMemcpyHostToDevice) );
   }
 
-  // copy input from host to device
-  prk_float * d_in;
-  prk_float * d_out;
-  prk::CUDA::check( cudaMalloc((void**)&d_in, bytes) );
-  prk::CUDA::check( cudaMalloc((void**)&d_out, bytes) );
-  prk::CUDA::check( cudaMemcpy(d_in, &(h_in[0]), bytes, cudaMemcpyHostToDevice) );
-  prk::CUDA::check( cudaMemcpy(d_out, &(h_out[0]), bytes, cudaMemcpyHostToDevice) );
+  // the warmup iteration absorbs any migration of managed pages
+  auto first_time = prk::wtime();
 
+  double launch_time(0);
+
+#ifndef __CORIANDERCC__
+  if (graph) {
+    // capture one iteration of the loop and replay it
+    cudaStream_t stream;
+    prk::CUDA::check( cudaStreamCreate(&stream) );
+    cudaGraph_t g;
+    cudaGraphExec_t instance;
+    prk::CUDA::check( cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal) );
+    stencil<<<dimGrid, dimBlock, 0, stream>>>(n, d_in, d_out);
+    add<<<dimGrid, dimBlock, 0, stream>>>(n, d_in);
+    prk::CUDA::check( cudaStreamEndCapture(stream, &g) );
+    prk::CUDA::check( cudaGraphInstantiate(&instance, g, NULL, NULL, 0) );
+
+    // warmup replay, also absorbing instantiation and migration
+    prk::CUDA::check( cudaGraphLaunch(instance, stream) );
+    prk::CUDA::check( cudaStreamSynchronize(stream) );
+    first_time = prk::wtime() - first_time;
+
+    stencil_time = prk::wtime();
+    for (auto iter = 1; iter<=iterations; iter++) {
+      const double t0 = prk::wtime();
+      prk::CUDA::check( cudaGraphLaunch(instance, stream) );
+      launch_time += prk::wtime() - t0;
+    }
+    prk::CUDA::check( cudaStreamSynchronize(stream) );
+    stencil_time = prk::wtime() - stencil_time;
+
+    prk::CUDA::check( cudaGraphExecDestroy(instance) );
+    prk::CUDA::check( cudaGraphDestroy(g) );
+    prk::CUDA::check( cudaStreamDestroy(stream) );
+  } else
+#endif
+  {
   for (auto iter = 0; iter<=iterations; iter++) {
 
-    if (iter==1) stencil_time = prk::wtime();
+    if (iter==1) {
+      first_time = prk::wtime() - first_time;
+      stencil_time = prk::wtime();
+    }
 
     // Apply the stencil operator
     stencil<<<dimGrid, dimBlock>>>(n, d_in, d_out);
@@ -227,17 +292,20 @@ int main(int argc, char* argv[])
 #endif
   }
   stencil_time = prk::wtime() - stencil_time;
+  }
 
-  // copy output back to host
-  prk::CUDA::check( cudaMemcpy(&(h_out[0]), d_out, bytes, cudaMemcpyDeviceToHost) );
+  if (!managed) {
+    // copy output back to host
+    prk::CUDA::check( cudaMemcpy(&(h_out[0]), d_out, bytes, cudaMemcpyDeviceToHost) );
 
 #ifdef VERBOSE
-  // copy input back to host - debug only
-  prk::CUDA::check( cudaMemcpy(&(h_in[0]), d_in, bytes, cudaMemcpyDeviceToHost) );
+    // copy input back to host - debug only
+    prk::CUDA::check( cudaMemcpy(&(h_in[0]), d_in, bytes, cudaMemcpyDeviceToHost) );
 #endif
 
-  prk::CUDA::check( cudaFree(d_out) );
-  prk::CUDA::check( cudaFree(d_in) );
+    prk::CUDA::check( cudaFree(d_out) );
+    prk::CUDA::check( cudaFree(d_in) );
+  }
 
   //////////////////////////////////////////////////////////////////////
   // Analyze and output results.
@@ -272,6 +340,15 @@ int main(int argc, char* argv[])
     auto avgtime = stencil_time/iterations;
     std::cout << "Rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops)/avgtime
               << " Avg time (s): " << avgtime << std::endl;
+    if (managed) {
+      // the first iteration pays for any page migration
+      std::cout << "Rate incl. migration (MFlops/s): "
+                << 1.0e-6 * static_cast<double>(flops)*(iterations+1)/(first_time+stencil_time)
+                << " First iteration (s): " << first_time << std::endl;
+    }
+    if (graph) {
+      std::cout << "Graph launch overhead (us): " << 1.e6*launch_time/iterations << std::endl;
+    }
   }
 
   return 0;
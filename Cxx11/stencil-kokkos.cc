@@ -42,6 +42,17 @@
 ///          dimension of the grid, and the number of iterations on the grid
 ///
 ///                <progname> <iterations> <grid size>
+///                           [<tile_size> <star/grid> <radius> <layout>
+///                            <flat/team/both> <team size>]
+///
+///          The layout is one of left, right, stride, or all (default
+///          right); "all" runs the same stencil once per view layout and
+///          reports each, as a standing check that the layout abstraction
+///          delivers the right layout on the configured backend.
+///
+///          The policy selects the flat MDRange stencil (default), a
+///          hierarchical TeamPolicy variant that stages tiles in team
+///          scratch memory, or both for side-by-side comparison.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
@@ -63,12 +74,13 @@
 #include "prk_util.h"
 #include "prk_kokkos.h"
 
-typedef Kokkos::View<double**, Kokkos::LayoutRight> matrix;
-//typedef Kokkos::View<double**, Kokkos::LayoutLeft> matrix;
-//typedef Kokkos::View<double**> matrix;
+typedef Kokkos::View<double**, Kokkos::LayoutRight>  matrix_right;
+typedef Kokkos::View<double**, Kokkos::LayoutLeft>   matrix_left;
+typedef Kokkos::View<double**, Kokkos::LayoutStride> matrix_stride;
 
 #include "stencil_kokkos.hpp"
 
+template <typename matrix>
 void nothing(const int n, const int t, matrix & in, matrix & out)
 {
     std::cout << "You are trying to use a stencil that does not exist." << std::endl;
@@ -76,104 +88,211 @@ void nothing(const int n, const int t, matrix & in, matrix & out)
     std::abort();
 }
 
-int main(int argc, char* argv[])
+// LayoutStride views require the strides to be spelled out; here they mimic
+// LayoutRight, so any rate difference measures the abstraction itself
+template <typename matrix> struct view_maker {
+  static matrix make(const char * label, int n) {
+    return matrix(label, n, n);
+  }
+};
+template <> struct view_maker<matrix_stride> {
+  static matrix_stride make(const char * label, int n) {
+    Kokkos::LayoutStride layout(n, n, n, 1);
+    return matrix_stride(label, layout);
+  }
+};
+
+// Hierarchical variant: one team per tile stages the tile of "in" plus its
+// stencil halo into team scratch memory before applying the stencil, the
+// staging the CUDA variant performs with shared memory.  The generated
+// compact stencils inline their weights, so this variant carries them in a
+// device view instead, initialized as in the classic C versions.
+template <typename matrix>
+int run_team(int iterations, int n, int tile_size, int team_size,
+             bool star, int radius, const char * layout_name)
 {
-  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
-  std::cout << "C++11/Kokkos Stencil execution on 2D grid" << std::endl;
+    std::cout << "Kokkos view layout   = " << layout_name
+              << " (team scratch)" << std::endl;
 
-  Kokkos::initialize (argc, argv);
-  {
-    //////////////////////////////////////////////////////////////////////
-    // Process and test input parameters
-    //////////////////////////////////////////////////////////////////////
+    double stencil_time(0);
 
-    int iterations, n, radius, tile_size;
-    bool star = true;
-    try {
-        if (argc < 3) {
-          throw "Usage: <# iterations> <array dimension> [<tile_size> <star/grid> <radius>]";
-        }
+    matrix in  = view_maker<matrix>::make("in", n);
+    matrix out = view_maker<matrix>::make("out", n);
 
-        // number of times to run the algorithm
-        iterations  = std::atoi(argv[1]);
-        if (iterations < 1) {
-          throw "ERROR: iterations must be >= 1";
+    Kokkos::View<double**> weight("weight", 2*radius+1, 2*radius+1);
+    {
+      auto weight_h = Kokkos::create_mirror_view(weight);
+      for (int ii=0; ii<2*radius+1; ii++)
+        for (int jj=0; jj<2*radius+1; jj++)
+          weight_h(ii,jj) = 0.0;
+      if (star) {
+        for (int ii=1; ii<=radius; ii++) {
+          weight_h(radius,radius+ii) = weight_h(radius+ii,radius) =  1.0/(2.0*ii*radius);
+          weight_h(radius,radius-ii) = weight_h(radius-ii,radius) = -1.0/(2.0*ii*radius);
         }
-
-        // linear grid dimension
-        n  = std::atoi(argv[2]);
-        if (n < 1) {
-          throw "ERROR: grid dimension must be positive";
-        } else if (n > std::floor(std::sqrt(INT_MAX))) {
-          throw "ERROR: grid dimension too large - overflow risk";
+      } else {
+        for (int jj=1; jj<=radius; jj++) {
+          for (int ii=-jj+1; ii<jj; ii++) {
+            weight_h(radius+ii,radius+jj) =  1.0/(4.0*jj*(2.0*jj-1)*radius);
+            weight_h(radius+ii,radius-jj) = -1.0/(4.0*jj*(2.0*jj-1)*radius);
+            weight_h(radius+jj,radius+ii) =  1.0/(4.0*jj*(2.0*jj-1)*radius);
+            weight_h(radius-jj,radius+ii) = -1.0/(4.0*jj*(2.0*jj-1)*radius);
+          }
+          weight_h(radius+jj,radius+jj) =  1.0/(4.0*jj*radius);
+          weight_h(radius-jj,radius-jj) = -1.0/(4.0*jj*radius);
         }
+      }
+      Kokkos::deep_copy(weight, weight_h);
+    }
 
-        // default tile size for tiling of local transpose
-        tile_size = 32;
-        if (argc > 3) {
-            tile_size = std::atoi(argv[3]);
-            if (tile_size <= 0) tile_size = n;
-            if (tile_size > n) tile_size = n;
-        }
+    auto z2     = {0,0};
+    auto n2     = {n,n};
+    auto tile2  = {tile_size,tile_size};
+    auto full   = Kokkos::MDRangePolicy<Kokkos::Rank<2>>(z2,n2,tile2);
 
-        // stencil pattern
-        if (argc > 4) {
-            auto stencil = std::string(argv[4]);
-            auto grid = std::string("grid");
-            star = (stencil == grid) ? false : true;
-        }
+    typedef typename Kokkos::TeamPolicy<>::member_type member_type;
+    typedef Kokkos::View<double**,
+                         Kokkos::DefaultExecutionSpace::scratch_memory_space,
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged>> scratch_matrix;
 
-        // stencil radius
-        radius = 2;
-        if (argc > 5) {
-            radius = std::atoi(argv[5]);
-        }
+    const int interior = n-2*radius;
+    const int ntiles   = (interior+tile_size-1)/tile_size;
+    const int halo     = tile_size+2*radius;
+    auto team = Kokkos::TeamPolicy<>(ntiles*ntiles,
+                                     team_size > 0 ? team_size : Kokkos::AUTO);
+    team.set_scratch_size(0, Kokkos::PerTeam(scratch_matrix::shmem_size(halo,halo)));
 
-        if ( (radius < 1) || (2*radius+1 > n) ) {
-          throw "ERROR: Stencil radius negative or too large";
+    {
+      Kokkos::parallel_for(full, KOKKOS_LAMBDA(int i, int j) {
+          in(i,j)  = static_cast<double>(i+j);
+          out(i,j) = 0.0;
+      });
+      Kokkos::fence();
+
+      for (int iter = 0; iter<=iterations; ++iter) {
+
+        if (iter==1) {
+          Kokkos::fence();
+          stencil_time = prk::wtime();
         }
+
+        Kokkos::parallel_for(team, KOKKOS_LAMBDA(const member_type & m) {
+            const int istart = radius + (m.league_rank()%ntiles)*tile_size;
+            const int jstart = radius + (m.league_rank()/ntiles)*tile_size;
+            const int iend   = istart+tile_size < n-radius ? istart+tile_size : n-radius;
+            const int jend   = jstart+tile_size < n-radius ? jstart+tile_size : n-radius;
+
+            scratch_matrix stage(m.team_scratch(0), halo, halo);
+
+            // cooperative copy of the tile plus halo into scratch
+            Kokkos::parallel_for(Kokkos::TeamThreadRange(m, iend-istart+2*radius),
+              [&](int si) {
+                Kokkos::parallel_for(Kokkos::ThreadVectorRange(m, jend-jstart+2*radius),
+                  [&](int sj) {
+                    stage(si,sj) = in(istart-radius+si, jstart-radius+sj);
+                });
+            });
+            m.team_barrier();
+
+            Kokkos::parallel_for(Kokkos::TeamThreadRange(m, iend-istart), [&](int i) {
+                Kokkos::parallel_for(Kokkos::ThreadVectorRange(m, jend-jstart),
+                  [&](int j) {
+                    double tmp(0);
+                    if (star) {
+                      for (int jj=-radius; jj<=radius; jj++)
+                        tmp += weight(radius,radius+jj)*stage(i+radius,j+radius+jj);
+                      for (int ii=-radius; ii<0; ii++)
+                        tmp += weight(radius+ii,radius)*stage(i+radius+ii,j+radius);
+                      for (int ii=1; ii<=radius; ii++)
+                        tmp += weight(radius+ii,radius)*stage(i+radius+ii,j+radius);
+                    } else {
+                      for (int ii=-radius; ii<=radius; ii++)
+                        for (int jj=-radius; jj<=radius; jj++)
+                          tmp += weight(radius+ii,radius+jj)*stage(i+radius+ii,j+radius+jj);
+                    }
+                    out(istart+i,jstart+j) += tmp;
+                });
+            });
+        });
+
+        Kokkos::parallel_for(full, KOKKOS_LAMBDA(int i, int j) {
+            in(i,j) += 1.0;
+        });
+      }
+      Kokkos::fence();
+      stencil_time = prk::wtime() - stencil_time;
     }
-    catch (const char * e) {
-      std::cout << e << std::endl;
+
+    //////////////////////////////////////////////////////////////////////
+    // Analyze and output results.
+    //////////////////////////////////////////////////////////////////////
+
+    size_t active_points = static_cast<size_t>(n-2*radius)*static_cast<size_t>(n-2*radius);
+
+    double norm(0);
+    auto r2     = {radius,radius};
+    auto nr2    = {n-radius,n-radius};
+    auto inside = Kokkos::MDRangePolicy<Kokkos::Rank<2>>(r2,nr2,tile2);
+    Kokkos::parallel_reduce(inside, KOKKOS_LAMBDA(int i, int j, double & norm) {
+        norm += std::fabs(out(i,j));
+    }, norm);
+    Kokkos::fence();
+    norm /= active_points;
+
+    // verify correctness
+    double const epsilon(1.0e-8);
+    double reference_norm = 2.*(iterations+1.);
+    if (std::fabs(norm-reference_norm) > epsilon) {
+      std::cout << "ERROR: L1 norm = " << norm
+                << " Reference L1 norm = " << reference_norm << std::endl;
       return 1;
+    } else {
+      std::cout << "Solution validates" << std::endl;
+#ifdef VERBOSE
+      std::cout << "L1 norm = " << norm
+                << " Reference L1 norm = " << reference_norm << std::endl;
+#endif
+      const int stencil_size = star ? 4*radius+1 : (2*radius+1)*(2*radius+1);
+      size_t flops = (2.*stencil_size+1.) * active_points;
+      auto avgtime = stencil_time/iterations;
+      std::cout << "Rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops)/avgtime
+            << " Avg time (s): " << avgtime << std::endl;
     }
 
-    std::cout << "Number of iterations = " << iterations << std::endl;
-    std::cout << "Grid size            = " << n << std::endl;
-    std::cout << "Tile size            = " << tile_size << std::endl;
-    std::cout << "Type of stencil      = " << (star ? "star" : "grid") << std::endl;
-    std::cout << "Radius of stencil    = " << radius << std::endl;
-    std::cout << "Compact representation of stencil loop body" << std::endl;
-    std::cout << "Kokkos execution space: " << Kokkos::DefaultExecutionSpace::name() << std::endl;
+    return 0;
+}
 
-    auto stencil = nothing;
+// identical logic for every layout, so that any rate difference between
+// the instantiations is attributable to the layout alone
+template <typename matrix>
+int run(int iterations, int n, int tile_size, bool star, int radius,
+        const char * layout_name)
+{
+    std::cout << "Kokkos view layout   = " << layout_name << std::endl;
+
+    auto stencil = nothing<matrix>;
     if (star) {
         switch (radius) {
-            case 1: stencil = star1; break;
-            case 2: stencil = star2; break;
-            case 3: stencil = star3; break;
-            case 4: stencil = star4; break;
-            case 5: stencil = star5; break;
+            case 1: stencil = star1<matrix>; break;
+            case 2: stencil = star2<matrix>; break;
+            case 3: stencil = star3<matrix>; break;
+            case 4: stencil = star4<matrix>; break;
+            case 5: stencil = star5<matrix>; break;
         }
     } else {
         switch (radius) {
-            case 1: stencil = grid1; break;
-            case 2: stencil = grid2; break;
-            case 3: stencil = grid3; break;
-            case 4: stencil = grid4; break;
-            case 5: stencil = grid5; break;
+            case 1: stencil = grid1<matrix>; break;
+            case 2: stencil = grid2<matrix>; break;
+            case 3: stencil = grid3<matrix>; break;
+            case 4: stencil = grid4<matrix>; break;
+            case 5: stencil = grid5<matrix>; break;
         }
     }
 
-    //////////////////////////////////////////////////////////////////////
-    // Allocate space and perform the computation
-    //////////////////////////////////////////////////////////////////////
-
     double stencil_time(0);
 
-    // row-major 2D array
-    matrix in("in", n, n);
-    matrix out("out", n, n);
+    matrix in  = view_maker<matrix>::make("in", n);
+    matrix out = view_maker<matrix>::make("out", n);
 
     auto z2     = {0,0};
     auto n2     = {n,n};
@@ -238,10 +357,140 @@ int main(int argc, char* argv[])
       auto avgtime = stencil_time/iterations;
       std::cout << "Rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops)/avgtime
             << " Avg time (s): " << avgtime << std::endl;
-  }
+    }
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11/Kokkos Stencil execution on 2D grid" << std::endl;
+
+  int status = 0;
+
+  Kokkos::initialize (argc, argv);
+  {
+    //////////////////////////////////////////////////////////////////////
+    // Process and test input parameters
+    //////////////////////////////////////////////////////////////////////
+
+    int iterations, n, radius, tile_size;
+    bool star = true;
+    std::string layout("right");
+    std::string policy("flat");
+    int team_size = 0;
+    try {
+        if (argc < 3) {
+          throw "Usage: <# iterations> <array dimension> [<tile_size> <star/grid> <radius> <layout> <flat/team/both> <team size>]";
+        }
+
+        // number of times to run the algorithm
+        iterations  = std::atoi(argv[1]);
+        if (iterations < 1) {
+          throw "ERROR: iterations must be >= 1";
+        }
+
+        // linear grid dimension
+        n  = std::atoi(argv[2]);
+        if (n < 1) {
+          throw "ERROR: grid dimension must be positive";
+        } else if (n > std::floor(std::sqrt(INT_MAX))) {
+          throw "ERROR: grid dimension too large - overflow risk";
+        }
+
+        // default tile size for tiling of local transpose
+        tile_size = 32;
+        if (argc > 3) {
+            tile_size = std::atoi(argv[3]);
+            if (tile_size <= 0) tile_size = n;
+            if (tile_size > n) tile_size = n;
+        }
+
+        // stencil pattern
+        if (argc > 4) {
+            auto stencil = std::string(argv[4]);
+            auto grid = std::string("grid");
+            star = (stencil == grid) ? false : true;
+        }
+
+        // stencil radius
+        radius = 2;
+        if (argc > 5) {
+            radius = std::atoi(argv[5]);
+        }
+
+        if ( (radius < 1) || (2*radius+1 > n) ) {
+          throw "ERROR: Stencil radius negative or too large";
+        }
+
+        // view layout
+        if (argc > 6) {
+            layout = std::string(argv[6]);
+            if (layout != "left" && layout != "right" &&
+                layout != "stride" && layout != "all") {
+              throw "ERROR: layout must be left, right, stride, or all";
+            }
+        }
+
+        // parallel policy: flat MDRange, hierarchical team with scratch
+        // staging, or both for side-by-side comparison
+        if (argc > 7) {
+            policy = std::string(argv[7]);
+            if (policy != "flat" && policy != "team" && policy != "both") {
+              throw "ERROR: policy must be flat, team, or both";
+            }
+        }
+
+        // team size for the team policy; <= 0 lets Kokkos choose
+        if (argc > 8) {
+            team_size = std::atoi(argv[8]);
+        }
+    }
+    catch (const char * e) {
+      std::cout << e << std::endl;
+      return 1;
+    }
+
+    std::cout << "Number of iterations = " << iterations << std::endl;
+    std::cout << "Grid size            = " << n << std::endl;
+    std::cout << "Tile size            = " << tile_size << std::endl;
+    std::cout << "Type of stencil      = " << (star ? "star" : "grid") << std::endl;
+    std::cout << "Radius of stencil    = " << radius << std::endl;
+    std::cout << "Compact representation of stencil loop body" << std::endl;
+    std::cout << "Parallel policy      = " << policy;
+    if (policy != "flat") {
+      if (team_size > 0) std::cout << " (team size " << team_size << ")";
+      else               std::cout << " (team size auto)";
+    }
+    std::cout << std::endl;
+    std::cout << "Kokkos execution space: " << Kokkos::DefaultExecutionSpace::name() << std::endl;
+
+    //////////////////////////////////////////////////////////////////////
+    // Allocate space and perform the computation
+    //////////////////////////////////////////////////////////////////////
+
+    if (layout == "right" || layout == "all") {
+      if (policy != "team")
+        status |= run<matrix_right>(iterations, n, tile_size, star, radius, "LayoutRight");
+      if (policy != "flat")
+        status |= run_team<matrix_right>(iterations, n, tile_size, team_size, star, radius, "LayoutRight");
+    }
+    if (layout == "left" || layout == "all") {
+      if (policy != "team")
+        status |= run<matrix_left>(iterations, n, tile_size, star, radius, "LayoutLeft");
+      if (policy != "flat")
+        status |= run_team<matrix_left>(iterations, n, tile_size, team_size, star, radius, "LayoutLeft");
+    }
+    if (layout == "stride" || layout == "all") {
+      if (policy != "team")
+        status |= run<matrix_stride>(iterations, n, tile_size, star, radius, "LayoutStride");
+      if (policy != "flat")
+        status |= run_team<matrix_stride>(iterations, n, tile_size, team_size, star, radius, "LayoutStride");
+    }
 
   }
   Kokkos::finalize();
 
-  return 0;
+  return status;
 }
@@ -0,0 +1,320 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    Stencil
+///
+/// PURPOSE: This program tests the efficiency with which a space-invariant,
+///          linear, symmetric filter (stencil) can be applied to a square
+///          grid or image.
+///
+/// USAGE:   The program takes as input the linear
+///          dimension of the grid, and the number of iterations on the grid
+///
+///                <progname> <iterations> <grid size> [<star/grid> <radius> <layout>]
+///
+///          The output consists of diagnostics to assure
+///          correctness, and of timing statistics.
+///
+///          This variant stores the grid either row-major or along a
+///          Morton (Z-order) space-filling curve; the index math is
+///          hidden behind a layout policy template so the stencil body
+///          is identical for both.  The stencil weights are computed at
+///          run time (as in the C versions) instead of using the
+///          generated operators, which bake in row-major indexing.
+///
+/// HISTORY: - Written by Rob Van der Wijngaart, February 2009.
+///          - RvdW: Removed unrolling pragmas for clarity;
+///            added constant to array "in" at end of each iteration to force
+///            refreshing of neighbor data in parallel versions; August 2013
+///          - Converted to C++11 by Jeff Hammond, December, 2017.
+///          - Morton-order layout policy added later.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+
+#define WEIGHT(ii,jj) weight[(ii+radius)*(2*radius+1) + (jj+radius)]
+
+// Storage layout policies.  The stencil loops are templated on the
+// policy so that the kernel body never spells out the index math.
+class RowMajor {
+  public:
+    static size_t size(const int n) {
+      return static_cast<size_t>(n)*static_cast<size_t>(n);
+    }
+    static inline size_t index(const int i, const int j, const int n) {
+      return static_cast<size_t>(i)*static_cast<size_t>(n)+static_cast<size_t>(j);
+    }
+    static const char * name(void) { return "row-major"; }
+};
+
+class Morton {
+  private:
+    // spread the low 32 bits of x into the even bit positions
+    static inline size_t spread(const size_t x) {
+      size_t v = x;
+      v = (v | (v<<16)) & UINT64_C(0x0000FFFF0000FFFF);
+      v = (v | (v<< 8)) & UINT64_C(0x00FF00FF00FF00FF);
+      v = (v | (v<< 4)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+      v = (v | (v<< 2)) & UINT64_C(0x3333333333333333);
+      v = (v | (v<< 1)) & UINT64_C(0x5555555555555555);
+      return v;
+    }
+  public:
+    // Morton indexing needs a power-of-two bounding square, so the
+    // allocation is padded up to the next one
+    static size_t size(const int n) {
+      int lg(0);
+      while ((1<<lg) < n) lg++;
+      return static_cast<size_t>(1) << (2*lg);
+    }
+    static inline size_t index(const int i, const int j, const int n) {
+      return (spread(i)<<1) | spread(j);
+    }
+    static const char * name(void) { return "Morton"; }
+};
+
+template <class Layout>
+void apply_star(const int n, const int radius, const std::vector<double> & weight,
+                const double * RESTRICT in, double * RESTRICT out)
+{
+  for (auto i=radius; i<n-radius; i++) {
+    for (auto j=radius; j<n-radius; j++) {
+      double tmp(0);
+      for (auto jj=-radius; jj<=radius; jj++) {
+        tmp += WEIGHT(0,jj) * in[Layout::index(i,j+jj,n)];
+      }
+      for (auto ii=-radius; ii<0; ii++) {
+        tmp += WEIGHT(ii,0) * in[Layout::index(i+ii,j,n)];
+      }
+      for (auto ii=1; ii<=radius; ii++) {
+        tmp += WEIGHT(ii,0) * in[Layout::index(i+ii,j,n)];
+      }
+      out[Layout::index(i,j,n)] += tmp;
+    }
+  }
+}
+
+template <class Layout>
+void apply_grid(const int n, const int radius, const std::vector<double> & weight,
+                const double * RESTRICT in, double * RESTRICT out)
+{
+  for (auto i=radius; i<n-radius; i++) {
+    for (auto j=radius; j<n-radius; j++) {
+      double tmp(0);
+      for (auto ii=-radius; ii<=radius; ii++) {
+        for (auto jj=-radius; jj<=radius; jj++) {
+          tmp += WEIGHT(ii,jj) * in[Layout::index(i+ii,j+jj,n)];
+        }
+      }
+      out[Layout::index(i,j,n)] += tmp;
+    }
+  }
+}
+
+template <class Layout>
+void run(const int iterations, const int n, const int radius, const bool star,
+         double & stencil_time, double & norm)
+{
+  // fill the stencil weights to reflect a discrete divergence operator,
+  // as in the C versions of this kernel
+  std::vector<double> weight((2*radius+1)*(2*radius+1), 0.0);
+  if (star) {
+    for (auto jj=1; jj<=radius; jj++) {
+      WEIGHT(0,jj) = WEIGHT(jj,0) =  1.0/(2.0*jj*radius);
+      WEIGHT(0,-jj) = WEIGHT(-jj,0) = -1.0/(2.0*jj*radius);
+    }
+  } else {
+    for (auto jj=1; jj<=radius; jj++) {
+      for (auto ii=-jj+1; ii<jj; ii++) {
+        WEIGHT(ii,jj) = WEIGHT(jj,ii) =  1.0/(4.0*jj*(2.0*jj-1)*radius);
+        WEIGHT(ii,-jj) = WEIGHT(-jj,ii) = -1.0/(4.0*jj*(2.0*jj-1)*radius);
+      }
+      WEIGHT(jj,jj)   =  1.0/(4.0*jj*radius);
+      WEIGHT(-jj,-jj) = -1.0/(4.0*jj*radius);
+    }
+  }
+
+  // padded for the Morton layout; the padding is never touched after
+  // initialization
+  const size_t nelems = Layout::size(n);
+  double * RESTRICT in  = new double[nelems];
+  double * RESTRICT out = new double[nelems];
+  for (size_t k=0; k<nelems; k++) {
+    in[k]  = 0.0;
+    out[k] = 0.0;
+  }
+  for (auto i=0; i<n; i++) {
+    for (auto j=0; j<n; j++) {
+      in[Layout::index(i,j,n)] = static_cast<double>(i+j);
+    }
+  }
+
+  for (auto iter = 0; iter<=iterations; iter++) {
+
+    if (iter==1) stencil_time = prk::wtime();
+
+    // Apply the stencil operator
+    if (star) {
+      apply_star<Layout>(n, radius, weight, in, out);
+    } else {
+      apply_grid<Layout>(n, radius, weight, in, out);
+    }
+    // Add constant to solution to force refresh of neighbor data
+    for (auto i=0; i<n; i++) {
+      for (auto j=0; j<n; j++) {
+        in[Layout::index(i,j,n)] += 1.0;
+      }
+    }
+  }
+  stencil_time = prk::wtime() - stencil_time;
+
+  // compute L1 norm of the interior
+  norm = 0.0;
+  for (auto i=radius; i<n-radius; i++) {
+    for (auto j=radius; j<n-radius; j++) {
+      norm += std::fabs(out[Layout::index(i,j,n)]);
+    }
+  }
+
+  delete[] out;
+  delete[] in;
+}
+
+int main(int argc, char* argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11 Stencil execution on 2D grid (layout policy)" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Process and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations, n, radius;
+  bool star = true;
+  bool morton = false;
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <array dimension> [<star/grid> <radius> <rowmajor/morton>]";
+      }
+
+      // number of times to run the algorithm
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      // linear grid dimension
+      n  = std::atoi(argv[2]);
+      if (n < 1) {
+        throw "ERROR: grid dimension must be positive";
+      } else if (n > std::floor(std::sqrt(INT_MAX))) {
+        throw "ERROR: grid dimension too large - overflow risk";
+      }
+
+      // stencil pattern
+      if (argc > 3) {
+          auto stencil = std::string(argv[3]);
+          auto grid = std::string("grid");
+          star = (stencil == grid) ? false : true;
+      }
+
+      // stencil radius
+      radius = 2;
+      if (argc > 4) {
+          radius = std::atoi(argv[4]);
+      }
+
+      if ( (radius < 1) || (2*radius+1 > n) ) {
+        throw "ERROR: Stencil radius negative or too large";
+      }
+
+      // grid storage layout
+      if (argc > 5) {
+          auto layout = std::string(argv[5]);
+          morton = (layout == std::string("morton"));
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Grid size            = " << n << std::endl;
+  std::cout << "Type of stencil      = " << (star ? "star" : "grid") << std::endl;
+  std::cout << "Radius of stencil    = " << radius << std::endl;
+  std::cout << "Grid layout          = " << (morton ? Morton::name() : RowMajor::name()) << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  double stencil_time(0);
+  double norm(0);
+  if (morton) {
+    run<Morton>(iterations, n, radius, star, stencil_time, norm);
+  } else {
+    run<RowMajor>(iterations, n, radius, star, stencil_time, norm);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // Analyze and output results.
+  //////////////////////////////////////////////////////////////////////
+
+  // interior of grid with respect to stencil
+  size_t active_points = static_cast<size_t>(n-2*radius)*static_cast<size_t>(n-2*radius);
+  norm /= active_points;
+
+  // verify correctness
+  const double epsilon = 1.0e-8;
+  double reference_norm = 2.*(iterations+1.);
+  if (std::fabs(norm-reference_norm) > epsilon) {
+    std::cout << "ERROR: L1 norm = " << norm
+              << " Reference L1 norm = " << reference_norm << std::endl;
+    return 1;
+  } else {
+    std::cout << "Solution validates" << std::endl;
+#ifdef VERBOSE
+    std::cout << "L1 norm = " << norm
+              << " Reference L1 norm = " << reference_norm << std::endl;
+#endif
+    const int stencil_size = star ? 4*radius+1 : (2*radius+1)*(2*radius+1);
+    size_t flops = (2L*(size_t)stencil_size+1L) * active_points;
+    auto avgtime = stencil_time/iterations;
+    std::cout << "Rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops)/avgtime
+              << " Avg time (s): " << avgtime << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,468 @@
+
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    Stencil
+///
+/// PURPOSE: This program tests the efficiency with which a space-invariant,
+///          linear, symmetric filter (stencil) can be applied to a square
+///          grid or image that is partitioned across the GPUs of a
+///          single node.
+///
+/// USAGE:   The program takes as input the linear
+///          dimension of the grid, and the number of iterations on the grid
+///
+///                <progname> <iterations> <grid size> [<# gpus>] [<exchange: p2p/nccl>] [<radius>]
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, and of timing statistics.
+///
+/// NOTES:   The grid is cut into horizontal slabs, one per device, with
+///          a halo of radius rows on either side.  Halos travel with
+///          cudaMemcpyPeerAsync, which uses the direct peer path (NVLink
+///          or PCIe P2P) where cudaDeviceEnablePeerAccess succeeds and is
+///          staged through the host otherwise; each link's sustained
+///          bandwidth is reported separately, so the NVLink topology can
+///          be checked against stencil-shaped traffic rather than
+///          all-reduce.  Building with -DUSE_NCCL adds an exchange mode
+///          that routes the same halos through NCCL point-to-point calls.
+///          Only the star pattern is supported.
+///
+/// HISTORY: - Written by Rob Van der Wijngaart, February 2009.
+///          - RvdW: Removed unrolling pragmas for clarity;
+///            added constant to array "in" at end of each iteration to force
+///            refreshing of neighbor data in parallel versions; August 2013
+///          - Converted to C++11 by Jeff Hammond, December, 2017.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+#include "prk_cuda.h"
+
+#if defined(USE_NCCL)
+#include <nccl.h>
+
+namespace prk {
+    namespace NCCL {
+        void check(ncclResult_t rc)
+        {
+            if (rc==ncclSuccess) {
+                return;
+            } else {
+                std::cerr << "PRK NCCL error: " << ncclGetErrorString(rc) << std::endl;
+                std::abort();
+            }
+        }
+    }
+}
+#endif
+
+const int tile_size = 32;
+
+/// Apply the star stencil to the local rows [lo,hi) of a slab of total
+/// height rows; the halo rows above and below the owned block are only
+/// ever read.
+template <int R>
+__global__ void star_slab(const int rows, const int n, const int lo, const int hi,
+                          const prk_float * in, prk_float * out)
+{
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    const int j = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if ( (lo <= i) && (i < hi) && (R <= j) && (j < n-R) ) {
+        prk_float sum(0);
+        #pragma unroll
+        for (int r=1; r<=R; r++) {
+            const prk_float w = (prk_float)1 / (prk_float)(2*r*R);
+            sum += w * ( in[(size_t)i*n+(j+r)] + in[((size_t)i+r)*n+j]
+                       - in[(size_t)i*n+(j-r)] - in[((size_t)i-r)*n+j] );
+        }
+        out[(size_t)i*n+j] += sum;
+    }
+}
+
+__global__ void add_slab(const int rows, const int n, const int lo, const int hi,
+                         prk_float * in)
+{
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    const int j = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if ( (lo <= i) && (i < hi) && (j < n) ) {
+        in[(size_t)i*n+j] += (prk_float)1;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11/CUDA Stencil execution on 2D grid (multi-GPU)" << std::endl;
+
+  prk::CUDA::info info;
+  info.print();
+
+  //////////////////////////////////////////////////////////////////////
+  // Process and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations, n, radius, ngpus;
+  bool nccl = false;
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <array dimension> [<# gpus>] [<exchange: p2p/nccl>] [<radius>]";
+      }
+
+      // number of times to run the algorithm
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      // linear grid dimension
+      n  = std::atoi(argv[2]);
+      if (n < 1) {
+        throw "ERROR: grid dimension must be positive";
+      } else if (n > std::floor(std::sqrt(INT_MAX))) {
+        throw "ERROR: grid dimension too large - overflow risk";
+      }
+
+      int available;
+      prk::CUDA::check( cudaGetDeviceCount(&available) );
+
+      // number of devices to spread the grid over
+      ngpus = available;
+      if (argc > 3) {
+          ngpus = std::atoi(argv[3]);
+          if (ngpus < 1) {
+            throw "ERROR: number of gpus must be positive";
+          }
+          if (ngpus > available) {
+            throw "ERROR: more gpus requested than available";
+          }
+      }
+
+      // halo exchange mechanism
+      if (argc > 4) {
+          auto exchange = std::string(argv[4]);
+          if (exchange == "nccl") {
+#if defined(USE_NCCL)
+              nccl = true;
+#else
+              throw "ERROR: nccl exchange requires building with USE_NCCL";
+#endif
+          } else if (exchange != "p2p") {
+              throw "ERROR: exchange must be p2p or nccl";
+          }
+      }
+
+      // stencil radius
+      radius = 2;
+      if (argc > 5) {
+          radius = std::atoi(argv[5]);
+      }
+
+      if ( (radius < 1) || (2*radius+1 > n) ) {
+        throw "ERROR: Stencil radius negative or too large";
+      }
+
+      // every device must own at least one halo's worth of rows
+      if (n/ngpus < radius) {
+        throw "ERROR: grid too small for this many gpus";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Grid size            = " << n << std::endl;
+  std::cout << "Number of gpus       = " << ngpus << std::endl;
+  std::cout << "Halo exchange        = " << (nccl ? "nccl" : "p2p copies") << std::endl;
+  std::cout << "Type of stencil      = star" << std::endl;
+  std::cout << "Radius of stencil    = " << radius << std::endl;
+
+  auto stencil = star_slab<2>;
+  switch (radius) {
+      case 1: stencil = star_slab<1>; break;
+      case 2: stencil = star_slab<2>; break;
+      case 3: stencil = star_slab<3>; break;
+      case 4: stencil = star_slab<4>; break;
+      case 5: stencil = star_slab<5>; break;
+      default:
+          std::cout << "ERROR: Please add the requested radius." << std::endl;
+          return 1;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // Partition the grid and wire up the devices
+  //////////////////////////////////////////////////////////////////////
+
+  // device g owns rows [start[g],start[g+1]); leftover rows go to the
+  // low devices
+  std::vector<int> start(ngpus+1,0);
+  for (int g=0; g<ngpus; g++) {
+      start[g+1] = start[g] + n/ngpus + ((g < n%ngpus) ? 1 : 0);
+  }
+
+  // direct peer access for the slab neighbors, where the topology has it
+  std::vector<bool> peered(ngpus,false);
+  if (!nccl) {
+      for (int g=0; g<ngpus-1; g++) {
+          int fwd(0), bwd(0);
+          prk::CUDA::check( cudaDeviceCanAccessPeer(&fwd, g, g+1) );
+          prk::CUDA::check( cudaDeviceCanAccessPeer(&bwd, g+1, g) );
+          if (fwd && bwd) {
+              peered[g] = true;
+              prk::CUDA::check( cudaSetDevice(g) );
+              prk::CUDA::check( cudaDeviceEnablePeerAccess(g+1, 0) );
+              prk::CUDA::check( cudaSetDevice(g+1) );
+              prk::CUDA::check( cudaDeviceEnablePeerAccess(g, 0) );
+          }
+      }
+  }
+
+#if defined(USE_NCCL)
+  std::vector<ncclComm_t> comm(ngpus);
+  if (nccl) {
+      prk::NCCL::check( ncclCommInitAll(comm.data(), ngpus, NULL) );
+  }
+  const ncclDataType_t nccl_type = (sizeof(prk_float)==8) ? ncclDouble : ncclFloat;
+#endif
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  auto stencil_time = 0.0;
+
+  const size_t nelems = (size_t)n * (size_t)n;
+  const size_t bytes = nelems * sizeof(prk_float);
+  const size_t halo_elems = (size_t)radius * (size_t)n;
+  const size_t halo_bytes = halo_elems * sizeof(prk_float);
+
+  prk_float * h_in;
+  prk_float * h_out;
+  prk::CUDA::check( cudaMallocHost((void**)&h_in, bytes) );
+  prk::CUDA::check( cudaMallocHost((void**)&h_out, bytes) );
+
+  for (int i=0; i<n; i++) {
+    for (int j=0; j<n; j++) {
+      h_in[(size_t)i*n+j]  = static_cast<prk_float>(i+j);
+      h_out[(size_t)i*n+j] = static_cast<prk_float>(0);
+    }
+  }
+
+  std::vector<prk_float*> d_in(ngpus), d_out(ngpus);
+  std::vector<cudaStream_t> stream(ngpus);
+  std::vector<dim3> dimGrid(ngpus);
+  std::vector<int> rows(ngpus), lo(ngpus), hi(ngpus);
+  dim3 dimBlock(tile_size, tile_size, 1);
+
+  for (int g=0; g<ngpus; g++) {
+      const int owned = start[g+1]-start[g];
+      rows[g] = owned + 2*radius;
+      // local row i holds global row start[g]+i-radius; the stencil only
+      // updates rows in the global interior
+      lo[g] = std::max(radius, start[g])   - start[g] + radius;
+      hi[g] = std::min(n-radius, start[g+1]) - start[g] + radius;
+
+      prk::CUDA::check( cudaSetDevice(g) );
+      prk::CUDA::check( cudaStreamCreate(&stream[g]) );
+      const size_t slab_bytes = (size_t)rows[g] * (size_t)n * sizeof(prk_float);
+      prk::CUDA::check( cudaMalloc((void**)&d_in[g],  slab_bytes) );
+      prk::CUDA::check( cudaMalloc((void**)&d_out[g], slab_bytes) );
+      prk::CUDA::check( cudaMemset(d_in[g],  0, slab_bytes) );
+      prk::CUDA::check( cudaMemset(d_out[g], 0, slab_bytes) );
+      // owned rows start below the top halo; halos are filled by the
+      // first exchange
+      prk::CUDA::check( cudaMemcpy(d_in[g] + halo_elems,
+                                   h_in + (size_t)start[g]*n,
+                                   (size_t)owned*n*sizeof(prk_float),
+                                   cudaMemcpyHostToDevice) );
+      dimGrid[g] = dim3(prk::divceil(rows[g],tile_size),prk::divceil(n,tile_size),1);
+      info.checkDims(dimBlock, dimGrid[g]);
+  }
+
+  // per-link halo traffic timing; link 2*g is g->g+1, link 2*g+1 is g+1->g
+  const int num_links = 2*(ngpus-1);
+  std::vector<cudaEvent_t> link_start(num_links), link_stop(num_links);
+  std::vector<double> link_time(num_links,0.0);
+  for (int g=0; g<ngpus-1; g++) {
+      prk::CUDA::check( cudaSetDevice(g) );
+      prk::CUDA::check( cudaEventCreate(&link_start[2*g]) );
+      prk::CUDA::check( cudaEventCreate(&link_stop[2*g]) );
+      prk::CUDA::check( cudaSetDevice(g+1) );
+      prk::CUDA::check( cudaEventCreate(&link_start[2*g+1]) );
+      prk::CUDA::check( cudaEventCreate(&link_stop[2*g+1]) );
+  }
+  double exchange_time = 0.0;
+
+  for (int iter = 0; iter<=iterations; iter++) {
+
+    if (iter==1) stencil_time = prk::wtime();
+    const bool timed = (iter>=1);
+
+    // refresh the halos; the bottom owned rows of g feed the top halo
+    // of g+1 and vice versa
+    const double x0 = prk::wtime();
+    if (nccl) {
+#if defined(USE_NCCL)
+      prk::NCCL::check( ncclGroupStart() );
+      for (int g=0; g<ngpus-1; g++) {
+          const size_t bottom = (size_t)(rows[g]-2*radius) * (size_t)n;
+          prk::NCCL::check( ncclSend(d_in[g] + bottom, halo_elems, nccl_type,
+                                     g+1, comm[g], stream[g]) );
+          prk::NCCL::check( ncclRecv(d_in[g+1], halo_elems, nccl_type,
+                                     g, comm[g+1], stream[g+1]) );
+          prk::NCCL::check( ncclSend(d_in[g+1] + halo_elems, halo_elems, nccl_type,
+                                     g, comm[g+1], stream[g+1]) );
+          prk::NCCL::check( ncclRecv(d_in[g] + (size_t)(rows[g]-radius)*n, halo_elems,
+                                     nccl_type, g+1, comm[g], stream[g]) );
+      }
+      prk::NCCL::check( ncclGroupEnd() );
+#endif
+    } else {
+      for (int g=0; g<ngpus-1; g++) {
+          const size_t bottom = (size_t)(rows[g]-2*radius) * (size_t)n;
+          prk::CUDA::check( cudaSetDevice(g) );
+          if (timed) prk::CUDA::check( cudaEventRecord(link_start[2*g], stream[g]) );
+          prk::CUDA::check( cudaMemcpyPeerAsync(d_in[g+1], g+1,
+                                                d_in[g] + bottom, g,
+                                                halo_bytes, stream[g]) );
+          if (timed) prk::CUDA::check( cudaEventRecord(link_stop[2*g], stream[g]) );
+          prk::CUDA::check( cudaSetDevice(g+1) );
+          if (timed) prk::CUDA::check( cudaEventRecord(link_start[2*g+1], stream[g+1]) );
+          prk::CUDA::check( cudaMemcpyPeerAsync(d_in[g] + (size_t)(rows[g]-radius)*n, g,
+                                                d_in[g+1] + halo_elems, g+1,
+                                                halo_bytes, stream[g+1]) );
+          if (timed) prk::CUDA::check( cudaEventRecord(link_stop[2*g+1], stream[g+1]) );
+      }
+    }
+    for (int g=0; g<ngpus; g++) {
+        prk::CUDA::check( cudaSetDevice(g) );
+        prk::CUDA::check( cudaStreamSynchronize(stream[g]) );
+    }
+    if (timed) {
+        exchange_time += prk::wtime() - x0;
+        if (!nccl) {
+            for (int l=0; l<num_links; l++) {
+                float ms(0);
+                prk::CUDA::check( cudaEventElapsedTime(&ms, link_start[l], link_stop[l]) );
+                link_time[l] += 1.e-3*ms;
+            }
+        }
+    }
+
+    // apply the stencil operator and refresh the owned rows
+    for (int g=0; g<ngpus; g++) {
+        prk::CUDA::check( cudaSetDevice(g) );
+        stencil<<<dimGrid[g], dimBlock, 0, stream[g]>>>(rows[g], n, lo[g], hi[g], d_in[g], d_out[g]);
+        add_slab<<<dimGrid[g], dimBlock, 0, stream[g]>>>(rows[g], n, radius, rows[g]-radius, d_in[g]);
+    }
+    for (int g=0; g<ngpus; g++) {
+        prk::CUDA::check( cudaSetDevice(g) );
+        prk::CUDA::check( cudaStreamSynchronize(stream[g]) );
+    }
+  }
+  stencil_time = prk::wtime() - stencil_time;
+
+  // gather the owned rows of the output slabs
+  for (int g=0; g<ngpus; g++) {
+      prk::CUDA::check( cudaSetDevice(g) );
+      prk::CUDA::check( cudaMemcpy(h_out + (size_t)start[g]*n,
+                                   d_out[g] + halo_elems,
+                                   (size_t)(start[g+1]-start[g])*n*sizeof(prk_float),
+                                   cudaMemcpyDeviceToHost) );
+      prk::CUDA::check( cudaFree(d_out[g]) );
+      prk::CUDA::check( cudaFree(d_in[g]) );
+      prk::CUDA::check( cudaStreamDestroy(stream[g]) );
+  }
+#if defined(USE_NCCL)
+  if (nccl) for (int g=0; g<ngpus; g++) ncclCommDestroy(comm[g]);
+#endif
+
+  //////////////////////////////////////////////////////////////////////
+  // Analyze and output results.
+  //////////////////////////////////////////////////////////////////////
+
+  // interior of grid with respect to stencil
+  size_t active_points = static_cast<size_t>(n-2*radius)*static_cast<size_t>(n-2*radius);
+  // compute L1 norm
+  double norm = 0.0;
+  for (int i=radius; i<n-radius; i++) {
+    for (int j=radius; j<n-radius; j++) {
+      norm += std::fabs(h_out[(size_t)i*n+j]);
+    }
+  }
+  norm /= active_points;
+
+  // verify correctness
+  const double epsilon = 1.0e-8;
+  double reference_norm = 2.*(iterations+1.);
+  if (std::fabs(norm-reference_norm) > epsilon) {
+    std::cout << "ERROR: L1 norm = " << norm
+              << " Reference L1 norm = " << reference_norm << std::endl;
+    return 1;
+  } else {
+    std::cout << "Solution validates" << std::endl;
+#ifdef VERBOSE
+    std::cout << "L1 norm = " << norm
+              << " Reference L1 norm = " << reference_norm << std::endl;
+#endif
+    const int stencil_size = 4*radius+1;
+    size_t flops = (2L*(size_t)stencil_size+1L) * active_points;
+    auto avgtime = stencil_time/iterations;
+    std::cout << "Rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops)/avgtime
+              << " Avg time (s): " << avgtime << std::endl;
+    if (ngpus > 1) {
+      std::cout << "Halo exchange time (s): " << exchange_time/iterations
+                << " (avg per iteration)" << std::endl;
+      const double link_bytes = static_cast<double>(halo_bytes)*iterations;
+      if (nccl) {
+        std::cout << "Halo aggregate (GB/s): "
+                  << 1.e-9 * link_bytes*num_links/exchange_time << std::endl;
+      } else {
+        for (int g=0; g<ngpus-1; g++) {
+          std::cout << "Halo link " << g << "->" << g+1
+                    << (peered[g] ? " (peer direct): " : " (host staged): ")
+                    << 1.e-9 * link_bytes/link_time[2*g] << " GB/s" << std::endl;
+          std::cout << "Halo link " << g+1 << "->" << g
+                    << (peered[g] ? " (peer direct): " : " (host staged): ")
+                    << 1.e-9 * link_bytes/link_time[2*g+1] << " GB/s" << std::endl;
+        }
+      }
+    }
+  }
+
+  return 0;
+}
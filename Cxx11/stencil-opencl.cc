@@ -63,16 +63,21 @@
 #include "prk_opencl.h"
 
 template <typename T>
-void run(cl::Context context, int iterations, int n, int radius, bool star)
+void run(cl::Context context, int iterations, int n, int tile_size, int radius, bool star)
 {
   auto precision = (sizeof(T)==8) ? 64 : 32;
 
+  // a tile size smaller than the grid selects the local-memory kernel,
+  // with tile_size x tile_size work groups staging their halo
+  const bool tiled = (tile_size > 0) && (tile_size < n);
+
   std::string funcname1, filename1;
   funcname1.reserve(255);
   funcname1 += ( star ? "star" : "grid" );
   funcname1 += std::to_string(radius);
   filename1 = funcname1 + ( ".cl" );
   funcname1 += "_" + std::to_string(precision);
+  if (tiled) funcname1 += "_tiled";
   auto funcname2 = (precision==64) ? "add64" : "add32";
   auto filename2 = "add.cl";
 
@@ -89,8 +94,12 @@ void run(cl::Context context, int iterations, int n, int radius, bool star)
       }
   }
   source = prk::opencl::loadProgram(filename1);
-  cl::Program program1(context, source, true);
-  cl::Program program2(context, prk::opencl::loadProgram(filename2), true);
+  // the generated kernels default LSIZE unless it is defined first
+  if (tiled) {
+      source = "#define LSIZE " + std::to_string(tile_size) + "\n" + source;
+  }
+  cl::Program program1 = prk::opencl::buildProgram(context, source);
+  cl::Program program2 = prk::opencl::buildProgram(context, prk::opencl::loadProgram(filename2));
 
   cl_int err;
   auto kernel1 = cl::make_kernel<int, cl::Buffer, cl::Buffer>(program1, funcname1, &err);
@@ -131,7 +140,14 @@ void run(cl::Context context, int iterations, int n, int radius, bool star)
     if (iter==1) stencil_time = prk::wtime();
 
     // Apply the stencil operator
-    kernel1(cl::EnqueueArgs(queue, cl::NDRange(n,n)), n, d_in, d_out);
+    if (tiled) {
+        // round the global range up to a work-group multiple; excess
+        // work items fail the interior test inside the kernel
+        const int g = ((n + tile_size - 1) / tile_size) * tile_size;
+        kernel1(cl::EnqueueArgs(queue, cl::NDRange(g,g), cl::NDRange(tile_size,tile_size)), n, d_in, d_out);
+    } else {
+        kernel1(cl::EnqueueArgs(queue, cl::NDRange(n,n)), n, d_in, d_out);
+    }
     // Add constant to solution to force refresh of neighbor data, if any
     kernel2(cl::EnqueueArgs(queue, cl::NDRange(n,n)), n, d_in);
     queue.finish();
@@ -264,9 +280,9 @@ int main(int argc, char* argv[])
     std::cout << "CPU Precision         = " << precision << "-bit" << std::endl;
 
     if (precision==64) {
-        run<double>(cpu, iterations, n, radius, star);
+        run<double>(cpu, iterations, n, tile_size, radius, star);
     } else {
-        run<float>(cpu, iterations, n, radius, star);
+        run<float>(cpu, iterations, n, tile_size, radius, star);
     }
   }
 
@@ -278,9 +294,9 @@ int main(int argc, char* argv[])
     std::cout << "GPU Precision         = " << precision << "-bit" << std::endl;
 
     if (precision==64) {
-        run<double>(gpu, iterations, n, radius, star);
+        run<double>(gpu, iterations, n, tile_size, radius, star);
     } else {
-        run<float>(gpu, iterations, n, radius, star);
+        run<float>(gpu, iterations, n, tile_size, radius, star);
     }
   }
 
@@ -293,9 +309,9 @@ int main(int argc, char* argv[])
     std::cout << "ACC Precision         = " << precision << "-bit" << std::endl;
 
     if (precision==64) {
-        run<double>(acc, iterations, n, radius, star);
+        run<double>(acc, iterations, n, tile_size, radius, star);
     } else {
-        run<float>(acc, iterations, n, radius, star);
+        run<float>(acc, iterations, n, tile_size, radius, star);
     }
   }
 
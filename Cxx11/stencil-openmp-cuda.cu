@@ -0,0 +1,376 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    Stencil
+///
+/// PURPOSE: This program tests the efficiency with which a space-invariant,
+///          linear, symmetric filter (stencil) can be applied to a square
+///          grid or image, with the grid rows split between the host
+///          (OpenMP threads) and the device (CUDA), exchanging halo rows
+///          over the partition boundary every iteration.
+///
+/// USAGE:   The program takes as input the number of iterations, the linear
+///          dimension of the grid, and optionally the fraction of rows
+///          assigned to the device:
+///
+///                <progname> <iterations> <grid size> [<gpu fraction or AUTO> <tile_size> <radius>]
+///
+///          A fraction of AUTO starts from an even split and rebalances
+///          after the warmup iteration based on the measured per-row rate
+///          of each side. Only the star stencil shape is supported.
+///
+///          The output consists of diagnostics to make sure the
+///          algorithm worked, per-side rates, and the achieved split.
+///
+/// HISTORY: Derived from the C++11/CUDA and C++11/OpenMP stencil versions.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+#include "prk_cuda.h"
+
+// the generated per-radius kernels always sweep the full interior, so this
+// version uses runtime-bounded row ranges instead, at some cost in unrolling
+__global__ void star(const int n, const int radius, const int istart, const int iend,
+                     const prk_float * RESTRICT in, prk_float * RESTRICT out)
+{
+    const int i = istart + blockIdx.x * blockDim.x + threadIdx.x;
+    const int j = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if ( (i < iend) && (j >= radius) && (j < n-radius) ) {
+        prk_float result = 0;
+        for (int k=1; k<=radius; k++) {
+            const prk_float w = (prk_float)1 / (prk_float)(2*k*radius);
+            result += w * ( in[(size_t)i*n+(j+k)] - in[(size_t)i*n+(j-k)]
+                          + in[(size_t)(i+k)*n+j] - in[(size_t)(i-k)*n+j] );
+        }
+        out[(size_t)i*n+j] += result;
+    }
+}
+
+__global__ void add(const int n, const int istart, const int iend, prk_float * in)
+{
+    const int i = istart + blockIdx.x * blockDim.x + threadIdx.x;
+    const int j = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if ((i<iend) && (j<n)) {
+        in[(size_t)i*n+j] += (prk_float)1;
+    }
+}
+
+static void host_star(const int n, const int radius, const int istart, const int iend,
+                      const prk_float * RESTRICT in, prk_float * RESTRICT out)
+{
+    OMP_PARALLEL()
+    {
+      OMP_FOR()
+      for (int i=istart; i<iend; ++i) {
+        OMP_SIMD
+        for (int j=radius; j<n-radius; ++j) {
+          prk_float result = 0;
+          for (int k=1; k<=radius; k++) {
+            const prk_float w = (prk_float)1 / (prk_float)(2*k*radius);
+            result += w * ( in[(size_t)i*n+(j+k)] - in[(size_t)i*n+(j-k)]
+                          + in[(size_t)(i+k)*n+j] - in[(size_t)(i-k)*n+j] );
+          }
+          out[(size_t)i*n+j] += result;
+        }
+      }
+    }
+}
+
+static void host_add(const int n, const int istart, const int iend, prk_float * in)
+{
+    OMP_PARALLEL()
+    {
+      OMP_FOR()
+      for (int i=istart; i<iend; ++i) {
+        OMP_SIMD
+        for (int j=0; j<n; ++j) {
+          in[(size_t)i*n+j] += (prk_float)1;
+        }
+      }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11/OpenMP + CUDA cooperative Stencil execution on 2D grid" << std::endl;
+
+  prk::CUDA::info info;
+  info.print();
+
+  //////////////////////////////////////////////////////////////////////
+  // Process and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations, n, radius, tile_size;
+  double gpu_fraction;
+  bool adaptive;
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <array dimension> [<gpu fraction or AUTO> <tile_size> <radius>]";
+      }
+
+      // number of times to run the algorithm
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      // linear grid dimension
+      n  = std::atoi(argv[2]);
+      if (n < 1) {
+        throw "ERROR: grid dimension must be positive";
+      } else if (n > std::floor(std::sqrt(INT_MAX))) {
+        throw "ERROR: grid dimension too large - overflow risk";
+      }
+
+      // fraction of rows assigned to the device
+      gpu_fraction = 0.5;
+      adaptive = false;
+      if (argc > 3) {
+          if (std::string(argv[3]) == "AUTO") {
+              adaptive = true;
+          } else {
+              gpu_fraction = std::atof(argv[3]);
+              if (gpu_fraction < 0.0 || gpu_fraction > 1.0) {
+                throw "ERROR: gpu fraction must be in [0,1] or AUTO";
+              }
+          }
+      }
+
+      tile_size = 32;
+      if (argc > 4) {
+          tile_size = std::atoi(argv[4]);
+          if (tile_size <= 0) tile_size = n;
+          if (tile_size > n) tile_size = n;
+      }
+
+      // stencil radius
+      radius = 2;
+      if (argc > 5) {
+          radius = std::atoi(argv[5]);
+      }
+
+      if ( (radius < 1) || (2*radius+1 > n) ) {
+        throw "ERROR: Stencil radius negative or too large";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  int num_threads = 1;
+#ifdef _OPENMP
+  num_threads = omp_get_max_threads();
+#endif
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Grid size            = " << n << std::endl;
+  std::cout << "Number of threads    = " << num_threads << std::endl;
+  std::cout << "Device row fraction  = " << (adaptive ? std::string("AUTO") : std::to_string(gpu_fraction)) << std::endl;
+  std::cout << "Tile size            = " << tile_size << std::endl;
+  std::cout << "Type of stencil      = star" << std::endl;
+  std::cout << "Radius of stencil    = " << radius << std::endl;
+
+  // first row owned by the host; device owns rows [0,split), host [split,n)
+  const int interior = n - 2*radius;
+  int split = radius + static_cast<int>(interior * gpu_fraction + 0.5);
+  split = std::max(radius, std::min(n-radius, split));
+
+  dim3 dimBlock(tile_size, tile_size, 1);
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  double stencil_time(0), gpu_time(0), cpu_time(0), halo_time(0);
+
+  const size_t nelems = (size_t)n * (size_t)n;
+  const size_t bytes = nelems * sizeof(prk_float);
+  const size_t row_bytes = (size_t)n * sizeof(prk_float);
+  prk_float * h_in;
+  prk_float * h_out;
+  prk_float * d_in;
+  prk_float * d_out;
+  prk::CUDA::check( cudaMallocHost((void**)&h_in, bytes) );
+  prk::CUDA::check( cudaMallocHost((void**)&h_out, bytes) );
+
+  for (int i=0; i<n; i++) {
+    for (int j=0; j<n; j++) {
+      h_in[(size_t)i*n+j]  = static_cast<prk_float>(i+j);
+      h_out[(size_t)i*n+j] = static_cast<prk_float>(0);
+    }
+  }
+
+  prk::CUDA::check( cudaMalloc((void**)&d_in, bytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_out, bytes) );
+  prk::CUDA::check( cudaMemcpy(d_in, h_in, bytes, cudaMemcpyHostToDevice) );
+  prk::CUDA::check( cudaMemcpy(d_out, h_out, bytes, cudaMemcpyHostToDevice) );
+
+  cudaEvent_t ev_start, ev_stop;
+  prk::CUDA::check( cudaEventCreate(&ev_start) );
+  prk::CUDA::check( cudaEventCreate(&ev_stop) );
+
+  for (int iter = 0; iter<=iterations; iter++) {
+
+    if (iter==1) stencil_time = prk::wtime();
+
+    // device side: stencil plus refresh of its own rows, asynchronously
+    prk::CUDA::check( cudaEventRecord(ev_start) );
+    if (split > radius) {
+      dim3 dimGridStar(prk::divceil(split-radius,tile_size),prk::divceil(n,tile_size),1);
+      star<<<dimGridStar, dimBlock>>>(n, radius, radius, split, d_in, d_out);
+    }
+    dim3 dimGridAdd(prk::divceil(split,tile_size),prk::divceil(n,tile_size),1);
+    add<<<dimGridAdd, dimBlock>>>(n, 0, split, d_in);
+    prk::CUDA::check( cudaEventRecord(ev_stop) );
+
+    // host side overlaps with the device kernels
+    double t0 = prk::wtime();
+    if (split < n-radius) host_star(n, radius, split, n-radius, h_in, h_out);
+    host_add(n, split, n, h_in);
+    double t_cpu = prk::wtime() - t0;
+
+    prk::CUDA::check( cudaEventSynchronize(ev_stop) );
+    float ms(0);
+    prk::CUDA::check( cudaEventElapsedTime(&ms, ev_start, ev_stop) );
+    if (iter > 0) {
+      cpu_time += t_cpu;
+      gpu_time += 1.e-3*ms;
+    }
+
+    // exchange halo rows over the partition boundary; each side only needs
+    // the other's boundary rows if it computes stencil rows of its own
+    t0 = prk::wtime();
+    if (split < n-radius) {
+      prk::CUDA::check( cudaMemcpy(&h_in[(size_t)(split-radius)*n], &d_in[(size_t)(split-radius)*n],
+                                   radius*row_bytes, cudaMemcpyDeviceToHost) );
+    }
+    if (split > radius) {
+      prk::CUDA::check( cudaMemcpy(&d_in[(size_t)split*n], &h_in[(size_t)split*n],
+                                   radius*row_bytes, cudaMemcpyHostToDevice) );
+    }
+    if (iter > 0) halo_time += prk::wtime() - t0;
+
+    // rebalance once, after the warmup iteration, from measured per-row rates
+    if (iter == 0 && adaptive) {
+      const int gpu_rows = split - radius;
+      const int cpu_rows = n - radius - split;
+      if (gpu_rows > 0 && cpu_rows > 0) {
+        const double trg = 1.e-3*ms / gpu_rows;
+        const double trc = t_cpu / cpu_rows;
+        int new_split = radius + static_cast<int>(interior * trc/(trc+trg) + 0.5);
+        new_split = std::max(radius, std::min(n-radius, new_split));
+        if (new_split != split) {
+          // reconstruct a complete current image on the host, then mirror it
+          prk::CUDA::check( cudaMemcpy(h_in,  d_in,  (size_t)split*row_bytes, cudaMemcpyDeviceToHost) );
+          prk::CUDA::check( cudaMemcpy(h_out, d_out, (size_t)split*row_bytes, cudaMemcpyDeviceToHost) );
+          split = new_split;
+          prk::CUDA::check( cudaMemcpy(d_in,  h_in,  bytes, cudaMemcpyHostToDevice) );
+          prk::CUDA::check( cudaMemcpy(d_out, h_out, bytes, cudaMemcpyHostToDevice) );
+        }
+      }
+    }
+  }
+  stencil_time = prk::wtime() - stencil_time;
+
+  // copy the device rows of the output back to the host for verification
+  if (split > radius) {
+    prk::CUDA::check( cudaMemcpy(h_out, d_out, (size_t)split*row_bytes, cudaMemcpyDeviceToHost) );
+  }
+
+  prk::CUDA::check( cudaEventDestroy(ev_stop) );
+  prk::CUDA::check( cudaEventDestroy(ev_start) );
+  prk::CUDA::check( cudaFree(d_out) );
+  prk::CUDA::check( cudaFree(d_in) );
+
+  //////////////////////////////////////////////////////////////////////
+  // Analyze and output results.
+  //////////////////////////////////////////////////////////////////////
+
+  // interior of grid with respect to stencil
+  size_t active_points = static_cast<size_t>(n-2*radius)*static_cast<size_t>(n-2*radius);
+  // compute L1 norm
+  double norm = 0.0;
+  for (int i=radius; i<n-radius; i++) {
+    for (int j=radius; j<n-radius; j++) {
+      norm += std::fabs(h_out[(size_t)i*n+j]);
+    }
+  }
+  norm /= active_points;
+
+  prk::CUDA::check( cudaFreeHost(h_out) );
+  prk::CUDA::check( cudaFreeHost(h_in) );
+
+  // verify correctness
+  const double epsilon = 1.0e-8;
+  double reference_norm = 2.*(iterations+1.);
+  if (std::fabs(norm-reference_norm) > epsilon) {
+    std::cout << "ERROR: L1 norm = " << norm
+              << " Reference L1 norm = " << reference_norm << std::endl;
+    return 1;
+  } else {
+    std::cout << "Solution validates" << std::endl;
+#ifdef VERBOSE
+    std::cout << "L1 norm = " << norm
+              << " Reference L1 norm = " << reference_norm << std::endl;
+#endif
+    const int gpu_rows = split - radius;
+    const int cpu_rows = n - radius - split;
+    const int stencil_size = 4*radius+1;
+    size_t flops = (2L*(size_t)stencil_size+1L) * active_points;
+    auto avgtime = stencil_time/iterations;
+    std::cout << "Achieved split: GPU rows = " << gpu_rows
+              << " CPU rows = " << cpu_rows
+              << " (GPU fraction = " << static_cast<double>(gpu_rows)/interior << ")" << std::endl;
+    if (gpu_rows > 0) {
+      size_t flops_gpu = (2L*(size_t)stencil_size+1L) * (size_t)gpu_rows * interior;
+      std::cout << "GPU rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops_gpu)/(gpu_time/iterations)
+                << " Avg time (s): " << gpu_time/iterations << std::endl;
+    }
+    if (cpu_rows > 0) {
+      size_t flops_cpu = (2L*(size_t)stencil_size+1L) * (size_t)cpu_rows * interior;
+      std::cout << "CPU rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops_cpu)/(cpu_time/iterations)
+                << " Avg time (s): " << cpu_time/iterations << std::endl;
+    }
+    std::cout << "Halo exchange avg time (s): " << halo_time/iterations << std::endl;
+    std::cout << "Rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops)/avgtime
+              << " Avg time (s): " << avgtime << std::endl;
+  }
+
+  return 0;
+}
@@ -179,7 +179,12 @@ int main(int argc, char* argv[])
   }
 
   // DEVICE
-  OMP_TARGET( data map(tofrom: in[0:n*n], out[0:n*n]) )
+  // map the grids once, before the timed loop; the kernels below run
+  // map-free against the device copies
+  double h2d_time = prk::wtime();
+  OMP_TARGET( enter data map(to: in[0:n*n], out[0:n*n]) )
+  h2d_time = prk::wtime() - h2d_time;
+
   {
     for (auto iter = 0; iter<=iterations; iter++) {
 
@@ -199,6 +204,11 @@ int main(int argc, char* argv[])
     stencil_time = omp_get_wtime() - stencil_time;
   }
 
+  // only the output grid is needed for verification
+  double d2h_time = prk::wtime();
+  OMP_TARGET( exit data map(from: out[0:n*n]) map(release: in[0:n*n]) )
+  d2h_time = prk::wtime() - d2h_time;
+
   //////////////////////////////////////////////////////////////////////
   // Analyze and output results.
   //////////////////////////////////////////////////////////////////////
@@ -233,6 +243,11 @@ int main(int argc, char* argv[])
     auto avgtime = stencil_time/iterations;
     std::cout << "Rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops)/avgtime
               << " Avg time (s): " << avgtime << std::endl;
+    if (prk::OpenMP::report_transfers()) {
+      const double grid_bytes = static_cast<double>(n)*n*sizeof(double);
+      std::cout << "H2D bandwidth (MB/s): " << 1.e-6*2.0*grid_bytes/h2d_time
+                << " D2H bandwidth (MB/s): " << 1.e-6*grid_bytes/d2h_time << std::endl;
+    }
   }
 
   return 0;
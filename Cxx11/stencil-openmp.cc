@@ -63,8 +63,10 @@
 #include "prk_util.h"
 #ifdef _OPENMP
 #include "stencil_openmp.hpp"
+#include "stencil_3d_openmp.hpp"
 #else
 #include "stencil_seq.hpp"
+#include "stencil_3d_seq.hpp"
 #endif
 
 void nothing(const int n, const int t, const double * RESTRICT in, double * RESTRICT out)
@@ -77,6 +79,16 @@ void nothing(const int n, const int t, const double * RESTRICT in, double * REST
     std::abort();
 }
 
+void nothing3(const int n, const int ti, const int tj, const int tk,
+              const double * RESTRICT in, double * RESTRICT out)
+{
+    std::cout << "You are trying to use a stencil that does not exist.\n";
+    std::cout << "3D stencils are generated for radii 1 through 4." << std::endl;
+    // n will never be zero - this is to silence compiler warnings.
+    if (n==0 || ti==0 || tj==0 || tk==0) std::cout << in << out << std::endl;
+    std::abort();
+}
+
 int main(int argc, char* argv[])
 {
   std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
@@ -91,10 +103,11 @@ int main(int argc, char* argv[])
   //////////////////////////////////////////////////////////////////////
 
   int iterations, n, radius, tile_size;
+  int dim = 2, tj, tk;
   bool star = true;
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <array dimension> [<tile_size> <star/grid> <radius>]";
+        throw "Usage: <# iterations> <array dimension> [<tile_size[,tj,tk]> <star/grid/star3d/grid3d> <radius>]";
       }
 
       // number of times to run the algorithm
@@ -104,26 +117,36 @@ int main(int argc, char* argv[])
       }
 
       // linear grid dimension
-      n  = std::atoi(argv[2]);
-      if (n < 1) {
+      const size_t n_input = prk::parse_size(argv[2]);
+      n = (int)n_input;
+      if (n_input < 1) {
         throw "ERROR: grid dimension must be positive";
-      } else if (n > std::floor(std::sqrt(INT_MAX))) {
+      } else if (n_input > (size_t)std::floor(std::sqrt(INT_MAX))) {
         throw "ERROR: grid dimension too large - overflow risk";
       }
 
-      // default tile size for tiling of local transpose
-      tile_size = 32;
+      // default tile size for tiling of local transpose; in 3D the
+      // three extents can be given independently as ti,tj,tk
+      tile_size = 32; tj = tk = 0;
       if (argc > 3) {
           tile_size = std::atoi(argv[3]);
+          const char * comma = std::strchr(argv[3], ',');
+          if (comma != nullptr) {
+              tj = std::atoi(comma+1);
+              comma = std::strchr(comma+1, ',');
+              if (comma != nullptr) tk = std::atoi(comma+1);
+          }
           if (tile_size <= 0) tile_size = n;
           if (tile_size > n) tile_size = n;
       }
+      if (tj <= 0 || tj > n) tj = tile_size;
+      if (tk <= 0 || tk > n) tk = tile_size;
 
-      // stencil pattern
+      // stencil pattern; the 3d shapes select the 3D kernels
       if (argc > 4) {
           auto stencil = std::string(argv[4]);
-          auto grid = std::string("grid");
-          star = (stencil == grid) ? false : true;
+          if (stencil == "star3d" || stencil == "grid3d") dim = 3;
+          star = (stencil == "grid" || stencil == "grid3d") ? false : true;
       }
 
       // stencil radius
@@ -135,6 +158,12 @@ int main(int argc, char* argv[])
       if ( (radius < 1) || (2*radius+1 > n) ) {
         throw "ERROR: Stencil radius negative or too large";
       }
+      if ( dim == 3 && radius > 4 ) {
+        throw "ERROR: 3D stencils are generated for radii 1 through 4";
+      }
+      if ( dim == 3 && n > std::floor(std::cbrt(INT_MAX)) ) {
+        throw "ERROR: grid dimension too large for 3D - overflow risk";
+      }
   }
   catch (const char * e) {
     std::cout << e << std::endl;
@@ -146,10 +175,34 @@ int main(int argc, char* argv[])
 #endif
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Grid size            = " << n << std::endl;
-  std::cout << "Tile size            = " << tile_size << std::endl;
-  std::cout << "Type of stencil      = " << (star ? "star" : "grid") << std::endl;
+  if (dim == 3) {
+    std::cout << "Tile size            = " << tile_size << "," << tj << "," << tk << std::endl;
+  } else {
+    std::cout << "Tile size            = " << tile_size << std::endl;
+  }
+  std::cout << "Type of stencil      = " << (star ? "star" : "grid")
+            << (dim == 3 ? " (3D)" : "") << std::endl;
   std::cout << "Radius of stencil    = " << radius << std::endl;
 
+  auto stencil3 = nothing3;
+  if (dim == 3) {
+      if (star) {
+          switch (radius) {
+              case 1: stencil3 = star3d1; break;
+              case 2: stencil3 = star3d2; break;
+              case 3: stencil3 = star3d3; break;
+              case 4: stencil3 = star3d4; break;
+          }
+      } else {
+          switch (radius) {
+              case 1: stencil3 = grid3d1; break;
+              case 2: stencil3 = grid3d2; break;
+              case 3: stencil3 = grid3d3; break;
+              case 4: stencil3 = grid3d4; break;
+          }
+      }
+  }
+
   auto stencil = nothing;
   if (star) {
       switch (radius) {
@@ -169,93 +222,210 @@ int main(int argc, char* argv[])
       }
   }
 
+  // PRK_THREAD_SWEEP=1,2,4,8 re-runs the timed region once per thread
+  // count in a single process, re-first-touching the data each point.
+  const std::vector<int> sweep = prk::thread_sweep();
+  const bool sweeping = !sweep.empty();
+
+  // PRK_INTERFERENCE=0,2,4 re-runs the timed region once per background
+  // pressure level, with that many co-runner threads (prk_util.h)
+  // hammering memory while the stencil runs, and reports the slowdown
+  // relative to the first level; the two sweeps are mutually exclusive.
+  std::vector<int> noise = prk::interference_sweep();
+  if (!noise.empty() && sweeping) {
+    std::cout << "PRK_INTERFERENCE ignored in favor of PRK_THREAD_SWEEP" << std::endl;
+    noise.clear();
+  }
+  const bool interfering = !noise.empty();
+  prk::interference pressure;
+  prk::energy_meter energy;
+  double base_rate(0);
+
+  if (sweeping) {
+    std::cout << "Thread scaling:" << std::endl;
+    std::cout << std::setw(8)  << "Threads"
+              << std::setw(18) << "Rate (MFlops/s)"
+              << std::setw(16) << "Avg time (s)" << std::endl;
+  } else if (interfering) {
+    std::cout << "Interference pattern = " << pressure.pattern() << std::endl;
+    std::cout << "Contention sweep:" << std::endl;
+    std::cout << std::setw(8)  << "Noise"
+              << std::setw(18) << "Rate (MFlops/s)"
+              << std::setw(16) << "Avg time (s)"
+              << std::setw(12) << "Slowdown" << std::endl;
+  }
+
   //////////////////////////////////////////////////////////////////////
   // Allocate space and perform the computation
   //////////////////////////////////////////////////////////////////////
 
-  auto stencil_time = 0.0;
-
-  double * RESTRICT in  = new double[n*n];
-  double * RESTRICT out = new double[n*n];
-
-  OMP_PARALLEL()
-  {
-    OMP_FOR( collapse(2) )
-    for (auto it=0; it<n; it+=tile_size) {
-      for (auto jt=0; jt<n; jt+=tile_size) {
-        for (auto i=it; i<std::min(n,it+tile_size); i++) {
-          PRAGMA_SIMD
-          for (auto j=jt; j<std::min(n,jt+tile_size); j++) {
-            in[i*n+j] = static_cast<double>(i+j);
-            out[i*n+j] = 0.0;
-          }
-        }
-      }
-    }
+  const size_t num_points = sweeping ? sweep.size() :
+                            interfering ? noise.size() : 1;
 
-    for (auto iter = 0; iter<=iterations; iter++) {
+  for (size_t point=0; point < num_points; point++) {
 
-      if (iter==1) {
-          OMP_BARRIER
-          OMP_MASTER
-          stencil_time = prk::wtime();
-      }
+#ifdef _OPENMP
+    if (sweeping) omp_set_num_threads(sweep[point]);
+#endif
+    if (interfering && noise[point] > 0) pressure.start(noise[point]);
+
+    auto stencil_time = 0.0;
 
-      // Apply the stencil operator
-      stencil(n, tile_size, in, out);
-      // Add constant to solution to force refresh of neighbor data, if any
+    // allocated fresh per sweep point so that first touch below places
+    // pages for the thread count being measured
+    const size_t npoints = (dim == 3) ? static_cast<size_t>(n)*n*n
+                                      : static_cast<size_t>(n)*n;
+    double * RESTRICT in  = new double[npoints];
+    double * RESTRICT out = new double[npoints];
+
+    OMP_PARALLEL()
+    {
+      if (dim == 3) {
+        OMP_FOR( collapse(2) )
+        for (auto i=0; i<n; i++) {
+          for (auto j=0; j<n; j++) {
+            PRAGMA_SIMD
+            for (auto k=0; k<n; k++) {
+              in[(i*n+j)*n+k] = static_cast<double>(i+j+k);
+              out[(i*n+j)*n+k] = 0.0;
+            }
+          }
+        }
+      } else {
       OMP_FOR( collapse(2) )
       for (auto it=0; it<n; it+=tile_size) {
         for (auto jt=0; jt<n; jt+=tile_size) {
           for (auto i=it; i<std::min(n,it+tile_size); i++) {
             PRAGMA_SIMD
             for (auto j=jt; j<std::min(n,jt+tile_size); j++) {
-              in[i*n+j] += 1.0;
+              in[i*n+j] = static_cast<double>(i+j);
+              out[i*n+j] = 0.0;
+            }
+          }
+        }
+      }
+      }
+
+      for (auto iter = 0; iter<=iterations; iter++) {
+
+        if (iter==1) {
+            OMP_BARRIER
+            OMP_MASTER
+            {
+              energy.start();
+              stencil_time = prk::wtime();
+            }
+        }
+
+        // Apply the stencil operator
+        if (dim == 3) stencil3(n, tile_size, tj, tk, in, out);
+        else          stencil(n, tile_size, in, out);
+        // Add constant to solution to force refresh of neighbor data, if any
+        if (dim == 3) {
+          OMP_FOR( collapse(2) )
+          for (auto i=0; i<n; i++) {
+            for (auto j=0; j<n; j++) {
+              PRAGMA_SIMD
+              for (auto k=0; k<n; k++) {
+                in[(i*n+j)*n+k] += 1.0;
+              }
+            }
+          }
+        } else {
+        OMP_FOR( collapse(2) )
+        for (auto it=0; it<n; it+=tile_size) {
+          for (auto jt=0; jt<n; jt+=tile_size) {
+            for (auto i=it; i<std::min(n,it+tile_size); i++) {
+              PRAGMA_SIMD
+              for (auto j=jt; j<std::min(n,jt+tile_size); j++) {
+                in[i*n+j] += 1.0;
+              }
             }
           }
         }
+        }
+      }
+      OMP_BARRIER
+      OMP_MASTER
+      {
+        stencil_time = prk::wtime() - stencil_time;
+        energy.stop();
       }
     }
-    OMP_BARRIER
-    OMP_MASTER
-    stencil_time = prk::wtime() - stencil_time;
-  }
 
-  //////////////////////////////////////////////////////////////////////
-  // Analyze and output results.
-  //////////////////////////////////////////////////////////////////////
+    if (interfering) pressure.stop();
 
-  // interior of grid with respect to stencil
-  size_t active_points = static_cast<size_t>(n-2*radius)*static_cast<size_t>(n-2*radius);
-  // compute L1 norm in parallel
-  double norm = 0.0;
-  OMP_PARALLEL_FOR_REDUCE( +:norm )
-  for (auto i=radius; i<n-radius; i++) {
-    for (auto j=radius; j<n-radius; j++) {
-      norm += std::fabs(out[i*n+j]);
+    //////////////////////////////////////////////////////////////////////
+    // Analyze and output results.
+    //////////////////////////////////////////////////////////////////////
+
+    // interior of grid with respect to stencil
+    size_t active_points = static_cast<size_t>(n-2*radius)*static_cast<size_t>(n-2*radius);
+    if (dim == 3) active_points *= static_cast<size_t>(n-2*radius);
+    // compute L1 norm in parallel
+    double norm = 0.0;
+    if (dim == 3) {
+      OMP_PARALLEL_FOR_REDUCE( +:norm )
+      for (auto i=radius; i<n-radius; i++) {
+        for (auto j=radius; j<n-radius; j++) {
+          for (auto k=radius; k<n-radius; k++) {
+            norm += std::fabs(out[(i*n+j)*n+k]);
+          }
+        }
+      }
+    } else {
+    OMP_PARALLEL_FOR_REDUCE( +:norm )
+    for (auto i=radius; i<n-radius; i++) {
+      for (auto j=radius; j<n-radius; j++) {
+        norm += std::fabs(out[i*n+j]);
+      }
     }
-  }
-  norm /= active_points;
-
-  // verify correctness
-  const double epsilon = 1.0e-8;
-  double reference_norm = 2.*(iterations+1.);
-  if (std::fabs(norm-reference_norm) > epsilon) {
-    std::cout << "ERROR: L1 norm = " << norm
-              << " Reference L1 norm = " << reference_norm << std::endl;
-    return 1;
-  } else {
-    std::cout << "Solution validates" << std::endl;
+    }
+    norm /= active_points;
+
+    // verify correctness; both 3D shapes advance a linear field by 3
+    const double epsilon = 1.0e-8;
+    double reference_norm = (dim == 3) ? 3.*(iterations+1.) : 2.*(iterations+1.);
+    if (std::fabs(norm-reference_norm) > epsilon) {
+      std::cout << "ERROR: L1 norm = " << norm
+                << " Reference L1 norm = " << reference_norm << std::endl;
+      return 1;
+    } else {
 #ifdef VERBOSE
-    std::cout << "L1 norm = " << norm
-              << " Reference L1 norm = " << reference_norm << std::endl;
+      std::cout << "L1 norm = " << norm
+                << " Reference L1 norm = " << reference_norm << std::endl;
 #endif
-    const int stencil_size = star ? 4*radius+1 : (2*radius+1)*(2*radius+1);
-    size_t flops = (2L*(size_t)stencil_size+1L) * active_points;
-    auto avgtime = stencil_time/iterations;
-    std::cout << "Rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops)/avgtime
-              << " Avg time (s): " << avgtime << std::endl;
+      const int stencil_size =
+          (dim == 3) ? (star ? 6*radius+1
+                             : (2*radius+1)*(2*radius+1)*(2*radius+1)
+                              - (2*radius)*(2*radius)*(2*radius) - 1)
+                     : (star ? 4*radius+1 : (2*radius+1)*(2*radius+1));
+      size_t flops = (2L*(size_t)stencil_size+1L) * active_points;
+      auto avgtime = stencil_time/iterations;
+      if (sweeping) {
+        std::cout << std::setw(8)  << sweep[point]
+                  << std::setw(18) << 1.0e-6 * static_cast<double>(flops)/avgtime
+                  << std::setw(16) << avgtime << std::endl;
+      } else if (interfering) {
+        const double rate = 1.0e-6 * static_cast<double>(flops)/avgtime;
+        if (point == 0) base_rate = rate;
+        std::cout << std::setw(8)  << noise[point]
+                  << std::setw(18) << rate
+                  << std::setw(16) << avgtime
+                  << std::setw(11) << base_rate/rate << "x" << std::endl;
+      } else {
+        std::cout << "Solution validates" << std::endl;
+        std::cout << "Rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops)/avgtime
+                  << " Avg time (s): " << avgtime << std::endl;
+        energy.report(1.0e-6 * static_cast<double>(flops)/avgtime, "MFlops/s");
+      }
+    }
+
+    delete[] out;
+    delete[] in;
   }
 
+  if (sweeping || interfering) std::cout << "Solution validates" << std::endl;
+
   return 0;
 }
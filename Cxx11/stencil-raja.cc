@@ -42,6 +42,13 @@
 ///          dimension of the grid, and the number of iterations on the grid
 ///
 ///                <progname> <iterations> <grid size>
+///                           [<tile_size> <star/grid> <radius> <policy>]
+///
+///          The policy selects one of the compiled-in RAJA kernel
+///          policies (seq, simd, tiled, omp, omp_static, omp_dynamic);
+///          "all" sweeps the whole matrix and reports each, so a RAJA or
+///          compiler upgrade shows immediately which policy regressed.
+///          The default reproduces the historical regular_policy choice.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
@@ -74,95 +81,55 @@ void nothing(const int n, const int t, matrix & in, matrix & out)
     std::abort();
 }
 
-int main(int argc, char* argv[])
-{
-  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
-  std::cout << "C++11/RAJA Stencil execution on 2D grid" << std::endl;
-
-  //////////////////////////////////////////////////////////////////////
-  // Process and test input parameters
-  //////////////////////////////////////////////////////////////////////
-
-  int iterations, n, radius, tile_size;
-  bool star = true;
-  try {
-      if (argc < 3) {
-        throw "Usage: <# iterations> <array dimension> [<tile_size> <star/grid> <radius>]";
-      }
-
-      // number of times to run the algorithm
-      iterations  = std::atoi(argv[1]);
-      if (iterations < 1) {
-        throw "ERROR: iterations must be >= 1";
-      }
-
-      // linear grid dimension
-      n  = std::atoi(argv[2]);
-      if (n < 1) {
-        throw "ERROR: grid dimension must be positive";
-      } else if (n > std::floor(std::sqrt(INT_MAX))) {
-        throw "ERROR: grid dimension too large - overflow risk";
-      }
-
-      // default tile size for tiling of local transpose
-      tile_size = 32;
-      if (argc > 3) {
-          tile_size = std::atoi(argv[3]);
-          if (tile_size <= 0) tile_size = n;
-          if (tile_size > n) tile_size = n;
-      }
-
-      // stencil pattern
-      if (argc > 4) {
-          auto stencil = std::string(argv[4]);
-          auto grid = std::string("grid");
-          star = (stencil == grid) ? false : true;
-      }
-
-      // stencil radius
-      radius = 2;
-      if (argc > 5) {
-          radius = std::atoi(argv[5]);
-      }
-
-      if ( (radius < 1) || (2*radius+1 > n) ) {
-        throw "ERROR: Stencil radius negative or too large";
-      }
-  }
-  catch (const char * e) {
-    std::cout << e << std::endl;
-    return 1;
-  }
+// the compiled-in policy matrix; regular_policy comes with the generated
+// stencil operators and is the historical default
+using seq_policy    = RAJA::KernelPolicy< RAJA::statement::For<0, RAJA::seq_exec,
+                                          RAJA::statement::For<1, RAJA::seq_exec,
+                                          RAJA::statement::Lambda<0> > > >;
+using simd_policy   = RAJA::KernelPolicy< RAJA::statement::For<0, RAJA::seq_exec,
+                                          RAJA::statement::For<1, RAJA::simd_exec,
+                                          RAJA::statement::Lambda<0> > > >;
+using tiled_policy  = RAJA::KernelPolicy< RAJA::statement::Tile<0, RAJA::tile_fixed<32>, RAJA::seq_exec,
+                                          RAJA::statement::Tile<1, RAJA::tile_fixed<32>, RAJA::seq_exec,
+                                          RAJA::statement::For<0, thread_exec,
+                                          RAJA::statement::For<1, RAJA::simd_exec,
+                                          RAJA::statement::Lambda<0> > > > > >;
+#if defined(RAJA_ENABLE_OPENMP)
+using omp_static_policy  = RAJA::KernelPolicy< RAJA::statement::For<0, RAJA::omp_parallel_for_static_exec<32>,
+                                               RAJA::statement::For<1, RAJA::simd_exec,
+                                               RAJA::statement::Lambda<0> > > >;
+using omp_dynamic_policy = RAJA::KernelPolicy< RAJA::statement::For<0, RAJA::omp_parallel_for_dynamic_exec<32>,
+                                               RAJA::statement::For<1, RAJA::simd_exec,
+                                               RAJA::statement::Lambda<0> > > >;
+#endif
 
-  std::cout << "Number of iterations = " << iterations << std::endl;
-  std::cout << "Grid size            = " << n << std::endl;
-  std::cout << "Tile size            = " << tile_size << std::endl;
-  std::cout << "Type of stencil      = " << (star ? "star" : "grid") << std::endl;
-  std::cout << "Radius of stencil    = " << radius << std::endl;
+// identical logic for every kernel policy, so that any rate difference
+// between the instantiations is attributable to the policy alone
+template <typename kernel_policy>
+int run(int iterations, int n, int tile_size, bool star, int radius,
+        const char * policy_name)
+{
+  std::cout << "RAJA kernel policy   = " << policy_name << std::endl;
 
   auto stencil = nothing;
   if (star) {
       switch (radius) {
-          case 1: stencil = star1; break;
-          case 2: stencil = star2; break;
-          case 3: stencil = star3; break;
-          case 4: stencil = star4; break;
-          case 5: stencil = star5; break;
+          case 1: stencil = star1<kernel_policy>; break;
+          case 2: stencil = star2<kernel_policy>; break;
+          case 3: stencil = star3<kernel_policy>; break;
+          case 4: stencil = star4<kernel_policy>; break;
+          case 5: stencil = star5<kernel_policy>; break;
       }
   } else {
       switch (radius) {
-          case 1: stencil = grid1; break;
-          case 2: stencil = grid2; break;
-          case 3: stencil = grid3; break;
-          case 4: stencil = grid4; break;
-          case 5: stencil = grid5; break;
+          case 1: stencil = grid1<kernel_policy>; break;
+          case 2: stencil = grid2<kernel_policy>; break;
+          case 3: stencil = grid3<kernel_policy>; break;
+          case 4: stencil = grid4<kernel_policy>; break;
+          case 5: stencil = grid5<kernel_policy>; break;
       }
   }
 
-  //////////////////////////////////////////////////////////////////////
-  // Allocate space and perform the computation
-  //////////////////////////////////////////////////////////////////////
-
   auto stencil_time = 0.0;
 
   double * RESTRICT imem = new double[n*n];
@@ -171,17 +138,10 @@ int main(int argc, char* argv[])
   RAJA::View<double, RAJA::Layout<2>> in(imem, n, n);
   RAJA::View<double, RAJA::Layout<2>> out(omem, n, n);
 
-  using regular_policy = RAJA::KernelPolicy< RAJA::statement::For<0, thread_exec,
-                                             RAJA::statement::For<1, RAJA::simd_exec,
-                                             RAJA::statement::Lambda<0> > > >;
-  using permute_policy = RAJA::KernelPolicy< RAJA::statement::For<1, thread_exec,
-                                             RAJA::statement::For<0, RAJA::simd_exec,
-                                             RAJA::statement::Lambda<0> > > >;
-
   RAJA::RangeSegment range(0, n);
   auto grid = RAJA::make_tuple(range, range);
 
-  RAJA::kernel<regular_policy>(grid, [=](int i, int j) {
+  RAJA::kernel<kernel_policy>(grid, [=](int i, int j) {
       in(i,j)  = static_cast<double>(i+j);
       out(i,j) = 0.0;
   });
@@ -192,7 +152,7 @@ int main(int argc, char* argv[])
     // Apply the stencil operator
     stencil(n, tile_size, in, out);
     // Add constant to solution to force refresh of neighbor data, if any
-    RAJA::kernel<regular_policy>(grid, [=](int i, int j) {
+    RAJA::kernel<kernel_policy>(grid, [=](int i, int j) {
         in(i,j) += 1.0;
     });
   }
@@ -216,6 +176,9 @@ int main(int argc, char* argv[])
   });
   double norm = reduced_norm / active_points;
 
+  delete [] omem;
+  delete [] imem;
+
   // verify correctness
   const double epsilon = 1.0e-8;
   double reference_norm = 2.*(iterations+1.);
@@ -238,3 +201,123 @@ int main(int argc, char* argv[])
 
   return 0;
 }
+
+int main(int argc, char* argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11/RAJA Stencil execution on 2D grid" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Process and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations, n, radius, tile_size;
+  bool star = true;
+  std::string policy("default");
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <array dimension> [<tile_size> <star/grid> <radius> <policy>]";
+      }
+
+      // number of times to run the algorithm
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      // linear grid dimension
+      n  = std::atoi(argv[2]);
+      if (n < 1) {
+        throw "ERROR: grid dimension must be positive";
+      } else if (n > std::floor(std::sqrt(INT_MAX))) {
+        throw "ERROR: grid dimension too large - overflow risk";
+      }
+
+      // default tile size for tiling of local transpose
+      tile_size = 32;
+      if (argc > 3) {
+          tile_size = std::atoi(argv[3]);
+          if (tile_size <= 0) tile_size = n;
+          if (tile_size > n) tile_size = n;
+      }
+
+      // stencil pattern
+      if (argc > 4) {
+          auto stencil = std::string(argv[4]);
+          auto grid = std::string("grid");
+          star = (stencil == grid) ? false : true;
+      }
+
+      // stencil radius
+      radius = 2;
+      if (argc > 5) {
+          radius = std::atoi(argv[5]);
+      }
+
+      if ( (radius < 1) || (2*radius+1 > n) ) {
+        throw "ERROR: Stencil radius negative or too large";
+      }
+
+      // kernel policy
+      if (argc > 6) {
+          policy = std::string(argv[6]);
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Grid size            = " << n << std::endl;
+  std::cout << "Tile size            = " << tile_size << std::endl;
+  std::cout << "Type of stencil      = " << (star ? "star" : "grid") << std::endl;
+  std::cout << "Radius of stencil    = " << radius << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  // Allocate space and perform the computation
+  //////////////////////////////////////////////////////////////////////
+
+  // the policy matrix is compiled in; "all" sweeps it so that a RAJA or
+  // compiler upgrade shows immediately which policy regressed
+  int status = 0;
+  bool known = false;
+  bool all = (policy == "all");
+  if (policy == "default") {
+    known = true;
+    status |= run<regular_policy>(iterations, n, tile_size, star, radius, "default");
+  }
+  if (all || policy == "seq") {
+    known = true;
+    status |= run<seq_policy>(iterations, n, tile_size, star, radius, "seq");
+  }
+  if (all || policy == "simd") {
+    known = true;
+    status |= run<simd_policy>(iterations, n, tile_size, star, radius, "simd");
+  }
+  if (all || policy == "tiled") {
+    known = true;
+    status |= run<tiled_policy>(iterations, n, tile_size, star, radius, "tiled");
+  }
+#if defined(RAJA_ENABLE_OPENMP)
+  if (all || policy == "omp") {
+    known = true;
+    status |= run<regular_policy>(iterations, n, tile_size, star, radius, "omp");
+  }
+  if (all || policy == "omp_static") {
+    known = true;
+    status |= run<omp_static_policy>(iterations, n, tile_size, star, radius, "omp_static");
+  }
+  if (all || policy == "omp_dynamic") {
+    known = true;
+    status |= run<omp_dynamic_policy>(iterations, n, tile_size, star, radius, "omp_dynamic");
+  }
+#endif
+  if (!known) {
+    std::cout << "ERROR: unknown policy " << policy
+              << " (try seq, simd, tiled, omp, omp_static, omp_dynamic, or all)" << std::endl;
+    return 1;
+  }
+
+  return status;
+}
@@ -41,7 +41,12 @@
 /// USAGE:   The program takes as input the linear
 ///          dimension of the grid, and the number of iterations on the grid
 ///
-///                <progname> <iterations> <grid size>
+///                <progname> <iterations> <grid size> [<work-group size> <star/grid> <stencil radius>]
+///
+///          The work-group size selects the ND-range launch configuration:
+///          0 leaves it to the runtime, a positive value w launches with
+///          w x w work-groups, and "auto" sweeps candidate sizes in an
+///          untimed probe phase and keeps the fastest.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
@@ -71,6 +76,7 @@
 
 template <typename T> class init;
 template <typename T> class add;
+template <typename T> class rowsum;
 
 #if USE_2D_INDEXING
 template <typename T>
@@ -86,17 +92,32 @@ void nothing(cl::sycl::queue & q, const size_t n, cl::sycl::buffer<T> & d_in, cl
     std::abort();
 }
 
+#if USE_2D_INDEXING
+template <typename T>
+void nothing_ndr(cl::sycl::queue & q, const size_t n, cl::sycl::range<2> lws, cl::sycl::buffer<T, 2> & d_in, cl::sycl::buffer<T, 2> & d_out)
+#else
+template <typename T>
+void nothing_ndr(cl::sycl::queue & q, const size_t n, cl::sycl::range<2> lws, cl::sycl::buffer<T> & d_in, cl::sycl::buffer<T> & d_out)
+#endif
+{
+    std::cout << "You are trying to use a stencil that does not exist.\n";
+    std::cout << "Please generate the new stencil using the code generator\n";
+    std::cout << "and add it to the case-switch in the driver." << std::endl;
+    std::abort();
+}
+
 template <typename T>
-void run(cl::sycl::queue & q, int iterations, size_t n, size_t tile_size, bool star, size_t radius)
+void run(cl::sycl::queue & q, int iterations, size_t n, int wgsize, bool star, size_t radius)
 {
   auto stencil = nothing<T>;
+  auto stencil_ndr = nothing_ndr<T>;
   if (star) {
       switch (radius) {
-          case 1: stencil = star1; break;
-          case 2: stencil = star2; break;
-          case 3: stencil = star3; break;
-          case 4: stencil = star4; break;
-          case 5: stencil = star5; break;
+          case 1: stencil = star1; stencil_ndr = star1; break;
+          case 2: stencil = star2; stencil_ndr = star2; break;
+          case 3: stencil = star3; stencil_ndr = star3; break;
+          case 4: stencil = star4; stencil_ndr = star4; break;
+          case 5: stencil = star5; stencil_ndr = star5; break;
       }
   }
 #if 0
@@ -116,6 +137,7 @@ void run(cl::sycl::queue & q, int iterations, size_t n, size_t tile_size, bool s
   //////////////////////////////////////////////////////////////////////
 
   double stencil_time(0);
+  double norm(0);
 
   std::vector<T> h_in(n*n,0);
   std::vector<T> h_out(n*n,0);
@@ -153,11 +175,53 @@ void run(cl::sycl::queue & q, int iterations, size_t n, size_t tile_size, bool s
     });
     q.wait();
 
+    if (wgsize < 0) {
+      // probe phase: sweep work-group sizes on live data and keep the
+      // fastest; none of these launches is timed
+#ifndef TRISYCL
+      const size_t max_wg = q.get_device().get_info<cl::sycl::info::device::max_work_group_size>();
+#else
+      const size_t max_wg = 1024;
+#endif
+      double best_time(1.e30);
+      for (size_t wg=4; wg<=32; wg*=2) {
+        if (wg*wg > max_wg || wg > n) break;
+        cl::sycl::range<2> lws {wg,wg};
+        stencil_ndr(q, n, lws, d_in, d_out);
+        q.wait();
+        double probe = prk::wtime();
+        for (int r=0; r<2; ++r) {
+          stencil_ndr(q, n, lws, d_in, d_out);
+        }
+        q.wait();
+        probe = prk::wtime() - probe;
+        if (probe < best_time) {
+          best_time = probe;
+          wgsize = wg;
+        }
+      }
+      if (wgsize < 0) wgsize = 0;
+      if (wgsize > 0) {
+        std::cout << "Autotuned work-group size = " << wgsize << "x" << wgsize << std::endl;
+      }
+      // the probe accumulated into the output; reset it before the timed run
+      q.submit([&](cl::sycl::handler& h) {
+        auto out = d_out.template get_access<cl::sycl::access::mode::discard_write>(h);
+        h.fill(out, static_cast<T>(0));
+      });
+      q.wait();
+    }
+
     for (auto iter = 0; iter<=iterations; iter++) {
 
       if (iter==1) stencil_time = prk::wtime();
 
-      stencil(q, n, d_in, d_out);
+      if (wgsize > 0) {
+        cl::sycl::range<2> lws {static_cast<size_t>(wgsize), static_cast<size_t>(wgsize)};
+        stencil_ndr(q, n, lws, d_in, d_out);
+      } else {
+        stencil(q, n, d_in, d_out);
+      }
 #ifdef TRISYCL
       q.wait();
 #endif
@@ -187,6 +251,39 @@ void run(cl::sycl::queue & q, int iterations, size_t n, size_t tile_size, bool s
       q.wait();
     }
     stencil_time = prk::wtime() - stencil_time;
+
+#ifndef VERBOSE
+    // reduce the interior norm on the device, one partial sum per row,
+    // so only O(n) data instead of the whole grid is read back; the
+    // debug build keeps the full readback and serial verification
+    d_out.set_final_data(static_cast<T*>(nullptr));
+    std::vector<T> h_rowsum(n-2*radius,0);
+    {
+      cl::sycl::buffer<T> d_rowsum { h_rowsum.data(), h_rowsum.size() };
+      q.submit([&](cl::sycl::handler& h) {
+
+        auto out = d_out.template get_access<cl::sycl::access::mode::read>(h);
+        auto row = d_rowsum.template get_access<cl::sycl::access::mode::discard_write>(h);
+
+        h.parallel_for<class rowsum<T>>(cl::sycl::range<1> {n-2*radius}, [=] (cl::sycl::item<1> it) {
+            const size_t i = it[0] + radius;
+            T sum(0);
+            for (size_t j=radius; j<n-radius; ++j) {
+#if USE_2D_INDEXING
+                sum += cl::sycl::fabs(out[cl::sycl::id<2>(i,j)]);
+#else
+                sum += cl::sycl::fabs(out[i*n+j]);
+#endif
+            }
+            row[it] = sum;
+        });
+      });
+      q.wait();
+    }
+    for (size_t i=0; i<h_rowsum.size(); ++i) {
+        norm += h_rowsum[i];
+    }
+#endif
   }
   catch (cl::sycl::exception e) {
     std::cout << e.what() << std::endl;
@@ -215,13 +312,14 @@ void run(cl::sycl::queue & q, int iterations, size_t n, size_t tile_size, bool s
   // interior of grid with respect to stencil
   auto active_points = (n-2L*radius)*(n-2L*radius);
 
-  // compute L1 norm in parallel
-  double norm(0);
+#ifdef VERBOSE
+  // compute L1 norm from the full readback - debug only
   for (int i=radius; i<n-radius; i++) {
     for (int j=radius; j<n-radius; j++) {
       norm += std::fabs(h_out[i*n+j]);
     }
   }
+#endif
   norm /= active_points;
 
   // verify correctness
@@ -255,12 +353,13 @@ int main(int argc, char * argv[])
   //////////////////////////////////////////////////////////////////////
 
   int iterations;
-  size_t n, tile_size;
+  size_t n;
+  int wgsize = 0;
   bool star = true;
   size_t radius = 2;
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <array dimension> [<tile size> <star/grid> <stencil radius>]";
+        throw "Usage: <# iterations> <array dimension> [<work-group size (0=default, auto=probe)> <star/grid> <stencil radius>]";
       }
 
       // number of times to run the algorithm
@@ -277,12 +376,10 @@ int main(int argc, char * argv[])
         throw "ERROR: grid dimension too large - overflow risk";
       }
 
-      // default tile size for tiling of local transpose
-      tile_size = 32;
+      // work-group size: 0 = runtime default, "auto" = probe phase
       if (argc > 3) {
-          tile_size = std::atoi(argv[3]);
-          if (tile_size <= 0) tile_size = n;
-          if (tile_size > n) tile_size = n;
+          wgsize = (std::string(argv[3]) == "auto") ? -1 : std::atoi(argv[3]);
+          if (wgsize > static_cast<int>(n)) wgsize = n;
       }
 
       // stencil pattern
@@ -309,6 +406,10 @@ int main(int argc, char * argv[])
 
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Grid size            = " << n << std::endl;
+  std::cout << "Work-group size      = ";
+  if      (wgsize < 0)  std::cout << "autotune" << std::endl;
+  else if (wgsize == 0) std::cout << "runtime default" << std::endl;
+  else                  std::cout << wgsize << "x" << wgsize << std::endl;
   std::cout << "Type of stencil      = " << (star ? "star" : "grid") << std::endl;
   std::cout << "Radius of stencil    = " << radius << std::endl;
 
@@ -331,8 +432,8 @@ int main(int argc, char * argv[])
         std::cout << "SYCL Platform: " << platform.get_info<cl::sycl::info::platform::name>() << std::endl;
 #endif
 
-        run<float>(host, iterations, n, tile_size, star, radius);
-        run<double>(host, iterations, n, tile_size, star, radius);
+        run<float>(host, iterations, n, wgsize, star, radius);
+        run<double>(host, iterations, n, wgsize, star, radius);
     }
 
     // CPU requires spir64 target
@@ -348,8 +449,8 @@ int main(int argc, char * argv[])
         bool has_spir = true; // ?
 #endif
         if (has_spir) {
-          run<float>(cpu, iterations, n, tile_size, star, radius);
-          run<double>(cpu, iterations, n, tile_size, star, radius);
+          run<float>(cpu, iterations, n, wgsize, star, radius);
+          run<double>(cpu, iterations, n, wgsize, star, radius);
         }
     }
 
@@ -371,17 +472,17 @@ int main(int argc, char * argv[])
           std::cout << "SYCL GPU device lacks FP64 support." << std::endl;
         }
         if (has_spir) {
-          run<float>(gpu, iterations, n, tile_size, star, radius);
+          run<float>(gpu, iterations, n, wgsize, star, radius);
           if (has_fp64) {
-            run<double>(gpu, iterations, n, tile_size, star, radius);
+            run<double>(gpu, iterations, n, wgsize, star, radius);
           }
         } else {
           std::cout << "SYCL GPU device lacks SPIR-V support." << std::endl;
 #ifdef __COMPUTECPP__
           std::cout << "You are using ComputeCpp so we will try it anyways..." << std::endl;
-          run<float>(gpu, iterations, n, tile_size, star, radius);
+          run<float>(gpu, iterations, n, wgsize, star, radius);
           if (has_fp64) {
-            run<double>(gpu, iterations, n, tile_size, star, radius);
+            run<double>(gpu, iterations, n, wgsize, star, radius);
           }
 #endif
         }
@@ -147,8 +147,12 @@ int main(int argc, char* argv[])
   }
 
   std::cout << "Number of iterations = " << iterations << std::endl;
+  const auto policy = prk::PSTL::get_policy();
+
   std::cout << "Grid size            = " << n << std::endl;
   std::cout << "Tile size            = " << tile_size << std::endl;
+  std::cout << "Execution policy     = " << prk::PSTL::policy_name(policy) << std::endl;
+  std::cout << "PSTL backend         = " << prk::PSTL::backend() << std::endl;
   std::cout << "Type of stencil      = " << (star ? "star" : "grid") << std::endl;
   std::cout << "Radius of stencil    = " << radius << std::endl;
 
@@ -182,17 +186,8 @@ int main(int argc, char* argv[])
 
   // initialize the input and output arrays
   auto range = prk::range(0,n);
-#if defined(USE_PSTL) && ( defined(USE_INTEL_PSTL) || ( defined(__GNUC__) && (__GNUC__ >= 9) ) )
-  std::for_each( exec::par, std::begin(range), std::end(range), [&] (int i) {
-    std::for_each( exec::unseq, std::begin(range), std::end(range), [&] (int j) {
-#elif defined(USE_PSTL) && defined(__GNUC__) && defined(__GNUC_MINOR__) \
-                        && ( (__GNUC__ == 8) || (__GNUC__ == 7) && (__GNUC_MINOR__ >= 2) )
-  __gnu_parallel::for_each( std::begin(range), std::end(range), [&] (int i) {
-    __gnu_parallel::for_each( std::begin(range), std::end(range), [&] (int j) {
-#else
-  std::for_each( std::begin(range), std::end(range), [&] (int i) {
-    std::for_each( std::begin(range), std::end(range), [&] (int j) {
-#endif
+  prk::PSTL::for_each( prk::PSTL::outer(policy), std::begin(range), std::end(range), [&] (int i) {
+    prk::PSTL::for_each( prk::PSTL::inner(policy), std::begin(range), std::end(range), [&] (int j) {
       in[i*n+j] = static_cast<double>(i+j);
       out[i*n+j] = 0.0;
     });
@@ -203,14 +198,7 @@ int main(int argc, char* argv[])
     // Apply the stencil operator
     stencil(n, tile_size, in, out);
     // Add constant to solution to force refresh of neighbor data, if any
-#if defined(USE_PSTL) && ( defined(USE_INTEL_PSTL) || ( defined(__GNUC__) && (__GNUC__ >= 9) ) )
-    std::transform( exec::par_unseq, in.begin(), in.end(), in.begin(), [](double c) { return c+=1.0; });
-#elif defined(USE_PSTL) && defined(__GNUC__) && defined(__GNUC_MINOR__) \
-                        && ( (__GNUC__ == 8) || (__GNUC__ == 7) && (__GNUC_MINOR__ >= 2) )
-    __gnu_parallel::transform( in.begin(), in.end(), in.begin(), [](double c) { return c+=1.0; });
-#else
-    std::transform( in.begin(), in.end(), in.begin(), [](double c) { return c+=1.0; });
-#endif
+    prk::PSTL::transform( policy, in.begin(), in.end(), in.begin(), [](double c) { return c+=1.0; });
   }
 
   stencil_time = prk::wtime() - stencil_time;
@@ -111,9 +111,9 @@ int main(int argc, char* argv[])
           if (tile_size > n) tile_size = n;
       }
 
-      // taskloop grainsize
+      // taskloop granularity: positive sets grainsize, negative num_tasks
       gs = (argc > 4) ? std::atoi(argv[4]) : 100;
-      if (gs < 1 || gs > n) {
+      if (gs == 0 || gs > n || -gs > n) {
         throw "ERROR: grainsize";
       }
 
@@ -141,7 +141,8 @@ int main(int argc, char* argv[])
 
 #ifdef _OPENMP
   std::cout << "Number of threads    = " << omp_get_max_threads() << std::endl;
-  std::cout << "Taskloop grainsize   = " << gs << std::endl;
+  if (gs > 0) std::cout << "Taskloop grainsize   = " << gs << std::endl;
+  else        std::cout << "Taskloop num_tasks   = " << -gs << std::endl;
 #endif
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Grid size            = " << n << std::endl;
@@ -180,14 +181,29 @@ int main(int argc, char* argv[])
   OMP_PARALLEL()
   OMP_MASTER
   {
-    OMP_TASKLOOP_COLLAPSE(2, firstprivate(n) shared(in,out) grainsize(gs) )
-    for (auto it=0; it<n; it+=tile_size) {
-      for (auto jt=0; jt<n; jt+=tile_size) {
-        for (auto i=it; i<std::min(n,it+tile_size); i++) {
-          PRAGMA_SIMD
-          for (auto j=jt; j<std::min(n,jt+tile_size); j++) {
-            in[i*n+j] = static_cast<double>(i+j);
-            out[i*n+j] = 0.0;
+    if (gs > 0) {
+      OMP_TASKLOOP_COLLAPSE(2, firstprivate(n) shared(in,out) grainsize(gs) )
+      for (auto it=0; it<n; it+=tile_size) {
+        for (auto jt=0; jt<n; jt+=tile_size) {
+          for (auto i=it; i<std::min(n,it+tile_size); i++) {
+            PRAGMA_SIMD
+            for (auto j=jt; j<std::min(n,jt+tile_size); j++) {
+              in[i*n+j] = static_cast<double>(i+j);
+              out[i*n+j] = 0.0;
+            }
+          }
+        }
+      }
+    } else {
+      OMP_TASKLOOP_COLLAPSE(2, firstprivate(n) shared(in,out) num_tasks(-gs) )
+      for (auto it=0; it<n; it+=tile_size) {
+        for (auto jt=0; jt<n; jt+=tile_size) {
+          for (auto i=it; i<std::min(n,it+tile_size); i++) {
+            PRAGMA_SIMD
+            for (auto j=jt; j<std::min(n,jt+tile_size); j++) {
+              in[i*n+j] = static_cast<double>(i+j);
+              out[i*n+j] = 0.0;
+            }
           }
         }
       }
@@ -202,13 +218,27 @@ int main(int argc, char* argv[])
       OMP_TASKWAIT
 
       // Add constant to solution to force refresh of neighbor data, if any
-      OMP_TASKLOOP_COLLAPSE(2, firstprivate(n) shared(in,out) grainsize(gs) )
-      for (auto it=0; it<n; it+=tile_size) {
-        for (auto jt=0; jt<n; jt+=tile_size) {
-          for (auto i=it; i<std::min(n,it+tile_size); i++) {
-            PRAGMA_SIMD
-            for (auto j=jt; j<std::min(n,jt+tile_size); j++) {
-              in[i*n+j] += 1.0;
+      if (gs > 0) {
+        OMP_TASKLOOP_COLLAPSE(2, firstprivate(n) shared(in,out) grainsize(gs) )
+        for (auto it=0; it<n; it+=tile_size) {
+          for (auto jt=0; jt<n; jt+=tile_size) {
+            for (auto i=it; i<std::min(n,it+tile_size); i++) {
+              PRAGMA_SIMD
+              for (auto j=jt; j<std::min(n,jt+tile_size); j++) {
+                in[i*n+j] += 1.0;
+              }
+            }
+          }
+        }
+      } else {
+        OMP_TASKLOOP_COLLAPSE(2, firstprivate(n) shared(in,out) num_tasks(-gs) )
+        for (auto it=0; it<n; it+=tile_size) {
+          for (auto jt=0; jt<n; jt+=tile_size) {
+            for (auto i=it; i<std::min(n,it+tile_size); i++) {
+              PRAGMA_SIMD
+              for (auto j=jt; j<std::min(n,jt+tile_size); j++) {
+                in[i*n+j] += 1.0;
+              }
             }
           }
         }
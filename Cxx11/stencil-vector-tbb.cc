@@ -63,6 +63,7 @@
 #include "prk_util.h"
 #include "prk_tbb.h"
 #include "stencil_tbb.hpp"
+#include "stencil_3d_tbb.hpp"
 
 void nothing(const int n, const int t, prk::vector<double> & in, prk::vector<double> & out)
 {
@@ -73,6 +74,16 @@ void nothing(const int n, const int t, prk::vector<double> & in, prk::vector<dou
     std::abort();
 }
 
+void nothing3(const int n, const int ti, const int tj, const int tk,
+              prk::vector<double> & in, prk::vector<double> & out)
+{
+    std::cout << "You are trying to use a stencil that does not exist." << std::endl;
+    std::cout << "3D stencils are generated for radii 1 through 4." << std::endl;
+    // n will never be zero - this is to silence compiler warnings.
+    if (n==0 || ti==0 || tj==0 || tk==0) std::cout << in.size() << out.size() << std::endl;
+    std::abort();
+}
+
 int main(int argc, char* argv[])
 {
   std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
@@ -84,10 +95,11 @@ int main(int argc, char* argv[])
 
   int iterations;
   int n, radius, tile_size;
+  int dim = 2, tj, tk;
   bool star = true;
   try {
       if (argc < 3){
-        throw "Usage: <# iterations> <array dimension> [tile_size] [<star/grid> <radius>]";
+        throw "Usage: <# iterations> <array dimension> [tile_size[,tj,tk]] [<star/grid/star3d/grid3d> <radius>]";
       }
 
       // number of times to run the algorithm
@@ -104,18 +116,27 @@ int main(int argc, char* argv[])
         throw "ERROR: grid dimension too large - overflow risk";
       }
 
-      // linear grid dimension
-      tile_size = 32;
+      // tile size; in 3D the three extents can be given independently
+      // as ti,tj,tk
+      tile_size = 32; tj = tk = 0;
       if (argc > 3) {
         tile_size  = std::atoi(argv[3]);
+        const char * comma = std::strchr(argv[3], ',');
+        if (comma != nullptr) {
+            tj = std::atoi(comma+1);
+            comma = std::strchr(comma+1, ',');
+            if (comma != nullptr) tk = std::atoi(comma+1);
+        }
         if (tile_size < 1 || tile_size > n) tile_size = n;
       }
+      if (tj <= 0 || tj > n) tj = tile_size;
+      if (tk <= 0 || tk > n) tk = tile_size;
 
-      // stencil pattern
+      // stencil pattern; the 3d shapes select the 3D kernels
       if (argc > 4) {
           auto stencil = std::string(argv[4]);
-          auto grid = std::string("grid");
-          star = (stencil == grid) ? false : true;
+          if (stencil == "star3d" || stencil == "grid3d") dim = 3;
+          star = (stencil == "grid" || stencil == "grid3d") ? false : true;
       }
 
       // stencil radius
@@ -127,6 +148,12 @@ int main(int argc, char* argv[])
       if ( (radius < 1) || (2*radius+1 > n) ) {
         throw "ERROR: Stencil radius negative or too large";
       }
+      if ( dim == 3 && radius > 4 ) {
+        throw "ERROR: 3D stencils are generated for radii 1 through 4";
+      }
+      if ( dim == 3 && n > std::floor(std::cbrt(INT_MAX)) ) {
+        throw "ERROR: grid dimension too large for 3D - overflow risk";
+      }
   }
   catch (const char * e) {
     std::cout << e << std::endl;
@@ -140,11 +167,35 @@ int main(int argc, char* argv[])
   std::cout << "Number of threads    = " << num_threads << std::endl;
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Grid size            = " << n << std::endl;
-  std::cout << "Tile size            = " << tile_size << std::endl;
-  std::cout << "Type of stencil      = " << (star ? "star" : "grid") << std::endl;
+  if (dim == 3) {
+    std::cout << "Tile size            = " << tile_size << "," << tj << "," << tk << std::endl;
+  } else {
+    std::cout << "Tile size            = " << tile_size << std::endl;
+  }
+  std::cout << "Type of stencil      = " << (star ? "star" : "grid")
+            << (dim == 3 ? " (3D)" : "") << std::endl;
   std::cout << "Radius of stencil    = " << radius << std::endl;
   std::cout << "TBB partitioner: " << typeid(tbb_partitioner).name() << std::endl;
 
+  auto stencil3 = nothing3;
+  if (dim == 3) {
+      if (star) {
+          switch (radius) {
+              case 1: stencil3 = star3d1; break;
+              case 2: stencil3 = star3d2; break;
+              case 3: stencil3 = star3d3; break;
+              case 4: stencil3 = star3d4; break;
+          }
+      } else {
+          switch (radius) {
+              case 1: stencil3 = grid3d1; break;
+              case 2: stencil3 = grid3d2; break;
+              case 3: stencil3 = grid3d3; break;
+              case 4: stencil3 = grid3d4; break;
+          }
+      }
+  }
+
   auto stencil = nothing;
   if (star) {
       switch (radius) {
@@ -170,17 +221,31 @@ int main(int argc, char* argv[])
 
   auto stencil_time = 0.0;
 
-  prk::vector<double> in(n*n);
-  prk::vector<double> out(n*n);
+  const size_t npoints = (dim == 3) ? static_cast<size_t>(n)*n*n
+                                    : static_cast<size_t>(n)*n;
+  prk::vector<double> in(npoints);
+  prk::vector<double> out(npoints);
 
-  tbb::blocked_range2d<int> range(0, n, tile_size, 0, n, tile_size);
+  // the 3D paths below reuse the i/j plane range and loop over k inside
+  tbb::blocked_range2d<int> range(0, n, (dim == 3) ? tj : tile_size,
+                                  0, n, (dim == 3) ? tk : tile_size);
   tbb::parallel_for( range, [&](decltype(range)& r) {
                      for (auto i=r.rows().begin(); i!=r.rows().end(); ++i ) {
+                         if (dim == 3) {
+                             for (auto j=r.cols().begin(); j!=r.cols().end(); ++j ) {
+                                 PRAGMA_SIMD
+                                 for (auto k=0; k<n; ++k) {
+                                     in[(i*n+j)*n+k] = static_cast<double>(i+j+k);
+                                     out[(i*n+j)*n+k] = 0.0;
+                                 }
+                             }
+                         } else {
                          PRAGMA_SIMD
                          for (auto j=r.cols().begin(); j!=r.cols().end(); ++j ) {
                              in[i*n+j] = static_cast<double>(i+j);
                              out[i*n+j] = 0.0;
                          }
+                         }
                      }
                    }, tbb_partitioner );
 
@@ -188,14 +253,24 @@ int main(int argc, char* argv[])
 
     if (iter==1) stencil_time = prk::wtime();
     // Apply the stencil operator
-    stencil(n, tile_size, in, out);
+    if (dim == 3) stencil3(n, tile_size, tj, tk, in, out);
+    else          stencil(n, tile_size, in, out);
     // Add constant to solution to force refresh of neighbor data, if any
     tbb::parallel_for( range, [&](decltype(range)& r) {
                        for (auto i=r.rows().begin(); i!=r.rows().end(); ++i ) {
+                           if (dim == 3) {
+                               for (auto j=r.cols().begin(); j!=r.cols().end(); ++j ) {
+                                   PRAGMA_SIMD
+                                   for (auto k=0; k<n; ++k) {
+                                       in[(i*n+j)*n+k] += 1.0;
+                                   }
+                               }
+                           } else {
                            PRAGMA_SIMD
                            for (auto j=r.cols().begin(); j!=r.cols().end(); ++j ) {
                                in[i*n+j] += 1.0;
                            }
+                           }
                        }
                      }, tbb_partitioner);
   }
@@ -207,6 +282,7 @@ int main(int argc, char* argv[])
 
   // interior of grid with respect to stencil
   size_t active_points = static_cast<size_t>(n-2*radius)*static_cast<size_t>(n-2*radius);
+  if (dim == 3) active_points *= static_cast<size_t>(n-2*radius);
 
   // compute L1 norm in parallel
   double norm = 0.0;
@@ -218,11 +294,19 @@ int main(int argc, char* argv[])
     }
   }
 #else
-  norm = tbb::parallel_reduce( range, double(0),
-                               [&](decltype(range)& r, double temp) -> double {
+  tbb::blocked_range2d<int> inside(radius, n-radius, (dim == 3) ? tj : tile_size,
+                                   radius, n-radius, (dim == 3) ? tk : tile_size);
+  norm = tbb::parallel_reduce( inside, double(0),
+                               [&](decltype(inside)& r, double temp) -> double {
                                    for (auto i=r.rows().begin(); i!=r.rows().end(); ++i ) {
                                        for (auto j=r.cols().begin(); j!=r.cols().end(); ++j ) {
+                                           if (dim == 3) {
+                                               for (auto k=radius; k<n-radius; ++k) {
+                                                   temp += std::fabs(out[(i*n+j)*n+k]);
+                                               }
+                                           } else {
                                            temp += std::fabs(out[i*n+j]);
+                                           }
                                        }
                                    }
                                    return temp;
@@ -232,9 +316,9 @@ int main(int argc, char* argv[])
 #endif
   norm /= active_points;
 
-  // verify correctness
+  // verify correctness; both 3D shapes advance a linear field by 3
   const double epsilon = 1.0e-8;
-  double reference_norm = 2.*(iterations+1.);
+  double reference_norm = (dim == 3) ? 3.*(iterations+1.) : 2.*(iterations+1.);
   if (std::fabs(norm-reference_norm) > epsilon) {
     std::cout << "ERROR: L1 norm = " << norm
               << " Reference L1 norm = " << reference_norm << std::endl;
@@ -245,7 +329,11 @@ int main(int argc, char* argv[])
     std::cout << "L1 norm = " << norm
               << " Reference L1 norm = " << reference_norm << std::endl;
 #endif
-    const int stencil_size = star ? 4*radius+1 : (2*radius+1)*(2*radius+1);
+    const int stencil_size =
+        (dim == 3) ? (star ? 6*radius+1
+                           : (2*radius+1)*(2*radius+1)*(2*radius+1)
+                            - (2*radius)*(2*radius)*(2*radius) - 1)
+                   : (star ? 4*radius+1 : (2*radius+1)*(2*radius+1));
     size_t flops = (2L*stencil_size+1L) * active_points;
     auto avgtime = stencil_time/iterations;
     std::cout << "Rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops)/avgtime
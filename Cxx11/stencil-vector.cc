@@ -43,6 +43,11 @@
 ///
 ///                <progname> <iterations> <grid size>
 ///
+///          Environment variable PRK_STENCIL_MODE=pingpong swaps the in
+///          and out buffers every iteration, the double-buffer pattern
+///          of real solvers; "both" runs the in-place and ping-pong
+///          modes back to back with labeled rates.
+///
 ///          The output consists of diagnostics to make sure the
 ///          algorithm worked, and of timing statistics.
 ///
@@ -158,27 +163,79 @@ int main(int argc, char* argv[])
       }
   }
 
+  // PRK_STENCIL_MODE selects the update pattern: "inplace" (default)
+  // accumulates into out, "pingpong" swaps the buffers every iteration
+  // the way real solvers do, and "both" runs the two back to back
+  const char * mode_env = std::getenv("PRK_STENCIL_MODE");
+  std::string mode = (mode_env!=nullptr) ? mode_env : "inplace";
+  if (mode!="inplace" && mode!="pingpong" && mode!="both") {
+      std::cout << "PRK_STENCIL_MODE=" << mode << " not recognized (inplace|pingpong|both); running inplace" << std::endl;
+      mode = "inplace";
+  }
+  const bool run_inplace  = (mode!="pingpong");
+  const bool run_pingpong = (mode=="pingpong" || mode=="both");
+  std::cout << "Update mode          = " << mode << std::endl;
+
   //////////////////////////////////////////////////////////////////////
   // Allocate space and perform the computation
   //////////////////////////////////////////////////////////////////////
 
-  auto stencil_time = 0.0;
-
   std::vector<double> in(n*n);
   std::vector<double> out(n*n);
 
-  {
+  auto initialize = [&](double out_value) {
     for (auto it=0; it<n; it+=tile_size) {
       for (auto jt=0; jt<n; jt+=tile_size) {
         for (auto i=it; i<std::min(n,it+tile_size); i++) {
           PRAGMA_SIMD
           for (auto j=jt; j<std::min(n,jt+tile_size); j++) {
             in[i*n+j] = static_cast<double>(i+j);
-            out[i*n+j] = 0.0;
+            out[i*n+j] = (out_value<0.0) ? static_cast<double>(i+j) : out_value;
           }
         }
       }
     }
+  };
+
+  // interior of grid with respect to stencil
+  size_t active_points = static_cast<size_t>(n-2*radius)*static_cast<size_t>(n-2*radius);
+
+  auto validate = [&](double stencil_time, double reference_norm,
+                      bool subtract_linear, const char * label) {
+    // compute L1 norm; the ping-pong field carries the linear i+j term,
+    // which is subtracted so the norm is again a small constant
+    double norm = 0.0;
+    for (auto i=radius; i<n-radius; i++) {
+      for (auto j=radius; j<n-radius; j++) {
+        norm += std::fabs(out[i*n+j] - (subtract_linear ? static_cast<double>(i+j) : 0.0));
+      }
+    }
+    norm /= active_points;
+
+    // verify correctness
+    const double epsilon = 1.0e-8;
+    if (std::fabs(norm-reference_norm) > epsilon) {
+      std::cout << "ERROR: L1 norm = " << norm
+                << " Reference L1 norm = " << reference_norm << std::endl;
+      return false;
+    } else {
+      std::cout << "Solution validates" << std::endl;
+#ifdef VERBOSE
+      std::cout << "L1 norm = " << norm
+                << " Reference L1 norm = " << reference_norm << std::endl;
+#endif
+      const int stencil_size = star ? 4*radius+1 : (2*radius+1)*(2*radius+1);
+      size_t flops = (2L*(size_t)stencil_size+1L) * active_points;
+      auto avgtime = stencil_time/iterations;
+      std::cout << label << "Rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops)/avgtime
+                << " Avg time (s): " << avgtime << std::endl;
+      return true;
+    }
+  };
+
+  if (run_inplace) {
+    auto stencil_time = 0.0;
+    initialize(0.0);
 
     for (auto iter = 0; iter<=iterations; iter++) {
 
@@ -189,42 +246,46 @@ int main(int argc, char* argv[])
       std::transform(in.begin(), in.end(), in.begin(), [](double c) { return c+=1.0; });
     }
     stencil_time = prk::wtime() - stencil_time;
+
+    if (!validate(stencil_time, 2.*(iterations+1.), false,
+                  (run_pingpong ? "In-place " : ""))) return 1;
   }
 
-  //////////////////////////////////////////////////////////////////////
-  // Analyze and output results.
-  //////////////////////////////////////////////////////////////////////
+  if (run_pingpong) {
+    auto stencil_time = 0.0;
+    // both buffers start from the linear field so that after every
+    // iteration each holds linear + constant, which keeps the
+    // validation closed-form
+    initialize(-1.0);
 
-  // interior of grid with respect to stencil
-  size_t active_points = static_cast<size_t>(n-2*radius)*static_cast<size_t>(n-2*radius);
+    for (auto iter = 0; iter<=iterations; iter++) {
 
-  // compute L1 norm in parallel
-  double norm = 0.0;
-  for (auto i=radius; i<n-radius; i++) {
-    for (auto j=radius; j<n-radius; j++) {
-      norm += std::fabs(out[i*n+j]);
+      if (iter==1) stencil_time = prk::wtime();
+      // Apply the stencil operator
+      stencil(n, tile_size, in, out);
+      // exact boundary condition: the stencil applied to the linear
+      // field adds 2 at every interior point, so the boundary ring gets
+      // the same increment and the whole field stays linear + constant
+      for (auto i=0; i<n; i++) {
+        for (auto j=0; j<n; j++) {
+          if (i<radius || i>=n-radius || j<radius || j>=n-radius) {
+            out[i*n+j] += 2.0;
+          }
+        }
+      }
+      // Add constant to solution to force refresh of neighbor data, if any
+      std::transform(in.begin(), in.end(), in.begin(), [](double c) { return c+=1.0; });
+      // the double-buffer exchange of real solvers: three pointer moves
+      std::swap(in, out);
     }
-  }
-  norm /= active_points;
-
-  // verify correctness
-  const double epsilon = 1.0e-8;
-  double reference_norm = 2.*(iterations+1.);
-  if (std::fabs(norm-reference_norm) > epsilon) {
-    std::cout << "ERROR: L1 norm = " << norm
-              << " Reference L1 norm = " << reference_norm << std::endl;
-    return 1;
-  } else {
-    std::cout << "Solution validates" << std::endl;
-#ifdef VERBOSE
-    std::cout << "L1 norm = " << norm
-              << " Reference L1 norm = " << reference_norm << std::endl;
-#endif
-    const int stencil_size = star ? 4*radius+1 : (2*radius+1)*(2*radius+1);
-    size_t flops = (2L*(size_t)stencil_size+1L) * active_points;
-    auto avgtime = stencil_time/iterations;
-    std::cout << "Rate (MFlops/s): " << 1.0e-6 * static_cast<double>(flops)/avgtime
-              << " Avg time (s): " << avgtime << std::endl;
+    stencil_time = prk::wtime() - stencil_time;
+
+    // the buffer constants follow a(k+1)=b(k)+2, b(k+1)=a(k)+1 from
+    // a(0)=b(0)=0; after T=iterations+1 swaps out holds b(T)
+    const int T = iterations+1;
+    const double reference_norm = (T%2==0) ? 1.5*T : 1.5*(T-1)+1.;
+    if (!validate(stencil_time, reference_norm, true,
+                  (run_inplace ? "Ping-pong " : ""))) return 1;
   }
 
   return 0;
@@ -0,0 +1,548 @@
+void star3d1(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto it=1; it<n-1; it+=ti) {
+      for (auto jt=1; jt<n-1; jt+=tj) {
+       for (auto kt=1; kt<n-1; kt+=tk) {
+        for (auto i=it; i<std::min(n-1,it+ti); ++i) {
+          for (auto j=jt; j<std::min(n-1,jt+tj); ++j) {
+            PRAGMA_SIMD
+            for (auto k=kt; k<std::min(n-1,kt+tk); ++k) {
+                out[(i*n+j)*n+k] += +in[((i-1)*n+(j))*n+(k)] * -0.5
+                              +in[((i)*n+(j-1))*n+(k)] * -0.5
+                              +in[((i)*n+(j))*n+(k-1)] * -0.5
+                              +in[((i)*n+(j))*n+(k+1)] * 0.5
+                              +in[((i)*n+(j+1))*n+(k)] * 0.5
+                              +in[((i+1)*n+(j))*n+(k)] * 0.5;
+             }
+           }
+         }
+        }
+      }
+    }
+}
+
+void star3d2(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto it=2; it<n-2; it+=ti) {
+      for (auto jt=2; jt<n-2; jt+=tj) {
+       for (auto kt=2; kt<n-2; kt+=tk) {
+        for (auto i=it; i<std::min(n-2,it+ti); ++i) {
+          for (auto j=jt; j<std::min(n-2,jt+tj); ++j) {
+            PRAGMA_SIMD
+            for (auto k=kt; k<std::min(n-2,kt+tk); ++k) {
+                out[(i*n+j)*n+k] += +in[((i-2)*n+(j))*n+(k)] * -0.125
+                              +in[((i-1)*n+(j))*n+(k)] * -0.25
+                              +in[((i)*n+(j-2))*n+(k)] * -0.125
+                              +in[((i)*n+(j-1))*n+(k)] * -0.25
+                              +in[((i)*n+(j))*n+(k-2)] * -0.125
+                              +in[((i)*n+(j))*n+(k-1)] * -0.25
+                              +in[((i)*n+(j))*n+(k+1)] * 0.25
+                              +in[((i)*n+(j))*n+(k+2)] * 0.125
+                              +in[((i)*n+(j+1))*n+(k)] * 0.25
+                              +in[((i)*n+(j+2))*n+(k)] * 0.125
+                              +in[((i+1)*n+(j))*n+(k)] * 0.25
+                              +in[((i+2)*n+(j))*n+(k)] * 0.125;
+             }
+           }
+         }
+        }
+      }
+    }
+}
+
+void star3d3(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto it=3; it<n-3; it+=ti) {
+      for (auto jt=3; jt<n-3; jt+=tj) {
+       for (auto kt=3; kt<n-3; kt+=tk) {
+        for (auto i=it; i<std::min(n-3,it+ti); ++i) {
+          for (auto j=jt; j<std::min(n-3,jt+tj); ++j) {
+            PRAGMA_SIMD
+            for (auto k=kt; k<std::min(n-3,kt+tk); ++k) {
+                out[(i*n+j)*n+k] += +in[((i-3)*n+(j))*n+(k)] * -0.05555555555555555
+                              +in[((i-2)*n+(j))*n+(k)] * -0.08333333333333333
+                              +in[((i-1)*n+(j))*n+(k)] * -0.16666666666666666
+                              +in[((i)*n+(j-3))*n+(k)] * -0.05555555555555555
+                              +in[((i)*n+(j-2))*n+(k)] * -0.08333333333333333
+                              +in[((i)*n+(j-1))*n+(k)] * -0.16666666666666666
+                              +in[((i)*n+(j))*n+(k-3)] * -0.05555555555555555
+                              +in[((i)*n+(j))*n+(k-2)] * -0.08333333333333333
+                              +in[((i)*n+(j))*n+(k-1)] * -0.16666666666666666
+                              +in[((i)*n+(j))*n+(k+1)] * 0.16666666666666666
+                              +in[((i)*n+(j))*n+(k+2)] * 0.08333333333333333
+                              +in[((i)*n+(j))*n+(k+3)] * 0.05555555555555555
+                              +in[((i)*n+(j+1))*n+(k)] * 0.16666666666666666
+                              +in[((i)*n+(j+2))*n+(k)] * 0.08333333333333333
+                              +in[((i)*n+(j+3))*n+(k)] * 0.05555555555555555
+                              +in[((i+1)*n+(j))*n+(k)] * 0.16666666666666666
+                              +in[((i+2)*n+(j))*n+(k)] * 0.08333333333333333
+                              +in[((i+3)*n+(j))*n+(k)] * 0.05555555555555555;
+             }
+           }
+         }
+        }
+      }
+    }
+}
+
+void star3d4(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto it=4; it<n-4; it+=ti) {
+      for (auto jt=4; jt<n-4; jt+=tj) {
+       for (auto kt=4; kt<n-4; kt+=tk) {
+        for (auto i=it; i<std::min(n-4,it+ti); ++i) {
+          for (auto j=jt; j<std::min(n-4,jt+tj); ++j) {
+            PRAGMA_SIMD
+            for (auto k=kt; k<std::min(n-4,kt+tk); ++k) {
+                out[(i*n+j)*n+k] += +in[((i-4)*n+(j))*n+(k)] * -0.03125
+                              +in[((i-3)*n+(j))*n+(k)] * -0.041666666666666664
+                              +in[((i-2)*n+(j))*n+(k)] * -0.0625
+                              +in[((i-1)*n+(j))*n+(k)] * -0.125
+                              +in[((i)*n+(j-4))*n+(k)] * -0.03125
+                              +in[((i)*n+(j-3))*n+(k)] * -0.041666666666666664
+                              +in[((i)*n+(j-2))*n+(k)] * -0.0625
+                              +in[((i)*n+(j-1))*n+(k)] * -0.125
+                              +in[((i)*n+(j))*n+(k-4)] * -0.03125
+                              +in[((i)*n+(j))*n+(k-3)] * -0.041666666666666664
+                              +in[((i)*n+(j))*n+(k-2)] * -0.0625
+                              +in[((i)*n+(j))*n+(k-1)] * -0.125
+                              +in[((i)*n+(j))*n+(k+1)] * 0.125
+                              +in[((i)*n+(j))*n+(k+2)] * 0.0625
+                              +in[((i)*n+(j))*n+(k+3)] * 0.041666666666666664
+                              +in[((i)*n+(j))*n+(k+4)] * 0.03125
+                              +in[((i)*n+(j+1))*n+(k)] * 0.125
+                              +in[((i)*n+(j+2))*n+(k)] * 0.0625
+                              +in[((i)*n+(j+3))*n+(k)] * 0.041666666666666664
+                              +in[((i)*n+(j+4))*n+(k)] * 0.03125
+                              +in[((i+1)*n+(j))*n+(k)] * 0.125
+                              +in[((i+2)*n+(j))*n+(k)] * 0.0625
+                              +in[((i+3)*n+(j))*n+(k)] * 0.041666666666666664
+                              +in[((i+4)*n+(j))*n+(k)] * 0.03125;
+             }
+           }
+         }
+        }
+      }
+    }
+}
+
+void grid3d1(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto it=1; it<n-1; it+=ti) {
+      for (auto jt=1; jt<n-1; jt+=tj) {
+       for (auto kt=1; kt<n-1; kt+=tk) {
+        for (auto i=it; i<std::min(n-1,it+ti); ++i) {
+          for (auto j=jt; j<std::min(n-1,jt+tj); ++j) {
+            PRAGMA_SIMD
+            for (auto k=kt; k<std::min(n-1,kt+tk); ++k) {
+                out[(i*n+j)*n+k] += +in[((i-1)*n+(j-1))*n+(k)] * -0.125
+                              +in[((i-1)*n+(j))*n+(k-1)] * -0.125
+                              +in[((i-1)*n+(j))*n+(k)] * -0.25
+                              +in[((i)*n+(j-1))*n+(k-1)] * -0.125
+                              +in[((i)*n+(j-1))*n+(k)] * -0.25
+                              +in[((i)*n+(j))*n+(k-1)] * -0.25
+                              +in[((i)*n+(j))*n+(k+1)] * 0.25
+                              +in[((i)*n+(j+1))*n+(k)] * 0.25
+                              +in[((i)*n+(j+1))*n+(k+1)] * 0.125
+                              +in[((i+1)*n+(j))*n+(k)] * 0.25
+                              +in[((i+1)*n+(j))*n+(k+1)] * 0.125
+                              +in[((i+1)*n+(j+1))*n+(k)] * 0.125;
+             }
+           }
+         }
+        }
+      }
+    }
+}
+
+void grid3d2(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto it=2; it<n-2; it+=ti) {
+      for (auto jt=2; jt<n-2; jt+=tj) {
+       for (auto kt=2; kt<n-2; kt+=tk) {
+        for (auto i=it; i<std::min(n-2,it+ti); ++i) {
+          for (auto j=jt; j<std::min(n-2,jt+tj); ++j) {
+            PRAGMA_SIMD
+            for (auto k=kt; k<std::min(n-2,kt+tk); ++k) {
+                out[(i*n+j)*n+k] += +in[((i-2)*n+(j-2))*n+(k)] * -0.03125
+                              +in[((i-2)*n+(j-1))*n+(k)] * -0.010416666666666666
+                              +in[((i-2)*n+(j))*n+(k-2)] * -0.03125
+                              +in[((i-2)*n+(j))*n+(k-1)] * -0.010416666666666666
+                              +in[((i-2)*n+(j))*n+(k)] * -0.020833333333333332
+                              +in[((i-2)*n+(j))*n+(k+1)] * -0.010416666666666666
+                              +in[((i-2)*n+(j+1))*n+(k)] * -0.010416666666666666
+                              +in[((i-1)*n+(j-2))*n+(k)] * -0.010416666666666666
+                              +in[((i-1)*n+(j-1))*n+(k)] * -0.0625
+                              +in[((i-1)*n+(j))*n+(k-2)] * -0.010416666666666666
+                              +in[((i-1)*n+(j))*n+(k-1)] * -0.0625
+                              +in[((i-1)*n+(j))*n+(k)] * -0.125
+                              +in[((i-1)*n+(j))*n+(k+2)] * 0.010416666666666666
+                              +in[((i-1)*n+(j+2))*n+(k)] * 0.010416666666666666
+                              +in[((i)*n+(j-2))*n+(k-2)] * -0.03125
+                              +in[((i)*n+(j-2))*n+(k-1)] * -0.010416666666666666
+                              +in[((i)*n+(j-2))*n+(k)] * -0.020833333333333332
+                              +in[((i)*n+(j-2))*n+(k+1)] * -0.010416666666666666
+                              +in[((i)*n+(j-1))*n+(k-2)] * -0.010416666666666666
+                              +in[((i)*n+(j-1))*n+(k-1)] * -0.0625
+                              +in[((i)*n+(j-1))*n+(k)] * -0.125
+                              +in[((i)*n+(j-1))*n+(k+2)] * 0.010416666666666666
+                              +in[((i)*n+(j))*n+(k-2)] * -0.020833333333333332
+                              +in[((i)*n+(j))*n+(k-1)] * -0.125
+                              +in[((i)*n+(j))*n+(k+1)] * 0.125
+                              +in[((i)*n+(j))*n+(k+2)] * 0.020833333333333332
+                              +in[((i)*n+(j+1))*n+(k-2)] * -0.010416666666666666
+                              +in[((i)*n+(j+1))*n+(k)] * 0.125
+                              +in[((i)*n+(j+1))*n+(k+1)] * 0.0625
+                              +in[((i)*n+(j+1))*n+(k+2)] * 0.010416666666666666
+                              +in[((i)*n+(j+2))*n+(k-1)] * 0.010416666666666666
+                              +in[((i)*n+(j+2))*n+(k)] * 0.020833333333333332
+                              +in[((i)*n+(j+2))*n+(k+1)] * 0.010416666666666666
+                              +in[((i)*n+(j+2))*n+(k+2)] * 0.03125
+                              +in[((i+1)*n+(j-2))*n+(k)] * -0.010416666666666666
+                              +in[((i+1)*n+(j))*n+(k-2)] * -0.010416666666666666
+                              +in[((i+1)*n+(j))*n+(k)] * 0.125
+                              +in[((i+1)*n+(j))*n+(k+1)] * 0.0625
+                              +in[((i+1)*n+(j))*n+(k+2)] * 0.010416666666666666
+                              +in[((i+1)*n+(j+1))*n+(k)] * 0.0625
+                              +in[((i+1)*n+(j+2))*n+(k)] * 0.010416666666666666
+                              +in[((i+2)*n+(j-1))*n+(k)] * 0.010416666666666666
+                              +in[((i+2)*n+(j))*n+(k-1)] * 0.010416666666666666
+                              +in[((i+2)*n+(j))*n+(k)] * 0.020833333333333332
+                              +in[((i+2)*n+(j))*n+(k+1)] * 0.010416666666666666
+                              +in[((i+2)*n+(j))*n+(k+2)] * 0.03125
+                              +in[((i+2)*n+(j+1))*n+(k)] * 0.010416666666666666
+                              +in[((i+2)*n+(j+2))*n+(k)] * 0.03125;
+             }
+           }
+         }
+        }
+      }
+    }
+}
+
+void grid3d3(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto it=3; it<n-3; it+=ti) {
+      for (auto jt=3; jt<n-3; jt+=tj) {
+       for (auto kt=3; kt<n-3; kt+=tk) {
+        for (auto i=it; i<std::min(n-3,it+ti); ++i) {
+          for (auto j=jt; j<std::min(n-3,jt+tj); ++j) {
+            PRAGMA_SIMD
+            for (auto k=kt; k<std::min(n-3,kt+tk); ++k) {
+                out[(i*n+j)*n+k] += +in[((i-3)*n+(j-3))*n+(k)] * -0.013888888888888888
+                              +in[((i-3)*n+(j-2))*n+(k)] * -0.002777777777777778
+                              +in[((i-3)*n+(j-1))*n+(k)] * -0.002777777777777778
+                              +in[((i-3)*n+(j))*n+(k-3)] * -0.013888888888888888
+                              +in[((i-3)*n+(j))*n+(k-2)] * -0.002777777777777778
+                              +in[((i-3)*n+(j))*n+(k-1)] * -0.002777777777777778
+                              +in[((i-3)*n+(j))*n+(k)] * -0.005555555555555556
+                              +in[((i-3)*n+(j))*n+(k+1)] * -0.002777777777777778
+                              +in[((i-3)*n+(j))*n+(k+2)] * -0.002777777777777778
+                              +in[((i-3)*n+(j+1))*n+(k)] * -0.002777777777777778
+                              +in[((i-3)*n+(j+2))*n+(k)] * -0.002777777777777778
+                              +in[((i-2)*n+(j-3))*n+(k)] * -0.002777777777777778
+                              +in[((i-2)*n+(j-2))*n+(k)] * -0.020833333333333332
+                              +in[((i-2)*n+(j-1))*n+(k)] * -0.006944444444444444
+                              +in[((i-2)*n+(j))*n+(k-3)] * -0.002777777777777778
+                              +in[((i-2)*n+(j))*n+(k-2)] * -0.020833333333333332
+                              +in[((i-2)*n+(j))*n+(k-1)] * -0.006944444444444444
+                              +in[((i-2)*n+(j))*n+(k)] * -0.013888888888888888
+                              +in[((i-2)*n+(j))*n+(k+1)] * -0.006944444444444444
+                              +in[((i-2)*n+(j))*n+(k+3)] * 0.002777777777777778
+                              +in[((i-2)*n+(j+1))*n+(k)] * -0.006944444444444444
+                              +in[((i-2)*n+(j+3))*n+(k)] * 0.002777777777777778
+                              +in[((i-1)*n+(j-3))*n+(k)] * -0.002777777777777778
+                              +in[((i-1)*n+(j-2))*n+(k)] * -0.006944444444444444
+                              +in[((i-1)*n+(j-1))*n+(k)] * -0.041666666666666664
+                              +in[((i-1)*n+(j))*n+(k-3)] * -0.002777777777777778
+                              +in[((i-1)*n+(j))*n+(k-2)] * -0.006944444444444444
+                              +in[((i-1)*n+(j))*n+(k-1)] * -0.041666666666666664
+                              +in[((i-1)*n+(j))*n+(k)] * -0.08333333333333333
+                              +in[((i-1)*n+(j))*n+(k+2)] * 0.006944444444444444
+                              +in[((i-1)*n+(j))*n+(k+3)] * 0.002777777777777778
+                              +in[((i-1)*n+(j+2))*n+(k)] * 0.006944444444444444
+                              +in[((i-1)*n+(j+3))*n+(k)] * 0.002777777777777778
+                              +in[((i)*n+(j-3))*n+(k-3)] * -0.013888888888888888
+                              +in[((i)*n+(j-3))*n+(k-2)] * -0.002777777777777778
+                              +in[((i)*n+(j-3))*n+(k-1)] * -0.002777777777777778
+                              +in[((i)*n+(j-3))*n+(k)] * -0.005555555555555556
+                              +in[((i)*n+(j-3))*n+(k+1)] * -0.002777777777777778
+                              +in[((i)*n+(j-3))*n+(k+2)] * -0.002777777777777778
+                              +in[((i)*n+(j-2))*n+(k-3)] * -0.002777777777777778
+                              +in[((i)*n+(j-2))*n+(k-2)] * -0.020833333333333332
+                              +in[((i)*n+(j-2))*n+(k-1)] * -0.006944444444444444
+                              +in[((i)*n+(j-2))*n+(k)] * -0.013888888888888888
+                              +in[((i)*n+(j-2))*n+(k+1)] * -0.006944444444444444
+                              +in[((i)*n+(j-2))*n+(k+3)] * 0.002777777777777778
+                              +in[((i)*n+(j-1))*n+(k-3)] * -0.002777777777777778
+                              +in[((i)*n+(j-1))*n+(k-2)] * -0.006944444444444444
+                              +in[((i)*n+(j-1))*n+(k-1)] * -0.041666666666666664
+                              +in[((i)*n+(j-1))*n+(k)] * -0.08333333333333333
+                              +in[((i)*n+(j-1))*n+(k+2)] * 0.006944444444444444
+                              +in[((i)*n+(j-1))*n+(k+3)] * 0.002777777777777778
+                              +in[((i)*n+(j))*n+(k-3)] * -0.005555555555555556
+                              +in[((i)*n+(j))*n+(k-2)] * -0.013888888888888888
+                              +in[((i)*n+(j))*n+(k-1)] * -0.08333333333333333
+                              +in[((i)*n+(j))*n+(k+1)] * 0.08333333333333333
+                              +in[((i)*n+(j))*n+(k+2)] * 0.013888888888888888
+                              +in[((i)*n+(j))*n+(k+3)] * 0.005555555555555556
+                              +in[((i)*n+(j+1))*n+(k-3)] * -0.002777777777777778
+                              +in[((i)*n+(j+1))*n+(k-2)] * -0.006944444444444444
+                              +in[((i)*n+(j+1))*n+(k)] * 0.08333333333333333
+                              +in[((i)*n+(j+1))*n+(k+1)] * 0.041666666666666664
+                              +in[((i)*n+(j+1))*n+(k+2)] * 0.006944444444444444
+                              +in[((i)*n+(j+1))*n+(k+3)] * 0.002777777777777778
+                              +in[((i)*n+(j+2))*n+(k-3)] * -0.002777777777777778
+                              +in[((i)*n+(j+2))*n+(k-1)] * 0.006944444444444444
+                              +in[((i)*n+(j+2))*n+(k)] * 0.013888888888888888
+                              +in[((i)*n+(j+2))*n+(k+1)] * 0.006944444444444444
+                              +in[((i)*n+(j+2))*n+(k+2)] * 0.020833333333333332
+                              +in[((i)*n+(j+2))*n+(k+3)] * 0.002777777777777778
+                              +in[((i)*n+(j+3))*n+(k-2)] * 0.002777777777777778
+                              +in[((i)*n+(j+3))*n+(k-1)] * 0.002777777777777778
+                              +in[((i)*n+(j+3))*n+(k)] * 0.005555555555555556
+                              +in[((i)*n+(j+3))*n+(k+1)] * 0.002777777777777778
+                              +in[((i)*n+(j+3))*n+(k+2)] * 0.002777777777777778
+                              +in[((i)*n+(j+3))*n+(k+3)] * 0.013888888888888888
+                              +in[((i+1)*n+(j-3))*n+(k)] * -0.002777777777777778
+                              +in[((i+1)*n+(j-2))*n+(k)] * -0.006944444444444444
+                              +in[((i+1)*n+(j))*n+(k-3)] * -0.002777777777777778
+                              +in[((i+1)*n+(j))*n+(k-2)] * -0.006944444444444444
+                              +in[((i+1)*n+(j))*n+(k)] * 0.08333333333333333
+                              +in[((i+1)*n+(j))*n+(k+1)] * 0.041666666666666664
+                              +in[((i+1)*n+(j))*n+(k+2)] * 0.006944444444444444
+                              +in[((i+1)*n+(j))*n+(k+3)] * 0.002777777777777778
+                              +in[((i+1)*n+(j+1))*n+(k)] * 0.041666666666666664
+                              +in[((i+1)*n+(j+2))*n+(k)] * 0.006944444444444444
+                              +in[((i+1)*n+(j+3))*n+(k)] * 0.002777777777777778
+                              +in[((i+2)*n+(j-3))*n+(k)] * -0.002777777777777778
+                              +in[((i+2)*n+(j-1))*n+(k)] * 0.006944444444444444
+                              +in[((i+2)*n+(j))*n+(k-3)] * -0.002777777777777778
+                              +in[((i+2)*n+(j))*n+(k-1)] * 0.006944444444444444
+                              +in[((i+2)*n+(j))*n+(k)] * 0.013888888888888888
+                              +in[((i+2)*n+(j))*n+(k+1)] * 0.006944444444444444
+                              +in[((i+2)*n+(j))*n+(k+2)] * 0.020833333333333332
+                              +in[((i+2)*n+(j))*n+(k+3)] * 0.002777777777777778
+                              +in[((i+2)*n+(j+1))*n+(k)] * 0.006944444444444444
+                              +in[((i+2)*n+(j+2))*n+(k)] * 0.020833333333333332
+                              +in[((i+2)*n+(j+3))*n+(k)] * 0.002777777777777778
+                              +in[((i+3)*n+(j-2))*n+(k)] * 0.002777777777777778
+                              +in[((i+3)*n+(j-1))*n+(k)] * 0.002777777777777778
+                              +in[((i+3)*n+(j))*n+(k-2)] * 0.002777777777777778
+                              +in[((i+3)*n+(j))*n+(k-1)] * 0.002777777777777778
+                              +in[((i+3)*n+(j))*n+(k)] * 0.005555555555555556
+                              +in[((i+3)*n+(j))*n+(k+1)] * 0.002777777777777778
+                              +in[((i+3)*n+(j))*n+(k+2)] * 0.002777777777777778
+                              +in[((i+3)*n+(j))*n+(k+3)] * 0.013888888888888888
+                              +in[((i+3)*n+(j+1))*n+(k)] * 0.002777777777777778
+                              +in[((i+3)*n+(j+2))*n+(k)] * 0.002777777777777778
+                              +in[((i+3)*n+(j+3))*n+(k)] * 0.013888888888888888;
+             }
+           }
+         }
+        }
+      }
+    }
+}
+
+void grid3d4(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto it=4; it<n-4; it+=ti) {
+      for (auto jt=4; jt<n-4; jt+=tj) {
+       for (auto kt=4; kt<n-4; kt+=tk) {
+        for (auto i=it; i<std::min(n-4,it+ti); ++i) {
+          for (auto j=jt; j<std::min(n-4,jt+tj); ++j) {
+            PRAGMA_SIMD
+            for (auto k=kt; k<std::min(n-4,kt+tk); ++k) {
+                out[(i*n+j)*n+k] += +in[((i-4)*n+(j-4))*n+(k)] * -0.0078125
+                              +in[((i-4)*n+(j-3))*n+(k)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j-2))*n+(k)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j-1))*n+(k)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j))*n+(k-4)] * -0.0078125
+                              +in[((i-4)*n+(j))*n+(k-3)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j))*n+(k-2)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j))*n+(k-1)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j))*n+(k)] * -0.002232142857142857
+                              +in[((i-4)*n+(j))*n+(k+1)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j))*n+(k+2)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j))*n+(k+3)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j+1))*n+(k)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j+2))*n+(k)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j+3))*n+(k)] * -0.0011160714285714285
+                              +in[((i-3)*n+(j-4))*n+(k)] * -0.0011160714285714285
+                              +in[((i-3)*n+(j-3))*n+(k)] * -0.010416666666666666
+                              +in[((i-3)*n+(j-2))*n+(k)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j-1))*n+(k)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i-3)*n+(j))*n+(k-3)] * -0.010416666666666666
+                              +in[((i-3)*n+(j))*n+(k-2)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j))*n+(k-1)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j))*n+(k)] * -0.004166666666666667
+                              +in[((i-3)*n+(j))*n+(k+1)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j))*n+(k+2)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i-3)*n+(j+1))*n+(k)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j+2))*n+(k)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j+4))*n+(k)] * 0.0011160714285714285
+                              +in[((i-2)*n+(j-4))*n+(k)] * -0.0011160714285714285
+                              +in[((i-2)*n+(j-3))*n+(k)] * -0.0020833333333333333
+                              +in[((i-2)*n+(j-2))*n+(k)] * -0.015625
+                              +in[((i-2)*n+(j-1))*n+(k)] * -0.005208333333333333
+                              +in[((i-2)*n+(j))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i-2)*n+(j))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i-2)*n+(j))*n+(k-2)] * -0.015625
+                              +in[((i-2)*n+(j))*n+(k-1)] * -0.005208333333333333
+                              +in[((i-2)*n+(j))*n+(k)] * -0.010416666666666666
+                              +in[((i-2)*n+(j))*n+(k+1)] * -0.005208333333333333
+                              +in[((i-2)*n+(j))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i-2)*n+(j))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i-2)*n+(j+1))*n+(k)] * -0.005208333333333333
+                              +in[((i-2)*n+(j+3))*n+(k)] * 0.0020833333333333333
+                              +in[((i-2)*n+(j+4))*n+(k)] * 0.0011160714285714285
+                              +in[((i-1)*n+(j-4))*n+(k)] * -0.0011160714285714285
+                              +in[((i-1)*n+(j-3))*n+(k)] * -0.0020833333333333333
+                              +in[((i-1)*n+(j-2))*n+(k)] * -0.005208333333333333
+                              +in[((i-1)*n+(j-1))*n+(k)] * -0.03125
+                              +in[((i-1)*n+(j))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i-1)*n+(j))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i-1)*n+(j))*n+(k-2)] * -0.005208333333333333
+                              +in[((i-1)*n+(j))*n+(k-1)] * -0.03125
+                              +in[((i-1)*n+(j))*n+(k)] * -0.0625
+                              +in[((i-1)*n+(j))*n+(k+2)] * 0.005208333333333333
+                              +in[((i-1)*n+(j))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i-1)*n+(j))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i-1)*n+(j+2))*n+(k)] * 0.005208333333333333
+                              +in[((i-1)*n+(j+3))*n+(k)] * 0.0020833333333333333
+                              +in[((i-1)*n+(j+4))*n+(k)] * 0.0011160714285714285
+                              +in[((i)*n+(j-4))*n+(k-4)] * -0.0078125
+                              +in[((i)*n+(j-4))*n+(k-3)] * -0.0011160714285714285
+                              +in[((i)*n+(j-4))*n+(k-2)] * -0.0011160714285714285
+                              +in[((i)*n+(j-4))*n+(k-1)] * -0.0011160714285714285
+                              +in[((i)*n+(j-4))*n+(k)] * -0.002232142857142857
+                              +in[((i)*n+(j-4))*n+(k+1)] * -0.0011160714285714285
+                              +in[((i)*n+(j-4))*n+(k+2)] * -0.0011160714285714285
+                              +in[((i)*n+(j-4))*n+(k+3)] * -0.0011160714285714285
+                              +in[((i)*n+(j-3))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i)*n+(j-3))*n+(k-3)] * -0.010416666666666666
+                              +in[((i)*n+(j-3))*n+(k-2)] * -0.0020833333333333333
+                              +in[((i)*n+(j-3))*n+(k-1)] * -0.0020833333333333333
+                              +in[((i)*n+(j-3))*n+(k)] * -0.004166666666666667
+                              +in[((i)*n+(j-3))*n+(k+1)] * -0.0020833333333333333
+                              +in[((i)*n+(j-3))*n+(k+2)] * -0.0020833333333333333
+                              +in[((i)*n+(j-3))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i)*n+(j-2))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i)*n+(j-2))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i)*n+(j-2))*n+(k-2)] * -0.015625
+                              +in[((i)*n+(j-2))*n+(k-1)] * -0.005208333333333333
+                              +in[((i)*n+(j-2))*n+(k)] * -0.010416666666666666
+                              +in[((i)*n+(j-2))*n+(k+1)] * -0.005208333333333333
+                              +in[((i)*n+(j-2))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i)*n+(j-2))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i)*n+(j-1))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i)*n+(j-1))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i)*n+(j-1))*n+(k-2)] * -0.005208333333333333
+                              +in[((i)*n+(j-1))*n+(k-1)] * -0.03125
+                              +in[((i)*n+(j-1))*n+(k)] * -0.0625
+                              +in[((i)*n+(j-1))*n+(k+2)] * 0.005208333333333333
+                              +in[((i)*n+(j-1))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i)*n+(j-1))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i)*n+(j))*n+(k-4)] * -0.002232142857142857
+                              +in[((i)*n+(j))*n+(k-3)] * -0.004166666666666667
+                              +in[((i)*n+(j))*n+(k-2)] * -0.010416666666666666
+                              +in[((i)*n+(j))*n+(k-1)] * -0.0625
+                              +in[((i)*n+(j))*n+(k+1)] * 0.0625
+                              +in[((i)*n+(j))*n+(k+2)] * 0.010416666666666666
+                              +in[((i)*n+(j))*n+(k+3)] * 0.004166666666666667
+                              +in[((i)*n+(j))*n+(k+4)] * 0.002232142857142857
+                              +in[((i)*n+(j+1))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i)*n+(j+1))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i)*n+(j+1))*n+(k-2)] * -0.005208333333333333
+                              +in[((i)*n+(j+1))*n+(k)] * 0.0625
+                              +in[((i)*n+(j+1))*n+(k+1)] * 0.03125
+                              +in[((i)*n+(j+1))*n+(k+2)] * 0.005208333333333333
+                              +in[((i)*n+(j+1))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i)*n+(j+1))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i)*n+(j+2))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i)*n+(j+2))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i)*n+(j+2))*n+(k-1)] * 0.005208333333333333
+                              +in[((i)*n+(j+2))*n+(k)] * 0.010416666666666666
+                              +in[((i)*n+(j+2))*n+(k+1)] * 0.005208333333333333
+                              +in[((i)*n+(j+2))*n+(k+2)] * 0.015625
+                              +in[((i)*n+(j+2))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i)*n+(j+2))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i)*n+(j+3))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i)*n+(j+3))*n+(k-2)] * 0.0020833333333333333
+                              +in[((i)*n+(j+3))*n+(k-1)] * 0.0020833333333333333
+                              +in[((i)*n+(j+3))*n+(k)] * 0.004166666666666667
+                              +in[((i)*n+(j+3))*n+(k+1)] * 0.0020833333333333333
+                              +in[((i)*n+(j+3))*n+(k+2)] * 0.0020833333333333333
+                              +in[((i)*n+(j+3))*n+(k+3)] * 0.010416666666666666
+                              +in[((i)*n+(j+3))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i)*n+(j+4))*n+(k-3)] * 0.0011160714285714285
+                              +in[((i)*n+(j+4))*n+(k-2)] * 0.0011160714285714285
+                              +in[((i)*n+(j+4))*n+(k-1)] * 0.0011160714285714285
+                              +in[((i)*n+(j+4))*n+(k)] * 0.002232142857142857
+                              +in[((i)*n+(j+4))*n+(k+1)] * 0.0011160714285714285
+                              +in[((i)*n+(j+4))*n+(k+2)] * 0.0011160714285714285
+                              +in[((i)*n+(j+4))*n+(k+3)] * 0.0011160714285714285
+                              +in[((i)*n+(j+4))*n+(k+4)] * 0.0078125
+                              +in[((i+1)*n+(j-4))*n+(k)] * -0.0011160714285714285
+                              +in[((i+1)*n+(j-3))*n+(k)] * -0.0020833333333333333
+                              +in[((i+1)*n+(j-2))*n+(k)] * -0.005208333333333333
+                              +in[((i+1)*n+(j))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i+1)*n+(j))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i+1)*n+(j))*n+(k-2)] * -0.005208333333333333
+                              +in[((i+1)*n+(j))*n+(k)] * 0.0625
+                              +in[((i+1)*n+(j))*n+(k+1)] * 0.03125
+                              +in[((i+1)*n+(j))*n+(k+2)] * 0.005208333333333333
+                              +in[((i+1)*n+(j))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i+1)*n+(j))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i+1)*n+(j+1))*n+(k)] * 0.03125
+                              +in[((i+1)*n+(j+2))*n+(k)] * 0.005208333333333333
+                              +in[((i+1)*n+(j+3))*n+(k)] * 0.0020833333333333333
+                              +in[((i+1)*n+(j+4))*n+(k)] * 0.0011160714285714285
+                              +in[((i+2)*n+(j-4))*n+(k)] * -0.0011160714285714285
+                              +in[((i+2)*n+(j-3))*n+(k)] * -0.0020833333333333333
+                              +in[((i+2)*n+(j-1))*n+(k)] * 0.005208333333333333
+                              +in[((i+2)*n+(j))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i+2)*n+(j))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i+2)*n+(j))*n+(k-1)] * 0.005208333333333333
+                              +in[((i+2)*n+(j))*n+(k)] * 0.010416666666666666
+                              +in[((i+2)*n+(j))*n+(k+1)] * 0.005208333333333333
+                              +in[((i+2)*n+(j))*n+(k+2)] * 0.015625
+                              +in[((i+2)*n+(j))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i+2)*n+(j))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i+2)*n+(j+1))*n+(k)] * 0.005208333333333333
+                              +in[((i+2)*n+(j+2))*n+(k)] * 0.015625
+                              +in[((i+2)*n+(j+3))*n+(k)] * 0.0020833333333333333
+                              +in[((i+2)*n+(j+4))*n+(k)] * 0.0011160714285714285
+                              +in[((i+3)*n+(j-4))*n+(k)] * -0.0011160714285714285
+                              +in[((i+3)*n+(j-2))*n+(k)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j-1))*n+(k)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i+3)*n+(j))*n+(k-2)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j))*n+(k-1)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j))*n+(k)] * 0.004166666666666667
+                              +in[((i+3)*n+(j))*n+(k+1)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j))*n+(k+2)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j))*n+(k+3)] * 0.010416666666666666
+                              +in[((i+3)*n+(j))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i+3)*n+(j+1))*n+(k)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j+2))*n+(k)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j+3))*n+(k)] * 0.010416666666666666
+                              +in[((i+3)*n+(j+4))*n+(k)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j-3))*n+(k)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j-2))*n+(k)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j-1))*n+(k)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j))*n+(k-3)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j))*n+(k-2)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j))*n+(k-1)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j))*n+(k)] * 0.002232142857142857
+                              +in[((i+4)*n+(j))*n+(k+1)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j))*n+(k+2)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j))*n+(k+3)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j))*n+(k+4)] * 0.0078125
+                              +in[((i+4)*n+(j+1))*n+(k)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j+2))*n+(k)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j+3))*n+(k)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j+4))*n+(k)] * 0.0078125;
+             }
+           }
+         }
+        }
+      }
+    }
+}
+
@@ -0,0 +1,524 @@
+void star3d1(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+  tbb::blocked_range3d<int> range(1, n-1, ti, 1, n-1, tj, 1, n-1, tk);
+  tbb::parallel_for( range, [&](decltype(range)& r ) {
+    for (auto i=r.pages().begin(); i!=r.pages().end(); ++i ) {
+      for (auto j=r.rows().begin(); j!=r.rows().end(); ++j ) {
+        PRAGMA_SIMD
+        for (auto k=r.cols().begin(); k!=r.cols().end(); ++k ) {
+                out[(i*n+j)*n+k] += +in[((i-1)*n+(j))*n+(k)] * -0.5
+                              +in[((i)*n+(j-1))*n+(k)] * -0.5
+                              +in[((i)*n+(j))*n+(k-1)] * -0.5
+                              +in[((i)*n+(j))*n+(k+1)] * 0.5
+                              +in[((i)*n+(j+1))*n+(k)] * 0.5
+                              +in[((i+1)*n+(j))*n+(k)] * 0.5;
+        }
+      }
+    }
+  }, tbb_partitioner );
+}
+
+void star3d2(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+  tbb::blocked_range3d<int> range(2, n-2, ti, 2, n-2, tj, 2, n-2, tk);
+  tbb::parallel_for( range, [&](decltype(range)& r ) {
+    for (auto i=r.pages().begin(); i!=r.pages().end(); ++i ) {
+      for (auto j=r.rows().begin(); j!=r.rows().end(); ++j ) {
+        PRAGMA_SIMD
+        for (auto k=r.cols().begin(); k!=r.cols().end(); ++k ) {
+                out[(i*n+j)*n+k] += +in[((i-2)*n+(j))*n+(k)] * -0.125
+                              +in[((i-1)*n+(j))*n+(k)] * -0.25
+                              +in[((i)*n+(j-2))*n+(k)] * -0.125
+                              +in[((i)*n+(j-1))*n+(k)] * -0.25
+                              +in[((i)*n+(j))*n+(k-2)] * -0.125
+                              +in[((i)*n+(j))*n+(k-1)] * -0.25
+                              +in[((i)*n+(j))*n+(k+1)] * 0.25
+                              +in[((i)*n+(j))*n+(k+2)] * 0.125
+                              +in[((i)*n+(j+1))*n+(k)] * 0.25
+                              +in[((i)*n+(j+2))*n+(k)] * 0.125
+                              +in[((i+1)*n+(j))*n+(k)] * 0.25
+                              +in[((i+2)*n+(j))*n+(k)] * 0.125;
+        }
+      }
+    }
+  }, tbb_partitioner );
+}
+
+void star3d3(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+  tbb::blocked_range3d<int> range(3, n-3, ti, 3, n-3, tj, 3, n-3, tk);
+  tbb::parallel_for( range, [&](decltype(range)& r ) {
+    for (auto i=r.pages().begin(); i!=r.pages().end(); ++i ) {
+      for (auto j=r.rows().begin(); j!=r.rows().end(); ++j ) {
+        PRAGMA_SIMD
+        for (auto k=r.cols().begin(); k!=r.cols().end(); ++k ) {
+                out[(i*n+j)*n+k] += +in[((i-3)*n+(j))*n+(k)] * -0.05555555555555555
+                              +in[((i-2)*n+(j))*n+(k)] * -0.08333333333333333
+                              +in[((i-1)*n+(j))*n+(k)] * -0.16666666666666666
+                              +in[((i)*n+(j-3))*n+(k)] * -0.05555555555555555
+                              +in[((i)*n+(j-2))*n+(k)] * -0.08333333333333333
+                              +in[((i)*n+(j-1))*n+(k)] * -0.16666666666666666
+                              +in[((i)*n+(j))*n+(k-3)] * -0.05555555555555555
+                              +in[((i)*n+(j))*n+(k-2)] * -0.08333333333333333
+                              +in[((i)*n+(j))*n+(k-1)] * -0.16666666666666666
+                              +in[((i)*n+(j))*n+(k+1)] * 0.16666666666666666
+                              +in[((i)*n+(j))*n+(k+2)] * 0.08333333333333333
+                              +in[((i)*n+(j))*n+(k+3)] * 0.05555555555555555
+                              +in[((i)*n+(j+1))*n+(k)] * 0.16666666666666666
+                              +in[((i)*n+(j+2))*n+(k)] * 0.08333333333333333
+                              +in[((i)*n+(j+3))*n+(k)] * 0.05555555555555555
+                              +in[((i+1)*n+(j))*n+(k)] * 0.16666666666666666
+                              +in[((i+2)*n+(j))*n+(k)] * 0.08333333333333333
+                              +in[((i+3)*n+(j))*n+(k)] * 0.05555555555555555;
+        }
+      }
+    }
+  }, tbb_partitioner );
+}
+
+void star3d4(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+  tbb::blocked_range3d<int> range(4, n-4, ti, 4, n-4, tj, 4, n-4, tk);
+  tbb::parallel_for( range, [&](decltype(range)& r ) {
+    for (auto i=r.pages().begin(); i!=r.pages().end(); ++i ) {
+      for (auto j=r.rows().begin(); j!=r.rows().end(); ++j ) {
+        PRAGMA_SIMD
+        for (auto k=r.cols().begin(); k!=r.cols().end(); ++k ) {
+                out[(i*n+j)*n+k] += +in[((i-4)*n+(j))*n+(k)] * -0.03125
+                              +in[((i-3)*n+(j))*n+(k)] * -0.041666666666666664
+                              +in[((i-2)*n+(j))*n+(k)] * -0.0625
+                              +in[((i-1)*n+(j))*n+(k)] * -0.125
+                              +in[((i)*n+(j-4))*n+(k)] * -0.03125
+                              +in[((i)*n+(j-3))*n+(k)] * -0.041666666666666664
+                              +in[((i)*n+(j-2))*n+(k)] * -0.0625
+                              +in[((i)*n+(j-1))*n+(k)] * -0.125
+                              +in[((i)*n+(j))*n+(k-4)] * -0.03125
+                              +in[((i)*n+(j))*n+(k-3)] * -0.041666666666666664
+                              +in[((i)*n+(j))*n+(k-2)] * -0.0625
+                              +in[((i)*n+(j))*n+(k-1)] * -0.125
+                              +in[((i)*n+(j))*n+(k+1)] * 0.125
+                              +in[((i)*n+(j))*n+(k+2)] * 0.0625
+                              +in[((i)*n+(j))*n+(k+3)] * 0.041666666666666664
+                              +in[((i)*n+(j))*n+(k+4)] * 0.03125
+                              +in[((i)*n+(j+1))*n+(k)] * 0.125
+                              +in[((i)*n+(j+2))*n+(k)] * 0.0625
+                              +in[((i)*n+(j+3))*n+(k)] * 0.041666666666666664
+                              +in[((i)*n+(j+4))*n+(k)] * 0.03125
+                              +in[((i+1)*n+(j))*n+(k)] * 0.125
+                              +in[((i+2)*n+(j))*n+(k)] * 0.0625
+                              +in[((i+3)*n+(j))*n+(k)] * 0.041666666666666664
+                              +in[((i+4)*n+(j))*n+(k)] * 0.03125;
+        }
+      }
+    }
+  }, tbb_partitioner );
+}
+
+void grid3d1(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+  tbb::blocked_range3d<int> range(1, n-1, ti, 1, n-1, tj, 1, n-1, tk);
+  tbb::parallel_for( range, [&](decltype(range)& r ) {
+    for (auto i=r.pages().begin(); i!=r.pages().end(); ++i ) {
+      for (auto j=r.rows().begin(); j!=r.rows().end(); ++j ) {
+        PRAGMA_SIMD
+        for (auto k=r.cols().begin(); k!=r.cols().end(); ++k ) {
+                out[(i*n+j)*n+k] += +in[((i-1)*n+(j-1))*n+(k)] * -0.125
+                              +in[((i-1)*n+(j))*n+(k-1)] * -0.125
+                              +in[((i-1)*n+(j))*n+(k)] * -0.25
+                              +in[((i)*n+(j-1))*n+(k-1)] * -0.125
+                              +in[((i)*n+(j-1))*n+(k)] * -0.25
+                              +in[((i)*n+(j))*n+(k-1)] * -0.25
+                              +in[((i)*n+(j))*n+(k+1)] * 0.25
+                              +in[((i)*n+(j+1))*n+(k)] * 0.25
+                              +in[((i)*n+(j+1))*n+(k+1)] * 0.125
+                              +in[((i+1)*n+(j))*n+(k)] * 0.25
+                              +in[((i+1)*n+(j))*n+(k+1)] * 0.125
+                              +in[((i+1)*n+(j+1))*n+(k)] * 0.125;
+        }
+      }
+    }
+  }, tbb_partitioner );
+}
+
+void grid3d2(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+  tbb::blocked_range3d<int> range(2, n-2, ti, 2, n-2, tj, 2, n-2, tk);
+  tbb::parallel_for( range, [&](decltype(range)& r ) {
+    for (auto i=r.pages().begin(); i!=r.pages().end(); ++i ) {
+      for (auto j=r.rows().begin(); j!=r.rows().end(); ++j ) {
+        PRAGMA_SIMD
+        for (auto k=r.cols().begin(); k!=r.cols().end(); ++k ) {
+                out[(i*n+j)*n+k] += +in[((i-2)*n+(j-2))*n+(k)] * -0.03125
+                              +in[((i-2)*n+(j-1))*n+(k)] * -0.010416666666666666
+                              +in[((i-2)*n+(j))*n+(k-2)] * -0.03125
+                              +in[((i-2)*n+(j))*n+(k-1)] * -0.010416666666666666
+                              +in[((i-2)*n+(j))*n+(k)] * -0.020833333333333332
+                              +in[((i-2)*n+(j))*n+(k+1)] * -0.010416666666666666
+                              +in[((i-2)*n+(j+1))*n+(k)] * -0.010416666666666666
+                              +in[((i-1)*n+(j-2))*n+(k)] * -0.010416666666666666
+                              +in[((i-1)*n+(j-1))*n+(k)] * -0.0625
+                              +in[((i-1)*n+(j))*n+(k-2)] * -0.010416666666666666
+                              +in[((i-1)*n+(j))*n+(k-1)] * -0.0625
+                              +in[((i-1)*n+(j))*n+(k)] * -0.125
+                              +in[((i-1)*n+(j))*n+(k+2)] * 0.010416666666666666
+                              +in[((i-1)*n+(j+2))*n+(k)] * 0.010416666666666666
+                              +in[((i)*n+(j-2))*n+(k-2)] * -0.03125
+                              +in[((i)*n+(j-2))*n+(k-1)] * -0.010416666666666666
+                              +in[((i)*n+(j-2))*n+(k)] * -0.020833333333333332
+                              +in[((i)*n+(j-2))*n+(k+1)] * -0.010416666666666666
+                              +in[((i)*n+(j-1))*n+(k-2)] * -0.010416666666666666
+                              +in[((i)*n+(j-1))*n+(k-1)] * -0.0625
+                              +in[((i)*n+(j-1))*n+(k)] * -0.125
+                              +in[((i)*n+(j-1))*n+(k+2)] * 0.010416666666666666
+                              +in[((i)*n+(j))*n+(k-2)] * -0.020833333333333332
+                              +in[((i)*n+(j))*n+(k-1)] * -0.125
+                              +in[((i)*n+(j))*n+(k+1)] * 0.125
+                              +in[((i)*n+(j))*n+(k+2)] * 0.020833333333333332
+                              +in[((i)*n+(j+1))*n+(k-2)] * -0.010416666666666666
+                              +in[((i)*n+(j+1))*n+(k)] * 0.125
+                              +in[((i)*n+(j+1))*n+(k+1)] * 0.0625
+                              +in[((i)*n+(j+1))*n+(k+2)] * 0.010416666666666666
+                              +in[((i)*n+(j+2))*n+(k-1)] * 0.010416666666666666
+                              +in[((i)*n+(j+2))*n+(k)] * 0.020833333333333332
+                              +in[((i)*n+(j+2))*n+(k+1)] * 0.010416666666666666
+                              +in[((i)*n+(j+2))*n+(k+2)] * 0.03125
+                              +in[((i+1)*n+(j-2))*n+(k)] * -0.010416666666666666
+                              +in[((i+1)*n+(j))*n+(k-2)] * -0.010416666666666666
+                              +in[((i+1)*n+(j))*n+(k)] * 0.125
+                              +in[((i+1)*n+(j))*n+(k+1)] * 0.0625
+                              +in[((i+1)*n+(j))*n+(k+2)] * 0.010416666666666666
+                              +in[((i+1)*n+(j+1))*n+(k)] * 0.0625
+                              +in[((i+1)*n+(j+2))*n+(k)] * 0.010416666666666666
+                              +in[((i+2)*n+(j-1))*n+(k)] * 0.010416666666666666
+                              +in[((i+2)*n+(j))*n+(k-1)] * 0.010416666666666666
+                              +in[((i+2)*n+(j))*n+(k)] * 0.020833333333333332
+                              +in[((i+2)*n+(j))*n+(k+1)] * 0.010416666666666666
+                              +in[((i+2)*n+(j))*n+(k+2)] * 0.03125
+                              +in[((i+2)*n+(j+1))*n+(k)] * 0.010416666666666666
+                              +in[((i+2)*n+(j+2))*n+(k)] * 0.03125;
+        }
+      }
+    }
+  }, tbb_partitioner );
+}
+
+void grid3d3(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+  tbb::blocked_range3d<int> range(3, n-3, ti, 3, n-3, tj, 3, n-3, tk);
+  tbb::parallel_for( range, [&](decltype(range)& r ) {
+    for (auto i=r.pages().begin(); i!=r.pages().end(); ++i ) {
+      for (auto j=r.rows().begin(); j!=r.rows().end(); ++j ) {
+        PRAGMA_SIMD
+        for (auto k=r.cols().begin(); k!=r.cols().end(); ++k ) {
+                out[(i*n+j)*n+k] += +in[((i-3)*n+(j-3))*n+(k)] * -0.013888888888888888
+                              +in[((i-3)*n+(j-2))*n+(k)] * -0.002777777777777778
+                              +in[((i-3)*n+(j-1))*n+(k)] * -0.002777777777777778
+                              +in[((i-3)*n+(j))*n+(k-3)] * -0.013888888888888888
+                              +in[((i-3)*n+(j))*n+(k-2)] * -0.002777777777777778
+                              +in[((i-3)*n+(j))*n+(k-1)] * -0.002777777777777778
+                              +in[((i-3)*n+(j))*n+(k)] * -0.005555555555555556
+                              +in[((i-3)*n+(j))*n+(k+1)] * -0.002777777777777778
+                              +in[((i-3)*n+(j))*n+(k+2)] * -0.002777777777777778
+                              +in[((i-3)*n+(j+1))*n+(k)] * -0.002777777777777778
+                              +in[((i-3)*n+(j+2))*n+(k)] * -0.002777777777777778
+                              +in[((i-2)*n+(j-3))*n+(k)] * -0.002777777777777778
+                              +in[((i-2)*n+(j-2))*n+(k)] * -0.020833333333333332
+                              +in[((i-2)*n+(j-1))*n+(k)] * -0.006944444444444444
+                              +in[((i-2)*n+(j))*n+(k-3)] * -0.002777777777777778
+                              +in[((i-2)*n+(j))*n+(k-2)] * -0.020833333333333332
+                              +in[((i-2)*n+(j))*n+(k-1)] * -0.006944444444444444
+                              +in[((i-2)*n+(j))*n+(k)] * -0.013888888888888888
+                              +in[((i-2)*n+(j))*n+(k+1)] * -0.006944444444444444
+                              +in[((i-2)*n+(j))*n+(k+3)] * 0.002777777777777778
+                              +in[((i-2)*n+(j+1))*n+(k)] * -0.006944444444444444
+                              +in[((i-2)*n+(j+3))*n+(k)] * 0.002777777777777778
+                              +in[((i-1)*n+(j-3))*n+(k)] * -0.002777777777777778
+                              +in[((i-1)*n+(j-2))*n+(k)] * -0.006944444444444444
+                              +in[((i-1)*n+(j-1))*n+(k)] * -0.041666666666666664
+                              +in[((i-1)*n+(j))*n+(k-3)] * -0.002777777777777778
+                              +in[((i-1)*n+(j))*n+(k-2)] * -0.006944444444444444
+                              +in[((i-1)*n+(j))*n+(k-1)] * -0.041666666666666664
+                              +in[((i-1)*n+(j))*n+(k)] * -0.08333333333333333
+                              +in[((i-1)*n+(j))*n+(k+2)] * 0.006944444444444444
+                              +in[((i-1)*n+(j))*n+(k+3)] * 0.002777777777777778
+                              +in[((i-1)*n+(j+2))*n+(k)] * 0.006944444444444444
+                              +in[((i-1)*n+(j+3))*n+(k)] * 0.002777777777777778
+                              +in[((i)*n+(j-3))*n+(k-3)] * -0.013888888888888888
+                              +in[((i)*n+(j-3))*n+(k-2)] * -0.002777777777777778
+                              +in[((i)*n+(j-3))*n+(k-1)] * -0.002777777777777778
+                              +in[((i)*n+(j-3))*n+(k)] * -0.005555555555555556
+                              +in[((i)*n+(j-3))*n+(k+1)] * -0.002777777777777778
+                              +in[((i)*n+(j-3))*n+(k+2)] * -0.002777777777777778
+                              +in[((i)*n+(j-2))*n+(k-3)] * -0.002777777777777778
+                              +in[((i)*n+(j-2))*n+(k-2)] * -0.020833333333333332
+                              +in[((i)*n+(j-2))*n+(k-1)] * -0.006944444444444444
+                              +in[((i)*n+(j-2))*n+(k)] * -0.013888888888888888
+                              +in[((i)*n+(j-2))*n+(k+1)] * -0.006944444444444444
+                              +in[((i)*n+(j-2))*n+(k+3)] * 0.002777777777777778
+                              +in[((i)*n+(j-1))*n+(k-3)] * -0.002777777777777778
+                              +in[((i)*n+(j-1))*n+(k-2)] * -0.006944444444444444
+                              +in[((i)*n+(j-1))*n+(k-1)] * -0.041666666666666664
+                              +in[((i)*n+(j-1))*n+(k)] * -0.08333333333333333
+                              +in[((i)*n+(j-1))*n+(k+2)] * 0.006944444444444444
+                              +in[((i)*n+(j-1))*n+(k+3)] * 0.002777777777777778
+                              +in[((i)*n+(j))*n+(k-3)] * -0.005555555555555556
+                              +in[((i)*n+(j))*n+(k-2)] * -0.013888888888888888
+                              +in[((i)*n+(j))*n+(k-1)] * -0.08333333333333333
+                              +in[((i)*n+(j))*n+(k+1)] * 0.08333333333333333
+                              +in[((i)*n+(j))*n+(k+2)] * 0.013888888888888888
+                              +in[((i)*n+(j))*n+(k+3)] * 0.005555555555555556
+                              +in[((i)*n+(j+1))*n+(k-3)] * -0.002777777777777778
+                              +in[((i)*n+(j+1))*n+(k-2)] * -0.006944444444444444
+                              +in[((i)*n+(j+1))*n+(k)] * 0.08333333333333333
+                              +in[((i)*n+(j+1))*n+(k+1)] * 0.041666666666666664
+                              +in[((i)*n+(j+1))*n+(k+2)] * 0.006944444444444444
+                              +in[((i)*n+(j+1))*n+(k+3)] * 0.002777777777777778
+                              +in[((i)*n+(j+2))*n+(k-3)] * -0.002777777777777778
+                              +in[((i)*n+(j+2))*n+(k-1)] * 0.006944444444444444
+                              +in[((i)*n+(j+2))*n+(k)] * 0.013888888888888888
+                              +in[((i)*n+(j+2))*n+(k+1)] * 0.006944444444444444
+                              +in[((i)*n+(j+2))*n+(k+2)] * 0.020833333333333332
+                              +in[((i)*n+(j+2))*n+(k+3)] * 0.002777777777777778
+                              +in[((i)*n+(j+3))*n+(k-2)] * 0.002777777777777778
+                              +in[((i)*n+(j+3))*n+(k-1)] * 0.002777777777777778
+                              +in[((i)*n+(j+3))*n+(k)] * 0.005555555555555556
+                              +in[((i)*n+(j+3))*n+(k+1)] * 0.002777777777777778
+                              +in[((i)*n+(j+3))*n+(k+2)] * 0.002777777777777778
+                              +in[((i)*n+(j+3))*n+(k+3)] * 0.013888888888888888
+                              +in[((i+1)*n+(j-3))*n+(k)] * -0.002777777777777778
+                              +in[((i+1)*n+(j-2))*n+(k)] * -0.006944444444444444
+                              +in[((i+1)*n+(j))*n+(k-3)] * -0.002777777777777778
+                              +in[((i+1)*n+(j))*n+(k-2)] * -0.006944444444444444
+                              +in[((i+1)*n+(j))*n+(k)] * 0.08333333333333333
+                              +in[((i+1)*n+(j))*n+(k+1)] * 0.041666666666666664
+                              +in[((i+1)*n+(j))*n+(k+2)] * 0.006944444444444444
+                              +in[((i+1)*n+(j))*n+(k+3)] * 0.002777777777777778
+                              +in[((i+1)*n+(j+1))*n+(k)] * 0.041666666666666664
+                              +in[((i+1)*n+(j+2))*n+(k)] * 0.006944444444444444
+                              +in[((i+1)*n+(j+3))*n+(k)] * 0.002777777777777778
+                              +in[((i+2)*n+(j-3))*n+(k)] * -0.002777777777777778
+                              +in[((i+2)*n+(j-1))*n+(k)] * 0.006944444444444444
+                              +in[((i+2)*n+(j))*n+(k-3)] * -0.002777777777777778
+                              +in[((i+2)*n+(j))*n+(k-1)] * 0.006944444444444444
+                              +in[((i+2)*n+(j))*n+(k)] * 0.013888888888888888
+                              +in[((i+2)*n+(j))*n+(k+1)] * 0.006944444444444444
+                              +in[((i+2)*n+(j))*n+(k+2)] * 0.020833333333333332
+                              +in[((i+2)*n+(j))*n+(k+3)] * 0.002777777777777778
+                              +in[((i+2)*n+(j+1))*n+(k)] * 0.006944444444444444
+                              +in[((i+2)*n+(j+2))*n+(k)] * 0.020833333333333332
+                              +in[((i+2)*n+(j+3))*n+(k)] * 0.002777777777777778
+                              +in[((i+3)*n+(j-2))*n+(k)] * 0.002777777777777778
+                              +in[((i+3)*n+(j-1))*n+(k)] * 0.002777777777777778
+                              +in[((i+3)*n+(j))*n+(k-2)] * 0.002777777777777778
+                              +in[((i+3)*n+(j))*n+(k-1)] * 0.002777777777777778
+                              +in[((i+3)*n+(j))*n+(k)] * 0.005555555555555556
+                              +in[((i+3)*n+(j))*n+(k+1)] * 0.002777777777777778
+                              +in[((i+3)*n+(j))*n+(k+2)] * 0.002777777777777778
+                              +in[((i+3)*n+(j))*n+(k+3)] * 0.013888888888888888
+                              +in[((i+3)*n+(j+1))*n+(k)] * 0.002777777777777778
+                              +in[((i+3)*n+(j+2))*n+(k)] * 0.002777777777777778
+                              +in[((i+3)*n+(j+3))*n+(k)] * 0.013888888888888888;
+        }
+      }
+    }
+  }, tbb_partitioner );
+}
+
+void grid3d4(const int n, const int ti, const int tj, const int tk, prk::vector<double> & in, prk::vector<double> & out) {
+  tbb::blocked_range3d<int> range(4, n-4, ti, 4, n-4, tj, 4, n-4, tk);
+  tbb::parallel_for( range, [&](decltype(range)& r ) {
+    for (auto i=r.pages().begin(); i!=r.pages().end(); ++i ) {
+      for (auto j=r.rows().begin(); j!=r.rows().end(); ++j ) {
+        PRAGMA_SIMD
+        for (auto k=r.cols().begin(); k!=r.cols().end(); ++k ) {
+                out[(i*n+j)*n+k] += +in[((i-4)*n+(j-4))*n+(k)] * -0.0078125
+                              +in[((i-4)*n+(j-3))*n+(k)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j-2))*n+(k)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j-1))*n+(k)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j))*n+(k-4)] * -0.0078125
+                              +in[((i-4)*n+(j))*n+(k-3)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j))*n+(k-2)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j))*n+(k-1)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j))*n+(k)] * -0.002232142857142857
+                              +in[((i-4)*n+(j))*n+(k+1)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j))*n+(k+2)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j))*n+(k+3)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j+1))*n+(k)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j+2))*n+(k)] * -0.0011160714285714285
+                              +in[((i-4)*n+(j+3))*n+(k)] * -0.0011160714285714285
+                              +in[((i-3)*n+(j-4))*n+(k)] * -0.0011160714285714285
+                              +in[((i-3)*n+(j-3))*n+(k)] * -0.010416666666666666
+                              +in[((i-3)*n+(j-2))*n+(k)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j-1))*n+(k)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i-3)*n+(j))*n+(k-3)] * -0.010416666666666666
+                              +in[((i-3)*n+(j))*n+(k-2)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j))*n+(k-1)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j))*n+(k)] * -0.004166666666666667
+                              +in[((i-3)*n+(j))*n+(k+1)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j))*n+(k+2)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i-3)*n+(j+1))*n+(k)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j+2))*n+(k)] * -0.0020833333333333333
+                              +in[((i-3)*n+(j+4))*n+(k)] * 0.0011160714285714285
+                              +in[((i-2)*n+(j-4))*n+(k)] * -0.0011160714285714285
+                              +in[((i-2)*n+(j-3))*n+(k)] * -0.0020833333333333333
+                              +in[((i-2)*n+(j-2))*n+(k)] * -0.015625
+                              +in[((i-2)*n+(j-1))*n+(k)] * -0.005208333333333333
+                              +in[((i-2)*n+(j))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i-2)*n+(j))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i-2)*n+(j))*n+(k-2)] * -0.015625
+                              +in[((i-2)*n+(j))*n+(k-1)] * -0.005208333333333333
+                              +in[((i-2)*n+(j))*n+(k)] * -0.010416666666666666
+                              +in[((i-2)*n+(j))*n+(k+1)] * -0.005208333333333333
+                              +in[((i-2)*n+(j))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i-2)*n+(j))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i-2)*n+(j+1))*n+(k)] * -0.005208333333333333
+                              +in[((i-2)*n+(j+3))*n+(k)] * 0.0020833333333333333
+                              +in[((i-2)*n+(j+4))*n+(k)] * 0.0011160714285714285
+                              +in[((i-1)*n+(j-4))*n+(k)] * -0.0011160714285714285
+                              +in[((i-1)*n+(j-3))*n+(k)] * -0.0020833333333333333
+                              +in[((i-1)*n+(j-2))*n+(k)] * -0.005208333333333333
+                              +in[((i-1)*n+(j-1))*n+(k)] * -0.03125
+                              +in[((i-1)*n+(j))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i-1)*n+(j))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i-1)*n+(j))*n+(k-2)] * -0.005208333333333333
+                              +in[((i-1)*n+(j))*n+(k-1)] * -0.03125
+                              +in[((i-1)*n+(j))*n+(k)] * -0.0625
+                              +in[((i-1)*n+(j))*n+(k+2)] * 0.005208333333333333
+                              +in[((i-1)*n+(j))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i-1)*n+(j))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i-1)*n+(j+2))*n+(k)] * 0.005208333333333333
+                              +in[((i-1)*n+(j+3))*n+(k)] * 0.0020833333333333333
+                              +in[((i-1)*n+(j+4))*n+(k)] * 0.0011160714285714285
+                              +in[((i)*n+(j-4))*n+(k-4)] * -0.0078125
+                              +in[((i)*n+(j-4))*n+(k-3)] * -0.0011160714285714285
+                              +in[((i)*n+(j-4))*n+(k-2)] * -0.0011160714285714285
+                              +in[((i)*n+(j-4))*n+(k-1)] * -0.0011160714285714285
+                              +in[((i)*n+(j-4))*n+(k)] * -0.002232142857142857
+                              +in[((i)*n+(j-4))*n+(k+1)] * -0.0011160714285714285
+                              +in[((i)*n+(j-4))*n+(k+2)] * -0.0011160714285714285
+                              +in[((i)*n+(j-4))*n+(k+3)] * -0.0011160714285714285
+                              +in[((i)*n+(j-3))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i)*n+(j-3))*n+(k-3)] * -0.010416666666666666
+                              +in[((i)*n+(j-3))*n+(k-2)] * -0.0020833333333333333
+                              +in[((i)*n+(j-3))*n+(k-1)] * -0.0020833333333333333
+                              +in[((i)*n+(j-3))*n+(k)] * -0.004166666666666667
+                              +in[((i)*n+(j-3))*n+(k+1)] * -0.0020833333333333333
+                              +in[((i)*n+(j-3))*n+(k+2)] * -0.0020833333333333333
+                              +in[((i)*n+(j-3))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i)*n+(j-2))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i)*n+(j-2))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i)*n+(j-2))*n+(k-2)] * -0.015625
+                              +in[((i)*n+(j-2))*n+(k-1)] * -0.005208333333333333
+                              +in[((i)*n+(j-2))*n+(k)] * -0.010416666666666666
+                              +in[((i)*n+(j-2))*n+(k+1)] * -0.005208333333333333
+                              +in[((i)*n+(j-2))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i)*n+(j-2))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i)*n+(j-1))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i)*n+(j-1))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i)*n+(j-1))*n+(k-2)] * -0.005208333333333333
+                              +in[((i)*n+(j-1))*n+(k-1)] * -0.03125
+                              +in[((i)*n+(j-1))*n+(k)] * -0.0625
+                              +in[((i)*n+(j-1))*n+(k+2)] * 0.005208333333333333
+                              +in[((i)*n+(j-1))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i)*n+(j-1))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i)*n+(j))*n+(k-4)] * -0.002232142857142857
+                              +in[((i)*n+(j))*n+(k-3)] * -0.004166666666666667
+                              +in[((i)*n+(j))*n+(k-2)] * -0.010416666666666666
+                              +in[((i)*n+(j))*n+(k-1)] * -0.0625
+                              +in[((i)*n+(j))*n+(k+1)] * 0.0625
+                              +in[((i)*n+(j))*n+(k+2)] * 0.010416666666666666
+                              +in[((i)*n+(j))*n+(k+3)] * 0.004166666666666667
+                              +in[((i)*n+(j))*n+(k+4)] * 0.002232142857142857
+                              +in[((i)*n+(j+1))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i)*n+(j+1))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i)*n+(j+1))*n+(k-2)] * -0.005208333333333333
+                              +in[((i)*n+(j+1))*n+(k)] * 0.0625
+                              +in[((i)*n+(j+1))*n+(k+1)] * 0.03125
+                              +in[((i)*n+(j+1))*n+(k+2)] * 0.005208333333333333
+                              +in[((i)*n+(j+1))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i)*n+(j+1))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i)*n+(j+2))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i)*n+(j+2))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i)*n+(j+2))*n+(k-1)] * 0.005208333333333333
+                              +in[((i)*n+(j+2))*n+(k)] * 0.010416666666666666
+                              +in[((i)*n+(j+2))*n+(k+1)] * 0.005208333333333333
+                              +in[((i)*n+(j+2))*n+(k+2)] * 0.015625
+                              +in[((i)*n+(j+2))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i)*n+(j+2))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i)*n+(j+3))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i)*n+(j+3))*n+(k-2)] * 0.0020833333333333333
+                              +in[((i)*n+(j+3))*n+(k-1)] * 0.0020833333333333333
+                              +in[((i)*n+(j+3))*n+(k)] * 0.004166666666666667
+                              +in[((i)*n+(j+3))*n+(k+1)] * 0.0020833333333333333
+                              +in[((i)*n+(j+3))*n+(k+2)] * 0.0020833333333333333
+                              +in[((i)*n+(j+3))*n+(k+3)] * 0.010416666666666666
+                              +in[((i)*n+(j+3))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i)*n+(j+4))*n+(k-3)] * 0.0011160714285714285
+                              +in[((i)*n+(j+4))*n+(k-2)] * 0.0011160714285714285
+                              +in[((i)*n+(j+4))*n+(k-1)] * 0.0011160714285714285
+                              +in[((i)*n+(j+4))*n+(k)] * 0.002232142857142857
+                              +in[((i)*n+(j+4))*n+(k+1)] * 0.0011160714285714285
+                              +in[((i)*n+(j+4))*n+(k+2)] * 0.0011160714285714285
+                              +in[((i)*n+(j+4))*n+(k+3)] * 0.0011160714285714285
+                              +in[((i)*n+(j+4))*n+(k+4)] * 0.0078125
+                              +in[((i+1)*n+(j-4))*n+(k)] * -0.0011160714285714285
+                              +in[((i+1)*n+(j-3))*n+(k)] * -0.0020833333333333333
+                              +in[((i+1)*n+(j-2))*n+(k)] * -0.005208333333333333
+                              +in[((i+1)*n+(j))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i+1)*n+(j))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i+1)*n+(j))*n+(k-2)] * -0.005208333333333333
+                              +in[((i+1)*n+(j))*n+(k)] * 0.0625
+                              +in[((i+1)*n+(j))*n+(k+1)] * 0.03125
+                              +in[((i+1)*n+(j))*n+(k+2)] * 0.005208333333333333
+                              +in[((i+1)*n+(j))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i+1)*n+(j))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i+1)*n+(j+1))*n+(k)] * 0.03125
+                              +in[((i+1)*n+(j+2))*n+(k)] * 0.005208333333333333
+                              +in[((i+1)*n+(j+3))*n+(k)] * 0.0020833333333333333
+                              +in[((i+1)*n+(j+4))*n+(k)] * 0.0011160714285714285
+                              +in[((i+2)*n+(j-4))*n+(k)] * -0.0011160714285714285
+                              +in[((i+2)*n+(j-3))*n+(k)] * -0.0020833333333333333
+                              +in[((i+2)*n+(j-1))*n+(k)] * 0.005208333333333333
+                              +in[((i+2)*n+(j))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i+2)*n+(j))*n+(k-3)] * -0.0020833333333333333
+                              +in[((i+2)*n+(j))*n+(k-1)] * 0.005208333333333333
+                              +in[((i+2)*n+(j))*n+(k)] * 0.010416666666666666
+                              +in[((i+2)*n+(j))*n+(k+1)] * 0.005208333333333333
+                              +in[((i+2)*n+(j))*n+(k+2)] * 0.015625
+                              +in[((i+2)*n+(j))*n+(k+3)] * 0.0020833333333333333
+                              +in[((i+2)*n+(j))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i+2)*n+(j+1))*n+(k)] * 0.005208333333333333
+                              +in[((i+2)*n+(j+2))*n+(k)] * 0.015625
+                              +in[((i+2)*n+(j+3))*n+(k)] * 0.0020833333333333333
+                              +in[((i+2)*n+(j+4))*n+(k)] * 0.0011160714285714285
+                              +in[((i+3)*n+(j-4))*n+(k)] * -0.0011160714285714285
+                              +in[((i+3)*n+(j-2))*n+(k)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j-1))*n+(k)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j))*n+(k-4)] * -0.0011160714285714285
+                              +in[((i+3)*n+(j))*n+(k-2)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j))*n+(k-1)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j))*n+(k)] * 0.004166666666666667
+                              +in[((i+3)*n+(j))*n+(k+1)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j))*n+(k+2)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j))*n+(k+3)] * 0.010416666666666666
+                              +in[((i+3)*n+(j))*n+(k+4)] * 0.0011160714285714285
+                              +in[((i+3)*n+(j+1))*n+(k)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j+2))*n+(k)] * 0.0020833333333333333
+                              +in[((i+3)*n+(j+3))*n+(k)] * 0.010416666666666666
+                              +in[((i+3)*n+(j+4))*n+(k)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j-3))*n+(k)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j-2))*n+(k)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j-1))*n+(k)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j))*n+(k-3)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j))*n+(k-2)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j))*n+(k-1)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j))*n+(k)] * 0.002232142857142857
+                              +in[((i+4)*n+(j))*n+(k+1)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j))*n+(k+2)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j))*n+(k+3)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j))*n+(k+4)] * 0.0078125
+                              +in[((i+4)*n+(j+1))*n+(k)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j+2))*n+(k)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j+3))*n+(k)] * 0.0011160714285714285
+                              +in[((i+4)*n+(j+4))*n+(k)] * 0.0078125;
+        }
+      }
+    }
+  }, tbb_partitioner );
+}
+
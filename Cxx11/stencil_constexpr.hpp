@@ -0,0 +1,203 @@
+///
+/// Compile-time specialized stencil kernels.
+///
+/// One template replaces the per-radius functions that
+/// generate-cxx-stencil.py emits: the radius and shape are template
+/// parameters, the coefficient table is constexpr (the same discrete
+/// divergence operator the generator computes), and every loop over
+/// stencil points has a compile-time trip count, so the compiler can
+/// fully unroll and fold away the zero coefficients of the grid shape.
+/// Unlike the generated headers, any radius can be instantiated; the
+/// driver dispatches radii 1 through 9.
+///
+/// The grid type T and the accumulation type TA are also template
+/// parameters: <...,float,float> runs entirely in single precision,
+/// while <...,float,double> keeps the grid in FP32 but carries the
+/// weights and the per-point sum in FP64.
+///
+
+#ifndef PRK_STENCIL_CONSTEXPR_HPP
+#define PRK_STENCIL_CONSTEXPR_HPP
+
+template <int radius, bool star, typename T = double>
+constexpr std::array<std::array<T,2*radius+1>,2*radius+1> stencil_weights(void)
+{
+    std::array<std::array<T,2*radius+1>,2*radius+1> W {};
+    constexpr int r = radius;
+    if (star) {
+        for (int i=1; i<=r; i++) {
+            W[r][r+i] = +T(1)/(T(2)*i*r);
+            W[r+i][r] = +T(1)/(T(2)*i*r);
+            W[r][r-i] = -T(1)/(T(2)*i*r);
+            W[r-i][r] = -T(1)/(T(2)*i*r);
+        }
+    } else {
+        for (int j=1; j<=r; j++) {
+            for (int i=-j+1; i<=j-1; i++) {
+                W[r+i][r+j] = +T(1)/(T(4)*j*(2*j-1)*r);
+                W[r+i][r-j] = -T(1)/(T(4)*j*(2*j-1)*r);
+                W[r+j][r+i] = +T(1)/(T(4)*j*(2*j-1)*r);
+                W[r-j][r+i] = -T(1)/(T(4)*j*(2*j-1)*r);
+            }
+            W[r+j][r+j] = +T(1)/(T(4)*j*r);
+            W[r-j][r-j] = -T(1)/(T(4)*j*r);
+        }
+    }
+    return W;
+}
+
+template <int radius, bool star, typename T = double, typename TA = T>
+void stencil_t(const int n, const int t, prk::vector<T> & in, prk::vector<T> & out)
+{
+    constexpr auto W = stencil_weights<radius,star,TA>();
+    for (auto it=radius; it<n-radius; it+=t) {
+      for (auto jt=radius; jt<n-radius; jt+=t) {
+        // hoisted bounds: GCC drops the ivdep annotation on loops whose
+        // trip count it cannot separate from the std::min call
+        const auto imax = std::min(n-radius,it+t);
+        const auto jmax = std::min(n-radius,jt+t);
+        for (auto i=it; i<imax; ++i) {
+          PRAGMA_SIMD
+          for (auto j=jt; j<jmax; ++j) {
+            TA result(0);
+            if constexpr (star) {
+                for (int k=1; k<=radius; k++) {
+                    result += W[radius][radius+k] * in[i*n+(j+k)]
+                            + W[radius][radius-k] * in[i*n+(j-k)]
+                            + W[radius+k][radius] * in[(i+k)*n+j]
+                            + W[radius-k][radius] * in[(i-k)*n+j];
+                }
+            } else {
+                for (int ii=-radius; ii<=radius; ii++) {
+                    for (int jj=-radius; jj<=radius; jj++) {
+                        result += W[radius+ii][radius+jj] * in[(i+ii)*n+(j+jj)];
+                    }
+                }
+            }
+            out[i*n+j] += static_cast<T>(result);
+           }
+         }
+       }
+     }
+}
+
+// Ghost-cell padded layout: the arrays have n+2*radius columns and the
+// n*n physical points start at offset (radius,radius), so the stencil
+// sweeps all of them with the same branch-free body — no loop-range
+// shrinking at the boundary and no divergent SIMD lanes.  The ghost
+// frame is owned by the driver, which keeps it a linear extension of
+// the physical field.
+template <int radius, bool star, typename T = double, typename TA = T>
+void stencil_padded_t(const int n, const int t, prk::vector<T> & in, prk::vector<T> & out)
+{
+    constexpr auto W = stencil_weights<radius,star,TA>();
+    const int np = n + 2*radius;
+    for (auto it=radius; it<n+radius; it+=t) {
+      for (auto jt=radius; jt<n+radius; jt+=t) {
+        const auto imax = std::min(n+radius,it+t);
+        const auto jmax = std::min(n+radius,jt+t);
+        for (auto i=it; i<imax; ++i) {
+          PRAGMA_SIMD
+          for (auto j=jt; j<jmax; ++j) {
+            TA result(0);
+            if constexpr (star) {
+                for (int k=1; k<=radius; k++) {
+                    result += W[radius][radius+k] * in[i*np+(j+k)]
+                            + W[radius][radius-k] * in[i*np+(j-k)]
+                            + W[radius+k][radius] * in[(i+k)*np+j]
+                            + W[radius-k][radius] * in[(i-k)*np+j];
+                }
+            } else {
+                for (int ii=-radius; ii<=radius; ii++) {
+                    for (int jj=-radius; jj<=radius; jj++) {
+                        result += W[radius+ii][radius+jj] * in[(i+ii)*np+(j+jj)];
+                    }
+                }
+            }
+            out[i*np+j] += static_cast<T>(result);
+           }
+         }
+       }
+     }
+}
+
+/// 3D weights: the star extends the discrete divergence along the third
+/// axis, and the grid applies the 2D grid operator in each of the three
+/// coordinate planes, halved.  Either way a linear field i+j+k is
+/// advanced by 3 per sweep, so the driver validates against
+/// 3*(iterations+1) the same way the 2D kernels use 2*(iterations+1).
+template <int radius, bool star, typename T = double>
+constexpr std::array<std::array<std::array<T,2*radius+1>,2*radius+1>,2*radius+1> stencil3d_weights(void)
+{
+    std::array<std::array<std::array<T,2*radius+1>,2*radius+1>,2*radius+1> W {};
+    constexpr int r = radius;
+    if (star) {
+        for (int i=1; i<=r; i++) {
+            W[r][r][r+i] = +T(1)/(T(2)*i*r);
+            W[r][r][r-i] = -T(1)/(T(2)*i*r);
+            W[r][r+i][r] = +T(1)/(T(2)*i*r);
+            W[r][r-i][r] = -T(1)/(T(2)*i*r);
+            W[r+i][r][r] = +T(1)/(T(2)*i*r);
+            W[r-i][r][r] = -T(1)/(T(2)*i*r);
+        }
+    } else {
+        const auto W2 = stencil_weights<radius,false,T>();
+        for (int a=0; a<2*r+1; a++) {
+            for (int b=0; b<2*r+1; b++) {
+                W[a][b][r] += W2[a][b]/T(2);
+                W[a][r][b] += W2[a][b]/T(2);
+                W[r][a][b] += W2[a][b]/T(2);
+            }
+        }
+    }
+    return W;
+}
+
+/// Per-axis tile sizes: 3D tiling trades i/j reuse against k-contiguous
+/// streaming, so the three extents are independent parameters instead
+/// of the single square tile of the 2D kernel.
+template <int radius, bool star, typename T = double, typename TA = T>
+void stencil3d_t(const int n, const int ti, const int tj, const int tk,
+                 prk::vector<T> & in, prk::vector<T> & out)
+{
+    constexpr auto W = stencil3d_weights<radius,star,TA>();
+    for (auto it=radius; it<n-radius; it+=ti) {
+      for (auto jt=radius; jt<n-radius; jt+=tj) {
+       for (auto kt=radius; kt<n-radius; kt+=tk) {
+        const auto imax = std::min(n-radius,it+ti);
+        const auto jmax = std::min(n-radius,jt+tj);
+        const auto kmax = std::min(n-radius,kt+tk);
+        for (auto i=it; i<imax; ++i) {
+          for (auto j=jt; j<jmax; ++j) {
+            PRAGMA_SIMD
+            for (auto k=kt; k<kmax; ++k) {
+              TA result(0);
+              if constexpr (star) {
+                  for (int m=1; m<=radius; m++) {
+                      result += W[radius][radius][radius+m] * in[((i)*n+(j))*n+(k+m)]
+                              + W[radius][radius][radius-m] * in[((i)*n+(j))*n+(k-m)]
+                              + W[radius][radius+m][radius] * in[((i)*n+(j+m))*n+k]
+                              + W[radius][radius-m][radius] * in[((i)*n+(j-m))*n+k]
+                              + W[radius+m][radius][radius] * in[((i+m)*n+j)*n+k]
+                              + W[radius-m][radius][radius] * in[((i-m)*n+j)*n+k];
+                  }
+              } else {
+                  for (int ii=-radius; ii<=radius; ii++) {
+                      for (int jj=-radius; jj<=radius; jj++) {
+                          for (int kk=-radius; kk<=radius; kk++) {
+                              result += W[radius+ii][radius+jj][radius+kk]
+                                      * in[((i+ii)*n+(j+jj))*n+(k+kk)];
+                          }
+                      }
+                  }
+              }
+              out[(i*n+j)*n+k] += static_cast<T>(result);
+             }
+           }
+         }
+        }
+      }
+    }
+}
+
+#endif /* PRK_STENCIL_CONSTEXPR_HPP */
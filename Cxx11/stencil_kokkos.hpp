@@ -1,3 +1,4 @@
+template <typename matrix>
 void star1(const int n, const int t, matrix & in, matrix & out) {
     auto inside = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({1,1},{n-1,n-1},{t,t});
     Kokkos::parallel_for(inside, KOKKOS_LAMBDA(int i, int j) {
@@ -8,6 +9,7 @@ void star1(const int n, const int t, matrix & in, matrix & out) {
     });
 }
 
+template <typename matrix>
 void star2(const int n, const int t, matrix & in, matrix & out) {
     auto inside = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({2,2},{n-2,n-2},{t,t});
     Kokkos::parallel_for(inside, KOKKOS_LAMBDA(int i, int j) {
@@ -22,6 +24,7 @@ void star2(const int n, const int t, matrix & in, matrix & out) {
     });
 }
 
+template <typename matrix>
 void star3(const int n, const int t, matrix & in, matrix & out) {
     auto inside = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({3,3},{n-3,n-3},{t,t});
     Kokkos::parallel_for(inside, KOKKOS_LAMBDA(int i, int j) {
@@ -40,6 +43,7 @@ void star3(const int n, const int t, matrix & in, matrix & out) {
     });
 }
 
+template <typename matrix>
 void star4(const int n, const int t, matrix & in, matrix & out) {
     auto inside = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({4,4},{n-4,n-4},{t,t});
     Kokkos::parallel_for(inside, KOKKOS_LAMBDA(int i, int j) {
@@ -62,6 +66,7 @@ void star4(const int n, const int t, matrix & in, matrix & out) {
     });
 }
 
+template <typename matrix>
 void star5(const int n, const int t, matrix & in, matrix & out) {
     auto inside = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({5,5},{n-5,n-5},{t,t});
     Kokkos::parallel_for(inside, KOKKOS_LAMBDA(int i, int j) {
@@ -88,6 +93,7 @@ void star5(const int n, const int t, matrix & in, matrix & out) {
     });
 }
 
+template <typename matrix>
 void grid1(const int n, const int t, matrix & in, matrix & out) {
     auto inside = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({1,1},{n-1,n-1},{t,t});
     Kokkos::parallel_for(inside, KOKKOS_LAMBDA(int i, int j) {
@@ -101,6 +107,7 @@ void grid1(const int n, const int t, matrix & in, matrix & out) {
     });
 }
 
+template <typename matrix>
 void grid2(const int n, const int t, matrix & in, matrix & out) {
     auto inside = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({2,2},{n-2,n-2},{t,t});
     Kokkos::parallel_for(inside, KOKKOS_LAMBDA(int i, int j) {
@@ -128,6 +135,7 @@ void grid2(const int n, const int t, matrix & in, matrix & out) {
     });
 }
 
+template <typename matrix>
 void grid3(const int n, const int t, matrix & in, matrix & out) {
     auto inside = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({3,3},{n-3,n-3},{t,t});
     Kokkos::parallel_for(inside, KOKKOS_LAMBDA(int i, int j) {
@@ -177,6 +185,7 @@ void grid3(const int n, const int t, matrix & in, matrix & out) {
     });
 }
 
+template <typename matrix>
 void grid4(const int n, const int t, matrix & in, matrix & out) {
     auto inside = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({4,4},{n-4,n-4},{t,t});
     Kokkos::parallel_for(inside, KOKKOS_LAMBDA(int i, int j) {
@@ -256,6 +265,7 @@ void grid4(const int n, const int t, matrix & in, matrix & out) {
     });
 }
 
+template <typename matrix>
 void grid5(const int n, const int t, matrix & in, matrix & out) {
     auto inside = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({5,5},{n-5,n-5},{t,t});
     Kokkos::parallel_for(inside, KOKKOS_LAMBDA(int i, int j) {
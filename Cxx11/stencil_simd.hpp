@@ -0,0 +1,745 @@
+void star1(const int n, const int t, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto i=1; i<n-1; ++i) {
+      auto j=1;
+      for (; j+prk::simd::lanes<=n-1; j+=prk::simd::lanes) {
+        prk::simd::vdouble acc = prk::simd::load(&out[i*n+j]);
+        acc += prk::simd::load(&in[(i)*n+(j-1)]) * -0.5;
+        acc += prk::simd::load(&in[(i-1)*n+(j)]) * -0.5;
+        acc += prk::simd::load(&in[(i+1)*n+(j)]) * 0.5;
+        acc += prk::simd::load(&in[(i)*n+(j+1)]) * 0.5;
+        prk::simd::store(&out[i*n+j], acc);
+      }
+      for (; j<n-1; ++j) {
+            out[i*n+j] += +in[(i)*n+(j-1)] * -0.5
+                          +in[(i-1)*n+(j)] * -0.5
+                          +in[(i+1)*n+(j)] * 0.5
+                          +in[(i)*n+(j+1)] * 0.5;
+      }
+    }
+}
+
+void star2(const int n, const int t, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto i=2; i<n-2; ++i) {
+      auto j=2;
+      for (; j+prk::simd::lanes<=n-2; j+=prk::simd::lanes) {
+        prk::simd::vdouble acc = prk::simd::load(&out[i*n+j]);
+        acc += prk::simd::load(&in[(i)*n+(j-2)]) * -0.125;
+        acc += prk::simd::load(&in[(i)*n+(j-1)]) * -0.25;
+        acc += prk::simd::load(&in[(i-2)*n+(j)]) * -0.125;
+        acc += prk::simd::load(&in[(i-1)*n+(j)]) * -0.25;
+        acc += prk::simd::load(&in[(i+1)*n+(j)]) * 0.25;
+        acc += prk::simd::load(&in[(i+2)*n+(j)]) * 0.125;
+        acc += prk::simd::load(&in[(i)*n+(j+1)]) * 0.25;
+        acc += prk::simd::load(&in[(i)*n+(j+2)]) * 0.125;
+        prk::simd::store(&out[i*n+j], acc);
+      }
+      for (; j<n-2; ++j) {
+            out[i*n+j] += +in[(i)*n+(j-2)] * -0.125
+                          +in[(i)*n+(j-1)] * -0.25
+                          +in[(i-2)*n+(j)] * -0.125
+                          +in[(i-1)*n+(j)] * -0.25
+                          +in[(i+1)*n+(j)] * 0.25
+                          +in[(i+2)*n+(j)] * 0.125
+                          +in[(i)*n+(j+1)] * 0.25
+                          +in[(i)*n+(j+2)] * 0.125;
+      }
+    }
+}
+
+void star3(const int n, const int t, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto i=3; i<n-3; ++i) {
+      auto j=3;
+      for (; j+prk::simd::lanes<=n-3; j+=prk::simd::lanes) {
+        prk::simd::vdouble acc = prk::simd::load(&out[i*n+j]);
+        acc += prk::simd::load(&in[(i)*n+(j-3)]) * -0.05555555555555555;
+        acc += prk::simd::load(&in[(i)*n+(j-2)]) * -0.08333333333333333;
+        acc += prk::simd::load(&in[(i)*n+(j-1)]) * -0.16666666666666666;
+        acc += prk::simd::load(&in[(i-3)*n+(j)]) * -0.05555555555555555;
+        acc += prk::simd::load(&in[(i-2)*n+(j)]) * -0.08333333333333333;
+        acc += prk::simd::load(&in[(i-1)*n+(j)]) * -0.16666666666666666;
+        acc += prk::simd::load(&in[(i+1)*n+(j)]) * 0.16666666666666666;
+        acc += prk::simd::load(&in[(i+2)*n+(j)]) * 0.08333333333333333;
+        acc += prk::simd::load(&in[(i+3)*n+(j)]) * 0.05555555555555555;
+        acc += prk::simd::load(&in[(i)*n+(j+1)]) * 0.16666666666666666;
+        acc += prk::simd::load(&in[(i)*n+(j+2)]) * 0.08333333333333333;
+        acc += prk::simd::load(&in[(i)*n+(j+3)]) * 0.05555555555555555;
+        prk::simd::store(&out[i*n+j], acc);
+      }
+      for (; j<n-3; ++j) {
+            out[i*n+j] += +in[(i)*n+(j-3)] * -0.05555555555555555
+                          +in[(i)*n+(j-2)] * -0.08333333333333333
+                          +in[(i)*n+(j-1)] * -0.16666666666666666
+                          +in[(i-3)*n+(j)] * -0.05555555555555555
+                          +in[(i-2)*n+(j)] * -0.08333333333333333
+                          +in[(i-1)*n+(j)] * -0.16666666666666666
+                          +in[(i+1)*n+(j)] * 0.16666666666666666
+                          +in[(i+2)*n+(j)] * 0.08333333333333333
+                          +in[(i+3)*n+(j)] * 0.05555555555555555
+                          +in[(i)*n+(j+1)] * 0.16666666666666666
+                          +in[(i)*n+(j+2)] * 0.08333333333333333
+                          +in[(i)*n+(j+3)] * 0.05555555555555555;
+      }
+    }
+}
+
+void star4(const int n, const int t, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto i=4; i<n-4; ++i) {
+      auto j=4;
+      for (; j+prk::simd::lanes<=n-4; j+=prk::simd::lanes) {
+        prk::simd::vdouble acc = prk::simd::load(&out[i*n+j]);
+        acc += prk::simd::load(&in[(i)*n+(j-4)]) * -0.03125;
+        acc += prk::simd::load(&in[(i)*n+(j-3)]) * -0.041666666666666664;
+        acc += prk::simd::load(&in[(i)*n+(j-2)]) * -0.0625;
+        acc += prk::simd::load(&in[(i)*n+(j-1)]) * -0.125;
+        acc += prk::simd::load(&in[(i-4)*n+(j)]) * -0.03125;
+        acc += prk::simd::load(&in[(i-3)*n+(j)]) * -0.041666666666666664;
+        acc += prk::simd::load(&in[(i-2)*n+(j)]) * -0.0625;
+        acc += prk::simd::load(&in[(i-1)*n+(j)]) * -0.125;
+        acc += prk::simd::load(&in[(i+1)*n+(j)]) * 0.125;
+        acc += prk::simd::load(&in[(i+2)*n+(j)]) * 0.0625;
+        acc += prk::simd::load(&in[(i+3)*n+(j)]) * 0.041666666666666664;
+        acc += prk::simd::load(&in[(i+4)*n+(j)]) * 0.03125;
+        acc += prk::simd::load(&in[(i)*n+(j+1)]) * 0.125;
+        acc += prk::simd::load(&in[(i)*n+(j+2)]) * 0.0625;
+        acc += prk::simd::load(&in[(i)*n+(j+3)]) * 0.041666666666666664;
+        acc += prk::simd::load(&in[(i)*n+(j+4)]) * 0.03125;
+        prk::simd::store(&out[i*n+j], acc);
+      }
+      for (; j<n-4; ++j) {
+            out[i*n+j] += +in[(i)*n+(j-4)] * -0.03125
+                          +in[(i)*n+(j-3)] * -0.041666666666666664
+                          +in[(i)*n+(j-2)] * -0.0625
+                          +in[(i)*n+(j-1)] * -0.125
+                          +in[(i-4)*n+(j)] * -0.03125
+                          +in[(i-3)*n+(j)] * -0.041666666666666664
+                          +in[(i-2)*n+(j)] * -0.0625
+                          +in[(i-1)*n+(j)] * -0.125
+                          +in[(i+1)*n+(j)] * 0.125
+                          +in[(i+2)*n+(j)] * 0.0625
+                          +in[(i+3)*n+(j)] * 0.041666666666666664
+                          +in[(i+4)*n+(j)] * 0.03125
+                          +in[(i)*n+(j+1)] * 0.125
+                          +in[(i)*n+(j+2)] * 0.0625
+                          +in[(i)*n+(j+3)] * 0.041666666666666664
+                          +in[(i)*n+(j+4)] * 0.03125;
+      }
+    }
+}
+
+void star5(const int n, const int t, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto i=5; i<n-5; ++i) {
+      auto j=5;
+      for (; j+prk::simd::lanes<=n-5; j+=prk::simd::lanes) {
+        prk::simd::vdouble acc = prk::simd::load(&out[i*n+j]);
+        acc += prk::simd::load(&in[(i)*n+(j-5)]) * -0.02;
+        acc += prk::simd::load(&in[(i)*n+(j-4)]) * -0.025;
+        acc += prk::simd::load(&in[(i)*n+(j-3)]) * -0.03333333333333333;
+        acc += prk::simd::load(&in[(i)*n+(j-2)]) * -0.05;
+        acc += prk::simd::load(&in[(i)*n+(j-1)]) * -0.1;
+        acc += prk::simd::load(&in[(i-5)*n+(j)]) * -0.02;
+        acc += prk::simd::load(&in[(i-4)*n+(j)]) * -0.025;
+        acc += prk::simd::load(&in[(i-3)*n+(j)]) * -0.03333333333333333;
+        acc += prk::simd::load(&in[(i-2)*n+(j)]) * -0.05;
+        acc += prk::simd::load(&in[(i-1)*n+(j)]) * -0.1;
+        acc += prk::simd::load(&in[(i+1)*n+(j)]) * 0.1;
+        acc += prk::simd::load(&in[(i+2)*n+(j)]) * 0.05;
+        acc += prk::simd::load(&in[(i+3)*n+(j)]) * 0.03333333333333333;
+        acc += prk::simd::load(&in[(i+4)*n+(j)]) * 0.025;
+        acc += prk::simd::load(&in[(i+5)*n+(j)]) * 0.02;
+        acc += prk::simd::load(&in[(i)*n+(j+1)]) * 0.1;
+        acc += prk::simd::load(&in[(i)*n+(j+2)]) * 0.05;
+        acc += prk::simd::load(&in[(i)*n+(j+3)]) * 0.03333333333333333;
+        acc += prk::simd::load(&in[(i)*n+(j+4)]) * 0.025;
+        acc += prk::simd::load(&in[(i)*n+(j+5)]) * 0.02;
+        prk::simd::store(&out[i*n+j], acc);
+      }
+      for (; j<n-5; ++j) {
+            out[i*n+j] += +in[(i)*n+(j-5)] * -0.02
+                          +in[(i)*n+(j-4)] * -0.025
+                          +in[(i)*n+(j-3)] * -0.03333333333333333
+                          +in[(i)*n+(j-2)] * -0.05
+                          +in[(i)*n+(j-1)] * -0.1
+                          +in[(i-5)*n+(j)] * -0.02
+                          +in[(i-4)*n+(j)] * -0.025
+                          +in[(i-3)*n+(j)] * -0.03333333333333333
+                          +in[(i-2)*n+(j)] * -0.05
+                          +in[(i-1)*n+(j)] * -0.1
+                          +in[(i+1)*n+(j)] * 0.1
+                          +in[(i+2)*n+(j)] * 0.05
+                          +in[(i+3)*n+(j)] * 0.03333333333333333
+                          +in[(i+4)*n+(j)] * 0.025
+                          +in[(i+5)*n+(j)] * 0.02
+                          +in[(i)*n+(j+1)] * 0.1
+                          +in[(i)*n+(j+2)] * 0.05
+                          +in[(i)*n+(j+3)] * 0.03333333333333333
+                          +in[(i)*n+(j+4)] * 0.025
+                          +in[(i)*n+(j+5)] * 0.02;
+      }
+    }
+}
+
+void grid1(const int n, const int t, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto i=1; i<n-1; ++i) {
+      auto j=1;
+      for (; j+prk::simd::lanes<=n-1; j+=prk::simd::lanes) {
+        prk::simd::vdouble acc = prk::simd::load(&out[i*n+j]);
+        acc += prk::simd::load(&in[(i-1)*n+(j-1)]) * -0.25;
+        acc += prk::simd::load(&in[(i)*n+(j-1)]) * -0.25;
+        acc += prk::simd::load(&in[(i-1)*n+(j)]) * -0.25;
+        acc += prk::simd::load(&in[(i+1)*n+(j)]) * 0.25;
+        acc += prk::simd::load(&in[(i)*n+(j+1)]) * 0.25;
+        acc += prk::simd::load(&in[(i+1)*n+(j+1)]) * 0.25;
+        prk::simd::store(&out[i*n+j], acc);
+      }
+      for (; j<n-1; ++j) {
+            out[i*n+j] += +in[(i-1)*n+(j-1)] * -0.25
+                          +in[(i)*n+(j-1)] * -0.25
+                          +in[(i-1)*n+(j)] * -0.25
+                          +in[(i+1)*n+(j)] * 0.25
+                          +in[(i)*n+(j+1)] * 0.25
+                          +in[(i+1)*n+(j+1)] * 0.25
+                          ;
+      }
+    }
+}
+
+void grid2(const int n, const int t, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto i=2; i<n-2; ++i) {
+      auto j=2;
+      for (; j+prk::simd::lanes<=n-2; j+=prk::simd::lanes) {
+        prk::simd::vdouble acc = prk::simd::load(&out[i*n+j]);
+        acc += prk::simd::load(&in[(i-2)*n+(j-2)]) * -0.0625;
+        acc += prk::simd::load(&in[(i-1)*n+(j-2)]) * -0.020833333333333332;
+        acc += prk::simd::load(&in[(i)*n+(j-2)]) * -0.020833333333333332;
+        acc += prk::simd::load(&in[(i+1)*n+(j-2)]) * -0.020833333333333332;
+        acc += prk::simd::load(&in[(i-2)*n+(j-1)]) * -0.020833333333333332;
+        acc += prk::simd::load(&in[(i-1)*n+(j-1)]) * -0.125;
+        acc += prk::simd::load(&in[(i)*n+(j-1)]) * -0.125;
+        acc += prk::simd::load(&in[(i+2)*n+(j-1)]) * 0.020833333333333332;
+        acc += prk::simd::load(&in[(i-2)*n+(j)]) * -0.020833333333333332;
+        acc += prk::simd::load(&in[(i-1)*n+(j)]) * -0.125;
+        acc += prk::simd::load(&in[(i+1)*n+(j)]) * 0.125;
+        acc += prk::simd::load(&in[(i+2)*n+(j)]) * 0.020833333333333332;
+        acc += prk::simd::load(&in[(i-2)*n+(j+1)]) * -0.020833333333333332;
+        acc += prk::simd::load(&in[(i)*n+(j+1)]) * 0.125;
+        acc += prk::simd::load(&in[(i+1)*n+(j+1)]) * 0.125;
+        acc += prk::simd::load(&in[(i+2)*n+(j+1)]) * 0.020833333333333332;
+        acc += prk::simd::load(&in[(i-1)*n+(j+2)]) * 0.020833333333333332;
+        acc += prk::simd::load(&in[(i)*n+(j+2)]) * 0.020833333333333332;
+        acc += prk::simd::load(&in[(i+1)*n+(j+2)]) * 0.020833333333333332;
+        acc += prk::simd::load(&in[(i+2)*n+(j+2)]) * 0.0625;
+        prk::simd::store(&out[i*n+j], acc);
+      }
+      for (; j<n-2; ++j) {
+            out[i*n+j] += +in[(i-2)*n+(j-2)] * -0.0625
+                          +in[(i-1)*n+(j-2)] * -0.020833333333333332
+                          +in[(i)*n+(j-2)] * -0.020833333333333332
+                          +in[(i+1)*n+(j-2)] * -0.020833333333333332
+                          +in[(i-2)*n+(j-1)] * -0.020833333333333332
+                          +in[(i-1)*n+(j-1)] * -0.125
+                          +in[(i)*n+(j-1)] * -0.125
+                          +in[(i+2)*n+(j-1)] * 0.020833333333333332
+                          +in[(i-2)*n+(j)] * -0.020833333333333332
+                          +in[(i-1)*n+(j)] * -0.125
+                          +in[(i+1)*n+(j)] * 0.125
+                          +in[(i+2)*n+(j)] * 0.020833333333333332
+                          +in[(i-2)*n+(j+1)] * -0.020833333333333332
+                          +in[(i)*n+(j+1)] * 0.125
+                          +in[(i+1)*n+(j+1)] * 0.125
+                          +in[(i+2)*n+(j+1)] * 0.020833333333333332
+                          +in[(i-1)*n+(j+2)] * 0.020833333333333332
+                          +in[(i)*n+(j+2)] * 0.020833333333333332
+                          +in[(i+1)*n+(j+2)] * 0.020833333333333332
+                          +in[(i+2)*n+(j+2)] * 0.0625
+                          ;
+      }
+    }
+}
+
+void grid3(const int n, const int t, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto i=3; i<n-3; ++i) {
+      auto j=3;
+      for (; j+prk::simd::lanes<=n-3; j+=prk::simd::lanes) {
+        prk::simd::vdouble acc = prk::simd::load(&out[i*n+j]);
+        acc += prk::simd::load(&in[(i-3)*n+(j-3)]) * -0.027777777777777776;
+        acc += prk::simd::load(&in[(i-2)*n+(j-3)]) * -0.005555555555555556;
+        acc += prk::simd::load(&in[(i-1)*n+(j-3)]) * -0.005555555555555556;
+        acc += prk::simd::load(&in[(i)*n+(j-3)]) * -0.005555555555555556;
+        acc += prk::simd::load(&in[(i+1)*n+(j-3)]) * -0.005555555555555556;
+        acc += prk::simd::load(&in[(i+2)*n+(j-3)]) * -0.005555555555555556;
+        acc += prk::simd::load(&in[(i-3)*n+(j-2)]) * -0.005555555555555556;
+        acc += prk::simd::load(&in[(i-2)*n+(j-2)]) * -0.041666666666666664;
+        acc += prk::simd::load(&in[(i-1)*n+(j-2)]) * -0.013888888888888888;
+        acc += prk::simd::load(&in[(i)*n+(j-2)]) * -0.013888888888888888;
+        acc += prk::simd::load(&in[(i+1)*n+(j-2)]) * -0.013888888888888888;
+        acc += prk::simd::load(&in[(i+3)*n+(j-2)]) * 0.005555555555555556;
+        acc += prk::simd::load(&in[(i-3)*n+(j-1)]) * -0.005555555555555556;
+        acc += prk::simd::load(&in[(i-2)*n+(j-1)]) * -0.013888888888888888;
+        acc += prk::simd::load(&in[(i-1)*n+(j-1)]) * -0.08333333333333333;
+        acc += prk::simd::load(&in[(i)*n+(j-1)]) * -0.08333333333333333;
+        acc += prk::simd::load(&in[(i+2)*n+(j-1)]) * 0.013888888888888888;
+        acc += prk::simd::load(&in[(i+3)*n+(j-1)]) * 0.005555555555555556;
+        acc += prk::simd::load(&in[(i-3)*n+(j)]) * -0.005555555555555556;
+        acc += prk::simd::load(&in[(i-2)*n+(j)]) * -0.013888888888888888;
+        acc += prk::simd::load(&in[(i-1)*n+(j)]) * -0.08333333333333333;
+        acc += prk::simd::load(&in[(i+1)*n+(j)]) * 0.08333333333333333;
+        acc += prk::simd::load(&in[(i+2)*n+(j)]) * 0.013888888888888888;
+        acc += prk::simd::load(&in[(i+3)*n+(j)]) * 0.005555555555555556;
+        acc += prk::simd::load(&in[(i-3)*n+(j+1)]) * -0.005555555555555556;
+        acc += prk::simd::load(&in[(i-2)*n+(j+1)]) * -0.013888888888888888;
+        acc += prk::simd::load(&in[(i)*n+(j+1)]) * 0.08333333333333333;
+        acc += prk::simd::load(&in[(i+1)*n+(j+1)]) * 0.08333333333333333;
+        acc += prk::simd::load(&in[(i+2)*n+(j+1)]) * 0.013888888888888888;
+        acc += prk::simd::load(&in[(i+3)*n+(j+1)]) * 0.005555555555555556;
+        acc += prk::simd::load(&in[(i-3)*n+(j+2)]) * -0.005555555555555556;
+        acc += prk::simd::load(&in[(i-1)*n+(j+2)]) * 0.013888888888888888;
+        acc += prk::simd::load(&in[(i)*n+(j+2)]) * 0.013888888888888888;
+        acc += prk::simd::load(&in[(i+1)*n+(j+2)]) * 0.013888888888888888;
+        acc += prk::simd::load(&in[(i+2)*n+(j+2)]) * 0.041666666666666664;
+        acc += prk::simd::load(&in[(i+3)*n+(j+2)]) * 0.005555555555555556;
+        acc += prk::simd::load(&in[(i-2)*n+(j+3)]) * 0.005555555555555556;
+        acc += prk::simd::load(&in[(i-1)*n+(j+3)]) * 0.005555555555555556;
+        acc += prk::simd::load(&in[(i)*n+(j+3)]) * 0.005555555555555556;
+        acc += prk::simd::load(&in[(i+1)*n+(j+3)]) * 0.005555555555555556;
+        acc += prk::simd::load(&in[(i+2)*n+(j+3)]) * 0.005555555555555556;
+        acc += prk::simd::load(&in[(i+3)*n+(j+3)]) * 0.027777777777777776;
+        prk::simd::store(&out[i*n+j], acc);
+      }
+      for (; j<n-3; ++j) {
+            out[i*n+j] += +in[(i-3)*n+(j-3)] * -0.027777777777777776
+                          +in[(i-2)*n+(j-3)] * -0.005555555555555556
+                          +in[(i-1)*n+(j-3)] * -0.005555555555555556
+                          +in[(i)*n+(j-3)] * -0.005555555555555556
+                          +in[(i+1)*n+(j-3)] * -0.005555555555555556
+                          +in[(i+2)*n+(j-3)] * -0.005555555555555556
+                          +in[(i-3)*n+(j-2)] * -0.005555555555555556
+                          +in[(i-2)*n+(j-2)] * -0.041666666666666664
+                          +in[(i-1)*n+(j-2)] * -0.013888888888888888
+                          +in[(i)*n+(j-2)] * -0.013888888888888888
+                          +in[(i+1)*n+(j-2)] * -0.013888888888888888
+                          +in[(i+3)*n+(j-2)] * 0.005555555555555556
+                          +in[(i-3)*n+(j-1)] * -0.005555555555555556
+                          +in[(i-2)*n+(j-1)] * -0.013888888888888888
+                          +in[(i-1)*n+(j-1)] * -0.08333333333333333
+                          +in[(i)*n+(j-1)] * -0.08333333333333333
+                          +in[(i+2)*n+(j-1)] * 0.013888888888888888
+                          +in[(i+3)*n+(j-1)] * 0.005555555555555556
+                          +in[(i-3)*n+(j)] * -0.005555555555555556
+                          +in[(i-2)*n+(j)] * -0.013888888888888888
+                          +in[(i-1)*n+(j)] * -0.08333333333333333
+                          +in[(i+1)*n+(j)] * 0.08333333333333333
+                          +in[(i+2)*n+(j)] * 0.013888888888888888
+                          +in[(i+3)*n+(j)] * 0.005555555555555556
+                          +in[(i-3)*n+(j+1)] * -0.005555555555555556
+                          +in[(i-2)*n+(j+1)] * -0.013888888888888888
+                          +in[(i)*n+(j+1)] * 0.08333333333333333
+                          +in[(i+1)*n+(j+1)] * 0.08333333333333333
+                          +in[(i+2)*n+(j+1)] * 0.013888888888888888
+                          +in[(i+3)*n+(j+1)] * 0.005555555555555556
+                          +in[(i-3)*n+(j+2)] * -0.005555555555555556
+                          +in[(i-1)*n+(j+2)] * 0.013888888888888888
+                          +in[(i)*n+(j+2)] * 0.013888888888888888
+                          +in[(i+1)*n+(j+2)] * 0.013888888888888888
+                          +in[(i+2)*n+(j+2)] * 0.041666666666666664
+                          +in[(i+3)*n+(j+2)] * 0.005555555555555556
+                          +in[(i-2)*n+(j+3)] * 0.005555555555555556
+                          +in[(i-1)*n+(j+3)] * 0.005555555555555556
+                          +in[(i)*n+(j+3)] * 0.005555555555555556
+                          +in[(i+1)*n+(j+3)] * 0.005555555555555556
+                          +in[(i+2)*n+(j+3)] * 0.005555555555555556
+                          +in[(i+3)*n+(j+3)] * 0.027777777777777776
+                          ;
+      }
+    }
+}
+
+void grid4(const int n, const int t, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto i=4; i<n-4; ++i) {
+      auto j=4;
+      for (; j+prk::simd::lanes<=n-4; j+=prk::simd::lanes) {
+        prk::simd::vdouble acc = prk::simd::load(&out[i*n+j]);
+        acc += prk::simd::load(&in[(i-4)*n+(j-4)]) * -0.015625;
+        acc += prk::simd::load(&in[(i-3)*n+(j-4)]) * -0.002232142857142857;
+        acc += prk::simd::load(&in[(i-2)*n+(j-4)]) * -0.002232142857142857;
+        acc += prk::simd::load(&in[(i-1)*n+(j-4)]) * -0.002232142857142857;
+        acc += prk::simd::load(&in[(i)*n+(j-4)]) * -0.002232142857142857;
+        acc += prk::simd::load(&in[(i+1)*n+(j-4)]) * -0.002232142857142857;
+        acc += prk::simd::load(&in[(i+2)*n+(j-4)]) * -0.002232142857142857;
+        acc += prk::simd::load(&in[(i+3)*n+(j-4)]) * -0.002232142857142857;
+        acc += prk::simd::load(&in[(i-4)*n+(j-3)]) * -0.002232142857142857;
+        acc += prk::simd::load(&in[(i-3)*n+(j-3)]) * -0.020833333333333332;
+        acc += prk::simd::load(&in[(i-2)*n+(j-3)]) * -0.004166666666666667;
+        acc += prk::simd::load(&in[(i-1)*n+(j-3)]) * -0.004166666666666667;
+        acc += prk::simd::load(&in[(i)*n+(j-3)]) * -0.004166666666666667;
+        acc += prk::simd::load(&in[(i+1)*n+(j-3)]) * -0.004166666666666667;
+        acc += prk::simd::load(&in[(i+2)*n+(j-3)]) * -0.004166666666666667;
+        acc += prk::simd::load(&in[(i+4)*n+(j-3)]) * 0.002232142857142857;
+        acc += prk::simd::load(&in[(i-4)*n+(j-2)]) * -0.002232142857142857;
+        acc += prk::simd::load(&in[(i-3)*n+(j-2)]) * -0.004166666666666667;
+        acc += prk::simd::load(&in[(i-2)*n+(j-2)]) * -0.03125;
+        acc += prk::simd::load(&in[(i-1)*n+(j-2)]) * -0.010416666666666666;
+        acc += prk::simd::load(&in[(i)*n+(j-2)]) * -0.010416666666666666;
+        acc += prk::simd::load(&in[(i+1)*n+(j-2)]) * -0.010416666666666666;
+        acc += prk::simd::load(&in[(i+3)*n+(j-2)]) * 0.004166666666666667;
+        acc += prk::simd::load(&in[(i+4)*n+(j-2)]) * 0.002232142857142857;
+        acc += prk::simd::load(&in[(i-4)*n+(j-1)]) * -0.002232142857142857;
+        acc += prk::simd::load(&in[(i-3)*n+(j-1)]) * -0.004166666666666667;
+        acc += prk::simd::load(&in[(i-2)*n+(j-1)]) * -0.010416666666666666;
+        acc += prk::simd::load(&in[(i-1)*n+(j-1)]) * -0.0625;
+        acc += prk::simd::load(&in[(i)*n+(j-1)]) * -0.0625;
+        acc += prk::simd::load(&in[(i+2)*n+(j-1)]) * 0.010416666666666666;
+        acc += prk::simd::load(&in[(i+3)*n+(j-1)]) * 0.004166666666666667;
+        acc += prk::simd::load(&in[(i+4)*n+(j-1)]) * 0.002232142857142857;
+        acc += prk::simd::load(&in[(i-4)*n+(j)]) * -0.002232142857142857;
+        acc += prk::simd::load(&in[(i-3)*n+(j)]) * -0.004166666666666667;
+        acc += prk::simd::load(&in[(i-2)*n+(j)]) * -0.010416666666666666;
+        acc += prk::simd::load(&in[(i-1)*n+(j)]) * -0.0625;
+        acc += prk::simd::load(&in[(i+1)*n+(j)]) * 0.0625;
+        acc += prk::simd::load(&in[(i+2)*n+(j)]) * 0.010416666666666666;
+        acc += prk::simd::load(&in[(i+3)*n+(j)]) * 0.004166666666666667;
+        acc += prk::simd::load(&in[(i+4)*n+(j)]) * 0.002232142857142857;
+        acc += prk::simd::load(&in[(i-4)*n+(j+1)]) * -0.002232142857142857;
+        acc += prk::simd::load(&in[(i-3)*n+(j+1)]) * -0.004166666666666667;
+        acc += prk::simd::load(&in[(i-2)*n+(j+1)]) * -0.010416666666666666;
+        acc += prk::simd::load(&in[(i)*n+(j+1)]) * 0.0625;
+        acc += prk::simd::load(&in[(i+1)*n+(j+1)]) * 0.0625;
+        acc += prk::simd::load(&in[(i+2)*n+(j+1)]) * 0.010416666666666666;
+        acc += prk::simd::load(&in[(i+3)*n+(j+1)]) * 0.004166666666666667;
+        acc += prk::simd::load(&in[(i+4)*n+(j+1)]) * 0.002232142857142857;
+        acc += prk::simd::load(&in[(i-4)*n+(j+2)]) * -0.002232142857142857;
+        acc += prk::simd::load(&in[(i-3)*n+(j+2)]) * -0.004166666666666667;
+        acc += prk::simd::load(&in[(i-1)*n+(j+2)]) * 0.010416666666666666;
+        acc += prk::simd::load(&in[(i)*n+(j+2)]) * 0.010416666666666666;
+        acc += prk::simd::load(&in[(i+1)*n+(j+2)]) * 0.010416666666666666;
+        acc += prk::simd::load(&in[(i+2)*n+(j+2)]) * 0.03125;
+        acc += prk::simd::load(&in[(i+3)*n+(j+2)]) * 0.004166666666666667;
+        acc += prk::simd::load(&in[(i+4)*n+(j+2)]) * 0.002232142857142857;
+        acc += prk::simd::load(&in[(i-4)*n+(j+3)]) * -0.002232142857142857;
+        acc += prk::simd::load(&in[(i-2)*n+(j+3)]) * 0.004166666666666667;
+        acc += prk::simd::load(&in[(i-1)*n+(j+3)]) * 0.004166666666666667;
+        acc += prk::simd::load(&in[(i)*n+(j+3)]) * 0.004166666666666667;
+        acc += prk::simd::load(&in[(i+1)*n+(j+3)]) * 0.004166666666666667;
+        acc += prk::simd::load(&in[(i+2)*n+(j+3)]) * 0.004166666666666667;
+        acc += prk::simd::load(&in[(i+3)*n+(j+3)]) * 0.020833333333333332;
+        acc += prk::simd::load(&in[(i+4)*n+(j+3)]) * 0.002232142857142857;
+        acc += prk::simd::load(&in[(i-3)*n+(j+4)]) * 0.002232142857142857;
+        acc += prk::simd::load(&in[(i-2)*n+(j+4)]) * 0.002232142857142857;
+        acc += prk::simd::load(&in[(i-1)*n+(j+4)]) * 0.002232142857142857;
+        acc += prk::simd::load(&in[(i)*n+(j+4)]) * 0.002232142857142857;
+        acc += prk::simd::load(&in[(i+1)*n+(j+4)]) * 0.002232142857142857;
+        acc += prk::simd::load(&in[(i+2)*n+(j+4)]) * 0.002232142857142857;
+        acc += prk::simd::load(&in[(i+3)*n+(j+4)]) * 0.002232142857142857;
+        acc += prk::simd::load(&in[(i+4)*n+(j+4)]) * 0.015625;
+        prk::simd::store(&out[i*n+j], acc);
+      }
+      for (; j<n-4; ++j) {
+            out[i*n+j] += +in[(i-4)*n+(j-4)] * -0.015625
+                          +in[(i-3)*n+(j-4)] * -0.002232142857142857
+                          +in[(i-2)*n+(j-4)] * -0.002232142857142857
+                          +in[(i-1)*n+(j-4)] * -0.002232142857142857
+                          +in[(i)*n+(j-4)] * -0.002232142857142857
+                          +in[(i+1)*n+(j-4)] * -0.002232142857142857
+                          +in[(i+2)*n+(j-4)] * -0.002232142857142857
+                          +in[(i+3)*n+(j-4)] * -0.002232142857142857
+                          +in[(i-4)*n+(j-3)] * -0.002232142857142857
+                          +in[(i-3)*n+(j-3)] * -0.020833333333333332
+                          +in[(i-2)*n+(j-3)] * -0.004166666666666667
+                          +in[(i-1)*n+(j-3)] * -0.004166666666666667
+                          +in[(i)*n+(j-3)] * -0.004166666666666667
+                          +in[(i+1)*n+(j-3)] * -0.004166666666666667
+                          +in[(i+2)*n+(j-3)] * -0.004166666666666667
+                          +in[(i+4)*n+(j-3)] * 0.002232142857142857
+                          +in[(i-4)*n+(j-2)] * -0.002232142857142857
+                          +in[(i-3)*n+(j-2)] * -0.004166666666666667
+                          +in[(i-2)*n+(j-2)] * -0.03125
+                          +in[(i-1)*n+(j-2)] * -0.010416666666666666
+                          +in[(i)*n+(j-2)] * -0.010416666666666666
+                          +in[(i+1)*n+(j-2)] * -0.010416666666666666
+                          +in[(i+3)*n+(j-2)] * 0.004166666666666667
+                          +in[(i+4)*n+(j-2)] * 0.002232142857142857
+                          +in[(i-4)*n+(j-1)] * -0.002232142857142857
+                          +in[(i-3)*n+(j-1)] * -0.004166666666666667
+                          +in[(i-2)*n+(j-1)] * -0.010416666666666666
+                          +in[(i-1)*n+(j-1)] * -0.0625
+                          +in[(i)*n+(j-1)] * -0.0625
+                          +in[(i+2)*n+(j-1)] * 0.010416666666666666
+                          +in[(i+3)*n+(j-1)] * 0.004166666666666667
+                          +in[(i+4)*n+(j-1)] * 0.002232142857142857
+                          +in[(i-4)*n+(j)] * -0.002232142857142857
+                          +in[(i-3)*n+(j)] * -0.004166666666666667
+                          +in[(i-2)*n+(j)] * -0.010416666666666666
+                          +in[(i-1)*n+(j)] * -0.0625
+                          +in[(i+1)*n+(j)] * 0.0625
+                          +in[(i+2)*n+(j)] * 0.010416666666666666
+                          +in[(i+3)*n+(j)] * 0.004166666666666667
+                          +in[(i+4)*n+(j)] * 0.002232142857142857
+                          +in[(i-4)*n+(j+1)] * -0.002232142857142857
+                          +in[(i-3)*n+(j+1)] * -0.004166666666666667
+                          +in[(i-2)*n+(j+1)] * -0.010416666666666666
+                          +in[(i)*n+(j+1)] * 0.0625
+                          +in[(i+1)*n+(j+1)] * 0.0625
+                          +in[(i+2)*n+(j+1)] * 0.010416666666666666
+                          +in[(i+3)*n+(j+1)] * 0.004166666666666667
+                          +in[(i+4)*n+(j+1)] * 0.002232142857142857
+                          +in[(i-4)*n+(j+2)] * -0.002232142857142857
+                          +in[(i-3)*n+(j+2)] * -0.004166666666666667
+                          +in[(i-1)*n+(j+2)] * 0.010416666666666666
+                          +in[(i)*n+(j+2)] * 0.010416666666666666
+                          +in[(i+1)*n+(j+2)] * 0.010416666666666666
+                          +in[(i+2)*n+(j+2)] * 0.03125
+                          +in[(i+3)*n+(j+2)] * 0.004166666666666667
+                          +in[(i+4)*n+(j+2)] * 0.002232142857142857
+                          +in[(i-4)*n+(j+3)] * -0.002232142857142857
+                          +in[(i-2)*n+(j+3)] * 0.004166666666666667
+                          +in[(i-1)*n+(j+3)] * 0.004166666666666667
+                          +in[(i)*n+(j+3)] * 0.004166666666666667
+                          +in[(i+1)*n+(j+3)] * 0.004166666666666667
+                          +in[(i+2)*n+(j+3)] * 0.004166666666666667
+                          +in[(i+3)*n+(j+3)] * 0.020833333333333332
+                          +in[(i+4)*n+(j+3)] * 0.002232142857142857
+                          +in[(i-3)*n+(j+4)] * 0.002232142857142857
+                          +in[(i-2)*n+(j+4)] * 0.002232142857142857
+                          +in[(i-1)*n+(j+4)] * 0.002232142857142857
+                          +in[(i)*n+(j+4)] * 0.002232142857142857
+                          +in[(i+1)*n+(j+4)] * 0.002232142857142857
+                          +in[(i+2)*n+(j+4)] * 0.002232142857142857
+                          +in[(i+3)*n+(j+4)] * 0.002232142857142857
+                          +in[(i+4)*n+(j+4)] * 0.015625
+                          ;
+      }
+    }
+}
+
+void grid5(const int n, const int t, prk::vector<double> & in, prk::vector<double> & out) {
+    for (auto i=5; i<n-5; ++i) {
+      auto j=5;
+      for (; j+prk::simd::lanes<=n-5; j+=prk::simd::lanes) {
+        prk::simd::vdouble acc = prk::simd::load(&out[i*n+j]);
+        acc += prk::simd::load(&in[(i-5)*n+(j-5)]) * -0.01;
+        acc += prk::simd::load(&in[(i-4)*n+(j-5)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-3)*n+(j-5)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-2)*n+(j-5)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-1)*n+(j-5)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i)*n+(j-5)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i+1)*n+(j-5)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i+2)*n+(j-5)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i+3)*n+(j-5)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i+4)*n+(j-5)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-5)*n+(j-4)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-4)*n+(j-4)]) * -0.0125;
+        acc += prk::simd::load(&in[(i-3)*n+(j-4)]) * -0.0017857142857142857;
+        acc += prk::simd::load(&in[(i-2)*n+(j-4)]) * -0.0017857142857142857;
+        acc += prk::simd::load(&in[(i-1)*n+(j-4)]) * -0.0017857142857142857;
+        acc += prk::simd::load(&in[(i)*n+(j-4)]) * -0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+1)*n+(j-4)]) * -0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+2)*n+(j-4)]) * -0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+3)*n+(j-4)]) * -0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+5)*n+(j-4)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-5)*n+(j-3)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-4)*n+(j-3)]) * -0.0017857142857142857;
+        acc += prk::simd::load(&in[(i-3)*n+(j-3)]) * -0.016666666666666666;
+        acc += prk::simd::load(&in[(i-2)*n+(j-3)]) * -0.0033333333333333335;
+        acc += prk::simd::load(&in[(i-1)*n+(j-3)]) * -0.0033333333333333335;
+        acc += prk::simd::load(&in[(i)*n+(j-3)]) * -0.0033333333333333335;
+        acc += prk::simd::load(&in[(i+1)*n+(j-3)]) * -0.0033333333333333335;
+        acc += prk::simd::load(&in[(i+2)*n+(j-3)]) * -0.0033333333333333335;
+        acc += prk::simd::load(&in[(i+4)*n+(j-3)]) * 0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+5)*n+(j-3)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-5)*n+(j-2)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-4)*n+(j-2)]) * -0.0017857142857142857;
+        acc += prk::simd::load(&in[(i-3)*n+(j-2)]) * -0.0033333333333333335;
+        acc += prk::simd::load(&in[(i-2)*n+(j-2)]) * -0.025;
+        acc += prk::simd::load(&in[(i-1)*n+(j-2)]) * -0.008333333333333333;
+        acc += prk::simd::load(&in[(i)*n+(j-2)]) * -0.008333333333333333;
+        acc += prk::simd::load(&in[(i+1)*n+(j-2)]) * -0.008333333333333333;
+        acc += prk::simd::load(&in[(i+3)*n+(j-2)]) * 0.0033333333333333335;
+        acc += prk::simd::load(&in[(i+4)*n+(j-2)]) * 0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+5)*n+(j-2)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-5)*n+(j-1)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-4)*n+(j-1)]) * -0.0017857142857142857;
+        acc += prk::simd::load(&in[(i-3)*n+(j-1)]) * -0.0033333333333333335;
+        acc += prk::simd::load(&in[(i-2)*n+(j-1)]) * -0.008333333333333333;
+        acc += prk::simd::load(&in[(i-1)*n+(j-1)]) * -0.05;
+        acc += prk::simd::load(&in[(i)*n+(j-1)]) * -0.05;
+        acc += prk::simd::load(&in[(i+2)*n+(j-1)]) * 0.008333333333333333;
+        acc += prk::simd::load(&in[(i+3)*n+(j-1)]) * 0.0033333333333333335;
+        acc += prk::simd::load(&in[(i+4)*n+(j-1)]) * 0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+5)*n+(j-1)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-5)*n+(j)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-4)*n+(j)]) * -0.0017857142857142857;
+        acc += prk::simd::load(&in[(i-3)*n+(j)]) * -0.0033333333333333335;
+        acc += prk::simd::load(&in[(i-2)*n+(j)]) * -0.008333333333333333;
+        acc += prk::simd::load(&in[(i-1)*n+(j)]) * -0.05;
+        acc += prk::simd::load(&in[(i+1)*n+(j)]) * 0.05;
+        acc += prk::simd::load(&in[(i+2)*n+(j)]) * 0.008333333333333333;
+        acc += prk::simd::load(&in[(i+3)*n+(j)]) * 0.0033333333333333335;
+        acc += prk::simd::load(&in[(i+4)*n+(j)]) * 0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+5)*n+(j)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-5)*n+(j+1)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-4)*n+(j+1)]) * -0.0017857142857142857;
+        acc += prk::simd::load(&in[(i-3)*n+(j+1)]) * -0.0033333333333333335;
+        acc += prk::simd::load(&in[(i-2)*n+(j+1)]) * -0.008333333333333333;
+        acc += prk::simd::load(&in[(i)*n+(j+1)]) * 0.05;
+        acc += prk::simd::load(&in[(i+1)*n+(j+1)]) * 0.05;
+        acc += prk::simd::load(&in[(i+2)*n+(j+1)]) * 0.008333333333333333;
+        acc += prk::simd::load(&in[(i+3)*n+(j+1)]) * 0.0033333333333333335;
+        acc += prk::simd::load(&in[(i+4)*n+(j+1)]) * 0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+5)*n+(j+1)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-5)*n+(j+2)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-4)*n+(j+2)]) * -0.0017857142857142857;
+        acc += prk::simd::load(&in[(i-3)*n+(j+2)]) * -0.0033333333333333335;
+        acc += prk::simd::load(&in[(i-1)*n+(j+2)]) * 0.008333333333333333;
+        acc += prk::simd::load(&in[(i)*n+(j+2)]) * 0.008333333333333333;
+        acc += prk::simd::load(&in[(i+1)*n+(j+2)]) * 0.008333333333333333;
+        acc += prk::simd::load(&in[(i+2)*n+(j+2)]) * 0.025;
+        acc += prk::simd::load(&in[(i+3)*n+(j+2)]) * 0.0033333333333333335;
+        acc += prk::simd::load(&in[(i+4)*n+(j+2)]) * 0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+5)*n+(j+2)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-5)*n+(j+3)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-4)*n+(j+3)]) * -0.0017857142857142857;
+        acc += prk::simd::load(&in[(i-2)*n+(j+3)]) * 0.0033333333333333335;
+        acc += prk::simd::load(&in[(i-1)*n+(j+3)]) * 0.0033333333333333335;
+        acc += prk::simd::load(&in[(i)*n+(j+3)]) * 0.0033333333333333335;
+        acc += prk::simd::load(&in[(i+1)*n+(j+3)]) * 0.0033333333333333335;
+        acc += prk::simd::load(&in[(i+2)*n+(j+3)]) * 0.0033333333333333335;
+        acc += prk::simd::load(&in[(i+3)*n+(j+3)]) * 0.016666666666666666;
+        acc += prk::simd::load(&in[(i+4)*n+(j+3)]) * 0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+5)*n+(j+3)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-5)*n+(j+4)]) * -0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-3)*n+(j+4)]) * 0.0017857142857142857;
+        acc += prk::simd::load(&in[(i-2)*n+(j+4)]) * 0.0017857142857142857;
+        acc += prk::simd::load(&in[(i-1)*n+(j+4)]) * 0.0017857142857142857;
+        acc += prk::simd::load(&in[(i)*n+(j+4)]) * 0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+1)*n+(j+4)]) * 0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+2)*n+(j+4)]) * 0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+3)*n+(j+4)]) * 0.0017857142857142857;
+        acc += prk::simd::load(&in[(i+4)*n+(j+4)]) * 0.0125;
+        acc += prk::simd::load(&in[(i+5)*n+(j+4)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-4)*n+(j+5)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-3)*n+(j+5)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-2)*n+(j+5)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i-1)*n+(j+5)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i)*n+(j+5)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i+1)*n+(j+5)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i+2)*n+(j+5)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i+3)*n+(j+5)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i+4)*n+(j+5)]) * 0.0011111111111111111;
+        acc += prk::simd::load(&in[(i+5)*n+(j+5)]) * 0.01;
+        prk::simd::store(&out[i*n+j], acc);
+      }
+      for (; j<n-5; ++j) {
+            out[i*n+j] += +in[(i-5)*n+(j-5)] * -0.01
+                          +in[(i-4)*n+(j-5)] * -0.0011111111111111111
+                          +in[(i-3)*n+(j-5)] * -0.0011111111111111111
+                          +in[(i-2)*n+(j-5)] * -0.0011111111111111111
+                          +in[(i-1)*n+(j-5)] * -0.0011111111111111111
+                          +in[(i)*n+(j-5)] * -0.0011111111111111111
+                          +in[(i+1)*n+(j-5)] * -0.0011111111111111111
+                          +in[(i+2)*n+(j-5)] * -0.0011111111111111111
+                          +in[(i+3)*n+(j-5)] * -0.0011111111111111111
+                          +in[(i+4)*n+(j-5)] * -0.0011111111111111111
+                          +in[(i-5)*n+(j-4)] * -0.0011111111111111111
+                          +in[(i-4)*n+(j-4)] * -0.0125
+                          +in[(i-3)*n+(j-4)] * -0.0017857142857142857
+                          +in[(i-2)*n+(j-4)] * -0.0017857142857142857
+                          +in[(i-1)*n+(j-4)] * -0.0017857142857142857
+                          +in[(i)*n+(j-4)] * -0.0017857142857142857
+                          +in[(i+1)*n+(j-4)] * -0.0017857142857142857
+                          +in[(i+2)*n+(j-4)] * -0.0017857142857142857
+                          +in[(i+3)*n+(j-4)] * -0.0017857142857142857
+                          +in[(i+5)*n+(j-4)] * 0.0011111111111111111
+                          +in[(i-5)*n+(j-3)] * -0.0011111111111111111
+                          +in[(i-4)*n+(j-3)] * -0.0017857142857142857
+                          +in[(i-3)*n+(j-3)] * -0.016666666666666666
+                          +in[(i-2)*n+(j-3)] * -0.0033333333333333335
+                          +in[(i-1)*n+(j-3)] * -0.0033333333333333335
+                          +in[(i)*n+(j-3)] * -0.0033333333333333335
+                          +in[(i+1)*n+(j-3)] * -0.0033333333333333335
+                          +in[(i+2)*n+(j-3)] * -0.0033333333333333335
+                          +in[(i+4)*n+(j-3)] * 0.0017857142857142857
+                          +in[(i+5)*n+(j-3)] * 0.0011111111111111111
+                          +in[(i-5)*n+(j-2)] * -0.0011111111111111111
+                          +in[(i-4)*n+(j-2)] * -0.0017857142857142857
+                          +in[(i-3)*n+(j-2)] * -0.0033333333333333335
+                          +in[(i-2)*n+(j-2)] * -0.025
+                          +in[(i-1)*n+(j-2)] * -0.008333333333333333
+                          +in[(i)*n+(j-2)] * -0.008333333333333333
+                          +in[(i+1)*n+(j-2)] * -0.008333333333333333
+                          +in[(i+3)*n+(j-2)] * 0.0033333333333333335
+                          +in[(i+4)*n+(j-2)] * 0.0017857142857142857
+                          +in[(i+5)*n+(j-2)] * 0.0011111111111111111
+                          +in[(i-5)*n+(j-1)] * -0.0011111111111111111
+                          +in[(i-4)*n+(j-1)] * -0.0017857142857142857
+                          +in[(i-3)*n+(j-1)] * -0.0033333333333333335
+                          +in[(i-2)*n+(j-1)] * -0.008333333333333333
+                          +in[(i-1)*n+(j-1)] * -0.05
+                          +in[(i)*n+(j-1)] * -0.05
+                          +in[(i+2)*n+(j-1)] * 0.008333333333333333
+                          +in[(i+3)*n+(j-1)] * 0.0033333333333333335
+                          +in[(i+4)*n+(j-1)] * 0.0017857142857142857
+                          +in[(i+5)*n+(j-1)] * 0.0011111111111111111
+                          +in[(i-5)*n+(j)] * -0.0011111111111111111
+                          +in[(i-4)*n+(j)] * -0.0017857142857142857
+                          +in[(i-3)*n+(j)] * -0.0033333333333333335
+                          +in[(i-2)*n+(j)] * -0.008333333333333333
+                          +in[(i-1)*n+(j)] * -0.05
+                          +in[(i+1)*n+(j)] * 0.05
+                          +in[(i+2)*n+(j)] * 0.008333333333333333
+                          +in[(i+3)*n+(j)] * 0.0033333333333333335
+                          +in[(i+4)*n+(j)] * 0.0017857142857142857
+                          +in[(i+5)*n+(j)] * 0.0011111111111111111
+                          +in[(i-5)*n+(j+1)] * -0.0011111111111111111
+                          +in[(i-4)*n+(j+1)] * -0.0017857142857142857
+                          +in[(i-3)*n+(j+1)] * -0.0033333333333333335
+                          +in[(i-2)*n+(j+1)] * -0.008333333333333333
+                          +in[(i)*n+(j+1)] * 0.05
+                          +in[(i+1)*n+(j+1)] * 0.05
+                          +in[(i+2)*n+(j+1)] * 0.008333333333333333
+                          +in[(i+3)*n+(j+1)] * 0.0033333333333333335
+                          +in[(i+4)*n+(j+1)] * 0.0017857142857142857
+                          +in[(i+5)*n+(j+1)] * 0.0011111111111111111
+                          +in[(i-5)*n+(j+2)] * -0.0011111111111111111
+                          +in[(i-4)*n+(j+2)] * -0.0017857142857142857
+                          +in[(i-3)*n+(j+2)] * -0.0033333333333333335
+                          +in[(i-1)*n+(j+2)] * 0.008333333333333333
+                          +in[(i)*n+(j+2)] * 0.008333333333333333
+                          +in[(i+1)*n+(j+2)] * 0.008333333333333333
+                          +in[(i+2)*n+(j+2)] * 0.025
+                          +in[(i+3)*n+(j+2)] * 0.0033333333333333335
+                          +in[(i+4)*n+(j+2)] * 0.0017857142857142857
+                          +in[(i+5)*n+(j+2)] * 0.0011111111111111111
+                          +in[(i-5)*n+(j+3)] * -0.0011111111111111111
+                          +in[(i-4)*n+(j+3)] * -0.0017857142857142857
+                          +in[(i-2)*n+(j+3)] * 0.0033333333333333335
+                          +in[(i-1)*n+(j+3)] * 0.0033333333333333335
+                          +in[(i)*n+(j+3)] * 0.0033333333333333335
+                          +in[(i+1)*n+(j+3)] * 0.0033333333333333335
+                          +in[(i+2)*n+(j+3)] * 0.0033333333333333335
+                          +in[(i+3)*n+(j+3)] * 0.016666666666666666
+                          +in[(i+4)*n+(j+3)] * 0.0017857142857142857
+                          +in[(i+5)*n+(j+3)] * 0.0011111111111111111
+                          +in[(i-5)*n+(j+4)] * -0.0011111111111111111
+                          +in[(i-3)*n+(j+4)] * 0.0017857142857142857
+                          +in[(i-2)*n+(j+4)] * 0.0017857142857142857
+                          +in[(i-1)*n+(j+4)] * 0.0017857142857142857
+                          +in[(i)*n+(j+4)] * 0.0017857142857142857
+                          +in[(i+1)*n+(j+4)] * 0.0017857142857142857
+                          +in[(i+2)*n+(j+4)] * 0.0017857142857142857
+                          +in[(i+3)*n+(j+4)] * 0.0017857142857142857
+                          +in[(i+4)*n+(j+4)] * 0.0125
+                          +in[(i+5)*n+(j+4)] * 0.0011111111111111111
+                          +in[(i-4)*n+(j+5)] * 0.0011111111111111111
+                          +in[(i-3)*n+(j+5)] * 0.0011111111111111111
+                          +in[(i-2)*n+(j+5)] * 0.0011111111111111111
+                          +in[(i-1)*n+(j+5)] * 0.0011111111111111111
+                          +in[(i)*n+(j+5)] * 0.0011111111111111111
+                          +in[(i+1)*n+(j+5)] * 0.0011111111111111111
+                          +in[(i+2)*n+(j+5)] * 0.0011111111111111111
+                          +in[(i+3)*n+(j+5)] * 0.0011111111111111111
+                          +in[(i+4)*n+(j+5)] * 0.0011111111111111111
+                          +in[(i+5)*n+(j+5)] * 0.01
+                          ;
+      }
+    }
+}
+
@@ -37,6 +37,57 @@ void star1(cl::sycl::queue & q, const size_t n, cl::sycl::buffer<T, 2> & d_in, c
   });
 }
 
+// declare the kernel name used in SYCL parallel_for
+template <typename T> class star1_1d_ndr;
+
+template <typename T>
+void star1(cl::sycl::queue & q, const size_t n, cl::sycl::range<2> lws, cl::sycl::buffer<T> & d_in, cl::sycl::buffer<T> & d_out)
+{
+  const size_t g0 = lws[0] * prk::divceil(n-2, lws[0]);
+  const size_t g1 = lws[1] * prk::divceil(n-2, lws[1]);
+  q.submit([&](cl::sycl::handler& h) {
+    auto in  = d_in.template get_access<cl::sycl::access::mode::read>(h);
+    auto out = d_out.template get_access<cl::sycl::access::mode::read_write>(h);
+    h.parallel_for<class star1_1d_ndr<T>>(cl::sycl::nd_range<2> {cl::sycl::range<2> {g0,g1}, lws}, [=] (cl::sycl::nd_item<2> it) {
+        const size_t i = it.get_global_id(0) + 1;
+        const size_t j = it.get_global_id(1) + 1;
+        if ( (i<n-1) && (j<n-1) ) {
+        out[i*n+j] += +in[i*n+(j+1)] * static_cast<T>(0.5)
+                              +in[i*n+(j-1)] * static_cast<T>(-0.5)
+                              +in[(i+1)*n+j] * static_cast<T>(0.5)
+                              +in[(i-1)*n+j] * static_cast<T>(-0.5);
+        }
+    });
+  });
+}
+
+// declare the kernel name used in SYCL parallel_for
+template <typename T> class star1_2d_ndr;
+
+template <typename T>
+void star1(cl::sycl::queue & q, const size_t n, cl::sycl::range<2> lws, cl::sycl::buffer<T, 2> & d_in, cl::sycl::buffer<T, 2> & d_out)
+{
+  const size_t g0 = lws[0] * prk::divceil(n-2, lws[0]);
+  const size_t g1 = lws[1] * prk::divceil(n-2, lws[1]);
+  q.submit([&](cl::sycl::handler& h) {
+    auto in  = d_in.template get_access<cl::sycl::access::mode::read>(h);
+    auto out = d_out.template get_access<cl::sycl::access::mode::read_write>(h);
+    cl::sycl::id<2> dx1(cl::sycl::range<2> {1,0});
+    cl::sycl::id<2> dy1(cl::sycl::range<2> {0,1});
+    h.parallel_for<class star1_2d_ndr<T>>(cl::sycl::nd_range<2> {cl::sycl::range<2> {g0,g1}, lws}, [=] (cl::sycl::nd_item<2> it) {
+        const size_t i = it.get_global_id(0) + 1;
+        const size_t j = it.get_global_id(1) + 1;
+        if ( (i<n-1) && (j<n-1) ) {
+        cl::sycl::id<2> xy(i,j);
+        out[xy] += +in[xy+dx1] * static_cast<T>(0.5)
+                   +in[xy-dx1] * static_cast<T>(-0.5)
+                   +in[xy+dy1] * static_cast<T>(0.5)
+                   +in[xy-dy1] * static_cast<T>(-0.5);
+        }
+    });
+  });
+}
+
 // declare the kernel name used in SYCL parallel_for
 template <typename T> class star2_1d;
 
@@ -86,6 +137,67 @@ void star2(cl::sycl::queue & q, const size_t n, cl::sycl::buffer<T, 2> & d_in, c
   });
 }
 
+// declare the kernel name used in SYCL parallel_for
+template <typename T> class star2_1d_ndr;
+
+template <typename T>
+void star2(cl::sycl::queue & q, const size_t n, cl::sycl::range<2> lws, cl::sycl::buffer<T> & d_in, cl::sycl::buffer<T> & d_out)
+{
+  const size_t g0 = lws[0] * prk::divceil(n-4, lws[0]);
+  const size_t g1 = lws[1] * prk::divceil(n-4, lws[1]);
+  q.submit([&](cl::sycl::handler& h) {
+    auto in  = d_in.template get_access<cl::sycl::access::mode::read>(h);
+    auto out = d_out.template get_access<cl::sycl::access::mode::read_write>(h);
+    h.parallel_for<class star2_1d_ndr<T>>(cl::sycl::nd_range<2> {cl::sycl::range<2> {g0,g1}, lws}, [=] (cl::sycl::nd_item<2> it) {
+        const size_t i = it.get_global_id(0) + 2;
+        const size_t j = it.get_global_id(1) + 2;
+        if ( (i<n-2) && (j<n-2) ) {
+        out[i*n+j] += +in[i*n+(j+1)] * static_cast<T>(0.25)
+                              +in[i*n+(j-1)] * static_cast<T>(-0.25)
+                              +in[(i+1)*n+j] * static_cast<T>(0.25)
+                              +in[(i-1)*n+j] * static_cast<T>(-0.25)
+                              +in[i*n+(j+2)] * static_cast<T>(0.125)
+                              +in[i*n+(j-2)] * static_cast<T>(-0.125)
+                              +in[(i+2)*n+j] * static_cast<T>(0.125)
+                              +in[(i-2)*n+j] * static_cast<T>(-0.125);
+        }
+    });
+  });
+}
+
+// declare the kernel name used in SYCL parallel_for
+template <typename T> class star2_2d_ndr;
+
+template <typename T>
+void star2(cl::sycl::queue & q, const size_t n, cl::sycl::range<2> lws, cl::sycl::buffer<T, 2> & d_in, cl::sycl::buffer<T, 2> & d_out)
+{
+  const size_t g0 = lws[0] * prk::divceil(n-4, lws[0]);
+  const size_t g1 = lws[1] * prk::divceil(n-4, lws[1]);
+  q.submit([&](cl::sycl::handler& h) {
+    auto in  = d_in.template get_access<cl::sycl::access::mode::read>(h);
+    auto out = d_out.template get_access<cl::sycl::access::mode::read_write>(h);
+    cl::sycl::id<2> dx1(cl::sycl::range<2> {1,0});
+    cl::sycl::id<2> dy1(cl::sycl::range<2> {0,1});
+    cl::sycl::id<2> dx2(cl::sycl::range<2> {2,0});
+    cl::sycl::id<2> dy2(cl::sycl::range<2> {0,2});
+    h.parallel_for<class star2_2d_ndr<T>>(cl::sycl::nd_range<2> {cl::sycl::range<2> {g0,g1}, lws}, [=] (cl::sycl::nd_item<2> it) {
+        const size_t i = it.get_global_id(0) + 2;
+        const size_t j = it.get_global_id(1) + 2;
+        if ( (i<n-2) && (j<n-2) ) {
+        cl::sycl::id<2> xy(i,j);
+        out[xy] += +in[xy+dx1] * static_cast<T>(0.25)
+                   +in[xy-dx1] * static_cast<T>(-0.25)
+                   +in[xy+dy1] * static_cast<T>(0.25)
+                   +in[xy-dy1] * static_cast<T>(-0.25)
+                   +in[xy+dx2] * static_cast<T>(0.125)
+                   +in[xy-dx2] * static_cast<T>(-0.125)
+                   +in[xy+dy2] * static_cast<T>(0.125)
+                   +in[xy-dy2] * static_cast<T>(-0.125);
+        }
+    });
+  });
+}
+
 // declare the kernel name used in SYCL parallel_for
 template <typename T> class star3_1d;
 
@@ -145,6 +257,77 @@ void star3(cl::sycl::queue & q, const size_t n, cl::sycl::buffer<T, 2> & d_in, c
   });
 }
 
+// declare the kernel name used in SYCL parallel_for
+template <typename T> class star3_1d_ndr;
+
+template <typename T>
+void star3(cl::sycl::queue & q, const size_t n, cl::sycl::range<2> lws, cl::sycl::buffer<T> & d_in, cl::sycl::buffer<T> & d_out)
+{
+  const size_t g0 = lws[0] * prk::divceil(n-6, lws[0]);
+  const size_t g1 = lws[1] * prk::divceil(n-6, lws[1]);
+  q.submit([&](cl::sycl::handler& h) {
+    auto in  = d_in.template get_access<cl::sycl::access::mode::read>(h);
+    auto out = d_out.template get_access<cl::sycl::access::mode::read_write>(h);
+    h.parallel_for<class star3_1d_ndr<T>>(cl::sycl::nd_range<2> {cl::sycl::range<2> {g0,g1}, lws}, [=] (cl::sycl::nd_item<2> it) {
+        const size_t i = it.get_global_id(0) + 3;
+        const size_t j = it.get_global_id(1) + 3;
+        if ( (i<n-3) && (j<n-3) ) {
+        out[i*n+j] += +in[i*n+(j+1)] * static_cast<T>(0.16666666666666666)
+                              +in[i*n+(j-1)] * static_cast<T>(-0.16666666666666666)
+                              +in[(i+1)*n+j] * static_cast<T>(0.16666666666666666)
+                              +in[(i-1)*n+j] * static_cast<T>(-0.16666666666666666)
+                              +in[i*n+(j+2)] * static_cast<T>(0.08333333333333333)
+                              +in[i*n+(j-2)] * static_cast<T>(-0.08333333333333333)
+                              +in[(i+2)*n+j] * static_cast<T>(0.08333333333333333)
+                              +in[(i-2)*n+j] * static_cast<T>(-0.08333333333333333)
+                              +in[i*n+(j+3)] * static_cast<T>(0.05555555555555555)
+                              +in[i*n+(j-3)] * static_cast<T>(-0.05555555555555555)
+                              +in[(i+3)*n+j] * static_cast<T>(0.05555555555555555)
+                              +in[(i-3)*n+j] * static_cast<T>(-0.05555555555555555);
+        }
+    });
+  });
+}
+
+// declare the kernel name used in SYCL parallel_for
+template <typename T> class star3_2d_ndr;
+
+template <typename T>
+void star3(cl::sycl::queue & q, const size_t n, cl::sycl::range<2> lws, cl::sycl::buffer<T, 2> & d_in, cl::sycl::buffer<T, 2> & d_out)
+{
+  const size_t g0 = lws[0] * prk::divceil(n-6, lws[0]);
+  const size_t g1 = lws[1] * prk::divceil(n-6, lws[1]);
+  q.submit([&](cl::sycl::handler& h) {
+    auto in  = d_in.template get_access<cl::sycl::access::mode::read>(h);
+    auto out = d_out.template get_access<cl::sycl::access::mode::read_write>(h);
+    cl::sycl::id<2> dx1(cl::sycl::range<2> {1,0});
+    cl::sycl::id<2> dy1(cl::sycl::range<2> {0,1});
+    cl::sycl::id<2> dx2(cl::sycl::range<2> {2,0});
+    cl::sycl::id<2> dy2(cl::sycl::range<2> {0,2});
+    cl::sycl::id<2> dx3(cl::sycl::range<2> {3,0});
+    cl::sycl::id<2> dy3(cl::sycl::range<2> {0,3});
+    h.parallel_for<class star3_2d_ndr<T>>(cl::sycl::nd_range<2> {cl::sycl::range<2> {g0,g1}, lws}, [=] (cl::sycl::nd_item<2> it) {
+        const size_t i = it.get_global_id(0) + 3;
+        const size_t j = it.get_global_id(1) + 3;
+        if ( (i<n-3) && (j<n-3) ) {
+        cl::sycl::id<2> xy(i,j);
+        out[xy] += +in[xy+dx1] * static_cast<T>(0.16666666666666666)
+                   +in[xy-dx1] * static_cast<T>(-0.16666666666666666)
+                   +in[xy+dy1] * static_cast<T>(0.16666666666666666)
+                   +in[xy-dy1] * static_cast<T>(-0.16666666666666666)
+                   +in[xy+dx2] * static_cast<T>(0.08333333333333333)
+                   +in[xy-dx2] * static_cast<T>(-0.08333333333333333)
+                   +in[xy+dy2] * static_cast<T>(0.08333333333333333)
+                   +in[xy-dy2] * static_cast<T>(-0.08333333333333333)
+                   +in[xy+dx3] * static_cast<T>(0.05555555555555555)
+                   +in[xy-dx3] * static_cast<T>(-0.05555555555555555)
+                   +in[xy+dy3] * static_cast<T>(0.05555555555555555)
+                   +in[xy-dy3] * static_cast<T>(-0.05555555555555555);
+        }
+    });
+  });
+}
+
 // declare the kernel name used in SYCL parallel_for
 template <typename T> class star4_1d;
 
@@ -214,6 +397,87 @@ void star4(cl::sycl::queue & q, const size_t n, cl::sycl::buffer<T, 2> & d_in, c
   });
 }
 
+// declare the kernel name used in SYCL parallel_for
+template <typename T> class star4_1d_ndr;
+
+template <typename T>
+void star4(cl::sycl::queue & q, const size_t n, cl::sycl::range<2> lws, cl::sycl::buffer<T> & d_in, cl::sycl::buffer<T> & d_out)
+{
+  const size_t g0 = lws[0] * prk::divceil(n-8, lws[0]);
+  const size_t g1 = lws[1] * prk::divceil(n-8, lws[1]);
+  q.submit([&](cl::sycl::handler& h) {
+    auto in  = d_in.template get_access<cl::sycl::access::mode::read>(h);
+    auto out = d_out.template get_access<cl::sycl::access::mode::read_write>(h);
+    h.parallel_for<class star4_1d_ndr<T>>(cl::sycl::nd_range<2> {cl::sycl::range<2> {g0,g1}, lws}, [=] (cl::sycl::nd_item<2> it) {
+        const size_t i = it.get_global_id(0) + 4;
+        const size_t j = it.get_global_id(1) + 4;
+        if ( (i<n-4) && (j<n-4) ) {
+        out[i*n+j] += +in[i*n+(j+1)] * static_cast<T>(0.125)
+                              +in[i*n+(j-1)] * static_cast<T>(-0.125)
+                              +in[(i+1)*n+j] * static_cast<T>(0.125)
+                              +in[(i-1)*n+j] * static_cast<T>(-0.125)
+                              +in[i*n+(j+2)] * static_cast<T>(0.0625)
+                              +in[i*n+(j-2)] * static_cast<T>(-0.0625)
+                              +in[(i+2)*n+j] * static_cast<T>(0.0625)
+                              +in[(i-2)*n+j] * static_cast<T>(-0.0625)
+                              +in[i*n+(j+3)] * static_cast<T>(0.041666666666666664)
+                              +in[i*n+(j-3)] * static_cast<T>(-0.041666666666666664)
+                              +in[(i+3)*n+j] * static_cast<T>(0.041666666666666664)
+                              +in[(i-3)*n+j] * static_cast<T>(-0.041666666666666664)
+                              +in[i*n+(j+4)] * static_cast<T>(0.03125)
+                              +in[i*n+(j-4)] * static_cast<T>(-0.03125)
+                              +in[(i+4)*n+j] * static_cast<T>(0.03125)
+                              +in[(i-4)*n+j] * static_cast<T>(-0.03125);
+        }
+    });
+  });
+}
+
+// declare the kernel name used in SYCL parallel_for
+template <typename T> class star4_2d_ndr;
+
+template <typename T>
+void star4(cl::sycl::queue & q, const size_t n, cl::sycl::range<2> lws, cl::sycl::buffer<T, 2> & d_in, cl::sycl::buffer<T, 2> & d_out)
+{
+  const size_t g0 = lws[0] * prk::divceil(n-8, lws[0]);
+  const size_t g1 = lws[1] * prk::divceil(n-8, lws[1]);
+  q.submit([&](cl::sycl::handler& h) {
+    auto in  = d_in.template get_access<cl::sycl::access::mode::read>(h);
+    auto out = d_out.template get_access<cl::sycl::access::mode::read_write>(h);
+    cl::sycl::id<2> dx1(cl::sycl::range<2> {1,0});
+    cl::sycl::id<2> dy1(cl::sycl::range<2> {0,1});
+    cl::sycl::id<2> dx2(cl::sycl::range<2> {2,0});
+    cl::sycl::id<2> dy2(cl::sycl::range<2> {0,2});
+    cl::sycl::id<2> dx3(cl::sycl::range<2> {3,0});
+    cl::sycl::id<2> dy3(cl::sycl::range<2> {0,3});
+    cl::sycl::id<2> dx4(cl::sycl::range<2> {4,0});
+    cl::sycl::id<2> dy4(cl::sycl::range<2> {0,4});
+    h.parallel_for<class star4_2d_ndr<T>>(cl::sycl::nd_range<2> {cl::sycl::range<2> {g0,g1}, lws}, [=] (cl::sycl::nd_item<2> it) {
+        const size_t i = it.get_global_id(0) + 4;
+        const size_t j = it.get_global_id(1) + 4;
+        if ( (i<n-4) && (j<n-4) ) {
+        cl::sycl::id<2> xy(i,j);
+        out[xy] += +in[xy+dx1] * static_cast<T>(0.125)
+                   +in[xy-dx1] * static_cast<T>(-0.125)
+                   +in[xy+dy1] * static_cast<T>(0.125)
+                   +in[xy-dy1] * static_cast<T>(-0.125)
+                   +in[xy+dx2] * static_cast<T>(0.0625)
+                   +in[xy-dx2] * static_cast<T>(-0.0625)
+                   +in[xy+dy2] * static_cast<T>(0.0625)
+                   +in[xy-dy2] * static_cast<T>(-0.0625)
+                   +in[xy+dx3] * static_cast<T>(0.041666666666666664)
+                   +in[xy-dx3] * static_cast<T>(-0.041666666666666664)
+                   +in[xy+dy3] * static_cast<T>(0.041666666666666664)
+                   +in[xy-dy3] * static_cast<T>(-0.041666666666666664)
+                   +in[xy+dx4] * static_cast<T>(0.03125)
+                   +in[xy-dx4] * static_cast<T>(-0.03125)
+                   +in[xy+dy4] * static_cast<T>(0.03125)
+                   +in[xy-dy4] * static_cast<T>(-0.03125);
+        }
+    });
+  });
+}
+
 // declare the kernel name used in SYCL parallel_for
 template <typename T> class star5_1d;
 
@@ -293,3 +557,94 @@ void star5(cl::sycl::queue & q, const size_t n, cl::sycl::buffer<T, 2> & d_in, c
   });
 }
 
+// declare the kernel name used in SYCL parallel_for
+template <typename T> class star5_1d_ndr;
+
+template <typename T>
+void star5(cl::sycl::queue & q, const size_t n, cl::sycl::range<2> lws, cl::sycl::buffer<T> & d_in, cl::sycl::buffer<T> & d_out)
+{
+  const size_t g0 = lws[0] * prk::divceil(n-10, lws[0]);
+  const size_t g1 = lws[1] * prk::divceil(n-10, lws[1]);
+  q.submit([&](cl::sycl::handler& h) {
+    auto in  = d_in.template get_access<cl::sycl::access::mode::read>(h);
+    auto out = d_out.template get_access<cl::sycl::access::mode::read_write>(h);
+    h.parallel_for<class star5_1d_ndr<T>>(cl::sycl::nd_range<2> {cl::sycl::range<2> {g0,g1}, lws}, [=] (cl::sycl::nd_item<2> it) {
+        const size_t i = it.get_global_id(0) + 5;
+        const size_t j = it.get_global_id(1) + 5;
+        if ( (i<n-5) && (j<n-5) ) {
+        out[i*n+j] += +in[i*n+(j+1)] * static_cast<T>(0.1)
+                              +in[i*n+(j-1)] * static_cast<T>(-0.1)
+                              +in[(i+1)*n+j] * static_cast<T>(0.1)
+                              +in[(i-1)*n+j] * static_cast<T>(-0.1)
+                              +in[i*n+(j+2)] * static_cast<T>(0.05)
+                              +in[i*n+(j-2)] * static_cast<T>(-0.05)
+                              +in[(i+2)*n+j] * static_cast<T>(0.05)
+                              +in[(i-2)*n+j] * static_cast<T>(-0.05)
+                              +in[i*n+(j+3)] * static_cast<T>(0.03333333333333333)
+                              +in[i*n+(j-3)] * static_cast<T>(-0.03333333333333333)
+                              +in[(i+3)*n+j] * static_cast<T>(0.03333333333333333)
+                              +in[(i-3)*n+j] * static_cast<T>(-0.03333333333333333)
+                              +in[i*n+(j+4)] * static_cast<T>(0.025)
+                              +in[i*n+(j-4)] * static_cast<T>(-0.025)
+                              +in[(i+4)*n+j] * static_cast<T>(0.025)
+                              +in[(i-4)*n+j] * static_cast<T>(-0.025)
+                              +in[i*n+(j+5)] * static_cast<T>(0.02)
+                              +in[i*n+(j-5)] * static_cast<T>(-0.02)
+                              +in[(i+5)*n+j] * static_cast<T>(0.02)
+                              +in[(i-5)*n+j] * static_cast<T>(-0.02);
+        }
+    });
+  });
+}
+
+// declare the kernel name used in SYCL parallel_for
+template <typename T> class star5_2d_ndr;
+
+template <typename T>
+void star5(cl::sycl::queue & q, const size_t n, cl::sycl::range<2> lws, cl::sycl::buffer<T, 2> & d_in, cl::sycl::buffer<T, 2> & d_out)
+{
+  const size_t g0 = lws[0] * prk::divceil(n-10, lws[0]);
+  const size_t g1 = lws[1] * prk::divceil(n-10, lws[1]);
+  q.submit([&](cl::sycl::handler& h) {
+    auto in  = d_in.template get_access<cl::sycl::access::mode::read>(h);
+    auto out = d_out.template get_access<cl::sycl::access::mode::read_write>(h);
+    cl::sycl::id<2> dx1(cl::sycl::range<2> {1,0});
+    cl::sycl::id<2> dy1(cl::sycl::range<2> {0,1});
+    cl::sycl::id<2> dx2(cl::sycl::range<2> {2,0});
+    cl::sycl::id<2> dy2(cl::sycl::range<2> {0,2});
+    cl::sycl::id<2> dx3(cl::sycl::range<2> {3,0});
+    cl::sycl::id<2> dy3(cl::sycl::range<2> {0,3});
+    cl::sycl::id<2> dx4(cl::sycl::range<2> {4,0});
+    cl::sycl::id<2> dy4(cl::sycl::range<2> {0,4});
+    cl::sycl::id<2> dx5(cl::sycl::range<2> {5,0});
+    cl::sycl::id<2> dy5(cl::sycl::range<2> {0,5});
+    h.parallel_for<class star5_2d_ndr<T>>(cl::sycl::nd_range<2> {cl::sycl::range<2> {g0,g1}, lws}, [=] (cl::sycl::nd_item<2> it) {
+        const size_t i = it.get_global_id(0) + 5;
+        const size_t j = it.get_global_id(1) + 5;
+        if ( (i<n-5) && (j<n-5) ) {
+        cl::sycl::id<2> xy(i,j);
+        out[xy] += +in[xy+dx1] * static_cast<T>(0.1)
+                   +in[xy-dx1] * static_cast<T>(-0.1)
+                   +in[xy+dy1] * static_cast<T>(0.1)
+                   +in[xy-dy1] * static_cast<T>(-0.1)
+                   +in[xy+dx2] * static_cast<T>(0.05)
+                   +in[xy-dx2] * static_cast<T>(-0.05)
+                   +in[xy+dy2] * static_cast<T>(0.05)
+                   +in[xy-dy2] * static_cast<T>(-0.05)
+                   +in[xy+dx3] * static_cast<T>(0.03333333333333333)
+                   +in[xy-dx3] * static_cast<T>(-0.03333333333333333)
+                   +in[xy+dy3] * static_cast<T>(0.03333333333333333)
+                   +in[xy-dy3] * static_cast<T>(-0.03333333333333333)
+                   +in[xy+dx4] * static_cast<T>(0.025)
+                   +in[xy-dx4] * static_cast<T>(-0.025)
+                   +in[xy+dy4] * static_cast<T>(0.025)
+                   +in[xy-dy4] * static_cast<T>(-0.025)
+                   +in[xy+dx5] * static_cast<T>(0.02)
+                   +in[xy-dx5] * static_cast<T>(-0.02)
+                   +in[xy+dy5] * static_cast<T>(0.02)
+                   +in[xy-dy5] * static_cast<T>(-0.02);
+        }
+    });
+  });
+}
+
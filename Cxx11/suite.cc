@@ -0,0 +1,198 @@
+///
+/// Copyright (c) 2020, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    suite
+///
+/// PURPOSE: To run a configured sequence of PRK kernels inside one
+///          process, so that a full characterization pays process
+///          startup, page-table setup, and allocator warmup once
+///          instead of once per kernel invocation.
+///
+/// USAGE:   The program takes either a run file with one kernel
+///          invocation per line ('#' starts a comment), or an inline
+///          sequence with ':' separating invocations
+///
+///          <progname> <runfile>
+///          <progname> <kernel> <args...> [: <kernel> <args...>]...
+///
+///          e.g. suite nstream 10 16777216 : transpose 10 1024 32
+///
+///          The kernels are the regular single-kernel programs
+///          (nstream, transpose, stencil, p2p, dgemm), compiled with
+///          their main() renamed and linked into this binary; each
+///          entry prints its usual output and the suite appends one
+///          consolidated pass/fail and timing report.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+
+#include <fstream>
+
+// the kernel translation units are compiled with -Dmain=prk_<name>_main
+int prk_nstream_main(int argc, char * argv[]);
+int prk_transpose_main(int argc, char * argv[]);
+int prk_stencil_main(int argc, char * argv[]);
+int prk_p2p_main(int argc, char * argv[]);
+int prk_dgemm_main(int argc, char * argv[]);
+
+namespace {
+
+    struct suite_entry {
+        const char * name;
+        int (*entry)(int argc, char * argv[]);
+    };
+
+    const suite_entry suite_table[] = {
+        { "nstream",   prk_nstream_main   },
+        { "transpose", prk_transpose_main },
+        { "stencil",   prk_stencil_main   },
+        { "p2p",       prk_p2p_main       },
+        { "dgemm",     prk_dgemm_main     },
+    };
+
+    struct suite_result {
+        std::string invocation;
+        int status;
+        double seconds;
+    };
+
+    // dispatch one tokenized invocation to its renamed main()
+    int invoke(const std::vector<std::string> & tokens)
+    {
+        for (auto & e : suite_table) {
+            if (tokens[0] == e.name) {
+                std::vector<char*> argv;
+                for (auto & t : tokens) {
+                    argv.push_back(const_cast<char*>(t.c_str()));
+                }
+                argv.push_back(nullptr);
+                return e.entry(static_cast<int>(tokens.size()), argv.data());
+            }
+        }
+        std::cout << "ERROR: unknown kernel '" << tokens[0] << "'" << std::endl;
+        return 1;
+    }
+
+    std::string join(const std::vector<std::string> & tokens)
+    {
+        std::string s;
+        for (auto & t : tokens) {
+            if (!s.empty()) s += ' ';
+            s += t;
+        }
+        return s;
+    }
+}
+
+int main(int argc, char * argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+  std::cout << "C++11 in-process kernel suite" << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  std::vector<std::vector<std::string>> sequence;
+  try {
+      if (argc < 2) {
+        throw "Usage: <runfile> | <kernel> <args...> [: <kernel> <args...>]...";
+      }
+
+      std::ifstream runfile(argv[1]);
+      if (argc == 2 && runfile.good()) {
+        std::string line;
+        while (std::getline(runfile, line)) {
+          const auto hash = line.find('#');
+          if (hash != std::string::npos) line.erase(hash);
+          std::istringstream iss(line);
+          std::vector<std::string> tokens;
+          std::string token;
+          while (iss >> token) tokens.push_back(token);
+          if (!tokens.empty()) sequence.push_back(tokens);
+        }
+      } else {
+        std::vector<std::string> tokens;
+        for (int a=1; a<argc; a++) {
+          if (std::string(argv[a]) == ":") {
+            if (!tokens.empty()) sequence.push_back(tokens);
+            tokens.clear();
+          } else {
+            tokens.push_back(argv[a]);
+          }
+        }
+        if (!tokens.empty()) sequence.push_back(tokens);
+      }
+
+      if (sequence.empty()) {
+        throw "ERROR: no kernel invocations found";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+  std::cout << "Number of invocations = " << sequence.size() << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  /// Run the sequence and emit the consolidated report
+  //////////////////////////////////////////////////////////////////////
+
+  std::vector<suite_result> results;
+  const double suite_start = prk::wtime();
+  for (auto & tokens : sequence) {
+    std::cout << "\n=== " << join(tokens) << " ===" << std::endl;
+    const double t0 = prk::wtime();
+    const int status = invoke(tokens);
+    results.push_back({join(tokens), status, prk::wtime()-t0});
+    // the finished kernel's buffers are all dead here; with PRK_ARENA
+    // set, rewinding lets the next invocation reuse the same pages
+    prk::arena::reset();
+  }
+  const double suite_time = prk::wtime() - suite_start;
+
+  std::cout << "\nSuite report:" << std::endl;
+  int failures(0);
+  for (auto & r : results) {
+    if (r.status != 0) failures++;
+    std::cout << "  " << (r.status == 0 ? "PASS" : "FAIL")
+              << "  " << r.invocation
+              << "  (" << r.seconds << " s)" << std::endl;
+  }
+  std::cout << results.size()-failures << " of " << results.size()
+            << " invocations passed in " << suite_time << " s" << std::endl;
+
+  return (failures > 0);
+}
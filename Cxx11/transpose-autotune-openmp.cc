@@ -0,0 +1,297 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of Intel Corporation nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    transpose
+///
+/// PURPOSE: This program measures the time for the transpose of a
+///          column-major stored matrix into a row-major stored matrix.
+///
+/// USAGE:   Program input is the matrix order and the number of times to
+///          repeat the operation:
+///
+///          transpose <# iterations> <matrix_size> [probe iterations]
+///
+///          Unlike transpose-openmp, the tile size and loop order are
+///          not inputs: the harness probes a set of candidate loop
+///          nests with short runs at startup and then executes the
+///          timed region with the fastest one, reporting the chosen
+///          configuration.  Unroll and vector factors are left to the
+///          compiler via the SIMD pragmas, as everywhere else in the
+///          C++11 suite.
+///
+///          The output consists of diagnostics to make sure the
+///          transpose worked and timing statistics.
+///
+/// HISTORY: Written by  Rob Van der Wijngaart, February 2009.
+///          Converted to C++11 by Jeff Hammond, February 2016 and May 2017.
+///          Autotuned variant selection added later.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+
+// One candidate configuration for the transpose loop nest.  A tile
+// size equal to the matrix order means no tiling; write_contiguous
+// selects whether the outer loop walks the rows of B (streaming
+// writes) or the rows of A (streaming reads).
+struct variant {
+  int tile_size;
+  bool write_contiguous;
+};
+
+static void init(const int order, double * RESTRICT A, double * RESTRICT B)
+{
+  OMP_PARALLEL()
+  {
+    OMP_FOR()
+    for (auto i=0;i<order; i++) {
+      PRAGMA_SIMD
+      for (auto j=0;j<order;j++) {
+        A[i*order+j] = static_cast<double>(i*order+j);
+        B[i*order+j] = 0.0;
+      }
+    }
+  }
+}
+
+// Runs the warmup iteration plus `iterations` timed ones with the
+// given variant and returns the time of the timed part, exactly as
+// the hand-tuned kernels measure it.
+static double run(const int order, const int iterations, const variant v,
+                  double * RESTRICT A, double * RESTRICT B)
+{
+  double trans_time(0);
+  const int tile_size = std::min(v.tile_size, order);
+
+  OMP_PARALLEL()
+  {
+    for (auto iter = 0; iter<=iterations; iter++) {
+
+      if (iter==1) {
+          OMP_BARRIER
+          OMP_MASTER
+          trans_time = prk::wtime();
+      }
+
+      if (tile_size < order) {
+        if (v.write_contiguous) {
+          OMP_FOR()
+          for (auto it=0; it<order; it+=tile_size) {
+            for (auto jt=0; jt<order; jt+=tile_size) {
+              for (auto i=it; i<std::min(order,it+tile_size); i++) {
+                PRAGMA_SIMD
+                for (auto j=jt; j<std::min(order,jt+tile_size); j++) {
+                  B[i*order+j] += A[j*order+i];
+                  A[j*order+i] += 1.0;
+                }
+              }
+            }
+          }
+        } else {
+          OMP_FOR()
+          for (auto jt=0; jt<order; jt+=tile_size) {
+            for (auto it=0; it<order; it+=tile_size) {
+              for (auto j=jt; j<std::min(order,jt+tile_size); j++) {
+                PRAGMA_SIMD
+                for (auto i=it; i<std::min(order,it+tile_size); i++) {
+                  B[i*order+j] += A[j*order+i];
+                  A[j*order+i] += 1.0;
+                }
+              }
+            }
+          }
+        }
+      } else {
+        if (v.write_contiguous) {
+          OMP_FOR()
+          for (auto i=0;i<order; i++) {
+            PRAGMA_SIMD
+            for (auto j=0;j<order;j++) {
+              B[i*order+j] += A[j*order+i];
+              A[j*order+i] += 1.0;
+            }
+          }
+        } else {
+          OMP_FOR()
+          for (auto j=0;j<order; j++) {
+            PRAGMA_SIMD
+            for (auto i=0;i<order;i++) {
+              B[i*order+j] += A[j*order+i];
+              A[j*order+i] += 1.0;
+            }
+          }
+        }
+      }
+    }
+    OMP_BARRIER
+    OMP_MASTER
+    trans_time = prk::wtime() - trans_time;
+  }
+  return trans_time;
+}
+
+int main(int argc, char * argv[])
+{
+  std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+#ifdef _OPENMP
+  std::cout << "C++11/OpenMP Matrix transpose: B = A^T (autotuned)" << std::endl;
+#else
+  std::cout << "C++11 Matrix transpose: B = A^T (autotuned)" << std::endl;
+#endif
+
+  //////////////////////////////////////////////////////////////////////
+  // Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations;
+  int order;
+  int probe_iterations;
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <matrix order> [probe iterations]";
+      }
+
+      // number of times to do the transpose
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      // order of a the matrix
+      order = std::atoi(argv[2]);
+      if (order <= 0) {
+        throw "ERROR: Matrix Order must be greater than 0";
+      } else if (order > std::floor(std::sqrt(INT_MAX))) {
+        throw "ERROR: matrix dimension too large - overflow risk";
+      }
+
+      // timed iterations per probe run during the search
+      probe_iterations = (argc>3) ? std::atoi(argv[3]) : 2;
+      if (probe_iterations < 1) {
+        throw "ERROR: probe iterations must be >= 1";
+      }
+  }
+  catch (const char * e) {
+    std::cout << e << std::endl;
+    return 1;
+  }
+
+#ifdef _OPENMP
+  std::cout << "Number of threads    = " << omp_get_max_threads() << std::endl;
+#endif
+  std::cout << "Number of iterations = " << iterations << std::endl;
+  std::cout << "Matrix order         = " << order << std::endl;
+  std::cout << "Probe iterations     = " << probe_iterations << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  /// Allocate space for the input and transpose matrix
+  //////////////////////////////////////////////////////////////////////
+
+  double * RESTRICT A = new double[order*order];
+  double * RESTRICT B = new double[order*order];
+
+  //////////////////////////////////////////////////////////////////////
+  /// Search the candidate loop nests with short probe runs
+  //////////////////////////////////////////////////////////////////////
+
+  std::vector<variant> candidates;
+  for (int t : {8, 16, 32, 64, 128}) {
+    if (t >= order) break;
+    candidates.push_back({t, true});
+    candidates.push_back({t, false});
+  }
+  // untiled loop nests
+  candidates.push_back({order, true});
+  candidates.push_back({order, false});
+
+  variant best = candidates.front();
+  double best_time = -1.0;
+  for (auto & v : candidates) {
+    // reinitialize so every probe touches data in the same state
+    init(order, A, B);
+    double t = run(order, probe_iterations, v, A, B);
+    if (best_time < 0.0 || t < best_time) {
+      best_time = t;
+      best = v;
+    }
+  }
+
+  std::cout << "Variants searched    = " << candidates.size() << std::endl;
+  std::cout << "Tuned tile size      = " << std::min(best.tile_size, order)
+            << ((best.tile_size >= order) ? " (untiled)" : "") << std::endl;
+  std::cout << "Tuned loop order     = "
+            << (best.write_contiguous ? "B rows outer (contiguous writes)"
+                                      : "A rows outer (contiguous reads)") << std::endl;
+
+  //////////////////////////////////////////////////////////////////////
+  /// Do the transpose with the chosen variant
+  //////////////////////////////////////////////////////////////////////
+
+  init(order, A, B);
+  double trans_time = run(order, iterations, best, A, B);
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  const auto addit = (iterations+1.) * (iterations/2.);
+  auto abserr = 0.0;
+  OMP_PARALLEL_FOR_REDUCE( +:abserr )
+  for (auto j=0; j<order; j++) {
+    for (auto i=0; i<order; i++) {
+      const int ij = i*order+j;
+      const int ji = j*order+i;
+      const double reference = static_cast<double>(ij)*(1.+iterations)+addit;
+      abserr += std::fabs(B[ji] - reference);
+    }
+  }
+
+#ifdef VERBOSE
+  std::cout << "Sum of absolute differences: " << abserr << std::endl;
+#endif
+
+  const auto epsilon = 1.0e-8;
+  if (abserr < epsilon) {
+    std::cout << "Solution validates" << std::endl;
+    auto avgtime = trans_time/iterations;
+    auto bytes = (size_t)order * (size_t)order * sizeof(double);
+    std::cout << "Rate (MB/s): " << 1.0e-6 * (2L*bytes)/avgtime
+              << " Avg time (s): " << avgtime << std::endl;
+  } else {
+    std::cout << "ERROR: Aggregate squared error " << abserr
+              << " exceeds threshold " << epsilon << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -107,10 +107,9 @@ int main(int argc, char * argv[])
   const size_t nelems = (size_t)order * (size_t)order;
   const size_t bytes = nelems * sizeof(double);
 
-  double * h_a;
-  double * h_b;
-  prk::CUDA::check( cudaMallocHost((void**)&h_a, bytes) );
-  prk::CUDA::check( cudaMallocHost((void**)&h_b, bytes) );
+  // pooled pinned host memory
+  prk::CUDA::host_vector<double> h_a(nelems);
+  prk::CUDA::host_vector<double> h_b(nelems);
 
   // fill A with the sequence 0 to order^2-1 as doubles
   for (auto j=0; j<order; j++) {
@@ -125,14 +124,15 @@ int main(int argc, char * argv[])
   double * d_b;
   prk::CUDA::check( cudaMalloc((void**)&d_a, bytes) );
   prk::CUDA::check( cudaMalloc((void**)&d_b, bytes) );
+  auto h2d_time = prk::wtime();
   prk::CUDA::check( cudaMemcpy(d_a, &(h_a[0]), bytes, cudaMemcpyHostToDevice) );
   prk::CUDA::check( cudaMemcpy(d_b, &(h_b[0]), bytes, cudaMemcpyHostToDevice) );
+  h2d_time = prk::wtime() - h2d_time;
 
 #if CUBLAS_AXPY_BUG
   // We need a vector of ones because CUBLAS daxpy does not
   // correctly implement incx=0.
-  double * h_o;
-  prk::CUDA::check( cudaMallocHost((void**)&h_o, bytes) );
+  prk::CUDA::host_vector<double> h_o(nelems);
   for (auto j=0; j<order; j++) {
     for (auto i=0; i<order; i++) {
       h_o[j*order+i] = 1;
@@ -144,10 +144,10 @@ int main(int argc, char * argv[])
 #endif
 
 #ifdef USE_HOST_BUFFERS
-  double p_a = h_a;
-  double p_b = h_b;
+  double * p_a = h_a.data();
+  double * p_b = h_b.data();
 #if CUBLAS_AXPY_BUG
-  double p_o = h_o;
+  double * p_o = h_o.data();
 #endif
 #else
   double * p_a = d_a;
@@ -196,18 +196,17 @@ int main(int argc, char * argv[])
   trans_time = prk::wtime() - trans_time;
 
   // copy output back to host
+  auto d2h_time = prk::wtime();
   prk::CUDA::check( cudaMemcpy(&(h_b[0]), d_b, bytes, cudaMemcpyDeviceToHost) );
+  d2h_time = prk::wtime() - d2h_time;
 
 #if CUBLAS_AXPY_BUG
   prk::CUDA::check( cudaFree(d_o) );
-  prk::CUDA::check( cudaFreeHost(h_o) );
 #endif
 
   prk::CUDA::check( cudaFree(d_b) );
   prk::CUDA::check( cudaFree(d_a) );
 
-  prk::CUDA::check( cudaFreeHost(h_a) );
-
   prk::CUDA::check( cublasDestroy(h) );
   //prk::CUDA::check( cublasShutdown() );
 
@@ -238,6 +237,10 @@ int main(int argc, char * argv[])
     auto bytes = (size_t)order * (size_t)order * sizeof(double);
     std::cout << "Rate (MB/s): " << 1.0e-6 * (2L*bytes)/avgtime
               << " Avg time (s): " << avgtime << std::endl;
+    if (prk::CUDA::report_transfers()) {
+      std::cout << "H2D bandwidth (MB/s): " << 1.0e-6 * (2L*bytes)/h2d_time
+                << " D2H bandwidth (MB/s): " << 1.0e-6 * bytes/d2h_time << std::endl;
+    }
   } else {
 #ifdef VERBOSE
     for (auto i=0; i<order; i++) {
@@ -251,8 +254,6 @@ int main(int argc, char * argv[])
     return 1;
   }
 
-  prk::CUDA::check( cudaFreeHost(h_b) );
-
   return 0;
 }
 
@@ -0,0 +1,277 @@
+///
+/// Copyright (c) 2013, Intel Corporation
+/// Copyright (c) 2015, NVIDIA CORPORATION.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions
+/// are met:
+///
+/// * Redistributions of source code must retain the above copyright
+///       notice, this list of conditions and the following disclaimer.
+/// * Redistributions in binary form must reproduce the above
+///       copyright notice, this list of conditions and the following
+///       disclaimer in the documentation and/or other materials provided
+///       with the distribution.
+/// * Neither the name of <COPYRIGHT HOLDER> nor the names of its
+///       contributors may be used to endorse or promote products
+///       derived from this software without specific prior written
+///       permission.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+/// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+/// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+/// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+/// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+/// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+/// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+/// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+/// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+/// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+/// POSSIBILITY OF SUCH DAMAGE.
+
+//////////////////////////////////////////////////////////////////////
+///
+/// NAME:    transpose
+///
+/// PURPOSE: This program measures the time for the transpose of a
+///          matrix distributed in column-block panels over MPI ranks,
+///          with one GPU per rank.  The inter-rank block exchange is
+///          the all-to-all pattern of a distributed FFT.
+///
+/// USAGE:   Program input is the number of iterations and the matrix
+///          order, which must be divisible by the number of ranks:
+///
+///          mpirun -n <ranks> transpose-cuda-mpi <# iterations> <matrix order>
+///
+///          Set PRK_GPU_AWARE_MPI=1 to pass device pointers straight
+///          to MPI_Alltoall; the default stages the exchange through
+///          pinned host buffers.
+///
+///          The output consists of diagnostics to make sure the
+///          transpose worked and timing statistics, including an
+///          estimate of the bandwidth crossing the rank bisection.
+///
+/// HISTORY: Written by  Rob Van der Wijngaart, February 2009.
+///          Converted to C++11 by Jeff Hammond, February 2016 and May 2017.
+///
+//////////////////////////////////////////////////////////////////////
+
+#include "prk_util.h"
+#include "prk_cuda.h"
+
+#include <mpi.h>
+
+const int block_threads = 256;
+
+/// Transpose each order/np sub-block of this rank's column panel into
+/// the send buffer (one contiguous block per destination rank), and
+/// bump the panel so neighbor data is refreshed every iteration.
+__global__ void pack(int order, int bo, prk_float * A, prk_float * sendbuf)
+{
+    const size_t nelems = (size_t)order * (size_t)bo;
+    for (size_t k = blockIdx.x * blockDim.x + threadIdx.x; k < nelems; k += (size_t)gridDim.x * blockDim.x) {
+        const int i  = k / bo;       // global row
+        const int j  = k % bo;       // local column
+        const int p  = i / bo;       // destination rank
+        const int ii = i % bo;       // row within the sub-block
+        sendbuf[((size_t)p*bo + j)*bo + ii] = A[k];
+        A[k] += (prk_float)1;
+    }
+}
+
+/// The flattened receive buffer lines up exactly with the B panel:
+/// block q, row jj, column j lands at global row q*bo+jj, column j.
+__global__ void unpack(size_t nelems, prk_float * B, const prk_float * recvbuf)
+{
+    for (size_t k = blockIdx.x * blockDim.x + threadIdx.x; k < nelems; k += (size_t)gridDim.x * blockDim.x) {
+        B[k] += recvbuf[k];
+    }
+}
+
+int main(int argc, char * argv[])
+{
+  MPI_Init(&argc, &argv);
+
+  int np, me;
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+
+  if (me==0) {
+    std::cout << "Parallel Research Kernels version " << PRKVERSION << std::endl;
+    std::cout << "C++11/CUDA+MPI Matrix transpose: B = A^T" << std::endl;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  /// Read and test input parameters
+  //////////////////////////////////////////////////////////////////////
+
+  int iterations;
+  int order;
+  try {
+      if (argc < 3) {
+        throw "Usage: <# iterations> <matrix order>";
+      }
+
+      iterations  = std::atoi(argv[1]);
+      if (iterations < 1) {
+        throw "ERROR: iterations must be >= 1";
+      }
+
+      order = std::atoi(argv[2]);
+      if (order <= 0) {
+        throw "ERROR: Matrix Order must be greater than 0";
+      } else if (order > std::floor(std::sqrt(INT_MAX))) {
+        throw "ERROR: matrix dimension too large - overflow risk";
+      } else if (order % np != 0) {
+        throw "ERROR: matrix order must be divisible by the number of ranks";
+      }
+  }
+  catch (const char * e) {
+    if (me==0) std::cout << e << std::endl;
+    MPI_Abort(MPI_COMM_WORLD, 1);
+  }
+
+  const char * aware_env = std::getenv("PRK_GPU_AWARE_MPI");
+  const bool gpu_aware = (aware_env!=nullptr) && (std::atoi(aware_env)!=0);
+
+  // one GPU per rank; ranks sharing a node take turns round robin
+  int ngpus;
+  prk::CUDA::check( cudaGetDeviceCount(&ngpus) );
+  prk::CUDA::check( cudaSetDevice(me % ngpus) );
+
+  const int bo = order / np;                   // columns owned by each rank
+
+  if (me==0) {
+    std::cout << "Number of ranks       = " << np << std::endl;
+    std::cout << "Number of iterations  = " << iterations << std::endl;
+    std::cout << "Matrix order          = " << order << std::endl;
+    std::cout << "Panel width           = " << bo << std::endl;
+    std::cout << "MPI buffers           = " << (gpu_aware ? "device (GPU-aware MPI)" : "pinned host staging") << std::endl;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  /// Allocate space for the input and transpose matrix
+  //////////////////////////////////////////////////////////////////////
+
+  const size_t nelems = (size_t)order * (size_t)bo;
+  const size_t bytes  = nelems * sizeof(prk_float);
+
+  prk_float * h_a;
+  prk_float * h_b;
+  prk::CUDA::check( cudaMallocHost((void**)&h_a, bytes) );
+  prk::CUDA::check( cudaMallocHost((void**)&h_b, bytes) );
+
+  // A(i, me*bo+j) = order * global column + global row, as in the CPU kernel
+  for (int i=0; i<order; i++) {
+    for (int j=0; j<bo; j++) {
+      h_a[(size_t)i*bo+j] = static_cast<prk_float>((size_t)order*(me*bo+j)+i);
+      h_b[(size_t)i*bo+j] = static_cast<prk_float>(0);
+    }
+  }
+
+  prk_float * d_a;
+  prk_float * d_b;
+  prk_float * d_send;
+  prk_float * d_recv;
+  prk::CUDA::check( cudaMalloc((void**)&d_a, bytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_b, bytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_send, bytes) );
+  prk::CUDA::check( cudaMalloc((void**)&d_recv, bytes) );
+  prk::CUDA::check( cudaMemcpy(d_a, h_a, bytes, cudaMemcpyHostToDevice) );
+  prk::CUDA::check( cudaMemcpy(d_b, h_b, bytes, cudaMemcpyHostToDevice) );
+
+  // staging buffers for the non-GPU-aware path
+  prk_float * h_send = nullptr;
+  prk_float * h_recv = nullptr;
+  if (!gpu_aware) {
+    prk::CUDA::check( cudaMallocHost((void**)&h_send, bytes) );
+    prk::CUDA::check( cudaMallocHost((void**)&h_recv, bytes) );
+  }
+
+  const MPI_Datatype dtype = (sizeof(prk_float)==8) ? MPI_DOUBLE : MPI_FLOAT;
+  const int blocks = (int)std::min((size_t)65535, (nelems + block_threads - 1)/block_threads);
+
+  auto trans_time = 0.0;
+
+  for (int iter = 0; iter<=iterations; iter++) {
+
+    if (iter==1) {
+      MPI_Barrier(MPI_COMM_WORLD);
+      trans_time = prk::wtime();
+    }
+
+    pack<<<blocks, block_threads>>>(order, bo, d_a, d_send);
+    prk::CUDA::check( cudaDeviceSynchronize() );
+
+    if (gpu_aware) {
+      MPI_Alltoall(d_send, bo*bo, dtype, d_recv, bo*bo, dtype, MPI_COMM_WORLD);
+    } else {
+      prk::CUDA::check( cudaMemcpy(h_send, d_send, bytes, cudaMemcpyDeviceToHost) );
+      MPI_Alltoall(h_send, bo*bo, dtype, h_recv, bo*bo, dtype, MPI_COMM_WORLD);
+      prk::CUDA::check( cudaMemcpy(d_recv, h_recv, bytes, cudaMemcpyHostToDevice) );
+    }
+
+    unpack<<<blocks, block_threads>>>(nelems, d_b, d_recv);
+    prk::CUDA::check( cudaDeviceSynchronize() );
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  trans_time = prk::wtime() - trans_time;
+
+  prk::CUDA::check( cudaMemcpy(h_b, d_b, bytes, cudaMemcpyDeviceToHost) );
+
+  prk::CUDA::check( cudaFree(d_recv) );
+  prk::CUDA::check( cudaFree(d_send) );
+  prk::CUDA::check( cudaFree(d_b) );
+  prk::CUDA::check( cudaFree(d_a) );
+  if (!gpu_aware) {
+    prk::CUDA::check( cudaFreeHost(h_send) );
+    prk::CUDA::check( cudaFreeHost(h_recv) );
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  /// Analyze and output results
+  //////////////////////////////////////////////////////////////////////
+
+  // B(i, me*bo+j) should hold (iterations+1) * A0(me*bo+j, i) + addit
+  const double addit = (iterations+1.) * (iterations/2.);
+  double abserr(0);
+  for (int i=0; i<order; i++) {
+    for (int j=0; j<bo; j++) {
+      const double reference = ((double)order*i + me*bo + j)*(1.+iterations)+addit;
+      abserr += std::fabs(h_b[(size_t)i*bo+j] - reference);
+    }
+  }
+
+  double total_err(0);
+  MPI_Reduce(&abserr, &total_err, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+
+  prk::CUDA::check( cudaFreeHost(h_b) );
+  prk::CUDA::check( cudaFreeHost(h_a) );
+
+  int status = 0;
+  if (me==0) {
+    const auto epsilon = 1.0e-8;
+    if (total_err < epsilon) {
+      std::cout << "Solution validates" << std::endl;
+      auto avgtime = trans_time/iterations;
+      auto bytes_total = (size_t)order * (size_t)order * sizeof(prk_float);
+      std::cout << "Rate (MB/s): " << 1.0e-6 * (2L*bytes_total)/avgtime
+                << " Avg time (s): " << avgtime << std::endl;
+      // every ordered rank pair exchanges one bo x bo block per iteration;
+      // pairs straddling the midpoint of the rank list carry the bisection
+      const double cross_blocks = 2.0 * (np/2) * (np - np/2);
+      const double bisection_bytes = cross_blocks * bo * bo * sizeof(prk_float);
+      std::cout << "Bisection bandwidth (MB/s): " << 1.0e-6 * bisection_bytes/avgtime << std::endl;
+    } else {
+      std::cout << "ERROR: Aggregate absolute error " << total_err
+                << " exceeds threshold " << epsilon << std::endl;
+      status = 1;
+    }
+  }
+
+  MPI_Bcast(&status, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  MPI_Finalize();
+  return status;
+}
@@ -40,10 +40,19 @@
 /// USAGE:   Program input is the matrix order and the number of times to
 ///          repeat the operation:
 ///
-///          transpose <matrix_size> <# iterations> [tile size]
+///          transpose <matrix_size> <# iterations> [tile size] [padding]
 ///
 ///          An optional parameter specifies the tile size used to divide the
 ///          individual matrix blocks for improved cache and TLB performance.
+///          Tile sizes 16 and 32 select a shared-memory tiled kernel whose
+///          store phase is coalesced; padding=1 (the default) pads each
+///          shared-memory tile row by one element so that the column read
+///          in the store phase does not serialize on one bank.  Other tile
+///          sizes select the element-per-thread kernel.
+///
+///          PRK_CUDA_SWEEP=1 runs every tile configuration in one process
+///          and reports the bandwidth of each, so the achievable device
+///          transpose bandwidth is visible without relaunching.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          transpose worked and timing statistics.
@@ -56,38 +65,73 @@
 #include "prk_util.h"
 #include "prk_cuda.h"
 
-#define TILED 0
-
-#if TILED
-// The kernel was derived from https://github.com/parallel-forall/code-samples/blob/master/series/cuda-cpp/transpose/transpose.cu,
-// which is the reason for the additional copyright noted above.
+__global__ void transpose(unsigned order, prk_float * A, prk_float * B)
+{
+    auto i = blockIdx.x * blockDim.x + threadIdx.x;
+    auto j = blockIdx.y * blockDim.y + threadIdx.y;
 
-const int tile_dim = 32;
-const int block_rows = 8;
+    if ((i<order) && (j<order)) {
+        B[i*order+j] += A[j*order+i];
+        A[j*order+i] += (prk_float)1;
+    }
+}
 
-__global__ void transpose(int order, prk_float * A, prk_float * B)
+// The tiled kernel was derived from https://github.com/parallel-forall/code-samples/blob/master/series/cuda-cpp/transpose/transpose.cu,
+// which is the reason for the additional copyright noted above.  Each
+// block stages a tile in shared memory so that both the load and the
+// store phase access global memory with unit stride; pad=1 offsets the
+// tile rows by one element so the column read in the store phase does
+// not serialize on a single shared-memory bank.  Bounds tests keep the
+// kernel correct for orders that are not a tile multiple.
+template <int tile_dim, int block_rows, int pad>
+__global__ void transpose_tiled(int order, prk_float * A, prk_float * B)
 {
+    __shared__ prk_float tile[tile_dim][tile_dim+pad];
+
     int x = blockIdx.x * tile_dim + threadIdx.x;
     int y = blockIdx.y * tile_dim + threadIdx.y;
-    int width = gridDim.x * tile_dim;
 
-    for (int j = 0; j < tile_dim; j+= block_rows) {
-        B[x*width + (y+j)] += A[(y+j)*width + x];
-        A[(y+j)*width + x] += (prk_float)1;
+    for (int j = 0; j < tile_dim; j += block_rows) {
+        if ((x < order) && (y+j < order)) {
+            tile[threadIdx.y+j][threadIdx.x] = A[(y+j)*order + x];
+            A[(y+j)*order + x] += (prk_float)1;
+        }
+    }
+    __syncthreads();
+
+    x = blockIdx.y * tile_dim + threadIdx.x;
+    y = blockIdx.x * tile_dim + threadIdx.y;
+
+    for (int j = 0; j < tile_dim; j += block_rows) {
+        if ((x < order) && (y+j < order)) {
+            B[(y+j)*order + x] += tile[threadIdx.x][threadIdx.y+j];
+        }
     }
 }
-#else
-__global__ void transpose(unsigned order, prk_float * A, prk_float * B)
-{
-    auto i = blockIdx.x * blockDim.x + threadIdx.x;
-    auto j = blockIdx.y * blockDim.y + threadIdx.y;
 
-    if ((i<order) && (j<order)) {
-        B[i*order+j] += A[j*order+i];
-        A[j*order+i] += (prk_float)1;
+const int verify_threads = 256;
+
+__global__ void verify(unsigned order, int iterations, double addit, const prk_float * B, double * partial)
+{
+    __shared__ double sum[verify_threads];
+    const unsigned tid = threadIdx.x;
+    const size_t nelems = (size_t)order*(size_t)order;
+    double local(0);
+    for (size_t k = blockIdx.x*(size_t)blockDim.x+tid; k<nelems; k += (size_t)gridDim.x*blockDim.x) {
+        // B[j*order+i] corresponds to A element ij = i*order+j
+        const size_t i = k%order;
+        const size_t j = k/order;
+        const double reference = static_cast<double>(i*order+j)*(1.+iterations)+addit;
+        local += fabs(static_cast<double>(B[k])-reference);
     }
+    sum[tid] = local;
+    __syncthreads();
+    for (unsigned s=blockDim.x/2; s>0; s>>=1) {
+        if (tid<s) sum[tid] += sum[tid+s];
+        __syncthreads();
+    }
+    if (tid==0) partial[blockIdx.x] = sum[0];
 }
-#endif
 
 int main(int argc, char * argv[])
 {
@@ -95,17 +139,19 @@ int main(int argc, char * argv[])
   std::cout << "C++11/CUDA Matrix transpose: B = A^T" << std::endl;
 
   prk::CUDA::info info;
-  info.print();
+  // enumerating and printing device properties is measurable cold-start
+  // cost in launch-dominated usage, so fast start skips it
+  if (!prk::fast_start()) info.print();
 
   //////////////////////////////////////////////////////////////////////
   /// Read and test input parameters
   //////////////////////////////////////////////////////////////////////
 
   int iterations;
-  int order, tile_size;
+  int order, tile_size, padding;
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <matrix order>";
+        throw "Usage: <# iterations> <matrix order> [<tile size> <padding>]";
       }
 
       iterations  = std::atoi(argv[1]);
@@ -120,12 +166,6 @@ int main(int argc, char * argv[])
         throw "ERROR: matrix dimension too large - overflow risk";
       }
 
-#if TILED
-      if (order % tile_dim != 0) {
-          std::cout << "Sorry, but order (" << order << ") must be evenly divible by " << tile_dim
-                    << " or the results are going to be wrong.\n";
-      }
-#else
       // default tile size for tiling of local transpose
       tile_size = 32;
       if (argc > 3) {
@@ -133,7 +173,12 @@ int main(int argc, char * argv[])
           if (tile_size <= 0) tile_size = order;
           if (tile_size > order) tile_size = order;
       }
-#endif
+
+      // shared-memory tile padding (16 and 32 tiles only)
+      padding = 1;
+      if (argc > 4) {
+          padding = (std::atoi(argv[4]) != 0) ? 1 : 0;
+      }
 #ifdef __CORIANDERCC__
       // This has not been analyzed, but it is an empirical fact.
       if (order > 1234) {
@@ -146,21 +191,28 @@ int main(int argc, char * argv[])
     return 1;
   }
 
+  const bool managed = prk::CUDA::use_managed();
+  const bool sweep   = prk::CUDA::use_sweep();
+
+  // the shared-memory kernel is instantiated for these tile sizes;
+  // anything else falls back to one element per thread
+  const bool shared = (tile_size==16 || tile_size==32);
+
   std::cout << "Number of iterations  = " << iterations << std::endl;
+  std::cout << "Startup time (s)      = " << prk::startup_time() << std::endl;
   std::cout << "Matrix order          = " << order << std::endl;
-#if TILED
-  std::cout << "Tile size             = " << tile_dim << std::endl;
-#else
+  std::cout << "Memory policy         = " << (managed ? "managed (unified)" : "explicit copy") << std::endl;
   std::cout << "Tile size             = " << tile_size << std::endl;
-#endif
+  if (shared) {
+      std::cout << "Transpose kernel      = shared-memory tiled (pad " << padding << ")" << std::endl;
+  } else {
+      std::cout << "Transpose kernel      = element per thread" << std::endl;
+  }
 
-#if TILED
-  dim3 dimGrid(order/tile_dim, order/tile_dim, 1);
-  dim3 dimBlock(tile_dim, block_rows, 1);
-#else
   dim3 dimGrid(prk::divceil(order,tile_size),prk::divceil(order,tile_size),1);
-  dim3 dimBlock(tile_size, tile_size, 1);
-#endif
+  // the tiled kernel coarsens over rows: each thread moves tile_size/4
+  // elements, so the block is tile_size x tile_size/4
+  dim3 dimBlock(tile_size, shared ? tile_size/4 : tile_size, 1);
 
   info.checkDims(dimBlock, dimGrid);
 
@@ -170,38 +222,149 @@ int main(int argc, char * argv[])
 
   const size_t nelems = (size_t)order * (size_t)order;
   const size_t bytes = nelems * sizeof(prk_float);
-  prk_float * h_a;
-  prk_float * h_b;
+  prk_float * h_a = NULL;
+  prk_float * h_b = NULL;
+  prk_float * d_a;
+  prk_float * d_b;
+  if (managed) {
+    // host and device share one allocation; pages migrate on demand
+    prk::CUDA::check( cudaMallocManaged((void**)&d_a, bytes) );
+    prk::CUDA::check( cudaMallocManaged((void**)&d_b, bytes) );
+    // fill A with the sequence 0 to order^2-1
+    for (auto j=0; j<order; j++) {
+      for (auto i=0; i<order; i++) {
+        d_a[j*order+i] = static_cast<prk_float>(order*j+i);
+        d_b[j*order+i] = static_cast<prk_float>(0);
+      }
+    }
+    prk::CUDA::prefetch_managed(d_a, bytes);
+    prk::CUDA::prefetch_managed(d_b, bytes);
+    h_a = d_a;
+    h_b = d_b;
+  } else {
 #ifndef __CORIANDERCC__
-  prk::CUDA::check( cudaMallocHost((void**)&h_a, bytes) );
-  prk::CUDA::check( cudaMallocHost((void**)&h_b, bytes) );
+    prk::CUDA::check( cudaMallocHost((void**)&h_a, bytes) );
+    prk::CUDA::check( cudaMallocHost((void**)&h_b, bytes) );
 #else
-  h_a = new prk_float[nelems];
-  h_b = new prk_float[nelems];
+    h_a = new prk_float[nelems];
+    h_b = new prk_float[nelems];
 #endif
-  // fill A with the sequence 0 to order^2-1
-  for (auto j=0; j<order; j++) {
-    for (auto i=0; i<order; i++) {
-      h_a[j*order+i] = static_cast<prk_float>(order*j+i);
-      h_b[j*order+i] = static_cast<prk_float>(0);
+    // fill A with the sequence 0 to order^2-1
+    for (auto j=0; j<order; j++) {
+      for (auto i=0; i<order; i++) {
+        h_a[j*order+i] = static_cast<prk_float>(order*j+i);
+        h_b[j*order+i] = static_cast<prk_float>(0);
+      }
     }
-  }
 
-  // copy input from host to device
-  prk_float * d_a;
-  prk_float * d_b;
-  prk::CUDA::check( cudaMalloc((void**)&d_a, bytes) );
-  prk::CUDA::check( cudaMalloc((void**)&d_b, bytes) );
-  prk::CUDA::check( cudaMemcpy(d_a, &(h_a[0]), bytes, cudaMemcpyHostToDevice) );
-  prk::CUDA::check( cudaMemcpy(d_b, &(h_b[0]), bytes, cudaMemcpyHostToDevice) );
+    // copy input from host to device
+    prk::CUDA::check( cudaMalloc((void**)&d_a, bytes) );
+    prk::CUDA::check( cudaMalloc((void**)&d_b, bytes) );
+    prk::CUDA::check( cudaMemcpy(d_a, &(h_a[0]), bytes, cudaMemcpyHostToDevice) );
+    prk::CUDA::check( cudaMemcpy(d_b, &(h_b[0]), bytes, cudaMemcpyHostToDevice) );
+  }
 
   auto trans_time = 0.0;
 
+  // one transpose with the selected tile configuration; pad<0 selects
+  // the element-per-thread kernel
+  auto launch = [&](int tile, int pad) {
+    dim3 grid(prk::divceil(order,tile), prk::divceil(order,tile), 1);
+    if (pad < 0) {
+      dim3 block(tile, tile, 1);
+      transpose<<<grid, block>>>(order, d_a, d_b);
+    } else if (tile == 16) {
+      dim3 block(16, 4, 1);
+      if (pad) transpose_tiled<16,4,1><<<grid, block>>>(order, d_a, d_b);
+      else     transpose_tiled<16,4,0><<<grid, block>>>(order, d_a, d_b);
+    } else {
+      dim3 block(32, 8, 1);
+      if (pad) transpose_tiled<32,8,1><<<grid, block>>>(order, d_a, d_b);
+      else     transpose_tiled<32,8,0><<<grid, block>>>(order, d_a, d_b);
+    }
+  };
+
+#ifndef __CORIANDERCC__
+  if (sweep) {
+    // every configuration starts from freshly initialized matrices so
+    // the checksum of each point is the same
+    struct config { int tile; int pad; const char * name; };
+    const config configs[] = {
+      { 32, -1, "element per thread   " },
+      { 16,  0, "shared tile 16 pad 0 " },
+      { 16,  1, "shared tile 16 pad 1 " },
+      { 32,  0, "shared tile 32 pad 0 " },
+      { 32,  1, "shared tile 32 pad 1 " },
+    };
+
+    const double addit = (iterations+1.) * (iterations/2.);
+    const int vblocks = 256;
+    double * d_err;
+    double h_err[vblocks];
+    prk::CUDA::check( cudaMalloc((void**)&d_err, vblocks*sizeof(double)) );
+
+    for (auto cfg : configs) {
+      if (managed) {
+        for (auto j=0; j<order; j++) {
+          for (auto i=0; i<order; i++) {
+            d_a[j*order+i] = static_cast<prk_float>(order*j+i);
+            d_b[j*order+i] = static_cast<prk_float>(0);
+          }
+        }
+        prk::CUDA::prefetch_managed(d_a, bytes);
+        prk::CUDA::prefetch_managed(d_b, bytes);
+      } else {
+        prk::CUDA::check( cudaMemcpy(d_a, &(h_a[0]), bytes, cudaMemcpyHostToDevice) );
+        prk::CUDA::check( cudaMemset(d_b, 0, bytes) );
+      }
+
+      double t(0);
+      for (auto iter = 0; iter<=iterations; iter++) {
+        if (iter==1) t = prk::wtime();
+        launch(cfg.tile, cfg.pad);
+        prk::CUDA::check( cudaDeviceSynchronize() );
+      }
+      t = prk::wtime() - t;
+
+      double abserr(0);
+      verify<<<vblocks, verify_threads>>>(static_cast<unsigned>(order), iterations, addit, d_b, d_err);
+      prk::CUDA::check( cudaMemcpy(h_err, d_err, vblocks*sizeof(double), cudaMemcpyDeviceToHost) );
+      for (auto i=0; i<vblocks; i++) abserr += h_err[i];
+      if (abserr >= 1.0e-8) {
+        std::cout << "ERROR: Aggregate squared error " << abserr
+                  << " for configuration " << cfg.name << std::endl;
+        return 1;
+      }
+
+      const double avgtime = t/iterations;
+      std::cout << cfg.name
+                << " Rate (MB/s): " << 1.0e-6 * (2L*bytes)/avgtime
+                << " Avg time (s): " << avgtime << std::endl;
+    }
+    std::cout << "Solution validates" << std::endl;
+
+    prk::CUDA::check( cudaFree(d_err) );
+    prk::CUDA::check( cudaFree(d_b) );
+    prk::CUDA::check( cudaFree(d_a) );
+    if (!managed) {
+      prk::CUDA::check( cudaFreeHost(h_b) );
+      prk::CUDA::check( cudaFreeHost(h_a) );
+    }
+    return 0;
+  }
+#endif
+
+  // the warmup iteration absorbs any migration of managed pages
+  auto first_time = prk::wtime();
+
   for (auto iter = 0; iter<=iterations; iter++) {
 
-    if (iter==1) trans_time = prk::wtime();
+    if (iter==1) {
+      first_time = prk::wtime() - first_time;
+      trans_time = prk::wtime();
+    }
 
-    transpose<<<dimGrid, dimBlock>>>(order, d_a, d_b);
+    launch(tile_size, shared ? padding : -1);
 #ifndef __CORIANDERCC__
     // silence "ignoring cudaDeviceSynchronize for now" warning
     prk::CUDA::check( cudaDeviceSynchronize() );
@@ -209,23 +372,20 @@ int main(int argc, char * argv[])
   }
   trans_time = prk::wtime() - trans_time;
 
-  // copy output back to host
-  prk::CUDA::check( cudaMemcpy(&(h_b[0]), d_b, bytes, cudaMemcpyDeviceToHost) );
-
-#ifdef VERBOSE
-  // copy input back to host - debug only
-  prk::CUDA::check( cudaMemcpy(&(h_a[0]), d_a, bytes, cudaMemcpyDeviceToHost) );
-#endif
-
-  prk::CUDA::check( cudaFree(d_b) );
-  prk::CUDA::check( cudaFree(d_a) );
-
   //////////////////////////////////////////////////////////////////////
   /// Analyze and output results
   //////////////////////////////////////////////////////////////////////
 
   const double addit = (iterations+1.) * (iterations/2.);
   double abserr(0);
+#ifdef VERBOSE
+  // full readback and serial verification - debug only
+  if (!managed) {
+    // copy output back to host
+    prk::CUDA::check( cudaMemcpy(&(h_b[0]), d_b, bytes, cudaMemcpyDeviceToHost) );
+    // copy input back to host - debug only
+    prk::CUDA::check( cudaMemcpy(&(h_a[0]), d_a, bytes, cudaMemcpyDeviceToHost) );
+  }
   for (auto j=0; j<order; j++) {
     for (auto i=0; i<order; i++) {
       const size_t ij = (size_t)i*(size_t)order+(size_t)j;
@@ -234,15 +394,28 @@ int main(int argc, char * argv[])
       abserr += std::fabs(h_b[ji] - reference);
     }
   }
-
-#ifdef VERBOSE
   std::cout << "Sum of absolute differences: " << abserr << std::endl;
+#else
+  // the checksum is reduced on the device so that only per-block
+  // partial sums are transferred, not the whole matrix
+  const int vblocks = 256;
+  double * d_err;
+  double h_err[vblocks];
+  prk::CUDA::check( cudaMalloc((void**)&d_err, vblocks*sizeof(double)) );
+  verify<<<vblocks, verify_threads>>>(static_cast<unsigned>(order), iterations, addit, d_b, d_err);
+  prk::CUDA::check( cudaMemcpy(h_err, d_err, vblocks*sizeof(double), cudaMemcpyDeviceToHost) );
+  for (auto i=0; i<vblocks; i++) abserr += h_err[i];
+  prk::CUDA::check( cudaFree(d_err) );
 #endif
 
+  prk::CUDA::check( cudaFree(d_b) );
+  prk::CUDA::check( cudaFree(d_a) );
+  if (!managed) {
 #ifndef __CORIANDERCC__
-  prk::CUDA::check( cudaFreeHost(h_b) );
-  prk::CUDA::check( cudaFreeHost(h_a) );
+    prk::CUDA::check( cudaFreeHost(h_b) );
+    prk::CUDA::check( cudaFreeHost(h_a) );
 #endif
+  }
 
   const auto epsilon = 1.0e-8;
   if (abserr < epsilon) {
@@ -251,6 +424,12 @@ int main(int argc, char * argv[])
     auto bytes = (size_t)order * (size_t)order * sizeof(prk_float);
     std::cout << "Rate (MB/s): " << 1.0e-6 * (2L*bytes)/avgtime
               << " Avg time (s): " << avgtime << std::endl;
+    if (managed) {
+      // the first iteration pays for any page migration
+      std::cout << "Rate incl. migration (MB/s): "
+                << 1.0e-6 * (2L*bytes)*(iterations+1)/(first_time+trans_time)
+                << " First iteration (s): " << first_time << std::endl;
+    }
   } else {
 #ifdef VERBOSE
     for (auto i=0; i<order; i++) {
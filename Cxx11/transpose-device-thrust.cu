@@ -50,6 +50,10 @@
 //////////////////////////////////////////////////////////////////////
 
 #include "prk_util.h"
+#include "prk_cuda.h"
+
+#include <thrust/async/for_each.h>
+#include <thrust/system/cuda/execution_policy.h>
 
 struct x : public thrust::unary_function<void,int>
 {
@@ -91,9 +95,10 @@ int main(int argc, char * argv[])
 
   int iterations;
   int order;
+  int num_streams;
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <matrix order>";
+        throw "Usage: <# iterations> <matrix order> [<# streams>]";
       }
 
       // number of times to do the transpose
@@ -109,6 +114,13 @@ int main(int argc, char * argv[])
       } else if (order > std::floor(std::sqrt(INT_MAX))) {
         throw "ERROR: matrix dimension too large - overflow risk";
       }
+
+      // more than one stream selects the asynchronous chunked mode
+      num_streams = (argc>3) ? std::atoi(argv[3]) : 1;
+      if (num_streams < 1) {
+        throw "ERROR: number of streams must be >= 1";
+      }
+      if (num_streams > order) num_streams = order;
   }
   catch (const char * e) {
     std::cout << e << std::endl;
@@ -117,6 +129,7 @@ int main(int argc, char * argv[])
 
   std::cout << "Number of iterations  = " << iterations << std::endl;
   std::cout << "Matrix order          = " << order << std::endl;
+  std::cout << "Number of streams     = " << num_streams << std::endl;
 
   //////////////////////////////////////////////////////////////////////
   /// Allocate space for the input and transpose matrix
@@ -131,23 +144,83 @@ int main(int argc, char * argv[])
   auto range = prk::range(0,order);
 
   auto trans_time = 0.0;
+  float busy_ms(0);
 
-  for (auto iter = 0; iter<=iterations; iter++) {
+  if (num_streams == 1) {
 
-    if (iter==1) trans_time = prk::wtime();
+    for (auto iter = 0; iter<=iterations; iter++) {
+
+      if (iter==1) trans_time = prk::wtime();
 
 #if 1
-    transpose(order, A, B);
+      transpose(order, A, B);
 #else
-    thrust::for_each( std::begin(range), std::end(range), [=,&A,&B] (int i) {
-      thrust::for_each( std::begin(range), std::end(range), [=,&A,&B] (int j) {
-        B[i*order+j] += A[j*order+i];
-        A[j*order+i] += 1.0;
+      thrust::for_each( std::begin(range), std::end(range), [=,&A,&B] (int i) {
+        thrust::for_each( std::begin(range), std::end(range), [=,&A,&B] (int j) {
+          B[i*order+j] += A[j*order+i];
+          A[j*order+i] += 1.0;
+        });
       });
-    });
 #endif
+    }
+    trans_time = prk::wtime() - trans_time;
+
+  } else {
+
+    // asynchronous mode: B is split into one contiguous block of rows per
+    // stream and each block is dispatched with the async algorithm
+    // interface on its own stream.  The blocks partition the (i,j) index
+    // space, so every element of A is updated exactly once per sweep and
+    // the chunks are free of races.  Events bracketing each chunk measure
+    // how much overlap the dispatch actually achieved.
+    double * pA = thrust::raw_pointer_cast(A.data());
+    double * pB = thrust::raw_pointer_cast(B.data());
+
+    std::vector<cudaStream_t> streams(num_streams);
+    std::vector<cudaEvent_t> ev0(num_streams);
+    std::vector<cudaEvent_t> ev1(num_streams);
+    for (int s=0; s<num_streams; s++) {
+      prk::CUDA::check( cudaStreamCreate(&streams[s]) );
+      prk::CUDA::check( cudaEventCreate(&ev0[s]) );
+      prk::CUDA::check( cudaEventCreate(&ev1[s]) );
+    }
+
+    for (auto iter = 0; iter<=iterations; iter++) {
+
+      if (iter==1) { busy_ms = 0; trans_time = prk::wtime(); }
+
+      std::vector<thrust::device_event> pending;
+      for (int s=0; s<num_streams; s++) {
+        const int lo = (int)((long)order*s/num_streams) * order;
+        const int hi = (int)((long)order*(s+1)/num_streams) * order;
+        prk::CUDA::check( cudaEventRecord(ev0[s], streams[s]) );
+        pending.push_back(
+            thrust::async::for_each( thrust::cuda::par.on(streams[s]),
+                                     thrust::counting_iterator<int>(lo),
+                                     thrust::counting_iterator<int>(hi),
+                                     [=] __device__ (int e) {
+                                         const int i = e / order;
+                                         const int j = e % order;
+                                         pB[e] += pA[j*order+i];
+                                         pA[j*order+i] += 1.0;
+                                     }) );
+        prk::CUDA::check( cudaEventRecord(ev1[s], streams[s]) );
+      }
+      for (auto & e : pending) e.wait();
+      for (int s=0; s<num_streams; s++) {
+        float ms(0);
+        prk::CUDA::check( cudaEventElapsedTime(&ms, ev0[s], ev1[s]) );
+        busy_ms += ms;
+      }
+    }
+    trans_time = prk::wtime() - trans_time;
+
+    for (int s=0; s<num_streams; s++) {
+      prk::CUDA::check( cudaEventDestroy(ev1[s]) );
+      prk::CUDA::check( cudaEventDestroy(ev0[s]) );
+      prk::CUDA::check( cudaStreamDestroy(streams[s]) );
+    }
   }
-  trans_time = prk::wtime() - trans_time;
 
   //////////////////////////////////////////////////////////////////////
   /// Analyze and output results
@@ -176,6 +249,12 @@ int main(int argc, char * argv[])
     auto bytes = (size_t)order * (size_t)order * sizeof(double);
     std::cout << "Rate (MB/s): " << 1.0e-6 * (2L*bytes)/avgtime
               << " Avg time (s): " << avgtime << std::endl;
+    if (num_streams > 1) {
+      // ratio of summed per-stream busy time to wall time: 1 means the
+      // chunks serialized, num_streams means they fully overlapped
+      std::cout << "Stream overlap: " << 1.e-3*busy_ms/trans_time
+                << " of " << num_streams << " streams busy on average" << std::endl;
+    }
   } else {
     std::cout << "ERROR: Aggregate squared error " << abserr
               << " exceeds threshold " << epsilon << std::endl;
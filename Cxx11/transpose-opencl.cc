@@ -60,7 +60,7 @@ void run(cl::Context context, int iterations, int order)
 {
   auto precision = (sizeof(T)==8) ? 64 : 32;
 
-  cl::Program program(context, prk::opencl::loadProgram("transpose.cl"), true);
+  cl::Program program = prk::opencl::buildProgram(context, prk::opencl::loadProgram("transpose.cl"));
 
   auto function = (precision==64) ? "transpose64" : "transpose32";
 
@@ -39,7 +39,16 @@
 /// USAGE:   Program input is the matrix order and the number of times to
 ///          repeat the operation:
 ///
-///          transpose <matrix_size> <# iterations>
+///          transpose <# iterations> <matrix_size> [<work-group size>]
+///
+///          A work-group size of 0 leaves the launch configuration to the
+///          runtime, a positive value w launches with w x w work-groups,
+///          and "auto" sweeps candidate sizes in an untimed probe phase
+///          and keeps the fastest.  Work-group sizes 16 and 32 select a
+///          local-memory tiled kernel whose tile row is padded by one
+///          element, matching the shared-memory design of the CUDA
+///          version, so both the load and the store traverse global
+///          memory row-wise.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          transpose worked and timing statistics.
@@ -58,9 +67,12 @@
 #endif
 
 template <typename T> class transpose;
+template <typename T> class transpose_ndr;
+template <typename T, int tile_dim> class transpose_tiled;
+template <typename T> class reset;
 
 template <typename T>
-void run(cl::sycl::queue & q, int iterations, size_t order)
+void run(cl::sycl::queue & q, int iterations, size_t order, int wgsize)
 {
   //////////////////////////////////////////////////////////////////////
   // Allocate space for the input and transpose matrix
@@ -89,10 +101,158 @@ void run(cl::sycl::queue & q, int iterations, size_t order)
     cl::sycl::buffer<T> d_B { h_B.data(), h_B.size() };
 #endif
 
+    // one transpose with an explicit ND-range; the global size is
+    // rounded up so the tail guard makes any work-group size legal
+    auto trans_ndr = [&](size_t wg) {
+      const size_t global = wg * prk::divceil(order, wg);
+      q.submit([&](cl::sycl::handler& h) {
+
+        // accessor methods
+        auto A = d_A.template get_access<cl::sycl::access::mode::read_write>(h);
+        auto B = d_B.template get_access<cl::sycl::access::mode::read_write>(h);
+
+        h.parallel_for<class transpose_ndr<T>>(
+                cl::sycl::nd_range<2>{cl::sycl::range<2>{global,global}, cl::sycl::range<2>{wg,wg}},
+                [=] (cl::sycl::nd_item<2> it) {
+          const size_t i = it.get_global_id(0);
+          const size_t j = it.get_global_id(1);
+          if ((i<order) && (j<order)) {
+#if USE_2D_INDEXING
+            cl::sycl::id<2> ij{i,j};
+            cl::sycl::id<2> ji{j,i};
+            B[ij] += A[ji];
+            A[ji] += (T)1;
+#else
+            B[i * order + j] += A[j * order + i];
+            A[j * order + i] += (T)1;
+#endif
+          }
+        });
+      });
+    };
+
+    // one transpose with a local-memory tiled kernel: the work-group
+    // stages a tile in local memory so that both the load and the store
+    // traverse global memory row-wise; the tile row is padded by one
+    // element so the column read in the store phase does not serialize
+    // on one bank.  The tile size is a compile-time constant of the
+    // kernel, instantiated for 16 and 32; the tail guards keep the
+    // kernel correct for orders that are not a tile multiple.
+    auto trans_tiled = [&](auto tile_tag) {
+      constexpr int tile_dim = decltype(tile_tag)::value;
+      const size_t global = tile_dim * prk::divceil(order, static_cast<size_t>(tile_dim));
+      q.submit([&](cl::sycl::handler& h) {
+
+        // accessor methods
+        auto A = d_A.template get_access<cl::sycl::access::mode::read_write>(h);
+        auto B = d_B.template get_access<cl::sycl::access::mode::read_write>(h);
+        cl::sycl::accessor<T, 2, cl::sycl::access::mode::read_write,
+                           cl::sycl::access::target::local>
+            tile(cl::sycl::range<2>{tile_dim, tile_dim+1}, h);
+
+        h.parallel_for<transpose_tiled<T,tile_dim>>(
+                cl::sycl::nd_range<2>{cl::sycl::range<2>{global,global},
+                                      cl::sycl::range<2>{tile_dim,tile_dim}},
+                [=] (cl::sycl::nd_item<2> it) {
+          const size_t li = it.get_local_id(0);
+          const size_t lj = it.get_local_id(1);
+          const size_t gi = it.get_group(0) * tile_dim + li;
+          const size_t gj = it.get_group(1) * tile_dim + lj;
+          if ((gi<order) && (gj<order)) {
+#if USE_2D_INDEXING
+            cl::sycl::id<2> ij{gi,gj};
+            tile[li][lj] = A[ij];
+            A[ij] += (T)1;
+#else
+            tile[li][lj] = A[gi * order + gj];
+            A[gi * order + gj] += (T)1;
+#endif
+          }
+          it.barrier(cl::sycl::access::fence_space::local_space);
+          // swap the group indices so the store is also row-wise;
+          // tile[lj][li] was loaded iff the guard below holds
+          const size_t ti = it.get_group(1) * tile_dim + li;
+          const size_t tj = it.get_group(0) * tile_dim + lj;
+          if ((ti<order) && (tj<order)) {
+#if USE_2D_INDEXING
+            cl::sycl::id<2> ij{ti,tj};
+            B[ij] += tile[lj][li];
+#else
+            B[ti * order + tj] += tile[lj][li];
+#endif
+          }
+        });
+      });
+    };
+
+    // dispatch on the work-group size: 16 and 32 have a tiled
+    // instantiation, everything else falls back to the naive ND-range
+    auto launch = [&](size_t wg) {
+      if      (wg == 16) trans_tiled(std::integral_constant<int,16>{});
+      else if (wg == 32) trans_tiled(std::integral_constant<int,32>{});
+      else               trans_ndr(wg);
+    };
+
+    if (wgsize < 0) {
+      // probe phase: sweep work-group sizes and keep the fastest;
+      // none of these launches is timed
+#ifndef TRISYCL
+      const size_t max_wg = q.get_device().get_info<cl::sycl::info::device::max_work_group_size>();
+#else
+      const size_t max_wg = 1024;
+#endif
+      double best_time(1.e30);
+      for (size_t wg=4; wg<=32; wg*=2) {
+        if (wg*wg > max_wg || wg > order) break;
+        launch(wg);
+        q.wait();
+        double probe = prk::wtime();
+        for (int r=0; r<2; ++r) {
+          launch(wg);
+        }
+        q.wait();
+        probe = prk::wtime() - probe;
+        if (probe < best_time) {
+          best_time = probe;
+          wgsize = wg;
+        }
+      }
+      if (wgsize < 0) wgsize = 0;
+      if (wgsize > 0) {
+        std::cout << "Autotuned work-group size = " << wgsize << "x" << wgsize
+                  << ((wgsize==16 || wgsize==32) ? " (local-memory tiled)" : "") << std::endl;
+      }
+      // the probe ran extra iterations; restore the initial matrices
+      q.submit([&](cl::sycl::handler& h) {
+
+        auto A = d_A.template get_access<cl::sycl::access::mode::discard_write>(h);
+        auto B = d_B.template get_access<cl::sycl::access::mode::discard_write>(h);
+
+        h.parallel_for<class reset<T>>(
+                cl::sycl::range<2>{order,order}, [=] (cl::sycl::item<2> it) {
+#if USE_2D_INDEXING
+          cl::sycl::id<2> ij{it[0],it[1]};
+          A[ij] = static_cast<T>(it[0] * order + it[1]);
+          B[ij] = (T)0;
+#else
+          A[it[0] * order + it[1]] = static_cast<T>(it[0] * order + it[1]);
+          B[it[0] * order + it[1]] = (T)0;
+#endif
+        });
+      });
+      q.wait();
+    }
+
     for (int iter = 0; iter<=iterations; ++iter) {
 
       if (iter==1) trans_time = prk::wtime();
 
+      if (wgsize > 0) {
+        launch(static_cast<size_t>(wgsize));
+        q.wait();
+        continue;
+      }
+
       q.submit([&](cl::sycl::handler& h) {
 
         // accessor methods
@@ -188,9 +348,10 @@ int main(int argc, char * argv[])
 
   int iterations;
   size_t order;
+  int wgsize = 0;
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <matrix order>";
+        throw "Usage: <# iterations> <matrix order> [<work-group size (0=default, auto=probe)>]";
       }
 
       // number of times to do the transpose
@@ -206,6 +367,12 @@ int main(int argc, char * argv[])
       } else if (order > std::floor(std::sqrt(INT_MAX))) {
         throw "ERROR: matrix dimension too large - overflow risk";
       }
+
+      // work-group size: 0 = runtime default, "auto" = probe phase
+      if (argc > 3) {
+          wgsize = (std::string(argv[3]) == "auto") ? -1 : std::atoi(argv[3]);
+          if (wgsize > static_cast<int>(order)) wgsize = order;
+      }
   }
   catch (const char * e) {
     std::cout << e << std::endl;
@@ -214,6 +381,13 @@ int main(int argc, char * argv[])
 
   std::cout << "Number of iterations  = " << iterations << std::endl;
   std::cout << "Matrix order          = " << order << std::endl;
+  std::cout << "Work-group size       = ";
+  if      (wgsize < 0)  std::cout << "autotune" << std::endl;
+  else if (wgsize == 0) std::cout << "runtime default" << std::endl;
+  else                  std::cout << wgsize << "x" << wgsize << std::endl;
+  if (wgsize==16 || wgsize==32) {
+    std::cout << "Transpose kernel      = local-memory tiled" << std::endl;
+  }
 
   //////////////////////////////////////////////////////////////////////
   /// Setup SYCL environment
@@ -232,8 +406,8 @@ int main(int argc, char * argv[])
         std::cout << "SYCL Device:   " << device.get_info<cl::sycl::info::device::name>() << std::endl;
         std::cout << "SYCL Platform: " << platform.get_info<cl::sycl::info::platform::name>() << std::endl;
 #endif
-        run<float>(host, iterations, order);
-        run<double>(host, iterations, order);
+        run<float>(host, iterations, order, wgsize);
+        run<double>(host, iterations, order, wgsize);
     }
 
     // CPU requires spir64 target
@@ -249,8 +423,8 @@ int main(int argc, char * argv[])
         bool has_spir = true; // ?
 #endif
         if (has_spir) {
-          run<float>(cpu, iterations, order);
-          run<double>(cpu, iterations, order);
+          run<float>(cpu, iterations, order, wgsize);
+          run<double>(cpu, iterations, order, wgsize);
         }
     }
 
@@ -272,17 +446,17 @@ int main(int argc, char * argv[])
           std::cout << "SYCL GPU device lacks FP64 support." << std::endl;
         }
         if (has_spir) {
-          run<float>(gpu, iterations, order);
+          run<float>(gpu, iterations, order, wgsize);
           if (has_fp64) {
-            run<double>(gpu, iterations, order);
+            run<double>(gpu, iterations, order, wgsize);
           }
         } else {
           std::cout << "SYCL GPU device lacks SPIR-V support." << std::endl;
 #ifdef __COMPUTECPP__
           std::cout << "You are using ComputeCpp so we will try it anyways..." << std::endl;
-          run<float>(gpu, iterations, order);
+          run<float>(gpu, iterations, order, wgsize);
           if (has_fp64) {
-            run<double>(gpu, iterations, order);
+            run<double>(gpu, iterations, order, wgsize);
           }
 #endif
         }
@@ -122,6 +122,12 @@ int main(int argc, char * argv[])
       return 1;
   }
 
+  // futures are serviced by persistent workers, so that small orders measure
+  // the transpose and not thread creation
+  const int pool_size = num_futures;
+  prk::thread_pool thread_pool(pool_size);
+  std::cout << "Number of pool workers= " << pool_size << std::endl;
+
   //////////////////////////////////////////////////////////////////////
   // Allocate space and perform the computation
   //////////////////////////////////////////////////////////////////////
@@ -142,7 +148,7 @@ int main(int argc, char * argv[])
 
     for (auto ib=0; ib<order; ib+=block_size) {
       for (auto jb=0; jb<order; jb+=block_size) {
-        pool.push_back(std::async(std::launch::async, [=,&A,&B] {
+        pool.push_back(thread_pool.submit([=,&A,&B] {
           for (auto it=ib; it<std::min(order,ib+block_size); it+=tile_size) {
             for (auto jt=jb; jt<std::min(order,jb+block_size); jt+=tile_size) {
               for (auto i=it; i<std::min(ib+block_size,it+tile_size); i++) {
@@ -66,9 +66,10 @@ int main(int argc, char * argv[])
   int iterations, gs;
   int order;
   int tile_size;
+  bool compare(false);
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <matrix order> [taskloop grainsize] [tile size]";
+        throw "Usage: <# iterations> <matrix order> [tile size] [grainsize (<0: num_tasks)] [compare]";
       }
 
       // number of times to do the transpose
@@ -90,11 +91,18 @@ int main(int argc, char * argv[])
       // a negative tile size means no tiling of the local transpose
       if (tile_size <= 0) tile_size = order;
 
-      // taskloop grainsize
+      // taskloop granularity: positive sets grainsize, negative num_tasks
       gs = (argc > 4) ? std::atoi(argv[4]) : 32;
-      if (gs < 1 || gs > order) {
+      if (gs == 0 || gs > order || -gs > order) {
         throw "ERROR: grainsize";
       }
+
+      // "compare" splits the timed iterations between taskloop and plain
+      // worksharing sweeps, so the task overhead can be read off one run
+      compare = (argc > 5) && (std::string(argv[5]) == "compare");
+      if (compare && iterations < 2) {
+        throw "ERROR: compare mode needs at least 2 iterations";
+      }
   }
   catch (const char * e) {
     std::cout << e << std::endl;
@@ -103,7 +111,10 @@ int main(int argc, char * argv[])
 
 #ifdef _OPENMP
   std::cout << "Number of threads    = " << omp_get_max_threads() << std::endl;
-  std::cout << "Taskloop grainsize   = " << gs << std::endl;
+  if (gs > 0) std::cout << "Taskloop grainsize   = " << gs << std::endl;
+  else        std::cout << "Taskloop num_tasks   = " << -gs << std::endl;
+  if (compare)
+    std::cout << "Taskloop vs worksharing comparison" << std::endl;
 #endif
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Matrix order         = " << order << std::endl;
@@ -118,49 +129,122 @@ int main(int argc, char * argv[])
 
   auto trans_time = 0.0;
 
+  // in compare mode taskloop runs the first half of the timed iterations
+  // and plain worksharing the rest; the total sweep count is unchanged
+  const int half = compare ? iterations/2 : iterations;
+  double task_time(0), ws_time(0);
+
   OMP_PARALLEL()
   OMP_MASTER
   {
-    OMP_TASKLOOP( firstprivate(order) shared(A,B) grainsize(gs) )
-    for (auto i=0;i<order; i++) {
-      for (auto j=0;j<order;j++) {
-        A[i*order+j] = static_cast<double>(i*order+j);
-        B[i*order+j] = 0.0;
+    if (gs > 0) {
+      OMP_TASKLOOP( firstprivate(order) shared(A,B) grainsize(gs) )
+      for (auto i=0;i<order; i++) {
+        for (auto j=0;j<order;j++) {
+          A[i*order+j] = static_cast<double>(i*order+j);
+          B[i*order+j] = 0.0;
+        }
+      }
+    } else {
+      OMP_TASKLOOP( firstprivate(order) shared(A,B) num_tasks(-gs) )
+      for (auto i=0;i<order; i++) {
+        for (auto j=0;j<order;j++) {
+          A[i*order+j] = static_cast<double>(i*order+j);
+          B[i*order+j] = 0.0;
+        }
       }
     }
     OMP_TASKWAIT
 
-    for (auto iter = 0; iter<=iterations; iter++) {
+    for (auto iter = 0; iter<=half; iter++) {
 
       if (iter==1) trans_time = prk::wtime();
 
       // transpose the  matrix
       if (tile_size < order) {
-        OMP_TASKLOOP_COLLAPSE(2, firstprivate(order) shared(A,B) grainsize(gs) )
-        for (auto it=0; it<order; it+=tile_size) {
-          for (auto jt=0; jt<order; jt+=tile_size) {
-            for (auto i=it; i<std::min(order,it+tile_size); i++) {
-              for (auto j=jt; j<std::min(order,jt+tile_size); j++) {
-                B[i*order+j] += A[j*order+i];
-                A[j*order+i] += 1.0;
+        if (gs > 0) {
+          OMP_TASKLOOP_COLLAPSE(2, firstprivate(order) shared(A,B) grainsize(gs) )
+          for (auto it=0; it<order; it+=tile_size) {
+            for (auto jt=0; jt<order; jt+=tile_size) {
+              for (auto i=it; i<std::min(order,it+tile_size); i++) {
+                for (auto j=jt; j<std::min(order,jt+tile_size); j++) {
+                  B[i*order+j] += A[j*order+i];
+                  A[j*order+i] += 1.0;
+                }
+              }
+            }
+          }
+        } else {
+          OMP_TASKLOOP_COLLAPSE(2, firstprivate(order) shared(A,B) num_tasks(-gs) )
+          for (auto it=0; it<order; it+=tile_size) {
+            for (auto jt=0; jt<order; jt+=tile_size) {
+              for (auto i=it; i<std::min(order,it+tile_size); i++) {
+                for (auto j=jt; j<std::min(order,jt+tile_size); j++) {
+                  B[i*order+j] += A[j*order+i];
+                  A[j*order+i] += 1.0;
+                }
               }
             }
           }
         }
       } else {
-        OMP_TASKLOOP( firstprivate(order) shared(A,B) grainsize(gs) )
-        for (auto i=0;i<order; i++) {
-          for (auto j=0;j<order;j++) {
-            B[i*order+j] += A[j*order+i];
-            A[j*order+i] += 1.0;
+        if (gs > 0) {
+          OMP_TASKLOOP( firstprivate(order) shared(A,B) grainsize(gs) )
+          for (auto i=0;i<order; i++) {
+            for (auto j=0;j<order;j++) {
+              B[i*order+j] += A[j*order+i];
+              A[j*order+i] += 1.0;
+            }
+          }
+        } else {
+          OMP_TASKLOOP( firstprivate(order) shared(A,B) num_tasks(-gs) )
+          for (auto i=0;i<order; i++) {
+            for (auto j=0;j<order;j++) {
+              B[i*order+j] += A[j*order+i];
+              A[j*order+i] += 1.0;
+            }
           }
         }
       }
       OMP_TASKWAIT
     }
-    trans_time = prk::wtime() - trans_time;
+    task_time = prk::wtime() - trans_time;
   }
 
+  if (compare) {
+    // identical sweeps without per-iteration task creation; the delta to
+    // the taskloop phase is what task graph reuse could amortize
+    double t1 = prk::wtime();
+    OMP_PARALLEL()
+    {
+      for (auto iter = half+1; iter<=iterations; iter++) {
+        if (tile_size < order) {
+          OMP_FOR()
+          for (auto it=0; it<order; it+=tile_size) {
+            for (auto jt=0; jt<order; jt+=tile_size) {
+              for (auto i=it; i<std::min(order,it+tile_size); i++) {
+                for (auto j=jt; j<std::min(order,jt+tile_size); j++) {
+                  B[i*order+j] += A[j*order+i];
+                  A[j*order+i] += 1.0;
+                }
+              }
+            }
+          }
+        } else {
+          OMP_FOR()
+          for (auto i=0;i<order; i++) {
+            for (auto j=0;j<order;j++) {
+              B[i*order+j] += A[j*order+i];
+              A[j*order+i] += 1.0;
+            }
+          }
+        }
+      }
+    }
+    ws_time = prk::wtime() - t1;
+  }
+  trans_time = task_time + ws_time;
+
   //////////////////////////////////////////////////////////////////////
   /// Analyze and output results
   //////////////////////////////////////////////////////////////////////
@@ -188,6 +272,13 @@ int main(int argc, char * argv[])
     auto bytes = (size_t)order * (size_t)order * sizeof(double);
     std::cout << "Rate (MB/s): " << 1.0e-6 * (2L*bytes)/avgtime
               << " Avg time (s): " << avgtime << std::endl;
+    if (compare) {
+      double t_task = task_time/half;
+      double t_ws   = ws_time/(iterations-half);
+      std::cout << "Sweep time/iter (s): " << t_task << " (taskloop) "
+                << t_ws << " (worksharing), task overhead "
+                << t_task-t_ws << std::endl;
+    }
   } else {
     std::cout << "ERROR: Aggregate squared error " << abserr
               << " exceeds threshold " << epsilon << std::endl;
@@ -79,12 +79,13 @@ int main(int argc, char * argv[])
       }
 
       // order of a the matrix
-      order = std::atoi(argv[2]);
-      if (order <= 0) {
+      const size_t order_input = prk::parse_size(argv[2]);
+      if (order_input == 0) {
         throw "ERROR: Matrix Order must be greater than 0";
-      } else if (order > std::floor(std::sqrt(INT_MAX))) {
+      } else if (order_input > (size_t)std::floor(std::sqrt(INT_MAX))) {
         throw "ERROR: matrix dimension too large - overflow risk";
       }
+      order = (int)order_input;
 
       // default tile size for tiling of local transpose
       tile_size = (argc>3) ? std::atoi(argv[3]) : 32;
@@ -100,11 +101,18 @@ int main(int argc, char * argv[])
   int num_threads = (envvar!=NULL) ? std::atoi(envvar) : tbb::task_scheduler_init::default_num_threads();
   tbb::task_scheduler_init init(num_threads);
 
+  const auto part = prk::TBB::get_partitioner();
+  // the tile size doubles as the default grainsize, so that the simple
+  // partitioner decomposes the matrix into exactly tile_size tiles
+  const int grainsize = (int)prk::TBB::get_grainsize(tile_size);
+  tbb::affinity_partitioner ap;
+
   std::cout << "Number of threads    = " << num_threads << std::endl;
   std::cout << "Number of iterations = " << iterations << std::endl;
   std::cout << "Matrix order         = " << order << std::endl;
   std::cout << "Tile size            = " << tile_size << std::endl;
-  std::cout << "TBB partitioner: " << typeid(tbb_partitioner).name() << std::endl;
+  std::cout << "TBB partitioner      = " << prk::TBB::partitioner_name(part) << std::endl;
+  std::cout << "TBB grainsize        = " << grainsize << std::endl;
 
   //////////////////////////////////////////////////////////////////////
   // Allocate space and perform the computation
@@ -115,8 +123,8 @@ int main(int argc, char * argv[])
   prk::vector<double> A(order*order);
   prk::vector<double> B(order*order);
 
-  tbb::blocked_range2d<int> range(0, order, tile_size, 0, order, tile_size);
-  tbb::parallel_for( range, [&](decltype(range)& r) {
+  tbb::blocked_range2d<int> range(0, order, grainsize, 0, order, grainsize);
+  prk::TBB::parallel_for( range, [&](decltype(range)& r) {
                      for (auto i=r.rows().begin(); i!=r.rows().end(); ++i ) {
                          PRAGMA_SIMD
                          for (auto j=r.cols().begin(); j!=r.cols().end(); ++j ) {
@@ -124,11 +132,11 @@ int main(int argc, char * argv[])
                              B[i*order+j] = 0.0;
                          }
                      }
-                   }, tbb_partitioner);
+                   }, part, ap);
 
   for (auto iter = 0; iter<=iterations; iter++) {
     if (iter==1) trans_time = prk::wtime();
-    tbb::parallel_for( range, [&](decltype(range)& r) {
+    prk::TBB::parallel_for( range, [&](decltype(range)& r) {
                        for (auto i=r.rows().begin(); i!=r.rows().end(); ++i ) {
                            PRAGMA_SIMD
                            for (auto j=r.cols().begin(); j!=r.cols().end(); ++j ) {
@@ -136,7 +144,7 @@ int main(int argc, char * argv[])
                                 A[j*order+i] += 1.0;
                            }
                        }
-                     }, tbb_partitioner);
+                     }, part, ap);
   }
   trans_time = prk::wtime() - trans_time;
 
@@ -157,7 +165,7 @@ int main(int argc, char * argv[])
     }
   }
 #else
-  abserr = tbb::parallel_reduce( range, double(0),
+  abserr = prk::TBB::parallel_reduce( range, double(0),
                                  [&](decltype(range)& r, double temp) -> double {
                                      for (auto i=r.rows().begin(); i!=r.rows().end(); ++i ) {
                                          for (auto j=r.cols().begin(); j!=r.cols().end(); ++j ) {
@@ -170,7 +178,7 @@ int main(int argc, char * argv[])
                                      return temp;
                                  },
                                  [] (const double x1, const double x2) { return x1+x2; },
-                                 tbb_partitioner );
+                                 part, ap );
 #endif
 
 #ifdef VERBOSE
@@ -126,6 +126,12 @@ int main(int argc, char * argv[])
       return 1;
   }
 
+  // tasks are executed by persistent workers, so that small orders measure
+  // the transpose and not thread creation
+  const int pool_size = num_threads;
+  prk::thread_pool pool(pool_size);
+  std::cout << "Number of pool workers= " << pool_size << std::endl;
+
   //////////////////////////////////////////////////////////////////////
   // Allocate space and perform the computation
   //////////////////////////////////////////////////////////////////////
@@ -138,7 +144,7 @@ int main(int argc, char * argv[])
 
   auto trans_time = 0.0;
 
-  std::vector<std::thread> pool;
+  std::vector<std::future<void>> futures;
 
   for (auto iter = 0; iter<=iterations; iter++) {
 
@@ -146,7 +152,7 @@ int main(int argc, char * argv[])
 
     for (auto ib=0; ib<order; ib+=block_size) {
       for (auto jb=0; jb<order; jb+=block_size) {
-        pool.push_back(std::thread([=,&A,&B] {
+        futures.push_back(pool.submit([=,&A,&B] {
           for (auto it=ib; it<std::min(order,ib+block_size); it+=tile_size) {
             for (auto jt=jb; jt<std::min(order,jb+block_size); jt+=tile_size) {
               for (auto i=it; i<std::min(ib+block_size,it+tile_size); i++) {
@@ -160,8 +166,8 @@ int main(int argc, char * argv[])
         } ));
       }
     }
-    std::for_each(pool.begin(), pool.end(), [](std::thread & t) { t.join(); });
-    pool.clear();
+    std::for_each(futures.begin(), futures.end(), [](std::future<void> & f) { f.wait(); });
+    futures.clear();
   }
   trans_time = prk::wtime() - trans_time;
 
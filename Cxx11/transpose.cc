@@ -36,13 +36,22 @@
 /// PURPOSE: This program measures the time for the transpose of a
 ///          column-major stored matrix into a row-major stored matrix.
 ///
-/// USAGE:   Program input is the matrix order and the number of times to
+/// USAGE:   Program input is the matrix shape and the number of times to
 ///          repeat the operation:
 ///
-///          transpose <matrix_size> <# iterations> [tile size]
+///          transpose <# iterations> <rows>[x<cols>] [tile size] [mode]
 ///
-///          An optional parameter specifies the tile size used to divide the
-///          individual matrix blocks for improved cache and TLB performance.
+///          A bare dimension gives a square matrix; <rows>x<cols> gives a
+///          rectangular one.  An optional parameter specifies the tile size
+///          used to divide the individual matrix blocks for improved cache
+///          and TLB performance.  The final optional argument selects the
+///          transpose mode: "inplace" uses pairwise swaps for a square
+///          matrix and cycle following for a rectangular one, so
+///          memory-constrained configurations can be measured without the
+///          second array; "compressed" stores A in a frame-of-reference
+///          block format (a double base per block plus 16-bit deltas) and
+///          decompresses tiles on the fly, trading decode arithmetic for
+///          memory traffic the way compressed columnar stores do.
 ///
 ///          The output consists of diagnostics to make sure the
 ///          transpose worked and timing statistics.
@@ -64,11 +73,13 @@ int main(int argc, char * argv[])
   //////////////////////////////////////////////////////////////////////
 
   int iterations;
-  int order;
+  int rows, cols;
   int tile_size;
+  bool inplace = false;
+  bool compressed = false;
   try {
       if (argc < 3) {
-        throw "Usage: <# iterations> <matrix order> [tile size]";
+        throw "Usage: <# iterations> <rows>[x<cols>] [tile size] [inplace|outofplace|compressed]";
       }
 
       iterations  = std::atoi(argv[1]);
@@ -76,26 +87,66 @@ int main(int argc, char * argv[])
         throw "ERROR: iterations must be >= 1";
       }
 
-      order = std::atoi(argv[2]);
-      if (order <= 0) {
-        throw "ERROR: Matrix Order must be greater than 0";
-      } else if (order > std::floor(std::sqrt(INT_MAX))) {
-        throw "ERROR: matrix dimension too large - overflow risk";
+      // a bare dimension is a square matrix, <rows>x<cols> a rectangular one
+      const std::string shape(argv[2]);
+      const auto x = shape.find('x');
+      const size_t rows_input = prk::parse_size(shape.substr(0,x).c_str());
+      const size_t cols_input = (x == std::string::npos) ? rows_input : prk::parse_size(shape.substr(x+1).c_str());
+      if (rows_input == 0 || cols_input == 0) {
+        throw "ERROR: Matrix dimensions must be greater than 0";
+      } else if (rows_input > INT_MAX || cols_input > INT_MAX || rows_input*cols_input > INT_MAX) {
+        throw "ERROR: matrix dimensions too large - overflow risk";
       }
+      rows = (int)rows_input;
+      cols = (int)cols_input;
 
       // default tile size for tiling of local transpose
       tile_size = (argc>3) ? std::atoi(argv[3]) : 32;
       // a negative tile size means no tiling of the local transpose
-      if (tile_size <= 0) tile_size = order;
+      if (tile_size <= 0) tile_size = std::max(rows,cols);
+
+      if (argc > 4) {
+        const std::string mode(argv[4]);
+        if (mode == "inplace") {
+          inplace = true;
+        } else if (mode == "compressed") {
+          compressed = true;
+        } else if (mode != "outofplace") {
+          throw "ERROR: transpose mode must be inplace, outofplace or compressed";
+        }
+      }
   }
   catch (const char * e) {
     std::cout << e << std::endl;
     return 1;
   }
 
+  // PRK_OOC_DIR switches the out-of-place matrices to file-backed
+  // storage, for shapes that exceed memory
+  const char * ooc_path = prk::ooc_dir();
+#if !defined(__linux__)
+  if (ooc_path != nullptr) {
+    std::cout << "PRK_OOC_DIR ignored: file-backed arrays require Linux" << std::endl;
+    ooc_path = nullptr;
+  }
+#endif
+  if (ooc_path != nullptr && (inplace || compressed)) {
+    std::cout << "PRK_OOC_DIR ignored: only the out-of-place transpose is file-backed" << std::endl;
+    ooc_path = nullptr;
+  }
+  const bool ooc = (ooc_path != nullptr);
+
   std::cout << "Number of iterations = " << iterations << std::endl;
-  std::cout << "Matrix order         = " << order << std::endl;
+  std::cout << "Startup time (s)     = " << prk::startup_time() << std::endl;
+  std::cout << "Matrix shape         = " << rows << "x" << cols << std::endl;
   std::cout << "Tile size            = " << tile_size << std::endl;
+  const char * mode_name = inplace ? "inplace" : compressed ? "compressed" : "outofplace";
+  std::cout << "Transpose mode       = " << (inplace ? "in-place" :
+                                             compressed ? "compressed (frame-of-reference)" :
+                                             "out-of-place") << std::endl;
+  if (ooc) {
+    std::cout << "Backing store        = file-backed (" << ooc_path << ")" << std::endl;
+  }
 
   //////////////////////////////////////////////////////////////////////
   // Allocate space and perform the computation
@@ -103,74 +154,325 @@ int main(int argc, char * argv[])
 
   auto trans_time = 0.0;
 
-  prk::vector<double> A(order*order);
-  prk::vector<double> B(order*order,0.0);
+  prk::counters perf;
+
+  prk::adaptive adapt;
+
+  prk::timing tstats(iterations);
+
+  prk::results res("transpose");
+  res.set("iterations", iterations);
+  res.set("rows", rows);
+  res.set("cols", cols);
+  res.set("tile_size", tile_size);
+  res.set("mode", mode_name);
+
+  prk::baseline base("transpose");
+  base.set("rows", rows);
+  base.set("cols", cols);
+  base.set("tile_size", tile_size);
+  base.set("mode", mode_name);
+
+  // the verification scalars do not depend on the tile size, so the
+  // golden record is keyed only by what determines the arithmetic
+  prk::golden gold("transpose");
+  gold.set("rows", rows);
+  gold.set("cols", cols);
+  gold.set("mode", mode_name);
+
+  const size_t nelems = static_cast<size_t>(rows)*cols;
+
+  prk::vector<double> A((compressed || ooc) ? 0 : nelems);
+  prk::vector<double> B((inplace || ooc) ? 0 : nelems, 0.0);
+#if defined(__linux__)
+  std::unique_ptr<prk::filemap<double>> fA, fB;
+  if (ooc) {
+    try {
+      fA.reset(new prk::filemap<double>(ooc_path, "A", nelems));
+      // file holes read as zero, so B needs no explicit fill
+      fB.reset(new prk::filemap<double>(ooc_path, "B", nelems));
+    }
+    catch (const char * e) {
+      std::cout << e << std::endl;
+      return 1;
+    }
+  }
+  double * Ap = ooc ? fA->data() : A.data();
+  double * Bp = ooc ? fB->data() : B.data();
+#else
+  double * Ap = A.data();
+  double * Bp = B.data();
+#endif
+  // marks moved elements during cycle following
+  std::vector<bool> moved(inplace && rows != cols ? nelems : 0);
 
-  // fill A with the sequence 0 to order^2-1 as doubles
-  std::iota(A.begin(), A.end(), 0.0);
+  // frame-of-reference storage: each row is split into blocks of
+  // comp_block elements, stored as a double base plus 16-bit deltas.
+  // The iota fill makes every block a base + 0..comp_block-1 ramp, and
+  // the per-iteration "A += 1" touches only the bases - the same way a
+  // columnar store patches a frame instead of rewriting its codes
+  constexpr int comp_block = 4096;
+  const size_t blocks_per_row = compressed ? ((size_t)cols + comp_block - 1)/comp_block : 0;
+  prk::vector<double> bases(compressed ? (size_t)rows*blocks_per_row : 0);
+  prk::vector<uint16_t> deltas(compressed ? nelems : 0);
+
+  if (compressed) {
+    for (size_t i=0; i<(size_t)rows; i++) {
+      for (size_t jb=0; jb<blocks_per_row; jb++) {
+        bases[i*blocks_per_row+jb] = static_cast<double>(i*cols + jb*comp_block);
+      }
+      for (size_t j=0; j<(size_t)cols; j++) {
+        deltas[i*cols+j] = static_cast<uint16_t>(j % comp_block);
+      }
+    }
+  } else {
+    // fill A with the sequence 0 to rows*cols-1 as doubles
+    std::iota(Ap, Ap+nelems, 0.0);
+  }
+
+  // the in-place transpose of a rectangular matrix toggles its shape
+  int cur_rows = rows;
+  int cur_cols = cols;
 
   {
-    for (auto iter = 0; iter<=iterations; iter++) {
+    for (auto iter = 0; ; iter++) {
+
+      if (iter==1) { trans_time = prk::wtime(); perf.start(); }
 
-      if (iter==1) trans_time = prk::wtime();
+      const bool sample = res.enabled() || tstats.enabled() || adapt.enabled();
+      const double it0 = sample ? prk::wtime() : 0.0;
 
       // transpose the  matrix
-      if (tile_size < order) {
-        for (auto it=0; it<order; it+=tile_size) {
-          for (auto jt=0; jt<order; jt+=tile_size) {
-            for (auto i=it; i<std::min(order,it+tile_size); i++) {
-              for (auto j=jt; j<std::min(order,jt+tile_size); j++) {
-                B[i*order+j] += A[j*order+i];
-                A[j*order+i] += 1.0;
+      if (inplace && rows == cols) {
+        // pairwise swaps above the diagonal
+        for (auto i=0; i<rows; i++) {
+          for (auto j=i+1; j<cols; j++) {
+            std::swap(A[i*cols+j], A[j*cols+i]);
+          }
+        }
+        for (size_t p=0; p<nelems; p++) A[p] += 1.0;
+      } else if (inplace) {
+        // cycle following: element idx of the cur_rows x cur_cols matrix
+        // moves to (idx*cur_rows) mod (nelems-1), the first and last
+        // elements stay put
+        const size_t nm1 = nelems-1;
+        std::fill(moved.begin(), moved.end(), false);
+        for (size_t start=1; start<nm1; start++) {
+          if (moved[start]) continue;
+          double carry = A[start];
+          size_t idx = start;
+          do {
+            const size_t next = (idx*cur_rows) % nm1;
+            std::swap(carry, A[next]);
+            moved[idx] = true;
+            idx = next;
+          } while (idx != start);
+        }
+        std::swap(cur_rows, cur_cols);
+        for (size_t p=0; p<nelems; p++) A[p] += 1.0;
+      } else if (compressed) {
+        // decompress tiles on the fly: B accumulates base + delta, and
+        // the A update reduces to bumping the block bases
+        for (auto it=0; it<rows; it+=tile_size) {
+          for (auto jt=0; jt<cols; jt+=tile_size) {
+            for (auto i=it; i<std::min(rows,it+tile_size); i++) {
+              const double * brow = &bases[(size_t)i*blocks_per_row];
+              const uint16_t * drow = &deltas[(size_t)i*cols];
+              for (auto j=jt; j<std::min(cols,jt+tile_size); j++) {
+                B[(size_t)j*rows+i] += brow[j/comp_block] + drow[j];
+              }
+            }
+          }
+        }
+        for (auto & fb : bases) fb += 1.0;
+      } else if (tile_size < std::max(rows,cols)) {
+#if defined(__linux__)
+        if (ooc) fA->will_need(0, (size_t)tile_size*cols);
+#endif
+        for (auto it=0; it<rows; it+=tile_size) {
+#if defined(__linux__)
+          if (ooc) {
+            // rows of A are read band by band: start readahead of the
+            // next band while this one computes, and drop the band just
+            // finished so its dirty pages stream back to the file
+            fA->will_need((size_t)(it+tile_size)*cols, (size_t)tile_size*cols);
+            if (it >= tile_size) {
+              fA->done_with((size_t)(it-tile_size)*cols, (size_t)tile_size*cols);
+            }
+          }
+#endif
+          for (auto jt=0; jt<cols; jt+=tile_size) {
+            for (auto i=it; i<std::min(rows,it+tile_size); i++) {
+              for (auto j=jt; j<std::min(cols,jt+tile_size); j++) {
+                Bp[(size_t)j*rows+i] += Ap[(size_t)i*cols+j];
+                Ap[(size_t)i*cols+j] += 1.0;
               }
             }
           }
         }
       } else {
-        for (auto i=0;i<order; i++) {
-          for (auto j=0;j<order;j++) {
-            B[i*order+j] += A[j*order+i];
-            A[j*order+i] += 1.0;
+        for (auto i=0;i<rows; i++) {
+          for (auto j=0;j<cols;j++) {
+            Bp[(size_t)j*rows+i] += Ap[(size_t)i*cols+j];
+            Ap[(size_t)i*cols+j] += 1.0;
           }
         }
       }
+
+      double dt(0);
+      if (sample && iter>0) {
+        dt = prk::wtime()-it0;
+        res.iteration(dt);
+        tstats.record(dt);
+      }
+      if (iter>0 && adapt.done(iter, iterations, dt)) {
+        iterations = iter;
+        break;
+      }
     }
     trans_time = prk::wtime() - trans_time;
+    perf.stop();
   }
 
+  // keyed after the run because adaptive mode may shorten the iteration
+  // count, and the scalars depend on the count actually executed
+  gold.set("iterations", iterations);
+
   //////////////////////////////////////////////////////////////////////
   /// Analyze and output results
   //////////////////////////////////////////////////////////////////////
 
-  const auto addit = (iterations+1.) * (iterations/2.);
-  double abserr(0);
-  // TODO: replace with std::generate, std::accumulate, or similar
-  for (auto j=0; j<order; j++) {
-    for (auto i=0; i<order; i++) {
-      const int ij = i*order+j;
-      const int ji = j*order+i;
-      const double reference = static_cast<double>(ij)*(1.+iterations)+addit;
-      abserr += std::fabs(B[ji] - reference);
+  double abserr;
+  if (inplace) {
+    // an even number of transposes is the identity and the uniform
+    // increments commute with transposition, so after an untimed fixup
+    // transpose (when the count is odd) every element must be exactly
+    // its initial value plus the iteration count
+    if ((iterations+1)%2 == 1) {
+      if (rows == cols) {
+        for (auto i=0; i<rows; i++)
+          for (auto j=i+1; j<cols; j++)
+            std::swap(A[i*cols+j], A[j*cols+i]);
+      } else {
+        const size_t nm1 = nelems-1;
+        std::fill(moved.begin(), moved.end(), false);
+        for (size_t start=1; start<nm1; start++) {
+          if (moved[start]) continue;
+          double carry = A[start];
+          size_t idx = start;
+          do {
+            const size_t next = (idx*cur_rows) % nm1;
+            std::swap(carry, A[next]);
+            moved[idx] = true;
+            idx = next;
+          } while (idx != start);
+        }
+      }
     }
+    abserr = 0.0;
+    for (size_t p=0; p<nelems; p++) {
+      abserr += std::fabs(A[p] - (static_cast<double>(p) + (iterations+1)));
+    }
+  } else {
+    // all updates are exact in double, so the sum of B is as well; compare it
+    // against its closed-form value instead of making a second O(rows*cols)
+    // pass that builds the per-element reference
+    const long double addit = (iterations+1.) * (iterations/2.);
+    const long double n2 = static_cast<long double>(nelems);
+    const long double reference = (n2-1.0L)*n2/2.0L*(1.0L+iterations) + n2*addit;
+    long double checksum(0);
+    for (size_t p=0; p<nelems; p++) checksum += Bp[p];
+    abserr = static_cast<double>(std::fabs(checksum-reference)/reference);
+    gold.check("checksum", static_cast<double>(checksum));
   }
 
-#ifdef VERBOSE
-  std::cout << "Sum of absolute differences: " << abserr << std::endl;
-#endif
-
   const auto epsilon = 1.0e-8;
   if (abserr < epsilon) {
     std::cout << "Solution validates" << std::endl;
+    gold.check("abserr", abserr);
+    adapt.report();
     auto avgtime = trans_time/iterations;
-    auto bytes = (size_t)order * (size_t)order * sizeof(double);
+    auto bytes = nelems * sizeof(double);
     std::cout << "Rate (MB/s): " << 1.0e-6 * (2L*bytes)/avgtime
               << " Avg time (s): " << avgtime << std::endl;
+    if (compressed) {
+      // the Rate line above counts the logical (decompressed) elements;
+      // the physical traffic reads the deltas and bases and writes B
+      const auto a_phys = nelems*sizeof(uint16_t) + bases.size()*sizeof(double);
+      const auto phys_bytes = a_phys + nelems*sizeof(double);
+      std::cout << "Physical rate (MB/s): " << 1.0e-6 * phys_bytes/avgtime
+                << " (A compressed " << static_cast<double>(bytes)/a_phys
+                << "x, block " << comp_block << ")" << std::endl;
+    }
+    perf.report(trans_time, 0.0, 2.0*bytes*iterations, iterations);
+    tstats.report();
+    res.set("rate_mbs", 1.0e-6 * (2L*bytes)/avgtime);
+    res.set("avgtime", avgtime);
+    res.emit();
+    base.check("rate_mbs", 1.0e-6 * (2L*bytes)/avgtime);
   } else {
-    std::cout << "ERROR: Aggregate squared error " << abserr
+    std::cout << "ERROR: Relative checksum error " << abserr
               << " exceeds threshold " << epsilon << std::endl;
     return 1;
   }
 
+  // PRK_PAGE_COMPARE=1 reruns the out-of-place sweep on freshly
+  // allocated arrays with base pages and then with transparent
+  // hugepages, counting dTLB misses and page faults for each, so one
+  // command answers whether this working set benefits from hugepages.
+  // The counters include the first touch of the arrays, where the two
+  // page sizes fault very differently.
+  if (std::getenv("PRK_PAGE_COMPARE") != nullptr) {
+    const char * saved = std::getenv("PRK_HUGEPAGES");
+    const std::string saved_copy = (saved != nullptr) ? saved : "";
+
+    auto page_run = [&](const char * label, const char * mode) {
+      // the allocator reads PRK_HUGEPAGES on every allocation, so
+      // switching the environment between the runs is sufficient
+      if (mode == nullptr) unsetenv("PRK_HUGEPAGES");
+      else                 setenv("PRK_HUGEPAGES", mode, 1);
+      prk::counters c(true);
+      std::cout << std::setw(12) << label;
+      c.start();
+      prk::vector<double> PA(nelems);
+      prk::vector<double> PB(nelems, 0.0);
+      std::iota(PA.begin(), PA.end(), 0.0);
+      double t = prk::wtime();
+      for (int iter = 0; iter<=iterations; iter++) {
+        for (auto it=0; it<rows; it+=tile_size) {
+          for (auto jt=0; jt<cols; jt+=tile_size) {
+            for (auto i=it; i<std::min(rows,it+tile_size); i++) {
+              for (auto j=jt; j<std::min(cols,jt+tile_size); j++) {
+                PB[(size_t)j*rows+i] += PA[(size_t)i*cols+j];
+                PA[(size_t)i*cols+j] += 1.0;
+              }
+            }
+          }
+        }
+      }
+      t = prk::wtime() - t;
+      c.stop();
+      const auto bytes = nelems * sizeof(double);
+      std::cout << std::setw(12) << 1.0e-6 * (2L*bytes)/(t/iterations)
+                << std::setw(18) << c.dtlb_misses()/static_cast<double>(iterations)
+                << std::setw(18) << c.page_faults()/static_cast<double>(iterations)
+                << std::endl;
+      return t;
+    };
+
+    std::cout << "Page size comparison (out-of-place tiled sweep):" << std::endl;
+    std::cout << std::setw(12) << "Pages"
+              << std::setw(12) << "Rate (MB/s)"
+              << std::setw(18) << "dTLB misses/iter"
+              << std::setw(18) << "page faults/iter" << std::endl;
+    const double t_base = page_run("4K", nullptr);
+    const double t_huge = page_run("2M (THP)", "transparent");
+    std::cout << "Hugepage speedup: " << t_base/t_huge << std::endl;
+
+    if (saved != nullptr) setenv("PRK_HUGEPAGES", saved_copy.c_str(), 1);
+    else                  unsetenv("PRK_HUGEPAGES");
+  }
+
   return 0;
 }
 
@@ -0,0 +1,61 @@
+// Generated by generate-unity.py - do not edit.
+
+#define main prk_p2p_hyperplane_openmp_main
+#include "p2p-hyperplane-openmp.cc"
+#undef main
+
+#define main prk_stencil_openmp_main
+#include "stencil-openmp.cc"
+#undef main
+
+#define main prk_transpose_openmp_main
+#include "transpose-openmp.cc"
+#undef main
+
+#define main prk_nstream_openmp_main
+#include "nstream-openmp.cc"
+#undef main
+
+#define main prk_gather_openmp_main
+#include "gather-openmp.cc"
+#undef main
+
+#define main prk_reduce_openmp_main
+#include "reduce-openmp.cc"
+#undef main
+
+#define main prk_random_openmp_main
+#include "random-openmp.cc"
+#undef main
+
+#define main prk_pic_openmp_main
+#include "pic-openmp.cc"
+#undef main
+
+#include <cstring>
+
+int main(int argc, char * argv[])
+{
+  if (argc > 1) {
+    if (std::strcmp(argv[1],"p2p-hyperplane-openmp") == 0) return prk_p2p_hyperplane_openmp_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"stencil-openmp") == 0) return prk_stencil_openmp_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"transpose-openmp") == 0) return prk_transpose_openmp_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"nstream-openmp") == 0) return prk_nstream_openmp_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"gather-openmp") == 0) return prk_gather_openmp_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"reduce-openmp") == 0) return prk_reduce_openmp_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"random-openmp") == 0) return prk_random_openmp_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"pic-openmp") == 0) return prk_pic_openmp_main(argc-1, argv+1);
+  }
+  std::cout << "Usage: <kernel> <kernel arguments>" << std::endl;
+  std::cout << "Available kernels:";
+  std::cout << " p2p-hyperplane-openmp";
+  std::cout << " stencil-openmp";
+  std::cout << " transpose-openmp";
+  std::cout << " nstream-openmp";
+  std::cout << " gather-openmp";
+  std::cout << " reduce-openmp";
+  std::cout << " random-openmp";
+  std::cout << " pic-openmp";
+  std::cout << std::endl;
+  return 1;
+}
@@ -0,0 +1,73 @@
+// Generated by generate-unity.py - do not edit.
+
+#define main prk_p2p_main
+#include "p2p.cc"
+#undef main
+
+#define main prk_stencil_main
+#include "stencil.cc"
+#undef main
+
+#define main prk_transpose_main
+#include "transpose.cc"
+#undef main
+
+#define main prk_nstream_main
+#include "nstream.cc"
+#undef main
+
+#define main prk_gather_main
+#include "gather.cc"
+#undef main
+
+#define main prk_dgemm_main
+#include "dgemm.cc"
+#undef main
+
+#define main prk_sparse_main
+#include "sparse.cc"
+#undef main
+
+#define main prk_reduce_main
+#include "reduce.cc"
+#undef main
+
+#define main prk_random_main
+#include "random.cc"
+#undef main
+
+#define main prk_pic_main
+#include "pic.cc"
+#undef main
+
+#include <cstring>
+
+int main(int argc, char * argv[])
+{
+  if (argc > 1) {
+    if (std::strcmp(argv[1],"p2p") == 0) return prk_p2p_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"stencil") == 0) return prk_stencil_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"transpose") == 0) return prk_transpose_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"nstream") == 0) return prk_nstream_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"gather") == 0) return prk_gather_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"dgemm") == 0) return prk_dgemm_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"sparse") == 0) return prk_sparse_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"reduce") == 0) return prk_reduce_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"random") == 0) return prk_random_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"pic") == 0) return prk_pic_main(argc-1, argv+1);
+  }
+  std::cout << "Usage: <kernel> <kernel arguments>" << std::endl;
+  std::cout << "Available kernels:";
+  std::cout << " p2p";
+  std::cout << " stencil";
+  std::cout << " transpose";
+  std::cout << " nstream";
+  std::cout << " gather";
+  std::cout << " dgemm";
+  std::cout << " sparse";
+  std::cout << " reduce";
+  std::cout << " random";
+  std::cout << " pic";
+  std::cout << std::endl;
+  return 1;
+}
@@ -0,0 +1,49 @@
+// Generated by generate-unity.py - do not edit.
+
+#define main prk_p2p_vector_tbb_main
+#include "p2p-vector-tbb.cc"
+#undef main
+
+#define main prk_transpose_vector_tbb_main
+#include "transpose-vector-tbb.cc"
+#undef main
+
+#define main prk_nstream_vector_tbb_main
+#include "nstream-vector-tbb.cc"
+#undef main
+
+#define main prk_reduce_tbb_main
+#include "reduce-tbb.cc"
+#undef main
+
+#define main prk_random_tbb_main
+#include "random-tbb.cc"
+#undef main
+
+#define main prk_pic_tbb_main
+#include "pic-tbb.cc"
+#undef main
+
+#include <cstring>
+
+int main(int argc, char * argv[])
+{
+  if (argc > 1) {
+    if (std::strcmp(argv[1],"p2p-vector-tbb") == 0) return prk_p2p_vector_tbb_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"transpose-vector-tbb") == 0) return prk_transpose_vector_tbb_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"nstream-vector-tbb") == 0) return prk_nstream_vector_tbb_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"reduce-tbb") == 0) return prk_reduce_tbb_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"random-tbb") == 0) return prk_random_tbb_main(argc-1, argv+1);
+    if (std::strcmp(argv[1],"pic-tbb") == 0) return prk_pic_tbb_main(argc-1, argv+1);
+  }
+  std::cout << "Usage: <kernel> <kernel arguments>" << std::endl;
+  std::cout << "Available kernels:";
+  std::cout << " p2p-vector-tbb";
+  std::cout << " transpose-vector-tbb";
+  std::cout << " nstream-vector-tbb";
+  std::cout << " reduce-tbb";
+  std::cout << " random-tbb";
+  std::cout << " pic-tbb";
+  std::cout << std::endl;
+  return 1;
+}
@@ -46,6 +46,15 @@ USAGE:   The program takes as input the linear dimension of the grid,
                <progname> <# iterations> <grid size> <spare ranks> \
                           <kill set size> <kill period> <checkpointing>
 
+         A checkpointing value of zero means data is recovered
+         analytically.  A positive value k makes each rank take an
+         in-memory checkpoint every k iterations: it snapshots its own
+         tile and replicates the snapshot asynchronously to a buddy rank
+         half the rank ring away, so the replication overlaps with
+         subsequent compute.  After a failure all ranks roll back to the
+         last checkpoint; recovered ranks obtain their tile from their
+         buddy.
+
          The output consists of diagnostics to make sure the
          algorithm worked, and of timing statistics.
 
@@ -102,6 +111,23 @@ HISTORY: - Written by Rob Van der Wijngaart, November 2006.
 #define OUT(i,j)      out[INDEXOUT(i-istart,j-jstart)]
 #define WEIGHT(ii,jj) weight[ii+RADIUS][jj+RADIUS]
 
+/* compute tile dimensions of any rank, using the same decomposition as the
+   calling rank applies to itself; needed to size the buddy's replica buffers   */
+static void tile_dims(int ID, int Num_procsx, int Num_procsy, int n,
+                      int *width, int *height)
+{
+  int IDx = ID%Num_procsx, IDy = ID/Num_procsx;
+  int base, leftover;
+
+  base     = n/Num_procsx;
+  leftover = n%Num_procsx;
+  *width   = (IDx<leftover) ? base+1 : base;
+
+  base     = n/Num_procsy;
+  leftover = n%Num_procsy;
+  *height  = (IDy<leftover) ? base+1 : base;
+}
+
 void time_step(int    Num_procsx, int Num_procsy,
 	       int    my_IDx, int my_IDy,
 	       int    right_nbr,
@@ -172,8 +198,17 @@ int main(int argc, char ** argv) {
   int    *fail_iter;      /* list of iterations when a failure will be triggered */
   int    fail_iter_s=0;   /* latest  */
   DTYPE  init_add;        /* used to offset initial solutions                    */
-  int    checkpointing;   /* indicates if data is restored using Fenix or
-                             analytically                                        */
+  int    checkpointing;   /* 0: restore data analytically; k>0: in-memory
+                             buddy checkpoint every k iterations                 */
+  int    buddy, partner;  /* rank storing my checkpoint replica, and rank
+                             whose replica I store                               */
+  int    partner_status;  /* Fenix role of partner after a failure               */
+  int    pwidth, pheight; /* tile dimensions of partner                          */
+  int    bkp_iter=0;      /* iteration at which the last checkpoint was taken    */
+  int    bkp_pending=0;   /* outstanding buddy replication requests              */
+  DTYPE  *bkp_in, *bkp_out;     /* local snapshot of own tile                    */
+  DTYPE  *buddy_in, *buddy_out; /* replica of partner's snapshot                 */
+  MPI_Request bkp_request[4];   /* requests for asynchronous replication         */
   int    num_fenix_init=1;/* number of times Fenix_Init is called                */
   int    num_fenix_init_loc;/* number of times Fenix_Init was called             */
   int    fenix_status;
@@ -257,8 +292,8 @@ int main(int argc, char ** argv) {
     }
 
     checkpointing = atoi(argv[6]);
-    if (checkpointing) {
-      printf("ERROR: Fenix checkpointing not yet implemented\n");
+    if (checkpointing < 0) {
+      printf("ERROR: checkpoint period must be non-negative: %d\n", checkpointing);
       error = 1;
       goto ENDOFTESTS;     
     }
@@ -300,7 +335,8 @@ int main(int argc, char ** argv) {
     printf("Kill set size            = %d\n", kill_ranks);
     printf("Fault period             = %d\n", kill_period);
     if (checkpointing)
-      printf("Data recovery            = Fenix checkpointing\n");
+      printf("Data recovery            = in-memory checkpointing, period %d\n",
+             checkpointing);
     else
       printf("Data recovery            = analytical\n");
   }
@@ -357,7 +393,8 @@ int main(int argc, char ** argv) {
   switch (fenix_status){
     case FENIX_ROLE_INITIAL_RANK:   iter_init = num_fenix_init_loc = 0;    break;
     case FENIX_ROLE_RECOVERED_RANK: iter_init = num_fenix_init_loc = iterations+1;   break;
-    case FENIX_ROLE_SURVIVOR_RANK:  iter_init = iter;  num_fenix_init_loc++;
+    case FENIX_ROLE_SURVIVOR_RANK:  iter_init = checkpointing ? bkp_iter : iter;
+                                    num_fenix_init_loc++;
   }
 
   MPI_Allreduce(&iter_init, &iter, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
@@ -485,6 +522,87 @@ int main(int argc, char ** argv) {
     bail_out(error);
   }
 
+  /* set up in-memory checkpointing: each rank snapshots its own tile and
+     replicates the snapshot to a buddy half the rank ring away, so that a
+     contiguous kill set smaller than half the ranks never takes out a rank
+     together with its buddy                                                   */
+  if (checkpointing) {
+    buddy   = (my_ID + Num_procs/2)%Num_procs;
+    partner = (my_ID - Num_procs/2 + Num_procs)%Num_procs;
+    tile_dims(partner, Num_procsx, Num_procsy, n, &pwidth, &pheight);
+    if (fenix_status != FENIX_ROLE_SURVIVOR_RANK) {
+      bkp_in    = (DTYPE *) prk_malloc(total_length_in);
+      bkp_out   = (DTYPE *) prk_malloc(total_length_out);
+      buddy_in  = (DTYPE *) prk_malloc((long)(pwidth+2*RADIUS)*
+                            (long)(pheight+2*RADIUS)*sizeof(DTYPE));
+      buddy_out = (DTYPE *) prk_malloc((long)pwidth*(long)pheight*sizeof(DTYPE));
+      if (!bkp_in || !bkp_out || !buddy_in || !buddy_out) {
+        printf("ERROR: rank %d could not allocate space for checkpoints\n", my_ID);
+        error = 1;
+      }
+    }
+    bail_out(error);
+
+    /* the initial state serves as checkpoint zero, so a failure before the
+       first periodic checkpoint rolls back to the beginning                   */
+    if (fenix_status == FENIX_ROLE_INITIAL_RANK) {
+      memcpy(bkp_in,  in,  total_length_in);
+      memcpy(bkp_out, out, total_length_out);
+      if (Num_procs > 1) {
+        MPI_Sendrecv(bkp_in, (width+2*RADIUS)*(height+2*RADIUS), MPI_DTYPE,
+                     buddy, 990,
+                     buddy_in, (pwidth+2*RADIUS)*(pheight+2*RADIUS), MPI_DTYPE,
+                     partner, 990, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        MPI_Sendrecv(bkp_out, width*height, MPI_DTYPE, buddy, 991,
+                     buddy_out, pwidth*pheight, MPI_DTYPE, partner, 991,
+                     MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+      }
+    }
+
+    /* after a failure, roll every rank back to the last checkpoint: survivors
+       restore their own snapshot, recovered ranks obtain theirs from their
+       buddy.  The replicas the failed ranks stored are refreshed at the next
+       checkpoint; a second failure before that point is not recoverable,
+       which is the usual buddy checkpointing caveat                           */
+    partner_status = FENIX_ROLE_INITIAL_RANK;
+    if (Num_procs > 1) {
+      MPI_Sendrecv(&fenix_status, 1, MPI_INT, buddy, 988,
+                   &partner_status, 1, MPI_INT, partner, 988,
+                   MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    }
+    if (fenix_status   == FENIX_ROLE_RECOVERED_RANK &&
+        partner_status == FENIX_ROLE_RECOVERED_RANK) {
+      printf("ERROR: rank %d lost the checkpoint replica of rank %d\n",
+             my_ID, partner);
+      error = 1;
+    }
+    bail_out(error);
+
+    bkp_iter = iter;  /* all ranks checkpoint in the same iteration             */
+    switch (fenix_status) {
+      case FENIX_ROLE_SURVIVOR_RANK:
+        /* replication requests posted before the failure did not survive it   */
+        bkp_pending = 0;
+        memcpy(in,  bkp_in,  total_length_in);
+        memcpy(out, bkp_out, total_length_out);
+        break;
+      case FENIX_ROLE_RECOVERED_RANK:
+        MPI_Recv(bkp_in, (width+2*RADIUS)*(height+2*RADIUS), MPI_DTYPE,
+                 buddy, 990, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        MPI_Recv(bkp_out, width*height, MPI_DTYPE, buddy, 991,
+                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        memcpy(in,  bkp_in,  total_length_in);
+        memcpy(out, bkp_out, total_length_out);
+        break;
+    }
+    if (partner_status == FENIX_ROLE_RECOVERED_RANK) {
+      MPI_Send(buddy_in, (pwidth+2*RADIUS)*(pheight+2*RADIUS), MPI_DTYPE,
+               partner, 990, MPI_COMM_WORLD);
+      MPI_Send(buddy_out, pwidth*pheight, MPI_DTYPE, partner, 991,
+               MPI_COMM_WORLD);
+    }
+  }
+
   for (; iter<=iterations; iter++){
 
     /* start timer after a warmup iteration */
@@ -516,8 +634,38 @@ int main(int argc, char ** argv) {
 	     weight,
 	     request);
 
+    /* take an in-memory checkpoint: snapshot the local tile synchronously,
+       then replicate it to the buddy asynchronously so the transfer overlaps
+       with the following iterations; the snapshot buffers stay untouched
+       until the next checkpoint, so the outstanding sends are safe           */
+    if (checkpointing && (iter+1)%checkpointing == 0) {
+      if (bkp_pending) {
+        MPI_Waitall(4, bkp_request, MPI_STATUSES_IGNORE);
+        bkp_pending = 0;
+      }
+      memcpy(bkp_in,  in,  total_length_in);
+      memcpy(bkp_out, out, total_length_out);
+      bkp_iter = iter+1;
+      if (Num_procs > 1) {
+        MPI_Isend(bkp_in, (width+2*RADIUS)*(height+2*RADIUS), MPI_DTYPE,
+                  buddy, 990, MPI_COMM_WORLD, &(bkp_request[0]));
+        MPI_Isend(bkp_out, width*height, MPI_DTYPE, buddy, 991,
+                  MPI_COMM_WORLD, &(bkp_request[1]));
+        MPI_Irecv(buddy_in, (pwidth+2*RADIUS)*(pheight+2*RADIUS), MPI_DTYPE,
+                  partner, 990, MPI_COMM_WORLD, &(bkp_request[2]));
+        MPI_Irecv(buddy_out, pwidth*pheight, MPI_DTYPE, partner, 991,
+                  MPI_COMM_WORLD, &(bkp_request[3]));
+        bkp_pending = 1;
+      }
+    }
+
   } /* end of iterations                                                   */
 
+  if (bkp_pending) {
+    MPI_Waitall(4, bkp_request, MPI_STATUSES_IGNORE);
+    bkp_pending = 0;
+  }
+
   MPI_Barrier(MPI_COMM_WORLD);
   stencil_time = wtime() - stencil_time;;
 
@@ -41,7 +41,15 @@ PURPOSE: This program tests the efficiency with which a space-invariant,
 USAGE:   The program takes as input the linear dimension of the grid,
          and the number of iterations on the grid
 
-               <progname> <# iterations> <grid size>
+               <progname> <# iterations> <grid size> [SWEEP]
+
+         The optional final argument SWEEP runs the stencil once per
+         coprocess-per-core density (1, 2, 4, ... up to the launched
+         -nfg value), leaving the surplus coprocesses parked in a
+         barrier, and tabulates rate, OS context-switch counts and the
+         overlap gained relative to one coprocess per core.  This
+         evaluates fine-grain oversubscription as a latency-hiding
+         strategy in a single job.
 
          The output consists of diagnostics to make sure the
          algorithm worked, and of timing statistics.
@@ -71,6 +79,9 @@ HISTORY: - Written by Rob Van der Wijngaart, November 2006.
 #include <par-res-kern_general.h>
 #include <par-res-kern_fg-mpi.h>
 
+#include <sys/time.h>
+#include <sys/resource.h>
+
 #if DOUBLE
   #define DTYPE     double
   #define MPI_DTYPE MPI_DOUBLE
@@ -95,187 +106,99 @@ HISTORY: - Written by Rob Van der Wijngaart, November 2006.
 #define OUT(i,j)      out[INDEXOUT(i-istart,j-jstart)]
 #define WEIGHT(ii,jj) weight[ii+RADIUS][jj+RADIUS]
 
-int main(int argc, char ** argv) {
+/* collective error check over comm; bail_out is a world collective and
+   cannot be used inside a run on a subcommunicator                    */
+static int comm_check(MPI_Comm comm, int err)
+{
+  int g;
+  MPI_Allreduce(&err, &g, 1, MPI_INT, MPI_MAX, comm);
+  return g;
+}
 
-  int    Num_procs;       /* number of ranks                                     */
-  int    Num_procsx, Num_procsy; /* number of ranks in each coord direction      */
-  int    my_ID;           /* MPI rank                                            */
-  int    my_IDx, my_IDy;  /* coordinates of rank in rank grid                    */
-  int    right_nbr;       /* global rank of right neighboring tile               */
-  int    left_nbr;        /* global rank of left neighboring tile                */
-  int    top_nbr;         /* global rank of top neighboring tile                 */
-  int    bottom_nbr;      /* global rank of bottom neighboring tile              */
-  DTYPE *top_buf_out;     /* communication buffer                                */
-  DTYPE *top_buf_in;      /*       "         "                                   */
-  DTYPE *bottom_buf_out;  /*       "         "                                   */
-  DTYPE *bottom_buf_in;   /*       "         "                                   */
-  DTYPE *right_buf_out;   /*       "         "                                   */
-  DTYPE *right_buf_in;    /*       "         "                                   */
-  DTYPE *left_buf_out;    /*       "         "                                   */
-  DTYPE *left_buf_in;     /*       "         "                                   */
-  int    root = 0;
-  int    n, width, height;/* linear global and local grid dimension              */
-  long   nsquare;         /* total number of grid points                         */
-  int    i, j, ii, jj, kk, it, jt, iter, leftover;  /* dummies                   */
-  int    istart, iend;    /* bounds of grid tile assigned to calling rank        */
-  int    jstart, jend;    /* bounds of grid tile assigned to calling rank        */
-  DTYPE  norm,            /* L1 norm of solution                                 */
-         local_norm,      /* contribution of calling rank to L1 norm             */
-         reference_norm;
-  DTYPE  f_active_points; /* interior of grid with respect to stencil            */
-  DTYPE  flops;           /* floating point ops per iteration                    */
-  int    iterations;      /* number of times to run the algorithm                */
-  double local_stencil_time,/* timing parameters                                 */
-         stencil_time,
-         avgtime;
-  int    stencil_size;    /* number of points in stencil                         */
-  DTYPE  * RESTRICT in;   /* input grid values                                   */
-  DTYPE  * RESTRICT out;  /* output grid values                                  */
-  long   total_length_in; /* total required length to store input array          */
-  long   total_length_out;/* total required length to store output array         */
-  int    error=0;         /* error flag                                          */
-  DTYPE  weight[2*RADIUS+1][2*RADIUS+1]; /* weights of points in the stencil     */
+/* One complete stencil run over the ranks of comm: decomposition,
+   initialization, timed iterations and verification.  Returns the
+   max-over-comm stencil time, valid on every rank of comm; *error_out
+   is set nonzero on every rank of comm if anything failed             */
+static double run_stencil(MPI_Comm comm, int n, int iterations, int *error_out)
+{
+  int    NP, Num_procsx, Num_procsy; /* comm size and rank grid       */
+  int    ID, IDx, IDy;    /* comm rank and its grid coordinates        */
+  int    right_nbr, left_nbr, top_nbr, bottom_nbr;
+  DTYPE  *top_buf_out=NULL, *top_buf_in, *bottom_buf_out, *bottom_buf_in;
+  DTYPE  *right_buf_out=NULL, *right_buf_in, *left_buf_out, *left_buf_in;
+  int    width, height;   /* local grid dimensions                     */
+  int    i, j, ii, jj, kk, iter, leftover;
+  int    istart, iend;    /* bounds of grid tile of calling rank       */
+  int    jstart, jend;    /* bounds of grid tile of calling rank       */
+  DTYPE  norm, local_norm, reference_norm;
+  DTYPE  f_active_points; /* interior of grid with respect to stencil  */
+  double local_stencil_time, stencil_time;
+  DTYPE  * RESTRICT in;   /* input grid values                         */
+  DTYPE  * RESTRICT out;  /* output grid values                        */
+  long   total_length_in, total_length_out;
+  int    error=0;
+  DTYPE  weight[2*RADIUS+1][2*RADIUS+1];
   MPI_Request request[8];
-  int     procsize;       /* number of ranks per OS process                      */
-
-  /*******************************************************************************
-  ** Initialize the MPI environment
-  ********************************************************************************/
-  MPI_Init(&argc,&argv);
-  MPI_Comm_rank(MPI_COMM_WORLD, &my_ID);
-  MPI_Comm_size(MPI_COMM_WORLD, &Num_procs);
-
-  /*******************************************************************************
-  ** process, test, and broadcast input parameters
-  ********************************************************************************/
-
-  if (my_ID == root) {
-    printf("Parallel Research Kernels version %s\n", PRKVERSION);
-    printf("FG_MPI stencil execution on 2D grid\n");
-#if !STAR
-    printf("ERROR: Compact stencil not supported\n");
-    error = 1;
-    goto ENDOFTESTS;
-#endif
 
-    if (argc != 3){
-      printf("Usage: %s <# iterations> <array dimension> \n",
-             *argv);
-      error = 1;
-      goto ENDOFTESTS;
-    }
+  *error_out = 0;
+  MPI_Comm_rank(comm, &ID);
+  MPI_Comm_size(comm, &NP);
 
-    iterations  = atoi(*++argv);
-    if (iterations < 1){
-      printf("ERROR: iterations must be >= 1 : %d \n",iterations);
-      error = 1;
-      goto ENDOFTESTS;
-    }
+  /* determine best way to create a 2D grid of ranks (closest to square) */
+  factor(NP, &Num_procsx, &Num_procsy);
 
-    n       = atoi(*++argv);
-    nsquare = (long) n * (long) n;
-    if (nsquare < Num_procs){
-      printf("ERROR: grid size %ld must be at least # ranks: %d\n",
-	     nsquare, Num_procs);
-      error = 1;
-      goto ENDOFTESTS;
-    }
+  IDx = ID%Num_procsx;
+  IDy = ID/Num_procsx;
+  /* compute neighbors; don't worry about dropping off the grid edges  */
+  right_nbr  = ID+1;
+  left_nbr   = ID-1;
+  top_nbr    = ID+Num_procsx;
+  bottom_nbr = ID-Num_procsx;
 
-    if (RADIUS < 0) {
-      printf("ERROR: Stencil radius %d should be non-negative\n", RADIUS);
-      error = 1;
-      goto ENDOFTESTS;
-    }
-
-    if (2*RADIUS +1 > n) {
-      printf("ERROR: Stencil radius %d exceeds grid size %d\n", RADIUS, n);
-      error = 1;
-      goto ENDOFTESTS;
-    }
-
-    ENDOFTESTS:;
-  }
-  bail_out(error);
-
-  /* determine best way to create a 2D grid of ranks (closest to square)     */
-  factor(Num_procs, &Num_procsx, &Num_procsy);
-
-  my_IDx = my_ID%Num_procsx;
-  my_IDy = my_ID/Num_procsx;
-  /* compute neighbors; don't worry about dropping off the edges of the grid */
-  right_nbr  = my_ID+1;
-  left_nbr   = my_ID-1;
-  top_nbr    = my_ID+Num_procsx;
-  bottom_nbr = my_ID-Num_procsx;
-
-  if (my_ID == root) {
-    MPIX_Get_collocated_size(&procsize);
-    printf("Number of ranks          = %d\n", Num_procs);
-    printf("Number of ranks/process  = %d\n", procsize);
-    printf("Grid size                = %d\n", n);
-    printf("Radius of stencil        = %d\n", RADIUS);
-    printf("Tiles in x/y-direction   = %d/%d\n", Num_procsx, Num_procsy);
-    printf("Type of stencil          = star\n");
-#if DOUBLE
-    printf("Data type                = double precision\n");
-#else
-    printf("Data type                = single precision\n");
-#endif
-#if LOOPGEN
-    printf("Script used to expand stencil loop body\n");
-#else
-    printf("Compact representation of stencil loop body\n");
-#endif
-    printf("Number of iterations     = %d\n", iterations);
-  }
-
-  MPI_Bcast(&n,          1, MPI_INT, root, MPI_COMM_WORLD);
-  MPI_Bcast(&iterations, 1, MPI_INT, root, MPI_COMM_WORLD);
-
-  /* compute amount of space required for input and solution arrays             */
+  /* compute amount of space required for input and solution arrays   */
 
   width = n/Num_procsx;
   leftover = n%Num_procsx;
-  if (my_IDx<leftover) {
-    istart = (width+1) * my_IDx;
+  if (IDx<leftover) {
+    istart = (width+1) * IDx;
     iend = istart + width;
   }
   else {
-    istart = (width+1) * leftover + width * (my_IDx-leftover);
+    istart = (width+1) * leftover + width * (IDx-leftover);
     iend = istart + width - 1;
   }
 
   width = iend - istart + 1;
   if (width == 0) {
-    printf("ERROR: rank %d has no work to do\n", my_ID);
+    printf("ERROR: rank %d has no work to do\n", ID);
     error = 1;
   }
-  bail_out(error);
+  if ((*error_out = comm_check(comm, error))) return 0.0;
 
   height = n/Num_procsy;
   leftover = n%Num_procsy;
-  if (my_IDy<leftover) {
-    jstart = (height+1) * my_IDy;
+  if (IDy<leftover) {
+    jstart = (height+1) * IDy;
     jend = jstart + height;
   }
   else {
-    jstart = (height+1) * leftover + height * (my_IDy-leftover);
+    jstart = (height+1) * leftover + height * (IDy-leftover);
     jend = jstart + height - 1;
   }
 
   height = jend - jstart + 1;
   if (height == 0) {
-    printf("ERROR: rank %d has no work to do\n", my_ID);
+    printf("ERROR: rank %d has no work to do\n", ID);
     error = 1;
   }
-  bail_out(error);
+  if ((*error_out = comm_check(comm, error))) return 0.0;
 
   if (width < RADIUS || height < RADIUS) {
     printf("ERROR: rank %d has work tile smaller then stencil radius\n",
-           my_ID);
+           ID);
     error = 1;
   }
-  bail_out(error);
+  if ((*error_out = comm_check(comm, error))) return 0.0;
 
   total_length_in  = (long) (width+2*RADIUS)*(long) (height+2*RADIUS)*sizeof(DTYPE);
   total_length_out = (long) width* (long) height*sizeof(DTYPE);
@@ -284,16 +207,15 @@ int main(int argc, char ** argv) {
   out = (DTYPE *) prk_malloc(total_length_out);
   if (!in || !out) {
     printf("ERROR: rank %d could not allocate space for input/output array\n",
-            my_ID);
+            ID);
     error = 1;
   }
-  bail_out(error);
+  if ((*error_out = comm_check(comm, error))) return 0.0;
 
-  /* fill the stencil weights to reflect a discrete divergence operator         */
+  /* fill the stencil weights to reflect a discrete divergence operator */
   for (jj=-RADIUS; jj<=RADIUS; jj++) for (ii=-RADIUS; ii<=RADIUS; ii++)
     WEIGHT(ii,jj) = (DTYPE) 0.0;
 
-  stencil_size = 4*RADIUS+1;
   for (ii=1; ii<=RADIUS; ii++) {
     WEIGHT(0, ii) = WEIGHT( ii,0) =  (DTYPE) (1.0/(2.0*ii*RADIUS));
     WEIGHT(0,-ii) = WEIGHT(-ii,0) = -(DTYPE) (1.0/(2.0*ii*RADIUS));
@@ -301,30 +223,30 @@ int main(int argc, char ** argv) {
 
   norm = (DTYPE) 0.0;
   f_active_points = (DTYPE) (n-2*RADIUS)*(DTYPE) (n-2*RADIUS);
-  /* intialize the input and output arrays                                     */
+  /* intialize the input and output arrays                             */
   for (j=jstart; j<=jend; j++) for (i=istart; i<=iend; i++) {
     IN(i,j)  = COEFX*i+COEFY*j;
     OUT(i,j) = (DTYPE)0.0;
   }
 
-  if (Num_procs > 1) {
-    /* allocate communication buffers for halo values                          */
+  if (NP > 1) {
+    /* allocate communication buffers for halo values                  */
     top_buf_out = (DTYPE *) prk_malloc(4*sizeof(DTYPE)*RADIUS*width);
     if (!top_buf_out) {
-      printf("ERROR: Rank %d could not allocated comm buffers for y-direction\n", my_ID);
+      printf("ERROR: Rank %d could not allocated comm buffers for y-direction\n", ID);
       error = 1;
     }
-    bail_out(error);
+    if ((*error_out = comm_check(comm, error))) return 0.0;
     top_buf_in     = top_buf_out +   RADIUS*width;
     bottom_buf_out = top_buf_out + 2*RADIUS*width;
     bottom_buf_in  = top_buf_out + 3*RADIUS*width;
 
     right_buf_out  = (DTYPE *) prk_malloc(4*sizeof(DTYPE)*RADIUS*height);
     if (!right_buf_out) {
-      printf("ERROR: Rank %d could not allocated comm buffers for x-direction\n", my_ID);
+      printf("ERROR: Rank %d could not allocated comm buffers for x-direction\n", ID);
       error = 1;
     }
-    bail_out(error);
+    if ((*error_out = comm_check(comm, error))) return 0.0;
     right_buf_in   = right_buf_out +   RADIUS*height;
     left_buf_out   = right_buf_out + 2*RADIUS*height;
     left_buf_in    = right_buf_out + 3*RADIUS*height;
@@ -334,37 +256,37 @@ int main(int argc, char ** argv) {
 
     /* start timer after a warmup iteration */
     if (iter == 1) {
-      MPI_Barrier(MPI_COMM_WORLD);
+      MPI_Barrier(comm);
       local_stencil_time = wtime();
     }
 
-    /* need to fetch ghost point data from neighbors in y-direction                 */
-    if (my_IDy < Num_procsy-1) {
+    /* need to fetch ghost point data from neighbors in y-direction    */
+    if (IDy < Num_procsy-1) {
       MPI_Irecv(top_buf_in, RADIUS*width, MPI_DTYPE, top_nbr, 101,
-                MPI_COMM_WORLD, &(request[1]));
+                comm, &(request[1]));
       for (kk=0,j=jend-RADIUS+1; j<=jend; j++) for (i=istart; i<=iend; i++) {
           top_buf_out[kk++]= IN(i,j);
       }
       MPI_Isend(top_buf_out, RADIUS*width,MPI_DTYPE, top_nbr, 99,
-                MPI_COMM_WORLD, &(request[0]));
+                comm, &(request[0]));
     }
-    if (my_IDy > 0) {
+    if (IDy > 0) {
       MPI_Irecv(bottom_buf_in,RADIUS*width, MPI_DTYPE, bottom_nbr, 99,
-                MPI_COMM_WORLD, &(request[3]));
+                comm, &(request[3]));
       for (kk=0,j=jstart; j<=jstart+RADIUS-1; j++) for (i=istart; i<=iend; i++) {
           bottom_buf_out[kk++]= IN(i,j);
       }
       MPI_Isend(bottom_buf_out, RADIUS*width,MPI_DTYPE, bottom_nbr, 101,
-                MPI_COMM_WORLD, &(request[2]));
+                comm, &(request[2]));
     }
-    if (my_IDy < Num_procsy-1) {
+    if (IDy < Num_procsy-1) {
       MPI_Wait(&(request[0]), MPI_STATUS_IGNORE);
       MPI_Wait(&(request[1]), MPI_STATUS_IGNORE);
       for (kk=0,j=jend+1; j<=jend+RADIUS; j++) for (i=istart; i<=iend; i++) {
           IN(i,j) = top_buf_in[kk++];
       }
     }
-    if (my_IDy > 0) {
+    if (IDy > 0) {
       MPI_Wait(&(request[2]), MPI_STATUS_IGNORE);
       MPI_Wait(&(request[3]), MPI_STATUS_IGNORE);
       for (kk=0,j=jstart-RADIUS; j<=jstart-1; j++) for (i=istart; i<=iend; i++) {
@@ -372,33 +294,33 @@ int main(int argc, char ** argv) {
       }
     }
 
-    /* need to fetch ghost point data from neighbors in x-direction                 */
-    if (my_IDx < Num_procsx-1) {
+    /* need to fetch ghost point data from neighbors in x-direction    */
+    if (IDx < Num_procsx-1) {
       MPI_Irecv(right_buf_in, RADIUS*height, MPI_DTYPE, right_nbr, 1010,
-                MPI_COMM_WORLD, &(request[1+4]));
+                comm, &(request[1+4]));
       for (kk=0,j=jstart; j<=jend; j++) for (i=iend-RADIUS+1; i<=iend; i++) {
           right_buf_out[kk++]= IN(i,j);
       }
       MPI_Isend(right_buf_out, RADIUS*height, MPI_DTYPE, right_nbr, 990,
-              MPI_COMM_WORLD, &(request[0+4]));
+              comm, &(request[0+4]));
     }
-    if (my_IDx > 0) {
+    if (IDx > 0) {
       MPI_Irecv(left_buf_in, RADIUS*height, MPI_DTYPE, left_nbr, 990,
-                MPI_COMM_WORLD, &(request[3+4]));
+                comm, &(request[3+4]));
       for (kk=0,j=jstart; j<=jend; j++) for (i=istart; i<=istart+RADIUS-1; i++) {
           left_buf_out[kk++]= IN(i,j);
       }
       MPI_Isend(left_buf_out, RADIUS*height, MPI_DTYPE, left_nbr, 1010,
-                MPI_COMM_WORLD, &(request[2+4]));
+                comm, &(request[2+4]));
     }
-    if (my_IDx < Num_procsx-1) {
+    if (IDx < Num_procsx-1) {
       MPI_Wait(&(request[0+4]), MPI_STATUS_IGNORE);
       MPI_Wait(&(request[1+4]), MPI_STATUS_IGNORE);
       for (kk=0,j=jstart; j<=jend; j++) for (i=iend+1; i<=iend+RADIUS; i++) {
           IN(i,j) = right_buf_in[kk++];
       }
     }
-    if (my_IDx > 0) {
+    if (IDx > 0) {
       MPI_Wait(&(request[2+4]), MPI_STATUS_IGNORE);
       MPI_Wait(&(request[3+4]), MPI_STATUS_IGNORE);
       for (kk=0,j=jstart; j<=jend; j++) for (i=istart-RADIUS; i<=istart-1; i++) {
@@ -422,13 +344,14 @@ int main(int argc, char ** argv) {
     /* add constant to solution to force refresh of neighbor data, if any */
     for (j=jstart; j<=jend; j++) for (i=istart; i<=iend; i++) IN(i,j)+= 1.0;
 
-  } /* end of iterations                                                   */
+  } /* end of iterations                                               */
 
   local_stencil_time = wtime() - local_stencil_time;
-  MPI_Reduce(&local_stencil_time, &stencil_time, 1, MPI_DOUBLE, MPI_MAX, root,
-             MPI_COMM_WORLD);
+  /* every rank of comm learns the time, so any of them can report     */
+  MPI_Allreduce(&local_stencil_time, &stencil_time, 1, MPI_DOUBLE, MPI_MAX,
+                comm);
 
-  /* compute L1 norm in parallel                                                */
+  /* compute L1 norm in parallel                                       */
   local_norm = (DTYPE) 0.0;
   for (j=MAX(jstart,RADIUS); j<=MIN(n-RADIUS-1,jend); j++) {
     for (i=MAX(istart,RADIUS); i<=MIN(n-RADIUS-1,iend); i++) {
@@ -436,14 +359,10 @@ int main(int argc, char ** argv) {
     }
   }
 
-  MPI_Reduce(&local_norm, &norm, 1, MPI_DTYPE, MPI_SUM, root, MPI_COMM_WORLD);
-
-  /*******************************************************************************
-  ** Analyze and output results.
-  ********************************************************************************/
+  MPI_Reduce(&local_norm, &norm, 1, MPI_DTYPE, MPI_SUM, 0, comm);
 
-/* verify correctness                                                            */
-  if (my_ID == root) {
+  /* verify correctness                                                */
+  if (ID == 0) {
     norm /= f_active_points;
     if (RADIUS > 0) {
       reference_norm = (DTYPE) (iterations+1) * (COEFX + COEFY);
@@ -456,23 +375,219 @@ int main(int argc, char ** argv) {
              norm, reference_norm);
       error = 1;
     }
-    else {
-      printf("Solution validates\n");
 #if VERBOSE
+    else {
       printf("Reference L1 norm = "FSTR", L1 norm = "FSTR"\n",
              reference_norm, norm);
+    }
+#endif
+  }
+  *error_out = comm_check(comm, error);
+
+  if (NP > 1) {
+    prk_free(right_buf_out);
+    prk_free(top_buf_out);
+  }
+  prk_free(out);
+  prk_free(in);
+  return stencil_time;
+}
+
+int main(int argc, char ** argv) {
+
+  int    Num_procs;       /* number of ranks                                     */
+  int    Num_procsx, Num_procsy; /* number of ranks in each coord direction      */
+  int    my_ID;           /* MPI rank                                            */
+  int    root = 0;
+  int    n;               /* linear global grid dimension                        */
+  long   nsquare;         /* total number of grid points                         */
+  DTYPE  f_active_points; /* interior of grid with respect to stencil            */
+  DTYPE  flops;           /* floating point ops per iteration                    */
+  int    iterations;      /* number of times to run the algorithm                */
+  double stencil_time,    /* timing parameters                                   */
+         avgtime;
+  int    stencil_size;    /* number of points in stencil                         */
+  int    error=0;         /* error flag                                          */
+  int    procsize;        /* number of ranks per OS process                      */
+  int    sweep=0;         /* nonzero runs the oversubscription sweep             */
+
+  /*******************************************************************************
+  ** Initialize the MPI environment
+  ********************************************************************************/
+  MPI_Init(&argc,&argv);
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_ID);
+  MPI_Comm_size(MPI_COMM_WORLD, &Num_procs);
+
+  /*******************************************************************************
+  ** process, test, and broadcast input parameters
+  ********************************************************************************/
+
+  if (my_ID == root) {
+    printf("Parallel Research Kernels version %s\n", PRKVERSION);
+    printf("FG_MPI stencil execution on 2D grid\n");
+#if !STAR
+    printf("ERROR: Compact stencil not supported\n");
+    error = 1;
+    goto ENDOFTESTS;
 #endif
+
+    /* the optional final argument selects the oversubscription
+       sweep; strip it before the positional arguments are read        */
+    if (argc > 3 && !strcmp(argv[argc-1], "SWEEP")) {
+      sweep = 1;
+      argc--;
+    }
+
+    if (argc != 3){
+      printf("Usage: %s <# iterations> <array dimension> [SWEEP]\n",
+             *argv);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    iterations  = atoi(*++argv);
+    if (iterations < 1){
+      printf("ERROR: iterations must be >= 1 : %d \n",iterations);
+      error = 1;
+      goto ENDOFTESTS;
     }
+
+    n       = atoi(*++argv);
+    nsquare = (long) n * (long) n;
+    if (nsquare < Num_procs){
+      printf("ERROR: grid size %ld must be at least # ranks: %d\n",
+	     nsquare, Num_procs);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    if (RADIUS < 0) {
+      printf("ERROR: Stencil radius %d should be non-negative\n", RADIUS);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    if (2*RADIUS +1 > n) {
+      printf("ERROR: Stencil radius %d exceeds grid size %d\n", RADIUS, n);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    ENDOFTESTS:;
   }
   bail_out(error);
 
+  /* determine best way to create a 2D grid of ranks (closest to square)     */
+  factor(Num_procs, &Num_procsx, &Num_procsy);
+
   if (my_ID == root) {
-    /* flops/stencil: 2 flops (fma) for each point in the stencil,
-       plus one flop for the update of the input of the array        */
-    flops = (DTYPE) (2*stencil_size+1) * f_active_points;
-    avgtime = stencil_time/iterations;
-    printf("Rate (MFlops/s): "FSTR"  Avg time (s): %lf\n",
-           1.0E-06 * flops/avgtime, avgtime);
+    MPIX_Get_collocated_size(&procsize);
+    printf("Number of ranks          = %d\n", Num_procs);
+    printf("Number of ranks/process  = %d\n", procsize);
+    printf("Grid size                = %d\n", n);
+    printf("Radius of stencil        = %d\n", RADIUS);
+    printf("Tiles in x/y-direction   = %d/%d\n", Num_procsx, Num_procsy);
+    printf("Type of stencil          = star\n");
+#if DOUBLE
+    printf("Data type                = double precision\n");
+#else
+    printf("Data type                = single precision\n");
+#endif
+#if LOOPGEN
+    printf("Script used to expand stencil loop body\n");
+#else
+    printf("Compact representation of stencil loop body\n");
+#endif
+    printf("Number of iterations     = %d\n", iterations);
+    if (sweep)
+    printf("Oversubscription sweep   = on\n");
+  }
+
+  MPI_Bcast(&n,          1, MPI_INT, root, MPI_COMM_WORLD);
+  MPI_Bcast(&iterations, 1, MPI_INT, root, MPI_COMM_WORLD);
+  MPI_Bcast(&sweep,      1, MPI_INT, root, MPI_COMM_WORLD);
+
+  /* flops/stencil: 2 flops (fma) for each point in the stencil,
+     plus one flop for the update of the input of the array                  */
+  stencil_size = 4*RADIUS+1;
+  f_active_points = (DTYPE) (n-2*RADIUS)*(DTYPE) (n-2*RADIUS);
+  flops = (DTYPE) (2*stencil_size+1) * f_active_points;
+
+  if (!sweep) {
+
+    stencil_time = run_stencil(MPI_COMM_WORLD, n, iterations, &error);
+    bail_out(error);
+
+    /*****************************************************************************
+    ** Analyze and output results.
+    ******************************************************************************/
+
+    if (my_ID == root) {
+      printf("Solution validates\n");
+      avgtime = stencil_time/iterations;
+      printf("Rate (MFlops/s): "FSTR"  Avg time (s): %lf\n",
+             1.0E-06 * flops/avgtime, avgtime);
+    }
+  }
+  else {
+
+    /* run the stencil once per coprocess density: d of the procsize
+       collocated coprocesses take part, the rest idle in bail_out's
+       collective, and the density doubles until the full -nfg value   */
+    int      d, index, active, base_set=0;
+    double   base_avg=1.0, avg;
+    long     nvcsw0, nivcsw0;
+    struct   rusage ru;
+    MPI_Comm comm;
+
+    MPIX_Get_collocated_size(&procsize);
+    /* the default FG-MPI mapping places collocated ranks in one
+       contiguous block, so the within-process index is the rank
+       modulo the block size                                           */
+    index = my_ID % procsize;
+
+    if (my_ID == root) {
+      printf("Oversubscription sweep (active coprocesses per core):\n");
+      printf("%5s %8s %17s %15s %9s %9s %9s\n",
+             "nfg", "ranks", "Rate (MFlops/s)", "Avg time (s)",
+             "vol cs", "invol cs", "overlap");
+    }
+
+    for (d=1; d<=procsize; d*=2) {
+      /* make the full density the final point even when the launched
+         coprocess count is not a power of two                         */
+      if (d*2 > procsize && d != procsize) d = procsize;
+
+      active = (index < d);
+      MPI_Comm_split(MPI_COMM_WORLD, active ? 0 : MPI_UNDEFINED, my_ID, &comm);
+
+      getrusage(RUSAGE_SELF, &ru);
+      nvcsw0  = ru.ru_nvcsw;
+      nivcsw0 = ru.ru_nivcsw;
+
+      error = 0;
+      if (active) {
+        stencil_time = run_stencil(comm, n, iterations, &error);
+      }
+      bail_out(error);
+
+      if (active) {
+        avg = stencil_time/iterations;
+        if (!base_set) { base_avg = avg; base_set = 1; }
+        /* rank 0 of the world is active at every density              */
+        if (my_ID == root) {
+          getrusage(RUSAGE_SELF, &ru);
+          printf("%5d %8d %17lf %15lf %9ld %9ld %9.2lf\n",
+                 d, (Num_procs/procsize)*d,
+                 1.0E-06 * flops/avg, avg,
+                 (long)(ru.ru_nvcsw-nvcsw0), (long)(ru.ru_nivcsw-nivcsw0),
+                 base_avg/avg);
+        }
+        MPI_Comm_free(&comm);
+      }
+      MPI_Barrier(MPI_COMM_WORLD);
+    }
+    if (my_ID == root) printf("Solution validates\n");
   }
 
   MPI_Finalize();
@@ -42,9 +42,17 @@ PURPOSE: This program tests the efficiency with which point-to-point
 USAGE:   The program takes as input the dimensions of the grid, and the
          number of times we loop over the grid
 
-               <progname> <# iterations> <m> <n>
-  
-         The output consists of diagnostics to make sure the 
+               <progname> <# iterations> <m> <n> [group factor] [SWEEP]
+
+         The optional final argument SWEEP runs the pipeline once per
+         coprocess-per-core density (1, 2, 4, ... up to the launched
+         -nfg value), leaving the surplus coprocesses parked in a
+         barrier, and tabulates rate, OS context-switch counts and the
+         overlap gained relative to one coprocess per core.  This
+         evaluates fine-grain oversubscription as a latency-hiding
+         strategy in a single job.
+
+         The output consists of diagnostics to make sure the
          algorithm worked, and of timing statistics.
 
 FUNCTIONS CALLED:
@@ -67,30 +75,192 @@ HISTORY: - Written by Rob Van der Wijngaart, March 2006.
 #include <par-res-kern_general.h>
 #include <par-res-kern_fg-mpi.h>
 
+#include <sys/time.h>
+#include <sys/resource.h>
+
 #define ARRAY(i,j) vector[i+1+(j)*(segment_size+1)]
 
+/* One complete pipeline run over the ranks of comm: decomposition,
+   initialization, timed iterations and verification.  Returns the
+   max-over-comm pipeline time, valid on every rank of comm; *error_out
+   is set nonzero on the last rank of comm if verification failed.
+   bail_out is a world collective and is left to the caller, so that
+   ranks outside comm can participate                                  */
+static double run_pipeline(MPI_Comm comm, long m, long n, int grp,
+                           int iterations, int *error_out)
+{
+  int    ID, NP, fin;     /* comm rank, size, and verifying rank       */
+  long   start, end;      /* bounds of grid slice owned by this rank   */
+  long   segment_size;    /* size of x-dimension of grid slice         */
+  long   total_length;    /* required length to store grid values      */
+  double *vector;         /* array holding grid values                 */
+  double *inbuf, *outbuf; /* communication buffers when aggregating    */
+  double corner_val;      /* verification value at top right corner    */
+  double local_pipeline_time, pipeline_time;
+  double epsilon = 1.e-8; /* error tolerance                           */
+  int    i, j, jj, jjsize, iter, leftover;
+
+  *error_out = 0;
+  MPI_Comm_rank(comm, &ID);
+  MPI_Comm_size(comm, &NP);
+  fin = NP-1;
+
+  segment_size = m/NP;
+  leftover     = m%NP;
+  if (ID < leftover) {
+    start = (segment_size+1)* ID;
+    end   = start + segment_size;
+  }
+  else {
+    start = (segment_size+1) * leftover + segment_size * (ID-leftover);
+    end   = start + segment_size -1;
+  }
+
+  /* now set segment_size to the value needed by the calling rank      */
+  segment_size = end - start + 1;
+
+  /* total_length takes into account one ghost cell on left side       */
+  total_length = ((end-start+1)+1)*n;
+  vector = (double *) prk_malloc(total_length*sizeof(double));
+  if (vector == NULL) {
+    printf("Could not allocate space for grid slice of %ld by %ld points",
+           segment_size, n);
+    printf(" on rank %d\n", ID);
+    *error_out = 1;
+    return 0.0;
+  }
+
+  /* reserve space for in and out buffers                              */
+  inbuf = (double *) prk_malloc(2*sizeof(double)*(grp));
+  if (inbuf == NULL) {
+    printf("Could not allocate space for %d words of communication buffers",
+            2*grp);
+    printf(" on rank %d\n", ID);
+    prk_free(vector);
+    *error_out = 1;
+    return 0.0;
+  }
+  outbuf = inbuf + grp;
+
+  /* clear the array                                                   */
+  for (j=0; j<n; j++) for (i=start-1; i<=end; i++) {
+    ARRAY(i-start,j) = 0.0;
+  }
+  /* set boundary values (bottom and left side of grid)                */
+  if (ID==0) for (j=0; j<n; j++) ARRAY(0,j) = (double) j;
+  for (i=start-1; i<=end; i++)      ARRAY(i-start,0) = (double) i;
+
+  /* redefine start and end for calling rank to reflect local indices  */
+  if (ID==0) start = 1;
+  else       start = 0;
+  end = segment_size-1;
+
+  for (iter=0; iter<=iterations; iter++) {
+
+    /* start timer after a warmup iteration */
+    if (iter == 1) {
+      MPI_Barrier(comm);
+      local_pipeline_time = wtime();
+    }
+
+    /* execute pipeline algorithm for grid lines 1 through n-1         */
+    if (grp==1) for (j=1; j<n; j++) { /* special case for no grouping  */
+
+      /* if I am not at the left boundary, I need to wait for my left
+         neighbor to send data                                         */
+      if (ID > 0) {
+        MPI_Recv(&(ARRAY(start-1,j)), 1, MPI_DOUBLE, ID-1, j,
+                                  comm, MPI_STATUS_IGNORE);
+      }
+
+      for (i=start; i<= end; i++) {
+        ARRAY(i,j) = ARRAY(i-1,j) + ARRAY(i,j-1) - ARRAY(i-1,j-1);
+      }
+
+      /* if I am not on the right boundary, send data to my right
+         neighbor                                                      */
+      if (ID < NP-1) {
+        MPI_Send(&(ARRAY(end,j)), 1, MPI_DOUBLE, ID+1, j, comm);
+      }
+    }
+    else for (j=1; j<n; j+=grp) { /* apply grouping                    */
+
+      jjsize = MIN(grp, n-j);
+      if (ID > 0) {
+        MPI_Recv(inbuf, jjsize, MPI_DOUBLE, ID-1, j, comm, MPI_STATUS_IGNORE);
+        for (jj=0; jj<jjsize; jj++) {
+          ARRAY(start-1,jj+j) = inbuf[jj];
+        }
+      }
+
+      for (jj=0; jj<jjsize; jj++) for (i=start; i<= end; i++) {
+        ARRAY(i,jj+j) = ARRAY(i-1,jj+j) + ARRAY(i,jj+j-1) - ARRAY(i-1,jj+j-1);
+      }
+
+      if (ID < NP-1) {
+        for (jj=0; jj<jjsize; jj++) {
+          outbuf[jj] = ARRAY(end,jj+j);
+        }
+        MPI_Send(outbuf, jjsize, MPI_DOUBLE, ID+1, j, comm);
+      }
+
+    }
+
+    /* copy top right corner value to bottom left corner to create
+       dependency                                                      */
+    if (NP >1) {
+      if (ID==fin) {
+        corner_val = -ARRAY(end,n-1);
+        MPI_Send(&corner_val,1,MPI_DOUBLE,0,888,comm);
+      }
+      if (ID==0) {
+        MPI_Recv(&(ARRAY(0,0)),1,MPI_DOUBLE,fin,888,comm,MPI_STATUS_IGNORE);
+      }
+    }
+    else ARRAY(0,0)= -ARRAY(end,n-1);
+
+  }
+
+  local_pipeline_time = wtime() - local_pipeline_time;
+  /* every rank of comm learns the time, so any of them can report     */
+  MPI_Allreduce(&local_pipeline_time, &pipeline_time, 1, MPI_DOUBLE, MPI_MAX,
+                comm);
+
+  /* verify correctness, using top right value                         */
+  corner_val = (double) ((iterations+1)*(m+n-2));
+  if (ID == fin) {
+    if (fabs(ARRAY(end,n-1)-corner_val)/corner_val >= epsilon) {
+      printf("ERROR: checksum %lf does not match verification value %lf\n",
+             ARRAY(end,n-1), corner_val);
+      *error_out = 1;
+    }
+#if VERBOSE
+    else {
+      printf("Solution validates; verification value = %lf\n", corner_val);
+      printf("Point-to-point synchronizations/s: %lf\n",
+             ((float)((n-1)*(NP-1)))/(pipeline_time/iterations));
+    }
+#endif
+  }
+
+  prk_free(inbuf);
+  prk_free(vector);
+  return pipeline_time;
+}
+
 int main(int argc, char ** argv)
 {
   int    my_ID;           /* MPI rank                                            */
   int    root=0, final;   /* IDs of root rank and rank that verifies result      */
   long   m, n;            /* grid dimensions                                     */
-  double local_pipeline_time, /* timing parameters                               */
-         pipeline_time,
+  double pipeline_time,   /* timing parameters                                   */
          avgtime;
-  double epsilon = 1.e-8; /* error tolerance                                     */
-  double corner_val;      /* verification value at top right corner of grid      */
-  int    i, j, jj, iter, ID;/* dummies                                           */
   int    iterations;      /* number of times to run the pipeline algorithm       */
-  long   start, end;      /* start and end of grid slice owned by calling rank   */
-  long   segment_size;    /* size of x-dimension of grid owned by calling rank   */
   int    error=0;         /* error flag                                          */
   int    Num_procs;       /* Number of ranks                                     */
   int    grp;             /* grid line aggregation factor                        */
-  int    jjsize;          /* actual line group size                              */
-  double * RESTRICT vector;/* array holding grid values                          */
-  double *inbuf, *outbuf; /* communication buffers used when aggregating         */
-  long   total_length;    /* total required length to store grid values          */
-  int     procsize;       /* number of ranks per OS process                      */
+  int    procsize;        /* number of ranks per OS process                      */
+  int    sweep=0;         /* nonzero runs the oversubscription sweep             */
 
 /*********************************************************************************
 ** Initialize the MPI environment
@@ -110,8 +280,15 @@ int main(int argc, char ** argv)
     printf("Parallel Research Kernels version %s\n", PRKVERSION);
     printf("FG_MPI pipeline execution on 2D grid\n");
 
+    /* an optional final argument SWEEP selects the oversubscription
+       sweep; strip it before the positional arguments are read        */
+    if (argc > 4 && !strcmp(argv[argc-1], "SWEEP")) {
+      sweep = 1;
+      argc--;
+    }
+
     if (argc != 4 && argc != 5){
-      printf("Usage: %s  <#iterations> <1st array dimension> <2nd array dimension> [group factor]\n", 
+      printf("Usage: %s  <#iterations> <1st array dimension> <2nd array dimension> [group factor] [SWEEP]\n",
              *argv);
       error = 1;
       goto ENDOFTESTS;
@@ -158,165 +335,94 @@ int main(int argc, char ** argv)
     printf("Number of iterations     = %d\n", iterations);
     if (grp > 1)
     printf("Group factor             = %d (cheating!)\n", grp);
+    if (sweep)
+    printf("Oversubscription sweep   = on\n");
   }
-  
+
   /* Broadcast benchmark data to all rankes */
   MPI_Bcast(&m,          1, MPI_LONG, root, MPI_COMM_WORLD);
   MPI_Bcast(&n,          1, MPI_LONG, root, MPI_COMM_WORLD);
   MPI_Bcast(&grp,        1, MPI_INT, root, MPI_COMM_WORLD);
   MPI_Bcast(&iterations, 1, MPI_INT, root, MPI_COMM_WORLD);
+  MPI_Bcast(&sweep,      1, MPI_INT, root, MPI_COMM_WORLD);
 
-  int leftover;
-  segment_size = m/Num_procs;
-  leftover     = m%Num_procs;
-  if (my_ID < leftover) {
-    start = (segment_size+1)* my_ID;
-    end   = start + segment_size;
-  }
-  else {
-    start = (segment_size+1) * leftover + segment_size * (my_ID-leftover);
-    end   = start + segment_size -1;
-  }
+  if (!sweep) {
 
-  /* now set segment_size to the value needed by the calling rank               */
-  segment_size = end - start + 1;
+    pipeline_time = run_pipeline(MPI_COMM_WORLD, m, n, grp, iterations, &error);
+    bail_out(error);
 
-  /* total_length takes into account one ghost cell on left side of segment     */
-  total_length = ((end-start+1)+1)*n;
-  vector = (double *) prk_malloc(total_length*sizeof(double));
-  if (vector == NULL) {
-    printf("Could not allocate space for grid slice of %ld by %ld points",
-           segment_size, n);
-    printf(" on rank %d\n", my_ID);
-    error = 1;
-  }
-  bail_out(error);
-  
-  /* reserve space for in and out buffers                                        */
-  inbuf = (double *) prk_malloc(2*sizeof(double)*(grp));
-  if (inbuf == NULL) {
-    printf("Could not allocate space for %d words of communication buffers", 
-            2*grp);
-    printf(" on rank %d\n", my_ID);
-    error = 1;
-  }
-  bail_out(error);
-  outbuf = inbuf + grp;
-   
-  /* clear the array                                                             */
-  for (j=0; j<n; j++) for (i=start-1; i<=end; i++) {
-    ARRAY(i-start,j) = 0.0;
+    if (my_ID == final) {
+      avgtime = pipeline_time/iterations;
+      /* flip the sign of the execution time to indicate cheating      */
+      if (grp>1) avgtime *= -1.0;
+#if !VERBOSE
+      printf("Solution validates\n");
+#endif
+      printf("Rate (MFlops/s): %lf Avg time (s): %lf\n",
+             1.0E-06 * 2 * ((double)((m-1)*(n-1)))/avgtime, avgtime);
+    }
   }
-  /* set boundary values (bottom and left side of grid */
-  if (my_ID==0) for (j=0; j<n; j++) ARRAY(0,j) = (double) j;
-  for (i=start-1; i<=end; i++)      ARRAY(i-start,0) = (double) i;
-
-  /* redefine start and end for calling rank to reflect local indices            */
-  if (my_ID==0) start = 1; 
-  else          start = 0;
-  end = segment_size-1;
+  else {
 
-  for (iter=0; iter<=iterations; iter++) {
+    /* run the pipeline once per coprocess density: d of the procsize
+       collocated coprocesses take part, the rest idle in bail_out's
+       collective, and the density doubles until the full -nfg value   */
+    int      d, index, active, base_set=0;
+    double   base_avg=1.0, avg;
+    long     nvcsw0, nivcsw0;
+    struct   rusage ru;
+    MPI_Comm comm;
 
-    /* start timer after a warmup iteration */
-    if (iter == 1) { 
-      MPI_Barrier(MPI_COMM_WORLD);
-      local_pipeline_time = wtime();
+    MPIX_Get_collocated_size(&procsize);
+    /* the default FG-MPI mapping places collocated ranks in one
+       contiguous block, so the within-process index is the rank
+       modulo the block size                                           */
+    index = my_ID % procsize;
+
+    if (my_ID == root) {
+      printf("Oversubscription sweep (active coprocesses per core):\n");
+      printf("%5s %8s %17s %15s %9s %9s %9s\n",
+             "nfg", "ranks", "Rate (MFlops/s)", "Avg time (s)",
+             "vol cs", "invol cs", "overlap");
     }
 
-    /* execute pipeline algorithm for grid lines 1 through n-1 (skip bottom line) */
-    if (grp==1) for (j=1; j<n; j++) { /* special case for no grouping             */
-
-      /* if I am not at the left boundary, I need to wait for my left neighbor to
-         send data                                                                */
-      if (my_ID > 0) {
-        MPI_Recv(&(ARRAY(start-1,j)), 1, MPI_DOUBLE, my_ID-1, j, 
-                                  MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-      }
-
-      for (i=start; i<= end; i++) {
-        ARRAY(i,j) = ARRAY(i-1,j) + ARRAY(i,j-1) - ARRAY(i-1,j-1);
-      }
+    for (d=1; d<=procsize; d*=2) {
+      /* make the full density the final point even when the launched
+         coprocess count is not a power of two                         */
+      if (d*2 > procsize && d != procsize) d = procsize;
 
-      /* if I am not on the right boundary, send data to my right neighbor        */  
-      if (my_ID < Num_procs-1) {
-        MPI_Send(&(ARRAY(end,j)), 1, MPI_DOUBLE, my_ID+1, j, MPI_COMM_WORLD);
-      }
-    }
-    else for (j=1; j<n; j+=grp) { /* apply grouping                               */
+      active = (index < d);
+      MPI_Comm_split(MPI_COMM_WORLD, active ? 0 : MPI_UNDEFINED, my_ID, &comm);
 
-      jjsize = MIN(grp, n-j);
-      /* if I am not at the left boundary, I need to wait for my left neighbor to
-         send data                                                                */
-      if (my_ID > 0) {
-        MPI_Recv(inbuf, jjsize, MPI_DOUBLE, my_ID-1, j, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-        for (jj=0; jj<jjsize; jj++) {
-          ARRAY(start-1,jj+j) = inbuf[jj];
-	}
-      }
+      getrusage(RUSAGE_SELF, &ru);
+      nvcsw0  = ru.ru_nvcsw;
+      nivcsw0 = ru.ru_nivcsw;
 
-      for (jj=0; jj<jjsize; jj++) for (i=start; i<= end; i++) {
-        ARRAY(i,jj+j) = ARRAY(i-1,jj+j) + ARRAY(i,jj+j-1) - ARRAY(i-1,jj+j-1);
+      error = 0;
+      if (active) {
+        pipeline_time = run_pipeline(comm, m, n, grp, iterations, &error);
       }
-
-      /* if I am not on the right boundary, send data to my right neighbor        */  
-      if (my_ID < Num_procs-1) {
-        for (jj=0; jj<jjsize; jj++) {
-          outbuf[jj] = ARRAY(end,jj+j);
+      bail_out(error);
+
+      if (active) {
+        avg = pipeline_time/iterations;
+        if (!base_set) { base_avg = avg; base_set = 1; }
+        /* rank 0 of the world is active at every density              */
+        if (my_ID == root) {
+          getrusage(RUSAGE_SELF, &ru);
+          printf("%5d %8d %17lf %15lf %9ld %9ld %9.2lf\n",
+                 d, (Num_procs/procsize)*d,
+                 1.0E-06 * 2 * ((double)((m-1)*(n-1)))/avg, avg,
+                 (long)(ru.ru_nvcsw-nvcsw0), (long)(ru.ru_nivcsw-nivcsw0),
+                 base_avg/avg);
         }
-        MPI_Send(outbuf, jjsize, MPI_DOUBLE, my_ID+1, j, MPI_COMM_WORLD);
-      }
-
-    }
-
-    /* copy top right corner value to bottom left corner to create dependency     */
-    if (Num_procs >1) {
-      if (my_ID==final) {
-        corner_val = -ARRAY(end,n-1);
-        MPI_Send(&corner_val,1,MPI_DOUBLE,root,888,MPI_COMM_WORLD);
-      }
-      if (my_ID==root) {
-        MPI_Recv(&(ARRAY(0,0)),1,MPI_DOUBLE,final,888,MPI_COMM_WORLD,MPI_STATUS_IGNORE);
+        MPI_Comm_free(&comm);
       }
+      MPI_Barrier(MPI_COMM_WORLD);
     }
-    else ARRAY(0,0)= -ARRAY(end,n-1);
-
+    if (my_ID == root) printf("Solution validates\n");
   }
 
-  local_pipeline_time = wtime() - local_pipeline_time;
-  MPI_Reduce(&local_pipeline_time, &pipeline_time, 1, MPI_DOUBLE, MPI_MAX, final,
-             MPI_COMM_WORLD);
-
-  /*******************************************************************************
-  ** Analyze and output results.
-  ********************************************************************************/
- 
-  /* verify correctness, using top right value                                     */
-  corner_val = (double) ((iterations+1)*(m+n-2));
-  if (my_ID == final) {
-    if (fabs(ARRAY(end,n-1)-corner_val)/corner_val >= epsilon) {
-      printf("ERROR: checksum %lf does not match verification value %lf\n",
-             ARRAY(end,n-1), corner_val);
-      error = 1;
-    }
-  }
-  bail_out(error);
-
-  if (my_ID == final) {
-    avgtime = pipeline_time/iterations;
-    /* flip the sign of the execution time to indicate cheating                    */
-    if (grp>1) avgtime *= -1.0;
-#if VERBOSE   
-    printf("Solution validates; verification value = %lf\n", corner_val);
-    printf("Point-to-point synchronizations/s: %lf\n",
-           ((float)((n-1)*(Num_procs-1)))/(avgtime));
-#else
-    printf("Solution validates\n");
-#endif
-    printf("Rate (MFlops/s): %lf Avg time (s): %lf\n",
-           1.0E-06 * 2 * ((double)((m-1)*(n-1)))/avgtime, avgtime);
-  }
- 
   MPI_Finalize();
   exit(EXIT_SUCCESS);
 
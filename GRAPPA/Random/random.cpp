@@ -55,6 +55,11 @@ USAGE:   The program takes as input the number of threads involved, the 2log
          there is no false sharing. It is also non-scalable.
 
          <progname>  <log2 tablesize> <#update ratio> <vector length>
+                     [<autoflush ticks> <aggregation buffers per core>]
+
+         The two optional parameters override the corresponding knobs of
+         Grappa's message aggregation layer, so the latency-vs-throughput
+         tradeoff of the aggregator can be studied without recompiling.
 
 FUNCTIONS CALLED:
 
@@ -134,6 +139,10 @@ HISTORY: Written by Rob Van der Wijngaart, June 2006.
 uint64_t PRK_starts(uint64_t n);
 static int32_t poweroftwo(int32_t);
 
+/* aggregation knobs defined by the Grappa runtime (gflags)                        */
+DECLARE_int64( aggregator_autoflush_ticks );
+DECLARE_int64( rdma_buffers_per_core );
+
 struct error {
   int64_t count;
   void init(int64_t count) {
@@ -171,10 +180,11 @@ int main(int argc, char * argv[]) {
   int32_t Num_procs = Grappa::cores();
   
 
-  if (argc != 4) {
+  if (argc < 4 || argc > 6) {
     if (my_ID == root)
       std::cout << "Usage: " << argv[0]
-		<< "\n<log2 tablesize> <#update ratio> <vector length>" 
+		<< "\n<log2 tablesize> <#update ratio> <vector length>"
+		<< " [<autoflush ticks> <aggregation buffers per core>]"
 		<< std::endl;
     exit(1);
   }
@@ -215,6 +225,29 @@ int main(int argc, char * argv[]) {
     exit(1);
   }
 
+  // optional overrides of the aggregation layer defaults
+  if (argc > 4) {
+    int64_t autoflush_ticks = atol(argv[4]);
+    if (autoflush_ticks < 1) {
+      if (my_ID == root)
+	std::cout << "ERROR: autoflush ticks " << autoflush_ticks
+		  << ", must be positive" << std::endl;
+      exit(1);
+    }
+    FLAGS_aggregator_autoflush_ticks = autoflush_ticks;
+  }
+
+  if (argc > 5) {
+    int64_t agg_buffers = atol(argv[5]);
+    if (agg_buffers < 1) {
+      if (my_ID == root)
+	std::cout << "ERROR: aggregation buffers per core " << agg_buffers
+		  << ", must be positive" << std::endl;
+      exit(1);
+    }
+    FLAGS_rdma_buffers_per_core = agg_buffers;
+  }
+
   // additional divisibility tests
   if (nstarts % Num_procs) {
     if (my_ID == root)
@@ -262,6 +295,10 @@ int main(int argc, char * argv[]) {
       std::cout << "Number of updates = " << nupdate << std::endl;
       std::cout << "Vector length = " << nstarts << std::endl;
       std::cout << "Percent errors allowed = " << ERRORPERCENT << std::endl;
+      std::cout << "Aggregator autoflush ticks = "
+		<< FLAGS_aggregator_autoflush_ticks << std::endl;
+      std::cout << "Aggregation buffers per core = "
+		<< FLAGS_rdma_buffers_per_core << std::endl;
 
       // create target array that we'll be updating
       auto Table = global_alloc<int64_t>(tablespace);
@@ -314,6 +351,14 @@ int main(int argc, char * argv[]) {
 	std::cout << "Solution validates, number of errors: " << e->count << std::endl;
 	std::cout << "Rate (GUPs/s): " << 1.e-9*nupdate/random_time.value()
 		  << ", time (s) = " << random_time.value() << " seconds" << std::endl;
+	// each update is one aggregated delegate message, so the update rate
+	// is also the rate the aggregation layer sustained
+	std::cout << "Aggregated message rate (Mmessages/s): "
+		  << 1.e-6*nupdate/random_time.value() << std::endl;
+#if VERBOSE
+	// runtime metrics include per-buffer aggregation counts and flush causes
+	Metrics::merge_and_print();
+#endif
       }
 
       global_free(Table);
@@ -49,14 +49,21 @@ FUNCTIONS CALLED:
 
 HISTORY: - Written by Rob Van der Wijngaart, February September 2016.
          - RvdW: Removed unrolling pragmas for clarity;
-           added constant to array "in" at end of each iteration to force 
+           added constant to array "in" at end of each iteration to force
            refreshing of neighbor data in parallel versions; August 2013
-  
+         - Added per-rank snapshot of initialized grids (write once, mmap
+           on reuse)
+
 **********************************************************************************/
 
 #include <par-res-kern_general.h>
 #include <par-res-kern_mpi.h>
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
 #if DOUBLE
   #define DTYPE     double
   #define MPI_DTYPE MPI_DOUBLE
@@ -93,6 +100,47 @@ HISTORY: - Written by Rob Van der Wijngaart, February September 2016.
 #define no_talk          1212
 #define high_water       3232
 
+#define fill_sync        4646
+#define fill_async       6464
+/* rows of overlapped BG compute between progress polls of the async fill       */
+#define PROGRESS_STRIDE  32
+
+/* grid snapshot files: layout version (bump when the format changes) and modes.
+   Each rank dumps its initialized grids to its own file once; later runs with
+   matching parameters map the file copy-on-write and skip initialization       */
+#define SNAP_MAGIC       "PRKAMRG"
+#define SNAP_VERSION     1
+#define snap_none        0
+#define snap_write       1
+#define snap_map         2
+/* data starts at a page boundary so the mapped arrays are well aligned         */
+#define SNAP_DATA_OFFSET 4096
+
+typedef struct {
+  char magic[8];      /* identifies the file as a PRK AMR grid snapshot         */
+  int  version;       /* layout version                                        */
+  int  num_procs;     /* decomposition the grids were initialized with         */
+  int  rank;
+  long n;             /* parameters the grids were initialized with            */
+  long n_r;
+  int  refine_level;
+  int  load_balance;
+  int  rank_spread;
+  int  radius;
+  int  dtype_size;
+} snap_header_t;
+
+/* write() in a loop so short writes of large grids are handled                 */
+static int snap_write_chunk(int fd, const void *buf, size_t bytes) {
+  const char *p = (const char *) buf;
+  while (bytes) {
+    ssize_t w = write(fd, p, bytes);
+    if (w <= 0) return -1;
+    p += w; bytes -= w;
+  }
+  return 0;
+}
+
 /* before interpolating from the background grid, we need to gather that BG data
    from wherever it resides and copy it to the right locations of the refinement */
 void get_BG_data(int load_balance, DTYPE *in_bg, DTYPE *ing_r, int my_ID, long expand,
@@ -227,6 +275,209 @@ void get_BG_data(int load_balance, DTYPE *in_bg, DTYPE *ing_r, int my_ID, long e
   }
 }
 
+/* state of a refinement patch fill that is in flight; filled in by
+   get_BG_data_start and consumed by get_BG_data_finish                           */
+typedef struct {
+  int         active;       /* nonzero while transfers are outstanding            */
+  long        *recv_vec;
+  int         *recv_count, *recv_offset, *send_count, *send_offset;
+  DTYPE       *recv_buf, *send_buf;
+  long        acc_send, acc_recv;
+  MPI_Request *request;
+  int         num_req;
+  /* parameters needed to drain the receive buffer in get_BG_data_finish         */
+  DTYPE       *ing_r;
+  MPI_Comm    comm_r;
+  long        expand, G_istart_r, G_jstart_r;
+  long        L_width_r_true_gross, L_istart_r_true_gross, L_jstart_r_true_gross;
+} fill_state_t;
+
+/* asynchronous version of get_BG_data: compute the intersections, pack the send
+   buffer, and post nonblocking point-to-point transfers in place of the
+   collective, so the fill can progress while the background grid is smoothed.
+   The matching get_BG_data_finish must be called before the interpolation       */
+void get_BG_data_start(fill_state_t *fill, int load_balance, DTYPE *in_bg, DTYPE *ing_r,
+                 int my_ID, long expand, int Num_procs, long L_width_bg,
+                 long L_istart_bg, long L_iend_bg, long L_jstart_bg, long L_jend_bg,
+                 long G_istart_r, long G_jstart_r, MPI_Comm comm_bg, MPI_Comm comm_r,
+                 long L_istart_r_gross, long L_iend_r_gross,
+                 long L_jstart_r_gross, long L_jend_r_gross,
+                 long L_width_r_true_gross, long L_istart_r_true_gross,
+                 long L_jstart_r_true_gross) {
+
+  long send_vec[8], *recv_vec, offset, i, j, p;
+  int *recv_offset, *recv_count, *send_offset, *send_count;
+
+  fill->active                = 1;
+  fill->recv_vec              = NULL;
+  fill->num_req               = 0;
+  fill->acc_send              = fill->acc_recv = 0;
+  fill->ing_r                 = ing_r;
+  fill->comm_r                = comm_r;
+  fill->expand                = expand;
+  fill->G_istart_r            = G_istart_r;
+  fill->G_jstart_r            = G_jstart_r;
+  fill->L_width_r_true_gross  = L_width_r_true_gross;
+  fill->L_istart_r_true_gross = L_istart_r_true_gross;
+  fill->L_jstart_r_true_gross = L_jstart_r_true_gross;
+
+  if (load_balance == no_talk) {
+    /* in case of no_talk we just copy the in-rank data from BG to refinement     */
+    if (comm_r != MPI_COMM_NULL) {
+      for (j=L_jstart_r_gross; j<=L_jend_r_gross; j++)
+      for (i=L_istart_r_gross; i<=L_iend_r_gross; i++) {
+	int ir = i-G_istart_r, jr = j-G_jstart_r;
+	ING_R(ir*expand,jr*expand) = IN(i,j);
+      }
+    }
+    return;
+  }
+
+  recv_vec    = fill->recv_vec    = (long *) prk_malloc(sizeof(long)*Num_procs*8);
+  recv_count  = fill->recv_count  = (int *)  prk_malloc(sizeof(int)*Num_procs);
+  recv_offset = fill->recv_offset = (int *)  prk_malloc(sizeof(int)*Num_procs);
+  send_count  = fill->send_count  = (int *)  prk_malloc(sizeof(int)*Num_procs);
+  send_offset = fill->send_offset = (int *)  prk_malloc(sizeof(int)*Num_procs);
+  fill->request = (MPI_Request *) prk_malloc(sizeof(MPI_Request)*2*Num_procs);
+  if (!recv_vec || !recv_count || !recv_offset || !send_count || !send_offset ||
+      !fill->request){
+    printf("ERROR: Could not allocate space for Allgather on rank %d\n", my_ID);
+    MPI_Abort(MPI_COMM_WORLD, 66); // no graceful exit in timed code
+  }
+
+  /* ask all other ranks what chunk of BG they have, and what chunk of the
+     refinement (one of the two will be nil for high_water)                     */
+
+  send_vec[0] = L_istart_bg;
+  send_vec[1] = L_iend_bg;
+  send_vec[2] = L_jstart_bg;
+  send_vec[3] = L_jend_bg;
+
+  send_vec[4] = L_istart_r_gross;
+  send_vec[5] = L_iend_r_gross;
+  send_vec[6] = L_jstart_r_gross;
+  send_vec[7] = L_jend_r_gross;
+
+  MPI_Allgather(send_vec, 8, MPI_LONG, recv_vec, 8, MPI_LONG, MPI_COMM_WORLD);
+
+  for (p=0; p<Num_procs; p++) {
+    /* Compute intersection of calling rank's gross refinement patch with each remote
+       BG chunk,  which is the data they need to receive                        */
+    recv_vec[p*8+0] = MAX(recv_vec[p*8+0], L_istart_r_gross);
+    recv_vec[p*8+1] = MIN(recv_vec[p*8+1], L_iend_r_gross);
+    recv_vec[p*8+2] = MAX(recv_vec[p*8+2], L_jstart_r_gross);
+    recv_vec[p*8+3] = MIN(recv_vec[p*8+3], L_jend_r_gross);
+    /* now they determine how much data they are going to receive from each rank*/
+    recv_count[p] = MAX(0,(recv_vec[p*8+1]-recv_vec[p*8+0]+1)) *
+                    MAX(0,(recv_vec[p*8+3]-recv_vec[p*8+2]+1));
+    fill->acc_recv += recv_count[p];
+  }
+  if (fill->acc_recv) {
+    fill->recv_buf = (DTYPE *) prk_malloc(sizeof(DTYPE)*fill->acc_recv);
+    if (!fill->recv_buf) {
+      printf("ERROR: Could not allocate space for recv_buf on rank %d\n", my_ID);
+      MPI_Abort(MPI_COMM_WORLD, 66); // no graceful exit in timed code
+    }
+  }
+
+  for (p=0; p<Num_procs; p++) {
+    /* compute intersection of calling rank BG with each refinement chunk, which
+       is the data they need to send                                            */
+    recv_vec[p*8+4] = MAX(recv_vec[p*8+4], L_istart_bg);
+    recv_vec[p*8+5] = MIN(recv_vec[p*8+5], L_iend_bg);
+    recv_vec[p*8+6] = MAX(recv_vec[p*8+6], L_jstart_bg);
+    recv_vec[p*8+7] = MIN(recv_vec[p*8+7], L_jend_bg);
+    /* now they determine how much data they are going to send to each rank     */
+    send_count[p] = MAX(0,(recv_vec[p*8+5]-recv_vec[p*8+4]+1)) *
+                    MAX(0,(recv_vec[p*8+7]-recv_vec[p*8+6]+1));
+    fill->acc_send += send_count[p];
+  }
+  if (fill->acc_send) {
+    fill->send_buf = (DTYPE *) prk_malloc(sizeof(DTYPE)*fill->acc_send);
+    if (!fill->send_buf) {
+      printf("ERROR: Could not allocate space for send_buf on rank %d\n", my_ID);
+      MPI_Abort(MPI_COMM_WORLD, 66); // no graceful exit in timed code
+    }
+  }
+
+  recv_offset[0] =  send_offset[0] = 0;
+  for (p=1; p<Num_procs; p++) {
+    recv_offset[p] = recv_offset[p-1]+recv_count[p-1];
+    send_offset[p] = send_offset[p-1]+send_count[p-1];
+  }
+
+  /* post all receives before any sends, so matching sends can complete early   */
+  if (comm_r != MPI_COMM_NULL) for (p=0; p<Num_procs; p++) if (recv_count[p]) {
+    MPI_Irecv(fill->recv_buf+recv_offset[p], recv_count[p], MPI_DTYPE, p, 4343,
+              MPI_COMM_WORLD, &(fill->request[fill->num_req++]));
+  }
+
+  /* fill send buffer with BG data to all other ranks who need it               */
+  offset = 0;
+  if (comm_bg != MPI_COMM_NULL) for (p=0; p<Num_procs; p++){
+    if (recv_vec[p*8+4]<=recv_vec[p*8+5]) { //test for non-empty inner loop
+      for (j=recv_vec[p*8+6]; j<=recv_vec[p*8+7]; j++) {
+        for (i=recv_vec[p*8+4]; i<=recv_vec[p*8+5]; i++){
+          fill->send_buf[offset++] = IN(i,j);
+        }
+      }
+    }
+    if (send_count[p]) {
+      MPI_Isend(fill->send_buf+send_offset[p], send_count[p], MPI_DTYPE, p, 4343,
+                MPI_COMM_WORLD, &(fill->request[fill->num_req++]));
+    }
+  }
+}
+
+/* give MPI a chance to progress outstanding fill transfers during compute      */
+void fill_progress(fill_state_t *fill) {
+  int flag;
+  if (fill->active && fill->num_req)
+    MPI_Testall(fill->num_req, fill->request, &flag, MPI_STATUSES_IGNORE);
+}
+
+/* complete an asynchronous refinement patch fill: wait for the outstanding
+   transfers and drain the receive buffer into the refinement                   */
+void get_BG_data_finish(fill_state_t *fill, int Num_procs) {
+
+  long  offset, i, j, p;
+  DTYPE *ing_r                = fill->ing_r;
+  long  expand                = fill->expand;
+  long  G_istart_r            = fill->G_istart_r;
+  long  G_jstart_r            = fill->G_jstart_r;
+  long  L_width_r_true_gross  = fill->L_width_r_true_gross;
+  long  L_istart_r_true_gross = fill->L_istart_r_true_gross;
+  long  L_jstart_r_true_gross = fill->L_jstart_r_true_gross;
+  long  *recv_vec             = fill->recv_vec;
+
+  if (!fill->active) return;
+  fill->active = 0;
+  /* no_talk copied the data locally in get_BG_data_start                       */
+  if (!recv_vec) return;
+
+  if (fill->num_req) MPI_Waitall(fill->num_req, fill->request, MPI_STATUSES_IGNORE);
+
+  /* drain receive buffer with BG data from all other ranks who supplied it     */
+  offset = 0;
+  if (fill->comm_r != MPI_COMM_NULL) for (p=0; p<Num_procs; p++) {
+    if (recv_vec[p*8+0]<=recv_vec[p*8+1]) { //test for non-empty inner loop
+      for (j=recv_vec[p*8+2]-G_jstart_r; j<=recv_vec[p*8+3]-G_jstart_r; j++) {
+        for (i=recv_vec[p*8+0]-G_istart_r; i<=recv_vec[p*8+1]-G_istart_r; i++) {
+          ING_R(i*expand,j*expand) = fill->recv_buf[offset++];
+	}
+      }
+    }
+  }
+  prk_free(fill->recv_vec);
+  prk_free(fill->recv_count);
+  prk_free(fill->recv_offset);
+  prk_free(fill->send_count);
+  prk_free(fill->send_offset);
+  prk_free(fill->request);
+  if (fill->acc_recv) prk_free(fill->recv_buf);
+  if (fill->acc_send) prk_free(fill->send_buf);
+}
+
 /* use two-stage, bi-linear interpolation of BG values to refinement. BG values
    have already been copied to the refinement                                   */
 void interpolate(DTYPE *ing_r, long L_width_r_true_gross,
@@ -373,6 +624,24 @@ int main(int argc, char ** argv) {
   int    validate=1;        /* tracks correct solution on all grids                */
   char   *c_load_balance;   /* input string defining load balancing                */
   int    load_balance;      /* integer defining load balancing                     */
+  int    fill_mode;         /* synchronous or asynchronous refinement patch fill   */
+  fill_state_t fill;        /* state of refinement patch fill in flight            */
+  int    bg_updated;        /* BG stencil already applied this iteration (async)   */
+  double tick;              /* scratch timer                                       */
+  double local_fill_post_time,   /* time spent packing/posting patch fills         */
+         local_fill_hidden_time, /* BG compute overlapped with patch fills         */
+         local_fill_exposed_time,/* fill wait+drain time not hidden by compute     */
+         fill_post_time, fill_hidden_time, fill_exposed_time;
+  char   snap_path[256];    /* base name of grid snapshot files                    */
+  char   snap_file[280];    /* per-rank snapshot file name                         */
+  int    snap_on=0;         /* nonzero when a snapshot base name was given         */
+  int    snap_mode=snap_none; /* no snapshot, write one, or map one                */
+  int    snap_fd;           /* snapshot file descriptor                            */
+  size_t snap_bytes;        /* total size of snapshot file                         */
+  void   *snap_base;        /* address at which snapshot file is mapped            */
+  snap_header_t snap_header;/* snapshot file header                                */
+  double local_setup_time=0.0, /* time to initialize, dump, or map the grids       */
+         setup_time;
   MPI_Request request_bg[8];
   MPI_Request request_r[4][8];
   MPI_Comm comm_r[4];       /* communicators for refinements                       */
@@ -402,14 +671,18 @@ int main(int argc, char ** argv) {
     goto ENDOFINPUTTESTS;
 #endif
 
-    if (argc != 9 && argc != 10){
+    if (argc < 9 || argc > 12){
       printf("Usage: %s <# iterations> <background grid size> <refinement size>\n",
              *argv);
       printf("       <refinement level> <refinement period> <refinement duration>\n");
-      printf("       <refinement sub-iterations> <load balancer> \n");
+      printf("       <refinement sub-iterations> <load balancer> [<fill engine>]\n");
+      printf("       [SNAPSHOT=<file>]\n");
       printf("       load balancer: FINE_GRAIN [refinement rank spread]\n");
       printf("                      NO_TALK\n");
       printf("                      HIGH_WATER\n");
+      printf("       fill engine (optional): SYNC or ASYNC\n");
+      printf("       SNAPSHOT=<file>: dump initialized grids to per-rank files\n");
+      printf("       on first use, map them back on later matching runs\n");
       error = 1;
       goto ENDOFINPUTTESTS;
     }
@@ -487,14 +760,33 @@ int main(int argc, char ** argv) {
       goto ENDOFINPUTTESTS;
     }
 
-    if (load_balance==fine_grain && argc==10) {
-      rank_spread = atoi(*++argv);
-      if (rank_spread<1 || rank_spread>Num_procs) {
-	printf("ERROR: Invalid number of ranks to spread refinement work: %d\n", rank_spread);
-	error = 1;
-	goto ENDOFINPUTTESTS;
+    /* optional trailing arguments: refinement rank spread (FINE_GRAIN only),
+       the refinement patch fill engine, and the grid snapshot base name         */
+    rank_spread = Num_procs;
+    fill_mode   = fill_sync;
+    for (int arg=9; arg<argc; arg++) {
+      char *c_arg = *++argv;
+      if      (!strcmp("ASYNC", c_arg)) fill_mode = fill_async;
+      else if (!strcmp("SYNC",  c_arg)) fill_mode = fill_sync;
+      else if (!strncmp("SNAPSHOT=", c_arg, 9)) {
+        strncpy(snap_path, c_arg+9, sizeof(snap_path)-1);
+        snap_path[sizeof(snap_path)-1] = '\0';
+        snap_on = 1;
+      }
+      else if (load_balance==fine_grain) {
+        rank_spread = atoi(c_arg);
+        if (rank_spread<1 || rank_spread>Num_procs) {
+	  printf("ERROR: Invalid number of ranks to spread refinement work: %d\n", rank_spread);
+	  error = 1;
+	  goto ENDOFINPUTTESTS;
+        }
       }
-    } else rank_spread = Num_procs;
+      else {
+        printf("ERROR: invalid trailing argument %s\n", c_arg);
+        error = 1;
+        goto ENDOFINPUTTESTS;
+      }
+    }
 
     if (RADIUS < 1) {
       printf("ERROR: Stencil radius %d should be positive\n", RADIUS);
@@ -536,7 +828,41 @@ int main(int argc, char ** argv) {
   MPI_Bcast(&sub_iterations, 1, MPI_INT,   root, MPI_COMM_WORLD);
   MPI_Bcast(&load_balance,   1, MPI_INT,   root, MPI_COMM_WORLD);
   MPI_Bcast(&rank_spread,    1, MPI_INT,   root, MPI_COMM_WORLD);
+  MPI_Bcast(&fill_mode,      1, MPI_INT,   root, MPI_COMM_WORLD);
   MPI_Bcast(&expand,         1, MPI_LONG,  root, MPI_COMM_WORLD);
+  MPI_Bcast(&snap_on,        1, MPI_INT,   root, MPI_COMM_WORLD);
+  if (snap_on) MPI_Bcast(snap_path, sizeof(snap_path), MPI_CHAR, root, MPI_COMM_WORLD);
+
+  /* decide whether to map existing grid snapshots or to write new ones; the
+     decomposition is a pure function of the parameters in the header, so a
+     matching header guarantees matching array sizes. All ranks must agree,
+     lest some regenerate while others map                                       */
+  if (snap_on) {
+    int valid = 1, all_valid;
+    snprintf(snap_file, sizeof(snap_file), "%s.%04d", snap_path, my_ID);
+    snap_fd = open(snap_file, O_RDONLY);
+    if (snap_fd < 0) valid = 0;
+    else {
+      if (read(snap_fd, &snap_header, sizeof(snap_header)) != sizeof(snap_header) ||
+          memcmp(snap_header.magic, SNAP_MAGIC, sizeof(snap_header.magic))        ||
+          snap_header.version      != SNAP_VERSION ||
+          snap_header.num_procs    != Num_procs    ||
+          snap_header.rank         != my_ID        ||
+          snap_header.n            != n            ||
+          snap_header.n_r          != n_r          ||
+          snap_header.refine_level != refine_level ||
+          snap_header.load_balance != load_balance ||
+          snap_header.rank_spread  != rank_spread  ||
+          snap_header.radius       != RADIUS       ||
+          snap_header.dtype_size   != (int)sizeof(DTYPE)) valid = 0;
+      close(snap_fd);
+    }
+    MPI_Allreduce(&valid, &all_valid, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+    snap_mode = all_valid ? snap_map : snap_write;
+    if (my_ID == root && snap_mode == snap_write && valid)
+      printf("Snapshot %s* does not match current parameters on all ranks; regenerating\n",
+             snap_path);
+  }
 
   /* depending on the load balancing strategy chosen, we determine the 
      partitions of BG (background grid) and the refinements                  */
@@ -655,13 +981,16 @@ int main(int argc, char ** argv) {
     total_length_in  = (long) (L_width_bg+2*RADIUS)*(long) (L_height_bg+2*RADIUS);
     total_length_out = (long) L_width_bg* (long) L_height_bg;
 
-    in_bg  = (DTYPE *) prk_malloc(total_length_in*sizeof(DTYPE));
-    out_bg = (DTYPE *) prk_malloc(total_length_out*sizeof(DTYPE));
-    if (!in_bg || !out_bg) {
-      printf("ERROR: rank %d could not allocate space for input/output array\n",
-              my_ID);
-      error = 1;
-      goto ENDOFBG;
+    /* when mapping a snapshot the fields live in the mapped file instead        */
+    if (snap_mode != snap_map) {
+      in_bg  = (DTYPE *) prk_malloc(total_length_in*sizeof(DTYPE));
+      out_bg = (DTYPE *) prk_malloc(total_length_out*sizeof(DTYPE));
+      if (!in_bg || !out_bg) {
+        printf("ERROR: rank %d could not allocate space for input/output array\n",
+                my_ID);
+        error = 1;
+        goto ENDOFBG;
+      }
     }
     ENDOFBG:;
   }
@@ -670,6 +999,8 @@ int main(int argc, char ** argv) {
     L_iend_bg   = -1;
     L_jstart_bg =  0;;
     L_jend_bg   = -1;
+    total_length_in  = 0;
+    total_length_out = 0;
   }
   bail_out(error);
   
@@ -760,6 +1091,10 @@ int main(int argc, char ** argv) {
     printf("Load balancer                   = %s\n", c_load_balance);
     if (load_balance==fine_grain)
       printf("Refinement rank spread          = %d\n", rank_spread);
+    printf("Patch fill engine               = %s\n",
+           (fill_mode==fill_async) ? "ASYNC" : "SYNC");
+    if      (snap_mode == snap_write) printf("Grid snapshot                   = writing %s.*\n", snap_path);
+    else if (snap_mode == snap_map)   printf("Grid snapshot                   = mapping %s.*\n", snap_path);
     printf("Refinements:\n");
     printf("   Background grid points       = %ld\n", n_r);
     printf("   Grid size                    = %ld\n", n_r_true);
@@ -879,11 +1214,13 @@ int main(int argc, char ** argv) {
     total_length_in_r[g]  = (L_width_r_true_gross[g]+2*RADIUS)*
                             (L_height_r_true_gross[g]+2*RADIUS);
     total_length_out_r[g] = L_width_r_true_gross[g] * L_height_r_true_gross[g];
-    in_r[g]  = (DTYPE *) prk_malloc(sizeof(DTYPE)*total_length_in_r[g]);
-    out_r[g] = (DTYPE *) prk_malloc(sizeof(DTYPE)*total_length_out_r[g]);
-    if (!in_r[g] || !out_r[g]) {
-      printf("ERROR: could not allocate space for refinement input or output arrays\n");
-      error=1;
+    if (snap_mode != snap_map) {
+      in_r[g]  = (DTYPE *) prk_malloc(sizeof(DTYPE)*total_length_in_r[g]);
+      out_r[g] = (DTYPE *) prk_malloc(sizeof(DTYPE)*total_length_out_r[g]);
+      if (!in_r[g] || !out_r[g]) {
+        printf("ERROR: could not allocate space for refinement input or output arrays\n");
+        error=1;
+      }
     }
   }
   else {//Bogus patch
@@ -891,6 +1228,8 @@ int main(int argc, char ** argv) {
     L_iend_r_gross[g]   = -1;
     L_jstart_r_gross[g] =  0;
     L_jend_r_gross[g]   = -1;
+    total_length_in_r[g]  = 0;
+    total_length_out_r[g] = 0;
   }
   bail_out(error);
 
@@ -911,8 +1250,42 @@ int main(int argc, char ** argv) {
   f_active_points_bg = (DTYPE) (n-2*RADIUS)*(DTYPE) (n-2*RADIUS);
   f_active_points_r  = (DTYPE) (n_r_true-2*RADIUS)*(DTYPE) (n_r_true-2*RADIUS);
 
+  local_setup_time = wtime();
+
+  if (snap_mode == snap_map) {
+    /* map this rank's snapshot copy-on-write and point the grid fields into
+       it; faulted pages start from the initialized contents, and the stencil
+       updates go to private pages, never back to the file                     */
+    struct stat st;
+    char *cursor;
+    snap_bytes = SNAP_DATA_OFFSET +
+                 (size_t)(total_length_in+total_length_out)*sizeof(DTYPE);
+    for (g=0; g<4; g++)
+      snap_bytes += (size_t)(total_length_in_r[g]+total_length_out_r[g])*sizeof(DTYPE);
+    snap_fd = open(snap_file, O_RDONLY);
+    if (snap_fd < 0 || fstat(snap_fd, &st) < 0 || (size_t)st.st_size < snap_bytes) {
+      printf("ERROR: rank %d cannot use snapshot file %s\n", my_ID, snap_file);
+      error = 1;
+    }
+    bail_out(error);
+    snap_base = mmap(NULL, snap_bytes, PROT_READ|PROT_WRITE, MAP_PRIVATE, snap_fd, 0);
+    if (snap_base == MAP_FAILED) {
+      printf("ERROR: rank %d could not map snapshot file %s\n", my_ID, snap_file);
+      error = 1;
+    }
+    bail_out(error);
+    close(snap_fd);
+    cursor = (char *)snap_base + SNAP_DATA_OFFSET;
+    in_bg  = (DTYPE *) cursor; cursor += total_length_in *sizeof(DTYPE);
+    out_bg = (DTYPE *) cursor; cursor += total_length_out*sizeof(DTYPE);
+    for (g=0; g<4; g++) {
+      in_r[g]  = (DTYPE *) cursor; cursor += total_length_in_r[g] *sizeof(DTYPE);
+      out_r[g] = (DTYPE *) cursor; cursor += total_length_out_r[g]*sizeof(DTYPE);
+    }
+  }
+
   /* intialize the input and output arrays                                     */
-  if (comm_bg != MPI_COMM_NULL)
+  if (snap_mode != snap_map && comm_bg != MPI_COMM_NULL)
   for (j=L_jstart_bg; j<=L_jend_bg; j++) for (i=L_istart_bg; i<=L_iend_bg; i++) {
     IN(i,j)  = COEFX*i+COEFY*j;
     OUT(i,j) = (DTYPE)0.0;
@@ -943,14 +1316,52 @@ int main(int argc, char ** argv) {
   bail_out(error);
 
   /* intialize the refinement arrays                                           */
+  if (snap_mode != snap_map)
   for (g=0; g<4; g++) if (comm_r[g] != MPI_COMM_NULL) {
-    for (j=L_jstart_r_true[g]; j<=L_jend_r_true[g]; j++) 
+    for (j=L_jstart_r_true[g]; j<=L_jend_r_true[g]; j++)
     for (i=L_istart_r_true[g]; i<=L_iend_r_true[g]; i++) {
       IN_R(g,i,j)  = (DTYPE)0.0;
       OUT_R(g,i,j) = (DTYPE)0.0;
     }
   }
 
+  if (snap_mode == snap_write) {
+    /* dump the freshly initialized grids; the next run with matching
+       parameters and rank count maps them back instead of re-initializing     */
+    memset(&snap_header, 0, sizeof(snap_header));
+    memcpy(snap_header.magic, SNAP_MAGIC, sizeof(snap_header.magic));
+    snap_header.version      = SNAP_VERSION;
+    snap_header.num_procs    = Num_procs;
+    snap_header.rank         = my_ID;
+    snap_header.n            = n;
+    snap_header.n_r          = n_r;
+    snap_header.refine_level = refine_level;
+    snap_header.load_balance = load_balance;
+    snap_header.rank_spread  = rank_spread;
+    snap_header.radius       = RADIUS;
+    snap_header.dtype_size   = (int)sizeof(DTYPE);
+    snap_fd = open(snap_file, O_WRONLY|O_CREAT|O_TRUNC, 0644);
+    if (snap_fd < 0                                                       ||
+        snap_write_chunk(snap_fd, &snap_header, sizeof(snap_header))      ||
+        lseek(snap_fd, SNAP_DATA_OFFSET, SEEK_SET) != SNAP_DATA_OFFSET    ||
+        snap_write_chunk(snap_fd, in_bg,  total_length_in *sizeof(DTYPE)) ||
+        snap_write_chunk(snap_fd, out_bg, total_length_out*sizeof(DTYPE))) {
+      printf("ERROR: rank %d could not write snapshot file %s\n", my_ID, snap_file);
+      error = 1;
+    }
+    for (g=0; g<4 && !error; g++) {
+      if (snap_write_chunk(snap_fd, in_r[g],  total_length_in_r[g] *sizeof(DTYPE)) ||
+          snap_write_chunk(snap_fd, out_r[g], total_length_out_r[g]*sizeof(DTYPE))) {
+        printf("ERROR: rank %d could not write snapshot file %s\n", my_ID, snap_file);
+        error = 1;
+      }
+    }
+    if (snap_fd >= 0) close(snap_fd);
+    bail_out(error);
+  }
+
+  local_setup_time = wtime() - local_setup_time;
+
   for (g=0; g<4; g++) if (comm_r[g] != MPI_COMM_NULL) {
     /* allocate communication buffers for halo values                          */
     top_buf_out_r[g] = (DTYPE *) prk_malloc(4*sizeof(DTYPE)*RADIUS*L_width_r_true[g]);
@@ -975,16 +1386,21 @@ int main(int argc, char ** argv) {
   bail_out(error);
 
   local_stencil_time = 0.0; /* silence compiler warning */
+  local_fill_post_time = local_fill_hidden_time = local_fill_exposed_time = 0.0;
+  fill.active = 0;
 
   num_interpolations = 0;
-  
+
   for (iter = 0; iter<=iterations; iter++){
 
     /* start timer after a warmup iteration */
     if (iter == 1) {
       MPI_Barrier(MPI_COMM_WORLD);
       local_stencil_time = wtime();
+      /* exclude the warmup fill from the overlap timers                          */
+      local_fill_post_time = local_fill_hidden_time = local_fill_exposed_time = 0.0;
     }
+    bg_updated = 0;
     /* first complete communication on background grid to help no_talk balancer     */
     if (comm_bg != MPI_COMM_NULL) {
       /* need to fetch ghost point data from neighbors in y-direction                 */
@@ -1069,14 +1485,57 @@ int main(int argc, char ** argv) {
       /* a specific refinement has come to life                                */
       g=(iter/period)%4;
 
-      get_BG_data(load_balance, in_bg, in_r[g], my_ID, expand, Num_procs,
-                  L_width_bg, L_istart_bg, L_iend_bg, L_jstart_bg, L_jend_bg,
-                  L_istart_r[g], L_iend_r[g], L_jstart_r[g], L_jend_r[g],
-                  G_istart_r[g], G_jstart_r[g], comm_bg, comm_r[g],
-                  L_istart_r_gross[g], L_iend_r_gross[g], 
-                  L_jstart_r_gross[g], L_jend_r_gross[g], 
-                  L_width_r_true_gross[g], L_istart_r_true_gross[g], L_iend_r_true_gross[g],
-                  L_jstart_r_true_gross[g], L_jend_r_true_gross[g], g);
+      if (fill_mode == fill_async) {
+        /* post the patch fill early and smooth the background grid while the
+           transfers are in flight; the send buffer is packed before the BG
+           input field is updated, so results are identical to the sync engine   */
+        tick = wtime();
+        get_BG_data_start(&fill, load_balance, in_bg, in_r[g], my_ID, expand,
+                    Num_procs, L_width_bg, L_istart_bg, L_iend_bg, L_jstart_bg,
+                    L_jend_bg, G_istart_r[g], G_jstart_r[g], comm_bg, comm_r[g],
+                    L_istart_r_gross[g], L_iend_r_gross[g],
+                    L_jstart_r_gross[g], L_jend_r_gross[g],
+                    L_width_r_true_gross[g], L_istart_r_true_gross[g],
+                    L_jstart_r_true_gross[g]);
+        local_fill_post_time += wtime() - tick;
+
+        tick = wtime();
+        if (comm_bg != MPI_COMM_NULL) {
+          for (int j=MAX(L_jstart_bg,RADIUS); j<=MIN(n-RADIUS-1,L_jend_bg); j++) {
+            for (int i=MAX(L_istart_bg,RADIUS); i<=MIN(n-RADIUS-1,L_iend_bg); i++) {
+              #if LOOPGEN
+                #include "loop_body_star.incl"
+              #else
+                for (int jj=-RADIUS; jj<=RADIUS; jj++) OUT(i,j) += WEIGHT(0,jj)*IN(i,j+jj);
+                for (int ii=-RADIUS; ii<0; ii++)       OUT(i,j) += WEIGHT(ii,0)*IN(i+ii,j);
+                for (int ii=1; ii<=RADIUS; ii++)       OUT(i,j) += WEIGHT(ii,0)*IN(i+ii,j);
+              #endif
+            }
+            /* poke the progress engine every few rows of overlapped compute     */
+            if (!(j%PROGRESS_STRIDE)) fill_progress(&fill);
+          }
+
+          /* add constant to solution to force refresh of neighbor data, if any */
+          for (int j=L_jstart_bg; j<=L_jend_bg; j++)
+          for (int i=L_istart_bg; i<=L_iend_bg; i++) IN(i,j)+= 1.0;
+        }
+        bg_updated = 1;
+        local_fill_hidden_time += wtime() - tick;
+
+        tick = wtime();
+        get_BG_data_finish(&fill, Num_procs);
+        local_fill_exposed_time += wtime() - tick;
+      }
+      else {
+        get_BG_data(load_balance, in_bg, in_r[g], my_ID, expand, Num_procs,
+                    L_width_bg, L_istart_bg, L_iend_bg, L_jstart_bg, L_jend_bg,
+                    L_istart_r[g], L_iend_r[g], L_jstart_r[g], L_jend_r[g],
+                    G_istart_r[g], G_jstart_r[g], comm_bg, comm_r[g],
+                    L_istart_r_gross[g], L_iend_r_gross[g],
+                    L_jstart_r_gross[g], L_jend_r_gross[g],
+                    L_width_r_true_gross[g], L_istart_r_true_gross[g], L_iend_r_true_gross[g],
+                    L_jstart_r_true_gross[g], L_jend_r_true_gross[g], g);
+      }
 
       
       if (comm_r[g] != MPI_COMM_NULL) {
@@ -1202,8 +1661,9 @@ int main(int argc, char ** argv) {
       }
     }
 
-    /* Apply the stencil operator to background grid                                 */
-    if (comm_bg != MPI_COMM_NULL) {
+    /* Apply the stencil operator to background grid, unless that already
+       happened while the asynchronous patch fill was in flight                      */
+    if (!bg_updated && comm_bg != MPI_COMM_NULL) {
       for (int j=MAX(L_jstart_bg,RADIUS); j<=MIN(n-RADIUS-1,L_jend_bg); j++) {
         for (int i=MAX(L_istart_bg,RADIUS); i<=MIN(n-RADIUS-1,L_iend_bg); i++) {
           #if LOOPGEN
@@ -1226,6 +1686,14 @@ int main(int argc, char ** argv) {
   local_stencil_time = wtime() - local_stencil_time;
   MPI_Reduce(&local_stencil_time, &stencil_time, 1, MPI_DOUBLE, MPI_MAX, root,
              MPI_COMM_WORLD);
+  MPI_Reduce(&local_setup_time, &setup_time, 1, MPI_DOUBLE, MPI_MAX, root,
+             MPI_COMM_WORLD);
+  MPI_Reduce(&local_fill_post_time, &fill_post_time, 1, MPI_DOUBLE, MPI_MAX, root,
+             MPI_COMM_WORLD);
+  MPI_Reduce(&local_fill_hidden_time, &fill_hidden_time, 1, MPI_DOUBLE, MPI_MAX, root,
+             MPI_COMM_WORLD);
+  MPI_Reduce(&local_fill_exposed_time, &fill_exposed_time, 1, MPI_DOUBLE, MPI_MAX, root,
+             MPI_COMM_WORLD);
 
   /* compute normalized L1 solution norm on background grid                      */
   local_norm = (DTYPE) 0.0;
@@ -1379,6 +1847,13 @@ int main(int argc, char ** argv) {
       avgtime = stencil_time/iterations;
       printf("Rate (MFlops/s): "FSTR"  Avg time (s): %lf\n",
              1.0E-06 * flops/stencil_time, avgtime);
+      printf("Setup time (s): %lf (grids %s)\n", setup_time,
+             snap_mode==snap_map   ? "mapped from snapshot" :
+             snap_mode==snap_write ? "initialized, snapshot written" : "initialized");
+      if (fill_mode == fill_async) {
+        printf("Patch fill post time (s): %lf  hidden time (s): %lf  exposed time (s): %lf\n",
+               fill_post_time, fill_hidden_time, fill_exposed_time);
+      }
     }
   }
 
@@ -58,9 +58,14 @@ FUNCTIONS CALLED:
 NOTES:   Derived frmo SUMMA implementation provided by Robert Van de Geijn,
          U. Texas at Austion.
          Algorithm first published by Elmroth, Gustavson, Jonsson & Kagstrom
+         Panel broadcasts are double buffered and posted with MPI_Ibcast,
+         so the broadcast of the next panel progresses while the local
+         update with the current panel is in flight. The panel width nb
+         tunes the compute/communication overlap.
 
 HISTORY: Written by Rob Van der Wijngaart, December 2007
-  
+         Panel broadcast pipelining added, 2020
+
 ***********************************************************************************/
 
 #include "par-res-kern_general.h"
@@ -75,7 +80,6 @@ HISTORY: Written by Rob Van der Wijngaart, December 2007
 
 #define epsilon  0.00001
 
-void RING_Bcast(double *, int, MPI_Datatype, int, MPI_Comm);
 void dlacpy(int, int, double *, int, double *, int);
 void dgemm_local(int, int, int, double *, int, double *, int, 
                  double *, int, int, int);
@@ -257,9 +261,11 @@ int main(int argc, char *argv[])
   }
   bail_out(error);
 
-  /* get space for two work arrays for dgemm                       */
-  work1 = (double *) prk_malloc( nb*lda*sizeof(double) );
-  work2 = (double *) prk_malloc( nb*myncols*sizeof(double) );
+  /* get space for two work arrays for dgemm; both are double
+     buffered so the broadcast of the next panel can overlap the
+     local update with the current panel                           */
+  work1 = (double *) prk_malloc( 2*nb*lda*sizeof(double) );
+  work2 = (double *) prk_malloc( 2*nb*myncols*sizeof(double) );
   if ( !work1 || !work2 ) {
     printf("ERROR: Proc %d could not allocate work buffers\n", my_ID);
     error = 1;
@@ -354,71 +360,129 @@ int main(int argc, char *argv[])
   MPI_Finalize();
 }
 
-void dgemm(k, nb, inner_block_flag, a, lda, b, ldb, c, ldc, mm, nn, 
+/* descriptor of one SUMMA panel: its position in the global matrix
+   and the rank grid row and column that own its data               */
+typedef struct {
+  int kk,               /* global index of first column of panel    */
+      updt,             /* panel width                              */
+      currow, curcol,   /* rank grid row/column that own the panel  */
+      ii, jj;           /* offsets within that row and column       */
+} panel_t;
+
+/* compute the width of the panel at the current position; the width
+   is the minimum of 1. the maximum number of remaining columns of A
+   and 2. the maximum number of remaining rows of B, respectively,
+   that can be gathered from the current row and column of the rank
+   grid, with an overall maximum of the block factor nb (carried in
+   p->updt). Returns zero when the matrix has been exhausted        */
+static int next_panel(panel_t *p, int k, int mm[], int nn[])
+{
+  if (p->kk >= k) return 0;
+  p->updt = MIN(p->updt, mm[p->currow]-p->ii);
+  p->updt = MIN(p->updt, nn[p->curcol]-p->jj);
+  return 1;
+}
+
+/* move the panel descriptor past the current panel; when a certain
+   rank grid row or column has been exhausted, move to the next row
+   or column (increment currow or curcol) and reset ii or jj       */
+static void advance_panel(panel_t *p, int mm[], int nn[])
+{
+  p->kk += p->updt;
+  p->ii += p->updt;     p->jj += p->updt;
+  if (p->jj>=nn[p->curcol]) {p->curcol++; p->jj = 0;};
+  if (p->ii>=mm[p->currow]) {p->currow++; p->ii = 0;};
+}
+
+/* pack a panel into buffer slot "slot" of the work arrays and post
+   its nonblocking broadcasts along the rank grid row and column    */
+static void post_panel(panel_t *p, int slot, double *a, int lda,
+                       double *b, int ldb, double *work1, double *work2,
+                       int nb, int mm[], int nn[], int myrow, int mycol,
+                       MPI_Comm comm_row, MPI_Comm comm_col,
+                       MPI_Request req[2])
+{
+  double *w1 = work1 + (long)slot*nb*lda;
+  double *w2 = work2 + (long)slot*nb*nn[mycol];
+
+  /* pack current "updt" columns of A into work1                   */
+  if ( mycol == p->curcol )
+     dlacpy(mm[myrow], p->updt, &A(0,p->jj), lda, w1, mm[myrow]);
+
+  /* pack current "updt" rows of B into work2                      */
+  if ( myrow == p->currow )
+     dlacpy(p->updt, nn[mycol], &B(p->ii,0), ldb, w2, p->updt );
+
+  /* broadcast work1 and work2                                     */
+  MPI_Ibcast(w1, mm[myrow]*p->updt, MPI_DOUBLE, p->curcol, comm_row,
+             &req[0]);
+  MPI_Ibcast(w2, nn[mycol]*p->updt, MPI_DOUBLE, p->currow, comm_col,
+             &req[1]);
+}
+
+void dgemm(k, nb, inner_block_flag, a, lda, b, ldb, c, ldc, mm, nn,
            comm_row, comm_col, work1, work2 )
 int    k,               /* global matrix dimensions                */
        nb,              /* panel width                             */
        inner_block_flag,/* determines local dgemm blocking         */
        mm[], nn[],      /* dimensions of blocks of A, B, C         */
-       lda, ldb, ldc;   /* leading dimension of local arrays that 
+       lda, ldb, ldc;   /* leading dimension of local arrays that
                            hold local portions of matrices A, B, C */
 double RESTRICT *a, *b, *c,/* arrays holding local parts of A, B, C \*/
-       *work1, *work2;  /* work arrays                             */
+       *work1, *work2;  /* work arrays, double buffered            */
 MPI_Comm comm_row,      /* Communicator for this row of nodes      */
        comm_col;        /* Communicator for this column of nodes   */
 {
-  int myrow, mycol,     /* my  row and column index                */
-      updt,             /* misc. index variables                   */
-      currow, curcol;   /* index of row and column that hold current 
-                           row and column, resp., for rank-1 update*/
-  int my_ID;
-
-  /* get row, column, and global MPI rank                          */
-  MPI_Comm_rank(comm_row, &mycol);  
+  int myrow, mycol;     /* my  row and column index                */
+  panel_t cur, nxt;     /* current and next panel descriptors      */
+  int slot,             /* work array buffer slot of current panel */
+      have_next;        /* true if another panel follows           */
+  MPI_Request reqs[2][2];/* broadcast requests, one pair per slot  */
+
+  /* get row and column rank                                       */
+  MPI_Comm_rank(comm_row, &mycol);
   MPI_Comm_rank(comm_col, &myrow);
-  MPI_Comm_rank(MPI_COMM_WORLD, &my_ID);
 
   /* This routine does a rank "updt" update of the matrix block
-     owned by the calling rank. This requires updt whole columns
-     of A and updt whole rows of B. The value of updt is determined
-     as the minimum of 1. the maximum number of remaining columns 
-     of A and 2. the maximum number of remaining rows of B, 
-     respectively, that can be gathered from the current row and column 
-     of the rank grid, with an overall maximum of the block factor nb.
-     We keep track of how many matrix columns and rows of the current 
-     rank grid row and column have been visited through the
-     indices ii and jj. When a certain rank grid row or column 
-     has been exhausted, we move to the next row or column (increment
-     currow or curcol) and reset ii or jj to zero                  */
-
-  currow = curcol = 0;
-  int ii = 0, jj = 0;
-  updt = nb;
-
-  for (int kk=0; kk<k; kk+=updt) {
-    updt = MIN(updt,mm[currow]-ii);
-    updt = MIN(updt,nn[curcol]-jj);
-
-    /* pack current "updt" columns of A into work1                 */
-    if ( mycol == curcol ) 
-       dlacpy(mm[myrow], updt, &A(0,jj), lda, work1, mm[myrow]);
-
-    /* pack current "updt" rows of B into work2                    */
-    if ( myrow == currow ) 
-       dlacpy(updt, nn[mycol], &B(ii,0), ldb, work2, updt );
-
-    /* broadcast work1 and work2                                   */
-    RING_Bcast(work1, mm[myrow]*updt, MPI_DOUBLE, curcol, comm_row); 
-    RING_Bcast(work2, nn[mycol]*updt, MPI_DOUBLE, currow, comm_col); 
-
-    /* update local block                                          */
-    dgemm_local(mm[myrow], nn[mycol], updt, work1, mm[myrow], 
-          work2, updt, c, ldc, nb, inner_block_flag);
-
-    /* update curcol, currow, ii, jj                             */
-    ii += updt;           jj += updt;
-    if (jj>=nn[curcol]) {curcol++; jj = 0;};
-    if (ii>=mm[currow]) {currow++; ii = 0;};
+     owned by the calling rank for each panel of updt whole columns
+     of A and updt whole rows of B. The broadcasts of the two panel
+     buffers are pipelined: while the local update with the current
+     panel executes, the broadcast of the next panel, posted into
+     the other buffer slot, makes progress                         */
+
+  cur.kk = 0;           cur.updt   = nb;
+  cur.currow = cur.curcol = 0;
+  cur.ii = cur.jj = 0;
+
+  if (!next_panel(&cur, k, mm, nn)) return;
+
+  /* prime the pipeline with the first panel                       */
+  slot = 0;
+  post_panel(&cur, slot, a, lda, b, ldb, work1, work2, nb, mm, nn,
+             myrow, mycol, comm_row, comm_col, reqs[slot]);
+
+  while (1) {
+    /* complete the broadcasts of the current panel                */
+    MPI_Waitall(2, reqs[slot], MPI_STATUSES_IGNORE);
+
+    /* post the broadcast of the next panel, if any, into the other
+       buffer slot before updating with the current panel          */
+    nxt = cur;
+    advance_panel(&nxt, mm, nn);
+    have_next = next_panel(&nxt, k, mm, nn);
+    if (have_next)
+      post_panel(&nxt, 1-slot, a, lda, b, ldb, work1, work2, nb, mm, nn,
+                 myrow, mycol, comm_row, comm_col, reqs[1-slot]);
+
+    /* update local block with the current panel                   */
+    dgemm_local(mm[myrow], nn[mycol], cur.updt,
+          work1+(long)slot*nb*lda, mm[myrow],
+          work2+(long)slot*nb*nn[mycol], cur.updt,
+          c, ldc, nb, inner_block_flag);
+
+    if (!have_next) break;
+    cur  = nxt;
+    slot = 1-slot;
   }
 }
 
@@ -487,16 +551,3 @@ void dlacpy(int m, int n, double *a, int lda, double *b, int ldb ) {
 
   return;
 }
-
-void RING_Bcast(double *buf, int count, MPI_Datatype type, int root, 
-              MPI_Comm comm )
-{
-  int my_ID, Num_procs;
-
-  MPI_Comm_rank( comm, &my_ID );    MPI_Comm_size( comm, &Num_procs );
-  if (my_ID != root) 
-    MPI_Recv(buf, count, type, (my_ID-1+Num_procs)%Num_procs, root, 
-             comm, MPI_STATUS_IGNORE);
-  if (( my_ID+1 )%Num_procs != root)
-    MPI_Send(buf, count, type, (my_ID+1)%Num_procs, root, comm);
-}
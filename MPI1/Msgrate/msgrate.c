@@ -0,0 +1,264 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+* Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*******************************************************************
+
+NAME:    Msgrate
+
+PURPOSE: This program measures the aggregate small-message rate and
+         injection bandwidth of the network. The ranks are split into
+         sender/receiver pairs (the first half of the rank space sends
+         to the second half), every sender streams windows of
+         nonblocking messages at its partner, and the partner
+         acknowledges each completed window. All pairs inject
+         concurrently, so the reported rates are those of the fabric
+         under full load, not of a single quiet pair. The message size
+         is swept in powers of two between the given bounds, which
+         separates the latency-bound message-rate regime from the
+         bandwidth-bound regime in a single run.
+
+USAGE:   The program takes as input the number of window repetitions
+         per message size, the number of messages per window, and
+         optionally the bounds of the message size sweep in bytes.
+
+               <progname> <# iterations> <window size> \
+                          [<min msg size> <max msg size>]
+
+         The output consists of diagnostics to make sure the
+         algorithm worked, and of timing statistics.
+
+FUNCTIONS CALLED:
+
+         Other than MPI or standard C functions, the following external
+         functions are used in this program:
+
+         wtime();
+         bail_out();
+
+HISTORY: Written by Rob Van der Wijngaart, September 2026.
+
+*******************************************************************/
+
+#include <par-res-kern_general.h>
+#include <par-res-kern_mpi.h>
+
+#define MAXSIZES 64
+
+int main(int argc, char ** argv)
+{
+  int    Num_procs;     /* number of ranks                                   */
+  int    my_ID;         /* rank                                              */
+  int    root=0;
+  int    iterations;    /* number of windows per message size                */
+  int    window;        /* number of messages per window                     */
+  long   min_size,      /* bounds of the message size sweep, in bytes        */
+         max_size;
+  long   cur_size;      /* message size of the current sweep step            */
+  int    num_sizes;     /* number of sweep steps                             */
+  int    num_pairs;     /* number of concurrent sender/receiver pairs        */
+  int    sender;        /* this rank sends (first half of the rank space)    */
+  int    partner;       /* the other end of this rank's pair                 */
+  int    iter, w, s;    /* dummies                                           */
+  long   i;
+  char   * RESTRICT sbuf; /* outgoing message, reused across the window      */
+  char   * RESTRICT rbuf; /* one landing zone per message in the window      */
+  MPI_Request *reqs;    /* pending messages of the current window            */
+  char   ack;           /* window acknowledgment                             */
+  double local_msg_time[MAXSIZES], /* timing parameters                      */
+         msg_time[MAXSIZES];
+  double msg_rate, bandwidth;
+  int    error = 0;     /* error flag                                        */
+
+  /***************************************************************************
+  ** Initialize the MPI environment
+  ****************************************************************************/
+  MPI_Init(&argc,&argv);
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_ID);
+  MPI_Comm_size(MPI_COMM_WORLD, &Num_procs);
+
+  /***************************************************************************
+  ** process, test and broadcast input parameters
+  ****************************************************************************/
+
+  if (my_ID == root){
+    printf("Parallel Research Kernels version %s\n", PRKVERSION);
+    printf("MPI aggregate message rate\n");
+
+    if (argc != 3 && argc != 5){
+      printf("Usage: %s <# iterations> <window size> [<min msg size> <max msg size>]\n",
+             *argv);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    iterations = atoi(*++argv);
+    if (iterations < 2) {
+      printf("ERROR: Iterations must be at least 2: %d\n", iterations);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    window = atoi(*++argv);
+    if (window < 1) {
+      printf("ERROR: Window size must be positive: %d\n", window);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    min_size = (argc==5) ? atol(*++argv) : 8;
+    max_size = (argc==5) ? atol(*++argv) : 65536;
+    if (min_size < 1 || max_size < min_size) {
+      printf("ERROR: Invalid message size bounds: %ld, %ld\n",
+             min_size, max_size);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    if (Num_procs < 2 || Num_procs%2 != 0) {
+      printf("ERROR: Number of ranks must be even and at least 2: %d\n",
+             Num_procs);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    ENDOFTESTS:;
+  }
+  bail_out(error);
+
+  /* Broadcast benchmark data to all ranks */
+  MPI_Bcast(&iterations, 1, MPI_INT,  root, MPI_COMM_WORLD);
+  MPI_Bcast(&window,     1, MPI_INT,  root, MPI_COMM_WORLD);
+  MPI_Bcast(&min_size,   1, MPI_LONG, root, MPI_COMM_WORLD);
+  MPI_Bcast(&max_size,   1, MPI_LONG, root, MPI_COMM_WORLD);
+
+  num_pairs = Num_procs/2;
+  sender    = (my_ID < num_pairs);
+  partner   = sender ? my_ID + num_pairs : my_ID - num_pairs;
+
+  num_sizes = 0;
+  for (cur_size = min_size; cur_size <= max_size; cur_size *= 2) num_sizes++;
+
+  if (my_ID == root) {
+    printf("Number of ranks      = %d\n", Num_procs);
+    printf("Number of pairs      = %d\n", num_pairs);
+    printf("Window size          = %d\n", window);
+    printf("Message sizes        = %ld-%ld bytes, %d steps\n",
+           min_size, max_size, num_sizes);
+    printf("Number of iterations = %d\n", iterations);
+  }
+
+  /* the send buffer is read-only during the window and can be shared by
+     all pending messages; each receive needs its own landing zone        */
+  sbuf = (char *) prk_malloc(max_size);
+  rbuf = (char *) prk_malloc((size_t)window*max_size);
+  reqs = (MPI_Request *) prk_malloc(window*sizeof(MPI_Request));
+  if (!sbuf || !rbuf || !reqs) {
+    printf("ERROR: Rank %d could not allocate message buffers\n", my_ID);
+    error = 1;
+  }
+  bail_out(error);
+
+  for (i=0; i<max_size; i++) sbuf[i] = (char)((my_ID+i)%127);
+
+  for (cur_size = min_size, s = 0; cur_size <= max_size; cur_size *= 2, s++) {
+
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    for (iter = 0; iter<=iterations; iter++) {
+
+      /* start timer after a warming up iteration */
+      if (iter == 1) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        local_msg_time[s] = wtime();
+      }
+
+      if (sender) {
+        for (w=0; w<window; w++) {
+          MPI_Isend(sbuf, cur_size, MPI_CHAR, partner, s, MPI_COMM_WORLD,
+                    &reqs[w]);
+        }
+        MPI_Waitall(window, reqs, MPI_STATUSES_IGNORE);
+        MPI_Recv(&ack, 1, MPI_CHAR, partner, s, MPI_COMM_WORLD,
+                 MPI_STATUS_IGNORE);
+      }
+      else {
+        for (w=0; w<window; w++) {
+          MPI_Irecv(rbuf+(size_t)w*cur_size, cur_size, MPI_CHAR, partner, s,
+                    MPI_COMM_WORLD, &reqs[w]);
+        }
+        MPI_Waitall(window, reqs, MPI_STATUSES_IGNORE);
+        MPI_Send(&ack, 1, MPI_CHAR, partner, s, MPI_COMM_WORLD);
+      }
+    }
+
+    local_msg_time[s] = wtime() - local_msg_time[s];
+
+    /* every landing zone must hold the partner's pattern                 */
+    if (!sender) {
+      for (w=0; w<window; w++) {
+        for (i=0; i<cur_size; i++) {
+          if (rbuf[(size_t)w*cur_size+i] != (char)((partner+i)%127)) error++;
+        }
+      }
+      if (error) {
+        printf("ERROR: Rank %d found %d corrupted bytes at message size %ld\n",
+               my_ID, error, cur_size);
+      }
+    }
+    bail_out(error);
+  }
+
+  MPI_Reduce(local_msg_time, msg_time, num_sizes, MPI_DOUBLE, MPI_MAX, root,
+             MPI_COMM_WORLD);
+
+  /***************************************************************************
+  ** Analyze and output results
+  ****************************************************************************/
+
+  if (my_ID == root) {
+    printf("Solution validates\n");
+    for (cur_size = min_size, s = 0; cur_size <= max_size; cur_size *= 2, s++) {
+      msg_rate  = (double)iterations*window*num_pairs/msg_time[s];
+      bandwidth = 1.0E-06 * msg_rate * cur_size;
+      printf("Message size (B): %8ld, Rate (Msgs/s): %13.0lf, "
+             "Injection bandwidth (MB/s): %lf\n",
+             cur_size, msg_rate, bandwidth);
+    }
+  }
+
+  prk_free(reqs);
+  prk_free(rbuf);
+  prk_free(sbuf);
+
+  MPI_Finalize();
+  exit(EXIT_SUCCESS);
+}
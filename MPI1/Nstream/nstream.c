@@ -83,7 +83,22 @@ USAGE:     The program takes as input the number of iterations to loop
  
            The output consists of diagnostics to make sure the 
            algorithm worked, and of timing statistics.
- 
+
+           Setting PRK_NODE_SHARED=1 makes the ranks of each node
+           allocate their vectors from a single MPI_Win_allocate_shared
+           region, and the report adds per-node aggregate and per-socket
+           bandwidth: summing per-rank rates over-counts shared memory
+           controllers, the node aggregate divides the node's bytes by
+           the node's slowest rank and shows controller saturation
+           directly.
+
+           Setting PRK_NET_STREAM=<size> makes each rank keep a
+           nonblocking message of <size> KBytes in flight to a partner
+           in the other half of the rank list for every triad
+           iteration, so memory bandwidth and injection bandwidth are
+           exercised simultaneously; the report then adds the achieved
+           aggregate network rate under this co-pressure.
+
 FUNCTIONS CALLED:
  
            Other than MPI or standard C functions, the following 
@@ -114,14 +129,45 @@ REVISION:  Modified by Rob Van der Wijngaart, November 2014, replaced
            loop; also replaced separate loop establishing dependence
            between iterations (must now be included in timing) with
            accumulation: a[] += b[] + scalar*c[]
+REVISION:  Node-shared allocation and per-node/per-socket reporting,
+           September 2026
 **********************************************************************/
+
+#if defined(__linux__)
+#define _GNU_SOURCE 1
+#endif
  
 #include <par-res-kern_general.h>
 #include <par-res-kern_mpi.h>
+#if defined(__linux__)
+#include <sched.h>
+#endif
  
 #define SCALAR  3.0
  
 static int checkTRIADresults(int, long int, double *);
+
+/* socket of the core the rank currently runs on; single socket where
+   the topology is not exposed                                         */
+static int get_socket_id(void)
+{
+#if defined(__linux__)
+  char path[128];
+  int  cpu = sched_getcpu();
+  if (cpu >= 0) {
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpu);
+    FILE *f = fopen(path, "r");
+    if (f) {
+      int socket = -1;
+      if (fscanf(f, "%d", &socket) != 1) socket = -1;
+      fclose(f);
+      if (socket >= 0) return socket;
+    }
+  }
+#endif
+  return 0;
+}
  
 int main(int argc, char **argv) 
 {
@@ -143,6 +189,17 @@ int main(int argc, char **argv)
   double * RESTRICT a;    /* main vector                                 */
   double * RESTRICT b;    /* main vector                                 */
   double * RESTRICT c;    /* main vector                                 */
+  int      node_shared=0; /* allocate from a node-shared window          */
+  long     net_stream=0;  /* network stream message size in KB, 0 = off  */
+  long     msg_len;       /* network stream message length in doubles    */
+  int      partner;       /* network stream partner rank                 */
+  double   *sbuf=NULL,    /* network stream send buffer                  */
+           *rbuf;         /* network stream receive buffer               */
+  MPI_Request net_req[2]; /* network stream message handles              */
+  MPI_Comm node_comm;     /* ranks sharing this node                     */
+  MPI_Win  shm_win;       /* node-shared window holding the vectors      */
+  int      *node_of, *socket_of; /* per-rank placement, root only        */
+  double   *time_of;      /* per-rank timings, root only                 */
  
 /**********************************************************************************
 * process and test input parameters    
@@ -184,6 +241,18 @@ int main(int argc, char **argv)
       goto ENDOFTESTS;
     }
 
+    {
+      char *envp = getenv("PRK_NODE_SHARED");
+      if (envp != NULL && atoi(envp) != 0) node_shared = 1;
+      envp = getenv("PRK_NET_STREAM");
+      if (envp != NULL) net_stream = atol(envp);
+      if (net_stream < 0) net_stream = 0;
+      if (net_stream > 0 && Num_procs == 1) {
+        printf("Network stream requires at least two ranks; disabled\n");
+        net_stream = 0;
+      }
+    }
+
     ENDOFTESTS:;
   }
   bail_out(error);
@@ -192,9 +261,21 @@ int main(int argc, char **argv)
   MPI_Bcast(&length,1, MPI_LONG, root, MPI_COMM_WORLD);
   MPI_Bcast(&offset,1, MPI_LONG, root, MPI_COMM_WORLD);
   MPI_Bcast(&iterations,1, MPI_INT, root, MPI_COMM_WORLD);
+  MPI_Bcast(&node_shared,1, MPI_INT, root, MPI_COMM_WORLD);
+  MPI_Bcast(&net_stream,1, MPI_LONG, root, MPI_COMM_WORLD);
 
   space = (3*length + 2*offset)*sizeof(double);
-  a = (double *) prk_malloc(space);
+  if (node_shared) {
+    /* one shared region per node; each rank owns the segment it
+       allocates, so the partitioning falls out of the window layout   */
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, my_ID,
+                        MPI_INFO_NULL, &node_comm);
+    MPI_Win_allocate_shared((MPI_Aint)space, sizeof(double), MPI_INFO_NULL,
+                            node_comm, &a, &shm_win);
+  }
+  else {
+    a = (double *) prk_malloc(space);
+  }
   if (!a && my_ID == root) {
     printf("ERROR: Could not allocate %ld bytes for vectors\n", (long int)space);
     error = 1;
@@ -205,12 +286,42 @@ int main(int argc, char **argv)
   c = b + length + offset;
 
   bytes   = 4.0 * sizeof(double) * length * Num_procs;
- 
+
+  /* pair up the halves of the rank list for the network stream; with
+     block placement the partner sits on another node whenever the job
+     spans nodes.  With an odd rank count the last rank runs the triad
+     without streaming                                                 */
+  partner = -1;
+  if (net_stream > 0) {
+    int half = Num_procs/2;
+    if      (my_ID < half)   partner = my_ID + half;
+    else if (my_ID < 2*half) partner = my_ID - half;
+    msg_len = net_stream*1024/sizeof(double);
+    if (msg_len < 1) msg_len = 1;
+    if (partner >= 0) {
+      sbuf = (double *) prk_malloc(2*msg_len*sizeof(double));
+      if (!sbuf) {
+        printf("ERROR: rank %d could not allocate network stream buffers\n", my_ID);
+        error = 1;
+      }
+    }
+  }
+  bail_out(error);
+  if (partner >= 0) {
+    rbuf = sbuf + msg_len;
+    for (j=0; j<msg_len; j++) sbuf[j] = (double) my_ID;
+  }
+
   if (my_ID == root) {
     printf("Number of ranks      = %d\n", Num_procs);
     printf("Vector length        = %ld\n", total_length);
     printf("Offset               = %ld\n", offset);
     printf("Number of iterations = %d\n", iterations);
+    if (node_shared)
+      printf("Allocation           = node-shared window (MPI_Win_allocate_shared)\n");
+    if (net_stream > 0)
+      printf("Network stream       = %ld KB/rank/iteration, cross-half partners\n",
+             net_stream);
   }
 
   for (j=0; j<length; j++) {
@@ -231,8 +342,19 @@ int main(int argc, char **argv)
       local_nstream_time = wtime();
     }
 
+    /* keep a nonblocking exchange in flight across the triad so the
+       fabric and the memory system are loaded simultaneously          */
+    if (partner >= 0) {
+      MPI_Irecv(rbuf, msg_len, MPI_DOUBLE, partner, 42, MPI_COMM_WORLD,
+                &net_req[0]);
+      MPI_Isend(sbuf, msg_len, MPI_DOUBLE, partner, 42, MPI_COMM_WORLD,
+                &net_req[1]);
+    }
+
     for (j=0; j<length; j++) a[j] += b[j]+scalar*c[j];
 
+    if (partner >= 0) MPI_Waitall(2, net_req, MPI_STATUSES_IGNORE);
+
   } /* end iterations */
  
   /*********************************************************************
@@ -242,16 +364,88 @@ int main(int argc, char **argv)
   local_nstream_time = wtime() - local_nstream_time;
   MPI_Reduce(&local_nstream_time, &nstream_time, 1, MPI_DOUBLE, MPI_MAX, root,
              MPI_COMM_WORLD);
-  
+  prk_report_rank_stats(local_nstream_time, MPI_COMM_WORLD);
+
+  node_of = socket_of = NULL; time_of = NULL;
+  if (node_shared) {
+    /* identify each rank's node by its node leader's world rank, and
+       funnel placement and timing to the root for the breakdown       */
+    int placement[2];
+    placement[0] = my_ID;
+    MPI_Bcast(&placement[0], 1, MPI_INT, 0, node_comm);
+    placement[1] = get_socket_id();
+    if (my_ID == root) {
+      node_of   = (int *)    prk_malloc(2*Num_procs*sizeof(int));
+      socket_of = node_of + Num_procs;
+      time_of   = (double *) prk_malloc(Num_procs*sizeof(double));
+    }
+    int my_pair[2]; my_pair[0] = placement[0]; my_pair[1] = placement[1];
+    int *pairs = (my_ID==root) ? (int *) prk_malloc(2*Num_procs*sizeof(int)) : NULL;
+    MPI_Gather(my_pair, 2, MPI_INT, pairs, 2, MPI_INT, root, MPI_COMM_WORLD);
+    MPI_Gather(&local_nstream_time, 1, MPI_DOUBLE, time_of, 1, MPI_DOUBLE,
+               root, MPI_COMM_WORLD);
+    if (my_ID == root) {
+      for (j=0; j<Num_procs; j++) {
+        node_of[j]   = pairs[2*j];
+        socket_of[j] = pairs[2*j+1];
+      }
+      prk_free(pairs);
+    }
+  }
+
   if (my_ID == root) {
     if (checkTRIADresults(iterations, length, a)) {
       avgtime = nstream_time/iterations;
       printf("Rate (MB/s): %lf Avg time (s): %lf\n",
              1.0E-06 * bytes/avgtime, avgtime);
+      if (net_stream > 0) {
+        /* injected bytes per iteration: one message per streaming rank */
+        double net_bytes = (double)net_stream*1024.0*(2*(Num_procs/2));
+        printf("Network rate (MB/s): %lf aggregate, under memory co-pressure\n",
+               1.0E-06 * net_bytes/avgtime);
+      }
+      if (node_shared) {
+        /* a node's aggregate is its bytes over its slowest rank, so the
+           shared memory controllers are counted once                  */
+        int node, rank, socket;
+        for (node=0; node<Num_procs; node++) {
+          int    nranks=0;
+          double maxtime=0.0;
+          for (rank=0; rank<Num_procs; rank++) {
+            if (node_of[rank] != node) continue;
+            nranks++;
+            if (time_of[rank] > maxtime) maxtime = time_of[rank];
+          }
+          if (nranks==0 || maxtime<=0.0) continue;
+          printf("Node %3d aggregate (%d ranks), rate (MB/s): %lf\n", node, nranks,
+                 1.0E-06 * (4.0*sizeof(double)*length*nranks)/(maxtime/iterations));
+          for (socket=0; ; socket++) {
+            int    sranks=0;
+            double smaxtime=0.0;
+            for (rank=0; rank<Num_procs; rank++) {
+              if (node_of[rank] != node || socket_of[rank] != socket) continue;
+              sranks++;
+              if (time_of[rank] > smaxtime) smaxtime = time_of[rank];
+            }
+            if (sranks==0) break;
+            printf("  socket %d (%d ranks), rate (MB/s): %lf\n", socket, sranks,
+                   1.0E-06 * (4.0*sizeof(double)*length*sranks)/(smaxtime/iterations));
+          }
+        }
+      }
     }
     else error = 1;
   }
   bail_out(error);
+  if (node_shared) {
+    if (my_ID == root) {
+      prk_free(time_of);
+      prk_free(node_of);
+    }
+    MPI_Win_free(&shm_win);
+    MPI_Comm_free(&node_comm);
+  }
+  if (partner >= 0) prk_free(sbuf);
   MPI_Finalize();
 }
  
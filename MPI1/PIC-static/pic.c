@@ -42,7 +42,17 @@ PURPOSE: This program tests the efficiency with which a cloud of
 
 USAGE:   <progname> <#simulation steps> <grid size> <#particles> \
                     <horizontal velocity> <vertical velocity>    \
-                    <init mode> <init parameters>
+                    <init mode> <init parameters>                \
+                    [<lb period> [<lb threshold>]]
+
+         The optional trailing parameters enable periodic particle load
+         balancing. Every <lb period> time steps the particle counts are
+         gathered; if the ratio of the maximum to the average count
+         exceeds <lb threshold>, surplus particles are shipped from
+         overloaded to underloaded ranks, where they are pushed using
+         charges computed directly from the dipole pattern. The
+         threshold acts as a simple cost model: redistribution is
+         skipped when the projected gain is small.
 
          The output consists of diagnostics to make sure the
          algorithm worked, and of timing statistics.
@@ -68,10 +78,12 @@ FUNCTIONS CALLED:
          bad_patch()
          contain()
          wtime()
-         random_draw()
+         random_draw_batch()
 
 HISTORY: - Written by Evangelos Georganas, August 2015.
          - RvdW: Refactored to make the code PRK conforming, March 2016
+         - Initialization draws random numbers a grid column at a time
+           through the batched (vectorizable) generator interface
 
 **********************************************************************************/
 #include <par-res-kern_general.h>
@@ -209,11 +221,16 @@ particle_t *initializeGeometric(uint64_t n_input, uint64_t L, double rho,
                                 random_draw_t *parm) {
   particle_t  *particles;
   double      A;
-  uint64_t    x, y, p, pi, actual_particles, start_index;
+  uint64_t    x, y, p, pi, actual_particles, start_index, height, *draws;
 
   /* initialize random number generator */
   LCG_init(parm);
 
+  /* column-sized buffer for the batched random number generator */
+  height = tile.top - tile.bottom;
+  draws = (uint64_t*) prk_malloc(height * sizeof(uint64_t));
+  if (draws == NULL) return(NULL);
+
   /* first determine total number of particles, then allocate and place them               */
   /* Each cell in the i-th column of cells contains p(i) = A * rho^i particles */
   A = n_input * ((1.0-rho) / (1.0-pow(rho, L))) / (double) L;
@@ -222,8 +239,9 @@ particle_t *initializeGeometric(uint64_t n_input, uint64_t L, double rho,
     /* at start of each grid column we jump into sequence of random numbers */
     start_index = tile.bottom+x*L;
     LCG_jump(2*start_index, 0, parm);
+    random_draw_batch(A * pow(rho, x), height, draws, parm);
     for (y=tile.bottom; y<tile.top; y++) {
-      (*n_placed) += random_draw(A * pow(rho, x), parm);
+      (*n_placed) += draws[y-tile.bottom];
     }
   }
 
@@ -236,8 +254,9 @@ particle_t *initializeGeometric(uint64_t n_input, uint64_t L, double rho,
     /* at start of each grid column we jump into sequence of random numbers */
     start_index = tile.bottom+x*L;
     LCG_jump(2*start_index, 0, parm);
+    random_draw_batch(A * pow(rho, x), height, draws, parm);
     for (y=tile.bottom; y<tile.top; y++) {
-      actual_particles = random_draw(A * pow(rho, x), parm);
+      actual_particles = draws[y-tile.bottom];
       for (p=0; p<actual_particles; p++) {
         particles[pi].x = x + REL_X;
         particles[pi].y = y + REL_Y;
@@ -248,6 +267,7 @@ particle_t *initializeGeometric(uint64_t n_input, uint64_t L, double rho,
     }
   }
   finishParticlesInitialization((*n_placed), particles);
+  prk_free(draws);
 
   return particles;
 }
@@ -259,19 +279,25 @@ particle_t *initializeSinusoidal(uint64_t n_input, uint64_t L,
                                  random_draw_t *parm) {
   particle_t  *particles;
   double      step;
-  uint64_t     x, y, pi, p, actual_particles, start_index;
+  uint64_t     x, y, pi, p, actual_particles, start_index, height, *draws;
 
   /* initialize random number generator */
   LCG_init(parm);
 
+  /* column-sized buffer for the batched random number generator */
+  height = tile.top - tile.bottom;
+  draws = (uint64_t*) prk_malloc(height * sizeof(uint64_t));
+  if (draws == NULL) return(NULL);
+
   step = PRK_M_PI/L;
   /* Place number of particles to each cell to form distribution decribed in spec.         */
   for ((*n_placed)=0,x=tile.left; x<tile.right; x++) {
     /* at start of each grid column we jump into sequence of random numbers */
     start_index = tile.bottom+x*L;
     LCG_jump(2*start_index, 0, parm);
+    random_draw_batch(2.0*cos(x*step)*cos(x*step)*n_input/(L*L), height, draws, parm);
     for (y=tile.bottom; y<tile.top; y++) {
-      (*n_placed) += random_draw(2.0*cos(x*step)*cos(x*step)*n_input/(L*L), parm);
+      (*n_placed) += draws[y-tile.bottom];
     }
   }
 
@@ -284,8 +310,9 @@ particle_t *initializeSinusoidal(uint64_t n_input, uint64_t L,
     /* at start of each grid column we jump into sequence of random numbers */
     start_index = tile.bottom+x*L;
     LCG_jump(2*start_index, 0, parm);
+    random_draw_batch(2.0*cos(x*step)*cos(x*step)*n_input/(L*L), height, draws, parm);
     for (y=tile.bottom; y<tile.top; y++) {
-      actual_particles = random_draw(2.0*cos(x*step)*cos(x*step)*n_input/(L*L), parm);
+      actual_particles = draws[y-tile.bottom];
       for (p=0; p<actual_particles; p++) {
         particles[pi].x = x + REL_X;
         particles[pi].y = y + REL_Y;
@@ -296,6 +323,7 @@ particle_t *initializeSinusoidal(uint64_t n_input, uint64_t L,
     }
   }
   finishParticlesInitialization((*n_placed), particles);
+  prk_free(draws);
   return particles;
 }
 
@@ -307,11 +335,16 @@ particle_t *initializeLinear(uint64_t n_input, uint64_t L, double alpha, double
                              random_draw_t *parm) {
   particle_t  *particles;
   double      total_weight, step, current_weight;
-  uint64_t     x, y, p, pi, actual_particles, start_index;
+  uint64_t     x, y, p, pi, actual_particles, start_index, height, *draws;
 
   /* initialize random number generator */
   LCG_init(parm);
 
+  /* column-sized buffer for the batched random number generator */
+  height = tile.top - tile.bottom;
+  draws = (uint64_t*) prk_malloc(height * sizeof(uint64_t));
+  if (draws == NULL) return(NULL);
+
   /* First, find sum of all weights in order to normalize the number of particles */
   step         = 1.0/(L-1);
   total_weight = beta*L-alpha*0.5*step*L*(L-1);
@@ -321,8 +354,9 @@ particle_t *initializeLinear(uint64_t n_input, uint64_t L, double alpha, double
     current_weight = (beta - alpha * step * ((double) x));
     start_index = tile.bottom+x*L;
     LCG_jump(2*start_index, 0, parm);
+    random_draw_batch(n_input*(current_weight/total_weight)/L, height, draws, parm);
     for (y=tile.bottom; y<tile.top; y++) {
-      (*n_placed) += random_draw(n_input*(current_weight/total_weight)/L, parm);
+      (*n_placed) += draws[y-tile.bottom];
     }
   }
 
@@ -335,8 +369,9 @@ particle_t *initializeLinear(uint64_t n_input, uint64_t L, double alpha, double
     current_weight = (beta - alpha * step * ((double) x));
     start_index = tile.bottom+x*L;
     LCG_jump(2*start_index,0, parm);
+    random_draw_batch(n_input*(current_weight/total_weight)/L, height, draws, parm);
     for (y=tile.bottom; y<tile.top; y++) {
-      actual_particles = random_draw(n_input*(current_weight/total_weight)/L, parm);
+      actual_particles = draws[y-tile.bottom];
       for (p=0; p<actual_particles; p++) {
         particles[pi].x = x + REL_X;
         particles[pi].y = y + REL_Y;
@@ -347,6 +382,7 @@ particle_t *initializeLinear(uint64_t n_input, uint64_t L, double alpha, double
     }
   }
   finishParticlesInitialization((*n_placed), particles);
+  prk_free(draws);
   return particles;
 }
 
@@ -356,22 +392,29 @@ particle_t *initializePatch(uint64_t n_input, uint64_t L, bbox_t patch,
                             uint64_t *n_placed, uint64_t *n_size,
                             random_draw_t *parm) {
   particle_t *particles;
-  uint64_t   x, y, total_cells, pi, p, actual_particles, start_index;
+  uint64_t   x, y, total_cells, pi, p, actual_particles, start_index, height, *draws;
   double     particles_per_cell;
 
   /* initialize random number generator */
   LCG_init(parm);
 
+  /* column-sized buffer for the batched random number generator */
+  height = tile.top - tile.bottom;
+  draws = (uint64_t*) prk_malloc(height * sizeof(uint64_t));
+  if (draws == NULL) return(NULL);
+
   total_cells  = (patch.right - patch.left+1)*(patch.top - patch.bottom+1);
   particles_per_cell = (double) n_input/total_cells;
 
-  /* Loop over columns of cells and assign number of particles if inside patch */
+  /* Loop over columns of cells and assign number of particles if inside patch;
+     cells outside the patch consume draws but contribute no particles, as in
+     the placement pass below                                                  */
   for (*n_placed=0,x=tile.left; x<tile.right; x++) {
     start_index = tile.bottom+x*L;
     LCG_jump(2*start_index, 0, parm);
+    random_draw_batch(particles_per_cell, height, draws, parm);
     for (y=tile.bottom; y<tile.top; y++) {
-      if (contain(x,y,patch)) (*n_placed) += random_draw(particles_per_cell, parm);
-      else                    (*n_placed) += random_draw(0.0, parm);
+      if (contain(x,y,patch)) (*n_placed) += draws[y-tile.bottom];
     }
   }
 
@@ -383,8 +426,9 @@ particle_t *initializePatch(uint64_t n_input, uint64_t L, bbox_t patch,
   for (pi=0,x=tile.left; x<tile.right; x++) {
     start_index = tile.bottom+x*L;
     LCG_jump(2*start_index,0, parm);
+    random_draw_batch(particles_per_cell, height, draws, parm);
     for (y=tile.bottom; y<tile.top; y++) {
-      actual_particles = random_draw(particles_per_cell, parm);
+      actual_particles = draws[y-tile.bottom];
       if (!contain(x,y,patch)) actual_particles = 0;
       for (p=0; p<actual_particles; p++) {
         particles[pi].x = x + REL_X;
@@ -396,6 +440,7 @@ particle_t *initializePatch(uint64_t n_input, uint64_t L, bbox_t patch,
     }
   }
   finishParticlesInitialization((*n_placed), particles);
+  prk_free(draws);
   return particles;
 }
 
@@ -490,6 +535,48 @@ void computeTotalForce(particle_t p, bbox_t tile, double *grid, double *fx, doub
   (*fy) = tmp_res_y;
 }
 
+/* Computes the total Coulomb force on a particle from the charges of its cell,
+   computing the dipole charges directly from the column parity, so that a
+   particle can be pushed by a rank that does not own the enclosing grid tile */
+void computeTotalForceGlobal(particle_t p, double *fx, double *fy)
+{
+  uint64_t  x, y;
+  double   q_left, q_right, tmp_fx, tmp_fy, rel_y, rel_x, tmp_res_x, tmp_res_y;
+
+  /* Coordinates of the cell containing the particle */
+  y = (uint64_t) floor(p.y);
+  x = (uint64_t) floor(p.x);
+
+  rel_x = p.x - x;
+  rel_y = p.y - y;
+
+  /* dipole charges of the left and right cell columns */
+  q_left  = (x%2 == 0) ? Q : -Q;
+  q_right = -q_left;
+
+  computeCoulomb(rel_x, rel_y, p.q, q_left, &tmp_fx, &tmp_fy);
+  tmp_res_x = tmp_fx;
+  tmp_res_y = tmp_fy;
+
+  /* Coulomb force from bottom-left charge */
+  computeCoulomb(rel_x, 1.0-rel_y, p.q, q_left, &tmp_fx, &tmp_fy);
+  tmp_res_x += tmp_fx;
+  tmp_res_y -= tmp_fy;
+
+  /* Coulomb force from top-right charge */
+  computeCoulomb(1.0-rel_x, rel_y, p.q, q_right, &tmp_fx, &tmp_fy);
+  tmp_res_x -= tmp_fx;
+  tmp_res_y += tmp_fy;
+
+  /* Coulomb force from bottom-right charge */
+  computeCoulomb(1.0-rel_x, 1.0-rel_y, p.q, q_right, &tmp_fx, &tmp_fy);
+  tmp_res_x -= tmp_fx;
+  tmp_res_y -= tmp_fy;
+
+  (*fx) = tmp_res_x;
+  (*fy) = tmp_res_y;
+}
+
 /* Verifies the final position of a particle */
 int verifyParticle(particle_t p, double L, uint64_t iterations)
 {
@@ -608,6 +695,15 @@ void resize_buffer(particle_t **buffer, uint64_t *size, uint64_t new_size)
 
 }
 
+/* Record of one load balancing event, reported after the timed loop */
+typedef struct {
+  uint64_t iteration;   // time step at which the rebalance took place
+  uint64_t moved;       // total number of particles redistributed
+  double   imb_before;  // max/avg particle count before redistribution
+  double   imb_after;   // max/avg particle count after redistribution
+  double   time;        // maximum time spent in the redistribution
+} lb_event_t;
+
 int main(int argc, char ** argv) {
 
   int             Num_procs;         // number of ranks
@@ -651,6 +747,17 @@ int main(int argc, char ** argv) {
   int             ileftover, jleftover;// excess grid points divided among "fat" tiles
   uint64_t        to_send[8], to_recv[8];//
   MPI_Request requests[16];
+  uint64_t        lb_period = 0;     // particle load balancing period; 0 disables
+  double          lb_threshold=1.05; // max/avg particle imbalance that triggers redistribution
+  particle_t      *hosted;           // particles pushed on behalf of other ranks
+  uint64_t        hosted_size, hosted_count=0;
+  particle_t      *lb_sendbuf, *lb_recvbuf; // particle redistribution buffers
+  uint64_t        lb_sendbuf_size, lb_recvbuf_size;
+  uint64_t        *lb_counts;        // gathered per-rank particle counts
+  uint64_t        *lb_to_send, *lb_to_recv; // redistribution schedule for my rank
+  MPI_Request     *lb_requests;
+  lb_event_t      *lb_events;        // records of rebalances, reported at the end
+  uint64_t        lb_num_events = 0;
   random_draw_t   dice;
 
   /* Initialize the MPI environment */
@@ -676,6 +783,7 @@ int main(int argc, char ** argv) {
       printf("             \"SINUSOIDAL\" parameters: none\n");
       printf("             \"LINEAR\"     parameters: <negative slope> <constant offset>\n");
       printf("             \"PATCH\"      parameters: <xleft> <xright>  <ybottom> <ytop>\n");
+      printf("   load balancing (optional): <lb period> [<lb threshold>]\n");
       error = 1;
       goto ENDOFTESTS;
     }
@@ -772,6 +880,19 @@ int main(int argc, char ** argv) {
         goto ENDOFTESTS2;
       }
     }
+
+    /* optional particle load balancing parameters */
+    if (argc>args_used) {
+      lb_period = atol(*++argv); args_used++;
+      if (argc>args_used) {
+        lb_threshold = atof(*++argv); args_used++;
+        if (lb_threshold < 1.0) {
+          printf("ERROR: imbalance threshold must be at least 1.0: %lf\n", lb_threshold);
+          error = 1;
+          goto ENDOFTESTS2;
+        }
+      }
+    }
     ENDOFTESTS2:;
 
   } //done with processing initializaton parameters, now broadcast
@@ -792,6 +913,8 @@ int main(int argc, char ** argv) {
                    MPI_Bcast(&init_patch.top,    1, MPI_UINT64_T, root, MPI_COMM_WORLD);
                    break;
   }
+  MPI_Bcast(&lb_period,    1, MPI_UINT64_T, root, MPI_COMM_WORLD);
+  MPI_Bcast(&lb_threshold, 1, MPI_DOUBLE,   root, MPI_COMM_WORLD);
 
   /* determine best way to create a 2D grid of ranks (closest to square, for
      best surface/volume ratio); we do this brute force for now                        */
@@ -807,7 +930,14 @@ int main(int argc, char ** argv) {
 
   if (my_ID == root) {
     printf("Number of ranks                    = %d\n", Num_procs);
-    printf("Load balancing                     = None\n");
+    if (lb_period) {
+      printf("Load balancing                     = particle redistribution\n");
+      printf("  Rebalancing period               = %llu\n", lb_period);
+      printf("  Imbalance threshold              = %lf\n", lb_threshold);
+    }
+    else {
+      printf("Load balancing                     = None\n");
+    }
     printf("Grid size                          = %llu\n", L);
     printf("Tiles in x/y-direction             = %d/%d\n", Num_procsx, Num_procsy);
     printf("Number of particles requested      = %llu\n", n);
@@ -944,6 +1074,27 @@ int main(int argc, char ** argv) {
   if (error) printf("Rank %d could not allocate communication buffers\n", my_ID);
   bail_out(error);
 
+  if (lb_period) {
+    /* Allocate space for the load balancing engine */
+    hosted_size     = MAX(1,n/(MEMORYSLACK*Num_procs));
+    lb_sendbuf_size = MAX(1,n/(MEMORYSLACK*Num_procs));
+    lb_recvbuf_size = MAX(1,n/(MEMORYSLACK*Num_procs));
+    hosted     = (particle_t*) prk_malloc(hosted_size * sizeof(particle_t));
+    lb_sendbuf = (particle_t*) prk_malloc(lb_sendbuf_size * sizeof(particle_t));
+    lb_recvbuf = (particle_t*) prk_malloc(lb_recvbuf_size * sizeof(particle_t));
+    lb_counts  = (uint64_t*) prk_malloc(Num_procs * sizeof(uint64_t));
+    lb_to_send = (uint64_t*) prk_malloc(Num_procs * sizeof(uint64_t));
+    lb_to_recv = (uint64_t*) prk_malloc(Num_procs * sizeof(uint64_t));
+    lb_requests= (MPI_Request*) prk_malloc(2 * Num_procs * sizeof(MPI_Request));
+    lb_events  = (lb_event_t*) prk_malloc((iterations/lb_period+1) * sizeof(lb_event_t));
+    if (!hosted || !lb_sendbuf || !lb_recvbuf || !lb_counts ||
+        !lb_to_send || !lb_to_recv || !lb_requests || !lb_events) {
+      printf("Rank %d could not allocate load balancing buffers\n", my_ID);
+      error = 1;
+    }
+    bail_out(error);
+  }
+
   /* Run the simulation */
   for (iter=0; iter<=iterations; iter++) {
 
@@ -953,6 +1104,87 @@ int main(int argc, char ** argv) {
       local_pic_time = wtime();
     }
 
+    /* Periodically redistribute particles over the ranks; the redistribution
+       is inside the timed region, so its cost shows up in the reported rate */
+    if (lb_period && iter && iter%lb_period == 0) {
+      uint64_t my_count, target, amount, moved, send_total, recv_total, staged, offset;
+      int      donor, receiver, rank, nreq;
+      double   total_count, max_count, imb_before, imb_after, lb_time, max_lb_time;
+
+      lb_time = wtime();
+      my_count = particles_count + hosted_count;
+      MPI_Allgather(&my_count, 1, MPI_UINT64_T, lb_counts, 1, MPI_UINT64_T,
+                    MPI_COMM_WORLD);
+      total_count = max_count = 0.0;
+      for (rank=0; rank<Num_procs; rank++) {
+        total_count += (double) lb_counts[rank];
+        max_count    = MAX(max_count, (double) lb_counts[rank]);
+      }
+      imb_before = max_count*Num_procs/total_count;
+      moved = 0;
+
+      if (imb_before > lb_threshold) {
+        /* compute a deterministic redistribution schedule from the gathered
+           counts: ranks above the average donate their surplus to ranks
+           below it, paired in rank order; every rank derives the same
+           schedule, so no further negotiation is needed                     */
+        target = (uint64_t) (total_count/Num_procs);
+        for (rank=0; rank<Num_procs; rank++) lb_to_send[rank] = lb_to_recv[rank] = 0;
+        donor = receiver = 0;
+        while (donor<Num_procs && receiver<Num_procs) {
+          while (donor<Num_procs    && lb_counts[donor]<=target)    donor++;
+          while (receiver<Num_procs && lb_counts[receiver]>=target) receiver++;
+          if (donor==Num_procs || receiver==Num_procs) break;
+          amount = MIN(lb_counts[donor]-target, target-lb_counts[receiver]);
+          lb_counts[donor]    -= amount;
+          lb_counts[receiver] += amount;
+          moved += amount;
+          if (donor    == my_ID) lb_to_send[receiver] += amount;
+          if (receiver == my_ID) lb_to_recv[donor]    += amount;
+        }
+
+        for (send_total=recv_total=0,rank=0; rank<Num_procs; rank++) {
+          send_total += lb_to_send[rank];
+          recv_total += lb_to_recv[rank];
+        }
+        resize_buffer(&lb_sendbuf, &lb_sendbuf_size, send_total);
+        resize_buffer(&lb_recvbuf, &lb_recvbuf_size, recv_total);
+
+        /* stage outgoing particles, giving away hosted particles first */
+        for (staged=0; staged<send_total; staged++) {
+          if (hosted_count > 0) lb_sendbuf[staged] = hosted[--hosted_count];
+          else                  lb_sendbuf[staged] = particles[--particles_count];
+        }
+
+        nreq = 0;
+        for (offset=0,rank=0; rank<Num_procs; rank++) if (lb_to_send[rank]) {
+          MPI_Isend(lb_sendbuf+offset, lb_to_send[rank], PARTICLE, rank, 1,
+                    MPI_COMM_WORLD, &lb_requests[nreq++]);
+          offset += lb_to_send[rank];
+        }
+        for (offset=0,rank=0; rank<Num_procs; rank++) if (lb_to_recv[rank]) {
+          MPI_Irecv(lb_recvbuf+offset, lb_to_recv[rank], PARTICLE, rank, 1,
+                    MPI_COMM_WORLD, &lb_requests[nreq++]);
+          offset += lb_to_recv[rank];
+        }
+        MPI_Waitall(nreq, lb_requests, MPI_STATUSES_IGNORE);
+        attach_particles(&hosted, &hosted_count, &hosted_size, lb_recvbuf, recv_total);
+      }
+
+      for (max_count=0.0,rank=0; rank<Num_procs; rank++)
+        max_count = MAX(max_count, (double) lb_counts[rank]);
+      imb_after = max_count*Num_procs/total_count;
+
+      lb_time = wtime() - lb_time;
+      MPI_Reduce(&lb_time, &max_lb_time, 1, MPI_DOUBLE, MPI_MAX, root,
+                 MPI_COMM_WORLD);
+      if (my_ID == root) {
+        lb_events[lb_num_events] = (lb_event_t)
+          {iter, moved, imb_before, imb_after, max_lb_time};
+        lb_num_events++;
+      }
+    }
+
     ptr_my = 0;
     for (i=0; i<8; i++) to_send[i]=0;
 
@@ -1003,6 +1235,23 @@ int main(int argc, char ** argv) {
       }
     }
 
+    /* Process hosted particles; they are pushed with charges computed from
+       the dipole pattern and never change hands in the neighbor exchange */
+    for (i=0; i < hosted_count; i++) {
+      fx = 0.0;
+      fy = 0.0;
+      computeTotalForceGlobal(hosted[i], &fx, &fy);
+
+      ax = fx * MASS_INV;
+      ay = fy * MASS_INV;
+
+      hosted[i].x = fmod(hosted[i].x + hosted[i].v_x*DT + 0.5*ax*DT*DT + L, L);
+      hosted[i].y = fmod(hosted[i].y + hosted[i].v_y*DT + 0.5*ay*DT*DT + L, L);
+
+      hosted[i].v_x += ax * DT;
+      hosted[i].v_y += ay * DT;
+    }
+
     /* Communicate the number of particles to be sent/received */
     for (i=0; i<8; i++) {
       MPI_Isend(&to_send[i], 1, MPI_UINT64_T, nbr[i], 0, MPI_COMM_WORLD, &requests[i]);
@@ -1040,6 +1289,11 @@ int main(int argc, char ** argv) {
     correctness += verifyParticle(particles[i], (double)L, iterations);
     my_checksum += (uint64_t)particles[i].ID;
   }
+  /* Then verify particles hosted on behalf of other ranks */
+  for (i=0; i < hosted_count; i++) {
+    correctness += verifyParticle(hosted[i], (double)L, iterations);
+    my_checksum += (uint64_t)hosted[i].ID;
+  }
 
   /* Gather total checksum of particles */
   MPI_Reduce(&my_checksum, &tot_checksum, 1, MPI_UINT64_T, MPI_SUM, root, MPI_COMM_WORLD);
@@ -1062,6 +1316,21 @@ int main(int argc, char ** argv) {
     }
   }
 
+  /* Report the load balancing metrics collected during the timed loop */
+  if (my_ID == root && lb_period) {
+    uint64_t total_moved = 0;
+    double   total_lb_time = 0.0;
+    for (i=0; i<lb_num_events; i++) {
+      printf("Rebalance at iteration %llu: imbalance %.2lf -> %.2lf, moved %llu particles, time (s): %lf\n",
+             lb_events[i].iteration, lb_events[i].imb_before, lb_events[i].imb_after,
+             lb_events[i].moved, lb_events[i].time);
+      total_moved   += lb_events[i].moved;
+      total_lb_time += lb_events[i].time;
+    }
+    printf("Total particles redistributed      = %llu\n", total_moved);
+    printf("Total redistribution time (s):       %lf\n", total_lb_time);
+  }
+
 #if VERBOSE
   for (i=0; i<Num_procs; i++) {
     MPI_Barrier(MPI_COMM_WORLD);
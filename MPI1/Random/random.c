@@ -78,7 +78,21 @@ USAGE:   The program takes as input the 2log of the size of the table that
          The code can be vectorized, in principle, with a vector length
          that is automatically set to the size of the LOOKAHEAD parameter.
 
-         <progname> <log2 tablesize> <#update ratio> 
+         <progname> <#update ratio> <log2 tablesize> [bucket size [error percent]]
+
+         The optional bucket size sets the aggregation depth: the number
+         of updates each rank generates before flushing the buckets with
+         a nonblocking all-to-all, overlapping the flush with generation
+         of the next batch. It must be a power of two no smaller than
+         LOOKAHEAD; a value of zero sweeps all valid depths and reports
+         the update rate for each. The default equals LOOKAHEAD, which
+         reproduces the historical flush granularity.
+
+         The optional error percent relaxes the verification test in the
+         style of HPC Challenge: the run passes if the fraction of
+         incorrect table elements does not exceed the given percentage
+         of the aggregate table size, and the number of errors is always
+         reported. The default of zero demands a perfect table.
 
 FUNCTIONS CALLED:
 
@@ -157,6 +171,29 @@ HISTORY: Written by Rob Van der Wijngaart, December 2007.
 static u64Int PRK_starts(s64Int);
 static int    poweroftwo(int);
 
+/* generate agg*nstarts new random numbers and drop each into the send bucket
+   of the rank that owns the corresponding table element                           */
+static void generate_batch(int agg, int nstarts, u64Int *ran, s64Int tablesize,
+                           int log2tablesize, int log2nproc, int Num_procs,
+                           u64Int **ranSendBucket, int *sizeSendBucket) {
+  int    a, j, proc, dest;
+  s64Int global_index;
+
+  for (proc=0; proc<Num_procs; proc++) sizeSendBucket[proc] = 0;
+  for (a=0; a<agg; a++) {
+    for (j=0; j<nstarts; j++) {
+      /* compute new random number                                                 */
+      ran[j] = (ran[j] << 1) ^ ((s64Int)ran[j] < 0? POLY: 0);
+      global_index = (ran[j] & (tablesize-1));
+      /* determine destination rank (high order bits of global table index)        */
+      dest = global_index>>(log2tablesize-log2nproc);
+      /* place new random number in first available element of the appropriate 
+         send bucket and increment that bucket size                                */
+      ranSendBucket[dest][sizeSendBucket[dest]++] = ran[j];
+    }
+  }
+}
+
 int main(int argc, char **argv) {
 
   int               update_ratio;/* multiplier of tablesize for # updates          */
@@ -168,15 +205,27 @@ int main(int argc, char **argv) {
   s64Int            nupdate;     /* number of updates per rank                     */
   s64Int            tablespace;  /* bytes per rank required for table              */
   u64Int            *ran;        /* vector of random numbers                       */
-  u64Int            **ranSendBucket; /* send list of buckets of random numbers     */
+  u64Int            **ranSendBucket[2]; /* double-buffered send bucket lists       */
   u64Int            **ranRecvBucket; /* receive list of buckets of random numbers  */
-  int               *sizeSendBucket; /* list of send bucket sizes                  */
+  int               *sizeSendBucket[2]; /* send bucket sizes, one set per buffer   */
   int               *sizeRecvBucket; /* list of receive buffer sizes               */
   int               sizeRecvTotal;/* total number of elements in receive buffer    */
   int               *senddispls; /* successive displacements in send buffer        */
   int               *recvdispls; /* successive dispalcemetns in receive buffer     */
+  int               bucket_size; /* aggregation depth: updates per flush           */
+  int               sweep=0;     /* boolean: sweep all valid aggregation depths    */
+  int               error_percent=0; /* percentage of table errors tolerated       */
+  int               agg;         /* number of LOOKAHEAD vectors per flush          */
+  int               num_depths;  /* number of aggregation depths to run            */
+  int               point;       /* index into list of aggregation depths          */
+  int               cur;         /* index of send buffer being filled              */
+  s64Int            depths[64];  /* list of aggregation depths                     */
+  s64Int            max_bucket;  /* largest aggregation depth to be run            */
+  s64Int            batch, num_batches; /* flush counters                          */
+  double            depth_time[64]; /* timing per aggregation depth               */
+  MPI_Request       flush_req;   /* request for nonblocking bucket flush           */
   u64Int * RESTRICT Table;       /* (pseudo-)randomly accessed array               */
-  double            random_time; /* timing parameters                              */
+  double            random_time=0.0; /* timing parameters                          */
   int               Num_procs,   /* rank parameters                                */
                     my_ID,       /* rank of calling rank                           */
                     root=0;      /* ID of master rank                              */
@@ -207,8 +256,9 @@ int main(int argc, char **argv) {
     printf("Parallel Research Kernels version %s\n", PRKVERSION);
     printf("MPI Random Access\n");
 
-    if (argc != 3){
-      printf("Usage: %s <#update ratio> <log2 tablesize>\n", *argv);
+    if (argc < 3 || argc > 5){
+      printf("Usage: %s <#update ratio> <log2 tablesize> [bucket size [error percent]]\n",
+             *argv);
       error = 1;
       goto ENDOFTESTS;
     }
@@ -305,6 +355,39 @@ int main(int argc, char **argv) {
     printf("Number of updates (aggregate) = "FSTR64U"\n", nupdate*Num_procs);
     printf("Vector (LOOKAHEAD) length     = "FSTR64U"\n", (u64Int) nstarts);
 
+    /* optionally override the aggregation depth (number of updates generated
+       between bucket flushes); zero means sweep all valid depths                  */
+    bucket_size = nstarts;
+    if (argc > 3) {
+      bucket_size = atoi(*++argv);
+      if (bucket_size == 0) sweep = 1;
+      else {
+        if (poweroftwo(bucket_size) < 0 || bucket_size < nstarts ||
+            (s64Int)bucket_size*2 > nupdate) {
+          printf("ERROR: Invalid bucket size: %d, must be a power of 2 between ",
+                 bucket_size);
+          printf("LOOKAHEAD (%d) and half the number of updates per rank\n", nstarts);
+          error = 1;
+          goto ENDOFTESTS;
+        }
+      }
+    }
+    if (sweep) printf("Aggregation depth             = sweep\n");
+    else       printf("Aggregation depth             = %d\n", bucket_size);
+
+    /* optionally tolerate a bounded fraction of incorrect table elements,
+       as in HPC Challenge; zero (the default) demands a perfect table          */
+    if (argc > 4) {
+      error_percent = atoi(*++argv);
+      if (error_percent < 0 || error_percent > 100) {
+        printf("ERROR: Invalid error percent: %d, must be between 0 and 100\n",
+               error_percent);
+        error = 1;
+        goto ENDOFTESTS;
+      }
+    }
+    printf("Percent errors allowed        = %d\n", error_percent);
+
     ENDOFTESTS:;
   }
   bail_out(error);
@@ -320,6 +403,22 @@ int main(int argc, char **argv) {
   MPI_Bcast(&loctablesize,     1, MPI_LONG_LONG_INT, root, MPI_COMM_WORLD);
   MPI_Bcast(&tablespace,       1, MPI_LONG_LONG_INT, root, MPI_COMM_WORLD);
   MPI_Bcast(&nupdate,          1, MPI_LONG_LONG_INT, root, MPI_COMM_WORLD);
+  MPI_Bcast(&bucket_size,      1, MPI_INT,           root, MPI_COMM_WORLD);
+  MPI_Bcast(&sweep,            1, MPI_INT,           root, MPI_COMM_WORLD);
+  MPI_Bcast(&error_percent,    1, MPI_INT,           root, MPI_COMM_WORLD);
+
+  /* determine the list of aggregation depths to run; every depth leaves the
+     table in its initial state, so multiple depths can share one run             */
+  if (sweep) {
+    num_depths = 0;
+    for (s64Int d=nstarts; d*2<=nupdate && d<=((s64Int)1<<20); d*=2)
+      depths[num_depths++] = d;
+  }
+  else {
+    num_depths = 1;
+    depths[0]  = bucket_size;
+  }
+  max_bucket = depths[num_depths-1];
 
   ran = (u64Int *) prk_malloc(nstarts*sizeof(u64Int));
   if (!ran) {
@@ -337,100 +436,113 @@ int main(int argc, char **argv) {
   }
   bail_out(error);
 
-  /* allocate send and receive buckets                                             */
-  ranSendBucket = (u64Int **) prk_malloc((Num_procs+1)*sizeof(u64Int *));
-  if (!ranSendBucket) {
+  /* allocate send and receive buckets; send buckets are double buffered so
+     that the next batch can be generated while the previous flush is in flight    */
+  ranSendBucket[0] = (u64Int **) prk_malloc(3*Num_procs*sizeof(u64Int *));
+  if (!ranSendBucket[0]) {
     printf("ERROR: rank %d Could not allocate bucket pointers\n", my_ID);
     error = 1;
   }
   bail_out(error);
-  ranRecvBucket = ranSendBucket + Num_procs;
+  ranSendBucket[1] = ranSendBucket[0] + Num_procs;
+  ranRecvBucket    = ranSendBucket[0] + 2*Num_procs;
 
-  ranSendBucket[0] = (u64Int *) prk_malloc(2*Num_procs*nstarts*sizeof(u64Int));
-  if (!ranSendBucket[0]) {
+  ranSendBucket[0][0] = (u64Int *) prk_malloc(3*Num_procs*max_bucket*sizeof(u64Int));
+  if (!ranSendBucket[0][0]) {
     printf("ERROR: rank %d Could not allocate bucket space\n", my_ID);
     error = 1;
   }
   bail_out(error);
 
-  for (proc=1; proc<Num_procs; proc++) 
-    ranSendBucket[proc] = ranSendBucket[0] + proc*nstarts;
+  /* buckets are laid out with the largest capacity, so smaller aggregation
+     depths can reuse the same buffers and displacements                           */
+  for (proc=0; proc<Num_procs; proc++) {
+    ranSendBucket[0][proc] = ranSendBucket[0][0] + proc*max_bucket;
+    ranSendBucket[1][proc] = ranSendBucket[0][0] + (Num_procs+proc)*max_bucket;
+  }
   /* we only need one (large) receive bucket                                       */
-  ranRecvBucket[0] = ranSendBucket[0] + Num_procs*nstarts;
+  ranRecvBucket[0] = ranSendBucket[0][0] + 2*Num_procs*max_bucket;
 
   /* allocate send and receive bucket sizes plus buffer offsets                    */
-  sizeSendBucket = (int *) prk_malloc(4*Num_procs*sizeof(int));
-  if (!sizeSendBucket) {
+  sizeSendBucket[0] = (int *) prk_malloc(5*Num_procs*sizeof(int));
+  if (!sizeSendBucket[0]) {
     printf("ERROR: rank %d Could not allocate bucket sizes\n", my_ID);
     error = 1;
   }
   bail_out(error);
 
-  sizeRecvBucket = sizeSendBucket + Num_procs;
-  senddispls     = sizeRecvBucket + Num_procs;
-  recvdispls     = senddispls     + Num_procs;
+  sizeSendBucket[1] = sizeSendBucket[0] + Num_procs;
+  sizeRecvBucket    = sizeSendBucket[0] + 2*Num_procs;
+  senddispls        = sizeSendBucket[0] + 3*Num_procs;
+  recvdispls        = sizeSendBucket[0] + 4*Num_procs;
 
   /* send displacements are regular, they can be calculated in advance             */
-  for (proc=0; proc<Num_procs; proc++) senddispls[proc] = nstarts*proc;
+  for (proc=0; proc<Num_procs; proc++) senddispls[proc] = max_bucket*proc;
   /* only the first receive displacement is always the same                        */
   recvdispls[0] = 0;
 
   /* initialize the table */
   for(i=0;i<loctablesize;i++) Table[i] = (u64Int) (i+ loctablesize*my_ID);
 
-  MPI_Barrier(MPI_COMM_WORLD);
-  if (my_ID == root) {
-    random_time = wtime();
-  }
-
-  /* do two identical rounds of Random Access to ensure we recover initial table   */
-  for (round=0; round <2; round++) {
-    /* compute seeds for independent streams, using jump-ahead feature             */
-    for (j=0; j<nstarts; j++) {
-      ran[j] = PRK_starts(SEQSEED+(nupdate/nstarts)*j+loctablesize*my_ID);
-    }
+  for (point=0; point<num_depths; point++) {
 
-    /* because we do two rounds, we divide nupdate in two                          */
-    for (i=0; i<nupdate/(nstarts*2); i++) {
+    agg         = depths[point]/nstarts;
+    num_batches = nupdate/(2*depths[point]);
 
-      /* reset actual send bucket sizes                                            */
-      for (proc=0; proc<Num_procs; proc++) sizeSendBucket[proc] = 0;
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (my_ID == root) {
+      random_time = wtime();
+    }
 
+    /* do two identical rounds of Random Access to ensure we recover initial table */
+    for (round=0; round <2; round++) {
+      /* compute seeds for independent streams, using jump-ahead feature           */
       for (j=0; j<nstarts; j++) {
-        /* compute new random number                                               */
-        ran[j] = (ran[j] << 1) ^ ((s64Int)ran[j] < 0? POLY: 0);
-        global_index = (ran[j] & (tablesize-1));
-        /* determine destination rank (high order bits of global table index)      */
-        dest = global_index>>(log2tablesize-log2nproc);
-        /* place new random number in first available element of the appropriate 
-           send bucket and increment that bucket size                              */
-        ranSendBucket[dest][sizeSendBucket[dest]++] = ran[j];
+        ran[j] = PRK_starts(SEQSEED+(nupdate/nstarts)*j+loctablesize*my_ID);
       }
 
-      /* let all other rankes know how many indices to expect                      */
-      MPI_Alltoall(sizeSendBucket, 1, MPI_INT,
-                   sizeRecvBucket, 1, MPI_INT, MPI_COMM_WORLD);
-
-      /* compute receive buffer offsets so that received data is contiguous        */
-      for (proc=1; proc<Num_procs; proc++) 
-        recvdispls[proc] = recvdispls[proc-1]+sizeRecvBucket[proc-1];
-
-      /* scatter the send bucket contents                                          */
-      MPI_Alltoallv(ranSendBucket[0], sizeSendBucket, senddispls, MPI_LONG_LONG_INT,
-                    ranRecvBucket[0], sizeRecvBucket, recvdispls, MPI_LONG_LONG_INT,
-                    MPI_COMM_WORLD);
-
-      /* do the actual table updates. Because the receive buckets are contiguous, 
-         we can view them as a single large bucket.                                */
-      sizeRecvTotal = recvdispls[Num_procs-1]+sizeRecvBucket[Num_procs-1];
-      for (j=0; j<sizeRecvTotal; j++) {
-        index = ranRecvBucket[0][j] & (loctablesize-1);
-        Table[index] ^= ranRecvBucket[0][j];
+      /* fill the first send buffer, then flush each batch with a nonblocking
+         all-to-all while the next batch is being generated                        */
+      cur = 0;
+      generate_batch(agg, nstarts, ran, tablesize, log2tablesize, log2nproc,
+                     Num_procs, ranSendBucket[cur], sizeSendBucket[cur]);
+
+      for (batch=0; batch<num_batches; batch++) {
+
+        /* let all other rankes know how many indices to expect                    */
+        MPI_Alltoall(sizeSendBucket[cur], 1, MPI_INT,
+                     sizeRecvBucket, 1, MPI_INT, MPI_COMM_WORLD);
+
+        /* compute receive buffer offsets so that received data is contiguous      */
+        for (proc=1; proc<Num_procs; proc++) 
+          recvdispls[proc] = recvdispls[proc-1]+sizeRecvBucket[proc-1];
+
+        /* scatter the send bucket contents                                        */
+        MPI_Ialltoallv(ranSendBucket[cur][0], sizeSendBucket[cur], senddispls,
+                       MPI_LONG_LONG_INT,
+                       ranRecvBucket[0], sizeRecvBucket, recvdispls,
+                       MPI_LONG_LONG_INT, MPI_COMM_WORLD, &flush_req);
+
+        /* overlap the flush with generation of the next batch                     */
+        if (batch+1 < num_batches) {
+          generate_batch(agg, nstarts, ran, tablesize, log2tablesize, log2nproc,
+                         Num_procs, ranSendBucket[1-cur], sizeSendBucket[1-cur]);
+        }
+        MPI_Wait(&flush_req, MPI_STATUS_IGNORE);
+
+        /* do the actual table updates. Because the receive buckets are contiguous, 
+           we can view them as a single large bucket.                              */
+        sizeRecvTotal = recvdispls[Num_procs-1]+sizeRecvBucket[Num_procs-1];
+        for (j=0; j<sizeRecvTotal; j++) {
+          index = ranRecvBucket[0][j] & (loctablesize-1);
+          Table[index] ^= ranRecvBucket[0][j];
+        }
+        cur = 1-cur;
       }
     }
-  }
 
-  if (my_ID == root) random_time = wtime() - random_time;
+    if (my_ID == root) depth_time[point] = wtime() - random_time;
+  }
 
   /* verification test */
   for(i=0;i<loctablesize;i++) {
@@ -449,10 +561,22 @@ int main(int argc, char **argv) {
 
   MPI_Reduce(&error, &tot_error, 1, MPI_LONG_LONG_INT, MPI_SUM, root, MPI_COMM_WORLD);
   if (my_ID==root) {
-    if (!tot_error) {
-      printf("Solution validates\n");
-      printf("Rate (GUPS/s): %lf, Time (s): %lf\n", 
-             1.e-9*(nupdate*Num_procs)/random_time, random_time);
+    if ((tot_error == 0 && error_percent == 0) ||
+        (error_percent > 0 &&
+         (double)tot_error/(double)tablesize <= (double)error_percent*0.01)) {
+      printf("Solution validates, number of errors: "FSTR64U"\n", tot_error);
+      if (num_depths == 1) {
+        printf("Rate (GUPS/s): %lf, Time (s): %lf\n", 
+               1.e-9*(nupdate*Num_procs)/depth_time[0], depth_time[0]);
+      }
+      else {
+        printf("Aggregation sweep:\n");
+        printf("%12s %16s %12s\n", "Bucket size", "Rate (GUPS/s)", "Time (s)");
+        for (point=0; point<num_depths; point++) {
+          printf("%12lld %16lf %12lf\n", (long long) depths[point],
+                 1.e-9*(nupdate*Num_procs)/depth_time[point], depth_time[point]);
+        }
+      }
     }
     else {
       printf("Total number of incorrect table elements: "FSTR64U"\n", tot_error);
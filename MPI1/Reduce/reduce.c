@@ -48,6 +48,14 @@ USAGE:   The program takes as input the length of the vectors, plus the
          The output consists of diagnostics to make sure the 
          algorithm worked, and of timing statistics.
 
+         Setting PRK_HIERARCHICAL=1 replaces the flat MPI_Reduce with a
+         two-level engine: the ranks of a node reduce their vectors
+         cooperatively over an MPI_Win_allocate_shared segment (each
+         rank owns a disjoint chunk of the vector), then the node
+         leaders reduce the node sums across nodes.  Both phases are
+         timed separately, which bounds how much a node-aware library
+         reduction can still gain over the flat collective.
+
 FUNCTIONS CALLED:
 
          Other than MPI or standard C functions, the following external 
@@ -57,6 +65,7 @@ FUNCTIONS CALLED:
          bail_out();
 
 HISTORY: Written by Rob Van der Wijngaart, March 2006.
+         Hierarchical intra/inter-node engine added, September 2026.
          Modified by Rob Van der Wijngaart, November 2014
          - added dependence between successive reductions
          - improved timing
@@ -66,6 +75,7 @@ HISTORY: Written by Rob Van der Wijngaart, March 2006.
 
 #include <par-res-kern_general.h>
 #include <par-res-kern_mpi.h>
+#include <prk_skew.h>
 
 int main(int argc, char ** argv)
 {
@@ -83,6 +93,20 @@ int main(int argc, char ** argv)
   double epsilon=1.e-8; /* error tolerance                                   */
   double element_value; /* verification value                                */
   int    error = 0;     /* error flag                                        */
+  double local_skew=0.0,/* injected delay and collective time on this rank   */
+         local_coll=0.0,
+         coll_start,
+         skew_avg, skew_max, coll_min, coll_avg, coll_max;
+  int    hierarchical=0;/* two-level reduction over node-shared memory       */
+  MPI_Comm node_comm,   /* ranks sharing this node                           */
+           leader_comm; /* one rank per node                                 */
+  MPI_Win  shm_win;     /* node-shared window holding the vectors            */
+  int      node_rank, node_size;
+  double **segment;     /* base of each node rank's vector in the window     */
+  double  *node_sum;    /* the node's accumulation buffer (on the leader)    */
+  long     chunk_lo, chunk_hi; /* this rank's share of the node reduction    */
+  double   phase_start, local_intra=0.0, local_inter=0.0,
+           intra_avg, intra_max, inter_avg, inter_max;
 
   /***************************************************************************
   ** Initialize the MPI environment
@@ -90,6 +114,7 @@ int main(int argc, char ** argv)
   MPI_Init(&argc,&argv);
   MPI_Comm_rank(MPI_COMM_WORLD, &my_ID);
   MPI_Comm_size(MPI_COMM_WORLD, &Num_procs);
+  prk_skew_init(my_ID);
 
   /***************************************************************************
   ** process, test and broadcast input parameters
@@ -119,6 +144,11 @@ int main(int argc, char ** argv)
       goto ENDOFTESTS;
     }
 
+    {
+      char *envp = getenv("PRK_HIERARCHICAL");
+      if (envp != NULL && atoi(envp) != 0) hierarchical = 1;
+    }
+
     ENDOFTESTS:;
   }
   bail_out(error);
@@ -127,19 +157,57 @@ int main(int argc, char ** argv)
   if (my_ID == root) {
     printf("Number of ranks      = %d\n", Num_procs);
     printf("Vector length        = %ld\n", vector_length);
-    printf("Number of iterations = %d\n", iterations);     
+    printf("Number of iterations = %d\n", iterations);
+    if (hierarchical)
+      printf("Reduction algorithm  = hierarchical (shared-memory node phase + leader exchange)\n");
+    if (prk_skew_active())
+      printf("Skew injection       = %s, scale %d us\n",
+             prk_skew_name(), prk_skew_scale());
   }
 
   /* Broadcast benchmark data to all ranks */
   MPI_Bcast(&iterations,    1, MPI_INT, root, MPI_COMM_WORLD);
   MPI_Bcast(&vector_length, 1, MPI_LONG, root, MPI_COMM_WORLD);
-  vector= (double *) prk_malloc(2*vector_length*sizeof(double)); 
-  if (vector==NULL) {
-    printf("ERROR: Could not allocate space %ld for vector in rank %d\n", 
-           2*vector_length*sizeof(double),my_ID);
-    error = 1;
+  MPI_Bcast(&hierarchical,  1, MPI_INT, root, MPI_COMM_WORLD);
+
+  if (hierarchical) {
+    /* the working vectors live in one shared region per node; the leader
+       allocates one extra vector that collects the node sum              */
+    MPI_Aint segsize;
+    int      r, disp_unit;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, my_ID,
+                        MPI_INFO_NULL, &node_comm);
+    MPI_Comm_rank(node_comm, &node_rank);
+    MPI_Comm_size(node_comm, &node_size);
+    MPI_Comm_split(MPI_COMM_WORLD, node_rank==0 ? 0 : MPI_UNDEFINED, my_ID,
+                   &leader_comm);
+    segsize = (node_rank==0 ? 3 : 2)*vector_length*sizeof(double);
+    MPI_Win_allocate_shared(segsize, sizeof(double), MPI_INFO_NULL,
+                            node_comm, &vector, &shm_win);
+    segment = (double **) prk_malloc(node_size*sizeof(double *));
+    if (vector==NULL || segment==NULL) {
+      printf("ERROR: Could not allocate shared space %ld for vector in rank %d\n",
+             (long)segsize, my_ID);
+      error = 1;
+    }
+    bail_out(error);
+    for (r=0; r<node_size; r++) {
+      MPI_Win_shared_query(shm_win, r, &segsize, &disp_unit, &segment[r]);
+    }
+    node_sum = segment[0] + 2*vector_length;
+    /* disjoint chunks of the vector, one per node rank                   */
+    chunk_lo = ( node_rank   *vector_length)/node_size;
+    chunk_hi = ((node_rank+1)*vector_length)/node_size;
+  }
+  else {
+    vector= (double *) prk_malloc(2*vector_length*sizeof(double)); 
+    if (vector==NULL) {
+      printf("ERROR: Could not allocate space %ld for vector in rank %d\n", 
+             2*vector_length*sizeof(double),my_ID);
+      error = 1;
+    }
+    bail_out(error);
   }
-  bail_out(error);
   ones = vector + vector_length;
 
   /* initialize the arrays                                                    */
@@ -161,14 +229,55 @@ int main(int argc, char ** argv)
       vector[i] += ones[i];
     }
 
+    /* inject the straggler delay just before the collective, and time the
+       collective itself, so the extra wait it absorbs can be reported       */
+    if (prk_skew_active()) {
+      double delay = prk_skew_inject();
+      if (iter >= 1) local_skew += delay;
+      coll_start = wtime();
+    }
+
     /* now do the "non-local" part                                              */
-    if (my_ID == root)
-      MPI_Reduce(MPI_IN_PLACE, vector, vector_length, MPI_DOUBLE, MPI_SUM, 
+    if (hierarchical) {
+      int  r;
+      long j;
+      /* node phase: after all working vectors are in place, every rank
+         sums its chunk across the node's segments into the node sum      */
+      phase_start = wtime();
+      MPI_Barrier(node_comm);
+      for (j=chunk_lo; j<chunk_hi; j++) {
+        double temp = segment[0][j];
+        for (r=1; r<node_size; r++) temp += segment[r][j];
+        node_sum[j] = temp;
+      }
+      MPI_Barrier(node_comm);
+      if (iter >= 1) local_intra += wtime() - phase_start;
+      /* inter-node phase: the leaders reduce the node sums; the world
+         root is the lowest leader, so the result lands on its node       */
+      if (node_rank == 0) {
+        phase_start = wtime();
+        if (my_ID == root)
+          MPI_Reduce(MPI_IN_PLACE, node_sum, vector_length, MPI_DOUBLE,
+                     MPI_SUM, 0, leader_comm);
+        else
+          MPI_Reduce(node_sum, NULL, vector_length, MPI_DOUBLE,
+                     MPI_SUM, 0, leader_comm);
+        if (iter >= 1) local_inter += wtime() - phase_start;
+        /* as in the flat version, only the root's working vector takes
+           the global result                                              */
+        if (my_ID == root)
+          for (j=0; j<vector_length; j++) vector[j] = node_sum[j];
+      }
+    }
+    else if (my_ID == root)
+      MPI_Reduce(MPI_IN_PLACE, vector, vector_length, MPI_DOUBLE, MPI_SUM,
                  root, MPI_COMM_WORLD);
     else
-      MPI_Reduce(vector, NULL, vector_length, MPI_DOUBLE, MPI_SUM, 
+      MPI_Reduce(vector, NULL, vector_length, MPI_DOUBLE, MPI_SUM,
                  root, MPI_COMM_WORLD);
 
+    if (prk_skew_active() && iter >= 1) local_coll += wtime() - coll_start;
+
   } /* end of iterations */
 
   local_reduce_time = wtime() - local_reduce_time;
@@ -206,6 +315,50 @@ int main(int argc, char ** argv)
            1.0E-06 * (2.0*Num_procs-1.0)*vector_length/ avgtime, avgtime);
   }
 
+  /* the two phases bound what a node-aware library reduction still buys:
+     a flat collective pays both, a perfect hierarchy hides the smaller   */
+  if (hierarchical) {
+    int num_nodes=0;
+    MPI_Reduce(&local_intra, &intra_avg, 1, MPI_DOUBLE, MPI_SUM, root, MPI_COMM_WORLD);
+    MPI_Reduce(&local_intra, &intra_max, 1, MPI_DOUBLE, MPI_MAX, root, MPI_COMM_WORLD);
+    if (node_rank == 0) {
+      MPI_Reduce(&local_inter, &inter_avg, 1, MPI_DOUBLE, MPI_SUM, 0, leader_comm);
+      MPI_Reduce(&local_inter, &inter_max, 1, MPI_DOUBLE, MPI_MAX, 0, leader_comm);
+      MPI_Comm_size(leader_comm, &num_nodes);
+    }
+    if (my_ID == root) {
+      intra_avg /= Num_procs*(double)iterations; intra_max /= (double)iterations;
+      inter_avg /= num_nodes*(double)iterations; inter_max /= (double)iterations;
+      printf("Number of nodes      = %d\n", num_nodes);
+      printf("Intra-node phase (s/iter): avg %lf, max %lf\n", intra_avg, intra_max);
+      printf("Inter-node phase (s/iter): avg %lf, max %lf\n", inter_avg, inter_max);
+    }
+    prk_free(segment);
+    if (node_rank == 0) MPI_Comm_free(&leader_comm);
+    MPI_Win_free(&shm_win);
+    MPI_Comm_free(&node_comm);
+  }
+
+  /* report how much of the injected imbalance the collective absorbed; the
+     least-delayed rank waits longest in the collective, so the spread of the
+     per-rank collective times above their minimum is the absorbed skew       */
+  if (prk_skew_active()) {
+    MPI_Reduce(&local_skew, &skew_avg, 1, MPI_DOUBLE, MPI_SUM, root, MPI_COMM_WORLD);
+    MPI_Reduce(&local_skew, &skew_max, 1, MPI_DOUBLE, MPI_MAX, root, MPI_COMM_WORLD);
+    MPI_Reduce(&local_coll, &coll_avg, 1, MPI_DOUBLE, MPI_SUM, root, MPI_COMM_WORLD);
+    MPI_Reduce(&local_coll, &coll_min, 1, MPI_DOUBLE, MPI_MIN, root, MPI_COMM_WORLD);
+    MPI_Reduce(&local_coll, &coll_max, 1, MPI_DOUBLE, MPI_MAX, root, MPI_COMM_WORLD);
+    if (my_ID == root) {
+      skew_avg /= Num_procs*(double)iterations; skew_max /= (double)iterations;
+      coll_avg /= Num_procs*(double)iterations;
+      coll_min /= (double)iterations;           coll_max /= (double)iterations;
+      printf("Injected skew (s/iter): avg %lf, max %lf\n", skew_avg, skew_max);
+      printf("Collective (s/iter): min %lf, avg %lf, max %lf\n",
+             coll_min, coll_avg, coll_max);
+      printf("Skew absorption time (s/iter): %lf\n", coll_avg-coll_min);
+    }
+  }
+
   MPI_Finalize();
   exit(EXIT_SUCCESS);
 
@@ -43,6 +43,22 @@ USAGE:   The program takes as input the 2log of the linear size of the 2D grid
          matrix-vector multiplication is carried out.
 
          <progname> <# iterations> <2log root-of-matrix-order> <radius>
+                    [<value bits> <index bits>] [<snapshot file>]
+
+         The optional value and index widths may each be 32 or 64 bits
+         (default 64); all four combinations are instantiated at compile
+         time and selected at run time, and the matrix bytes moved per
+         nonzero are reported so the bandwidth effect of narrower storage
+         formats can be measured with the same code. 32-bit indices
+         require the matrix order to fit in a signed 32-bit integer.
+
+         If a snapshot file is given, the generated matrix (values plus
+         column indices) is saved to it in a versioned binary format on
+         first use, and mapped directly from it on subsequent runs with
+         matching parameters, so that parameter sweeps over communication
+         options do not pay the (scrambled) matrix generation cost each
+         time. A snapshot whose header does not match the current
+         parameters is regenerated and overwritten.
 
          The output consists of diagnostics to make sure the
          algorithm worked, and of timing statistics.
@@ -64,12 +80,20 @@ HISTORY: Written by Rob Van der Wijngaart, October 2006.
          Updated by RvdW to fix verification bug, February 2013
          Updated by RvdW to sort matrix elements to reflect traditional CSR storage,
          August 2013
+         - Added versioned matrix snapshot file (write once, mmap on reuse)
+         - Split the SpMV into local and remote phases; the local phase is
+           overlapped with a nonblocking gather of the remote vector entries
 
 ***********************************************************************************/
 
 #include <par-res-kern_general.h>
 #include <par-res-kern_mpi.h>
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
 /* linearize the grid index                                                       */
 #define LIN(i,j) (i+((j)<<lsize))
 
@@ -87,9 +111,79 @@ HISTORY: Written by Rob Van der Wijngaart, October 2006.
 
 #define BITS_IN_BYTE 8
 
+/* matrix snapshot file: layout version (bump when the format changes) and modes  */
+#define SNAP_MAGIC       "PRKSPMV"
+#define SNAP_VERSION     2
+#define snap_none        0
+#define snap_write       1
+#define snap_map         2
+/* data starts at a page boundary so the mapped arrays are well aligned           */
+#define SNAP_DATA_OFFSET 4096
+
+typedef struct {
+  char   magic[8];     /* identifies the file as a PRK sparse matrix snapshot     */
+  int    version;      /* layout version                                          */
+  int    lsize;        /* parameters the matrix was generated with                */
+  int    radius;
+  int    scramble;
+  int    value_bits;   /* storage widths the matrix was generated with            */
+  int    index_bits;
+} snap_header_t;
+
 static u64Int reverse(register u64Int, int);
 static int compare(const void *el1, const void *el2);
 
+/* one SpMV instantiation per (value type, index type) combination; the hot
+   loop must see the narrow types for the compiler to exploit them. Each call
+   processes the per-row entry subrange [lo[row],hi[row]), so the same code
+   serves the local phase (offset maps owned columns into the local slice)
+   and the remote prefix/suffix phases (offset zero, full gathered vector)   */
+#define DEFINE_SPMV(FNAME, VTYPE, ITYPE)                          \
+static void FNAME(int nrows, int stencil_size,                    \
+                  const int * RESTRICT lo,                        \
+                  const int * RESTRICT hi,                        \
+                  s64Int offset,                                  \
+                  const VTYPE * RESTRICT matrix,                  \
+                  const ITYPE * RESTRICT colIndex,                \
+                  const VTYPE * RESTRICT vector,                  \
+                  VTYPE * RESTRICT result) {                      \
+  s64Int row, col, first, last;                                   \
+  VTYPE temp;                                                     \
+  for (row=0; row<nrows; row++) {                                 \
+    first = stencil_size*row + lo[row];                           \
+    last  = stencil_size*row + hi[row] - 1;                       \
+    for (temp=(VTYPE)0.0,col=first; col<=last; col++) {           \
+      temp += matrix[col]*vector[colIndex[col]-offset];           \
+    }                                                             \
+    result[row] += temp;                                          \
+  }                                                               \
+}
+DEFINE_SPMV(spmv_fp64_i64, double, s64Int)
+DEFINE_SPMV(spmv_fp64_i32, double, int)
+DEFINE_SPMV(spmv_fp32_i64, float,  s64Int)
+DEFINE_SPMV(spmv_fp32_i32, float,  int)
+
+/* select the instantiation matching the run-time storage widths              */
+static void spmv(int value_bits, int index_bits, int nrows, int stencil_size,
+                 const int * RESTRICT lo, const int * RESTRICT hi, s64Int offset,
+                 const void * RESTRICT matrix, const void * RESTRICT colIndex,
+                 const void * RESTRICT vector, void * RESTRICT result) {
+  if (value_bits == 64) {
+    if (index_bits == 64)
+         spmv_fp64_i64(nrows, stencil_size, lo, hi, offset, (const double *)matrix,
+                       (const s64Int *)colIndex, (const double *)vector, (double *)result);
+    else spmv_fp64_i32(nrows, stencil_size, lo, hi, offset, (const double *)matrix,
+                       (const int    *)colIndex, (const double *)vector, (double *)result);
+  }
+  else {
+    if (index_bits == 64)
+         spmv_fp32_i64(nrows, stencil_size, lo, hi, offset, (const float  *)matrix,
+                       (const s64Int *)colIndex, (const float  *)vector, (float  *)result);
+    else spmv_fp32_i32(nrows, stencil_size, lo, hi, offset, (const float  *)matrix,
+                       (const int    *)colIndex, (const float  *)vector, (float  *)result);
+  }
+}
+
 int main(int argc, char **argv){
 
   int               Num_procs;  /* Number of ranks                                */
@@ -116,10 +210,26 @@ int main(int argc, char **argv){
   double            local_sparse_time,/* timing parameters                        */
                     sparse_time,
                     avgtime;
-  double * RESTRICT matrix;     /* sparse matrix entries                          */
-  double * RESTRICT vector;     /* vector multiplying the sparse matrix           */
-  double * RESTRICT result;     /* computed matrix-vector product                 */
-  double            temp;       /* temporary scalar storing reduction data        */
+  void * RESTRICT   matrix;     /* sparse matrix entries                          */
+  void * RESTRICT   vector;     /* vector multiplying the sparse matrix           */
+  void * RESTRICT   result;     /* computed matrix-vector product                 */
+  int               value_bits=64, /* width of matrix/vector values in bits       */
+                    index_bits=64; /* width of column indices in bits             */
+  int               value_bytes, index_bytes; /* same, in bytes                   */
+  MPI_Datatype      mpi_value;  /* MPI datatype matching the value width          */
+  s64Int * RESTRICT tmpcol;     /* scratch row of column indices, always 64 bits  */
+  void * RESTRICT   local_vec;  /* this rank's slice of the multiplying vector    */
+  int * RESTRICT    local_lo,   /* per-row extent of entries with owned columns   */
+       * RESTRICT   local_hi;
+  int * RESTRICT    row_zero,   /* constant per-row extents: 0 and stencil_size   */
+       * RESTRICT   row_full;
+  s64Int            col_start,  /* range of columns owned by this rank            */
+                    col_end;
+  MPI_Request       gather_req; /* outstanding vector gather                      */
+  double            wait_start, /* timing of the un-overlapped part of the gather */
+                    local_exposed_time = 0.0,
+                    exposed_time,
+                    exposed_time_avg;
 #if TESTDENSE
   double * RESTRICT rhs;        /* known matrix-vector product                    */
   double * RESTRICT dense;      /* dense matrix equivalent of "matrix"            */
@@ -128,11 +238,21 @@ int main(int argc, char **argv){
   double            reference_sum, /* local checksum of "rhs"                     */
                     check_sum;  /* aggregate checksum of "rhs"                    */
   double            epsilon = 1.e-8; /* error tolerance                           */
-  s64Int * RESTRICT colIndex;   /* column indices of sparse matrix entries        */
+  void * RESTRICT   colIndex;   /* column indices of sparse matrix entries        */
   int               error=0;    /* error flag                                     */
   size_t            vector_space, /* variables used to hold prk_malloc sizes          */
                     matrix_space,
                     index_space;
+  char              snap_path[256]; /* name of matrix snapshot file               */
+  int               snap_mode=snap_none; /* no snapshot, write one, or map one    */
+  int               snap_fd;    /* snapshot file descriptor                       */
+  size_t            snap_bytes; /* total size of snapshot file                    */
+  void              *snap_base; /* address at which snapshot file is mapped       */
+  off_t             colIndex_off, matrix_off; /* file offsets of the two arrays   */
+  s64Int            first_elm;  /* global index of this rank's first nonzero      */
+  snap_header_t     header;     /* snapshot file header                           */
+  double            local_setup_time, /* time to generate, write, or map matrix   */
+                    setup_time;
 
 /*********************************************************************
 ** Initialize the MPI environment
@@ -149,8 +269,10 @@ int main(int argc, char **argv){
     printf("Parallel Research Kernels version %s\n", PRKVERSION);
     printf("MPI sparse matrix-vector multiplication\n");
 
-    if (argc != 4){
-      printf("Usage: %s <# iterations> <2log grid size> <stencil radius>\n",*argv);
+    if (argc < 4 || argc > 7){
+      printf("Usage: %s <# iterations> <2log grid size> <stencil radius> ",
+             *argv);
+      printf("[<value bits> <index bits>] [<snapshot file>]\n");
       error = 1;
       goto ENDOFTESTS;
     }
@@ -203,6 +325,57 @@ int main(int argc, char **argv){
       goto ENDOFTESTS;
     }
 
+    /* optional widths of matrix values and column indices, in bits               */
+    if (argc >= 6) {
+      value_bits = atoi(*++argv);
+      if (value_bits != 32 && value_bits != 64) {
+        printf("ERROR: Value width must be 32 or 64 bits: %d\n", value_bits);
+        error = 1;
+        goto ENDOFTESTS;
+      }
+      index_bits = atoi(*++argv);
+      if (index_bits != 32 && index_bits != 64) {
+        printf("ERROR: Index width must be 32 or 64 bits: %d\n", index_bits);
+        error = 1;
+        goto ENDOFTESTS;
+      }
+      if (index_bits == 32 && size2 >= ((s64Int)1<<31)) {
+        printf("ERROR: Matrix order "FSTR64U" too large for 32-bit indices\n",
+               size2);
+        error = 1;
+        goto ENDOFTESTS;
+      }
+#if TESTDENSE
+      if (value_bits != 64 || index_bits != 64) {
+        printf("ERROR: Dense matrix test requires 64-bit values and indices\n");
+        error = 1;
+        goto ENDOFTESTS;
+      }
+#endif
+    }
+
+    /* decide whether to map an existing matrix snapshot or to write one           */
+    if (argc == 5 || argc == 7) {
+      strncpy(snap_path, *++argv, sizeof(snap_path)-1);
+      snap_path[sizeof(snap_path)-1] = '\0';
+      snap_mode = snap_write;
+      snap_fd = open(snap_path, O_RDONLY);
+      if (snap_fd >= 0) {
+        if (read(snap_fd, &header, sizeof(header)) == sizeof(header)     &&
+            !memcmp(header.magic, SNAP_MAGIC, sizeof(header.magic))      &&
+            header.version  == SNAP_VERSION && header.lsize == lsize     &&
+            header.radius   == radius       && header.scramble == SCRAMBLE &&
+            header.value_bits == value_bits && header.index_bits == index_bits) {
+          snap_mode = snap_map;
+        }
+        else {
+          printf("Snapshot %s does not match current parameters; regenerating\n",
+                 snap_path);
+        }
+        close(snap_fd);
+      }
+    }
+
     /* sparsity follows from number of non-zeroes per row                           */
     sparsity = (double)(4*radius+1)/(double)size2;
 
@@ -211,6 +384,9 @@ int main(int argc, char **argv){
     printf("Stencil diameter      = %16d\n", 2*radius+1);
     printf("Sparsity              = %16.10lf\n", sparsity);
     printf("Number of iterations  = %16d\n", iterations);
+    printf("Value width (bits)    = %16d\n", value_bits);
+    printf("Index width (bits)    = %16d\n", index_bits);
+    printf("Bytes per nonzero     = %16d\n", (value_bits+index_bits)/8);
 #if SCRAMBLE
     printf("Indexing              = scrambled\n");
 #else
@@ -221,6 +397,9 @@ int main(int argc, char **argv){
 #else
     printf("Matrix storage format = Compressed Sparse Row\n");
 #endif
+    if      (snap_mode == snap_write) printf("Matrix snapshot       = writing %s\n", snap_path);
+    else if (snap_mode == snap_map)   printf("Matrix snapshot       = mapping %s\n", snap_path);
+    printf("SpMV decomposition    = local/remote split, gather overlapped\n");
 
     ENDOFTESTS:;
   }
@@ -233,6 +412,15 @@ int main(int argc, char **argv){
   MPI_Bcast(&size2,      1, MPI_LONG_LONG_INT, root, MPI_COMM_WORLD);
   MPI_Bcast(&radius,     1, MPI_INT,           root, MPI_COMM_WORLD);
   MPI_Bcast(&iterations, 1, MPI_INT,           root, MPI_COMM_WORLD);
+  MPI_Bcast(&value_bits, 1, MPI_INT,           root, MPI_COMM_WORLD);
+  MPI_Bcast(&index_bits, 1, MPI_INT,           root, MPI_COMM_WORLD);
+  MPI_Bcast(&snap_mode,  1, MPI_INT,           root, MPI_COMM_WORLD);
+  if (snap_mode != snap_none)
+    MPI_Bcast(snap_path, sizeof(snap_path), MPI_CHAR, root, MPI_COMM_WORLD);
+
+  value_bytes = value_bits/BITS_IN_BYTE;
+  index_bytes = index_bits/BITS_IN_BYTE;
+  mpi_value   = (value_bits == 64) ? MPI_DOUBLE : MPI_FLOAT;
 
   /* compute total size of star stencil in 2D                                     */
   stencil_size = 4*radius+1;
@@ -242,33 +430,89 @@ int main(int argc, char **argv){
   /* compute total number of non-zeroes for this rank                             */
   nent = nrows*stencil_size;
 
-  matrix_space = nent*sizeof(double);
-  matrix = (double *) prk_malloc(matrix_space);
-  if (!matrix) {
-    printf("ERROR: rank %d could not allocate space for sparse matrix: %zu\n",
-           my_ID, matrix_space);
-    error = 1;
+  /* snapshot file geometry: global column index array followed by global matrix
+     value array, both in row order, so the layout does not depend on the
+     number of ranks; each rank owns a contiguous slice of both arrays            */
+  first_elm    = (s64Int)my_ID*nent;
+  colIndex_off = SNAP_DATA_OFFSET;
+  matrix_off   = SNAP_DATA_OFFSET + (off_t)size2*stencil_size*index_bytes;
+  snap_bytes   = (size_t)matrix_off + (size_t)size2*stencil_size*value_bytes;
+
+  matrix_space = nent*value_bytes;
+  if (snap_mode != snap_map) {
+    matrix = prk_malloc(matrix_space);
+    if (!matrix) {
+      printf("ERROR: rank %d could not allocate space for sparse matrix: %zu\n",
+             my_ID, matrix_space);
+      error = 1;
+    }
   }
   bail_out(error);
 
-  vector_space = (size2 + nrows)*sizeof(double);
-  vector = (double *) prk_malloc(vector_space);
+  vector_space = (size2 + 2*nrows)*value_bytes;
+  vector = prk_malloc(vector_space);
   if (!vector) {
     printf("ERROR: rank %d could not allocate space for vectors: %d\n",
-           my_ID, (int)(2*nrows));
+           my_ID, (int)(3*nrows));
+    error = 1;
+  }
+  bail_out(error);
+  result    = (char *)vector + size2*value_bytes;
+  local_vec = (char *)result + (size_t)nrows*value_bytes;
+
+  local_lo = (int *) prk_malloc(4*nrows*sizeof(int));
+  if (!local_lo) {
+    printf("ERROR: rank %d could not allocate space for row partition\n", my_ID);
+    error = 1;
+  }
+  bail_out(error);
+  local_hi = local_lo + nrows;
+  row_zero = local_hi + nrows;
+  row_full = row_zero + nrows;
+
+  index_space = nent*index_bytes;
+  if (snap_mode != snap_map) {
+    colIndex = prk_malloc(index_space);
+    if (!colIndex) {
+      printf("ERROR: rank %d Could not allocate space for column indices: "FSTR64U"\n",
+             my_ID, (u64Int) index_space);
+      error = 1;
+    }
+  }
+  bail_out(error);
+
+  /* rows are generated with full-width indices, then stored in the narrow
+     format; the scratch row is sorted in place                                   */
+  tmpcol = (s64Int *) prk_malloc(stencil_size*sizeof(s64Int));
+  if (!tmpcol) {
+    printf("ERROR: rank %d could not allocate scratch row\n", my_ID);
     error = 1;
   }
   bail_out(error);
-  result = vector + size2;
 
-  index_space = nent*sizeof(s64Int);
-  colIndex = (s64Int *) prk_malloc(index_space);
-  if (!colIndex) {
-    printf("ERROR: rank %d Could not allocate space for column indices: "FSTR64U"\n",
-           my_ID, nent*sizeof(s64Int));
+  local_setup_time = wtime();
+
+  if (snap_mode == snap_map) {
+
+  /* map the snapshot file and point the matrix arrays at this rank's slices      */
+  snap_fd = open(snap_path, O_RDONLY);
+  if (snap_fd < 0) {
+    printf("ERROR: rank %d could not open snapshot file %s\n", my_ID, snap_path);
     error = 1;
   }
   bail_out(error);
+  snap_base = mmap(NULL, snap_bytes, PROT_READ, MAP_SHARED, snap_fd, 0);
+  if (snap_base == MAP_FAILED) {
+    printf("ERROR: rank %d could not map snapshot file %s\n", my_ID, snap_path);
+    error = 1;
+  }
+  bail_out(error);
+  close(snap_fd);
+  colIndex = (char *)snap_base + colIndex_off + first_elm*index_bytes;
+  matrix   = (char *)snap_base + matrix_off   + first_elm*value_bytes;
+
+  }
+  else {
 
   /* fill matrix with nonzeroes corresponding to difference stencil. We use the
      scrambling for reordering the points in the grid.                            */
@@ -279,21 +523,94 @@ int main(int argc, char **argv){
   for (int j=jstart; j<jend; j++)
     for (int i=0; i<size; i++) {
       elm_start = (i+(j-jstart)*size)*stencil_size;
-      elm = elm_start;
-      colIndex[elm] = REVERSE(LIN(i,j),lsize2);
+      elm = 0;
+      tmpcol[elm] = REVERSE(LIN(i,j),lsize2);
       for (r=1; r<=radius; r++, elm+=4) {
-        colIndex[elm+1] = REVERSE(LIN((i+r)%size,j),lsize2);
-        colIndex[elm+2] = REVERSE(LIN((i-r+size)%size,j),lsize2);
-        colIndex[elm+3] = REVERSE(LIN(i,(j+r)%size),lsize2);
-        colIndex[elm+4] = REVERSE(LIN(i,(j-r+size)%size),lsize2);
+        tmpcol[elm+1] = REVERSE(LIN((i+r)%size,j),lsize2);
+        tmpcol[elm+2] = REVERSE(LIN((i-r+size)%size,j),lsize2);
+        tmpcol[elm+3] = REVERSE(LIN(i,(j+r)%size),lsize2);
+        tmpcol[elm+4] = REVERSE(LIN(i,(j-r+size)%size),lsize2);
       }
-      /* sort colIndex to make sure the compressed row accesses
+      /* sort the row to make sure the compressed row accesses
          vector elements in increasing order                                        */
-      qsort(&(colIndex[elm_start]), stencil_size, sizeof(s64Int), compare);
-      for (elm=elm_start; elm<elm_start+stencil_size; elm++)
-        matrix[elm] = 1.0/(double)(colIndex[elm]+1);
+      qsort(tmpcol, stencil_size, sizeof(s64Int), compare);
+      for (elm=0; elm<stencil_size; elm++) {
+        if (index_bits == 64)
+             ((s64Int *)colIndex)[elm_start+elm] = tmpcol[elm];
+        else ((int    *)colIndex)[elm_start+elm] = (int)tmpcol[elm];
+        if (value_bits == 64)
+             ((double *)matrix)[elm_start+elm] = 1.0/(double)(tmpcol[elm]+1);
+        else ((float  *)matrix)[elm_start+elm] = 1.0f/(float)(tmpcol[elm]+1);
+      }
+  }
+
+  if (snap_mode == snap_write) {
+    /* root lays out the file, then each rank deposits its slice of both arrays   */
+    if (my_ID == root) {
+      memset(&header, 0, sizeof(header));
+      memcpy(header.magic, SNAP_MAGIC, sizeof(header.magic));
+      header.version    = SNAP_VERSION;
+      header.lsize      = lsize;
+      header.radius     = radius;
+      header.scramble   = SCRAMBLE;
+      header.value_bits = value_bits;
+      header.index_bits = index_bits;
+      snap_fd = open(snap_path, O_WRONLY|O_CREAT|O_TRUNC, 0644);
+      if (snap_fd < 0                                              ||
+          write(snap_fd, &header, sizeof(header)) != sizeof(header)||
+          ftruncate(snap_fd, snap_bytes) < 0) {
+        printf("ERROR: rank %d could not create snapshot file %s\n", my_ID, snap_path);
+        error = 1;
+      }
+      else close(snap_fd);
+    }
+    bail_out(error);
+    MPI_Barrier(MPI_COMM_WORLD);
+    snap_fd = open(snap_path, O_WRONLY);
+    if (snap_fd < 0                                                ||
+        pwrite(snap_fd, colIndex, index_space,
+               colIndex_off + first_elm*index_bytes) != (ssize_t)index_space ||
+        pwrite(snap_fd, matrix, matrix_space,
+               matrix_off   + first_elm*value_bytes) != (ssize_t)matrix_space) {
+      printf("ERROR: rank %d could not write snapshot file %s\n", my_ID, snap_path);
+      error = 1;
+    }
+    else close(snap_fd);
+    bail_out(error);
   }
 
+  } /* end of generate-or-map                                                     */
+
+  /* classify each row's nonzeroes: rows are sorted by column and each rank owns
+     a contiguous block of columns, so the entries with owned columns form one
+     contiguous range per row, framed by a remote prefix and suffix              */
+  col_start = (s64Int)nrows*my_ID;
+  col_end   = col_start + nrows;
+  for (row=0; row<nrows; row++) {
+    int lo, hi;
+    first = stencil_size*row;
+    for (lo=0; lo<stencil_size; lo++) {
+      s64Int c = (index_bits == 64) ? ((s64Int *)colIndex)[first+lo]
+                                    : ((int    *)colIndex)[first+lo];
+      if (c >= col_start) break;
+    }
+    for (hi=lo; hi<stencil_size; hi++) {
+      s64Int c = (index_bits == 64) ? ((s64Int *)colIndex)[first+hi]
+                                    : ((int    *)colIndex)[first+hi];
+      if (c >= col_end) break;
+    }
+    local_lo[row] = lo;
+    local_hi[row] = hi;
+    row_zero[row] = 0;
+    row_full[row] = stencil_size;
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  local_setup_time = wtime() - local_setup_time;
+  MPI_Reduce(&local_setup_time, &setup_time, 1, MPI_DOUBLE, MPI_MAX, root,
+             MPI_COMM_WORLD);
+  if (my_ID == root) printf("Matrix setup time (s) = %16.6lf\n", setup_time);
+
 #if TESTDENSE
   /* fill dense matrix to test                                                    */
   matrix_space = size2*size2/Num_procs*sizeof(double);
@@ -312,12 +629,19 @@ int main(int argc, char **argv){
     for (col=0; col<size2; col++) DENSE(col,row) = 0.0;
     first = row*stencil_size; last = first+stencil_size-1;
     rhs[row] = (double) (last-first+1) * (double) iterations;
-    for (elm=first; elm<=last; elm++) DENSE(colIndex[elm],row) = matrix[elm];
+    for (elm=first; elm<=last; elm++)
+      DENSE(((s64Int *)colIndex)[elm],row) = ((double *)matrix)[elm];
   }
 #endif
 
   /* initialize the input and result vectors                                      */
-  for (row=0; row<nrows; row++) result[row] = vector[row] = 0.0;
+  if (value_bits == 64)
+       for (row=0; row<nrows; row++)
+         ((double *)result)[row] = ((double *)local_vec)[row] = 0.0;
+  else for (row=0; row<nrows; row++)
+         ((float  *)result)[row] = ((float  *)local_vec)[row] = 0.0f;
+
+  row_offset = nrows*my_ID;
 
   for (iter=0; iter<=iterations; iter++) {
 
@@ -327,27 +651,41 @@ int main(int argc, char **argv){
       local_sparse_time = wtime();
     }
 
-    /* fill vector                                                                */
-    row_offset = nrows*my_ID;
-    for (row=row_offset; row<nrows+row_offset; row++) vector[row] += (double) (row+1);
-
-    /* replicate vector on all ranks                                              */
-    MPI_Allgather(MPI_IN_PLACE, nrows, MPI_DOUBLE, vector, nrows, MPI_DOUBLE,
-                  MPI_COMM_WORLD);
-
-    /* do the actual matrix multiplication                                        */
-    for (row=0; row<nrows; row++) {
-      first = stencil_size*row; last = first+stencil_size-1;
-      for (temp=0.0,col=first; col<=last; col++) {
-        temp += matrix[col]*vector[colIndex[col]];
-      }
-      result[row] += temp;
-    }
+    /* fill this rank's slice of the vector                                       */
+    if (value_bits == 64)
+         for (row=0; row<nrows; row++)
+           ((double *)local_vec)[row] += (double) (row_offset+row+1);
+    else for (row=0; row<nrows; row++)
+           ((float  *)local_vec)[row] += (float) (row_offset+row+1);
+
+    /* start replicating the vector on all ranks; the gather proceeds while
+       the local phase computes                                                   */
+    MPI_Iallgather(local_vec, nrows, mpi_value, vector, nrows, mpi_value,
+                   MPI_COMM_WORLD, &gather_req);
+
+    /* local phase: entries with owned columns read from the local slice         */
+    spmv(value_bits, index_bits, nrows, stencil_size, local_lo, local_hi,
+         (s64Int)row_offset, matrix, colIndex, local_vec, result);
+
+    /* whatever part of the gather the local phase did not hide is exposed       */
+    wait_start = wtime();
+    MPI_Wait(&gather_req, MPI_STATUS_IGNORE);
+    if (iter >= 1) local_exposed_time += wtime() - wait_start;
+
+    /* remote phase: the prefix and suffix of each row, from the full vector     */
+    spmv(value_bits, index_bits, nrows, stencil_size, row_zero, local_lo,
+         (s64Int)0, matrix, colIndex, vector, result);
+    spmv(value_bits, index_bits, nrows, stencil_size, local_hi, row_full,
+         (s64Int)0, matrix, colIndex, vector, result);
   } /* end of iterations                                                          */
 
   local_sparse_time = wtime() - local_sparse_time;
   MPI_Reduce(&local_sparse_time, &sparse_time, 1, MPI_DOUBLE, MPI_MAX, root,
              MPI_COMM_WORLD);
+  MPI_Reduce(&local_exposed_time, &exposed_time, 1, MPI_DOUBLE, MPI_MAX, root,
+             MPI_COMM_WORLD);
+  MPI_Reduce(&local_exposed_time, &exposed_time_avg, 1, MPI_DOUBLE, MPI_SUM, root,
+             MPI_COMM_WORLD);
 
 
 #if TESTDENSE && VERBOSE
@@ -356,7 +694,7 @@ int main(int argc, char **argv){
     printf("( ");
     for (col=0; col<size2; col++) printf("%1.3lf  ", DENSE(col,row));
     printf(" ) ( %1.3lf ) = ( %1.3lf ) | ( %1.3lf )\n",
-           vector[row], result[row], rhs[row]);
+           ((double *)vector)[row], ((double *)result)[row], rhs[row]);
   }
 #endif
 
@@ -365,10 +703,17 @@ int main(int argc, char **argv){
     (double) (iterations+1) * (double) (iterations + 2);
 
   vector_sum = 0.0;
-  for (row=0; row<nrows; row++) vector_sum += result[row];
+  if (value_bits == 64)
+       for (row=0; row<nrows; row++) vector_sum += ((double *)result)[row];
+  else for (row=0; row<nrows; row++) vector_sum += ((float  *)result)[row];
 
   MPI_Reduce(&vector_sum, &check_sum, 1, MPI_DOUBLE, MPI_SUM, root, MPI_COMM_WORLD);
 
+  /* all contributions are positive, so the relative error of the checksum is
+     bounded by the per-term rounding error of the value type; 64-bit values
+     keep the historical absolute tolerance                                       */
+  if (value_bits == 32) epsilon = 1.e-4*reference_sum;
+
   if (my_ID == root) {
     if (ABS(check_sum-reference_sum) > epsilon) {
       printf("ERROR: Vector sum = %lf, Reference vector sum = %lf, my_ID = %d\n",
@@ -385,6 +730,10 @@ int main(int argc, char **argv){
     avgtime = sparse_time/iterations;
     printf("Rate (MFlops/s): %lf  Avg time (s): %lf\n",
            1.0E-06 * (2.0*nent*Num_procs)/avgtime, avgtime);
+    printf("Matrix traffic (MB/s): %lf\n",
+           1.0E-06 * ((double)(value_bytes+index_bytes)*nent*Num_procs)/avgtime);
+    printf("Exposed comm time (s/iter): avg %lf, max %lf\n",
+           exposed_time_avg/(double)Num_procs/iterations, exposed_time/iterations);
   }
 
   bail_out(error);
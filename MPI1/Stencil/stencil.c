@@ -70,6 +70,7 @@ HISTORY: - Written by Rob Van der Wijngaart, November 2006.
 
 #include <par-res-kern_general.h>
 #include <par-res-kern_mpi.h>
+#include <prk_trace.h>
 
 #if DOUBLE
   #define DTYPE     double
@@ -95,6 +96,27 @@ HISTORY: - Written by Rob Van der Wijngaart, November 2006.
 #define OUT(i,j)      out[INDEXOUT(i-istart,j-jstart)]
 #define WEIGHT(ii,jj) weight[ii+RADIUS][jj+RADIUS]
 
+/* pack/unpack of one halo, in the native type or demoted to FP32 on the
+   wire (PRK_HALO_COMPRESS=fp32); both paths fill the same buffers        */
+#define PACK_HALO(buf, jlo_, jhi_, ilo_, ihi_)                                   \
+    if (halo_compress) {                                                         \
+      float * RESTRICT cbuf = (float *) (buf);                                   \
+      for (int kk=0,j=(jlo_); j<=(jhi_); j++) for (int i=(ilo_); i<=(ihi_); i++) \
+        cbuf[kk++] = (float) IN(i,j);                                            \
+    } else {                                                                     \
+      for (int kk=0,j=(jlo_); j<=(jhi_); j++) for (int i=(ilo_); i<=(ihi_); i++) \
+        (buf)[kk++] = IN(i,j);                                                   \
+    }
+#define SCATTER_HALO(buf, jlo_, jhi_, ilo_, ihi_)                                \
+    if (halo_compress) {                                                         \
+      const float * RESTRICT cbuf = (const float *) (buf);                       \
+      for (int kk=0,j=(jlo_); j<=(jhi_); j++) for (int i=(ilo_); i<=(ihi_); i++) \
+        IN(i,j) = (DTYPE) cbuf[kk++];                                            \
+    } else {                                                                     \
+      for (int kk=0,j=(jlo_); j<=(jhi_); j++) for (int i=(ilo_); i<=(ihi_); i++) \
+        IN(i,j) = (buf)[kk++];                                                   \
+    }
+
 int main(int argc, char ** argv) {
 
   int    Num_procs;       /* number of ranks                                     */
@@ -105,16 +127,17 @@ int main(int argc, char ** argv) {
   int    left_nbr;        /* global rank of left neighboring tile                */
   int    top_nbr;         /* global rank of top neighboring tile                 */
   int    bottom_nbr;      /* global rank of bottom neighboring tile              */
-  DTYPE *top_buf_out;     /* communication buffer                                */
-  DTYPE *top_buf_in;      /*       "         "                                   */
-  DTYPE *bottom_buf_out;  /*       "         "                                   */
-  DTYPE *bottom_buf_in;   /*       "         "                                   */
-  DTYPE *right_buf_out;   /*       "         "                                   */
-  DTYPE *right_buf_in;    /*       "         "                                   */
-  DTYPE *left_buf_out;    /*       "         "                                   */
-  DTYPE *left_buf_in;     /*       "         "                                   */
+  DTYPE *top_buf_out[2];  /* double-buffered communication buffers               */
+  DTYPE *top_buf_in[2];   /*       "         "                                   */
+  DTYPE *bottom_buf_out[2];/*      "         "                                   */
+  DTYPE *bottom_buf_in[2];/*       "         "                                   */
+  DTYPE *right_buf_out[2];/*       "         "                                   */
+  DTYPE *right_buf_in[2]; /*       "         "                                   */
+  DTYPE *left_buf_out[2]; /*       "         "                                   */
+  DTYPE *left_buf_in[2];  /*       "         "                                   */
   int    root = 0;
-  int    n, width, height;/* linear global and local grid dimension              */
+  long   n;               /* linear global grid dimension                        */
+  int    width, height;   /* local grid dimensions of calling rank               */
   long   nsquare;         /* total number of grid points                         */
   int    iter, leftover;  /* dummies                   */
   int    istart, iend;    /* bounds of grid tile assigned to calling rank        */
@@ -128,6 +151,9 @@ int main(int argc, char ** argv) {
   double local_stencil_time,/* timing parameters                                 */
          stencil_time,
          avgtime;
+  double local_compute_time=0.0, compute_time,  /* stencil sweep vs halo exchange */
+         local_exchange_time=0.0, exchange_time,
+         tsplit;
   int    stencil_size;    /* number of points in stencil                         */
   DTYPE  * RESTRICT in;   /* input grid values                                   */
   DTYPE  * RESTRICT out;  /* output grid values                                  */
@@ -135,7 +161,42 @@ int main(int argc, char ** argv) {
   long   total_length_out;/* total required length to store output array         */
   int    error=0;         /* error flag                                          */
   DTYPE  weight[2*RADIUS+1][2*RADIUS+1]; /* weights of points in the stencil     */
-  MPI_Request request[8];
+  MPI_Request exch_req[2][8]; /* persistent halo requests, one set per parity    */
+  int    nrecv=0, nreq=0; /* number of receives/total requests per parity set    */
+  MPI_Comm comm;          /* communicator, with optional node-aware rank order   */
+  int    nbrs[4], num_nbrs=0, /* existing halo partners of calling rank          */
+         offnode,         /* how many of them live on a different node           */
+         total_offnode, total_links; /* aggregates over all ranks                */
+  int    halo_compress=0; /* demote double halos to FP32 on the wire             */
+  int    ddt_mode=0;      /* halo exchange: 0 manual pack (default), 1 derived
+                             datatypes, 2 both paths in one run, split over the
+                             timed iterations for a standing comparison          */
+  int    half;            /* last timed iteration of the pack phase (mode 2)     */
+  MPI_Datatype x_halo_ddt, y_halo_ddt; /* strided column/row-block halo types    */
+  MPI_Request ddt_req[8]; /* requests of the datatype-mode exchange              */
+  int    nddt_req=0;      /* number of active datatype-mode requests             */
+  double local_pack_time=0.0, pack_time, /* per-path exchange timings (mode 2)   */
+         local_ddt_time=0.0,  ddt_time;
+  MPI_Datatype halo_type; /* element type of the halos as transmitted            */
+  long   halo_words,      /* halo elements sent per iteration by calling rank    */
+         total_halo_words;
+  int    ckpt_interval=0; /* write a checkpoint every k iterations (PRK_CHECKPOINT) */
+  int    ckpt_async=0;    /* overlap the write with subsequent iterations        */
+  int    num_ckpts=0;     /* checkpoints written during the timed iterations     */
+  MPI_File ckpt_file;     /* collective MPI-IO checkpoint file                   */
+  MPI_Datatype ckpt_filetype, /* this rank's tile within the global grid file    */
+               ckpt_memtype;  /* the tile interior within the padded local array */
+  DTYPE  *ckpt_buf[2];    /* double-buffered staging for asynchronous writes     */
+  MPI_Request ckpt_req[2] = {MPI_REQUEST_NULL, MPI_REQUEST_NULL};
+  double local_ckpt_time=0.0, ckpt_time, /* time blocked on checkpoint I/O       */
+         local_nockpt_time, nockpt_time; /* total time minus checkpoint stalls   */
+#if NBC
+  MPI_Comm comm_cart;     /* Cartesian communicator for neighborhood collective  */
+  MPI_Request nbc_req;    /* pending neighborhood collective                     */
+  int    nbc_counts[4];   /* per-neighbor element counts                         */
+  MPI_Aint sdispl[2][4], rdispl[2][4]; /* absolute buffer addresses per parity   */
+  MPI_Datatype nbc_types[4];
+#endif
 
   /*******************************************************************************
   ** Initialize the MPI environment
@@ -171,8 +232,8 @@ int main(int argc, char ** argv) {
       goto ENDOFTESTS;
     }
 
-    n       = atoi(*++argv);
-    nsquare = (long) n * (long) n;
+    n       = atol(*++argv);
+    nsquare = n * n;
     if (nsquare < Num_procs){
       printf("ERROR: grid size %ld must be at least # ranks: %d\n",
 	     nsquare, Num_procs);
@@ -187,7 +248,7 @@ int main(int argc, char ** argv) {
     }
 
     if (2*RADIUS +1 > n) {
-      printf("ERROR: Stencil radius %d exceeds grid size %d\n", RADIUS, n);
+      printf("ERROR: Stencil radius %d exceeds grid size %ld\n", RADIUS, n);
       error = 1;
       goto ENDOFTESTS;
     }
@@ -196,9 +257,91 @@ int main(int argc, char ** argv) {
   }
   bail_out(error);
 
+  MPI_Bcast(&n,          1, MPI_LONG, root, MPI_COMM_WORLD);
+  MPI_Bcast(&iterations, 1, MPI_INT, root, MPI_COMM_WORLD);
+
   /* determine best way to create a 2D grid of ranks (closest to square)     */
   factor(Num_procs, &Num_procsx, &Num_procsy);
 
+  /* optionally renumber ranks so grid neighbors share a node; all further
+     communication uses the resulting communicator                           */
+  comm = prk_node_aware_comm(MPI_COMM_WORLD, Num_procsx, Num_procsy);
+  MPI_Comm_rank(comm, &my_ID);
+
+  /* optional phase timeline (PRK_TRACE=1), keyed by the final rank order */
+  prk_trace_init(my_ID);
+
+  /* optional lossy halo compression: demote the double halos to FP32 on
+     the wire; a no-op (with a warning) when the grid is already FP32     */
+  {
+    char *envar = getenv("PRK_HALO_COMPRESS");
+    if (envar) {
+      if (!strcmp(envar,"fp32")) halo_compress = 1;
+      else if (my_ID == root)
+        printf("Unknown PRK_HALO_COMPRESS value %s ignored\n", envar);
+#if !DOUBLE
+      if (halo_compress) {
+        halo_compress = 0;
+        if (my_ID == root)
+          printf("Halo data is already single precision; compression disabled\n");
+      }
+#endif
+    }
+  }
+  halo_type = halo_compress ? MPI_FLOAT : MPI_DTYPE;
+
+  /* optional derived-datatype halo exchange: the strided column (and
+     row-block) halos are described by MPI_Type_vector and sent directly
+     from the grid array, leaving the gather/scatter to the MPI datatype
+     engine.  "compare" runs both paths in one invocation, pack for the
+     first half of the timed iterations and datatypes for the second,
+     and reports the exchange time of each                               */
+  {
+    char *envar = getenv("PRK_HALO_DATATYPE");
+    if (envar) {
+      if      (!strcmp(envar,"vector"))  ddt_mode = 1;
+      else if (!strcmp(envar,"compare")) ddt_mode = 2;
+      else if (my_ID == root)
+        printf("Unknown PRK_HALO_DATATYPE value %s ignored\n", envar);
+      if (ddt_mode == 2 && iterations < 2) {
+        ddt_mode = 0;
+        if (my_ID == root)
+          printf("Datatype comparison needs at least 2 iterations; disabled\n");
+      }
+      if (ddt_mode && halo_compress) {
+        ddt_mode = 0;
+        if (my_ID == root)
+          printf("Datatype halos send native elements; disabled under halo compression\n");
+      }
+#if NBC
+      if (ddt_mode) {
+        ddt_mode = 0;
+        if (my_ID == root)
+          printf("Datatype halos not supported with neighborhood collectives; disabled\n");
+      }
+#endif
+    }
+  }
+  half = iterations/2;
+
+  /* optional checkpoint stage, modeling codes that dump their state every
+     k steps: a collective MPI-IO write of the global grid.  The default
+     write blocks; PRK_CHECKPOINT_ASYNC stages the tile in one of two
+     buffers and issues a nonblocking collective write, so the I/O overlaps
+     the following iterations and only buffer reuse can stall             */
+  {
+    char *envar = getenv("PRK_CHECKPOINT");
+    if (envar) {
+      ckpt_interval = atoi(envar);
+      if (ckpt_interval < 1) {
+        ckpt_interval = 0;
+        if (my_ID == root)
+          printf("Checkpoint interval %s not positive; checkpointing disabled\n", envar);
+      }
+      if (ckpt_interval && getenv("PRK_CHECKPOINT_ASYNC")) ckpt_async = 1;
+    }
+  }
+
   my_IDx = my_ID%Num_procsx;
   my_IDy = my_ID/Num_procsx;
   /* compute neighbors; don't worry about dropping off the edges of the grid */
@@ -207,9 +350,18 @@ int main(int argc, char ** argv) {
   top_nbr    = my_ID+Num_procsx;
   bottom_nbr = my_ID-Num_procsx;
 
+  /* count how many of my halo partners live on a different node             */
+  if (my_IDy < Num_procsy-1) nbrs[num_nbrs++] = top_nbr;
+  if (my_IDy > 0)            nbrs[num_nbrs++] = bottom_nbr;
+  if (my_IDx < Num_procsx-1) nbrs[num_nbrs++] = right_nbr;
+  if (my_IDx > 0)            nbrs[num_nbrs++] = left_nbr;
+  offnode = prk_count_offnode(comm, nbrs, num_nbrs);
+  MPI_Reduce(&offnode,  &total_offnode, 1, MPI_INT, MPI_SUM, root, comm);
+  MPI_Reduce(&num_nbrs, &total_links,   1, MPI_INT, MPI_SUM, root, comm);
+
   if (my_ID == root) {
     printf("Number of ranks        = %d\n", Num_procs);
-    printf("Grid size              = %d\n", n);
+    printf("Grid size              = %ld\n", n);
     printf("Radius of stencil      = %d\n", RADIUS);
     printf("Tiles in x/y-direction = %d/%d\n", Num_procsx, Num_procsy);
     printf("Type of stencil        = star\n");
@@ -224,11 +376,26 @@ int main(int argc, char ** argv) {
     printf("Compact representation of stencil loop body\n");
 #endif
     printf("Number of iterations   = %d\n", iterations);
+#if NBC
+    printf("Halo exchange          = neighborhood collective\n");
+#else
+    if (ddt_mode == 1)
+      printf("Halo exchange          = derived datatype (MPI_Type_vector)\n");
+    else if (ddt_mode == 2)
+      printf("Halo exchange          = pack vs derived-datatype comparison\n");
+    else
+      printf("Halo exchange          = persistent point-to-point\n");
+#endif
+    if (ckpt_interval)
+      printf("Checkpoint interval    = %d (%s MPI-IO)\n", ckpt_interval,
+             ckpt_async ? "asynchronous" : "blocking");
+    if (halo_compress)
+      printf("Halo compression       = FP32 demotion on the wire\n");
+    if (getenv("PRK_TOPOLOGY_REMAP"))
+      printf("Rank remapping         = node aware\n");
+    printf("Off-node halo links    = %d of %d\n", total_offnode, total_links);
   }
 
-  MPI_Bcast(&n,          1, MPI_INT, root, MPI_COMM_WORLD);
-  MPI_Bcast(&iterations, 1, MPI_INT, root, MPI_COMM_WORLD);
-
   /* compute amount of space required for input and solution arrays             */
 
   width = n/Num_procsx;
@@ -305,107 +472,308 @@ int main(int argc, char ** argv) {
   }
 
   if (Num_procs > 1) {
-    /* allocate communication buffers for halo values                          */
-    top_buf_out = (DTYPE *) prk_malloc(4*sizeof(DTYPE)*RADIUS*width);
-    if (!top_buf_out) {
+    /* allocate communication buffers for halo values; two generations of
+       each buffer so the exchange can be double buffered                     */
+    DTYPE *y_buf = (DTYPE *) prk_malloc(8*sizeof(DTYPE)*RADIUS*width);
+    if (!y_buf) {
       printf("ERROR: Rank %d could not allocated comm buffers for y-direction\n", my_ID);
       error = 1;
     }
     bail_out(error);
-    top_buf_in     = top_buf_out +   RADIUS*width;
-    bottom_buf_out = top_buf_out + 2*RADIUS*width;
-    bottom_buf_in  = top_buf_out + 3*RADIUS*width;
-
-    right_buf_out  = (DTYPE *) prk_malloc(4*sizeof(DTYPE)*RADIUS*height);
-    if (!right_buf_out) {
+    DTYPE *x_buf = (DTYPE *) prk_malloc(8*sizeof(DTYPE)*RADIUS*height);
+    if (!x_buf) {
       printf("ERROR: Rank %d could not allocated comm buffers for x-direction\n", my_ID);
       error = 1;
     }
     bail_out(error);
-    right_buf_in   = right_buf_out +   RADIUS*height;
-    left_buf_out   = right_buf_out + 2*RADIUS*height;
-    left_buf_in    = right_buf_out + 3*RADIUS*height;
+    for (int p=0; p<2; p++) {
+      top_buf_out[p]    = y_buf + (4*p+0)*RADIUS*width;
+      top_buf_in[p]     = y_buf + (4*p+1)*RADIUS*width;
+      bottom_buf_out[p] = y_buf + (4*p+2)*RADIUS*width;
+      bottom_buf_in[p]  = y_buf + (4*p+3)*RADIUS*width;
+      right_buf_out[p]  = x_buf + (4*p+0)*RADIUS*height;
+      right_buf_in[p]   = x_buf + (4*p+1)*RADIUS*height;
+      left_buf_out[p]   = x_buf + (4*p+2)*RADIUS*height;
+      left_buf_in[p]    = x_buf + (4*p+3)*RADIUS*height;
+    }
+
+    /* strided halo datatypes: RADIUS row segments of width elements in the
+       y-direction, height column segments of RADIUS elements in the
+       x-direction, both with the padded row length of "in" as stride      */
+    if (ddt_mode) {
+      MPI_Type_vector(RADIUS, width,  width+2*RADIUS, MPI_DTYPE, &y_halo_ddt);
+      MPI_Type_vector(height, RADIUS, width+2*RADIUS, MPI_DTYPE, &x_halo_ddt);
+      MPI_Type_commit(&y_halo_ddt);
+      MPI_Type_commit(&x_halo_ddt);
+    }
+
+#if NBC
+    /* neighborhood collective: express the decomposition as a Cartesian
+       communicator (same rank order as the manual my_IDx/my_IDy mapping)
+       and exchange all four halos in one MPI_Ineighbor_alltoallw.  The
+       neighbor order of a 2D Cartesian topology is fixed by the standard:
+       lower/upper in dimension 0 (y), then lower/upper in dimension 1 (x).
+       Buffers are addressed absolutely from MPI_BOTTOM, with one set of
+       displacements per buffer generation                                    */
+    {
+      int dims[2]    = {Num_procsy, Num_procsx};
+      int periods[2] = {0, 0};
+      MPI_Cart_create(comm, 2, dims, periods, 0, &comm_cart);
+      nbc_counts[0] = nbc_counts[1] = RADIUS*width;   /* bottom, top  */
+      nbc_counts[2] = nbc_counts[3] = RADIUS*height;  /* left, right  */
+      for (int i=0; i<4; i++) nbc_types[i] = halo_type;
+      for (int p=0; p<2; p++) {
+        MPI_Get_address(bottom_buf_out[p], &sdispl[p][0]);
+        MPI_Get_address(top_buf_out[p],    &sdispl[p][1]);
+        MPI_Get_address(left_buf_out[p],   &sdispl[p][2]);
+        MPI_Get_address(right_buf_out[p],  &sdispl[p][3]);
+        MPI_Get_address(bottom_buf_in[p],  &rdispl[p][0]);
+        MPI_Get_address(top_buf_in[p],     &rdispl[p][1]);
+        MPI_Get_address(left_buf_in[p],    &rdispl[p][2]);
+        MPI_Get_address(right_buf_in[p],   &rdispl[p][3]);
+      }
+    }
+#else
+    /* set up the persistent halo exchange; tags encode direction and parity
+       so the two buffer generations cannot match each other's traffic.
+       Receives come first in each request set so they can be pre-posted
+       separately with MPI_Startall                                           */
+    for (int p=0; p<2; p++) {
+      int nr = 0;
+      if (my_IDy < Num_procsy-1)
+        MPI_Recv_init(top_buf_in[p], RADIUS*width, halo_type, top_nbr, 4*p+1,
+                      comm, &exch_req[p][nr++]);
+      if (my_IDy > 0)
+        MPI_Recv_init(bottom_buf_in[p], RADIUS*width, halo_type, bottom_nbr, 4*p+0,
+                      comm, &exch_req[p][nr++]);
+      if (my_IDx < Num_procsx-1)
+        MPI_Recv_init(right_buf_in[p], RADIUS*height, halo_type, right_nbr, 4*p+3,
+                      comm, &exch_req[p][nr++]);
+      if (my_IDx > 0)
+        MPI_Recv_init(left_buf_in[p], RADIUS*height, halo_type, left_nbr, 4*p+2,
+                      comm, &exch_req[p][nr++]);
+      nrecv = nr;
+      if (my_IDy < Num_procsy-1)
+        MPI_Send_init(top_buf_out[p], RADIUS*width, halo_type, top_nbr, 4*p+0,
+                      comm, &exch_req[p][nr++]);
+      if (my_IDy > 0)
+        MPI_Send_init(bottom_buf_out[p], RADIUS*width, halo_type, bottom_nbr, 4*p+1,
+                      comm, &exch_req[p][nr++]);
+      if (my_IDx < Num_procsx-1)
+        MPI_Send_init(right_buf_out[p], RADIUS*height, halo_type, right_nbr, 4*p+2,
+                      comm, &exch_req[p][nr++]);
+      if (my_IDx > 0)
+        MPI_Send_init(left_buf_out[p], RADIUS*height, halo_type, left_nbr, 4*p+3,
+                      comm, &exch_req[p][nr++]);
+      nreq = nr;
+    }
+#endif
+  }
+
+  /* halo elements sent per iteration, for the bandwidth report              */
+  halo_words = 0;
+  if (my_IDy < Num_procsy-1) halo_words += (long)RADIUS*width;
+  if (my_IDy > 0)            halo_words += (long)RADIUS*width;
+  if (my_IDx < Num_procsx-1) halo_words += (long)RADIUS*height;
+  if (my_IDx > 0)            halo_words += (long)RADIUS*height;
+  MPI_Reduce(&halo_words, &total_halo_words, 1, MPI_LONG, MPI_SUM, root, comm);
+
+  if (ckpt_interval) {
+    /* each rank writes its tile into a single file holding the global grid;
+       the file view is the tile's subarray of the n x n file, the memory
+       type the tile interior of the ghost-padded local array               */
+    int gsizes[2]  = {(int)n, (int)n};
+    int lsizes[2]  = {height, width};
+    int fstarts[2] = {jstart, istart};
+    int msizes[2]  = {height+2*RADIUS, width+2*RADIUS};
+    int mstarts[2] = {RADIUS, RADIUS};
+    MPI_Type_create_subarray(2, gsizes, lsizes, fstarts, MPI_ORDER_C,
+                             MPI_DTYPE, &ckpt_filetype);
+    MPI_Type_create_subarray(2, msizes, lsizes, mstarts, MPI_ORDER_C,
+                             MPI_DTYPE, &ckpt_memtype);
+    MPI_Type_commit(&ckpt_filetype);
+    MPI_Type_commit(&ckpt_memtype);
+    if (MPI_File_open(comm, "stencil.ckpt", MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                      MPI_INFO_NULL, &ckpt_file) != MPI_SUCCESS) {
+      printf("ERROR: rank %d could not open checkpoint file\n", my_ID);
+      error = 1;
+    }
+    bail_out(error);
+    MPI_File_set_view(ckpt_file, 0, MPI_DTYPE, ckpt_filetype, "native",
+                      MPI_INFO_NULL);
+    if (ckpt_async) for (int b=0; b<2; b++) {
+      ckpt_buf[b] = (DTYPE *) prk_malloc((long)width*height*sizeof(DTYPE));
+      if (!ckpt_buf[b]) {
+        printf("ERROR: rank %d could not allocate checkpoint buffers\n", my_ID);
+        error = 1;
+      }
+    }
+    bail_out(error);
   }
 
   for (iter = 0; iter<=iterations; iter++){
 
     /* start timer after a warmup iteration */
     if (iter == 1) {
-      MPI_Barrier(MPI_COMM_WORLD);
+      MPI_Barrier(comm);
       local_stencil_time = wtime();
     }
 
-    /* need to fetch ghost point data from neighbors in y-direction                 */
-    if (my_IDy < Num_procsy-1) {
-      MPI_Irecv(top_buf_in, RADIUS*width, MPI_DTYPE, top_nbr, 101,
-                MPI_COMM_WORLD, &(request[1]));
-      for (int kk=0,j=jend-RADIUS+1; j<=jend; j++) for (int i=istart; i<=iend; i++) {
-          top_buf_out[kk++]= IN(i,j);
+    int p = iter%2;
+    /* which exchange path this iteration (and the next one) uses           */
+    int use_ddt      = ddt_mode && (ddt_mode == 1 || iter   > half);
+    int next_use_ddt = ddt_mode && (ddt_mode == 1 || iter+1 > half);
+
+#if !NBC
+    /* the receives of the very first iteration cannot be pre-posted         */
+    if (iter == 0 && Num_procs > 1 && !use_ddt) MPI_Startall(nrecv, exch_req[0]);
+#endif
+
+    /* pack and start the halo exchange of this iteration, then pre-post the
+       receives of the next one so that communication overlaps the interior
+       sweep below.  In datatype mode there is nothing to pack: sends read
+       the strided halo straight out of "in", and receives land straight in
+       its ghost region, so they cannot be posted before the previous
+       boundary sweep has consumed that region                               */
+    prk_trace_begin();
+    tsplit = wtime();
+    if (use_ddt) {
+      nddt_req = 0;
+      if (my_IDy < Num_procsy-1) {
+        MPI_Irecv(&IN(istart,jend+1), 1, y_halo_ddt, top_nbr, 9,
+                  comm, &ddt_req[nddt_req++]);
+        MPI_Isend(&IN(istart,jend-RADIUS+1), 1, y_halo_ddt, top_nbr, 8,
+                  comm, &ddt_req[nddt_req++]);
       }
-      MPI_Isend(top_buf_out, RADIUS*width,MPI_DTYPE, top_nbr, 99,
-                MPI_COMM_WORLD, &(request[0]));
-    }
-    if (my_IDy > 0) {
-      MPI_Irecv(bottom_buf_in,RADIUS*width, MPI_DTYPE, bottom_nbr, 99,
-                MPI_COMM_WORLD, &(request[3]));
-      for (int kk=0,j=jstart; j<=jstart+RADIUS-1; j++) for (int i=istart; i<=iend; i++) {
-          bottom_buf_out[kk++]= IN(i,j);
+      if (my_IDy > 0) {
+        MPI_Irecv(&IN(istart,jstart-RADIUS), 1, y_halo_ddt, bottom_nbr, 8,
+                  comm, &ddt_req[nddt_req++]);
+        MPI_Isend(&IN(istart,jstart), 1, y_halo_ddt, bottom_nbr, 9,
+                  comm, &ddt_req[nddt_req++]);
+      }
+      if (my_IDx < Num_procsx-1) {
+        MPI_Irecv(&IN(iend+1,jstart), 1, x_halo_ddt, right_nbr, 11,
+                  comm, &ddt_req[nddt_req++]);
+        MPI_Isend(&IN(iend-RADIUS+1,jstart), 1, x_halo_ddt, right_nbr, 10,
+                  comm, &ddt_req[nddt_req++]);
+      }
+      if (my_IDx > 0) {
+        MPI_Irecv(&IN(istart-RADIUS,jstart), 1, x_halo_ddt, left_nbr, 10,
+                  comm, &ddt_req[nddt_req++]);
+        MPI_Isend(&IN(istart,jstart), 1, x_halo_ddt, left_nbr, 11,
+                  comm, &ddt_req[nddt_req++]);
       }
-      MPI_Isend(bottom_buf_out, RADIUS*width,MPI_DTYPE, bottom_nbr, 101,
-                MPI_COMM_WORLD, &(request[2]));
     }
+    else {
     if (my_IDy < Num_procsy-1) {
-      MPI_Wait(&(request[0]), MPI_STATUS_IGNORE);
-      MPI_Wait(&(request[1]), MPI_STATUS_IGNORE);
-      for (int kk=0,j=jend+1; j<=jend+RADIUS; j++) for (int i=istart; i<=iend; i++) {
-          IN(i,j) = top_buf_in[kk++];
-      }
+      PACK_HALO(top_buf_out[p],    jend-RADIUS+1, jend,   istart, iend);
     }
     if (my_IDy > 0) {
-      MPI_Wait(&(request[2]), MPI_STATUS_IGNORE);
-      MPI_Wait(&(request[3]), MPI_STATUS_IGNORE);
-      for (int kk=0,j=jstart-RADIUS; j<=jstart-1; j++) for (int i=istart; i<=iend; i++) {
-          IN(i,j) = bottom_buf_in[kk++];
-      }
+      PACK_HALO(bottom_buf_out[p], jstart, jstart+RADIUS-1, istart, iend);
     }
-
-    /* need to fetch ghost point data from neighbors in x-direction                 */
     if (my_IDx < Num_procsx-1) {
-      MPI_Irecv(right_buf_in, RADIUS*height, MPI_DTYPE, right_nbr, 1010,
-                MPI_COMM_WORLD, &(request[1+4]));
-      for (int kk=0,j=jstart; j<=jend; j++) for (int i=iend-RADIUS+1; i<=iend; i++) {
-          right_buf_out[kk++]= IN(i,j);
-      }
-      MPI_Isend(right_buf_out, RADIUS*height, MPI_DTYPE, right_nbr, 990,
-              MPI_COMM_WORLD, &(request[0+4]));
+      PACK_HALO(right_buf_out[p],  jstart, jend, iend-RADIUS+1, iend);
     }
     if (my_IDx > 0) {
-      MPI_Irecv(left_buf_in, RADIUS*height, MPI_DTYPE, left_nbr, 990,
-                MPI_COMM_WORLD, &(request[3+4]));
-      for (int kk=0,j=jstart; j<=jend; j++) for (int i=istart; i<=istart+RADIUS-1; i++) {
-          left_buf_out[kk++]= IN(i,j);
+      PACK_HALO(left_buf_out[p],   jstart, jend, istart, istart+RADIUS-1);
+    }
+    if (Num_procs > 1) {
+#if NBC
+      MPI_Ineighbor_alltoallw(MPI_BOTTOM, nbc_counts, sdispl[p], nbc_types,
+                              MPI_BOTTOM, nbc_counts, rdispl[p], nbc_types,
+                              comm_cart, &nbc_req);
+#else
+      MPI_Startall(nreq-nrecv, &exch_req[p][nrecv]);
+      if (!next_use_ddt) MPI_Startall(nrecv, exch_req[1-p]);
+#endif
+    }
+    }
+    if (iter > 0) {
+      double dt = wtime() - tsplit;
+      local_exchange_time += dt;
+      if (use_ddt) local_ddt_time  += dt;
+      else         local_pack_time += dt;
+    }
+    prk_trace_end("halo pack+post");
+
+    /* bounds of the active grid points, and of the interior points whose
+       stencil does not reach into the ghost region                          */
+    int jlo=MAX(jstart,RADIUS),   jhi=MIN(n-RADIUS-1,jend);
+    int ilo=MAX(istart,RADIUS),   ihi=MIN(n-RADIUS-1,iend);
+    int jlo_i = (my_IDy>0)            ? MAX(jlo,jstart+RADIUS) : jlo;
+    int jhi_i = (my_IDy<Num_procsy-1) ? MIN(jhi,jend-RADIUS)   : jhi;
+    int ilo_i = (my_IDx>0)            ? MAX(ilo,istart+RADIUS) : ilo;
+    int ihi_i = (my_IDx<Num_procsx-1) ? MIN(ihi,iend-RADIUS)   : ihi;
+
+    /* Apply the stencil operator to the interior while the halo is in flight */
+    prk_trace_begin();
+    tsplit = wtime();
+    for (int j=jlo_i; j<=jhi_i; j++) {
+      for (int i=ilo_i; i<=ihi_i; i++) {
+        #if LOOPGEN
+          #include "loop_body_star.incl"
+        #else
+          for (int jj=-RADIUS; jj<=RADIUS; jj++) OUT(i,j) += WEIGHT(0,jj)*IN(i,j+jj);
+          for (int ii=-RADIUS; ii<0; ii++)       OUT(i,j) += WEIGHT(ii,0)*IN(i+ii,j);
+          for (int ii=1; ii<=RADIUS; ii++)       OUT(i,j) += WEIGHT(ii,0)*IN(i+ii,j);
+        #endif
       }
-      MPI_Isend(left_buf_out, RADIUS*height, MPI_DTYPE, left_nbr, 1010,
-                MPI_COMM_WORLD, &(request[2+4]));
+    }
+    if (iter > 0) local_compute_time += wtime() - tsplit;
+    prk_trace_end("interior sweep");
+
+    /* complete the exchange and scatter the ghost point data; in datatype
+       mode the receives unpacked into the ghost region directly            */
+    prk_trace_begin();
+    tsplit = wtime();
+    if (use_ddt) {
+      MPI_Waitall(nddt_req, ddt_req, MPI_STATUSES_IGNORE);
+    }
+    else {
+#if NBC
+    if (Num_procs > 1) MPI_Wait(&nbc_req, MPI_STATUS_IGNORE);
+#else
+    if (Num_procs > 1) MPI_Waitall(nreq, exch_req[p], MPI_STATUSES_IGNORE);
+#endif
+    if (my_IDy < Num_procsy-1) {
+      SCATTER_HALO(top_buf_in[p],    jend+1, jend+RADIUS, istart, iend);
+    }
+    if (my_IDy > 0) {
+      SCATTER_HALO(bottom_buf_in[p], jstart-RADIUS, jstart-1, istart, iend);
     }
     if (my_IDx < Num_procsx-1) {
-      MPI_Wait(&(request[0+4]), MPI_STATUS_IGNORE);
-      MPI_Wait(&(request[1+4]), MPI_STATUS_IGNORE);
-      for (int kk=0,j=jstart; j<=jend; j++) for (int i=iend+1; i<=iend+RADIUS; i++) {
-          IN(i,j) = right_buf_in[kk++];
-      }
+      SCATTER_HALO(right_buf_in[p],  jstart, jend, iend+1, iend+RADIUS);
     }
     if (my_IDx > 0) {
-      MPI_Wait(&(request[2+4]), MPI_STATUS_IGNORE);
-      MPI_Wait(&(request[3+4]), MPI_STATUS_IGNORE);
-      for (int kk=0,j=jstart; j<=jend; j++) for (int i=istart-RADIUS; i<=istart-1; i++) {
-          IN(i,j) = left_buf_in[kk++];
+      SCATTER_HALO(left_buf_in[p],   jstart, jend, istart-RADIUS, istart-1);
+    }
+    }
+    if (iter > 0) {
+      double dt = wtime() - tsplit;
+      local_exchange_time += dt;
+      if (use_ddt) local_ddt_time  += dt;
+      else         local_pack_time += dt;
+    }
+    prk_trace_end("halo wait+scatter");
+
+    /* Apply the stencil operator to the points that needed the ghost data   */
+    prk_trace_begin();
+    tsplit = wtime();
+    for (int j=jlo; j<=jhi; j++) {
+      if (j>=jlo_i && j<=jhi_i) continue;
+      for (int i=ilo; i<=ihi; i++) {
+        #if LOOPGEN
+          #include "loop_body_star.incl"
+        #else
+          for (int jj=-RADIUS; jj<=RADIUS; jj++) OUT(i,j) += WEIGHT(0,jj)*IN(i,j+jj);
+          for (int ii=-RADIUS; ii<0; ii++)       OUT(i,j) += WEIGHT(ii,0)*IN(i+ii,j);
+          for (int ii=1; ii<=RADIUS; ii++)       OUT(i,j) += WEIGHT(ii,0)*IN(i+ii,j);
+        #endif
       }
     }
-
-    /* Apply the stencil operator */
-    for (int j=MAX(jstart,RADIUS); j<=MIN(n-RADIUS-1,jend); j++) {
-      for (int i=MAX(istart,RADIUS); i<=MIN(n-RADIUS-1,iend); i++) {
+    for (int j=jlo_i; j<=jhi_i; j++) {
+      for (int i=ilo; i<=ihi; i++) {
+        if (i>=ilo_i && i<=ihi_i) { i = ihi_i; continue; }
         #if LOOPGEN
           #include "loop_body_star.incl"
         #else
@@ -418,12 +786,85 @@ int main(int argc, char ** argv) {
 
     /* add constant to solution to force refresh of neighbor data, if any */
     for (int j=jstart; j<=jend; j++) for (int i=istart; i<=iend; i++) IN(i,j)+= 1.0;
+    if (iter > 0) local_compute_time += wtime() - tsplit;
+    prk_trace_end("boundary sweep");
+
+    /* checkpoint stage: dump the global grid every ckpt_interval timed
+       iterations.  The async path stages the tile and returns; it only
+       stalls when a buffer's previous write has not yet retired          */
+    if (ckpt_interval && iter > 0 && iter%ckpt_interval == 0) {
+      prk_trace_begin();
+      tsplit = wtime();
+      if (ckpt_async) {
+        int b = num_ckpts%2;
+        MPI_Wait(&ckpt_req[b], MPI_STATUS_IGNORE);
+        for (int j=jstart; j<=jend; j++) for (int i=istart; i<=iend; i++)
+          ckpt_buf[b][(long)(j-jstart)*width + (i-istart)] = IN(i,j);
+        MPI_File_iwrite_all(ckpt_file, ckpt_buf[b], width*height, MPI_DTYPE,
+                            &ckpt_req[b]);
+      }
+      else {
+        MPI_File_write_all(ckpt_file, in, 1, ckpt_memtype, MPI_STATUS_IGNORE);
+      }
+      num_ckpts++;
+      local_ckpt_time += wtime() - tsplit;
+      prk_trace_end("checkpoint");
+    }
 
   } /* end of iterations                                                   */
 
+  /* writes still in flight count against the checkpoint stage             */
+  if (ckpt_interval && ckpt_async) {
+    tsplit = wtime();
+    for (int b=0; b<2; b++) MPI_Wait(&ckpt_req[b], MPI_STATUS_IGNORE);
+    local_ckpt_time += wtime() - tsplit;
+  }
+
   local_stencil_time = wtime() - local_stencil_time;
   MPI_Reduce(&local_stencil_time, &stencil_time, 1, MPI_DOUBLE, MPI_MAX, root,
-             MPI_COMM_WORLD);
+             comm);
+  MPI_Reduce(&local_compute_time, &compute_time, 1, MPI_DOUBLE, MPI_MAX, root,
+             comm);
+  MPI_Reduce(&local_exchange_time, &exchange_time, 1, MPI_DOUBLE, MPI_MAX, root,
+             comm);
+  MPI_Reduce(&local_pack_time, &pack_time, 1, MPI_DOUBLE, MPI_MAX, root, comm);
+  MPI_Reduce(&local_ddt_time,  &ddt_time,  1, MPI_DOUBLE, MPI_MAX, root, comm);
+  local_nockpt_time = local_stencil_time - local_ckpt_time;
+  MPI_Reduce(&local_ckpt_time,   &ckpt_time,   1, MPI_DOUBLE, MPI_MAX, root, comm);
+  MPI_Reduce(&local_nockpt_time, &nockpt_time, 1, MPI_DOUBLE, MPI_MAX, root, comm);
+  prk_report_rank_stats(local_stencil_time, comm);
+
+  if (ckpt_interval) {
+    MPI_File_close(&ckpt_file);
+    MPI_Type_free(&ckpt_filetype);
+    MPI_Type_free(&ckpt_memtype);
+    if (ckpt_async) for (int b=0; b<2; b++) prk_free(ckpt_buf[b]);
+    /* the checkpoint file is a benchmark proxy, not a restart artifact    */
+    if (my_ID == root) MPI_File_delete("stencil.ckpt", MPI_INFO_NULL);
+  }
+
+  /* retire the receives that were pre-posted for the iteration after the last;
+     in datatype mode no receives are pending (the last pack iteration of a
+     comparison run does not pre-post), so only the requests are freed        */
+  if (Num_procs > 1) {
+#if NBC
+    MPI_Comm_free(&comm_cart);
+#else
+    if (ddt_mode == 0) {
+      int pl = (iterations+1)%2;
+      for (int r=0; r<nrecv; r++) {
+        MPI_Cancel(&exch_req[pl][r]);
+        MPI_Wait(&exch_req[pl][r], MPI_STATUS_IGNORE);
+      }
+    }
+    for (int p=0; p<2; p++) for (int r=0; r<nreq; r++)
+      MPI_Request_free(&exch_req[p][r]);
+    if (ddt_mode) {
+      MPI_Type_free(&y_halo_ddt);
+      MPI_Type_free(&x_halo_ddt);
+    }
+#endif
+  }
 
   /* compute L1 norm in parallel                                                */
   local_norm = (DTYPE) 0.0;
@@ -433,7 +874,7 @@ int main(int argc, char ** argv) {
     }
   }
 
-  MPI_Reduce(&local_norm, &norm, 1, MPI_DTYPE, MPI_SUM, root, MPI_COMM_WORLD);
+  MPI_Reduce(&local_norm, &norm, 1, MPI_DTYPE, MPI_SUM, root, comm);
 
   /*******************************************************************************
   ** Analyze and output results.
@@ -448,7 +889,10 @@ int main(int argc, char ** argv) {
     else {
       reference_norm = (DTYPE) 0.0;
     }
-    if (ABS(norm-reference_norm) > EPSILON) {
+    /* FP32 halos inject relative error of order 2^-24 into the boundary
+       points; widen the tolerance accordingly                              */
+    DTYPE epsilon = halo_compress ? (DTYPE) 1.e-4 : EPSILON;
+    if (ABS(norm-reference_norm) > epsilon) {
       printf("ERROR: L1 norm = "FSTR", Reference L1 norm = "FSTR"\n",
              norm, reference_norm);
       error = 1;
@@ -470,8 +914,38 @@ int main(int argc, char ** argv) {
     avgtime = stencil_time/iterations;
     printf("Rate (MFlops/s): "FSTR"  Avg time (s): %lf\n",
            1.0E-06 * flops/avgtime, avgtime);
+    printf("Compute time (s): %lf  Exchange time (s): %lf\n",
+           compute_time/iterations, exchange_time/iterations);
+    if (Num_procs > 1 && exchange_time > 0.0) {
+      /* effective bandwidth counts the logical (uncompressed) halo bytes;
+         wire bandwidth counts what actually crossed the network           */
+      double raw_bytes  = (double)total_halo_words*sizeof(DTYPE);
+      double wire_bytes = (double)total_halo_words*
+                          (halo_compress ? sizeof(float) : sizeof(DTYPE));
+      double extime     = exchange_time/iterations;
+      printf("Halo bandwidth (MB/s): %lf (effective) %lf (wire)\n",
+             1.0E-06*raw_bytes/extime, 1.0E-06*wire_bytes/extime);
+    }
+    if (ddt_mode == 2 && Num_procs > 1) {
+      /* the pack path ran the first half of the timed iterations, the
+         datatype path the rest; ratio < 1 means the datatype engine won  */
+      double pack_avg = pack_time/half;
+      double ddt_avg  = ddt_time/(iterations-half);
+      printf("Exchange time/iter (s): %lf (pack) %lf (datatype), ratio %.3lf\n",
+             pack_avg, ddt_avg, (pack_avg > 0.0) ? ddt_avg/pack_avg : 0.0);
+    }
+    if (ckpt_interval && num_ckpts > 0) {
+      /* the Rate line above includes checkpoint stalls; the rate below
+         removes them, so their difference prices the chosen interval     */
+      printf("Checkpoints written    = %d, blocked time/write (s): %lf\n",
+             num_ckpts, ckpt_time/num_ckpts);
+      printf("Rate excl. checkpoint (MFlops/s): "FSTR"\n",
+             1.0E-06 * flops/(nockpt_time/iterations));
+    }
   }
 
+  prk_trace_finalize();
+
   MPI_Finalize();
   exit(EXIT_SUCCESS);
 }
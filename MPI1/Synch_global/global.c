@@ -39,10 +39,21 @@ PURPOSE: This program tests the efficiency of a global synchronization
   
 USAGE:   The program takes as input the number of times the test of
          string manipulation involving the global synchronization is
-         carried out, as well as the length of the string.
+         carried out, the length of the string, and optionally an
+         additional synchronization engine to be applied each iteration
+
+         <progname>  <# iterations> <length of numerical string> [<sync>]
+
+         sync is one of
+           none          only the allgather synchronizes (default)
+           barrier       MPI_Barrier
+           iallreduce    nonblocking allreduce of a phase counter
+           dissemination log2(P) rounds of point-to-point messages
+           rma           dissemination over one-sided accumulates with
+                         per-target flushes
+         The string manipulation and its verification are identical for
+         all engines, so run-to-run differences isolate the engine cost.
 
-         <progname>  <# iterations> <length of numerical string>
-  
          The output consists of diagnostics to make sure the 
          algorithm worked, and of timing statistics.
 
@@ -63,9 +74,17 @@ HISTORY: Written by Rob Van der Wijngaart, December 2005.
 
 #include <par-res-kern_general.h>
 #include <par-res-kern_mpi.h>
+#include <prk_skew.h>
 
 #define EOS '\0'
 
+/* labels for the selectable synchronization engines                             */
+#define SYNC_NONE          0
+#define SYNC_BARRIER       1
+#define SYNC_IALLREDUCE    2
+#define SYNC_DISSEMINATION 3
+#define SYNC_RMA           4
+
 int chartoi(char c) {
   /* define short string; need two characters, second contains string terminator */
   char letter[2]="0";
@@ -92,6 +111,17 @@ int main(int argc, char ** argv)
   double stopngo_time;/* timing parameter                                        */
   int    Num_procs;   /* Number of ranks                                         */
   int    error = 0;   /* error flag                                              */
+  int    sync_type;   /* additional synchronization engine                       */
+  char   *sync_name = "none"; /* name of synchronization engine                  */
+  int    round, k;    /* dissemination round and its index                       */
+  int    phase_error; /* mismatches of the iallreduce phase counter              */
+  MPI_Win rma_win;    /* window holding dissemination flags                      */
+  int    *rma_flags;  /* local dissemination flags, one per round                */
+  int    rma_rounds;  /* number of dissemination rounds                          */
+  double local_skew=0.0, /* injected delay and allgather time on this rank       */
+         local_coll=0.0,
+         coll_start,
+         skew_avg, skew_max, coll_min, coll_avg, coll_max;
 
 /*********************************************************************************
 ** Initialize the MPI environment
@@ -99,6 +129,7 @@ int main(int argc, char ** argv)
   MPI_Init(&argc,&argv);
   MPI_Comm_rank(MPI_COMM_WORLD, &my_ID);
   MPI_Comm_size(MPI_COMM_WORLD, &Num_procs);
+  prk_skew_init(my_ID);
 
 /*********************************************************************************
 ** process, test and broadcast input parameter
@@ -108,8 +139,10 @@ int main(int argc, char ** argv)
     printf("Parallel Research Kernels version %s\n", PRKVERSION);
     printf("MPI global synchronization\n");
 
-    if (argc != 3){
-      printf("Usage: %s <# iterations> <scramble string length>\n", *argv);
+    if (argc != 3 && argc != 4){
+      printf("Usage: %s <# iterations> <scramble string length> [<sync>]\n", *argv);
+      printf("    sync is one of 'none', 'barrier', 'iallreduce', ");
+      printf("'dissemination', or 'rma'\n");
       error = 1;
       goto ENDOFTESTS;
     }
@@ -129,6 +162,21 @@ int main(int argc, char ** argv)
       goto ENDOFTESTS;
      }
 
+     if (argc == 4) {
+       sync_name = *++argv;
+       if      (!strcmp(sync_name,"none"))          sync_type = SYNC_NONE;
+       else if (!strcmp(sync_name,"barrier"))       sync_type = SYNC_BARRIER;
+       else if (!strcmp(sync_name,"iallreduce"))    sync_type = SYNC_IALLREDUCE;
+       else if (!strcmp(sync_name,"dissemination")) sync_type = SYNC_DISSEMINATION;
+       else if (!strcmp(sync_name,"rma"))           sync_type = SYNC_RMA;
+       else {
+         printf("ERROR: unknown synchronization engine '%s'\n", sync_name);
+         error = 1;
+         goto ENDOFTESTS;
+       }
+     }
+     else sync_type = SYNC_NONE;
+
      ENDOFTESTS:;
   }
   bail_out(error);
@@ -137,11 +185,16 @@ int main(int argc, char ** argv)
     printf("Number of ranks        = %d\n", Num_procs);
     printf("Scramble string length = %ld\n", length);
     printf("Number of iterations   = %d\n", iterations);
+    printf("Synchronization engine = %s\n", sync_name);
+    if (prk_skew_active())
+      printf("Skew injection         = %s, scale %d us\n",
+             prk_skew_name(), prk_skew_scale());
   }
 
   /* Broadcast benchmark data to all ranks */
   MPI_Bcast(&iterations, 1, MPI_INT, root, MPI_COMM_WORLD);
   MPI_Bcast(&length,     1, MPI_LONG, root, MPI_COMM_WORLD);
+  MPI_Bcast(&sync_type,  1, MPI_INT, root, MPI_COMM_WORLD);
   proc_length = length/Num_procs;
 
   basestring = prk_malloc((proc_length+1)*sizeof(char));
@@ -191,14 +244,34 @@ int main(int argc, char ** argv)
   MPI_Type_contiguous(proc_length,MPI_CHAR, &mpi_word);
   MPI_Type_commit(&mpi_word);
 
+  /* one flag per dissemination round; rank p is signaled once per round
+     per iteration, so after iteration iter each flag equals iter+1        */
+  for (rma_rounds=0, round=1; round<Num_procs; round<<=1) rma_rounds++;
+  if (sync_type == SYNC_RMA) {
+    MPI_Win_allocate(MAX(rma_rounds,1)*sizeof(int), sizeof(int), MPI_INFO_NULL,
+                     MPI_COMM_WORLD, &rma_flags, &rma_win);
+    for (k=0; k<MAX(rma_rounds,1); k++) rma_flags[k] = 0;
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, rma_win);
+  }
+  phase_error = 0;
+
   MPI_Barrier(MPI_COMM_WORLD);
   stopngo_time = wtime();
 
   for (iter=0; iter<iterations; iter++) { 
 
+    /* inject the straggler delay just before the collective, and time the
+       collective itself, so the extra wait it absorbs can be reported     */
+    if (prk_skew_active()) {
+      local_skew += prk_skew_inject();
+      coll_start = wtime();
+    }
+
     /* Everybody sends own string to everybody else and concatenates */
     MPI_Allgather(iterstring,1,mpi_word, catstring,1,mpi_word, MPI_COMM_WORLD);
 
+    if (prk_skew_active()) local_coll += wtime() - coll_start;
+
     /* now everybody selects a different substring */
     for (i=0; i<proc_length; i++) iterstring[i]=catstring[my_ID+i*Num_procs];
 
@@ -210,10 +283,64 @@ int main(int argc, char ** argv)
              iter, catstring, checksum);
     }
 #endif
+
+    /* apply the selected additional synchronization engine                */
+    switch (sync_type) {
+    case SYNC_NONE:
+      break;
+    case SYNC_BARRIER:
+      MPI_Barrier(MPI_COMM_WORLD);
+      break;
+    case SYNC_IALLREDUCE:
+      {
+        /* all ranks contribute the iteration number; the sum doubles as a
+           cheap sanity check that nobody is a phase behind               */
+        int phase_in = iter, phase_out;
+        MPI_Request req;
+        MPI_Iallreduce(&phase_in, &phase_out, 1, MPI_INT, MPI_SUM,
+                       MPI_COMM_WORLD, &req);
+        MPI_Wait(&req, MPI_STATUS_IGNORE);
+        if (phase_out != iter*Num_procs) phase_error++;
+      }
+      break;
+    case SYNC_DISSEMINATION:
+      for (round=1; round<Num_procs; round<<=1) {
+        int to   = (my_ID+round)%Num_procs;
+        int from = (my_ID-round+Num_procs)%Num_procs;
+        MPI_Sendrecv(NULL, 0, MPI_CHAR, to,   round,
+                     NULL, 0, MPI_CHAR, from, round,
+                     MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+      }
+      break;
+    case SYNC_RMA:
+      {
+        const int one = 1;
+        for (k=0, round=1; round<Num_procs; round<<=1, k++) {
+          int to = (my_ID+round)%Num_procs;
+          MPI_Accumulate(&one, 1, MPI_INT, to, k, 1, MPI_INT, MPI_SUM, rma_win);
+          MPI_Win_flush(to, rma_win);
+          do {
+            MPI_Win_sync(rma_win);
+          } while (rma_flags[k] < iter+1);
+        }
+      }
+      break;
+    }
   }
 
   stopngo_time = wtime() - stopngo_time;
 
+  if (sync_type == SYNC_RMA) {
+    MPI_Win_unlock_all(rma_win);
+    MPI_Win_free(&rma_win);
+  }
+
+  if (phase_error) {
+    printf("ERROR: rank %d saw %d phase counter mismatches\n", my_ID, phase_error);
+    error = 1;
+  }
+  bail_out(error);
+
   /* compute checksum on obtained result, adding all digits in the string */
   if (my_ID==0) {
     basesum=0;
@@ -226,10 +353,30 @@ int main(int argc, char ** argv)
     else {
       printf("Solution validates\n");
     }
-    printf("Rate (synch/s): %lf, time (s): %lf\n", 
+    printf("Rate (synch/s): %lf, time (s): %lf\n",
            (iterations/stopngo_time), stopngo_time);
   }
 
+  /* report how much of the injected imbalance the allgather absorbed; the
+     least-delayed rank waits longest in the collective, so the spread of
+     the per-rank collective times above their minimum is the absorbed skew */
+  if (prk_skew_active()) {
+    MPI_Reduce(&local_skew, &skew_avg, 1, MPI_DOUBLE, MPI_SUM, root, MPI_COMM_WORLD);
+    MPI_Reduce(&local_skew, &skew_max, 1, MPI_DOUBLE, MPI_MAX, root, MPI_COMM_WORLD);
+    MPI_Reduce(&local_coll, &coll_avg, 1, MPI_DOUBLE, MPI_SUM, root, MPI_COMM_WORLD);
+    MPI_Reduce(&local_coll, &coll_min, 1, MPI_DOUBLE, MPI_MIN, root, MPI_COMM_WORLD);
+    MPI_Reduce(&local_coll, &coll_max, 1, MPI_DOUBLE, MPI_MAX, root, MPI_COMM_WORLD);
+    if (my_ID == root) {
+      skew_avg /= Num_procs*(double)iterations; skew_max /= (double)iterations;
+      coll_avg /= Num_procs*(double)iterations;
+      coll_min /= (double)iterations;           coll_max /= (double)iterations;
+      printf("Injected skew (s/iter): avg %lf, max %lf\n", skew_avg, skew_max);
+      printf("Collective (s/iter): min %lf, avg %lf, max %lf\n",
+             coll_min, coll_avg, coll_max);
+      printf("Skew absorption time (s/iter): %lf\n", coll_avg-coll_min);
+    }
+  }
+
   MPI_Finalize();
 
 
@@ -34,17 +34,24 @@ POSSIBILITY OF SUCH DAMAGE.
 
 NAME:    transpose
 
-PURPOSE: This program tests the efficiency with which a square matrix
+PURPOSE: This program tests the efficiency with which a matrix
          can be transposed and stored in another matrix. The matrices
          are distributed identically.
   
-USAGE:   Program inputs are the matrix order, the number of times to 
+USAGE:   Program inputs are the matrix shape, the number of times to 
          repeat the operation, and the communication mode
 
-         transpose <# iterations> <matrix order> [tile size]
+         transpose <# iterations> <rows>[x<cols>] [tile size] [pipeline slices]
 
+         A bare dimension gives the classic square transpose; 
+         <rows>x<cols> gives a rectangular one, with both dimensions 
+         divisible by the number of ranks. 
          An optional parameter specifies the tile size used to divide the 
          individual matrix blocks for improved cache and TLB performance. 
+         A second optional parameter pipelines the pairwise exchange: each
+         block is split into the indicated number of column slices, and the
+         local transpose of one slice is overlapped with communication of
+         the previous one (requires nonblocking communication).
   
          The output consists of diagnostics to make sure the 
          transpose worked and timing statistics.
@@ -69,7 +76,9 @@ HISTORY: Written by Tim Mattson, April 1999.
            produce unit stride
          - changed initialization values, such that the input matrix
            elements are: A(i,j) = i+order*j
-         
+         Updated by Rob Van der Wijngaart, with optional pipelined
+           (sliced) pairwise exchange to overlap the local transpose
+           with communication
   
 *******************************************************************/
 
@@ -79,6 +88,10 @@ HISTORY: Written by Tim Mattson, April 1999.
 
 o Each rank owns one block of columns (Colblock) of the overall
   matrix to be transposed, as well as of the transposed matrix.
+  For a rectangular rows x cols matrix the Colblock of A holds
+  cols/#ranks columns of height rows, and the Colblock of B holds
+  rows/#ranks columns of height cols; the communicated Block is
+  then rows/#ranks by cols/#ranks.
 o Colblock is stored contiguously in the memory of the rank. 
   The stored format is column major, which means that matrix
   elements (i,j) and (i+1,j) are adjacent, and (i,j) and (i,j+1)
@@ -121,21 +134,28 @@ o The original and transposed matrices are called A and B
 
 #include <par-res-kern_general.h>
 #include <par-res-kern_mpi.h>
+#include <prk_counters.h>
 
-#define A(i,j)        A_p[(i+istart)+order*(j)]
-#define B(i,j)        B_p[(i+istart)+order*(j)]
-#define Work_in(i,j)  Work_in_p[i+Block_order*(j)]
-#define Work_out(i,j) Work_out_p[i+Block_order*(j)]
+#define A(i,j)        A_p[(i+istart_A)+rows*(j)]
+#define B(i,j)        B_p[(i+istart_B)+cols*(j)]
+#define Work_in(i,j)  Work_in_p[i+Block_cols*(j)]
+#define Work_out(i,j) Work_out_p[i+Block_cols*(j)]
 
 int main(int argc, char ** argv)
 {
-  long Block_order;        /* number of columns owned by rank       */
+  long Block_rows;         /* rows of a communicated block          */
+  long Block_cols;         /* columns of a communicated block       */
   long Block_size;         /* size of a single block                */
-  long Colblock_size;      /* size of column block                  */
   int Tile_order=32;       /* default Tile order                    */
   int tiling;              /* boolean: true if tiling is used       */
+  int num_slices=1;        /* number of slices in pipelined exchange*/
+  int k;                   /* slice index                           */
+  long lo, hi,             /* column range of current slice         */
+       klo, khi;           /* column range of slice being drained   */
+  MPI_Request *send_reqs,  /* per-slice requests, pipelined exchange*/
+              *recv_reqs;
   int Num_procs;           /* number of ranks                       */
-  long order;              /* order of overall matrix               */
+  long rows, cols;         /* dimensions of overall matrix          */
   int send_to, recv_from;  /* ranks with which to communicate       */
 #if !SYNCHRONOUS
   MPI_Request send_req;
@@ -145,10 +165,11 @@ int main(int argc, char ** argv)
   int my_ID;               /* rank                                  */
   int root=0;              /* rank of root                          */
   int iterations;          /* number of times to do the transpose   */
-  int i, j, it, jt, istart;/* dummies                               */
+  long i, j, it, jt;       /* matrix indices                        */
+  long istart_A, istart_B; /* row offsets into blocks of A and B    */
   int iter;                /* index of iteration                    */
   int phase;               /* phase inside staged communication     */
-  int colstart;            /* starting column for owning rank       */
+  int colstart;            /* starting column of A for owning rank  */
   int error;               /* error flag                            */
   double * RESTRICT A_p;   /* original matrix column block          */
   double * RESTRICT B_p;   /* transposed matrix column block        */
@@ -160,6 +181,10 @@ int main(int argc, char ** argv)
   double local_trans_time, /* timing parameters                     */
          trans_time,
          avgtime;
+  int msg_profile;         /* sweep message sizes after the run and
+                              classify the communication regime      */
+  MPI_Comm comm;           /* communicator, with optional node-aware
+                              rank order                            */
 
 /*********************************************************************
 ** Initialize the MPI environment
@@ -168,6 +193,8 @@ int main(int argc, char ** argv)
   MPI_Comm_rank(MPI_COMM_WORLD, &my_ID);
   MPI_Comm_size(MPI_COMM_WORLD, &Num_procs);
 
+  msg_profile = (getenv("PRK_MSG_PROFILE") != NULL);
+
 /*********************************************************************
 ** process, test and broadcast input parameters
 *********************************************************************/
@@ -176,8 +203,8 @@ int main(int argc, char ** argv)
     printf("Parallel Research Kernels version %s\n", PRKVERSION);
     printf("MPI matrix transpose: B = A^T\n");
 
-    if (argc != 3 && argc != 4){
-      printf("Usage: %s <# iterations> <matrix order> [Tile size]\n",
+    if (argc < 3 || argc > 5){
+      printf("Usage: %s <# iterations> <rows>[x<cols>] [Tile size] [pipeline slices]\n",
                                                                *argv);
       error = 1; goto ENDOFTESTS;
     }
@@ -188,19 +215,37 @@ int main(int argc, char ** argv)
       error = 1; goto ENDOFTESTS;
     }
 
-    order = atol(*++argv);
-    if (order < Num_procs) {
-      printf("ERROR: matrix order %ld should at least # procs %d\n",
-             order, Num_procs);
+    /* a bare dimension is a square matrix, <rows>x<cols> a rectangular one */
+    char *xpos = strchr(*++argv, 'x');
+    rows = atol(*argv);
+    cols = (xpos != NULL) ? atol(xpos+1) : rows;
+    if (rows < Num_procs || cols < Num_procs) {
+      printf("ERROR: matrix dimensions %ldx%ld should be at least # procs %d\n",
+             rows, cols, Num_procs);
       error = 1; goto ENDOFTESTS;
     }
-    if (order%Num_procs) {
-      printf("ERROR: matrix order %ld should be divisible by # procs %d\n",
-             order, Num_procs);
+    if (rows%Num_procs || cols%Num_procs) {
+      printf("ERROR: matrix dimensions %ldx%ld should be divisible by # procs %d\n",
+             rows, cols, Num_procs);
       error = 1; goto ENDOFTESTS;
     }
 
-    if (argc == 4) Tile_order = atoi(*++argv);
+    if (argc >= 4) Tile_order = atoi(*++argv);
+
+    if (argc == 5) {
+      num_slices = atoi(*++argv);
+      if (num_slices < 1 || num_slices > rows/Num_procs) {
+        printf("ERROR: pipeline slices must be between 1 and block rows %ld: %d\n",
+               rows/Num_procs, num_slices);
+        error = 1; goto ENDOFTESTS;
+      }
+#if SYNCHRONOUS
+      if (num_slices > 1) {
+        printf("ERROR: pipelined exchange requires nonblocking communication\n");
+        error = 1; goto ENDOFTESTS;
+      }
+#endif
+    }
 
     ENDOFTESTS:;
   }
@@ -208,49 +253,87 @@ int main(int argc, char ** argv)
 
   if (my_ID == root) {
     printf("Number of ranks      = %d\n", Num_procs);
-    printf("Matrix order         = %ld\n", order);
+    printf("Matrix shape         = %ldx%ld\n", rows, cols);
     printf("Number of iterations = %d\n", iterations);
-    if ((Tile_order > 0) && (Tile_order < order))
+    if ((Tile_order > 0) && (Tile_order < MAX(rows,cols)))
           printf("Tile size            = %d\n", Tile_order);
     else  printf("Untiled\n");
 #if !SYNCHRONOUS
     printf("Non-");
 #endif
     printf("Blocking messages\n");
+    if (num_slices > 1)
+      printf("Pipeline slices      = %d\n", num_slices);
+    if (msg_profile) {
+      if (Num_procs > 1)
+        printf("Message profiling    = enabled\n");
+      else
+        printf("Message profiling needs more than one rank; disabled\n");
+    }
   }
 
   /*  Broadcast input data to all ranks */
-  MPI_Bcast(&order,      1, MPI_LONG, root, MPI_COMM_WORLD);
+  MPI_Bcast(&rows,       1, MPI_LONG, root, MPI_COMM_WORLD);
+  MPI_Bcast(&cols,       1, MPI_LONG, root, MPI_COMM_WORLD);
   MPI_Bcast(&iterations, 1, MPI_INT,  root, MPI_COMM_WORLD);
   MPI_Bcast(&Tile_order, 1, MPI_INT,  root, MPI_COMM_WORLD);
+  MPI_Bcast(&num_slices, 1, MPI_INT,  root, MPI_COMM_WORLD);
+
+  /* optionally renumber ranks so consecutive ranks share a node; all
+     further communication uses the resulting communicator           */
+  comm = prk_node_aware_comm(MPI_COMM_WORLD, Num_procs, 1);
+  MPI_Comm_rank(comm, &my_ID);
+
+  /* every rank exchanges a block with every other rank, so the number
+     of off-node partners is Num_procs minus the node population; it
+     is reported to put measured rates in context                    */
+  if (Num_procs > 1) {
+    int *nbrs = (int *) prk_malloc((Num_procs-1)*sizeof(int));
+    int num_nbrs=0, offnode, total_offnode, total_links;
+    if (!nbrs) {
+      printf(" Error allocating space for partner list on node %d\n",my_ID);
+      error = 1;
+    }
+    bail_out(error);
+    for (i=0; i<Num_procs; i++) if (i != my_ID) nbrs[num_nbrs++] = i;
+    offnode = prk_count_offnode(comm, nbrs, num_nbrs);
+    prk_free(nbrs);
+    MPI_Reduce(&offnode,  &total_offnode, 1, MPI_INT, MPI_SUM, root, comm);
+    MPI_Reduce(&num_nbrs, &total_links,   1, MPI_INT, MPI_SUM, root, comm);
+    if (my_ID == root) {
+      if (getenv("PRK_TOPOLOGY_REMAP"))
+        printf("Rank remapping       = node aware\n");
+      printf("Off-node partners    = %d of %d\n", total_offnode, total_links);
+    }
+  }
 
   /* a non-positive tile size means no tiling of the local transpose */
-  tiling = (Tile_order > 0) && (Tile_order < order);
-  bytes = 2 * sizeof(double) * order * order;
+  tiling = (Tile_order > 0) && (Tile_order < MAX(rows,cols));
+  bytes = 2 * sizeof(double) * rows * cols;
 
 /*********************************************************************
 ** The matrix is broken up into column blocks that are mapped one to a
-** rank.  Each column block is made up of Num_procs smaller square
-** blocks of order block_order.
+** rank.  Each column block is made up of Num_procs smaller
+** blocks of Block_rows by Block_cols.
 *********************************************************************/
 
-  Block_order    = order/Num_procs;
-  colstart       = Block_order * my_ID;
-  Colblock_size  = order * Block_order;
-  Block_size     = Block_order * Block_order;
+  Block_rows     = rows/Num_procs;
+  Block_cols     = cols/Num_procs;
+  colstart       = Block_cols * my_ID;
+  Block_size     = Block_rows * Block_cols;
 
 /*********************************************************************
 ** Create the column block of the test matrix, the row block of the
 ** transposed matrix, and workspace (workspace only if #procs>1)
 *********************************************************************/
-  A_p = (double *)prk_malloc(Colblock_size*sizeof(double));
+  A_p = (double *)prk_malloc(rows*Block_cols*sizeof(double));
   if (A_p == NULL){
     printf(" Error allocating space for original matrix on node %d\n",my_ID);
     error = 1;
   }
   bail_out(error);
 
-  B_p = (double *)prk_malloc(Colblock_size*sizeof(double));
+  B_p = (double *)prk_malloc(cols*Block_rows*sizeof(double));
   if (B_p == NULL){
     printf(" Error allocating space for transpose matrix on node %d\n",my_ID);
     error = 1;
@@ -265,13 +348,26 @@ int main(int argc, char ** argv)
     }
     bail_out(error);
     Work_out_p = Work_in_p + Block_size;
+
+    if (num_slices > 1) {
+      send_reqs = (MPI_Request *)prk_malloc(2*num_slices*sizeof(MPI_Request));
+      if (send_reqs == NULL){
+        printf(" Error allocating space for requests on node %d\n",my_ID);
+        error = 1;
+      }
+      bail_out(error);
+      recv_reqs = send_reqs + num_slices;
+    }
   }
 
   /* Fill the original column matrix                                                */
-  istart = 0;
-  for (j=0;j<Block_order;j++)
-    for (i=0;i<order; i++)  {
-      A(i,j) = (double) (order*(j+colstart) + i);
+  istart_A = istart_B = 0;
+  for (j=0;j<Block_cols;j++)
+    for (i=0;i<rows; i++)  {
+      A(i,j) = (double) (rows*(j+colstart) + i);
+  }
+  for (j=0;j<Block_rows;j++)
+    for (i=0;i<cols; i++)  {
       B(i,j) = 0.0;
   }
 
@@ -279,24 +375,26 @@ int main(int argc, char ** argv)
 
     /* start timer after a warmup iteration                                        */
     if (iter == 1) {
-      MPI_Barrier(MPI_COMM_WORLD);
+      MPI_Barrier(comm);
+      prk_counters_start();
       local_trans_time = wtime();
     }
 
     /* do the local transpose                                                     */
-    istart = colstart;
+    istart_A = my_ID*Block_rows;
+    istart_B = my_ID*Block_cols;
     if (!tiling) {
-      for (i=0; i<Block_order; i++)
-        for (j=0; j<Block_order; j++) {
+      for (i=0; i<Block_rows; i++)
+        for (j=0; j<Block_cols; j++) {
           B(j,i) += A(i,j);
           A(i,j) += 1.0;
 	}
     }
     else {
-      for (i=0; i<Block_order; i+=Tile_order)
-        for (j=0; j<Block_order; j+=Tile_order)
-          for (it=i; it<MIN(Block_order,i+Tile_order); it++)
-            for (jt=j; jt<MIN(Block_order,j+Tile_order);jt++) {
+      for (i=0; i<Block_rows; i+=Tile_order)
+        for (j=0; j<Block_cols; j+=Tile_order)
+          for (it=i; it<MIN(Block_rows,i+Tile_order); it++)
+            for (jt=j; jt<MIN(Block_cols,j+Tile_order);jt++) {
               B(jt,it) += A(it,jt);
               A(it,jt) += 1.0;
 	    }
@@ -307,23 +405,79 @@ int main(int argc, char ** argv)
       send_to   = (my_ID - phase + Num_procs)%Num_procs;
 
 #if !SYNCHRONOUS
+      if (num_slices > 1) {
+
+      /* pipelined exchange: while slice k is on the wire, transpose slice
+         k+1 of the outgoing block and scatter slice k-1 of the incoming one */
+      for (k=0; k<num_slices; k++) {
+        lo = ((long)k*Block_rows)/num_slices;
+        hi = ((long)(k+1)*Block_rows)/num_slices;
+        MPI_Irecv(Work_in_p+Block_cols*lo, Block_cols*(hi-lo), MPI_DOUBLE,
+                  recv_from, phase, comm, &recv_reqs[k]);
+      }
+
+      for (k=0; k<num_slices; k++) {
+        lo = ((long)k*Block_rows)/num_slices;
+        hi = ((long)(k+1)*Block_rows)/num_slices;
+
+        istart_A = send_to*Block_rows;
+        if (!tiling) {
+          for (i=lo; i<hi; i++)
+            for (j=0; j<Block_cols; j++){
+              Work_out(j,i) = A(i,j);
+              A(i,j) += 1.0;
+            }
+        }
+        else {
+          for (i=lo; i<hi; i+=Tile_order)
+            for (j=0; j<Block_cols; j+=Tile_order)
+              for (it=i; it<MIN(hi,i+Tile_order); it++)
+                for (jt=j; jt<MIN(Block_cols,j+Tile_order);jt++) {
+                  Work_out(jt,it) = A(it,jt);
+                  A(it,jt) += 1.0;
+                }
+        }
+        MPI_Isend(Work_out_p+Block_cols*lo, Block_cols*(hi-lo), MPI_DOUBLE,
+                  send_to, phase, comm, &send_reqs[k]);
+
+        if (k > 0) {
+          klo = ((long)(k-1)*Block_rows)/num_slices;
+          khi = ((long)k*Block_rows)/num_slices;
+          MPI_Wait(&recv_reqs[k-1], MPI_STATUS_IGNORE);
+          istart_B = recv_from*Block_cols;
+          for (j=klo; j<khi; j++)
+            for (i=0; i<Block_cols; i++)
+              B(i,j) += Work_in(i,j);
+        }
+      }
+      klo = ((long)(num_slices-1)*Block_rows)/num_slices;
+      MPI_Wait(&recv_reqs[num_slices-1], MPI_STATUS_IGNORE);
+      istart_B = recv_from*Block_cols;
+      for (j=klo; j<Block_rows; j++)
+        for (i=0; i<Block_cols; i++)
+          B(i,j) += Work_in(i,j);
+      MPI_Waitall(num_slices, send_reqs, MPI_STATUSES_IGNORE);
+
+      continue;
+      }
+
       MPI_Irecv(Work_in_p, Block_size, MPI_DOUBLE,
-                recv_from, phase, MPI_COMM_WORLD, &recv_req);
+                recv_from, phase, comm, &recv_req);
 #endif
 
-      istart = send_to*Block_order;
+      istart_A = send_to*Block_rows;
       if (!tiling) {
-        for (i=0; i<Block_order; i++)
-          for (j=0; j<Block_order; j++){
+        for (i=0; i<Block_rows; i++)
+          for (j=0; j<Block_cols; j++){
 	    Work_out(j,i) = A(i,j);
             A(i,j) += 1.0;
 	  }
       }
       else {
-        for (i=0; i<Block_order; i+=Tile_order)
-          for (j=0; j<Block_order; j+=Tile_order)
-            for (it=i; it<MIN(Block_order,i+Tile_order); it++)
-              for (jt=j; jt<MIN(Block_order,j+Tile_order);jt++) {
+        for (i=0; i<Block_rows; i+=Tile_order)
+          for (j=0; j<Block_cols; j+=Tile_order)
+            for (it=i; it<MIN(Block_rows,i+Tile_order); it++)
+              for (jt=j; jt<MIN(Block_cols,j+Tile_order);jt++) {
                 Work_out(jt,it) = A(it,jt);
                 A(it,jt) += 1.0;
 	      }
@@ -331,54 +485,123 @@ int main(int argc, char ** argv)
 
 #if !SYNCHRONOUS
       MPI_Isend(Work_out_p, Block_size, MPI_DOUBLE, send_to,
-                phase, MPI_COMM_WORLD, &send_req);
+                phase, comm, &send_req);
       MPI_Wait(&recv_req, MPI_STATUS_IGNORE);
       MPI_Wait(&send_req, MPI_STATUS_IGNORE);
 #else
       MPI_Sendrecv(Work_out_p, Block_size, MPI_DOUBLE, send_to, phase,
                    Work_in_p, Block_size, MPI_DOUBLE,
-	           recv_from, phase, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+	           recv_from, phase, comm, MPI_STATUS_IGNORE);
 #endif
 
-      istart = recv_from*Block_order;
+      istart_B = recv_from*Block_cols;
       /* scatter received block to transposed matrix; no need to tile */
-      for (j=0; j<Block_order; j++)
-        for (i=0; i<Block_order; i++)
+      for (j=0; j<Block_rows; j++)
+        for (i=0; i<Block_cols; i++)
           B(i,j) += Work_in(i,j);
 
     }  /* end of phase loop  */
   } /* end of iterations */
 
   local_trans_time = wtime() - local_trans_time;
+  prk_counters_stop();
   MPI_Reduce(&local_trans_time, &trans_time, 1, MPI_DOUBLE, MPI_MAX, root,
-             MPI_COMM_WORLD);
-
-  abserr = 0.0;
-  istart = 0;
+             comm);
+  prk_report_rank_stats(local_trans_time, comm);
+
+  /* all updates are exact in double, so the sum of B is as well; each rank
+     sums its own block and the root compares the total against the
+     closed-form value, instead of building the per-element reference         */
+  long double local_sum = 0.0, total_sum, reference;
+  istart_B = 0;
   double addit = ((double)(iterations+1) * (double) (iterations))/2.0;
-  for (j=0;j<Block_order;j++) for (i=0;i<order; i++) {
-      abserr += ABS(B(i,j) - (double)((order*i + j+colstart)*(iterations+1)+addit));
+  for (j=0;j<Block_rows;j++) for (i=0;i<cols; i++) {
+      local_sum += B(i,j);
   }
 
-  MPI_Reduce(&abserr, &abserr_tot, 1, MPI_DOUBLE, MPI_SUM, root, MPI_COMM_WORLD);
+  MPI_Reduce(&local_sum, &total_sum, 1, MPI_LONG_DOUBLE, MPI_SUM, root, comm);
 
   if (my_ID == root) {
+    long double n2 = (long double)rows * (long double)cols;
+    reference = (n2-1.0L)*n2/2.0L*(long double)(iterations+1)
+              + n2*(long double)addit;
+    abserr_tot = (double)(ABS(total_sum-reference)/reference);
     if (abserr_tot < epsilon) {
       printf("Solution validates\n");
       avgtime = trans_time/(double)iterations;
       printf("Rate (MB/s): %lf Avg time (s): %lf\n",1.0E-06*bytes/avgtime, avgtime);
+      prk_counters_report(iterations);
 #if VERBOSE
-      printf("Summed errors: %f \n", abserr);
+      printf("Checksum = %Lf; reference = %Lf\n", total_sum, reference);
 #endif
     }
     else {
-      printf("ERROR: Aggregate squared error %lf exceeds threshold %e\n", abserr, epsilon);
+      printf("ERROR: Relative checksum error %lf exceeds threshold %e\n",
+             abserr_tot, epsilon);
       error = 1;
     }
   }
 
   bail_out(error);
 
+  /* optional message-size/time profile: replay the transpose's own
+     all-to-all rotation at a range of message sizes bracketing the one
+     this run used, so the output distinguishes the latency-bound regime
+     (small orders at high rank counts) from the bandwidth-bound one.
+     The time per message at the smallest size is the effective latency;
+     its share of the time per message at the run's size classifies the
+     regime                                                              */
+  if (msg_profile && Num_procs > 1) {
+    long   prof_sizes[16];
+    double prof_tpm[16];
+    int    num_prof = 0;
+    int    reps = 50;
+    long   msg_elems = MAX(Block_size/num_slices, 1);
+
+    for (long s=1; s<msg_elems && num_prof<15; s*=16) prof_sizes[num_prof++] = s;
+    prof_sizes[num_prof++] = msg_elems;
+
+    for (int ps=0; ps<num_prof; ps++) {
+      double t, t_max;
+      MPI_Barrier(comm);
+      t = wtime();
+      for (int rep=0; rep<reps; rep++) {
+        for (phase=1; phase<Num_procs; phase++) {
+          MPI_Request rq, sq;
+          recv_from = (my_ID + phase            )%Num_procs;
+          send_to   = (my_ID - phase + Num_procs)%Num_procs;
+          MPI_Irecv(Work_in_p,  prof_sizes[ps], MPI_DOUBLE, recv_from, phase,
+                    comm, &rq);
+          MPI_Isend(Work_out_p, prof_sizes[ps], MPI_DOUBLE, send_to,   phase,
+                    comm, &sq);
+          MPI_Wait(&rq, MPI_STATUS_IGNORE);
+          MPI_Wait(&sq, MPI_STATUS_IGNORE);
+        }
+      }
+      t = wtime() - t;
+      MPI_Reduce(&t, &t_max, 1, MPI_DOUBLE, MPI_MAX, root, comm);
+      prof_tpm[ps] = t_max/((double)reps*(Num_procs-1));
+    }
+
+    if (my_ID == root) {
+      double latency = prof_tpm[0];
+      double share   = latency/prof_tpm[num_prof-1];
+      printf("Message size/time curve (transpose rotation, %d phases/iteration):\n",
+             Num_procs-1);
+      printf("%12s %16s %14s\n", "bytes/msg", "time/msg (s)", "rate (MB/s)");
+      for (int ps=0; ps<num_prof; ps++)
+        printf("%12ld %16.3e %14.2lf\n",
+               prof_sizes[ps]*(long)sizeof(double), prof_tpm[ps],
+               1.0E-06*prof_sizes[ps]*sizeof(double)/prof_tpm[ps]);
+      printf("Message size per phase = %ld bytes", msg_elems*(long)sizeof(double));
+      if (num_slices > 1) printf(" (%d pipeline slices)", num_slices);
+      printf("\n");
+      printf("Communication regime   = %s (latency share %.0lf%% of time/message)\n",
+             (share >= 0.5) ? "latency-dominated" : "bandwidth-dominated",
+             100.0*share);
+    }
+  }
+
   MPI_Finalize();
   exit(EXIT_SUCCESS);
 
@@ -41,7 +41,13 @@ PURPOSE: This program tests the efficiency with which a space-invariant,
 USAGE:   The program takes as input the linear dimension of the grid,
          and the number of iterations on the grid
 
-               <progname> <#threads><# iterations> <grid size>
+               <progname> <#threads><# iterations> <grid size> [<halo mode>]
+
+         The optional halo mode is "funneled" (default), in which the
+         master thread exchanges the complete halo, or "multiple", in
+         which each OpenMP thread concurrently exchanges its own
+         sub-halo under MPI_THREAD_MULTIPLE, exercising the MPI
+         implementation's multi-threaded injection path.
 
          The output consists of diagnostics to make sure the
          algorithm worked, and of timing statistics.
@@ -70,6 +76,7 @@ HISTORY: - Written by Rob Van der Wijngaart, November 2006.
 
 #include <par-res-kern_general.h>
 #include <par-res-kern_mpiomp.h>
+#include <prk_trace.h>
 
 #if DOUBLE
   #define DTYPE     double
@@ -138,14 +145,25 @@ int main(int argc, char ** argv) {
   int    error=0;         /* error flag                                          */
   DTYPE  weight[2*RADIUS+1][2*RADIUS+1]; /* weights of points in the stencil     */
   MPI_Request request[8];
+  int    thread_multiple=0; /* per-thread halo exchange under THREAD_MULTIPLE    */
+  int    requested, provided; /* MPI threading levels                            */
+  double local_comm_time=0.0, /* time spent in halo exchange                     */
+         comm_time, comm_start;
 
   /*******************************************************************************
   ** Initialize the MPI environment
   ********************************************************************************/
-  MPI_Init(&argc,&argv);
+  /* the threading level must be requested before MPI_Init_thread, so peek
+     at the optional halo mode argument ahead of regular argument parsing       */
+  requested = MPI_THREAD_FUNNELED;
+  if (argc > 4 && !strcmp(argv[4], "multiple")) requested = MPI_THREAD_MULTIPLE;
+  MPI_Init_thread(&argc, &argv, requested, &provided);
   MPI_Comm_rank(MPI_COMM_WORLD, &my_ID);
   MPI_Comm_size(MPI_COMM_WORLD, &Num_procs);
 
+  /* optional phase timeline (PRK_TRACE=1) */
+  prk_trace_init(my_ID);
+
   /*******************************************************************************
   ** process, test, and broadcast input parameters
   ********************************************************************************/
@@ -160,8 +178,8 @@ int main(int argc, char ** argv) {
       goto ENDOFTESTS;
 #endif
 
-    if (argc != 4){
-      printf("Usage: %s <#threads><#iterations> <array dimension> \n",
+    if (argc != 4 && argc != 5){
+      printf("Usage: %s <#threads><#iterations> <array dimension> [<halo mode>]\n",
              *argv);
       error = 1;
       goto ENDOFTESTS;
@@ -203,6 +221,21 @@ int main(int argc, char ** argv) {
       goto ENDOFTESTS;
     }
 
+    if (argc == 5) {
+      if      (!strcmp(argv[1], "multiple")) thread_multiple = 1;
+      else if (strcmp(argv[1], "funneled")) {
+        printf("ERROR: halo mode must be funneled or multiple: %s\n", argv[1]);
+        error = 1;
+        goto ENDOFTESTS;
+      }
+    }
+
+    if (thread_multiple && provided < MPI_THREAD_MULTIPLE) {
+      printf("ERROR: MPI implementation provides no MPI_THREAD_MULTIPLE\n");
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
     ENDOFTESTS:;
   }
   bail_out(error);
@@ -222,6 +255,7 @@ int main(int argc, char ** argv) {
   MPI_Bcast(&n,             1, MPI_INT, root, MPI_COMM_WORLD);
   MPI_Bcast(&iterations,    1, MPI_INT, root, MPI_COMM_WORLD);
   MPI_Bcast(&nthread_input, 1, MPI_INT, root, MPI_COMM_WORLD);
+  MPI_Bcast(&thread_multiple,1,MPI_INT, root, MPI_COMM_WORLD);
 
   omp_set_num_threads(nthread_input);
 
@@ -232,6 +266,8 @@ int main(int argc, char ** argv) {
     printf("Radius of stencil      = %d\n", RADIUS);
     printf("Tiles in x/y-direction = %d/%d\n", Num_procsx, Num_procsy);
     printf("Type of stencil        = star\n");
+    printf("Halo exchange mode     = %s\n",
+           thread_multiple ? "multiple (per-thread)" : "funneled (master)");
 #if DOUBLE
     printf("Data type              = double precision\n");
 #else
@@ -356,6 +392,133 @@ int main(int argc, char ** argv) {
       local_stencil_time = wtime();
     }
 
+    prk_trace_begin();
+    if (iter >= 1) comm_start = wtime();
+
+    if (thread_multiple) {
+
+    /* each thread exchanges the sub-halo of its own chunk of the tile,
+       with the thread index folded into the tag so that concurrent
+       messages between the same rank pair match up; top/bottom (resp.
+       left/right) neighbors share the same tile width (resp. height),
+       so the chunk decomposition agrees on both sides of each exchange */
+    #pragma omp parallel
+    {
+      int tid = omp_get_thread_num();
+      int nt  = omp_get_num_threads();
+      int ti, tj, tkk, chunk, excess, toff, tcount;
+      int tistart, tiend, tjstart, tjend;
+      MPI_Request treq[8];
+
+      /* columns of the tile assigned to this thread (y-direction)              */
+      chunk  = width/nt;
+      excess = width%nt;
+      if (tid < excess) {
+        tistart = istart + (chunk+1)*tid;
+        tiend   = tistart + chunk;
+      }
+      else {
+        tistart = istart + (chunk+1)*excess + chunk*(tid-excess);
+        tiend   = tistart + chunk - 1;
+      }
+
+      if (tiend >= tistart) {
+        toff   = RADIUS*(tistart-istart);
+        tcount = RADIUS*(tiend-tistart+1);
+        if (my_IDy < Num_procsy-1) {
+          MPI_Irecv(top_buf_in+toff, tcount, MPI_DTYPE, top_nbr, 4*tid+1,
+                    MPI_COMM_WORLD, &(treq[1]));
+          tkk = toff;
+          for (tj=jend-RADIUS+1; tj<=jend; tj++) for (ti=tistart; ti<=tiend; ti++) {
+              top_buf_out[tkk++] = IN(ti,tj);
+          }
+          MPI_Isend(top_buf_out+toff, tcount, MPI_DTYPE, top_nbr, 4*tid+0,
+                    MPI_COMM_WORLD, &(treq[0]));
+        }
+        if (my_IDy > 0) {
+          MPI_Irecv(bottom_buf_in+toff, tcount, MPI_DTYPE, bottom_nbr, 4*tid+0,
+                    MPI_COMM_WORLD, &(treq[3]));
+          tkk = toff;
+          for (tj=jstart; tj<=jstart+RADIUS-1; tj++) for (ti=tistart; ti<=tiend; ti++) {
+              bottom_buf_out[tkk++] = IN(ti,tj);
+          }
+          MPI_Isend(bottom_buf_out+toff, tcount, MPI_DTYPE, bottom_nbr, 4*tid+1,
+                    MPI_COMM_WORLD, &(treq[2]));
+        }
+        if (my_IDy < Num_procsy-1) {
+          MPI_Wait(&(treq[0]), MPI_STATUS_IGNORE);
+          MPI_Wait(&(treq[1]), MPI_STATUS_IGNORE);
+          tkk = toff;
+          for (tj=jend+1; tj<=jend+RADIUS; tj++) for (ti=tistart; ti<=tiend; ti++) {
+              IN(ti,tj) = top_buf_in[tkk++];
+          }
+        }
+        if (my_IDy > 0) {
+          MPI_Wait(&(treq[2]), MPI_STATUS_IGNORE);
+          MPI_Wait(&(treq[3]), MPI_STATUS_IGNORE);
+          tkk = toff;
+          for (tj=jstart-RADIUS; tj<=jstart-1; tj++) for (ti=tistart; ti<=tiend; ti++) {
+              IN(ti,tj) = bottom_buf_in[tkk++];
+          }
+        }
+      }
+
+      /* rows of the tile assigned to this thread (x-direction)                 */
+      chunk  = height/nt;
+      excess = height%nt;
+      if (tid < excess) {
+        tjstart = jstart + (chunk+1)*tid;
+        tjend   = tjstart + chunk;
+      }
+      else {
+        tjstart = jstart + (chunk+1)*excess + chunk*(tid-excess);
+        tjend   = tjstart + chunk - 1;
+      }
+
+      if (tjend >= tjstart) {
+        toff   = RADIUS*(tjstart-jstart);
+        tcount = RADIUS*(tjend-tjstart+1);
+        if (my_IDx < Num_procsx-1) {
+          MPI_Irecv(right_buf_in+toff, tcount, MPI_DTYPE, right_nbr, 4*tid+3,
+                    MPI_COMM_WORLD, &(treq[5]));
+          tkk = toff;
+          for (tj=tjstart; tj<=tjend; tj++) for (ti=iend-RADIUS+1; ti<=iend; ti++) {
+              right_buf_out[tkk++] = IN(ti,tj);
+          }
+          MPI_Isend(right_buf_out+toff, tcount, MPI_DTYPE, right_nbr, 4*tid+2,
+                    MPI_COMM_WORLD, &(treq[4]));
+        }
+        if (my_IDx > 0) {
+          MPI_Irecv(left_buf_in+toff, tcount, MPI_DTYPE, left_nbr, 4*tid+2,
+                    MPI_COMM_WORLD, &(treq[7]));
+          tkk = toff;
+          for (tj=tjstart; tj<=tjend; tj++) for (ti=istart; ti<=istart+RADIUS-1; ti++) {
+              left_buf_out[tkk++] = IN(ti,tj);
+          }
+          MPI_Isend(left_buf_out+toff, tcount, MPI_DTYPE, left_nbr, 4*tid+3,
+                    MPI_COMM_WORLD, &(treq[6]));
+        }
+        if (my_IDx < Num_procsx-1) {
+          MPI_Wait(&(treq[4]), MPI_STATUS_IGNORE);
+          MPI_Wait(&(treq[5]), MPI_STATUS_IGNORE);
+          tkk = toff;
+          for (tj=tjstart; tj<=tjend; tj++) for (ti=iend+1; ti<=iend+RADIUS; ti++) {
+              IN(ti,tj) = right_buf_in[tkk++];
+          }
+        }
+        if (my_IDx > 0) {
+          MPI_Wait(&(treq[6]), MPI_STATUS_IGNORE);
+          MPI_Wait(&(treq[7]), MPI_STATUS_IGNORE);
+          tkk = toff;
+          for (tj=tjstart; tj<=tjend; tj++) for (ti=istart-RADIUS; ti<=istart-1; ti++) {
+              IN(ti,tj) = left_buf_in[tkk++];
+          }
+        }
+      }
+    }
+
+    } else {
+
     /* need to fetch ghost point data from neighbors in y-direction                 */
     if (my_IDy < Num_procsy-1) {
       MPI_Irecv(top_buf_in, RADIUS*width, MPI_DTYPE, top_nbr, 101,
@@ -424,7 +587,13 @@ int main(int argc, char ** argv) {
       }
     }
 
+    }
+
+    if (iter >= 1) local_comm_time += wtime() - comm_start;
+    prk_trace_end("halo exchange");
+
     /* Apply the stencil operator */
+    prk_trace_begin();
     #pragma omp parallel for  private (i, j, ii, jj)
     for (j=MAX(jstart,RADIUS); j<=MIN(n-RADIUS-1,jend); j++) {
       for (i=MAX(istart,RADIUS); i<=MIN(n-RADIUS-1,iend); i++) {
@@ -438,15 +607,21 @@ int main(int argc, char ** argv) {
       }
     }
 
+    prk_trace_end("stencil sweep");
+
+    prk_trace_begin();
     #pragma omp parallel for private (i)
     /* add constant to solution to force refresh of neighbor data, if any */
     for (j=jstart; j<=jend; j++) for (i=istart; i<=iend; i++) IN(i,j)+= 1.0;
+    prk_trace_end("input update");
 
   }
 
   local_stencil_time = wtime() - local_stencil_time;
   MPI_Reduce(&local_stencil_time, &stencil_time, 1, MPI_DOUBLE, MPI_MAX, root,
              MPI_COMM_WORLD);
+  MPI_Reduce(&local_comm_time, &comm_time, 1, MPI_DOUBLE, MPI_MAX, root,
+             MPI_COMM_WORLD);
 
   /* compute L1 norm in parallel                                                */
   local_norm = (DTYPE) 0.0;
@@ -494,8 +669,12 @@ int main(int argc, char ** argv) {
     avgtime = stencil_time/iterations;
     printf("Rate (MFlops/s): "FSTR"  Avg time (s): %lf\n",
            1.0E-06 * flops/avgtime, avgtime);
+    printf("Halo exchange time (s): %lf (avg per iteration)\n",
+           comm_time/iterations);
   }
 
+  prk_trace_finalize();
+
   MPI_Finalize();
   exit(EXIT_SUCCESS);
 }
@@ -42,7 +42,14 @@ PURPOSE: This program tests the efficiency with which point-to-point
 USAGE:   The program takes as input the dimensions of the grid, and the
          number of times we loop over the grid
  
-               p2p <#threads> <# iterations> <m> <n>
+               p2p <#threads> <# iterations> <m> <n> [<boundary mode>]
+
+         The optional boundary mode is "p2p" (default), which sends one
+         message per grid line to the right neighbor, or "partitioned",
+         which uses MPI 4.0 partitioned communication: one send per
+         iteration with one partition per grid line, marked ready as the
+         producing thread completes that line, exercising the
+         fine-grained producer pattern the partitioned API targets.
   
          The output consists of diagnostics to make sure the 
          algorithm worked, and of timing statistics.
@@ -96,6 +103,11 @@ int main(int argc, char ** argv)
   int    Num_procs;     /* Number of ranks                                       */
   long   total_length;  /* total required length to store grid values            */
   int    provided;      /* MPI level of thread support                           */
+  int    partitioned=0; /* boundary exchange via MPI 4.0 partitioned comm        */
+  double *sbuf, *rbuf;  /* boundary buffers for partitioned mode                 */
+#if MPI_VERSION >= 4
+  MPI_Request psend_req, precv_req; /* partitioned communication requests        */
+#endif
   int    true, false;   /* toggled booleans used for synchronization             */
  
 /*********************************************************************************
@@ -126,8 +138,8 @@ int main(int argc, char ** argv)
 *********************************************************************/
  
   if (my_ID == root){
-    if (argc != 5){
-      printf("Usage: %s <#threads> <#iterations> <1st array dimension> <2nd array dimension>\n", 
+    if (argc != 5 && argc != 6){
+      printf("Usage: %s <#threads> <#iterations> <1st array dimension> <2nd array dimension> [<boundary mode>]\n", 
              *argv);
       error = 1;
       goto ENDOFTESTS;
@@ -162,6 +174,29 @@ int main(int argc, char ** argv)
       error = 1;
       goto ENDOFTESTS;
     }
+
+    if (argc == 6) {
+      if      (!strcmp(argv[1], "partitioned")) partitioned = 1;
+      else if (strcmp(argv[1], "p2p")) {
+        printf("ERROR: boundary mode must be p2p or partitioned: %s\n", argv[1]);
+        error = 1;
+        goto ENDOFTESTS;
+      }
+    }
+
+    if (partitioned && n < 2) {
+      printf("ERROR: partitioned mode requires second dimension > 1\n");
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+#if MPI_VERSION < 4
+    if (partitioned) {
+      printf("ERROR: partitioned mode requires an MPI 4.0 library\n");
+      error = 1;
+      goto ENDOFTESTS;
+    }
+#endif
  
     ENDOFTESTS:;
   }
@@ -172,6 +207,7 @@ int main(int argc, char ** argv)
   MPI_Bcast(&n,          1, MPI_LONG, root, MPI_COMM_WORLD);
   MPI_Bcast(&iterations, 1, MPI_INT, root, MPI_COMM_WORLD);
   MPI_Bcast(&nthread,    1, MPI_INT, root, MPI_COMM_WORLD);
+  MPI_Bcast(&partitioned,1, MPI_INT, root, MPI_COMM_WORLD);
  
   omp_set_num_threads(nthread);
  
@@ -180,6 +216,8 @@ int main(int argc, char ** argv)
     printf("Number of threads              = %d\n", omp_get_max_threads());
     printf("Grid sizes                     = %ld, %ld\n", m, n);
     printf("Number of iterations           = %d\n", iterations);
+    printf("Boundary exchange              = %s\n",
+           partitioned ? "partitioned (MPI 4.0)" : "send/receive per line");
 #if SYNCHRONOUS
     printf("Handshake between neighbor threads\n");
 #else
@@ -235,6 +273,25 @@ int main(int argc, char ** argv)
     printf("ERROR: Could not allocate space for synchronization flags\n");
     exit(EXIT_FAILURE);
   }  
+
+#if MPI_VERSION >= 4
+  /* one partitioned send/receive per iteration covering the whole boundary
+     column, with one single-element partition per grid line                      */
+  if (partitioned) {
+    sbuf = (double *) prk_malloc(2*sizeof(double)*(n-1));
+    if (!sbuf) {
+      printf("ERROR: Could not allocate space for boundary buffers\n");
+      exit(EXIT_FAILURE);
+    }
+    rbuf = sbuf + (n-1);
+    if (my_ID < Num_procs-1)
+      MPI_Psend_init(sbuf, (int)(n-1), 1, MPI_DOUBLE, my_ID+1, 77,
+                     MPI_COMM_WORLD, MPI_INFO_NULL, &psend_req);
+    if (my_ID > 0)
+      MPI_Precv_init(rbuf, (int)(n-1), 1, MPI_DOUBLE, my_ID-1, 77,
+                     MPI_COMM_WORLD, MPI_INFO_NULL, &precv_req);
+  }
+#endif
  
 #pragma omp parallel private(i, j, iter, true, false)
   {
@@ -293,6 +350,18 @@ int main(int argc, char ** argv)
       }
     }
 
+#if MPI_VERSION >= 4
+    if (partitioned) {
+      /* all partitions must be re-armed before any thread marks one ready       */
+      #pragma omp barrier
+      if (TID==0) {
+        if (my_ID > 0)           MPI_Start(&precv_req);
+        if (my_ID < Num_procs-1) MPI_Start(&psend_req);
+      }
+      #pragma omp barrier
+    }
+#endif
+
     if ((Num_procs==1) && (TID==0)) { /* first thread waits for corner value       */
       while (flag(0,0) == true) {
         #pragma omp flush
@@ -310,6 +379,14 @@ int main(int argc, char ** argv)
          send data                                                                */
       if (TID==0){
         if (my_ID > 0) {
+#if MPI_VERSION >= 4
+          if (partitioned) {
+            int arrived = 0;
+            while (!arrived) MPI_Parrived(precv_req, j-1, &arrived);
+            ARRAY(start-1,j) = rbuf[j-1];
+          }
+          else
+#endif
           MPI_Recv(&(ARRAY(start-1,j)), 1, MPI_DOUBLE, my_ID-1, j, 
                      MPI_COMM_WORLD, MPI_STATUS_IGNORE);
         }
@@ -340,10 +417,28 @@ int main(int argc, char ** argv)
       }
       else { /* if not on the right boundary, send data to my right neighbor      */  
         if (my_ID < Num_procs-1) {
+#if MPI_VERSION >= 4
+          if (partitioned) {
+            sbuf[j-1] = ARRAY(end,j);
+            MPI_Pready(j-1, psend_req);
+          }
+          else
+#endif
           MPI_Send(&(ARRAY(end,j)), 1, MPI_DOUBLE, my_ID+1, j, MPI_COMM_WORLD);
         }
       }
     }
+
+#if MPI_VERSION >= 4
+    if (partitioned) {
+      /* complete the boundary exchange before re-arming it next iteration       */
+      #pragma omp barrier
+      if (TID==0) {
+        if (my_ID > 0)           MPI_Wait(&precv_req, MPI_STATUS_IGNORE);
+        if (my_ID < Num_procs-1) MPI_Wait(&psend_req, MPI_STATUS_IGNORE);
+      }
+    }
+#endif
  
     /* copy top right corner value to bottom left corner to create dependency     */
     if (Num_procs>1) {
@@ -0,0 +1,273 @@
+/*
+Copyright (c) 2013-2017, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+* Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*******************************************************************
+
+NAME:    RefCount
+
+PURPOSE: This program tests the efficiency of exclusive access to
+         reference counters that are shared across ranks.  Updates
+         are carried out with MPI_Fetch_and_op on an RMA window, so
+         the cost of a remote atomic update - including cross-node
+         contention on the fabric - becomes a measured quantity.
+
+USAGE:   The program takes as input the number of counter updates
+         per active rank, the number of ranks that perform updates,
+         and the number of counters:
+
+               <progname> <# iterations> <# active ranks> <# counters>
+
+         One counter makes every active rank hammer the same memory
+         location; more counters stripe the updates round-robin over
+         locations hosted by all ranks, diluting the contention.
+
+         The output consists of diagnostics to make sure the
+         algorithm worked, of timing statistics, and of the per-op
+         latency distribution over all timed updates.
+
+FUNCTIONS CALLED:
+
+         Other than MPI or standard C functions, the following
+         functions are used in this program:
+
+         wtime()
+         bail_out()
+
+HISTORY: Written by Rob Van der Wijngaart, January 2006.
+         MPI RMA version, August 2026.
+
+*******************************************************************/
+
+#include <par-res-kern_general.h>
+#include <par-res-kern_mpi.h>
+
+static int compare_doubles(const void *a, const void *b)
+{
+  const double da = *(const double *)a;
+  const double db = *(const double *)b;
+  return (da > db) - (da < db);
+}
+
+int main(int argc, char ** argv)
+{
+  int      my_ID;           /* rank                                           */
+  int      root=0;          /* ID of root rank                                */
+  int      Num_procs;       /* number of ranks                                */
+  int      iterations;      /* number of counter updates per active rank      */
+  int      active_ranks;    /* number of ranks that perform updates           */
+  long     num_counters;    /* number of counters in the window               */
+  long     counters_local;  /* counters hosted by the calling rank            */
+  long     counter;         /* global index of target counter                 */
+  int      target;          /* rank hosting the target counter                */
+  MPI_Aint disp;            /* displacement of target counter in its window   */
+  long     *counter_space;  /* local window memory                            */
+  long     one=1, dummy;    /* update operand and fetched value               */
+  double   *latency;        /* per-op latencies of the calling rank           */
+  double   *all_latency;    /* gathered latencies (root only)                 */
+  int      *counts, *displs;/* gather bookkeeping (root only)                 */
+  long     total_updates;   /* verification value                             */
+  long     local_sum, sum;  /* counter sums for verification                  */
+  double   local_time, refcount_time, op_time; /* timing parameters           */
+  int      i, iter;         /* dummies                                        */
+  int      nsamples;        /* total number of gathered latency samples       */
+  int      error=0;         /* error flag                                     */
+  MPI_Info rma_winfo;       /* info for window                                */
+  MPI_Win  rma_win;         /* RMA window object                              */
+
+/*********************************************************************************
+** Initialize the MPI environment
+**********************************************************************************/
+  MPI_Init(&argc,&argv);
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_ID);
+  MPI_Comm_size(MPI_COMM_WORLD, &Num_procs);
+
+/*********************************************************************
+** process, test and broadcast input parameters
+*********************************************************************/
+
+  if (my_ID == root){
+    printf("Parallel Research Kernels version %s\n", PRKVERSION);
+    printf("MPIRMA atomic reference counter update\n");
+
+    if (argc != 4){
+      printf("Usage: %s <# iterations> <# active ranks> <# counters>\n", *argv);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    iterations = atoi(*++argv);
+    if (iterations < 1){
+      printf("ERROR: iterations must be >= 1 : %d \n",iterations);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    active_ranks = atoi(*++argv);
+    if (active_ranks < 1 || active_ranks > Num_procs){
+      printf("ERROR: number of active ranks must be between 1 and %d: %d\n",
+             Num_procs, active_ranks);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    num_counters = atol(*++argv);
+    if (num_counters < 1){
+      printf("ERROR: number of counters must be >= 1 : %ld\n", num_counters);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    ENDOFTESTS:;
+  }
+  bail_out(error);
+
+  MPI_Bcast(&iterations,   1, MPI_INT,  root, MPI_COMM_WORLD);
+  MPI_Bcast(&active_ranks, 1, MPI_INT,  root, MPI_COMM_WORLD);
+  MPI_Bcast(&num_counters, 1, MPI_LONG, root, MPI_COMM_WORLD);
+
+  if (my_ID == root) {
+    printf("Number of ranks                = %d\n", Num_procs);
+    printf("Number of active ranks         = %d\n", active_ranks);
+    printf("Number of counters             = %ld %s\n", num_counters,
+           num_counters==1 ? "(single hot counter)" : "(striped round-robin)");
+    printf("Number of updates per rank     = %d\n", iterations);
+  }
+
+  /* counter c is hosted by rank c%Num_procs at displacement c/Num_procs        */
+  counters_local = num_counters/Num_procs + (my_ID < num_counters%Num_procs ? 1 : 0);
+
+  MPI_Info_create(&rma_winfo);
+  MPI_Info_set(rma_winfo, "accumulate_ordering", "none");
+  MPI_Win_allocate(counters_local*sizeof(long), sizeof(long), rma_winfo,
+                   MPI_COMM_WORLD, (void *) &counter_space, &rma_win);
+  for (i=0; i<counters_local; i++) counter_space[i] = 0;
+
+  latency = (double *) prk_malloc(iterations*sizeof(double));
+  if (!latency) {
+    printf("ERROR: rank %d could not allocate latency array\n", my_ID);
+    error = 1;
+  }
+  bail_out(error);
+
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, rma_win);
+
+  /* one untimed update warms up connections and the window                     */
+  if (my_ID < active_ranks) {
+    counter = my_ID%num_counters;
+    target  = (int)(counter%Num_procs);
+    disp    = (MPI_Aint)(counter/Num_procs);
+    MPI_Fetch_and_op(&one, &dummy, MPI_LONG, target, disp, MPI_SUM, rma_win);
+    MPI_Win_flush(target, rma_win);
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  local_time = wtime();
+
+  if (my_ID < active_ranks) {
+    for (iter=0; iter<iterations; iter++) {
+      /* stripe the updates so concurrent ranks start on different counters     */
+      counter = (my_ID+(long)iter)%num_counters;
+      target  = (int)(counter%Num_procs);
+      disp    = (MPI_Aint)(counter/Num_procs);
+      op_time = wtime();
+      MPI_Fetch_and_op(&one, &dummy, MPI_LONG, target, disp, MPI_SUM, rma_win);
+      MPI_Win_flush(target, rma_win);
+      latency[iter] = wtime() - op_time;
+    }
+  }
+
+  local_time = wtime() - local_time;
+  MPI_Win_unlock_all(rma_win);
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  MPI_Reduce(&local_time, &refcount_time, 1, MPI_DOUBLE, MPI_MAX, root, MPI_COMM_WORLD);
+
+/*********************************************************************
+** Verify and report
+*********************************************************************/
+
+  local_sum = 0;
+  for (i=0; i<counters_local; i++) local_sum += counter_space[i];
+  MPI_Reduce(&local_sum, &sum, 1, MPI_LONG, MPI_SUM, root, MPI_COMM_WORLD);
+
+  /* gather the per-op latencies of the active ranks on the root                */
+  counts = displs = NULL;
+  all_latency = NULL;
+  nsamples = active_ranks*iterations;
+  if (my_ID == root) {
+    counts      = (int *) prk_malloc(2*Num_procs*sizeof(int));
+    all_latency = (double *) prk_malloc(nsamples*sizeof(double));
+    if (!counts || !all_latency) {
+      printf("ERROR: could not allocate latency gather space\n");
+      error = 1;
+    }
+  }
+  bail_out(error);
+  if (my_ID == root) {
+    displs = counts + Num_procs;
+    for (i=0; i<Num_procs; i++) {
+      counts[i] = (i < active_ranks) ? iterations : 0;
+      displs[i] = (i < active_ranks) ? i*iterations : nsamples;
+    }
+  }
+  MPI_Gatherv(latency, (my_ID < active_ranks) ? iterations : 0, MPI_DOUBLE,
+              all_latency, counts, displs, MPI_DOUBLE, root, MPI_COMM_WORLD);
+
+  if (my_ID == root) {
+    total_updates = (long)active_ranks*iterations + active_ranks; /* incl. warmup */
+    if (sum != total_updates) {
+      printf("ERROR: counter sum %ld differs from update count %ld\n",
+             sum, total_updates);
+      error = 1;
+    }
+    else {
+      printf("Solution validates\n");
+      printf("Rate (Mupdates/s): %lf time (s): %lf\n",
+             1.e-6*((long)active_ranks*iterations)/refcount_time, refcount_time);
+      qsort(all_latency, nsamples, sizeof(double), compare_doubles);
+      printf("Update latency (us): min %lf p50 %lf p90 %lf p99 %lf max %lf\n",
+             1.e6*all_latency[0],
+             1.e6*all_latency[nsamples/2],
+             1.e6*all_latency[(long)nsamples*90/100],
+             1.e6*all_latency[(long)nsamples*99/100],
+             1.e6*all_latency[nsamples-1]);
+    }
+  }
+  bail_out(error);
+
+  MPI_Win_free(&rma_win);
+  MPI_Info_free(&rma_winfo);
+
+  MPI_Finalize();
+  return(MPI_SUCCESS);
+
+} /* end of main */
@@ -41,7 +41,12 @@ PURPOSE: This program tests the efficiency with which a space-invariant,
 USAGE:   The program takes as input the linear dimension of the grid,
          and the number of iterations on the grid
 
-               <progname> <# iterations> <grid size>
+               <progname> <# iterations> <grid size> [<on-node halo mode>]
+
+         The optional on-node halo mode is COPY (default), which exchanges
+         halos between coherence domains on the same node via MPI messages,
+         or DIRECT, which loads them straight from the adjacent group's
+         shared memory block.
 
          The output consists of diagnostics to make sure the
          algorithm worked, and of timing statistics.
@@ -65,6 +70,8 @@ HISTORY: - Written by Rob Van der Wijngaart, November 2006.
          - RvdW, October 2014: removed barrier at start of each iteration
          - RvdW, October 2014: replaced single rank/single iteration timing
            with global timing of all iterations across all ranks
+         - Added DIRECT mode, reading on-node halos from neighboring
+           groups' shared memory blocks without messages or copies
 
 *********************************************************************************/
 
@@ -180,6 +187,14 @@ int main(int argc, char ** argv) {
   int    local_nbr[4];    /* list of synchronizing local neighbors               */
   int    num_local_nbrs;  /* number of synchronizing local neighbors             */
   int    dummy;
+  int    direct_halo;     /* whether on-node halos are read from shared memory   */
+  DTYPE *top_in_direct;   /* input block of on-node neighbor group, or NULL      */
+  DTYPE *bottom_in_direct;/*       "         "                                   */
+  DTYPE *right_in_direct; /*       "         "                                   */
+  DTYPE *left_in_direct;  /*       "         "                                   */
+  long   width_left,      /* x-extent of blocks to the left/right, if on-node    */
+         width_right;
+  long   height_bottom;   /* y-extent of block below, if on-node                 */
   DTYPE *top_buf_out;     /* communication buffer                                */
   DTYPE *top_buf_in;      /*       "         "                                   */
   DTYPE *bottom_buf_out;  /*       "         "                                   */
@@ -208,6 +223,9 @@ int main(int argc, char ** argv) {
   double local_stencil_time,/* timing parameters                                 */
          stencil_time,
          avgtime;
+  double halo_start,      /* timing parameters for halo exchanges                */
+         local_onnode_halo_time,  onnode_halo_time,
+         local_offnode_halo_time, offnode_halo_time;
   int    stencil_size;    /* number of points in stencil                         */
   DTYPE  * RESTRICT in;   /* input grid values                                   */
   DTYPE  * RESTRICT out;  /* output grid values                                  */
@@ -220,6 +238,9 @@ int main(int argc, char ** argv) {
   MPI_Win shm_win_out;    /* shared memory window object for OUT array           */
   MPI_Comm shm_comm_prep; /* preparatory shared memory communicator              */
   MPI_Comm shm_comm;      /* Shared Memory Communicator                          */
+  MPI_Comm node_comm;     /* communicator spanning all ranks on the node         */
+  MPI_Group world_group,  /* used to locate neighboring groups within the node   */
+            node_group;
   int shm_procs;          /* # of rankes in shared domain                        */
   int shm_ID;             /* MPI rank in shared memory domain                    */
   MPI_Aint size_in;       /* size of the IN array in shared memory window        */
@@ -248,8 +269,8 @@ int main(int argc, char ** argv) {
       goto ENDOFTESTS;
 #endif
 
-    if (argc != 4){
-      printf("Usage: %s  <#ranks per coherence domain><# iterations> <array dimension> \n",
+    if (argc != 4 && argc != 5){
+      printf("Usage: %s  <#ranks per coherence domain><# iterations> <array dimension> [<on-node halo mode>]\n",
              *argv);
       error = 1;
       goto ENDOFTESTS;
@@ -295,6 +316,18 @@ int main(int argc, char ** argv) {
       goto ENDOFTESTS;
     }
 
+    direct_halo = 0;
+    if (argc == 5) {
+      char *halo_mode = *++argv;
+      if      (!strcmp("DIRECT", halo_mode)) direct_halo = 1;
+      else if (!strcmp("COPY",   halo_mode)) direct_halo = 0;
+      else {
+        printf("ERROR: on-node halo mode must be COPY or DIRECT: %s\n", halo_mode);
+        error = 1;
+        goto ENDOFTESTS;
+      }
+    }
+
     ENDOFTESTS:;
   }
   bail_out(error);
@@ -302,6 +335,7 @@ int main(int argc, char ** argv) {
   MPI_Bcast(&n,          1, MPI_LONG, root, MPI_COMM_WORLD);
   MPI_Bcast(&iterations, 1, MPI_INT, root, MPI_COMM_WORLD);
   MPI_Bcast(&group_size, 1, MPI_INT, root, MPI_COMM_WORLD);
+  MPI_Bcast(&direct_halo,1, MPI_INT, root, MPI_COMM_WORLD);
 
   /* determine best way to create a 2D grid of ranks (closest to square, for
      best surface/volume ratio); we do this brute force for now. The
@@ -330,11 +364,19 @@ int main(int argc, char ** argv) {
     printf("Tiles per shared memory domain  = %d\n", group_size);
     printf("Tiles in x/y-direction in group = %d/%d\n", group_sizex,  group_sizey);
     printf("Type of stencil                 = star\n");
+    if (direct_halo)
+    printf("On-node halo exchange           = direct shared memory loads\n");
+    else
+    printf("On-node halo exchange           = copy (MPI messages)\n");
+    if (direct_halo)
+    printf("Local synchronization           = node barrier\n");
+    else {
 #if LOCAL_BARRIER_SYNCH
     printf("Local synchronization           = barrier\n");
 #else
     printf("Local synchronization           = point to point\n");
 #endif
+    }
 #if DOUBLE
     printf("Data type                       = double precision\n");
 #else
@@ -452,13 +494,31 @@ int main(int argc, char ** argv) {
   total_length_in = (width+2*RADIUS)*(height+2*RADIUS)*sizeof(DTYPE);
   total_length_out = width*height*sizeof(DTYPE);
 
+  /* in DIRECT mode the windows span the entire node rather than a single
+     group, so that ranks can read halo data straight from the blocks of
+     adjacent groups; each group root still allocates just its own block     */
+  int my_root_node = MPI_PROC_NULL;
+  if (direct_halo) {
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+                        &node_comm);
+    MPI_Comm_group(MPI_COMM_WORLD, &world_group);
+    MPI_Comm_group(node_comm, &node_group);
+    /* locate the root of my own group within the node communicator          */
+    int my_root_world = my_group*group_size;
+    MPI_Group_translate_ranks(world_group, 1, &my_root_world, node_group,
+                              &my_root_node);
+    if (my_root_node == MPI_UNDEFINED) MPI_Abort(MPI_COMM_WORLD, 667);
+  }
+
   /* only the root of each SHM domain specifies window of nonzero size */
   size_mul = (shm_ID==0);
   size_in= total_length_in*size_mul;
-  MPI_Win_allocate_shared(size_in, sizeof(double), MPI_INFO_NULL, shm_comm,
+  MPI_Win_allocate_shared(size_in, sizeof(double), MPI_INFO_NULL,
+                          direct_halo ? node_comm : shm_comm,
                           (void *) &in, &shm_win_in);
   MPI_Win_lock_all(MPI_MODE_NOCHECK, shm_win_in);
-  MPI_Win_shared_query(shm_win_in, MPI_PROC_NULL, &size_in, &disp_unit, (void *)&in);
+  MPI_Win_shared_query(shm_win_in, direct_halo ? my_root_node : MPI_PROC_NULL,
+                       &size_in, &disp_unit, (void *)&in);
   if (in == NULL){
     printf("Error allocating space for input array by group %d\n",my_group);
     error = 1;
@@ -466,16 +526,66 @@ int main(int argc, char ** argv) {
   bail_out(error);
 
   size_out= total_length_out*size_mul;
-  MPI_Win_allocate_shared(size_out, sizeof(double), MPI_INFO_NULL, shm_comm,
+  MPI_Win_allocate_shared(size_out, sizeof(double), MPI_INFO_NULL,
+                          direct_halo ? node_comm : shm_comm,
                           (void *) &out, &shm_win_out);
   MPI_Win_lock_all(MPI_MODE_NOCHECK, shm_win_out);
-  MPI_Win_shared_query(shm_win_out, MPI_PROC_NULL, &size_out, &disp_unit, (void *)&out);
+  MPI_Win_shared_query(shm_win_out, direct_halo ? my_root_node : MPI_PROC_NULL,
+                       &size_out, &disp_unit, (void *)&out);
   if (out == NULL){
     printf("Error allocating space for output array by group %d\n", my_group);
     error = 1;
   }
   bail_out(error);
 
+  /* determine for each remote neighbor whether it resides on the same node;
+     if so, record a pointer to that group's input block plus its extent, so
+     that halo values can be loaded directly                                 */
+  top_in_direct = bottom_in_direct = right_in_direct = left_in_direct = NULL;
+  width_left = width_right = height_bottom = 0;
+  if (direct_halo) {
+    int nbr_root_world, nbr_root_node;
+    MPI_Aint nbr_size;
+    if (top_nbr != -1) {
+      nbr_root_world = (top_nbr/group_size)*group_size;
+      MPI_Group_translate_ranks(world_group, 1, &nbr_root_world, node_group,
+                                &nbr_root_node);
+      if (nbr_root_node != MPI_UNDEFINED)
+        MPI_Win_shared_query(shm_win_in, nbr_root_node, &nbr_size, &disp_unit,
+                             (void *)&top_in_direct);
+    }
+    if (bottom_nbr != -1) {
+      nbr_root_world = (bottom_nbr/group_size)*group_size;
+      MPI_Group_translate_ranks(world_group, 1, &nbr_root_world, node_group,
+                                &nbr_root_node);
+      if (nbr_root_node != MPI_UNDEFINED) {
+        MPI_Win_shared_query(shm_win_in, nbr_root_node, &nbr_size, &disp_unit,
+                             (void *)&bottom_in_direct);
+        height_bottom = n/Num_groupsy + ((my_group_IDy-1) < (int)(n%Num_groupsy));
+      }
+    }
+    if (right_nbr != -1) {
+      nbr_root_world = (right_nbr/group_size)*group_size;
+      MPI_Group_translate_ranks(world_group, 1, &nbr_root_world, node_group,
+                                &nbr_root_node);
+      if (nbr_root_node != MPI_UNDEFINED) {
+        MPI_Win_shared_query(shm_win_in, nbr_root_node, &nbr_size, &disp_unit,
+                             (void *)&right_in_direct);
+        width_right = n/Num_groupsx + ((my_group_IDx+1) < (int)(n%Num_groupsx));
+      }
+    }
+    if (left_nbr != -1) {
+      nbr_root_world = (left_nbr/group_size)*group_size;
+      MPI_Group_translate_ranks(world_group, 1, &nbr_root_world, node_group,
+                                &nbr_root_node);
+      if (nbr_root_node != MPI_UNDEFINED) {
+        MPI_Win_shared_query(shm_win_in, nbr_root_node, &nbr_size, &disp_unit,
+                             (void *)&left_in_direct);
+        width_left = n/Num_groupsx + ((my_group_IDx-1) < (int)(n%Num_groupsx));
+      }
+    }
+  }
+
   /* determine index set assigned to each rank                         */
 
   width_rank = width/group_sizex;
@@ -553,7 +663,10 @@ int main(int argc, char ** argv) {
   /* LOAD/STORE FENCE */
   MPI_Win_sync(shm_win_in);
   MPI_Win_sync(shm_win_out);
-  MPI_Barrier(shm_comm);
+  if (direct_halo) MPI_Barrier(node_comm);
+  else             MPI_Barrier(shm_comm);
+
+  local_onnode_halo_time = local_offnode_halo_time = 0.0;
 
   for (iter = 0; iter<=iterations; iter++){
 
@@ -563,8 +676,41 @@ int main(int argc, char ** argv) {
       local_stencil_time = wtime();
     }
 
+    /* load ghost point data directly from the blocks of on-node neighbor groups   */
+    if (iter > 0) halo_start = wtime();
+    if (top_in_direct) {
+      for (int j=jend_rank+1; j<=jend_rank+RADIUS; j++)
+      for (int i=istart_rank; i<=iend_rank; i++) {
+        IN(i,j) = top_in_direct[(i-istart+RADIUS)+
+                                (long)(j-jend_rank-1+RADIUS)*(width+2*RADIUS)];
+      }
+    }
+    if (bottom_in_direct) {
+      for (int j=jstart_rank-RADIUS; j<=jstart_rank-1; j++)
+      for (int i=istart_rank; i<=iend_rank; i++) {
+        IN(i,j) = bottom_in_direct[(i-istart+RADIUS)+
+                                   (long)(j-jstart_rank+height_bottom+RADIUS)*(width+2*RADIUS)];
+      }
+    }
+    if (right_in_direct) {
+      for (int j=jstart_rank; j<=jend_rank; j++)
+      for (int i=iend_rank+1; i<=iend_rank+RADIUS; i++) {
+        IN(i,j) = right_in_direct[(i-iend_rank-1+RADIUS)+
+                                  (long)(j-jstart+RADIUS)*(width_right+2*RADIUS)];
+      }
+    }
+    if (left_in_direct) {
+      for (int j=jstart_rank; j<=jend_rank; j++)
+      for (int i=istart_rank-RADIUS; i<=istart_rank-1; i++) {
+        IN(i,j) = left_in_direct[(i-istart_rank+width_left+RADIUS)+
+                                 (long)(j-jstart+RADIUS)*(width_left+2*RADIUS)];
+      }
+    }
+    if (iter > 0) local_onnode_halo_time += wtime() - halo_start;
+
     /* need to fetch ghost point data from neighbors in y-direction                 */
-    if (top_nbr != -1) {
+    if (iter > 0) halo_start = wtime();
+    if (top_nbr != -1 && !top_in_direct) {
       MPI_Irecv(top_buf_in, RADIUS*width_rank, MPI_DTYPE, top_nbr, 101,
                 MPI_COMM_WORLD, &(request[1]));
       for (int kk=0,j=jend_rank-RADIUS+1; j<=jend_rank; j++)
@@ -575,7 +721,7 @@ int main(int argc, char ** argv) {
                 MPI_COMM_WORLD, &(request[0]));
     }
 
-    if (bottom_nbr != -1) {
+    if (bottom_nbr != -1 && !bottom_in_direct) {
       MPI_Irecv(bottom_buf_in,RADIUS*width_rank, MPI_DTYPE, bottom_nbr, 99,
                 MPI_COMM_WORLD, &(request[3]));
       for (int kk=0,j=jstart_rank; j<=jstart_rank+RADIUS-1; j++)
@@ -586,7 +732,7 @@ int main(int argc, char ** argv) {
  	  MPI_COMM_WORLD, &(request[2]));
       }
 
-    if (top_nbr != -1) {
+    if (top_nbr != -1 && !top_in_direct) {
       MPI_Wait(&(request[0]), MPI_STATUS_IGNORE);
       MPI_Wait(&(request[1]), MPI_STATUS_IGNORE);
       for (int kk=0,j=jend_rank+1; j<=jend_rank+RADIUS; j++)
@@ -595,7 +741,7 @@ int main(int argc, char ** argv) {
       }
     }
 
-    if (bottom_nbr != -1) {
+    if (bottom_nbr != -1 && !bottom_in_direct) {
       MPI_Wait(&(request[2]), MPI_STATUS_IGNORE);
       MPI_Wait(&(request[3]), MPI_STATUS_IGNORE);
       for (int kk=0,j=jstart_rank-RADIUS; j<=jstart_rank-1; j++)
@@ -608,7 +754,7 @@ int main(int argc, char ** argv) {
     MPI_Win_sync(shm_win_in);
 
     /* need to fetch ghost point data from neighbors in x-direction                 */
-    if (right_nbr != -1) {
+    if (right_nbr != -1 && !right_in_direct) {
       MPI_Irecv(right_buf_in, RADIUS*height_rank, MPI_DTYPE, right_nbr, 1010,
                 MPI_COMM_WORLD, &(request[1+4]));
       for (int kk=0,j=jstart_rank; j<=jend_rank; j++)
@@ -619,7 +765,7 @@ int main(int argc, char ** argv) {
                 MPI_COMM_WORLD, &(request[0+4]));
     }
 
-    if (left_nbr != -1) {
+    if (left_nbr != -1 && !left_in_direct) {
       MPI_Irecv(left_buf_in, RADIUS*height_rank, MPI_DTYPE, left_nbr, 990,
                 MPI_COMM_WORLD, &(request[3+4]));
       for (int kk=0,j=jstart_rank; j<=jend_rank; j++)
@@ -630,7 +776,7 @@ int main(int argc, char ** argv) {
                 MPI_COMM_WORLD, &(request[2+4]));
     }
 
-    if (right_nbr != -1) {
+    if (right_nbr != -1 && !right_in_direct) {
       MPI_Wait(&(request[0+4]), MPI_STATUS_IGNORE);
       MPI_Wait(&(request[1+4]), MPI_STATUS_IGNORE);
       for (int kk=0,j=jstart_rank; j<=jend_rank; j++)
@@ -639,7 +785,7 @@ int main(int argc, char ** argv) {
       }
     }
 
-    if (left_nbr != -1) {
+    if (left_nbr != -1 && !left_in_direct) {
       MPI_Wait(&(request[2+4]), MPI_STATUS_IGNORE);
       MPI_Wait(&(request[3+4]), MPI_STATUS_IGNORE);
       for (int kk=0,j=jstart_rank; j<=jend_rank; j++)
@@ -647,6 +793,7 @@ int main(int argc, char ** argv) {
         IN(i,j) = left_buf_in[kk++];
       }
     }
+    if (iter > 0) local_offnode_halo_time += wtime() - halo_start;
 
     /* LOAD/STORE FENCE */
     MPI_Win_sync(shm_win_in);
@@ -667,6 +814,9 @@ int main(int argc, char ** argv) {
     /* LOAD/STORE FENCE */
     MPI_Win_sync(shm_win_out);
 
+    if (direct_halo) {
+      MPI_Barrier(node_comm); // needed to avoid writing IN while other ranks are reading it
+    } else {
 #if LOCAL_BARRIER_SYNCH
     MPI_Barrier(shm_comm); // needed to avoid writing IN while other ranks are reading it
 #else
@@ -676,6 +826,7 @@ int main(int argc, char ** argv) {
     }
     MPI_Waitall(num_local_nbrs, request, MPI_STATUSES_IGNORE);
 #endif
+    }
 
     /* add constant to solution to force refresh of neighbor data, if any */
     for (int j=jstart_rank; j<=jend_rank; j++)
@@ -684,6 +835,9 @@ int main(int argc, char ** argv) {
     /* LOAD/STORE FENCE */
     MPI_Win_sync(shm_win_in);
 
+    if (direct_halo) {
+      MPI_Barrier(node_comm); // needed to avoid reading IN while other ranks are writing it
+    } else {
 #if LOCAL_BARRIER_SYNCH
     MPI_Barrier(shm_comm); // needed to avoid reading IN while other ranks are writing it
 #else
@@ -693,12 +847,17 @@ int main(int argc, char ** argv) {
     }
     MPI_Waitall(num_local_nbrs, request, MPI_STATUSES_IGNORE);
 #endif
+    }
 
   } /* end of iterations                                                   */
 
   local_stencil_time = wtime() - local_stencil_time;
   MPI_Reduce(&local_stencil_time, &stencil_time, 1, MPI_DOUBLE, MPI_MAX, root,
              MPI_COMM_WORLD);
+  MPI_Reduce(&local_onnode_halo_time,  &onnode_halo_time,  1, MPI_DOUBLE, MPI_MAX,
+             root, MPI_COMM_WORLD);
+  MPI_Reduce(&local_offnode_halo_time, &offnode_halo_time, 1, MPI_DOUBLE, MPI_MAX,
+             root, MPI_COMM_WORLD);
 
   /* compute L1 norm in parallel                                                */
   local_norm = (DTYPE) 0.0;
@@ -748,6 +907,8 @@ int main(int argc, char ** argv) {
        plus one flop for the update of the input of the array        */
     flops = (DTYPE) (2*stencil_size+1) * f_active_points;
     avgtime = stencil_time/iterations;
+    printf("On-node halo avg time (s): %lf; off-node halo avg time (s): %lf\n",
+           onnode_halo_time/iterations, offnode_halo_time/iterations);
     printf("Rate (MFlops/s): "FSTR"  Avg time (s): %lf\n",
            1.0E-06 * flops/avgtime, avgtime);
   }
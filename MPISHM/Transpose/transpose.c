@@ -77,6 +77,7 @@ HISTORY: Written by Tim Mattson, April 1999.
 
 #define A(i,j)        A_p[(i+istart)+order*(j)]
 #define B(i,j)        B_p[(i+istart)+order*(j)]
+#define A_peer(i,j)   A_peer_p[(i)+order*(j)]
 #define Work_in(i,j)  Work_in_p[i+Block_order*(j)]
 #define Work_out(i,j) Work_out_p[i+Block_order*(j)]
 
@@ -123,6 +124,13 @@ int main(int argc, char ** argv)
   int size_mul;        /* size multiplier; 0 for non-root ranks in coherence dom.*/
   size_t istart;
   MPI_Request send_req, recv_req;
+  int shm_direct;      /* read on-node peer blocks in place (PRK_SHM_DIRECT)     */
+  MPI_Comm node_comm;  /* all ranks sharing physical memory, across groups       */
+  int *root_node_rank; /* node rank of each group's root, MPI_UNDEFINED off-node */
+  double **A_group_p;  /* base of each on-node group's A block, NULL off-node    */
+  double * RESTRICT A_peer_p; /* A block of the current on-node peer group       */
+  double local_onnode_time=0.0, local_offnode_time=0.0, /* phase timings         */
+         onnode_time, offnode_time, phase_start;
 
 /*********************************************************************************
 ** Initialize the MPI environment
@@ -133,6 +141,9 @@ int main(int argc, char ** argv)
 
   root = 0;
 
+  /* transpose on-node peer blocks straight out of their shared segments        */
+  shm_direct = (getenv("PRK_SHM_DIRECT") != NULL);
+
 /*********************************************************************
 ** process, test and broadcast input parameter
 *********************************************************************/
@@ -205,6 +216,8 @@ int main(int argc, char ** argv)
     printf("Non-");
 #endif
     printf("Blocking messages\n");
+    if (shm_direct)
+      printf("On-node exchange     = direct (single copy through shared windows)\n");
   }
 
   /* Setup for Shared memory regions */
@@ -218,6 +231,11 @@ int main(int argc, char ** argv)
   /* do sanity check, making sure groups did not shrink in second comm split */
   if (shm_procs != group_size) MPI_Abort(MPI_COMM_WORLD, 666);
 
+  /* in direct mode the A and B windows span the whole node, not just the
+     group, so co-located groups can read each other's blocks in place         */
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+                      &node_comm);
+
   /* a non-positive tile size means no tiling of the local transpose */
   tiling = (Tile_order > 0) && (Tile_order < order);
   bytes = 2 * sizeof(double) * order * order;
@@ -247,14 +265,38 @@ int main(int argc, char ** argv)
    * It is the one info key that MPICH actually uses for optimization. */
   MPI_Info_set(rma_winfo, "no_locks", "true");
 
+  /* locate each group's root on this node; off-node roots translate to
+     MPI_UNDEFINED, which marks their groups for the messaging fallback        */
+  root_node_rank = (int *)     prk_malloc(Num_groups*sizeof(int));
+  A_group_p      = (double **) prk_malloc(Num_groups*sizeof(double *));
+  if (!root_node_rank || !A_group_p) {
+    printf(" Error allocating group tables on node %d\n",my_ID);
+    error = 1;
+  }
+  bail_out(error);
+  {
+    MPI_Group world_group, node_group;
+    MPI_Comm_group(MPI_COMM_WORLD, &world_group);
+    MPI_Comm_group(node_comm, &node_group);
+    for (i=0; i<Num_groups; i++) {
+      int world_rank = i*group_size;
+      MPI_Group_translate_ranks(world_group, 1, &world_rank, node_group,
+                                &root_node_rank[i]);
+    }
+    MPI_Group_free(&world_group);
+    MPI_Group_free(&node_group);
+  }
+
   /* only the root of each SHM domain specifies window of nonzero size */
-  size_mul = (shm_ID==0);  
+  size_mul = (shm_ID==0);
   int offset = 32;
+  MPI_Comm win_comm = shm_direct ? node_comm : shm_comm;
+  int own_root = shm_direct ? root_node_rank[group_ID] : MPI_PROC_NULL;
   MPI_Aint size= (Colblock_size+offset)*sizeof(double)*size_mul; int disp_unit;
-  MPI_Win_allocate_shared(size, sizeof(double), rma_winfo, shm_comm, 
+  MPI_Win_allocate_shared(size, sizeof(double), rma_winfo, win_comm,
                           (void *) &A_p, &shm_win_A);
   MPI_Win_lock_all(MPI_MODE_NOCHECK,shm_win_A);
-  MPI_Win_shared_query(shm_win_A, MPI_PROC_NULL, &size, &disp_unit, (void *)&A_p);
+  MPI_Win_shared_query(shm_win_A, own_root, &size, &disp_unit, (void *)&A_p);
 
   if (A_p == NULL){
     printf(" Error allocating space for original matrix on node %d\n",my_ID);
@@ -263,12 +305,22 @@ int main(int argc, char ** argv)
   bail_out(error);
   A_p += offset;
 
+  /* map the A blocks of all groups that share this node                       */
+  for (i=0; i<Num_groups; i++) {
+    A_group_p[i] = NULL;
+    if (shm_direct && root_node_rank[i] != MPI_UNDEFINED) {
+      MPI_Win_shared_query(shm_win_A, root_node_rank[i], &size, &disp_unit,
+                           (void *)&A_group_p[i]);
+      A_group_p[i] += offset;
+    }
+  }
+
   /* recompute memory size (overwritten by prior query                 */
-  size= (Colblock_size+offset)*sizeof(double)*size_mul; 
-  MPI_Win_allocate_shared(size, sizeof(double), rma_winfo, shm_comm, 
+  size= (Colblock_size+offset)*sizeof(double)*size_mul;
+  MPI_Win_allocate_shared(size, sizeof(double), rma_winfo, win_comm,
                           (void *) &B_p, &shm_win_B);
   MPI_Win_lock_all(MPI_MODE_NOCHECK,shm_win_B);
-  MPI_Win_shared_query(shm_win_B, MPI_PROC_NULL, &size, &disp_unit, (void *)&B_p);
+  MPI_Win_shared_query(shm_win_B, own_root, &size, &disp_unit, (void *)&B_p);
   if (B_p == NULL){
     printf(" Error allocating space for transposed matrix by group %d\n",group_ID);
     error = 1;
@@ -332,9 +384,10 @@ int main(int argc, char ** argv)
   for (iter=0; iter<=iterations; iter++) {
 
     /* start timer after a warmup iteration */
-    if (iter == 1) { 
+    if (iter == 1) {
       MPI_Barrier(MPI_COMM_WORLD);
       local_trans_time = wtime();
+      local_onnode_time = local_offnode_time = 0.0;
     }
 
     /* do the local transpose                                                    */
@@ -363,7 +416,114 @@ int main(int argc, char ** argv)
       recv_from = ((group_ID + phase             )%Num_groups);
       send_to   = ((group_ID - phase + Num_groups)%Num_groups);
 
-      istart = send_to*Block_order; 
+      if (shm_direct) {
+      /* at phase p my group reads the block that group recv_from would have
+         sent to it, while recv_from reads one of mine; when a peer shares the
+         node we transpose straight out of its window segment and only the
+         messaging fallback pays for pack/copy                                 */
+      int recv_local = (A_group_p[recv_from] != NULL);
+      int send_local = (A_group_p[send_to]   != NULL);
+
+      phase_start = wtime();
+      if (!send_local) {
+        istart = send_to*Block_order;
+        if (!tiling) {
+          for (i=shm_ID*chunk_size; i<(shm_ID+1)*chunk_size; i++)
+            for (j=0; j<Block_order; j++){
+              Work_out(j,i) = A(i,j);
+              A(i,j) += 1.0;
+            }
+        }
+        else {
+          for (i=shm_ID*chunk_size; i<(shm_ID+1)*chunk_size; i+=Tile_order)
+            for (j=0; j<Block_order; j+=Tile_order)
+              for (it=i; it<MIN((shm_ID+1)*chunk_size,i+Tile_order); it++)
+                for (jt=j; jt<MIN(Block_order,j+Tile_order);jt++) {
+                  Work_out(jt,it) = A(it,jt);
+                  A(it,jt) += 1.0;
+                }
+        }
+      }
+      local_offnode_time += wtime() - phase_start;
+
+      /* NEED A LOAD/STORE FENCE HERE; no peer may still be reading the block
+         its owner is about to overwrite next phase                            */
+      phase_start = wtime();
+      MPI_Win_sync(shm_win_A);
+      MPI_Barrier(node_comm);
+
+      if (recv_local) {
+        A_peer_p = A_group_p[recv_from];
+        istart = recv_from*Block_order;
+        if (!tiling) {
+          for (j=shm_ID*chunk_size; j<(shm_ID+1)*chunk_size; j++)
+            for (i=0; i<Block_order; i++)
+              B(i,j) += A_peer(j+group_ID*Block_order,i);
+        }
+        else {
+          for (j=shm_ID*chunk_size; j<(shm_ID+1)*chunk_size; j+=Tile_order)
+            for (i=0; i<Block_order; i+=Tile_order)
+              for (jt=j; jt<MIN((shm_ID+1)*chunk_size,j+Tile_order); jt++)
+                for (it=i; it<MIN(Block_order,i+Tile_order); it++)
+                  B(it,jt) += A_peer(jt+group_ID*Block_order,it);
+        }
+      }
+      local_onnode_time += wtime() - phase_start;
+
+      phase_start = wtime();
+      if (!recv_local || !send_local) {
+        /* NEED A LOAD/STORE FENCE HERE                                        */
+        MPI_Win_sync(shm_win_Work_in);
+        MPI_Win_sync(shm_win_Work_out);
+        MPI_Barrier(shm_comm);
+        if (shm_ID==0) {
+          int msg_recv_from = recv_local ? MPI_PROC_NULL : recv_from*group_size;
+          int msg_send_to   = send_local ? MPI_PROC_NULL : send_to*group_size;
+#if !SYNCHRONOUS
+          MPI_Irecv(Work_in_p, Block_size, MPI_DOUBLE,
+                    msg_recv_from, phase, MPI_COMM_WORLD, &recv_req);
+          MPI_Isend(Work_out_p, Block_size, MPI_DOUBLE, msg_send_to,
+                    phase, MPI_COMM_WORLD, &send_req);
+          MPI_Wait(&recv_req, MPI_STATUS_IGNORE);
+          MPI_Wait(&send_req, MPI_STATUS_IGNORE);
+#else
+          MPI_Sendrecv(Work_out_p, Block_size, MPI_DOUBLE, msg_send_to,
+                       phase, Work_in_p, Block_size, MPI_DOUBLE,
+                       msg_recv_from, phase, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+#endif
+        }
+        /* NEED A LOAD FENCE HERE                                              */
+        MPI_Win_sync(shm_win_Work_in);
+        MPI_Win_sync(shm_win_Work_out);
+        MPI_Barrier(shm_comm);
+
+        if (!recv_local) {
+          istart = recv_from*Block_order;
+          /* scatter received block to transposed matrix; no need to tile */
+          for (j=shm_ID*chunk_size; j<(shm_ID+1)*chunk_size; j++)
+            for (i=0; i<Block_order; i++)
+              B(i,j) += Work_in(i,j);
+        }
+      }
+      local_offnode_time += wtime() - phase_start;
+
+      /* all direct readers are done with this phase's blocks; the block that
+         stayed on node can now receive its per-iteration update              */
+      phase_start = wtime();
+      MPI_Win_sync(shm_win_A);
+      MPI_Barrier(node_comm);
+      if (send_local) {
+        istart = send_to*Block_order;
+        for (i=shm_ID*chunk_size; i<(shm_ID+1)*chunk_size; i++)
+          for (j=0; j<Block_order; j++)
+            A(i,j) += 1.0;
+      }
+      local_onnode_time += wtime() - phase_start;
+
+      continue;
+      }  /* end of shm_direct phase                                            */
+
+      istart = send_to*Block_order;
       if (!tiling) {
         for (i=shm_ID*chunk_size; i<(shm_ID+1)*chunk_size; i++) 
           for (j=0; j<Block_order; j++){
@@ -419,6 +579,10 @@ int main(int argc, char ** argv)
   local_trans_time = wtime() - local_trans_time;
   MPI_Reduce(&local_trans_time, &trans_time, 1, MPI_DOUBLE, MPI_MAX, root,
              MPI_COMM_WORLD);
+  MPI_Reduce(&local_onnode_time,  &onnode_time,  1, MPI_DOUBLE, MPI_MAX, root,
+             MPI_COMM_WORLD);
+  MPI_Reduce(&local_offnode_time, &offnode_time, 1, MPI_DOUBLE, MPI_MAX, root,
+             MPI_COMM_WORLD);
 
   abserr = 0.0;
   istart = 0;
@@ -436,6 +600,9 @@ int main(int argc, char ** argv)
       printf("Solution validates\n");
       avgtime = trans_time/(double)iterations;
       printf("Rate (MB/s): %lf Avg time (s): %lf\n",1.0E-06*bytes/avgtime, avgtime);
+      if (shm_direct && Num_groups>1)
+        printf("Phase time/iter (s): %lf (on-node) %lf (off-node)\n",
+               onnode_time/(double)iterations, offnode_time/(double)iterations);
 #if VERBOSE
       printf("Summed errors: %f \n", abserr_tot);
 #endif
@@ -461,6 +628,8 @@ int main(int argc, char ** argv)
   }
 
   MPI_Info_free(&rma_winfo);
+  prk_free(A_group_p);
+  prk_free(root_node_rank);
 
   MPI_Finalize();
   exit(EXIT_SUCCESS);
@@ -119,12 +119,15 @@ HISTORY: Written by Rob Van der Wijngaart, May 2006.
 
 #include <par-res-kern_general.h>
 #include <par-res-kern_omp.h>
+#include <par-res-kern_branch.h>
 
 /* the following values are only used as labels                                  */
 #define VECTOR_STOP       66
 #define VECTOR_GO         77
 #define NO_VECTOR         88
 #define INS_HEAVY         99
+#define INDIRECT         111
+#define CORRELATED       122
 #define WITH_BRANCHES      1
 #define WITHOUT_BRANCHES   0
 
@@ -146,6 +149,7 @@ int main(int argc, char ** argv)
   int      btype;           /* integer encoding branching type                   */
   int      total=0, 
            total_ref;       /* computed and stored verification values           */
+  int      table_size;      /* number of distinct indirect dispatch targets      */
   int      nthread_input;   /* thread parameters                                 */
   int      nthread; 
   int      num_error=0;     /* flag that signals that requested and obtained
@@ -158,10 +162,11 @@ int main(int argc, char ** argv)
   printf("Parallel Research Kernels version %s\n", PRKVERSION);
   printf("OpenMP Branching Bonanza\n");
 
-  if (argc != 5){
+  if (argc != 5 && argc != 6){
     printf("Usage:     %s <# threads> <# iterations> <vector length>", *argv);
-    printf("<branching type>\n");
-    printf("branching type: vector_go, vector_stop, no_vector, ins_heavy\n");
+    printf("<branching type> [dispatch table size]\n");
+    printf("branching type: vector_go, vector_stop, no_vector, ins_heavy,\n");
+    printf("                indirect, correlated\n");
     exit(EXIT_FAILURE);
   }
 
@@ -190,15 +195,24 @@ int main(int argc, char ** argv)
   else if (!strcmp(branch_type,"vector_go"  )) btype = VECTOR_GO;
   else if (!strcmp(branch_type,"no_vector"  )) btype = NO_VECTOR;
   else if (!strcmp(branch_type,"ins_heavy"  )) btype = INS_HEAVY;
+  else if (!strcmp(branch_type,"indirect"   )) btype = INDIRECT;
+  else if (!strcmp(branch_type,"correlated" )) btype = CORRELATED;
   else  {
     printf("Wrong branch type: %s; choose vector_stop, vector_go, ", branch_type);
-    printf("no_vector, or ins_heavy\n");
+    printf("no_vector, ins_heavy, indirect, or correlated\n");
+    exit(EXIT_FAILURE);
+  }
+
+  table_size = (argc == 6) ? atoi(*++argv) : 16;
+  if (table_size < 1 || table_size > BRANCH_MAX_TABLE) {
+    printf("ERROR: dispatch table size must be in [1,%d] : %d\n",
+           BRANCH_MAX_TABLE, table_size);
     exit(EXIT_FAILURE);
   }
 
   #pragma omp parallel private(i, my_ID, iter, aux, nfunc, rank) reduction(+:total)
   {
-  int * RESTRICT vector; int * RESTRICT index;
+  int * RESTRICT vector; int * RESTRICT index; int * RESTRICT targets;
 
   #pragma omp master
   {
@@ -214,6 +228,9 @@ int main(int argc, char ** argv)
     printf("Vector length              = %d\n", vector_length);
     printf("Number of iterations       = %d\n", iterations);
     printf("Branching type             = %s\n", branch_type);
+    if (btype == INDIRECT || btype == CORRELATED) {
+      printf("Dispatch table size        = %d\n", table_size);
+    }
 #if RESTRICT_KEYWORD
     printf("No aliasing                = on\n");
 #else
@@ -225,7 +242,7 @@ int main(int argc, char ** argv)
 
   my_ID = omp_get_thread_num();
 
-  vector = prk_malloc(vector_length*2*sizeof(int));
+  vector = prk_malloc(vector_length*3*sizeof(int));
   if (!vector) {
     printf("ERROR: Thread %d failed to allocate space for vector\n", my_ID);
     num_error = 1;
@@ -233,8 +250,10 @@ int main(int argc, char ** argv)
 
   bail_out(num_error);
 
-  /* grab the second half of vector to store index array                         */
+  /* grab the second third of vector to store index array, and the last
+     third for the indirect dispatch-target sequence                             */
   index   = vector + vector_length;
+  targets = index  + vector_length;
 
   /* initialize the array with entries with varying signs; array "index" is only 
      used to obfuscate the compiler (i.e. it won't vectorize a loop containing
@@ -244,6 +263,20 @@ int main(int argc, char ** argv)
     index[i]   = i;
   }
 
+  /* dispatch-target sequence: pseudo-random targets probe branch-target-buffer
+     and indirect-predictor capacity; a cyclic sequence of the same targets is
+     learnable by a correlating predictor                                        */
+  if (btype == INDIRECT || btype == CORRELATED) {
+    unsigned int seed = 79;
+    for (i=0; i<vector_length; i++) {
+      if (btype == INDIRECT) {
+        seed = 1103515245u*seed + 12345u;
+        targets[i] = (int)((seed>>16) % (unsigned int)table_size);
+      }
+      else targets[i] = i % table_size;
+    }
+  }
+
   #pragma omp barrier   
   #pragma omp master
   {   
@@ -308,6 +341,22 @@ int main(int argc, char ** argv)
       }
       break;
 
+    case INDIRECT:
+    case CORRELATED:
+      /* every element dispatches through a function pointer; the callees
+         perform the no_vector update, so the totals are unchanged             */
+      for (iter=0; iter<iterations; iter+=2) {
+        for (i=0; i<vector_length; i++) {
+          aux = -(3 - (i&7));
+          branch_table[targets[i]](vector, index, i, aux);
+        }
+        for (i=0; i<vector_length; i++) {
+          aux = (3 - (i&7));
+          branch_table[targets[i]](vector, index, i, aux);
+        }
+      }
+      break;
+
     case INS_HEAVY:
       fill_vec(vector, vector_length, iterations, WITH_BRANCHES, &nfunc, &rank);
     }
@@ -362,6 +411,22 @@ int main(int argc, char ** argv)
       }
       break;
 
+    case INDIRECT:
+    case CORRELATED:
+      /* the branch-free update through a direct call: no conditional branch
+         and no indirect dispatch                                               */
+      for (iter=0; iter<iterations; iter+=2) {
+        for (i=0; i<vector_length; i++) {
+          aux = -(3 - (i&7));
+          branch_func_fixed(vector, index, i, aux);
+        }
+        for (i=0; i<vector_length; i++) {
+          aux = (3 - (i&7));
+          branch_func_fixed(vector, index, i, aux);
+        }
+      }
+      break;
+
     case INS_HEAVY:
       fill_vec(vector, vector_length, iterations, WITHOUT_BRANCHES, &nfunc, &rank);
     }
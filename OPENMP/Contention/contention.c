@@ -0,0 +1,272 @@
+/*
+Copyright (c) 2013-2017, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+* Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*******************************************************************
+
+NAME:    Contention
+
+PURPOSE: This program measures the cost of contended atomic updates
+         to a shared counter, as a function of the update primitive
+         and of the counter placement.  It generalizes the RefCount
+         kernel, which exercises only one mutual-exclusion flavor.
+
+USAGE:   The program takes as input the number of threads, the number
+         of counter updates per thread, the update method, and the
+         counter placement
+
+               <progname> <# threads> <# updates per thread> <method> <placement>
+
+         method is one of
+           fetchadd   hardware fetch-and-add
+           cas        compare-and-swap retry loop
+           backoff    compare-and-swap with bounded exponential backoff,
+                      which is friendlier to LL/SC architectures
+         placement is one of
+           shared     all threads update one counter (contended)
+           private    each thread updates its own counter, padded to a
+                      full cache line (uncontended baseline)
+
+         The output consists of diagnostics to make sure the
+         algorithm worked, and of timing statistics: the mean per-update
+         latency, the per-thread minimum and maximum, and the fairness
+         spread (slowest over fastest thread time).
+
+FUNCTIONS CALLED:
+
+         Other than OpenMP or standard C functions, the following
+         functions are used in this program:
+
+         wtime()
+         bail_out()
+
+HISTORY: Derived from the RefCount kernel by Rob Van der Wijngaart.
+
+*******************************************************************/
+
+#include <par-res-kern_general.h>
+#include <par-res-kern_omp.h>
+
+#define LINE_SIZE    64
+#define METHOD_FAD   0
+#define METHOD_CAS   1
+#define METHOD_BOFF  2
+#define MAX_DELAY    1024
+
+/* one counter per cache line, so private counters do not false-share */
+typedef struct {
+  int64_t c;
+  char    pad[LINE_SIZE-sizeof(int64_t)];
+} counter_t;
+
+static void cpu_relax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+int main(int argc, char ** argv)
+{
+  size_t     iterations;      /* number of counter updates per thread           */
+  int        method;          /* update primitive                               */
+  int        shared;          /* all threads share one counter                  */
+  counter_t  *counters;       /* counter storage, one cache line per counter    */
+  double     *thread_time;    /* per-thread time spent in the update loop       */
+  int        nthread_input;   /* number of threads requested                    */
+  int        nthread;         /* actual number of threads used                  */
+  int        error=0;         /* global errors                                  */
+  int        i;
+
+/*********************************************************************
+** process and test input parameters
+*********************************************************************/
+
+  printf("Parallel Research Kernels version %s\n", PRKVERSION);
+  printf("OpenMP atomic contention test\n");
+
+  if (argc != 5){
+    printf("Usage: %s <# threads> <# updates per thread> <method> <placement>\n", *argv);
+    printf("    method is one of 'fetchadd', 'cas', or 'backoff'\n");
+    printf("    placement is one of 'shared' or 'private'\n");
+    return(1);
+  }
+
+  nthread_input = atoi(*++argv);
+  if ((nthread_input < 1) || (nthread_input > MAX_THREADS)) {
+    printf("ERROR: Invalid number of threads: %d\n", nthread_input);
+    exit(EXIT_FAILURE);
+  }
+
+  iterations = atol(*++argv);
+  if (iterations < 1){
+    printf("ERROR: updates per thread must be >= 1 : %zu \n",iterations);
+    exit(EXIT_FAILURE);
+  }
+
+  char const * method_name = *++argv;
+  if      (!strcmp(method_name, "fetchadd")) method = METHOD_FAD;
+  else if (!strcmp(method_name, "cas"))      method = METHOD_CAS;
+  else if (!strcmp(method_name, "backoff"))  method = METHOD_BOFF;
+  else {
+    printf("ERROR: unknown method '%s'\n", method_name);
+    exit(EXIT_FAILURE);
+  }
+
+  char const * placement_name = *++argv;
+  if      (!strcmp(placement_name, "shared"))  shared = 1;
+  else if (!strcmp(placement_name, "private")) shared = 0;
+  else {
+    printf("ERROR: unknown placement '%s'\n", placement_name);
+    exit(EXIT_FAILURE);
+  }
+
+  omp_set_num_threads(nthread_input);
+
+  counters = (counter_t *) prk_malloc(nthread_input*sizeof(counter_t));
+  thread_time = (double *) prk_malloc(nthread_input*sizeof(double));
+  if (!counters || !thread_time) {
+    printf("ERROR: could not allocate counter space\n");
+    exit(EXIT_FAILURE);
+  }
+  for (i=0; i<nthread_input; i++) counters[i].c = 0;
+
+  #pragma omp parallel
+  {
+  size_t   iter;
+  int      num_error=0;
+  int      my_ID = omp_get_thread_num();
+  int64_t  *pcounter;
+
+  #pragma omp master
+  {
+  nthread = omp_get_num_threads();
+  if (nthread != nthread_input) {
+    num_error = 1;
+    printf("ERROR: number of requested threads %d does not equal ",
+           nthread_input);
+    printf("number of spawned threads %d\n", nthread);
+  }
+  else {
+    printf("Number of threads         = %d\n", nthread_input);
+    printf("Updates per thread        = %zu\n", iterations);
+    printf("Update method             = %s\n", method_name);
+    printf("Counter placement         = %s\n", placement_name);
+  }
+  }
+  bail_out(num_error);
+
+  pcounter = shared ? &(counters[0].c) : &(counters[my_ID].c);
+
+  /* do one warmup update outside the timed loop to avoid overhead   */
+  __atomic_fetch_add(pcounter, 1, __ATOMIC_RELAXED);
+
+  #pragma omp barrier
+  double my_time = wtime();
+
+  switch (method) {
+  case METHOD_FAD:
+    for (iter=1; iter<=iterations; iter++) {
+      __atomic_fetch_add(pcounter, 1, __ATOMIC_RELAXED);
+    }
+    break;
+  case METHOD_CAS:
+    for (iter=1; iter<=iterations; iter++) {
+      int64_t old = __atomic_load_n(pcounter, __ATOMIC_RELAXED);
+      while (!__atomic_compare_exchange_n(pcounter, &old, old+1, 1,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        /* old has been refreshed by the failed CAS */
+      }
+    }
+    break;
+  case METHOD_BOFF:
+    for (iter=1; iter<=iterations; iter++) {
+      int delay = 1;
+      int64_t old = __atomic_load_n(pcounter, __ATOMIC_RELAXED);
+      while (!__atomic_compare_exchange_n(pcounter, &old, old+1, 1,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        /* back off before rereading the line, so a winner can retire
+           its store-conditional/retry without being disturbed        */
+        for (int d=0; d<delay; d++) cpu_relax();
+        if (delay < MAX_DELAY) delay += delay;
+      }
+    }
+    break;
+  }
+
+  thread_time[my_ID] = wtime() - my_time;
+  } /* end of OpenMP parallel region */
+
+  /* every update is exact in 64-bit integers, so the check is exact  */
+  if (shared) {
+    int64_t expected = (int64_t)nthread_input*(int64_t)(iterations+1);
+    if (counters[0].c != expected) {
+      printf("ERROR: shared counter is %" PRId64 "; should be %" PRId64 "\n",
+             counters[0].c, expected);
+      error = 1;
+    }
+  }
+  else {
+    for (i=0; i<nthread_input; i++) {
+      if (counters[i].c != (int64_t)(iterations+1)) {
+        printf("ERROR: counter %d is %" PRId64 "; should be %" PRId64 "\n",
+               i, counters[i].c, (int64_t)(iterations+1));
+        error = 1;
+      }
+    }
+  }
+
+  if (!error) {
+    double total_time = 0.0;
+    double min_time = thread_time[0];
+    double max_time = thread_time[0];
+    for (i=0; i<nthread_input; i++) {
+      total_time += thread_time[i];
+      min_time = MIN(min_time, thread_time[i]);
+      max_time = MAX(max_time, thread_time[i]);
+    }
+    printf("Solution validates\n");
+    printf("Rate (MCUPs/s): %lf time (s): %lf\n",
+           1.e-6*(double)nthread_input*(double)iterations/max_time, max_time);
+    printf("Per-update latency (ns): avg %lf min %lf max %lf\n",
+           1.e9*total_time/((double)nthread_input*(double)iterations),
+           1.e9*min_time/(double)iterations,
+           1.e9*max_time/(double)iterations);
+    printf("Fairness spread (max/min): %lf\n", max_time/min_time);
+  }
+
+  prk_free(thread_time);
+  prk_free(counters);
+
+  exit(error ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -66,6 +66,7 @@ HISTORY: Written by Rob Van der Wijngaart, September 2006.
 
 #include <par-res-kern_general.h>
 #include <par-res-kern_omp.h>
+#include <prk_energy.h>
 
 #if MKL
   #include <mkl_cblas.h>
@@ -82,7 +83,8 @@ HISTORY: Written by Rob Van der Wijngaart, September 2006.
 
 int main(int argc, char **argv){
 
-  int     iter, i,ii,j,jj,k,kk,ig,jg,kg; /* dummies                               */
+  long    i,ii,j,jj,k,kk,ig,jg,kg; /* matrix indices                              */
+  int     iter;                 /* iteration counter                              */
   int     iterations;           /* number of times the multiplication is done     */
   double  dgemm_time,           /* timing parameters                              */
           avgtime;
@@ -211,6 +213,7 @@ int main(int argc, char **argv){
       #pragma omp barrier
       #pragma omp master
       {
+        prk_energy_start();
         dgemm_time = wtime();
       }
     }
@@ -263,6 +266,7 @@ int main(int argc, char **argv){
   #pragma omp master
   {
     dgemm_time = wtime() - dgemm_time;
+    prk_energy_stop();
   }
 
   } /* end of parallel region                                                     */
@@ -276,13 +280,17 @@ int main(int argc, char **argv){
 
   for (iter=0; iter<=iterations; iter++) {
 
-    if (iter==1) dgemm_time = wtime();
+    if (iter==1) {
+      prk_energy_start();
+      dgemm_time = wtime();
+    }
 
     cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, order, order, 
                 order, 1.0, &(A_arr(0,0)), order, &(B_arr(0,0)), order, 
                 1.0, &(C_arr(0,0)), order);
   }
   dgemm_time = wtime()-dgemm_time;
+  prk_energy_stop();
 #endif
 
   for(checksum=0.0,j = 0; j < order; j++) for(i = 0; i < order; i++)
@@ -308,6 +316,7 @@ int main(int argc, char **argv){
   avgtime = dgemm_time/iterations;
   printf("Rate (MFlops/s): %lf  Avg time (s): %lf\n",
          1.0E-06 *nflops/avgtime, avgtime);
+  prk_energy_report(1.0E-06*nflops/avgtime, "MFlops/s");
 
   exit(EXIT_SUCCESS);
 
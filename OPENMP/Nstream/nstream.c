@@ -109,6 +109,7 @@ REVISION:  Modified by Rob Van der Wijngaart, May 2006, to introduce
  
 #include <par-res-kern_general.h>
 #include <par-res-kern_omp.h>
+#include <prk_energy.h>
  
 #define N   MAXLENGTH
  
@@ -243,6 +244,7 @@ int main(int argc, char **argv)
       #pragma omp barrier
       #pragma omp master
       {
+        prk_energy_start();
         nstream_time = wtime();
       }
     }
@@ -256,6 +258,7 @@ int main(int argc, char **argv)
   #pragma omp master
   {
     nstream_time = wtime() - nstream_time;
+    prk_energy_stop();
   }
 
   }  /* end of OpenMP parallel region */
@@ -269,6 +272,7 @@ int main(int argc, char **argv)
     avgtime = nstream_time/iterations;
     printf("Rate (MB/s): %lf Avg time (s): %lf\n",
            1.0E-06 * bytes/avgtime, avgtime);
+    prk_energy_report(1.0E-06 * bytes/avgtime, "MB/s");
    }
   else exit(EXIT_FAILURE);
  
@@ -42,7 +42,8 @@ PURPOSE: This program tests the efficiency with which a cloud of
 
 USAGE:   <progname> <#simulation steps> <grid size> <#particles> \
                     <horizontal velocity> <vertical velocity>    \
-                    <init mode> <init parameters>
+                    <init mode> <init parameters>                \
+                    [<particle layout> [<AoSoA block>]]
 
          The output consists of diagnostics to make sure the
          algorithm worked, and of timing statistics.
@@ -93,6 +94,19 @@ HISTORY: - Written by Evangelos Georganas, August 2015.
 #define PATCH      3
 #define UNDEFINED  4
 
+#define AOS        0
+#define SOA        1
+#define AOSOA      2
+
+#define DEP_NONE    0
+#define DEP_ATOMIC  1
+#define DEP_PRIVATE 2
+
+#define DG(i,j,L) Dgrid[(j)*(L+1)+i]
+
+/* number of double fields per particle touched in the push loop */
+#define TILE_FIELDS 5
+
 typedef struct {
   uint64_t left;
   uint64_t right;
@@ -114,6 +128,17 @@ typedef struct particle_t {
   int64_t  m; //  determines how many cells particles move per time step in the y direction
 } particle_t;
 
+/* Structure-of-arrays storage for the fields touched in the push loop;
+   the remaining particle_t fields are only needed for verification and
+   stay in the AoS array */
+typedef struct {
+  double   *x;
+  double   *y;
+  double   *v_x;
+  double   *v_y;
+  double   *q;
+} particle_soa_t;
+
 /* Initializes the grid of charges
   We follow a column major format for the grid. Note that this may affect cache performance, depending on access pattern of particles. */
 
@@ -406,33 +431,34 @@ void computeCoulomb(double x_dist, double y_dist, double q1, double q2, double *
 }
 
 /* Computes the total Coulomb force on a particle exerted from the charges of the corresponding cell */
-void computeTotalForce(particle_t p, uint64_t L, double *Qgrid, double *fx, double *fy){
+void computeTotalForceCoords(double p_x, double p_y, double p_q, uint64_t L,
+                             double *Qgrid, double *fx, double *fy){
   uint64_t  y, x;
   double   tmp_fx, tmp_fy, rel_y, rel_x, tmp_res_x = 0.0, tmp_res_y = 0.0;
 
   /* Coordinates of the cell containing the particle */
-  y = (uint64_t) floor(p.y);
-  x = (uint64_t) floor(p.x);
-  rel_x = p.x -  x;
-  rel_y = p.y -  y;
+  y = (uint64_t) floor(p_y);
+  x = (uint64_t) floor(p_x);
+  rel_x = p_x -  x;
+  rel_y = p_y -  y;
 
   /* Coulomb force from top-left charge */
-  computeCoulomb(rel_x, rel_y, p.q, QG(y,x,L), &tmp_fx, &tmp_fy);
+  computeCoulomb(rel_x, rel_y, p_q, QG(y,x,L), &tmp_fx, &tmp_fy);
   tmp_res_x += tmp_fx;
   tmp_res_y += tmp_fy;
 
   /* Coulomb force from bottom-left charge */
-  computeCoulomb(rel_x, 1.0-rel_y, p.q, QG(y+1,x,L), &tmp_fx, &tmp_fy);
+  computeCoulomb(rel_x, 1.0-rel_y, p_q, QG(y+1,x,L), &tmp_fx, &tmp_fy);
   tmp_res_x += tmp_fx;
   tmp_res_y -= tmp_fy;
 
   /* Coulomb force from top-right charge */
-  computeCoulomb(1.0-rel_x, rel_y, p.q, QG(y,x+1,L), &tmp_fx, &tmp_fy);
+  computeCoulomb(1.0-rel_x, rel_y, p_q, QG(y,x+1,L), &tmp_fx, &tmp_fy);
   tmp_res_x -= tmp_fx;
   tmp_res_y += tmp_fy;
 
   /* Coulomb force from bottom-right charge */
-  computeCoulomb(1.0-rel_x, 1.0-rel_y, p.q, QG(y+1,x+1,L), &tmp_fx, &tmp_fy);
+  computeCoulomb(1.0-rel_x, 1.0-rel_y, p_q, QG(y+1,x+1,L), &tmp_fx, &tmp_fy);
   tmp_res_x -= tmp_fx;
   tmp_res_y -= tmp_fy;
 
@@ -440,6 +466,65 @@ void computeTotalForce(particle_t p, uint64_t L, double *Qgrid, double *fx, doub
   (*fy) = tmp_res_y;
 }
 
+void computeTotalForce(particle_t p, uint64_t L, double *Qgrid, double *fx, double *fy){
+  computeTotalForceCoords(p.x, p.y, p.q, L, Qgrid, fx, fy);
+}
+
+/* Copies the push-loop fields between the AoS particle array and the
+   alternative layouts; conversion happens outside the timed loop, so
+   the physics and verification are identical for all layouts */
+void packSoA(uint64_t n, particle_t *p, particle_soa_t *s) {
+  uint64_t i;
+  for (i=0; i<n; i++) {
+    s->x[i]   = p[i].x;
+    s->y[i]   = p[i].y;
+    s->v_x[i] = p[i].v_x;
+    s->v_y[i] = p[i].v_y;
+    s->q[i]   = p[i].q;
+  }
+}
+
+void unpackSoA(uint64_t n, particle_soa_t *s, particle_t *p) {
+  uint64_t i;
+  for (i=0; i<n; i++) {
+    p[i].x   = s->x[i];
+    p[i].y   = s->y[i];
+    p[i].v_x = s->v_x[i];
+    p[i].v_y = s->v_y[i];
+  }
+}
+
+/* AoSoA: tiles of `block` particles; each tile stores block x values,
+   then block y, v_x, v_y and q values contiguously */
+void packAoSoA(uint64_t n, uint64_t block, particle_t *p, double *buf) {
+  uint64_t i, tile, lane;
+  double *base;
+  for (i=0; i<n; i++) {
+    tile = i/block;
+    lane = i%block;
+    base = buf + tile*TILE_FIELDS*block;
+    base[        lane] = p[i].x;
+    base[  block+lane] = p[i].y;
+    base[2*block+lane] = p[i].v_x;
+    base[3*block+lane] = p[i].v_y;
+    base[4*block+lane] = p[i].q;
+  }
+}
+
+void unpackAoSoA(uint64_t n, uint64_t block, double *buf, particle_t *p) {
+  uint64_t i, tile, lane;
+  double *base;
+  for (i=0; i<n; i++) {
+    tile = i/block;
+    lane = i%block;
+    base = buf + tile*TILE_FIELDS*block;
+    p[i].x   = base[        lane];
+    p[i].y   = base[  block+lane];
+    p[i].v_x = base[2*block+lane];
+    p[i].v_y = base[3*block+lane];
+  }
+}
+
 int bad_patch(bbox_t *patch, bbox_t *patch_contain) {
   if (patch->left>=patch->right || patch->bottom>=patch->top) return(1);
   if (patch_contain) {
@@ -466,7 +551,18 @@ int main(int argc, char ** argv) {
   int         correctness = 1;   // determines whether simulation was correct
   double      *Qgrid;            // field of fixed charges
   particle_t  *particles, *p;    // the particles array
-  uint64_t    iter, i;           // dummies
+  uint64_t    layout;            // particle storage layout for the push loop
+  uint64_t    layout_block = 32; // particles per AoSoA tile
+  particle_soa_t soa;            // SoA particle storage
+  double      *aosoa;            // AoSoA particle storage
+  double      *tx, *ty, *tvx, *tvy, *tq; // AoSoA tile field pointers
+  uint64_t    deposition;        // charge-deposition strategy to benchmark
+  double      *Dgrid;            // field of deposited charge
+  double      *Pgrid;            // thread-private deposition grids
+  uint64_t    gsize;             // number of grid points
+  double      dep_time;          // deposition timing
+  double      qsum, qabs, gsum;  // deposition verification sums
+  uint64_t    iter, i, it, l, ntiles, lanes; // dummies
   double      fx, fy, ax, ay;    // forces and accelerations
 #if UNUSED
   int         particles_per_cell;// number of particles per cell to be injected
@@ -494,11 +590,13 @@ int main(int argc, char ** argv) {
     printf("             \"SINUSOIDAL\" parameters: none\n");
     printf("             \"LINEAR\"     parameters: <negative slope> <constant offset>\n");
     printf("             \"PATCH\"      parameters: <xleft> <xright>  <ybottom> <ytop>\n");
+    printf("   particle layout (optional): \"AOS\" (default), \"SOA\", or \"AOSOA\" [<block>]\n");
+    printf("   deposition mode (optional, requires layout): \"ATOMIC\" or \"PRIVATE\"\n");
     exit(SUCCESS);
   }
 
   /* Take number of threads to request from command line */
-  nthread_input = atoi(*++argv);
+  nthread_input = atoi(*++argv); args_used++;
 
   if ((nthread_input < 1) || (nthread_input > MAX_THREADS)) {
     printf("ERROR: Invalid number of threads: %d\n", nthread_input);
@@ -582,6 +680,48 @@ int main(int argc, char ** argv) {
     }
   }
 
+  /* optional particle storage layout for the push loop */
+  layout = AOS;
+  if (argc>args_used) {
+    char *layout_name = *++argv; args_used++;
+    if (!layout_name) {
+      printf("ERROR: Missing particle layout argument\n");
+      exit(FAILURE);
+    }
+    if      (strcmp(layout_name, "AOS") == 0) layout = AOS;
+    else if (strcmp(layout_name, "SOA") == 0) layout = SOA;
+    else if (strcmp(layout_name, "AOSOA") == 0) {
+      layout = AOSOA;
+      if (argc>args_used) {
+        layout_block = atol(*++argv); args_used++;
+      }
+      if (layout_block<1) {
+        printf("ERROR: AoSoA block must be positive: %" PRIu64 "\n", layout_block);
+        exit(FAILURE);
+      }
+    }
+    else {
+      printf("ERROR: Unsupported particle layout: %s\n", layout_name);
+      exit(FAILURE);
+    }
+  }
+
+  /* optional charge-deposition microbenchmark, reported separately from the push */
+  deposition = DEP_NONE;
+  if (argc>args_used) {
+    char *dep_name = *++argv; args_used++;
+    if (!dep_name) {
+      printf("ERROR: Missing deposition mode argument\n");
+      exit(FAILURE);
+    }
+    if      (strcmp(dep_name, "ATOMIC")  == 0) deposition = DEP_ATOMIC;
+    else if (strcmp(dep_name, "PRIVATE") == 0) deposition = DEP_PRIVATE;
+    else {
+      printf("ERROR: Unsupported deposition mode: %s\n", dep_name);
+      exit(FAILURE);
+    }
+  }
+
   #pragma omp parallel
   {
 
@@ -615,6 +755,19 @@ int main(int argc, char ** argv) {
     }
     printf("Particle charge semi-increment = %"PRIu64"\n", k);
     printf("Vertical velocity              = %"PRIu64"\n", m);
+    switch(layout) {
+    case AOS:   printf("Particle layout                = AoS\n");   break;
+    case SOA:   printf("Particle layout                = SoA\n");   break;
+    case AOSOA: printf("Particle layout                = AoSoA, block %" PRIu64 "\n",
+                       layout_block);                               break;
+    }
+    switch(deposition) {
+    case DEP_NONE:                                                             break;
+    case DEP_ATOMIC:  printf("Charge deposition              = per-cell atomics\n");
+                                                                               break;
+    case DEP_PRIVATE: printf("Charge deposition              = private grids, tree reduction\n");
+                                                                               break;
+    }
 
     /* Initialize grid of charges and particles */
     Qgrid = initializeGrid(L);
@@ -634,6 +787,29 @@ int main(int argc, char ** argv) {
   bail_out(num_error);
   }
 
+  /* convert the particle array to the requested layout outside the timed loop */
+  if (layout == SOA) {
+    soa.x   = (double*) prk_malloc(n*sizeof(double));
+    soa.y   = (double*) prk_malloc(n*sizeof(double));
+    soa.v_x = (double*) prk_malloc(n*sizeof(double));
+    soa.v_y = (double*) prk_malloc(n*sizeof(double));
+    soa.q   = (double*) prk_malloc(n*sizeof(double));
+    if (!soa.x || !soa.y || !soa.v_x || !soa.v_y || !soa.q) {
+      printf("ERROR: Could not allocate space for SoA particles\n");
+      exit(EXIT_FAILURE);
+    }
+    packSoA(n, particles, &soa);
+  }
+  if (layout == AOSOA) {
+    ntiles = (n+layout_block-1)/layout_block;
+    aosoa = (double*) prk_malloc(ntiles*TILE_FIELDS*layout_block*sizeof(double));
+    if (aosoa == NULL) {
+      printf("ERROR: Could not allocate space for AoSoA particles\n");
+      exit(EXIT_FAILURE);
+    }
+    packAoSoA(n, layout_block, particles, aosoa);
+  }
+
   for (iter=0; iter<=iterations; iter++) {
 
     /* start the timer after one warm-up time step */
@@ -642,6 +818,9 @@ int main(int argc, char ** argv) {
     }
 
     /* Calculate forces on particles and update positions */
+    switch (layout) {
+
+    case AOS:
     #pragma omp parallel for private(i, p, fx, fy, ax, ay)
     for (i=0; i<n; i++) {
       p = particles;
@@ -659,10 +838,58 @@ int main(int argc, char ** argv) {
       p[i].v_x += ax * DT;
       p[i].v_y += ay * DT;
     }
+    break;
+
+    case SOA:
+    #pragma omp parallel for private(i, fx, fy, ax, ay)
+    for (i=0; i<n; i++) {
+      fx = 0.0;
+      fy = 0.0;
+      computeTotalForceCoords(soa.x[i], soa.y[i], soa.q[i], L, Qgrid, &fx, &fy);
+      ax = fx * MASS_INV;
+      ay = fy * MASS_INV;
+
+      soa.x[i] = fmod(soa.x[i] + soa.v_x[i]*DT + 0.5*ax*DT*DT + L, L);
+      soa.y[i] = fmod(soa.y[i] + soa.v_y[i]*DT + 0.5*ay*DT*DT + L, L);
+
+      soa.v_x[i] += ax * DT;
+      soa.v_y[i] += ay * DT;
+    }
+    break;
+
+    case AOSOA:
+    #pragma omp parallel for private(it, l, lanes, tx, ty, tvx, tvy, tq, fx, fy, ax, ay)
+    for (it=0; it<ntiles; it++) {
+      tx  = aosoa + it*TILE_FIELDS*layout_block;
+      ty  = tx  + layout_block;
+      tvx = ty  + layout_block;
+      tvy = tvx + layout_block;
+      tq  = tvy + layout_block;
+      lanes = MIN(layout_block, n - it*layout_block);
+      for (l=0; l<lanes; l++) {
+        fx = 0.0;
+        fy = 0.0;
+        computeTotalForceCoords(tx[l], ty[l], tq[l], L, Qgrid, &fx, &fy);
+        ax = fx * MASS_INV;
+        ay = fy * MASS_INV;
+
+        tx[l] = fmod(tx[l] + tvx[l]*DT + 0.5*ax*DT*DT + L, L);
+        ty[l] = fmod(ty[l] + tvy[l]*DT + 0.5*ay*DT*DT + L, L);
+
+        tvx[l] += ax * DT;
+        tvy[l] += ay * DT;
+      }
+    }
+    break;
+    }
   }
 
   pic_time = wtime() - pic_time;
 
+  /* bring positions and velocities back to the AoS array for verification */
+  if (layout == SOA)   unpackSoA(n, &soa, particles);
+  if (layout == AOSOA) unpackAoSoA(n, layout_block, aosoa, particles);
+
   /* Run the verification test */
   for (i=0; i<n; i++) {
     correctness *= verifyParticle(particles[i], iterations, Qgrid, L);
@@ -679,5 +906,119 @@ int main(int argc, char ** argv) {
     printf("Solution does not validate\n");
   }
 
+  /*******************************************************************************
+  ** charge-deposition microbenchmark: scatter each particle's charge
+  ** bilinearly to the four surrounding grid points with the selected
+  ** accumulation strategy; particle positions are left untouched
+  ********************************************************************************/
+
+  if (deposition != DEP_NONE) {
+
+    gsize = (L+1)*(L+1);
+    Dgrid = (double*) prk_malloc(gsize*sizeof(double));
+    if (Dgrid == NULL) {
+      printf("ERROR: Could not allocate space for deposition grid\n");
+      exit(EXIT_FAILURE);
+    }
+    for (i=0; i<gsize; i++) Dgrid[i] = 0.0;
+
+    Pgrid = NULL;
+    if (deposition == DEP_PRIVATE) {
+      Pgrid = (double*) prk_malloc((size_t)nthread*gsize*sizeof(double));
+      if (Pgrid == NULL) {
+        printf("ERROR: Could not allocate space for private deposition grids\n");
+        exit(EXIT_FAILURE);
+      }
+    }
+
+    for (iter=0; iter<=iterations; iter++) {
+
+      /* start the timer after one warm-up time step */
+      if (iter==1) dep_time = wtime();
+
+      if (deposition == DEP_ATOMIC) {
+
+        #pragma omp parallel for private(i)
+        for (i=0; i<n; i++) {
+          uint64_t cx = (uint64_t) floor(particles[i].x);
+          uint64_t cy = (uint64_t) floor(particles[i].y);
+          double rel_x = particles[i].x - cx;
+          double rel_y = particles[i].y - cy;
+          double q = particles[i].q;
+          #pragma omp atomic
+          DG(cy,  cx,  L) += q*(1.0-rel_x)*(1.0-rel_y);
+          #pragma omp atomic
+          DG(cy+1,cx,  L) += q*(1.0-rel_x)*rel_y;
+          #pragma omp atomic
+          DG(cy,  cx+1,L) += q*rel_x*(1.0-rel_y);
+          #pragma omp atomic
+          DG(cy+1,cx+1,L) += q*rel_x*rel_y;
+        }
+
+      } else { /* DEP_PRIVATE */
+
+        #pragma omp parallel private(i)
+        {
+          int      tid = omp_get_thread_num();
+          int      nt  = omp_get_num_threads();
+          int      stride;
+          int64_t  c;
+          double   *mygrid = Pgrid + (size_t)tid*gsize;
+
+          /* zero the private copy */
+          for (c=0; c<(int64_t)gsize; c++) mygrid[c] = 0.0;
+
+          #pragma omp for
+          for (i=0; i<n; i++) {
+            uint64_t cx = (uint64_t) floor(particles[i].x);
+            uint64_t cy = (uint64_t) floor(particles[i].y);
+            double rel_x = particles[i].x - cx;
+            double rel_y = particles[i].y - cy;
+            double q = particles[i].q;
+            mygrid[(cx  )*(L+1)+cy  ] += q*(1.0-rel_x)*(1.0-rel_y);
+            mygrid[(cx  )*(L+1)+cy+1] += q*(1.0-rel_x)*rel_y;
+            mygrid[(cx+1)*(L+1)+cy  ] += q*rel_x*(1.0-rel_y);
+            mygrid[(cx+1)*(L+1)+cy+1] += q*rel_x*rel_y;
+          }
+
+          /* pairwise tree reduction of the private grids */
+          for (stride=1; stride<nt; stride*=2) {
+            #pragma omp barrier
+            if ((tid % (2*stride)) == 0 && tid+stride < nt) {
+              double *other = Pgrid + (size_t)(tid+stride)*gsize;
+              for (c=0; c<(int64_t)gsize; c++) mygrid[c] += other[c];
+            }
+          }
+          #pragma omp barrier
+
+          /* accumulate the combined grid into the deposition field */
+          #pragma omp for
+          for (c=0; c<(int64_t)gsize; c++) Dgrid[c] += Pgrid[c];
+        }
+      }
+    }
+
+    dep_time = wtime() - dep_time;
+
+    /* each time step deposits the total particle charge once */
+    qsum = qabs = 0.0;
+    for (i=0; i<n; i++) {
+      qsum += particles[i].q;
+      qabs += fabs(particles[i].q);
+    }
+    gsum = 0.0;
+    for (i=0; i<gsize; i++) gsum += Dgrid[i];
+
+    if (fabs(gsum - (double)(iterations+1)*qsum) >
+        epsilon*(double)(iterations+1)*qabs) {
+      printf("Deposition does not validate; deposited %lf, expected %lf\n",
+             gsum, (double)(iterations+1)*qsum);
+    } else {
+      printf("Deposition validates\n");
+      printf("Deposition rate (Mparticles_deposited/s): %lf\n",
+             1.0e-6*n*iterations/dep_time);
+    }
+  }
+
   return(EXIT_SUCCESS);
 }
@@ -90,7 +90,15 @@ USAGE:   The program takes as input the number of threads involved, the 2log
          elements that fall inside its chunk. Hence, this version is safe, and
          there is no false sharing. It is also non-scalable.
 
-         <progname>  <# threads> <log2 tablesize> <#update ratio> <vector length>
+         <progname>  <# threads> <log2 tablesize> <#update ratio> <vector length> \
+                     [<batch depth>]
+
+         The optional batch depth breaks the dependent update chain: each
+         stream generates <batch depth> random numbers ahead of the table
+         updates, which are then applied in an independent, gather/scatter-
+         friendly loop. A depth of 0 sweeps powers of two and reports the
+         update rate per depth, to locate the look-ahead depth at which the
+         memory-level parallelism of the machine saturates.
 
 FUNCTIONS CALLED:
 
@@ -198,6 +206,10 @@ int main(int argc, char **argv) {
 #endif
   u64Int * RESTRICT Table;       /* (pseudo-)randomly accessed array               */
   double            random_time;
+  int               batch_depth=-1; /* look-ahead depth; -1 disables batching      */
+  s64Int            chain_len;   /* dependent updates per stream and round         */
+  s64Int            batch_alloc; /* allocated look-ahead depth                     */
+  int               run, num_runs; /* index/number of batch depth sweep runs       */
   int               nthread_input;   /* thread parameters                          */
   int               nthread;
   int               log2tablesize; /* log2 of aggregate table size                 */
@@ -219,9 +231,9 @@ int main(int argc, char **argv) {
 ** process and test input parameters    
 *********************************************************************/
 
-  if (argc != 5){
+  if (argc != 5 && argc != 6){
     printf("Usage: %s <# threads> <log2 tablesize> <#update ratio> ", *argv);
-    printf("<vector length>\n");
+    printf("<vector length> [<batch depth>]\n");
     exit(EXIT_FAILURE);
   }
 
@@ -269,6 +281,15 @@ int main(int argc, char **argv) {
     exit(EXIT_FAILURE);
   }
 
+  if (argc == 6) {
+    batch_depth = atoi(*++argv);
+    if (batch_depth < 0) {
+      printf("ERROR: Invalid batch depth: %d, must be non-negative\n",
+             batch_depth);
+      exit(EXIT_FAILURE);
+    }
+  }
+
 
   /* compute table size carefully to make sure it can be represented        */
   tablesize = 1;
@@ -308,6 +329,20 @@ int main(int argc, char **argv) {
     exit(EXIT_FAILURE);
   }
 
+  /* each stream does this many dependent updates per round */
+  chain_len = nupdate/(nstarts*2);
+  num_runs = 1;
+  batch_alloc = 0;
+  if (batch_depth > 0) {
+    batch_alloc = MIN((s64Int) batch_depth, chain_len);
+  }
+  else if (batch_depth == 0) {
+    /* sweep look-ahead depths in powers of two; MLP saturates long before
+       the chain length, so cap the sweep at a depth of 512                 */
+    for (num_runs=1; ((s64Int)1<<num_runs) <= MIN((s64Int)512, chain_len); num_runs++);
+    batch_alloc = (s64Int)1<<(num_runs-1);
+  }
+
   Table = (u64Int *) prk_malloc(tablespace);
   if (!Table) {
     printf("ERROR: Could not allocate space of "FSTR64U"  bytes for table\n",
@@ -317,7 +352,7 @@ int main(int argc, char **argv) {
 
   error = 0;
 
-  #pragma omp parallel private(i, j, ran, round, index, my_ID) reduction(+:error)
+  #pragma omp parallel private(i, j, ran, round, index, my_ID, run) reduction(+:error)
   {
 
   int my_starts;
@@ -339,6 +374,10 @@ int main(int argc, char **argv) {
     printf("Update ratio           = "FSTR64U"\n", (u64Int) update_ratio);
     printf("Number of updates      = "FSTR64U"\n", nupdate);
     printf("Vector length          = "FSTR64U"\n", (u64Int) nstarts);
+    if (batch_depth > 0)
+    printf("Look-ahead batch depth = "FSTR64U"\n", (u64Int) batch_alloc);
+    else if (batch_depth == 0)
+    printf("Look-ahead batch depth = sweep\n");
     printf("Percent errors allowed = "FSTR64U"\n", (u64Int) ERRORPERCENT);
 #if RESTRICT_KEYWORD
     printf("No aliasing            = on\n");
@@ -373,17 +412,23 @@ int main(int argc, char **argv) {
   }
   bail_out(num_error);
 
+  /* space for the look-ahead batch of this thread's streams */
+  u64Int * RESTRICT batch = NULL;
+  if (batch_alloc > 0) {
+    batch = (u64Int *) prk_malloc(batch_alloc*my_starts*sizeof(u64Int));
+    if (!batch) {
+      printf("ERROR: Thread %d could not allocate space for update batch\n",
+             my_ID);
+      num_error = 1;
+    }
+  }
+  bail_out(num_error);
+
   /* initialize the table */
   #pragma omp for 
   for(i=0;i<tablesize;i++) Table[i] = (u64Int) i;
 
-  #pragma omp barrier
-  #pragma omp master
-  {
-  random_time = wtime();
-  }
-
-  /* ran is privatized. Must make sure for non-chunked version that 
+  /* ran is privatized. Must make sure for non-chunked version that
      we pick the right section of the originally shared ran array          */
 #if CHUNKED
   int offset = 0;
@@ -391,20 +436,33 @@ int main(int argc, char **argv) {
   int offset = my_ID*my_starts;
 #endif
 
-  /* do two identical rounds of Random Access to make sure we recover 
+  for (run=0; run<num_runs; run++) {
+
+  /* batch depth of this run; zero means the original dependent loop      */
+  s64Int depth = (batch_depth < 0) ? 0 :
+                 (batch_depth > 0) ? batch_alloc : ((s64Int)1<<run);
+
+  #pragma omp barrier
+  #pragma omp master
+  {
+  random_time = wtime();
+  }
+
+  /* do two identical rounds of Random Access to make sure we recover
      the initial condition                                                 */
   for (round=0; round <2; round++) {
 
     for (j=0; j<my_starts; j++) {
       ran[j] = PRK_starts(SEQSEED+(nupdate/nstarts)*(j+offset));
     }
+    if (depth == 0) {
     for (j=0; j<my_starts; j++) {
       /* because we do two rounds, we divide nupdates in two               */
       for (i=0; i<nupdate/(nstarts*2); i++) {
         ran[j] = (ran[j] << 1) ^ ((s64Int)ran[j] < 0? POLY: 0);
         index = ran[j] & (tablesize-1);
-#if defined(ATOMIC) 
-        #pragma omp atomic      
+#if defined(ATOMIC)
+        #pragma omp atomic
 #elif defined(CHUNKED)
         if (index >= low && index < up) {
 #endif
@@ -418,13 +476,54 @@ int main(int argc, char **argv) {
 #endif
       }
     }
+    }
+    else {
+    /* generate the chain values a batch ahead of the table updates, so the
+       updates form an independent loop that compilers can gather/scatter;
+       the reordering of updates is benign because XOR commutes             */
+    s64Int done, nbatch, b, kk;
+    for (done=0; done<chain_len; done+=nbatch) {
+      nbatch = MIN(depth, chain_len-done);
+      for (b=0; b<nbatch; b++) {
+        for (j=0; j<my_starts; j++) {
+          ran[j] = (ran[j] << 1) ^ ((s64Int)ran[j] < 0? POLY: 0);
+          batch[b*my_starts+j] = ran[j];
+        }
+      }
+      for (kk=0; kk<nbatch*my_starts; kk++) {
+        index = batch[kk] & (tablesize-1);
+#if defined(ATOMIC)
+        #pragma omp atomic
+#elif defined(CHUNKED)
+        if (index >= low && index < up) {
+#endif
+          Table[index] ^= batch[kk];
+#if VERBOSE
+          #pragma omp atomic
+          Hist[index] += 1;
+#endif
+#if CHUNKED
+        }
+#endif
+      }
+    }
+    }
   }
 
-  #pragma omp master 
-  { 
+  if (num_runs > 1) {
+    #pragma omp barrier
+  }
+  #pragma omp master
+  {
   random_time = wtime() - random_time;
+  if (num_runs > 1) {
+    printf("Batch depth: "FSTR64U" Rate (GUPs/s): %lf\n",
+           (u64Int) depth, 1.e-9*nupdate/random_time);
+  }
   }
 
+  } /* end of batch depth sweep runs                                       */
+
   } /* end of OpenMP parallel region                                       */
 
   /* verification test */
@@ -444,8 +543,9 @@ int main(int argc, char **argv) {
   }
   else {
     printf("Solution validates, number of errors: %ld\n",(long) error);
-    printf("Rate (GUPs/s): %lf, time (s) = %lf\n", 
-           1.e-9*nupdate/random_time,random_time);
+    if (num_runs == 1)
+      printf("Rate (GUPs/s): %lf, time (s) = %lf\n",
+             1.e-9*nupdate/random_time,random_time);
   }
 
 #if VERBOSE
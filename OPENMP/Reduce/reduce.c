@@ -102,7 +102,8 @@ int main(int argc, char ** argv)
   double epsilon=1.e-8;   /* error tolerance                                 */
   int    group_size,      /* size of aggregating half of thread pool         */
          old_size,        /* group size in previous binary tree iteration    */
-         i, id, iter, stage; /* dummies                                      */
+         id, iter, stage; /* dummies                                         */
+  long   i;               /* element index                                   */
   double element_value;   /* reference element value for final vector        */
   char   *algorithm;      /* reduction algorithm selector                    */
   int    intalgorithm;    /* integer encoding of algorithm selector          */
@@ -366,7 +367,7 @@ int main(int argc, char ** argv)
 
   for (i=0; i<vector_length; i++) {
     if (ABS(VEC0(0,i) - element_value) >= epsilon) {
-       printf("First error at i=%d; value: %lf; reference value: %lf\n",
+       printf("First error at i=%ld; value: %lf; reference value: %lf\n",
               i, VEC0(0,i), element_value);
        exit(EXIT_FAILURE);
     }
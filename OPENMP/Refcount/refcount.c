@@ -42,9 +42,20 @@ USAGE:   The program takes as input the total number of times the reference
          involved.
  
                <progname>  <# threads><# iterations> <length of private triad vector> [lock hint]
-  
-         The output consists of diagnostics to make sure the 
+
+         The output consists of diagnostics to make sure the
          algorithm worked, and of timing statistics.
+
+         Compiling with SHARDED=1 replaces each contended counter with a
+         set of cache-line-padded shards that is aggregated on read. The
+         number of shards in use is adapted at run time: the update loop
+         is split into epochs, and as long as doubling the shard count
+         keeps improving the measured epoch throughput the counter keeps
+         growing, up to one shard per thread; the first doubling that
+         does not pay is rolled back and the count is frozen. The final
+         shard count, the update throughput, and the measured cost of an
+         aggregated read are all reported, which is the tradeoff a
+         sharding heuristic has to navigate.
  
 FUNCTIONS CALLED:
  
@@ -78,6 +89,14 @@ HISTORY: Written by Rob Van der Wijngaart, January 2006.
   #define DTYPE double
 #endif
 
+#if SHARDED
+  #if DEPENDENT || !CONTENDED
+    #error SHARDED mode requires CONTENDED=1 and DEPENDENT=0
+  #endif
+  /* one shard per cache line, so shards never false-share */
+  #define SHARD_STRIDE (64/sizeof(DTYPE))
+#endif
+
 /* declare a simple function that does some work                                */
 void private_stream(double *a, double *b, double *c, size_t size) {
   size_t j;
@@ -130,6 +149,19 @@ int main(int argc, char ** argv)
 #if _OPENMP>=201611
   omp_lock_hint_t lock_hint;  /* indicated type of lock hint (if using locks)   */
   char const * lock_hint_name;
+#endif
+#if SHARDED
+  DTYPE      *shards1,        /* padded shards of the two counters              */
+             *shards2;
+  int        num_shards=1,    /* shards currently in use                        */
+             prev_shards=1,   /* best shard count seen so far                   */
+             max_shards,      /* allocation cap: one shard per thread           */
+             growing=1;       /* the adaptive policy is still exploring         */
+  long       next_iter,       /* first update of the next epoch                 */
+             epoch_chunk,     /* updates in the current epoch                   */
+             epoch_size;
+  double     best_rate=0.0,   /* best epoch throughput observed so far          */
+             epoch_start;
 #endif
   int        error=0;         /* global errors                                  */
  
@@ -241,6 +273,10 @@ int main(int argc, char ** argv)
 #else
     printf("Counter access                 = uncontended\n");
 #endif
+#if SHARDED
+    printf("Counter layout                 = sharded, adaptive (at most %d shards)\n",
+           nthread);
+#endif
 #if DEPENDENT
     printf("Counter pair update type       = dependent\n");
 #else
@@ -303,6 +339,26 @@ int main(int argc, char ** argv)
   COUNTER1 = 1.0;
   COUNTER2 = 0.0;
 
+#if SHARDED
+  /* all shards are allocated up front; the adaptive policy only decides
+     how many of them the threads spread their updates over             */
+  max_shards = omp_get_num_threads();
+  shards1 = (DTYPE *) prk_malloc(2*max_shards*SHARD_STRIDE*sizeof(DTYPE));
+  if (!shards1) {
+    printf("ERROR: could not allocate space for counter shards\n");
+    exit(EXIT_FAILURE);
+  }
+  shards2 = shards1 + max_shards*SHARD_STRIDE;
+  for (j=0; j<2*max_shards*SHARD_STRIDE; j++) shards1[j] = 0;
+  /* seed shard 0 with the initial counter values */
+  shards1[0] = COUNTER1;
+  shards2[0] = COUNTER2;
+  next_iter  = omp_get_num_threads();
+  /* enough epochs for the policy to explore every shard count and then
+     settle, even on wide machines                                      */
+  epoch_size = MAX((long)iterations/32, 1);
+#endif
+
   /* initialize the lock on which we will be pounding */
 #if LOCK==2
   #if _OPENMP>=201611
@@ -330,6 +386,11 @@ int main(int argc, char ** argv)
   #if LOCK==2
   omp_unset_lock(pcounter_lock);
   #endif
+#elif SHARDED
+  #pragma omp atomic
+  shards1[0]++;
+  #pragma omp atomic
+  shards2[0]++;
 #else
   #if LOCK==2
     omp_set_lock(pcounter_lock);
@@ -357,10 +418,53 @@ int main(int argc, char ** argv)
   refcount_time = wtime();
   }
 
-#if CONTENDED 
+#if SHARDED
+  /* the update loop is cut into epochs; each epoch is timed, and between
+     epochs one thread runs the shard policy: keep doubling the number of
+     shards while the epoch throughput keeps improving, roll back the
+     first doubling that does not pay and freeze                        */
+  while (next_iter <= (long)iterations) {
+    long k;
+    int  my_shard;
+    #pragma omp single
+    {
+    epoch_chunk = MIN(epoch_size, (long)iterations-next_iter+1);
+    epoch_start = wtime();
+    }
+    my_shard = (omp_get_thread_num()%num_shards)*SHARD_STRIDE;
+    #pragma omp for
+    for (k=0; k<epoch_chunk; k++) {
+      #pragma omp atomic
+      shards1[my_shard]++;
+      #pragma omp atomic
+      shards2[my_shard]++;
+#if STREAM
+      private_stream(a, b, c, stream_size);
+#endif
+    }
+    #pragma omp single
+    {
+    double epoch_rate = epoch_chunk/(wtime()-epoch_start);
+    if (growing) {
+      if (epoch_rate > 1.05*best_rate) {
+        best_rate   = epoch_rate;
+        prev_shards = num_shards;
+        if (num_shards < max_shards) num_shards *= 2;
+        else                         growing = 0;
+      } else {
+        num_shards = prev_shards;
+        growing = 0;
+      }
+      if (num_shards > max_shards) num_shards = max_shards;
+    }
+    next_iter += epoch_chunk;
+    }
+  }
+#else
+#if CONTENDED
   #pragma omp for
   /* skip some iterations to take into account pre-loop iter  */
-  for (iter=nthread; iter<=iterations; iter++) { 
+  for (iter=nthread; iter<=iterations; iter++) {
 #else
   for (iter=1; iter<=iterations; iter++) { 
 #endif
@@ -397,20 +501,38 @@ int main(int argc, char ** argv)
     private_stream(a, b, c, stream_size);
 #endif
   }
+#endif
 
   #pragma omp single
-  { 
+  {
   refcount_time = wtime() - refcount_time;
   }
 
   /* check whether the private work has been done correctly           */
   aj = A0; bj = B0; cj = C0;
+#if SHARDED
+  /* replay the epoch split so every thread reconstructs its own
+     private stream call count                                        */
+  {
+  long done = nthread, chunk, k;
+  aj += bj + SCALAR*cj;   /* pre-loop call */
+  while (done <= (long)iterations) {
+    chunk = MIN(epoch_size, (long)iterations-done+1);
+    #pragma omp for
+    for (k=0; k<chunk; k++) {
+      aj += bj + SCALAR*cj;
+    }
+    done += chunk;
+  }
+  }
+#else
 #if CONTENDED
   #pragma omp for
 #endif
   for (iter=0; iter<=iterations; iter++) {
     aj += bj + SCALAR*cj;
   }
+#endif
 
   for (j=0; j<stream_size; j++) {
     num_error += MAX(ABS(a[j]-aj)>epsilon,num_error);
@@ -427,6 +549,18 @@ int main(int argc, char ** argv)
   {
 #endif
 
+#if SHARDED
+  /* an aggregated read folds all allocated shards: shards beyond the
+     final count still hold updates from the exploration epochs        */
+  {
+  int s;
+  COUNTER1 = 0; COUNTER2 = 0;
+  for (s=0; s<max_shards; s++) {
+    COUNTER1 += shards1[s*SHARD_STRIDE];
+    COUNTER2 += shards2[s*SHARD_STRIDE];
+  }
+  }
+#endif
 #if DEPENDENT
   refcounter1 = cos(iterations+1);
   refcounter2 = sin(iterations+1);
@@ -465,8 +599,27 @@ int main(int argc, char ** argv)
     updates=iterations*nthread;
 #endif
 
-    printf("Rate (MCPUPs/s): %lf time (s): %lf\n", 
+    printf("Rate (MCPUPs/s): %lf time (s): %lf\n",
            updates/refcount_time*1.e-6, refcount_time);
+#if SHARDED
+    {
+    /* the price of sharding: an aggregated read touches one cache line
+       per allocated shard instead of one location                     */
+    long   r, nreads = 1000000;
+    double sink = 0.0, read_time;
+    int    s;
+    read_time = wtime();
+    for (r=0; r<nreads; r++) {
+      DTYPE agg = 0;
+      for (s=0; s<max_shards; s++) agg += shards1[s*SHARD_STRIDE];
+      sink += agg;
+    }
+    read_time = wtime() - read_time;
+    printf("Final shard count: %d, aggregated read cost (ns): %lf\n",
+           num_shards, 1.e9*read_time/nreads);
+    if (sink < 0) printf("%lf\n", sink); /* defeat dead code elimination */
+    }
+#endif
   }
 
    exit(EXIT_SUCCESS);
@@ -43,6 +43,23 @@ USAGE:   The program takes as input the number of threads, the 2log of the linea
          of times the matrix-vector multiplication is carried out.
 
          <progname> <# threads> <# iterations> <2log root-of-matrix-order> <radius>
+                    [<scatter method>] [<schedule>]
+
+         The optional scatter method (ATOMIC or COLOR) selects the
+         transpose-apply variant of the kernel, in which each matrix row
+         scatters contributions into the result vector instead of
+         gathering them. Rows sharing a column then race; ATOMIC resolves
+         the races with atomic updates, COLOR precolors the rows at setup
+         so that no two rows in the same color share a column and executes
+         color by color without atomics.
+
+         The optional schedule (STATIC, DYNAMIC or GUIDED, with an
+         optional ",<chunk>" suffix) selects how rows are handed out to
+         threads. The static default assumes threads retire rows at the
+         same pace, which heterogeneous (performance/efficiency) cores
+         break; dynamic and guided let fast cores steal rows from the
+         shared queue. When a schedule is given, the work each thread
+         actually completed is reported so the imbalance is measurable.
 
          The output consists of diagnostics to make sure the
          algorithm worked, and of timing statistics.
@@ -63,6 +80,8 @@ HISTORY: Written by Rob Van der Wijngaart, August 2006.
          Updated by RvdW to fix verification bug, February 2013
          Updated by RvdW to sort matrix elements to reflect traditional CSR storage,
          August 2013
+         - Added transpose-apply (scatter) variant with atomic and
+           coloring-based conflict resolution
 
 ***********************************************************************************/
 
@@ -82,9 +101,28 @@ HISTORY: Written by Rob Van der Wijngaart, August 2006.
 
 #define BITS_IN_BYTE 8
 
+/* method used to resolve write conflicts in the scatter (transpose-apply)
+   variant of the kernel                                                          */
+#define no_scatter      5050
+#define scatter_atomic  6060
+#define scatter_color   7070
+
 static u64Int reverse(register u64Int, int);
 static int compare(const void *el1, const void *el2);
 
+/* parse a loop schedule of the form STATIC, DYNAMIC or GUIDED, with an
+   optional ",<chunk>" suffix; returns zero if the spec is not valid        */
+static int parse_schedule(char *spec, omp_sched_t *kind, int *chunk) {
+  char *comma = strchr(spec, ',');
+  if (comma) *chunk = atoi(comma+1);
+  if (*chunk < 0) return 0;
+  if      (!strncmp(spec, "STATIC",  6)) *kind = omp_sched_static;
+  else if (!strncmp(spec, "DYNAMIC", 7)) *kind = omp_sched_dynamic;
+  else if (!strncmp(spec, "GUIDED",  6)) *kind = omp_sched_guided;
+  else return 0;
+  return 1;
+}
+
 int main(int argc, char **argv){
 
   int               iter, r;    /* dummies                                        */
@@ -117,12 +155,29 @@ int main(int argc, char **argv){
   size_t            vector_space, /* variables used to hold prk_malloc sizes          */
                     matrix_space,
                     index_space;
+  int               scatter_mode=no_scatter; /* conflict resolution in scatter mode */
+  int               c;          /* color dummy                                    */
+  int               num_colors=0; /* number of colors used by greedy coloring     */
+  s64Int            row2;       /* dummy                                          */
+  int    * RESTRICT rowColor;   /* color assigned to each matrix row              */
+  s64Int * RESTRICT colStart;   /* start of each column's row list                */
+  s64Int * RESTRICT colRows;    /* rows containing each column (inverse pattern)  */
+  s64Int * RESTRICT mark;       /* row-stamped list of forbidden colors           */
+  s64Int * RESTRICT perm;       /* rows sorted by color                           */
+  s64Int * RESTRICT colorStart; /* start of each color class in perm              */
+  double            color_time; /* time spent coloring the sparsity pattern       */
+  omp_sched_t       sched_kind=omp_sched_static; /* loop schedule of the kernel   */
+  int               sched_chunk=0; /* chunk size of the loop schedule             */
+  int               sched_set=0;/* nonzero if a schedule was requested            */
+  char              *sched_name;/* name of the loop schedule for reporting        */
+  static s64Int     thread_work[MAX_THREADS]; /* nonzeroes processed per thread   */
 
   printf("Parallel Research Kernels version %s\n", PRKVERSION);
   printf("OpenMP Sparse matrix-vector multiplication\n");
 
-  if (argc != 5) {
-    printf("Usage: %s <# threads> <# iterations> <2log grid size> <stencil radius>\n",*argv);
+  if (argc < 5 || argc > 7) {
+    printf("Usage: %s <# threads> <# iterations> <2log grid size> <stencil radius> [<scatter method>] [<schedule: STATIC/DYNAMIC/GUIDED[,chunk]>]\n",
+           *argv);
     exit(EXIT_FAILURE);
   }
 
@@ -166,6 +221,22 @@ int main(int argc, char **argv){
     exit(EXIT_FAILURE);
   }
 
+  /* remaining arguments are a scatter method and/or a loop schedule             */
+  while (--argc >= 5) {
+    if      (!strcmp(*++argv, "ATOMIC")) scatter_mode = scatter_atomic;
+    else if (!strcmp(*argv,   "COLOR"))  scatter_mode = scatter_color;
+    else if (parse_schedule(*argv, &sched_kind, &sched_chunk)) sched_set = 1;
+    else {
+      printf("ERROR: Invalid scatter method or schedule %s\n", *argv);
+      exit(EXIT_FAILURE);
+    }
+  }
+  sched_name = (sched_kind == omp_sched_dynamic) ? "dynamic" :
+               (sched_kind == omp_sched_guided)  ? "guided"  : "static";
+  /* pin down the runtime schedule even when none was requested, so that
+     schedule(runtime) below always means what the static default meant          */
+  omp_set_schedule(sched_kind, sched_chunk);
+
   /* compute total size of star stencil in 2D                                     */
   stencil_size = 4*radius+1;
   /* sparsity follows from number of non-zeroes per row                           */
@@ -211,8 +282,9 @@ int main(int argc, char **argv){
     exit(EXIT_FAILURE);
   }
 
-  #pragma omp parallel private (row, col, elm, first, last, iter)
+  #pragma omp parallel private (row, col, elm, first, last, iter, c)
   {
+  s64Int my_work = 0; /* nonzeroes this thread processes over all sweeps          */
 
   #pragma omp master
   {
@@ -234,6 +306,16 @@ int main(int argc, char **argv){
 #else
     printf("Using canonical indexing\n");
 #endif
+    if      (scatter_mode == scatter_atomic)
+      printf("Scatter (transpose-apply) mode, atomic updates\n");
+    else if (scatter_mode == scatter_color)
+      printf("Scatter (transpose-apply) mode, colored execution\n");
+    if (sched_set) {
+      if (sched_chunk > 0)
+        printf("Loop schedule         = %s, chunk %d\n", sched_name, sched_chunk);
+      else
+        printf("Loop schedule         = %s, default chunk\n", sched_name);
+    }
   }
   }
   bail_out(num_error);
@@ -259,8 +341,79 @@ int main(int argc, char **argv){
     /* sort colIndex to make sure the compressed row accesses
        vector elements in increasing order                                         */
     qsort(&(colIndex[row*stencil_size]), stencil_size, sizeof(s64Int), compare);
+    /* in scatter mode the matrix value must cancel the row (not column) index
+       of the vector element it multiplies, so that the same checksum results     */
     for (elm=row*stencil_size; elm<(row+1)*stencil_size; elm++)
-      matrix[elm] = 1.0/(double)(colIndex[elm]+1);
+      matrix[elm] = (scatter_mode == no_scatter) ?
+                    1.0/(double)(colIndex[elm]+1) : 1.0/(double)(row+1);
+  }
+
+  /* color the rows of the sparsity pattern such that no two rows of the same
+     color share a column; rows within a color can then scatter without atomics.
+     The work is sequential, cheap, and done once, so a single thread does it     */
+  if (scatter_mode == scatter_color) {
+    #pragma omp single
+    {
+      color_time = wtime();
+      colStart = (s64Int *) prk_malloc((size2+1)*sizeof(s64Int));
+      colRows  = (s64Int *) prk_malloc(nent*sizeof(s64Int));
+      rowColor = (int *)    prk_malloc(size2*sizeof(int));
+      mark     = (s64Int *) prk_malloc((stencil_size*(stencil_size-1)+2)*sizeof(s64Int));
+      perm     = (s64Int *) prk_malloc(size2*sizeof(s64Int));
+      if (!colStart || !colRows || !rowColor || !mark || !perm) {
+        printf("ERROR: Could not allocate space for coloring\n");
+        exit(EXIT_FAILURE);
+      }
+
+      /* build the inverse (column-to-rows) map of the sparsity pattern           */
+      for (i=0; i<=size2; i++) colStart[i] = 0;
+      for (elm=0; elm<nent; elm++) colStart[colIndex[elm]+1]++;
+      for (i=0; i<size2; i++) colStart[i+1] += colStart[i];
+      for (row=0; row<size2; row++)
+        for (elm=row*stencil_size; elm<(row+1)*stencil_size; elm++)
+          colRows[colStart[colIndex[elm]]++] = row;
+      /* the fill bumped each column's start to its end; shift back one slot      */
+      for (i=size2; i>0; i--) colStart[i] = colStart[i-1];
+      colStart[0] = 0;
+
+      /* greedy coloring; rows are visited in order, so any row found through
+         the inverse map that precedes the current row has a color already.
+         A row conflicts with at most stencil_size*(stencil_size-1) others,
+         which bounds the number of colors the greedy algorithm can use          */
+      for (c=0; c<stencil_size*(stencil_size-1)+2; c++) mark[c] = -1;
+      for (row=0; row<size2; row++) {
+        for (elm=row*stencil_size; elm<(row+1)*stencil_size; elm++) {
+          col = colIndex[elm];
+          for (j=colStart[col]; j<colStart[col+1]; j++) {
+            row2 = colRows[j];
+            if (row2 < row) mark[rowColor[row2]] = row;
+          }
+        }
+        for (c=0; mark[c]==row; c++);
+        rowColor[row] = c;
+        if (c+1 > num_colors) num_colors = c+1;
+      }
+
+      /* sort the rows by color                                                   */
+      colorStart = (s64Int *) prk_malloc((num_colors+1)*sizeof(s64Int));
+      if (!colorStart) {
+        printf("ERROR: Could not allocate space for color classes\n");
+        exit(EXIT_FAILURE);
+      }
+      for (c=0; c<=num_colors; c++) colorStart[c] = 0;
+      for (row=0; row<size2; row++) colorStart[rowColor[row]+1]++;
+      for (c=0; c<num_colors; c++) colorStart[c+1] += colorStart[c];
+      for (row=0; row<size2; row++) perm[colorStart[rowColor[row]]++] = row;
+      for (c=num_colors; c>0; c--) colorStart[c] = colorStart[c-1];
+      colorStart[0] = 0;
+
+      prk_free(mark);
+      prk_free(colRows);
+      prk_free(colStart);
+      color_time = wtime() - color_time;
+      printf("Number of colors      = %16d\n", num_colors);
+      printf("Coloring time (s)     = %16.6lf\n", color_time);
+    } /* implied barrier publishes perm/colorStart to all threads                 */
   }
 
   for (iter=0; iter<=iterations; iter++) {
@@ -278,16 +431,44 @@ int main(int argc, char **argv){
     #pragma omp for
     for (row=0; row<size2; row++) vector[row] += (double) (row+1);
 
-    /* do the actual matrix-vector multiplication                                 */
-    #pragma omp for
-    for (row=0; row<size2; row++) {
-      first = stencil_size*row; last = first+stencil_size-1;
-      temp=0.0;
-      /* #pragma omp simd reduction(+:temp) */
-      for (col=first; col<=last; col++) {
-        temp += matrix[col]*vector[colIndex[col]];
+    /* do the actual matrix-vector multiplication, or its transpose (scatter)     */
+    if (scatter_mode == no_scatter) {
+      #pragma omp for schedule(runtime)
+      for (row=0; row<size2; row++) {
+        first = stencil_size*row; last = first+stencil_size-1;
+        temp=0.0;
+        /* #pragma omp simd reduction(+:temp) */
+        for (col=first; col<=last; col++) {
+          temp += matrix[col]*vector[colIndex[col]];
+        }
+        result[row] += temp;
+        my_work += stencil_size;
+      }
+    }
+    else if (scatter_mode == scatter_atomic) {
+      #pragma omp for schedule(runtime)
+      for (row=0; row<size2; row++) {
+        first = stencil_size*row; last = first+stencil_size-1;
+        for (col=first; col<=last; col++) {
+          #pragma omp atomic
+          result[colIndex[col]] += matrix[col]*vector[row];
+        }
+        my_work += stencil_size;
+      }
+    }
+    else { /* scatter_color: rows within a color share no column, so no atomics;
+              the implied barrier after each omp for separates the colors         */
+      for (c=0; c<num_colors; c++) {
+        #pragma omp for schedule(runtime)
+        for (j=colorStart[c]; j<colorStart[c+1]; j++) {
+          row = perm[j];
+          first = stencil_size*row; last = first+stencil_size-1;
+          for (col=first; col<=last; col++) {
+            result[colIndex[col]] += matrix[col]*vector[row];
+          }
+          my_work += stencil_size;
+        }
       }
-      result[row] += temp;
     }
   } /* end of iterations                                                          */
 
@@ -297,6 +478,8 @@ int main(int argc, char **argv){
     sparse_time = wtime() - sparse_time;
   }
 
+  thread_work[omp_get_thread_num()] = my_work;
+
   } /* end of parallel region                                                     */
 
   /* verification test                                                            */
@@ -322,6 +505,22 @@ int main(int argc, char **argv){
   printf("Rate (MFlops/s): %lf  Avg time (s): %lf\n",
          1.0E-06 * (2.0*nent)/avgtime, avgtime);
 
+  /* with a dynamic schedule the rows a thread completes track the speed of
+     the core it runs on; report the realized distribution over all sweeps        */
+  if (sched_set) {
+    s64Int work_min=thread_work[0], work_max=thread_work[0];
+    double work_avg=0.0;
+    for (i=0; i<nthread_input; i++) {
+      if (thread_work[i] < work_min) work_min = thread_work[i];
+      if (thread_work[i] > work_max) work_max = thread_work[i];
+      work_avg += (double) thread_work[i];
+    }
+    work_avg /= nthread_input;
+    printf("Thread work (nnz): min "FSTR64U", max "FSTR64U", imbalance %.2lf%%\n",
+           work_min, work_max,
+           (work_avg > 0.0) ? 100.0*((double)work_max/work_avg-1.0) : 0.0);
+  }
+
   exit(EXIT_SUCCESS);
 }
 
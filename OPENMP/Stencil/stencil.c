@@ -43,6 +43,23 @@ USAGE:   The program takes as input the number of threads, the linear
 
                <progname> <# threads> <iterations> <grid size>
 
+         An optional decomposition parameter selects how the grid is
+         carved up among threads: "slab" (default) assigns each thread
+         a block of rows, "tile" a near-square 2D tile, and <tx>x<ty>
+         an explicit thread grid. Slabs become thin at high thread
+         counts, so the halo a thread reads from its neighbors starts
+         to rival its own rows in the cache; 2D tiles keep the
+         halo-to-interior ratio bounded.
+
+         An optional schedule parameter (STATIC, DYNAMIC or GUIDED,
+         with an optional ",<chunk>" suffix) selects how the rows of
+         the slab decomposition are handed out to threads. The static
+         default assumes all cores retire rows at the same pace, which
+         heterogeneous (performance/efficiency) cores break; dynamic
+         and guided let fast cores pull extra rows from the shared
+         queue. When a schedule is given, the work each thread actually
+         completed is reported so the imbalance is measurable.
+
          The output consists of diagnostics to make sure the
          algorithm worked, and of timing statistics.
 
@@ -63,6 +80,8 @@ HISTORY: - Written by Rob Van der Wijngaart, November 2006.
 
 #include <par-res-kern_general.h>
 #include <par-res-kern_omp.h>
+#include <prk_counters.h>
+#include <prk_energy.h>
 
 #if DOUBLE
   #define DTYPE   double
@@ -83,10 +102,42 @@ HISTORY: - Written by Rob Van der Wijngaart, November 2006.
 #define OUT(i,j)      out[i+(j)*(n)]
 #define WEIGHT(ii,jj) weight[ii+RADIUS][jj+RADIUS]
 
+/* bounds of the calling thread's tile, with leftover cells spread
+   over the lowest-numbered tiles, as in the MPI decompositions          */
+static void tile_bounds(int my_ID, int num_tilesx, int num_tilesy, long n,
+                        long *ilo, long *ihi, long *jlo, long *jhi)
+{
+  int  my_IDx   = my_ID%num_tilesx;
+  int  my_IDy   = my_ID/num_tilesx;
+  long width    = n/num_tilesx;
+  long leftover = n%num_tilesx;
+  if (my_IDx < leftover) { *ilo = (width+1)*my_IDx; *ihi = *ilo + width + 1; }
+  else                   { *ilo = width*my_IDx + leftover; *ihi = *ilo + width; }
+  width    = n/num_tilesy;
+  leftover = n%num_tilesy;
+  if (my_IDy < leftover) { *jlo = (width+1)*my_IDy; *jhi = *jlo + width + 1; }
+  else                   { *jlo = width*my_IDy + leftover; *jhi = *jlo + width; }
+}
+
+/* parse a loop schedule of the form STATIC, DYNAMIC or GUIDED, with an
+   optional ",<chunk>" suffix; returns zero if the spec is not valid    */
+static int parse_schedule(char *spec, omp_sched_t *kind, int *chunk)
+{
+  char *comma = strchr(spec, ',');
+  if (comma) *chunk = atoi(comma+1);
+  if (*chunk < 0) return 0;
+  if      (!strncmp(spec, "STATIC",  6)) *kind = omp_sched_static;
+  else if (!strncmp(spec, "DYNAMIC", 7)) *kind = omp_sched_dynamic;
+  else if (!strncmp(spec, "GUIDED",  6)) *kind = omp_sched_guided;
+  else return 0;
+  return 1;
+}
+
 int main(int argc, char ** argv) {
 
   long   n;               /* linear grid dimension                               */
-  int    i, j, ii, jj, it, jt, iter;  /* dummies                                 */
+  long   i, j, ii, jj, it, jt;  /* grid indices                                  */
+  int    iter;            /* iteration counter                                   */
   DTYPE  norm,            /* L1 norm of solution                                 */
          reference_norm;
   DTYPE  f_active_points; /* interior of grid with respect to stencil            */
@@ -102,6 +153,16 @@ int main(int argc, char ** argv) {
   long   total_length;    /* total required length to store grid values          */
   int    num_error=0;     /* flag that signals that requested and obtained
                              numbers of threads are the same                     */
+  char   *affinity="none";/* thread placement policy                             */
+  int    num_tilesx=0,    /* thread tiles in each grid direction; zero           */
+         num_tilesy;      /* selects the default 1D slab decomposition           */
+  int    pin_active;      /* cpus in the pinning order, 0 if unbound             */
+  static int thread_cpu[MAX_THREADS]; /* realized binding of each thread         */
+  omp_sched_t sched_kind=omp_sched_static; /* loop schedule of the slab loops    */
+  int    sched_chunk=0;   /* chunk size of the loop schedule                     */
+  int    sched_set=0;     /* nonzero if a schedule was requested                 */
+  char   *sched_name;     /* name of the loop schedule for reporting             */
+  static long thread_work[MAX_THREADS]; /* grid points processed per thread      */
   DTYPE  weight[2*RADIUS+1][2*RADIUS+1]; /* weights of points in the stencil     */
 
   printf("Parallel Research Kernels version %s\n", PRKVERSION);
@@ -111,8 +172,8 @@ int main(int argc, char ** argv) {
   ** process and test input parameters
   ********************************************************************************/
 
-  if (argc != 4){
-    printf("Usage: %s <# threads> <# iterations> <array dimension>\n",
+  if (argc < 4 || argc > 7){
+    printf("Usage: %s <# threads> <# iterations> <array dimension> [<affinity: core/socket/none>] [<decomposition: slab/tile/<tx>x<ty>>] [<schedule: STATIC/DYNAMIC/GUIDED[,chunk]>]\n",
            *argv);
     return(EXIT_FAILURE);
   }
@@ -140,6 +201,57 @@ int main(int argc, char ** argv) {
     exit(EXIT_FAILURE);
   }
 
+  if (argc >= 5) affinity = *++argv;
+  pin_active = prk_affinity_init(affinity);
+
+  if (argc >= 6) {
+    char *decomp = *++argv;
+    if (!strcmp(decomp, "tile")) {
+      /* near-square thread grid, as in the MPI versions                        */
+      for (num_tilesx=(int)(sqrt(nthread_input+1)); num_tilesx>0; num_tilesx--)
+        if (!(nthread_input%num_tilesx)) break;
+      num_tilesy = nthread_input/num_tilesx;
+    }
+    else if (strchr(decomp, 'x')) {
+      num_tilesx = atoi(decomp);
+      num_tilesy = atoi(strchr(decomp, 'x')+1);
+      if (num_tilesx < 1 || num_tilesy < 1 ||
+          num_tilesx*num_tilesy != nthread_input) {
+        printf("ERROR: thread grid %s does not match %d threads\n",
+               decomp, nthread_input);
+        exit(EXIT_FAILURE);
+      }
+    }
+    else if (strcmp(decomp, "slab")) {
+      printf("ERROR: decomposition must be slab, tile, or <tx>x<ty>: %s\n",
+             decomp);
+      exit(EXIT_FAILURE);
+    }
+    if (num_tilesx > n || (num_tilesx > 0 && num_tilesy > n)) {
+      printf("ERROR: thread grid %dx%d exceeds grid size %ld\n",
+             num_tilesx, num_tilesy, n);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  if (argc == 7) {
+    if (!parse_schedule(*++argv, &sched_kind, &sched_chunk)) {
+      printf("ERROR: schedule must be STATIC, DYNAMIC or GUIDED[,chunk]: %s\n",
+             *argv);
+      exit(EXIT_FAILURE);
+    }
+    sched_set = 1;
+    if (num_tilesx > 0) {
+      printf("ERROR: loop schedules apply to the slab decomposition only\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  sched_name = (sched_kind == omp_sched_dynamic) ? "dynamic" :
+               (sched_kind == omp_sched_guided)  ? "guided"  : "static";
+  /* pin down the runtime schedule even when none was requested, so that
+     schedule(runtime) below always means what the static default meant          */
+  omp_set_schedule(sched_kind, sched_chunk);
+
   if (RADIUS < 1) {
     printf("ERROR: Stencil radius %d should be positive\n", RADIUS);
     exit(EXIT_FAILURE);
@@ -189,6 +301,12 @@ int main(int argc, char ** argv) {
 
   #pragma omp parallel private(i, j, ii, jj, it, jt, iter)
   {
+  int my_ID = omp_get_thread_num();
+
+  /* pin before any data is touched so first-touch follows the binding */
+  if (pin_active) prk_affinity_pin(my_ID);
+  thread_cpu[my_ID] = prk_affinity_cpu();
+  #pragma omp barrier
 
   #pragma omp master
   {
@@ -230,6 +348,26 @@ int main(int argc, char ** argv) {
 #else
     printf("Parallel regions     = split (omp parallel for)\n");
 #endif
+    if (num_tilesx > 0)
+      printf("Grid decomposition   = 2D tiles (%d x %d threads)\n",
+             num_tilesx, num_tilesy);
+    else
+      printf("Grid decomposition   = 1D slabs\n");
+    if (sched_set) {
+      if (sched_chunk > 0)
+        printf("Loop schedule        = %s, chunk %d\n", sched_name, sched_chunk);
+      else
+        printf("Loop schedule        = %s, default chunk\n", sched_name);
+    }
+    printf("Affinity policy      = %s\n", affinity);
+    if (pin_active) {
+      printf("Realized binding     =");
+      for (i=0; i<nthread; i++) printf(" %d", thread_cpu[i]);
+      printf("\n");
+    }
+    else {
+      printf("Realized binding     = runtime default\n");
+    }
   }
   }
   bail_out(num_error);
@@ -238,7 +376,27 @@ int main(int argc, char ** argv) {
 }
 #endif
 
-  /* intialize the input and output arrays                                     */
+  /* intialize the input and output arrays; in tile mode each thread touches
+     its own tile first, so its pages land in the right NUMA domain            */
+  if (num_tilesx > 0) {
+#if PARALLELFOR
+    #pragma omp parallel private(i, j)
+#endif
+    {
+      long ilo, ihi, jlo, jhi;
+      tile_bounds(omp_get_thread_num(), num_tilesx, num_tilesy, n,
+                  &ilo, &ihi, &jlo, &jhi);
+      for (j=jlo; j<jhi; j++) for (i=ilo; i<ihi; i++)
+        IN(i,j) = COEFX*i+COEFY*j;
+      for (j=MAX(jlo,RADIUS); j<MIN(jhi,n-RADIUS); j++)
+        for (i=MAX(ilo,RADIUS); i<MIN(ihi,n-RADIUS); i++)
+          OUT(i,j) = (DTYPE)0.0;
+    }
+#if !PARALLELFOR
+    #pragma omp barrier
+#endif
+  }
+  else {
 #if PARALLELFOR
   #pragma omp parallel for private(i)
 #else
@@ -253,6 +411,7 @@ int main(int argc, char ** argv) {
 #endif
   for (j=RADIUS; j<n-RADIUS; j++) for (i=RADIUS; i<n-RADIUS; i++)
     OUT(i,j) = (DTYPE)0.0;
+  }
 
   for (iter = 0; iter<=iterations; iter++){
 
@@ -263,16 +422,54 @@ int main(int argc, char ** argv) {
       #pragma omp master
 #endif
       {
+        prk_counters_start();
+        prk_energy_start();
         stencil_time = wtime();
       }
     }
 
+    if (num_tilesx > 0) {
+#if PARALLELFOR
+    #pragma omp parallel private(i, j, ii, jj)
+#endif
+    {
+      long ilo, ihi, jlo, jhi;
+      tile_bounds(omp_get_thread_num(), num_tilesx, num_tilesy, n,
+                  &ilo, &ihi, &jlo, &jhi);
+      for (j=MAX(jlo,RADIUS); j<MIN(jhi,n-RADIUS); j++) {
+        for (i=MAX(ilo,RADIUS); i<MIN(ihi,n-RADIUS); i++) {
+          #if STAR
+            #if LOOPGEN
+              #include "loop_body_star.incl"
+            #else
+              for (jj=-RADIUS; jj<=RADIUS; jj++)  OUT(i,j) += WEIGHT(0,jj)*IN(i,j+jj);
+              for (ii=-RADIUS; ii<0; ii++)        OUT(i,j) += WEIGHT(ii,0)*IN(i+ii,j);
+              for (ii=1; ii<=RADIUS; ii++)        OUT(i,j) += WEIGHT(ii,0)*IN(i+ii,j);
+            #endif
+          #else
+            #if LOOPGEN
+              #include "loop_body_compact.incl"
+            #else
+              for (jj=-RADIUS; jj<=RADIUS; jj++)
+              for (ii=-RADIUS; ii<=RADIUS; ii++)  OUT(i,j) += WEIGHT(ii,jj)*IN(i+ii,j+jj);
+            #endif
+          #endif
+        }
+      }
+    }
+    /* neighbor halos must be read before they are refreshed below             */
+#if !PARALLELFOR
+    #pragma omp barrier
+#endif
+    }
+    else {
 #if PARALLELFOR
-    #pragma omp parallel for private(i, ii, jj)
+    #pragma omp parallel for private(i, ii, jj) schedule(runtime)
 #else
-    #pragma omp for
+    #pragma omp for schedule(runtime)
 #endif
     for (j=RADIUS; j<n-RADIUS; j++) {
+      thread_work[omp_get_thread_num()] += n-2*RADIUS;
       for (i=RADIUS; i<n-RADIUS; i++) {
         #if STAR
           #if LOOPGEN
@@ -293,14 +490,32 @@ int main(int argc, char ** argv) {
         #endif
       }
     }
+    }
 
     /* add constant to solution to force refresh of neighbor data, if any       */
+    if (num_tilesx > 0) {
+#if PARALLELFOR
+    #pragma omp parallel private(i, j)
+#endif
+    {
+      long ilo, ihi, jlo, jhi;
+      tile_bounds(omp_get_thread_num(), num_tilesx, num_tilesy, n,
+                  &ilo, &ihi, &jlo, &jhi);
+      for (j=jlo; j<jhi; j++) for (i=ilo; i<ihi; i++) IN(i,j)+= 1.0;
+    }
+    /* refreshed halos must be visible before the next application             */
+#if !PARALLELFOR
+    #pragma omp barrier
+#endif
+    }
+    else {
 #if PARALLELFOR
     #pragma omp parallel for private(i)
 #else
     #pragma omp for
 #endif
     for (j=0; j<n; j++) for (i=0; i<n; i++) IN(i,j)+= 1.0;
+    }
   } /* end of iterations                                                        */
 
 #if !PARALLELFOR
@@ -309,6 +524,8 @@ int main(int argc, char ** argv) {
 #endif
   {
     stencil_time = wtime() - stencil_time;
+    prk_energy_stop();
+    prk_counters_stop();
   }
 
   /* compute L1 norm in parallel                                                */
@@ -353,5 +570,23 @@ int main(int argc, char ** argv) {
   printf("Rate (MFlops/s): "FSTR"  Avg time (s): %lf\n",
          1.0E-06 * flops/avgtime, avgtime);
 
+  /* with a dynamic schedule the rows a thread completes track the speed of
+     the core it runs on; report the realized distribution over all sweeps     */
+  if (sched_set) {
+    long work_min=thread_work[0], work_max=thread_work[0];
+    double work_avg=0.0;
+    for (i=0; i<nthread_input; i++) {
+      if (thread_work[i] < work_min) work_min = thread_work[i];
+      if (thread_work[i] > work_max) work_max = thread_work[i];
+      work_avg += (double) thread_work[i];
+    }
+    work_avg /= nthread_input;
+    printf("Thread work (points): min %ld, max %ld, imbalance %.2lf%%\n",
+           work_min, work_max,
+           (work_avg > 0.0) ? 100.0*((double)work_max/work_avg-1.0) : 0.0);
+  }
+  prk_energy_report(1.0E-06 * flops/avgtime, "MFlops/s");
+  prk_counters_report(iterations);
+
   exit(EXIT_SUCCESS);
 }
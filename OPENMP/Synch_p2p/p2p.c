@@ -77,19 +77,20 @@ int main(int argc, char ** argv) {
 
   int    TID;             /* Thread ID                                           */
   long   m, n;            /* grid dimensions                                     */
-  int    i, j, jj, iter, ID; /* dummies                                          */
+  long   i, j, jj;        /* grid indices                                        */
+  int    iter, ID;        /* dummies                                             */
   int    iterations;      /* number of times to run the pipeline algorithm       */
   int    *flag;           /* used for pairwise synchronizations                  */
-  int    *start, *end;    /* starts and ends of grid slices                      */
-  int    segment_size;
+  long   *start, *end;    /* starts and ends of grid slices                      */
+  long   segment_size;
   double pipeline_time,   /* timing parameters                                   */
          avgtime; 
   double epsilon = 1.e-8; /* error tolerance                                     */
   double corner_val;      /* verification value at top right corner of grid      */
   int    nthread_input,   /* thread parameters                                   */
          nthread; 
-  int    grp;             /* grid line aggregation factor                        */
-  int    jjsize;          /* actual line group size                              */
+  long   grp;             /* grid line aggregation factor                        */
+  long   jjsize;          /* actual line group size                              */
   double * RESTRICT vector;/* array holding grid values                          */
   long   total_length;    /* total required length to store grid values          */
   int    num_error=0;     /* flag that signals that requested and obtained
@@ -134,7 +135,7 @@ int main(int argc, char ** argv) {
   }
 
   if (argc==6) {
-    grp = atoi(*++argv);
+    grp = atol(*++argv);
     if (grp < 1) grp = 1;
     else if (grp >= n) grp = n-1;
   }
@@ -153,7 +154,7 @@ int main(int argc, char ** argv) {
     exit(EXIT_FAILURE);
   }
 
-  start = (int *) prk_malloc(2*nthread_input*sizeof(int));
+  start = (long *) prk_malloc(2*nthread_input*sizeof(long));
   if (!start) {
     printf("ERROR: Could not allocate space for array of slice boundaries\n");
     exit(EXIT_FAILURE);
@@ -190,7 +191,7 @@ int main(int argc, char ** argv) {
     printf("Grid sizes                = %ld, %ld\n", m, n);
     printf("Number of iterations      = %d\n", iterations);
     if (grp > 1)
-    printf("Group factor              = %d (cheating!)\n", grp);
+    printf("Group factor              = %ld (cheating!)\n", grp);
 #if SYNCHRONOUS
     printf("Neighbor thread handshake = on\n");
 #else
@@ -321,6 +322,11 @@ int main(int argc, char ** argv) {
   avgtime = pipeline_time/iterations;
   /* flip the sign of the execution time to indicate cheating                    */
   if (grp>1) avgtime *= -1.0;
+  if (fabs(avgtime) < 100.0*wtime_resolution()) {
+    printf("ERROR: Average time per iteration %lf is within 100x of timer resolution %.3e; increase grid size or iterations\n",
+           fabs(avgtime), wtime_resolution());
+    exit(EXIT_FAILURE);
+  }
   printf("Rate (MFlops/s): %lf Avg time (s): %lf\n",
          1.0E-06 * 2 * ((double)((m-1)*(n-1)))/avgtime, avgtime);
 
@@ -91,6 +91,9 @@ int main(int argc, char ** argv) {
          nthread;
   int    num_error=0;     /* flag that signals that requested and 
                              obtained numbers of threads are the same      */
+  char   *affinity="none";/* thread placement policy                       */
+  int    pin_active;      /* cpus in the pinning order, 0 if unbound       */
+  static int thread_cpu[MAX_THREADS]; /* realized binding of each thread   */
 
   /*********************************************************************
   ** read and test input parameters
@@ -99,8 +102,8 @@ int main(int argc, char ** argv) {
   printf("Parallel Research Kernels version %s\n", PRKVERSION);
   printf("OpenMP Matrix transpose: B = A^T\n");
 
-  if (argc != 4 && argc != 5){
-    printf("Usage: %s <# threads> <# iterations> <matrix order> [tile size]\n",
+  if (argc < 4 || argc > 6){
+    printf("Usage: %s <# threads> <# iterations> <matrix order> [tile size] [<affinity: core/socket/none>]\n",
            *argv);
     exit(EXIT_FAILURE);
   }
@@ -127,11 +130,14 @@ int main(int argc, char ** argv) {
     exit(EXIT_FAILURE);
   }
 
-  if (argc == 5) Tile_order = atoi(*++argv);
+  if (argc >= 5) Tile_order = atoi(*++argv);
   /* a non-positive tile size means no tiling of the local transpose */
   tiling = (Tile_order > 0) && ((size_t)Tile_order < order);
   if (!tiling) Tile_order = order;
 
+  if (argc == 6) affinity = *++argv;
+  pin_active = prk_affinity_init(affinity);
+
   /*********************************************************************
   ** Allocate space for the input and transpose matrix
   *********************************************************************/
@@ -153,6 +159,12 @@ int main(int argc, char ** argv) {
 
 #pragma omp parallel private (i, j, it, jt, iter)
   {  
+  int my_ID = omp_get_thread_num();
+
+  /* pin before any data is touched so first-touch follows the binding */
+  if (pin_active) prk_affinity_pin(my_ID);
+  thread_cpu[my_ID] = prk_affinity_cpu();
+  #pragma omp barrier
 
   #pragma omp master
   {
@@ -177,6 +189,15 @@ int main(int argc, char ** argv) {
     }
     else                   
       printf("Untiled\n");
+    printf("Affinity policy       = %s\n", affinity);
+    if (pin_active) {
+      printf("Realized binding      =");
+      for (i=0; i<nthread; i++) printf(" %d", thread_cpu[i]);
+      printf("\n");
+    }
+    else {
+      printf("Realized binding      = runtime default\n");
+    }
   }
   }
   bail_out(num_error);
@@ -117,12 +117,15 @@ HISTORY: Written by Rob Van der Wijngaart, February 2009.
 **********************************************************************************/
 
 #include <par-res-kern_general.h>
+#include <par-res-kern_branch.h>
 
 /* the following values are only used as labels                                  */
 #define VECTOR_STOP       66
 #define VECTOR_GO         77
 #define NO_VECTOR         88
 #define INS_HEAVY         99
+#define INDIRECT         111
+#define CORRELATED       122
 #define WITH_BRANCHES      1
 #define WITHOUT_BRANCHES   0
 
@@ -143,8 +146,10 @@ int main(int argc, char ** argv)
   int      btype;           /* integer encoding branching type                   */
   int      total=0, 
            total_ref;       /* computed and stored verification values           */
+  int      table_size;      /* number of distinct indirect dispatch targets      */
   int * RESTRICT vector; 
   int * RESTRICT index;
+  int * RESTRICT targets;
   /* UNUSED int factor = -1; */
 
 /**********************************************************************************
@@ -154,10 +159,11 @@ int main(int argc, char ** argv)
   printf("Parallel Research Kernels version %s\n", PRKVERSION);
   printf("Serial Branching Bonanza\n");
 
-  if (argc != 4){
+  if (argc != 4 && argc != 5){
     printf("Usage:     %s <# iterations> <vector length>", *argv);
-    printf("<branching type>\n");
-    printf("branching type: vector_go, vector_stop, no_vector, ins_heavy\n");
+    printf("<branching type> [dispatch table size]\n");
+    printf("branching type: vector_go, vector_stop, no_vector, ins_heavy,\n");
+    printf("                indirect, correlated\n");
     exit(EXIT_FAILURE);
   }
 
@@ -178,24 +184,38 @@ int main(int argc, char ** argv)
   else if (!strcmp(branch_type,"vector_go"  )) btype = VECTOR_GO;
   else if (!strcmp(branch_type,"no_vector"  )) btype = NO_VECTOR;
   else if (!strcmp(branch_type,"ins_heavy"  )) btype = INS_HEAVY;
+  else if (!strcmp(branch_type,"indirect"   )) btype = INDIRECT;
+  else if (!strcmp(branch_type,"correlated" )) btype = CORRELATED;
   else  {
     printf("Wrong branch type: %s; choose vector_stop, vector_go, ", branch_type);
-    printf("no_vector, or ins_heavy\n");
+    printf("no_vector, ins_heavy, indirect, or correlated\n");
+    exit(EXIT_FAILURE);
+  }
+
+  table_size = (argc == 5) ? atoi(*++argv) : 16;
+  if (table_size < 1 || table_size > BRANCH_MAX_TABLE) {
+    printf("ERROR: dispatch table size must be in [1,%d] : %d\n",
+           BRANCH_MAX_TABLE, table_size);
     exit(EXIT_FAILURE);
   }
 
   printf("Vector length              = %ld\n", vector_length);
   printf("Number of iterations       = %d\n", iterations);
   printf("Branching type             = %s\n", branch_type);
+  if (btype == INDIRECT || btype == CORRELATED) {
+    printf("Dispatch table size        = %d\n", table_size);
+  }
 
-  vector = prk_malloc(vector_length*2*sizeof(int));
+  vector = prk_malloc(vector_length*3*sizeof(int));
   if (!vector) {
     printf("ERROR: Failed to allocate space for vector\n");
     exit(EXIT_FAILURE);
   }
 
-  /* grab the second half of vector to store index array                         */
+  /* grab the second third of vector to store index array, and the last
+     third for the indirect dispatch-target sequence                             */
   index   = vector + vector_length;
+  targets = index  + vector_length;
 
   /* initialize the array with entries with varying signs; array "index" is only 
      used to obfuscate the compiler (i.e. it won't vectorize a loop containing
@@ -205,6 +225,20 @@ int main(int argc, char ** argv)
     index[i]   = i;
   }
 
+  /* dispatch-target sequence: pseudo-random targets probe branch-target-buffer
+     and indirect-predictor capacity; a cyclic sequence of the same targets is
+     learnable by a correlating predictor                                        */
+  if (btype == INDIRECT || btype == CORRELATED) {
+    unsigned int seed = 79;
+    for (i=0; i<vector_length; i++) {
+      if (btype == INDIRECT) {
+        seed = 1103515245u*seed + 12345u;
+        targets[i] = (int)((seed>>16) % (unsigned int)table_size);
+      }
+      else targets[i] = i % table_size;
+    }
+  }
+
   branch_time = wtime();
 
   /* do actual branching */
@@ -259,6 +293,22 @@ int main(int argc, char ** argv)
       }
       break;
 
+    case INDIRECT:
+    case CORRELATED:
+      /* every element dispatches through a function pointer; the callees
+         perform the no_vector update, so the totals are unchanged             */
+      for (iter=0; iter<iterations; iter+=2) {
+        for (i=0; i<vector_length; i++) {
+          aux = -(3 - (i&7));
+          branch_table[targets[i]](vector, index, i, aux);
+        }
+        for (i=0; i<vector_length; i++) {
+          aux = (3 - (i&7));
+          branch_table[targets[i]](vector, index, i, aux);
+        }
+      }
+      break;
+
     case INS_HEAVY:
       fill_vec(vector, vector_length, iterations, WITH_BRANCHES, &nfunc, &rank);
     }
@@ -304,6 +354,22 @@ int main(int argc, char ** argv)
       }
       break;
 
+    case INDIRECT:
+    case CORRELATED:
+      /* the branch-free update through a direct call: no conditional branch
+         and no indirect dispatch                                               */
+      for (iter=0; iter<iterations; iter+=2) {
+        for (i=0; i<vector_length; i++) {
+          aux = -(3 - (i&7));
+          branch_func_fixed(vector, index, i, aux);
+        }
+        for (i=0; i<vector_length; i++) {
+          aux = (3 - (i&7));
+          branch_func_fixed(vector, index, i, aux);
+        }
+      }
+      break;
+
     case INS_HEAVY:
       fill_vec(vector, vector_length, iterations, WITHOUT_BRANCHES, &nfunc, &rank);
     }
@@ -0,0 +1,32762 @@
+#include <par-res-kern_general.h>
+static int one[10], zero[10];
+int func0(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (0+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func20(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (20+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func1(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (1+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func21(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (21+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func2(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (2+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func22(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (22+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func3(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (3+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func23(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (23+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func4(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (4+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func24(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (24+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func5(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (5+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func25(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (25+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func6(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (6+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func26(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (26+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func7(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (7+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func27(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (27+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func8(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (8+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func28(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (28+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func9(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (9+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func29(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (29+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func10(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (10+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func30(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (30+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func11(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (11+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func31(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (31+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func12(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (12+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func32(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (32+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func13(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (13+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func33(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (33+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func14(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (14+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func34(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (34+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func15(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (15+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func35(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (35+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func16(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (16+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func36(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (36+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func17(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (17+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func37(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (37+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func18(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (18+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func38(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (38+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func19(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (19+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int func39(int index, int a[10][10], int b[10][10]){
+  int i, j, x1, x2, x3, error=0;
+
+  x1 = 0 + index;
+  x2 = 38357;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][0] = one[x3];
+
+  x1 = 6666 + index;
+  x2 = 67800;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][1] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 20214;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][2] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 49657;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][3] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 2071;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][4] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 31514;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][5] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 60957;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][6] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 13371;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][7] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 42814;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][8] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 72257;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[0][9] = zero[x3];
+
+  x1 = 6666 + index;
+  x2 = 58571;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][0] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 10985;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][1] = one[x3];
+
+  x1 = 3220 + index;
+  x2 = 40428;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][2] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 69871;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][3] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 22285;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][4] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 51728;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][5] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 4142;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][6] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 33585;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][7] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 63028;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][8] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 15442;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[1][9] = zero[x3];
+
+  x1 = 4943 + index;
+  x2 = 1756;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][0] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 31199;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][1] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 60642;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][2] = one[x3];
+
+  x1 = 8163 + index;
+  x2 = 13056;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][3] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 42499;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][4] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 71942;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][5] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 24356;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][6] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 53799;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][7] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 6213;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][8] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 35656;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[2][9] = zero[x3];
+
+  x1 = 3220 + index;
+  x2 = 21970;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][0] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 51413;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][1] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 3827;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][2] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 33270;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][3] = one[x3];
+
+  x1 = 4717 + index;
+  x2 = 62713;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][4] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 15127;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][5] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 44570;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][6] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 74013;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][7] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 26427;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][8] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 55870;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[3][9] = zero[x3];
+
+  x1 = 1497 + index;
+  x2 = 42184;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][0] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 71627;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][1] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 24041;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][2] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 53484;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][3] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 5898;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][4] = one[x3];
+
+  x1 = 1271 + index;
+  x2 = 35341;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][5] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 64784;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][6] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 17198;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][7] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 46641;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][8] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 76084;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[4][9] = zero[x3];
+
+  x1 = 8163 + index;
+  x2 = 62398;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][0] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 14812;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][1] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 44255;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][2] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 73698;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][3] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 26112;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][4] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 55555;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][5] = one[x3];
+
+  x1 = 6214 + index;
+  x2 = 7969;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][6] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 37412;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][7] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 66855;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][8] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 19269;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[5][9] = zero[x3];
+
+  x1 = 6440 + index;
+  x2 = 5583;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][0] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 35026;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][1] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 64469;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][2] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 16883;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][3] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 46326;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][4] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 75769;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][5] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 28183;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][6] = one[x3];
+
+  x1 = 2768 + index;
+  x2 = 57626;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][7] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 10040;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][8] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 39483;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[6][9] = zero[x3];
+
+  x1 = 4717 + index;
+  x2 = 25797;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][0] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 55240;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][1] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 7654;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][2] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 37097;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][3] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 66540;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][4] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 18954;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][5] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 48397;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][6] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 811;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][7] = one[x3];
+
+  x1 = 7711 + index;
+  x2 = 30254;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][8] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 59697;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[7][9] = zero[x3];
+
+  x1 = 2994 + index;
+  x2 = 46011;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][0] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 75454;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][1] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 27868;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][2] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 57311;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][3] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 9725;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][4] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 39168;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][5] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 68611;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][6] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 21025;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][7] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 50468;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][8] = one[x3];
+
+  x1 = 4265 + index;
+  x2 = 2882;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[8][9] = zero[x3];
+
+  x1 = 1271 + index;
+  x2 = 66225;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][0] = zero[x3];
+
+  x1 = 7937 + index;
+  x2 = 18639;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][1] = zero[x3];
+
+  x1 = 6214 + index;
+  x2 = 48082;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][2] = zero[x3];
+
+  x1 = 4491 + index;
+  x2 = 496;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][3] = zero[x3];
+
+  x1 = 2768 + index;
+  x2 = 29939;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][4] = zero[x3];
+
+  x1 = 1045 + index;
+  x2 = 59382;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][5] = zero[x3];
+
+  x1 = 7711 + index;
+  x2 = 11796;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][6] = zero[x3];
+
+  x1 = 5988 + index;
+  x2 = 41239;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][7] = zero[x3];
+
+  x1 = 4265 + index;
+  x2 = 70682;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][8] = zero[x3];
+
+  x1 = 2542 + index;
+  x2 = 23096;
+  x3 = (x1 + (39+1)*x2) % 10;
+  x1 += (x2 - x3 + 10 ) % 10;
+  x2 += (x1 - 5*x3 + 7 * 10 ) % 10;
+  x3 = (x1 + 4*x2) % 10;
+  a[9][9] = one[x3];
+
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    b[j][i] = (a[i][j]+a[j][i])/2;
+  for (j=0; j<10; j++) for (i=0; i<10; i++)
+    if (i != j) error += ABS(b[j][i]);
+  for (i=0; i<10; i++) error += ABS(1-b[i][i]);
+  if (error) return(0);
+  else       return(index);
+}
+
+int fill_vec(int *vector, int length, int iterations, int branch,  
+             int *nfunc, int *rank) {
+  static int a[10][10], b[10][10];
+  int aux, aux2, i, iter;
+  /* return generator values to calling program */
+  *nfunc = 40;
+  *rank  = 10;
+
+  if (!branch)
+    for (iter=0; iter<iterations; iter+=2) {
+      for (i=0; i<length; i++) {
+         aux2 = -(3-(func0(i,a,b)&7));
+         vector[i] -= (vector[i]+aux2);
+      }
+      for (i=0; i<length; i++) {
+         aux2 = (3-(func0(i,a,b)&7));
+         vector[i] -= (vector[i]+aux2);
+      }
+    }
+  else {
+    for (i=0; i<10; i++) {
+      zero[i] = 0; one[i]  = 1;
+    }
+    for (iter=0; iter<iterations; iter+=2) {
+      for (i=0; i<length; i++) {
+        aux = i%40;
+        switch(aux) {
+          case 0: aux2 = -(3-(func0(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 1: aux2 = -(3-(func1(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 2: aux2 = -(3-(func2(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 3: aux2 = -(3-(func3(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 4: aux2 = -(3-(func4(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 5: aux2 = -(3-(func5(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 6: aux2 = -(3-(func6(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 7: aux2 = -(3-(func7(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 8: aux2 = -(3-(func8(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 9: aux2 = -(3-(func9(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 10: aux2 = -(3-(func10(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 11: aux2 = -(3-(func11(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 12: aux2 = -(3-(func12(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 13: aux2 = -(3-(func13(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 14: aux2 = -(3-(func14(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 15: aux2 = -(3-(func15(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 16: aux2 = -(3-(func16(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 17: aux2 = -(3-(func17(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 18: aux2 = -(3-(func18(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 19: aux2 = -(3-(func19(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 20: aux2 = -(3-(func20(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 21: aux2 = -(3-(func21(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 22: aux2 = -(3-(func22(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 23: aux2 = -(3-(func23(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 24: aux2 = -(3-(func24(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 25: aux2 = -(3-(func25(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 26: aux2 = -(3-(func26(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 27: aux2 = -(3-(func27(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 28: aux2 = -(3-(func28(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 29: aux2 = -(3-(func29(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 30: aux2 = -(3-(func30(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 31: aux2 = -(3-(func31(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 32: aux2 = -(3-(func32(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 33: aux2 = -(3-(func33(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 34: aux2 = -(3-(func34(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 35: aux2 = -(3-(func35(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 36: aux2 = -(3-(func36(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 37: aux2 = -(3-(func37(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 38: aux2 = -(3-(func38(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 39: aux2 = -(3-(func39(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          default: vector[i] = 0;
+        }
+      }
+      for (i=0; i<length; i++) {
+        aux = i%40;
+        switch(aux) {
+          case 0: aux2 = (3-(func0(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 1: aux2 = (3-(func1(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 2: aux2 = (3-(func2(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 3: aux2 = (3-(func3(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 4: aux2 = (3-(func4(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 5: aux2 = (3-(func5(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 6: aux2 = (3-(func6(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 7: aux2 = (3-(func7(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 8: aux2 = (3-(func8(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 9: aux2 = (3-(func9(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 10: aux2 = (3-(func10(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 11: aux2 = (3-(func11(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 12: aux2 = (3-(func12(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 13: aux2 = (3-(func13(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 14: aux2 = (3-(func14(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 15: aux2 = (3-(func15(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 16: aux2 = (3-(func16(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 17: aux2 = (3-(func17(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 18: aux2 = (3-(func18(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 19: aux2 = (3-(func19(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 20: aux2 = (3-(func20(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 21: aux2 = (3-(func21(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 22: aux2 = (3-(func22(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 23: aux2 = (3-(func23(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 24: aux2 = (3-(func24(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 25: aux2 = (3-(func25(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 26: aux2 = (3-(func26(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 27: aux2 = (3-(func27(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 28: aux2 = (3-(func28(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 29: aux2 = (3-(func29(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 30: aux2 = (3-(func30(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 31: aux2 = (3-(func31(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 32: aux2 = (3-(func32(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 33: aux2 = (3-(func33(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 34: aux2 = (3-(func34(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 35: aux2 = (3-(func35(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 36: aux2 = (3-(func36(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 37: aux2 = (3-(func37(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 38: aux2 = (3-(func38(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          case 39: aux2 = (3-(func39(i,a,b)&7));
+                   vector[i] -= (vector[i]+aux2);
+                   break;
+          default: vector[i] = 0;
+        }
+      }
+    }
+  }
+  return(0);
+}
@@ -75,7 +75,8 @@ HISTORY: Written by Rob Van der Wijngaart, February 2009.
 
 int main(int argc, char **argv)
 {
-  int     iter, i,ii,j,jj,k,kk,ig,jg,kg; /* dummies                               */
+  long    i,ii,j,jj,k,kk,ig,jg,kg; /* matrix indices                              */
+  int     iter;                 /* iteration counter                              */
   int     iterations;           /* number of times the multiplication is done     */
   double  dgemm_time = 0.0,     /* timing parameters                              */
           avgtime; 
@@ -118,6 +119,10 @@ int main(int argc, char **argv)
     printf("ERROR: Matrix order must be positive: %ld\n", order);
     exit(EXIT_FAILURE);
   }
+  if ((order*order)/order != order) {
+    printf("ERROR: Matrix order %ld overflows matrix size computation\n", order);
+    exit(EXIT_FAILURE);
+  }
 
 #if !MKL
   if (argc == 4) {
@@ -211,7 +216,7 @@ int main(int argc, char **argv)
   } /* end of iterations                                                          */
 #else
 
-  printf("Matrix size           = %dx%d\n", order, order);
+  printf("Matrix size           = %ldx%ld\n", order, order);
   printf("Using MKL library     = on\n");
   printf("Number of iterations  = %d\n", iterations);
 
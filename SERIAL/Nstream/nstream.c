@@ -113,6 +113,7 @@ HISTORY:   This code is loosely based on the Stream benchmark by John
 **********************************************************************/
  
 #include <par-res-kern_general.h>
+#include <prk_results.h>
  
 #define N   MAXLENGTH
  
@@ -132,7 +133,8 @@ static int checkTRIADresults(int, long int);
  
 int main(int argc, char **argv) 
 {
-  int      j, iter;       /* dummies                                     */
+  long     j;             /* element index                               */
+  int      iter;          /* iteration counter                           */
   double   scalar;        /* constant used in Triad operation            */
   int      iterations;    /* number of times vector loop gets repeated   */
   long int length,        /* total vector length                         */
@@ -183,6 +185,11 @@ int main(int argc, char **argv)
  
 #if !STATIC_ALLOCATION
   space = (3*length + 2*offset)*sizeof(double);
+  if (space/sizeof(double) != (size_t)(3*length + 2*offset)) {
+    printf("ERROR: vector length/offset %ld/%ld overflow space computation\n",
+           length, offset);
+    exit(EXIT_FAILURE);
+  }
   a = (double *) prk_malloc(space);
   if (!a) {
     printf("ERROR: Could not allocate %ld words for vectors\n", 
@@ -193,6 +200,11 @@ int main(int argc, char **argv)
   b = a + length + offset;
   c = b + length + offset;
  
+  prk_results_begin("nstream");
+  prk_results_kv_long("iterations", iterations);
+  prk_results_kv_long("length", length);
+  prk_results_kv_long("offset", offset);
+
   printf("Vector length        = %ld\n", length);
   printf("Offset               = %ld\n", offset);
   printf("Number of iterations = %d\n", iterations);
@@ -213,8 +225,12 @@ int main(int argc, char **argv)
  
     /* start timer after a warmup iteration */
     if (iter == 1) nstream_time = wtime();
+
+    double iter_time = wtime();
  
     for (j=0; j<length; j++) a[j] += b[j]+scalar*c[j];
+
+    if (iter > 0) prk_results_iteration(wtime()-iter_time);
  
   }
  
@@ -229,6 +245,9 @@ int main(int argc, char **argv)
     avgtime = nstream_time/(double)iterations;
     printf("Rate (MB/s): %lf Avg time (s): %lf\n",
            1.0E-06 * bytes/avgtime, avgtime);
+    prk_results_kv_double("rate_mbs", 1.0E-06 * bytes/avgtime);
+    prk_results_kv_double("avgtime", avgtime);
+    prk_results_emit();
    }
   else exit(EXIT_FAILURE);
  
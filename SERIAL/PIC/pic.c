@@ -42,7 +42,8 @@ PURPOSE: This program tests the efficiency with which a cloud of
 
 USAGE:   <progname> <#simulation steps> <grid size> <#particles> \
                     <horizontal velocity> <vertical velocity>    \
-                    <init mode> <init parameters>
+                    <init mode> <init parameters>                \
+                    [<particle layout> [<AoSoA block>|<re-sort period>]]
 
          The output consists of diagnostics to make sure the
          algorithm worked, and of timing statistics.
@@ -53,10 +54,12 @@ FUNCTIONS CALLED:
          this program:
          wtime()
          bad_patch()
-         random_draw()
+         random_draw_batch()
 
 HISTORY: - Written by Evangelos Georganas, August 2015.
          - RvdW: Refactored to make the code PRK conforming, December 2015
+         - Initialization draws random numbers a grid column at a time
+           through the batched (vectorizable) generator interface
 
 **********************************************************************************/
 
@@ -92,6 +95,14 @@ HISTORY: - Written by Evangelos Georganas, August 2015.
 #define PATCH      3
 #define UNDEFINED  4
 
+#define AOS        0
+#define SOA        1
+#define AOSOA      2
+#define BINNED     3
+
+/* number of double fields per particle touched in the push loop */
+#define TILE_FIELDS 5
+
 typedef struct {
   uint64_t left;
   uint64_t right;
@@ -113,6 +124,17 @@ typedef struct particle_t {
   int64_t  m; //  determines how many cells particles move per time step in the y direction
 } particle_t;
 
+/* Structure-of-arrays storage for the fields touched in the push loop;
+   the remaining particle_t fields are only needed for verification and
+   stay in the AoS array */
+typedef struct {
+  double   *x;
+  double   *y;
+  double   *v_x;
+  double   *v_y;
+  double   *q;
+} particle_soa_t;
+
 /* Initializes the grid of charges
   We follow a column major format for the grid. Note that this may affect cache performance, depending on access pattern of particles. */
 
@@ -177,19 +199,27 @@ particle_t *initializeGeometric(uint64_t n_input, uint64_t L, double rho,
                                 double k, double m, uint64_t *n_placed, 
                                 random_draw_t *parm){
   particle_t  *particles;
-  uint64_t    x, y, p, pi, actual_particles;
+  uint64_t    x, y, p, pi, actual_particles, *draws;
   double      A;
 
   /* initialize random number generator */
   LCG_init(parm);
 
+  /* column-sized buffer for the batched random number generator */
+  draws = (uint64_t*) prk_malloc(L * sizeof(uint64_t));
+  if (draws == NULL) {
+    printf("ERROR: Could not allocate space for random draws\n");
+    exit(EXIT_FAILURE);
+  }
+
   /* first determine total number of particles, then allocate and place them   */
 
   /* Each cell in the i-th column of cells contains p(i) = A * rho^i particles */
   A = n_input * ((1.0-rho) / (1.0-pow(rho,L))) / (double)L;
   for (*n_placed=0,x=0; x<L; x++) {
+    random_draw_batch(A * pow(rho, x), L, draws, parm);
     for (y=0; y<L; y++) {
-      (*n_placed) += random_draw(A * pow(rho, x), parm);
+      (*n_placed) += draws[y];
     }
   }
 
@@ -204,8 +234,9 @@ particle_t *initializeGeometric(uint64_t n_input, uint64_t L, double rho,
 
   A = n_input * ((1.0-rho) / (1.0-pow(rho,L))) / (double)L;
   for (pi=0,x=0; x<L; x++) {
+    random_draw_batch(A * pow(rho, x), L, draws, parm);
     for (y=0; y<L; y++) {
-      actual_particles = random_draw(A * pow(rho, x), parm);
+      actual_particles = draws[y];
       for (p=0; p<actual_particles; p++,pi++) {
         particles[pi].x = x + REL_X;
         particles[pi].y = y + REL_Y;
@@ -216,6 +247,7 @@ particle_t *initializeGeometric(uint64_t n_input, uint64_t L, double rho,
   }
   finish_distribution((*n_placed), particles);
 
+  prk_free(draws);
   return particles;
 }
 
@@ -225,17 +257,25 @@ particle_t *initializeSinusoidal(uint64_t n_input, uint64_t L,
                                  random_draw_t *parm){
   particle_t  *particles;
   double      step = PRK_M_PI/L;
-  uint64_t    x, y, p, pi, actual_particles;
+  uint64_t    x, y, p, pi, actual_particles, *draws;
 
   /* initialize random number generator */
   LCG_init(parm);
 
+  /* column-sized buffer for the batched random number generator */
+  draws = (uint64_t*) prk_malloc(L * sizeof(uint64_t));
+  if (draws == NULL) {
+    printf("ERROR: Could not allocate space for random draws\n");
+    exit(EXIT_FAILURE);
+  }
+
   /* first determine total number of particles, then allocate and place them   */
 
   /* Loop over columns of cells and assign number of particles proportional to sinusodial weight */
   for (*n_placed=0,x=0; x<L; x++) {
+    random_draw_batch(2.0*cos(x*step)*cos(x*step)*n_input/(L*L), L, draws, parm);
     for (y=0; y<L; y++) {
-      (*n_placed) += random_draw(2.0*cos(x*step)*cos(x*step)*n_input/(L*L), parm);
+      (*n_placed) += draws[y];
     }
   }
 
@@ -249,8 +289,9 @@ particle_t *initializeSinusoidal(uint64_t n_input, uint64_t L,
   LCG_init(parm);
 
   for (pi=0,x=0; x<L; x++) {
+    random_draw_batch(2.0*cos(x*step)*cos(x*step)*n_input/(L*L), L, draws, parm);
     for (y=0; y<L; y++) {
-      actual_particles = random_draw(2.0*cos(x*step)*cos(x*step)*n_input/(L*L), parm);
+      actual_particles = draws[y];
       for (p=0; p<actual_particles; p++,pi++) {
         particles[pi].x = x + REL_X;
         particles[pi].y = y + REL_Y;
@@ -261,6 +302,7 @@ particle_t *initializeSinusoidal(uint64_t n_input, uint64_t L,
   }
   finish_distribution((*n_placed), particles);
 
+  prk_free(draws);
   return particles;
 }
 
@@ -269,12 +311,19 @@ particle_t *initializeSinusoidal(uint64_t n_input, uint64_t L,
 particle_t *initializeLinear(uint64_t n_input, uint64_t L, double alpha, double beta,
                              double k, double m, uint64_t *n_placed, random_draw_t *parm){
   particle_t  *particles;
-  uint64_t    x, y, p, pi, actual_particles;
+  uint64_t    x, y, p, pi, actual_particles, *draws;
   double      total_weight, step = 1.0/L, current_weight;
 
   /* initialize random number generator */
   LCG_init(parm);
 
+  /* column-sized buffer for the batched random number generator */
+  draws = (uint64_t*) prk_malloc(L * sizeof(uint64_t));
+  if (draws == NULL) {
+    printf("ERROR: Could not allocate space for random draws\n");
+    exit(EXIT_FAILURE);
+  }
+
   /* first determine total number of particles, then allocate and place them   */
 
   /* Find sum of all weights to normalize the number of particles */
@@ -283,8 +332,9 @@ particle_t *initializeLinear(uint64_t n_input, uint64_t L, double alpha, double
   /* Loop over columns of cells and assign number of particles proportional linear weight */
   for ((*n_placed)=0,x=0; x<L; x++) {
     current_weight = (beta - alpha * step * ((double) x));
+    random_draw_batch(n_input * (current_weight/total_weight)/L, L, draws, parm);
     for (y=0; y<L; y++) {
-      (*n_placed) += random_draw(n_input * (current_weight/total_weight)/L, parm);
+      (*n_placed) += draws[y];
     }
   }
 
@@ -300,8 +350,9 @@ particle_t *initializeLinear(uint64_t n_input, uint64_t L, double alpha, double
   /* Loop over columns of cells and assign number of particles proportional linear weight */
   for (pi=0,x=0; x<L; x++) {
     current_weight = (beta - alpha * step * ((double) x));
+    random_draw_batch(n_input * (current_weight/total_weight)/L, L, draws, parm);
     for (y=0; y<L; y++) {
-      actual_particles = random_draw(n_input * (current_weight/total_weight)/L, parm);
+      actual_particles = draws[y];
       for (p=0; p<actual_particles; p++,pi++) {
         particles[pi].x = x + REL_X;
         particles[pi].y = y + REL_Y;
@@ -312,6 +363,7 @@ particle_t *initializeLinear(uint64_t n_input, uint64_t L, double alpha, double
   }
   finish_distribution((*n_placed), particles);
 
+  prk_free(draws);
   return particles;
 }
 
@@ -320,20 +372,28 @@ particle_t *initializePatch(uint64_t n_input, uint64_t L, bbox_t patch,
                             double k, double m, uint64_t *n_placed,
                             random_draw_t *parm){
   particle_t  *particles;
-  uint64_t    x, y, p, pi, total_cells, actual_particles;
+  uint64_t    x, y, p, pi, total_cells, actual_particles, *draws;
   double      particles_per_cell;
 
   /* initialize random number generator */
   LCG_init(parm);
 
+  /* column-sized buffer for the batched random number generator */
+  draws = (uint64_t*) prk_malloc(L * sizeof(uint64_t));
+  if (draws == NULL) {
+    printf("ERROR: Could not allocate space for random draws\n");
+    exit(EXIT_FAILURE);
+  }
+
   /* first determine total number of particles, then allocate and place them   */
   total_cells  = (patch.right - patch.left+1)*(patch.top - patch.bottom+1);
   particles_per_cell = (double) n_input/total_cells;
 
   /* Iterate over the columns of cells and assign uniform number of particles */
   for ((*n_placed)=0,x=0; x<L; x++) {
+    random_draw_batch(particles_per_cell, L, draws, parm);
     for (y=0; y<L; y++) {
-      actual_particles = random_draw(particles_per_cell, parm);
+      actual_particles = draws[y];
       if (x<patch.left || x>patch.right || y<patch.bottom || y>patch.top)
         actual_particles = 0;
       (*n_placed) += actual_particles;
@@ -351,8 +411,9 @@ particle_t *initializePatch(uint64_t n_input, uint64_t L, bbox_t patch,
 
   /* Iterate over the columns of cells and assign uniform number of particles */
   for (pi=0,x=0; x<L; x++) {
+    random_draw_batch(particles_per_cell, L, draws, parm);
     for (y=0; y<L; y++) {
-      actual_particles = random_draw(particles_per_cell, parm);
+      actual_particles = draws[y];
       if (x<patch.left || x>patch.right || y<patch.bottom || y>patch.top)
         actual_particles = 0;
       for (p=0; p<actual_particles; p++,pi++) {
@@ -365,6 +426,7 @@ particle_t *initializePatch(uint64_t n_input, uint64_t L, bbox_t patch,
   }
   finish_distribution((*n_placed), particles);
 
+  prk_free(draws);
   return particles;
 }
 
@@ -404,33 +466,34 @@ void computeCoulomb(double x_dist, double y_dist, double q1, double q2, double *
 }
 
 /* Computes the total Coulomb force on a particle exerted from the charges of the corresponding cell */
-void computeTotalForce(particle_t p, uint64_t L, double *Qgrid, double *fx, double *fy){
+void computeTotalForceCoords(double p_x, double p_y, double p_q, uint64_t L,
+                             double *Qgrid, double *fx, double *fy){
   uint64_t  y, x;
   double   tmp_fx, tmp_fy, rel_y, rel_x, tmp_res_x = 0.0, tmp_res_y = 0.0;
 
   /* Coordinates of the cell containing the particle */
-  y = (uint64_t) floor(p.y);
-  x = (uint64_t) floor(p.x);
-  rel_x = p.x -  x;
-  rel_y = p.y -  y;
+  y = (uint64_t) floor(p_y);
+  x = (uint64_t) floor(p_x);
+  rel_x = p_x -  x;
+  rel_y = p_y -  y;
 
   /* Coulomb force from top-left charge */
-  computeCoulomb(rel_x, rel_y, p.q, QG(y,x,L), &tmp_fx, &tmp_fy);
+  computeCoulomb(rel_x, rel_y, p_q, QG(y,x,L), &tmp_fx, &tmp_fy);
   tmp_res_x += tmp_fx;
   tmp_res_y += tmp_fy;
 
   /* Coulomb force from bottom-left charge */
-  computeCoulomb(rel_x, 1.0-rel_y, p.q, QG(y+1,x,L), &tmp_fx, &tmp_fy);
+  computeCoulomb(rel_x, 1.0-rel_y, p_q, QG(y+1,x,L), &tmp_fx, &tmp_fy);
   tmp_res_x += tmp_fx;
   tmp_res_y -= tmp_fy;
 
   /* Coulomb force from top-right charge */
-  computeCoulomb(1.0-rel_x, rel_y, p.q, QG(y,x+1,L), &tmp_fx, &tmp_fy);
+  computeCoulomb(1.0-rel_x, rel_y, p_q, QG(y,x+1,L), &tmp_fx, &tmp_fy);
   tmp_res_x -= tmp_fx;
   tmp_res_y += tmp_fy;
 
   /* Coulomb force from bottom-right charge */
-  computeCoulomb(1.0-rel_x, 1.0-rel_y, p.q, QG(y+1,x+1,L), &tmp_fx, &tmp_fy);
+  computeCoulomb(1.0-rel_x, 1.0-rel_y, p_q, QG(y+1,x+1,L), &tmp_fx, &tmp_fy);
   tmp_res_x -= tmp_fx;
   tmp_res_y -= tmp_fy;
 
@@ -438,6 +501,86 @@ void computeTotalForce(particle_t p, uint64_t L, double *Qgrid, double *fx, doub
   (*fy) = tmp_res_y;
 }
 
+void computeTotalForce(particle_t p, uint64_t L, double *Qgrid, double *fx, double *fy){
+  computeTotalForceCoords(p.x, p.y, p.q, L, Qgrid, fx, fy);
+}
+
+/* Copies the push-loop fields between the AoS particle array and the
+   alternative layouts; conversion happens outside the timed loop, so
+   the physics and verification are identical for all layouts */
+void packSoA(uint64_t n, particle_t *p, particle_soa_t *s) {
+  uint64_t i;
+  for (i=0; i<n; i++) {
+    s->x[i]   = p[i].x;
+    s->y[i]   = p[i].y;
+    s->v_x[i] = p[i].v_x;
+    s->v_y[i] = p[i].v_y;
+    s->q[i]   = p[i].q;
+  }
+}
+
+void unpackSoA(uint64_t n, particle_soa_t *s, particle_t *p) {
+  uint64_t i;
+  for (i=0; i<n; i++) {
+    p[i].x   = s->x[i];
+    p[i].y   = s->y[i];
+    p[i].v_x = s->v_x[i];
+    p[i].v_y = s->v_y[i];
+  }
+}
+
+/* AoSoA: tiles of `block` particles; each tile stores block x values,
+   then block y, v_x, v_y and q values contiguously */
+void packAoSoA(uint64_t n, uint64_t block, particle_t *p, double *buf) {
+  uint64_t i, tile, lane;
+  double *base;
+  for (i=0; i<n; i++) {
+    tile = i/block;
+    lane = i%block;
+    base = buf + tile*TILE_FIELDS*block;
+    base[        lane] = p[i].x;
+    base[  block+lane] = p[i].y;
+    base[2*block+lane] = p[i].v_x;
+    base[3*block+lane] = p[i].v_y;
+    base[4*block+lane] = p[i].q;
+  }
+}
+
+void unpackAoSoA(uint64_t n, uint64_t block, double *buf, particle_t *p) {
+  uint64_t i, tile, lane;
+  double *base;
+  for (i=0; i<n; i++) {
+    tile = i/block;
+    lane = i%block;
+    base = buf + tile*TILE_FIELDS*block;
+    p[i].x   = base[        lane];
+    p[i].y   = base[  block+lane];
+    p[i].v_x = base[2*block+lane];
+    p[i].v_y = base[3*block+lane];
+  }
+}
+
+/* Counting sort of the particles by grid cell, so that particles reading
+   the same charges are adjacent in memory; cells are ordered to match the
+   column major layout of the charge grid. Returns the sorted array (aux);
+   the caller swaps the array pointers */
+particle_t *binParticles(uint64_t n, uint64_t L, particle_t *p, particle_t *aux,
+                         uint64_t *counts) {
+  uint64_t i, c;
+
+  for (c=0; c<=L*L; c++) counts[c] = 0;
+  for (i=0; i<n; i++) {
+    c = ((uint64_t)p[i].x)*L + (uint64_t)p[i].y;
+    counts[c+1]++;
+  }
+  for (c=1; c<=L*L; c++) counts[c] += counts[c-1];
+  for (i=0; i<n; i++) {
+    c = ((uint64_t)p[i].x)*L + (uint64_t)p[i].y;
+    aux[counts[c]++] = p[i];
+  }
+  return aux;
+}
+
 int bad_patch(bbox_t *patch, bbox_t *patch_contain) {
   if (patch->left>=patch->right || patch->bottom>=patch->top) return(1);
   if (patch_contain) {
@@ -464,7 +607,19 @@ int main(int argc, char ** argv) {
   int         correctness = 1;   // determines whether simulation was correct
   double      *Qgrid;            // field of fixed charges
   particle_t  *particles, *p;    // the particles array
-  uint64_t    iter, i;           // dummies
+  uint64_t    layout;            // particle storage layout for the push loop
+  uint64_t    layout_block = 32; // particles per AoSoA tile
+  particle_soa_t soa;            // SoA particle storage
+  double      *aosoa;            // AoSoA particle storage
+  double      *tx, *ty, *tvx, *tvy, *tq; // AoSoA tile field pointers
+  particle_t  *particles_aux;    // scratch array for the counting sort
+  particle_t  *pristine;         // copy of initial particles for period sweep
+  particle_t  *sorted;           // result of the counting sort
+  uint64_t    *bin_counts;       // cell occupation counts for the counting sort
+  uint64_t    bin_period = 0;    // cell re-sort period; 0 means period sweep
+  uint64_t    period = 0;        // re-sort period of the current run
+  uint64_t    run, num_runs;     // run index/count of the period sweep
+  uint64_t    iter, i, it, l, ntiles, lanes; // dummies
   double      fx, fy, ax, ay;    // forces and accelerations
 #if UNUSED
   int         particles_per_cell;// number of particles per cell to be injected
@@ -488,6 +643,8 @@ int main(int argc, char ** argv) {
     printf("             \"SINUSOIDAL\" parameters: none\n");
     printf("             \"LINEAR\"     parameters: <negative slope> <constant offset>\n");
     printf("             \"PATCH\"      parameters: <xleft> <xright>  <ybottom> <ytop>\n");
+    printf("   particle layout (optional): \"AOS\" (default), \"SOA\", \"AOSOA\" [<block>],\n");
+    printf("             or \"BINNED\" [<re-sort period>] (period 0 sweeps powers of two)\n");
     exit(SUCCESS);
   }
 
@@ -566,6 +723,39 @@ int main(int argc, char ** argv) {
     }
   }
 
+  /* optional particle storage layout for the push loop */
+  layout = AOS;
+  if (argc>args_used) {
+    char *layout_name = *++argv; args_used++;
+    if      (strcmp(layout_name, "AOS") == 0) layout = AOS;
+    else if (strcmp(layout_name, "SOA") == 0) layout = SOA;
+    else if (strcmp(layout_name, "AOSOA") == 0) {
+      layout = AOSOA;
+      if (argc>args_used) {
+        layout_block = atol(*++argv); args_used++;
+      }
+      if (layout_block<1) {
+        printf("ERROR: AoSoA block must be positive: %" PRIu64 "\n", layout_block);
+        exit(FAILURE);
+      }
+    }
+    else if (strcmp(layout_name, "BINNED") == 0) {
+      layout = BINNED;
+      if (argc>args_used) {
+        int64_t period_input = atol(*++argv); args_used++;
+        if (period_input<0) {
+          printf("ERROR: re-sort period must be non-negative: %" PRId64 "\n", period_input);
+          exit(FAILURE);
+        }
+        bin_period = (uint64_t) period_input;
+      }
+    }
+    else {
+      printf("ERROR: Unsupported particle layout: %s\n", layout_name);
+      exit(FAILURE);
+    }
+  }
+
   printf("Grid size                      = %lld\n", L);
   printf("Number of particles requested  = %lld\n", n);
   printf("Number of time steps           = %lld\n", iterations);
@@ -583,6 +773,17 @@ int main(int argc, char ** argv) {
   }
   printf("Particle charge semi-increment = %" PRIu64 "\n", k);
   printf("Vertical velocity              = %" PRIu64 "\n", m);
+  switch(layout) {
+  case AOS:   printf("Particle layout                = AoS\n");   break;
+  case SOA:   printf("Particle layout                = SoA\n");   break;
+  case AOSOA: printf("Particle layout                = AoSoA, block %" PRIu64 "\n",
+                     layout_block);                               break;
+  case BINNED:
+    if (bin_period) printf("Particle layout                = cell-binned, re-sort period %" PRIu64 "\n",
+                           bin_period);
+    else            printf("Particle layout                = cell-binned, re-sort period sweep\n");
+    break;
+  }
 
   /* Initialize grid of charges and particles */
   Qgrid = initializeGrid(L);
@@ -598,12 +799,76 @@ int main(int argc, char ** argv) {
 
   printf("Number of particles placed     = %lld\n", n);
 
+  /* convert the particle array to the requested layout outside the timed loop */
+  if (layout == SOA) {
+    soa.x   = (double*) prk_malloc(n*sizeof(double));
+    soa.y   = (double*) prk_malloc(n*sizeof(double));
+    soa.v_x = (double*) prk_malloc(n*sizeof(double));
+    soa.v_y = (double*) prk_malloc(n*sizeof(double));
+    soa.q   = (double*) prk_malloc(n*sizeof(double));
+    if (!soa.x || !soa.y || !soa.v_x || !soa.v_y || !soa.q) {
+      printf("ERROR: Could not allocate space for SoA particles\n");
+      exit(EXIT_FAILURE);
+    }
+    packSoA(n, particles, &soa);
+  }
+  if (layout == AOSOA) {
+    ntiles = (n+layout_block-1)/layout_block;
+    aosoa = (double*) prk_malloc(ntiles*TILE_FIELDS*layout_block*sizeof(double));
+    if (aosoa == NULL) {
+      printf("ERROR: Could not allocate space for AoSoA particles\n");
+      exit(EXIT_FAILURE);
+    }
+    packAoSoA(n, layout_block, particles, aosoa);
+  }
+  if (layout == BINNED) {
+    particles_aux = (particle_t*) prk_malloc(n*sizeof(particle_t));
+    bin_counts    = (uint64_t*) prk_malloc((L*L+1)*sizeof(uint64_t));
+    if (!particles_aux || !bin_counts) {
+      printf("ERROR: Could not allocate space for particle bins\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  /* with a zero re-sort period the simulation is repeated with the period
+     sweeping through powers of two, to expose the tradeoff between sort
+     cost and cache-friendly particle traversal; each run restarts from a
+     pristine copy of the particles                                        */
+  num_runs = 1;
+  if (layout == BINNED && bin_period == 0) {
+    for (num_runs=1; (1ULL<<num_runs)<=iterations; num_runs++);
+    pristine = (particle_t*) prk_malloc(n*sizeof(particle_t));
+    if (pristine == NULL) {
+      printf("ERROR: Could not allocate space for pristine particle copy\n");
+      exit(EXIT_FAILURE);
+    }
+    memcpy(pristine, particles, n*sizeof(particle_t));
+  }
+
+  for (run=0; run<num_runs; run++) {
+
+  if (layout == BINNED) {
+    period = bin_period ? bin_period : (1ULL<<run);
+    if (num_runs>1 && run>0) memcpy(particles, pristine, n*sizeof(particle_t));
+  }
+
   for (iter=0; iter<=iterations; iter++) {
 
     /* start the timer after one warm-up time step */
     if (iter==1) pic_time = wtime();
 
+    /* the sort is inside the timed region; its cost is part of the tradeoff */
+    if (layout==BINNED && iter%period==0) {
+      sorted = binParticles(n, L, particles, particles_aux, bin_counts);
+      particles_aux = particles;
+      particles = sorted;
+    }
+
     /* Calculate forces on particles and update positions */
+    switch (layout) {
+
+    case BINNED:
+    case AOS:
     for (i=0; i<n; i++) {
       p = particles;
       fx = 0.0;
@@ -620,22 +885,78 @@ int main(int argc, char ** argv) {
       p[i].v_x += ax * DT;
       p[i].v_y += ay * DT;
     }
+    break;
+
+    case SOA:
+    for (i=0; i<n; i++) {
+      fx = 0.0;
+      fy = 0.0;
+      computeTotalForceCoords(soa.x[i], soa.y[i], soa.q[i], L, Qgrid, &fx, &fy);
+      ax = fx * MASS_INV;
+      ay = fy * MASS_INV;
+
+      soa.x[i] = fmod(soa.x[i] + soa.v_x[i]*DT + 0.5*ax*DT*DT + L, L);
+      soa.y[i] = fmod(soa.y[i] + soa.v_y[i]*DT + 0.5*ay*DT*DT + L, L);
+
+      soa.v_x[i] += ax * DT;
+      soa.v_y[i] += ay * DT;
+    }
+    break;
+
+    case AOSOA:
+    for (it=0; it<ntiles; it++) {
+      tx  = aosoa + it*TILE_FIELDS*layout_block;
+      ty  = tx  + layout_block;
+      tvx = ty  + layout_block;
+      tvy = tvx + layout_block;
+      tq  = tvy + layout_block;
+      lanes = MIN(layout_block, n - it*layout_block);
+      for (l=0; l<lanes; l++) {
+        fx = 0.0;
+        fy = 0.0;
+        computeTotalForceCoords(tx[l], ty[l], tq[l], L, Qgrid, &fx, &fy);
+        ax = fx * MASS_INV;
+        ay = fy * MASS_INV;
+
+        tx[l] = fmod(tx[l] + tvx[l]*DT + 0.5*ax*DT*DT + L, L);
+        ty[l] = fmod(ty[l] + tvy[l]*DT + 0.5*ay*DT*DT + L, L);
+
+        tvx[l] += ax * DT;
+        tvy[l] += ay * DT;
+      }
+    }
+    break;
+    }
   }
 
   pic_time = wtime() - pic_time;
 
+  /* bring positions and velocities back to the AoS array for verification */
+  if (layout == SOA)   unpackSoA(n, &soa, particles);
+  if (layout == AOSOA) unpackAoSoA(n, layout_block, aosoa, particles);
+
   /* Run the verification test */
   for (i=0; i<n; i++) {
     correctness *= verifyParticle(particles[i], iterations, Qgrid, L);
   }
 
+  if (num_runs>1 && correctness) {
+    avg_time = n*iterations/pic_time;
+    printf("Re-sort period: %" PRIu64 " Rate (Mparticles_moved/s): %lf\n",
+           period, 1.0e-6*avg_time);
+  }
+
+  } /* end of period sweep runs */
+
   if (correctness) {
     printf("Solution validates\n");
 #if VERBOSE
     printf("Simulation time is %lf seconds\n", pic_time);
 #endif
-    avg_time = n*iterations/pic_time;
-    printf("Rate (Mparticles_moved/s): %lf\n", 1.0e-6*avg_time);
+    if (num_runs==1) {
+      avg_time = n*iterations/pic_time;
+      printf("Rate (Mparticles_moved/s): %lf\n", 1.0e-6*avg_time);
+    }
   } else {
     printf("Solution does not validate\n");
   }
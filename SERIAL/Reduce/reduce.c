@@ -64,7 +64,8 @@ int main(int argc, char ** argv)
   double reduce_time,      /* timing parameters                              */
          avgtime;
   double epsilon=1.e-8;    /* error tolerance                                */
-  int    i, iter;          /* dummies                                        */
+  long   i;                /* element index                                  */
+  int    iter;             /* iteration counter                              */
   double element_value;    /* reference element value for final vector       */
   int    iterations;       /* number of times the reduction is carried out   */
   double * RESTRICT vector;/* vector to be reduced                           */
@@ -135,7 +136,7 @@ int main(int argc, char ** argv)
 
   for (i=0; i<vector_length; i++) {
     if (ABS(vector[i] - element_value) >= epsilon) {
-       printf("First error at i=%d; value: %lf; reference value: %lf\n",
+       printf("First error at i=%ld; value: %lf; reference value: %lf\n",
               i, vector[i], element_value);
        exit(EXIT_FAILURE);
     }
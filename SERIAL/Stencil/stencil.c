@@ -85,7 +85,8 @@ int main(int argc, char ** argv) {
   long   n;               /* linear grid dimension                               */
   int    tile_size;       /* loop nest block factor                              */
   int    tiling=0;        /* boolean indication loop nest blocking               */
-  int    i, j, ii, jj, it, jt, iter;  /* dummies                                 */
+  long   i, j, ii, jj, it, jt;  /* grid indices                                  */
+  int    iter;            /* iteration counter                                   */
   DTYPE  norm,            /* L1 norm of solution                                 */
          reference_norm;
   DTYPE  f_active_points; /* interior of grid with respect to stencil            */
@@ -65,7 +65,8 @@ HISTORY: - Written by Rob Van der Wijngaart, February 2009.
 int main(int argc, char ** argv) {
 
   long   m, n;            /* grid dimensions                                     */
-  int    i, j, iter;      /* dummies                                             */
+  long   i, j;            /* grid indices                                        */
+  int    iter;            /* iteration counter                                   */
   int    iterations;      /* number of times to run the pipeline algorithm       */
   double pipeline_time,   /* timing parameters                                   */
          avgtime; 
@@ -102,6 +103,10 @@ int main(int argc, char ** argv) {
   }
 
   total_length = sizeof(double)*m*n;
+  if (total_length/m != sizeof(double)*n) {
+    printf("ERROR: grid dimensions %ld, %ld overflow space computation\n", m, n);
+    exit(EXIT_FAILURE);
+  }
   vector = (double *) prk_malloc(total_length);
   if (!vector) {
     printf("ERROR: Could not allocate space for array: %ld\n", total_length);
@@ -154,6 +159,11 @@ int main(int argc, char ** argv) {
   printf("Solution validates\n");
 #endif
   avgtime = pipeline_time/iterations;
+  if (avgtime < 100.0*wtime_resolution()) {
+    printf("ERROR: Average time per iteration %lf is within 100x of timer resolution %.3e; increase grid size or iterations\n",
+           avgtime, wtime_resolution());
+    exit(EXIT_FAILURE);
+  }
   printf("Rate (MFlops/s): %lf Avg time (s): %lf\n",
          1.0E-06 * 2 * ((double)((m-1)*(n-1)))/avgtime, avgtime);
 
@@ -72,7 +72,8 @@ int main(int argc, char ** argv) {
   long   order;         /* order of a the matrix                           */
   long   tile_size=32;  /* default tile size for tiling of local transpose */
   int    iterations;    /* number of times to do the transpose             */
-  int    i, j, it, jt, iter;  /* dummies                                   */
+  long   i, j, it, jt;  /* matrix indices                                  */
+  int    iter;          /* iteration counter                               */
   double bytes;         /* combined size of matrices                       */
   double * RESTRICT A_p;/* buffer to hold original matrix                  */
   double * RESTRICT B_p;/* buffer to hold transposed matrix                */
@@ -100,11 +101,15 @@ int main(int argc, char ** argv) {
     exit(EXIT_FAILURE);
   }
 
-  order = atol(*++argv); 
+  order = atol(*++argv);
   if (order < 0){
     printf("ERROR: Matrix Order must be greater than 0 : %ld \n", order);
     exit(EXIT_FAILURE);
   }
+  if (order > 0 && (order*order)/order != order) {
+    printf("ERROR: Matrix Order %ld overflows matrix size computation\n", order);
+    exit(EXIT_FAILURE);
+  }
 
   if (argc == 4) tile_size = atoi(*++argv);
   /* a non-positive tile size means no tiling of the local transpose */
@@ -0,0 +1,518 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+* Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+/*******************************************************************
+
+NAME:    RandomAccess
+
+PURPOSE: This program tests the efficiency of the memory subsystem to
+         update elements of a distributed array with irregular stride.
+
+USAGE:   The program takes as input the 2log of the size of the table that
+         gets updated and the ratio of table size over number of updates.
+         The table is distributed evenly over all participating PEs.
+
+         <progname> <#update ratio> <log2 tablesize> [bucket size]
+
+         By default each update is applied directly to the remote table
+         element with a one-sided atomic XOR. The optional bucket size
+         enables a software aggregation layer: each PE accumulates that
+         many updates in per-destination buckets, then deposits each
+         bucket in the owner's symmetric receive buffer with a put,
+         followed by a flag update (put-with-signal) that tells the
+         owner the data has arrived; the owner applies the updates
+         locally. The bucket size must be a power of two no smaller
+         than LOOKAHEAD.
+
+FUNCTIONS CALLED:
+
+         Other than SHMEM or standard C functions, the following
+         functions are used in this program:
+
+         wtime
+         bail_out()
+         PRK_starts
+         poweroftwo
+
+NOTES:   This program is derived from the MPI1 version of the kernel, which
+         is itself derived from HPC Challenge Random Access. The principal
+         differences between this code and the HPCC version are documented
+         there. Because the update operator (XOR) is commutative and its own
+         inverse, the two timed rounds restore the table to its initial
+         state no matter in which order the updates are applied, so the
+         direct (atomic) and aggregated versions validate identically.
+
+HISTORY: Written by Rob Van der Wijngaart, December 2007.
+         - Adapted to SHMEM, with one-sided atomic updates and optional
+           put-with-signal aggregation.
+
+************************************************************************************/
+
+#include <par-res-kern_general.h>
+#include <par-res-kern_shmem.h>
+
+/* Define 64-bit constants and the atomic XOR flavor matching the u64Int
+   typedef in par-res-kern_general.h (which also keys on this macro)              */
+/* PERIOD = (2^63-1)/7 = 7*73*127*337*92737*649657                                 */
+#ifdef LONG_IS_64BITS
+  #define POLY               0x0000000000000007UL
+  #define PERIOD             1317624576693539401L
+  /* sequence number in series of random numbers to be used as initial value       */
+  #define SEQSEED            834568137686317453L
+  #define PRK_ATOMIC_XOR(t,v,pe) shmem_ulong_atomic_xor(t,v,pe)
+#else
+  #define POLY               0x0000000000000007ULL
+  #define PERIOD             1317624576693539401LL
+  /* sequence number in series of random numbers to be used as initial value       */
+  #define SEQSEED            834568137686317453LL
+  #define PRK_ATOMIC_XOR(t,v,pe) shmem_ulonglong_atomic_xor(t,v,pe)
+#endif
+
+static u64Int PRK_starts(s64Int);
+static int    poweroftwo(int);
+
+int main(int argc, char **argv) {
+
+  int               update_ratio;/* multiplier of tablesize for # updates          */
+  int               nstarts;     /* vector length                                  */
+  s64Int            i, j, round, index, global_index; /* dummies                   */
+  int               proc, dest;  /* dummies                                        */
+  s64Int            tablesize;   /* aggregate table size (all PEs)                 */
+  s64Int            loctablesize;/* local table size (each PE)                     */
+  s64Int            nupdate;     /* number of updates per PE                       */
+  s64Int            tablespace;  /* bytes per PE required for table                */
+  u64Int            *ran;        /* vector of random numbers                       */
+  u64Int            **sendBucket;/* list of per-destination update buckets         */
+  u64Int            *recvBucket; /* symmetric receive buffer, one slot per source  */
+  int               *sizeSendBucket; /* list of send bucket sizes                  */
+  int               *recvCount;  /* symmetric list of receive bucket sizes         */
+  int               *recvFlag;   /* symmetric signal flags, one per source         */
+  int               bucket_size; /* aggregation depth; zero means direct atomics   */
+  s64Int            batch, num_batches; /* flush counters                          */
+  int               agg;         /* number of LOOKAHEAD vectors per bucket         */
+  int               epoch;       /* signal value for current batch                 */
+  u64Int * RESTRICT Table;       /* (pseudo-)randomly accessed array               */
+  double            random_time=0.0;/* timing parameters                           */
+  int               Num_procs,   /* rank parameters                                */
+                    my_ID,       /* rank of calling PE                             */
+                    root=0;      /* ID of master PE                                */
+  int               error=0;     /* error flag for individual PE                   */
+  s64Int            *loc_error;  /* symmetric error counts for reduction           */
+  s64Int            *tot_error;
+  int               log2nproc;   /* log2 of # PEs                                  */
+  int               log2nstarts; /* log2 of vector length                          */
+  int               log2tablesize; /* log2 of aggregate table size                 */
+  int               log2update_ratio; /* log2 of update ratio                      */
+  int               *arguments;  /* command line arguments                         */
+  long              *pSync_bcast;/* work space for collectives                     */
+  long              *pSync_reduce;
+  s64Int            *pWrk;
+
+#if LONG_IS_64BITS
+  if (sizeof(long) != 8) {
+    printf("ERROR: Makefile says \"long\" is 8 bytes, but it is %d bytes\n",
+           sizeof(long));
+    exit(EXIT_FAILURE);
+  }
+#endif
+
+/***********************************************************************************
+** Initialize the SHMEM environment
+************************************************************************************/
+
+  prk_shmem_init();
+  my_ID    = prk_shmem_my_pe();
+  Num_procs= prk_shmem_n_pes();
+
+  if (my_ID == root) {
+    printf("Parallel Research Kernels version %s\n", PRKVERSION);
+    printf("SHMEM Random Access\n");
+  }
+
+  /* initialize sync variables for collectives                                     */
+  pSync_bcast  = (long *)   prk_shmem_align(prk_get_alignment(),PRK_SHMEM_BCAST_SYNC_SIZE*sizeof(long));
+  pSync_reduce = (long *)   prk_shmem_align(prk_get_alignment(),PRK_SHMEM_REDUCE_SYNC_SIZE*sizeof(long));
+  pWrk         = (s64Int *) prk_shmem_align(prk_get_alignment(),sizeof(s64Int)*PRK_SHMEM_REDUCE_MIN_WRKDATA_SIZE);
+  arguments    = (int *)    prk_shmem_align(prk_get_alignment(),3*sizeof(int));
+  loc_error    = (s64Int *) prk_shmem_align(prk_get_alignment(),2*sizeof(s64Int));
+  if (!pSync_bcast || !pSync_reduce || !pWrk || !arguments || !loc_error) {
+    printf("PE %d could not allocate scalar work space on symm heap\n", my_ID);
+    error = 1;
+  }
+  bail_out(error);
+  tot_error = loc_error + 1;
+
+  for(i=0;i<PRK_SHMEM_BCAST_SYNC_SIZE;i++)
+    pSync_bcast[i]=PRK_SHMEM_SYNC_VALUE;
+
+  for(i=0;i<PRK_SHMEM_REDUCE_SYNC_SIZE;i++)
+    pSync_reduce[i]=PRK_SHMEM_SYNC_VALUE;
+
+/***********************************************************************************
+** process, test and broadcast input parameters
+************************************************************************************/
+
+  if (my_ID == root) {
+    if (argc != 3 && argc != 4){
+      printf("Usage: %s <#update ratio> <log2 tablesize> [bucket size]\n", *argv);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    update_ratio  = atoi(*++argv);
+    /* test whether update ratio is a power of two                                 */
+    log2update_ratio = poweroftwo(update_ratio);
+    if (log2update_ratio <0) {
+      printf("ERROR: Invalid update ratio: %d, must be a power of 2\n",
+             update_ratio);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    /* test whether number of PEs is a power of two                                */
+    log2nproc = poweroftwo(Num_procs);
+    if (log2nproc <0) {
+      printf("ERROR: Invalid number of PEs: %d, must be a power of 2\n",
+             Num_procs);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    log2tablesize  = atoi(*++argv);
+    if (log2tablesize < 1 || log2tablesize < log2nproc){
+      printf("ERROR: Log2 tablesize is %d; must be >= 1 and >= log2 #PEs\n",
+             log2tablesize);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    /* for simplicity we set the vector length equal to the LOOKAHEAD size         */
+    nstarts = LOOKAHEAD;
+
+    /* test whether vector length is a power of two                                */
+    log2nstarts = poweroftwo(nstarts);
+    if (log2nstarts <0) {
+      printf("ERROR: Invalid vector length: %d, must be a power of 2\n",
+             nstarts);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    /* compute local table size and number of updates; because the table size
+       is a power of two, overflow shows up as a nonpositive size                  */
+    loctablesize = (s64Int)1<<(log2tablesize-log2nproc);
+    if (loctablesize <= 0) {
+      printf("ERROR: Requested table size too large; reduce log2 tablesize = %d\n",
+              log2tablesize);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+    tablesize = loctablesize * Num_procs;
+
+    if ((log2tablesize + log2update_ratio) < (log2nproc+log2nstarts)) {
+      printf("ERROR: Table size ("FSTR64U") times update ratio (%d) must be at ",
+             ((s64Int)1<<log2tablesize), update_ratio);
+      printf("least equal to number of PEs (%d) times vector length (%d)\n",
+             Num_procs, nstarts);
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    nupdate = update_ratio * loctablesize;
+    if (nupdate/loctablesize != update_ratio) {
+      printf("Requested number of updates too large; ");
+      printf("reduce log2 tablesize or update ratio\n");
+      error = 1;
+      goto ENDOFTESTS;
+    }
+
+    /* optionally engage the aggregation layer                                     */
+    bucket_size = 0;
+    if (argc == 4) {
+      bucket_size = atoi(*++argv);
+      if (bucket_size != 0 &&
+          (poweroftwo(bucket_size) < 0 || bucket_size < nstarts ||
+           (s64Int)bucket_size*2 > nupdate)) {
+        printf("ERROR: Invalid bucket size: %d, must be a power of 2 between ",
+               bucket_size);
+        printf("LOOKAHEAD (%d) and half the number of updates per PE\n", nstarts);
+        error = 1;
+        goto ENDOFTESTS;
+      }
+    }
+
+    printf("Number of PEs                 = "FSTR64U"\n", (u64Int) Num_procs);
+    printf("Table size (aggregate)        = "FSTR64U"\n", tablesize);
+    printf("Update ratio                  = "FSTR64U"\n", (u64Int) update_ratio);
+    printf("Number of updates (aggregate) = "FSTR64U"\n", nupdate*Num_procs);
+    printf("Vector (LOOKAHEAD) length     = "FSTR64U"\n", (u64Int) nstarts);
+    if (bucket_size) printf("Update method                 = aggregated, bucket size %d\n",
+                            bucket_size);
+    else             printf("Update method                 = direct atomic XOR\n");
+
+    arguments[0] = update_ratio;
+    arguments[1] = log2tablesize;
+    arguments[2] = bucket_size;
+
+    ENDOFTESTS:;
+  }
+  bail_out(error);
+
+  /* broadcast the command line arguments; all derived quantities are
+     recomputed identically on each PE                                             */
+  shmem_broadcast32(&arguments[0], &arguments[0], 3, root, 0, 0, Num_procs, pSync_bcast);
+  shmem_barrier_all();
+
+  update_ratio     = arguments[0];
+  log2tablesize    = arguments[1];
+  bucket_size      = arguments[2];
+  log2update_ratio = poweroftwo(update_ratio);
+  log2nproc        = poweroftwo(Num_procs);
+  nstarts          = LOOKAHEAD;
+  log2nstarts      = poweroftwo(nstarts);
+  loctablesize     = (s64Int)1<<(log2tablesize-log2nproc);
+  tablesize        = loctablesize * Num_procs;
+  nupdate          = update_ratio * loctablesize;
+  tablespace       = (size_t) loctablesize*sizeof(u64Int);
+
+  shmem_barrier_all();
+  prk_shmem_free(arguments);
+
+  ran = (u64Int *) prk_malloc(nstarts*sizeof(u64Int));
+  if (!ran) {
+    printf("ERROR: PE %d could not allocate %zu bytes for random numbers\n",
+           my_ID, nstarts*sizeof(u64Int));
+    error = 1;
+  }
+  bail_out(error);
+
+  /* the table must be symmetric so that remote PEs can update it                  */
+  Table = (u64Int *) prk_shmem_align(prk_get_alignment(),tablespace);
+  if (!Table) {
+    printf("ERROR: PE %d could not allocate space of "FSTR64U" bytes for table\n",
+           my_ID, (u64Int) tablespace);
+    error = 1;
+  }
+  bail_out(error);
+
+  if (bucket_size) {
+    /* allocate local send buckets and symmetric receive buffers; each source
+       PE owns a fixed slot in the receive buffer of each destination              */
+    sendBucket = (u64Int **) prk_malloc(Num_procs*sizeof(u64Int *));
+    if (sendBucket)
+      sendBucket[0] = (u64Int *) prk_malloc((size_t)Num_procs*bucket_size*sizeof(u64Int));
+    if (!sendBucket || !sendBucket[0]) {
+      printf("ERROR: PE %d could not allocate send bucket space\n", my_ID);
+      error = 1;
+    }
+    bail_out(error);
+    for (proc=1; proc<Num_procs; proc++)
+      sendBucket[proc] = sendBucket[0] + (size_t)proc*bucket_size;
+
+    sizeSendBucket = (int *) prk_malloc(Num_procs*sizeof(int));
+    recvBucket = (u64Int *) prk_shmem_align(prk_get_alignment(),
+                            (size_t)Num_procs*bucket_size*sizeof(u64Int));
+    recvCount  = (int *) prk_shmem_align(prk_get_alignment(),Num_procs*sizeof(int));
+    recvFlag   = (int *) prk_shmem_align(prk_get_alignment(),Num_procs*sizeof(int));
+    if (!sizeSendBucket || !recvBucket || !recvCount || !recvFlag) {
+      printf("ERROR: PE %d could not allocate receive bucket space\n", my_ID);
+      error = 1;
+    }
+    bail_out(error);
+    for (proc=0; proc<Num_procs; proc++) recvFlag[proc] = 0;
+  }
+
+  /* initialize the table */
+  for(i=0;i<loctablesize;i++) Table[i] = (u64Int) (i+ loctablesize*my_ID);
+
+  shmem_barrier_all();
+  if (my_ID == root) {
+    random_time = wtime();
+  }
+
+  /* do two identical rounds of Random Access to ensure we recover initial table   */
+  for (round=0; round <2; round++) {
+    /* compute seeds for independent streams, using jump-ahead feature             */
+    for (j=0; j<nstarts; j++) {
+      ran[j] = PRK_starts(SEQSEED+(nupdate/nstarts)*j+loctablesize*my_ID);
+    }
+
+    if (!bucket_size) {
+
+      /* direct mode: fire one atomic XOR at the owner of each table element       */
+      for (i=0; i<nupdate/(nstarts*2); i++) {
+        for (j=0; j<nstarts; j++) {
+          /* compute new random number                                             */
+          ran[j] = (ran[j] << 1) ^ ((s64Int)ran[j] < 0? POLY: 0);
+          global_index = (ran[j] & (tablesize-1));
+          /* determine destination rank (high order bits of global table index)    */
+          dest  = global_index>>(log2tablesize-log2nproc);
+          index = ran[j] & (loctablesize-1);
+          PRK_ATOMIC_XOR(&Table[index], ran[j], dest);
+        }
+      }
+      /* the barrier completes all outstanding atomics                             */
+      shmem_barrier_all();
+    }
+    else {
+
+      /* aggregated mode: fill per-destination buckets, deposit each bucket in
+         the owner's receive buffer, and signal arrival with a flag update         */
+      agg         = bucket_size/nstarts;
+      num_batches = nupdate/(2*bucket_size);
+
+      for (batch=0; batch<num_batches; batch++) {
+
+        /* reset actual send bucket sizes                                          */
+        for (proc=0; proc<Num_procs; proc++) sizeSendBucket[proc] = 0;
+
+        for (i=0; i<agg; i++) {
+          for (j=0; j<nstarts; j++) {
+            /* compute new random number                                           */
+            ran[j] = (ran[j] << 1) ^ ((s64Int)ran[j] < 0? POLY: 0);
+            global_index = (ran[j] & (tablesize-1));
+            /* determine destination rank (high order bits of global table index)  */
+            dest = global_index>>(log2tablesize-log2nproc);
+            sendBucket[dest][sizeSendBucket[dest]++] = ran[j];
+          }
+        }
+
+        /* deposit buckets; the fence orders data and count before the signal      */
+        epoch = (int) (round*num_batches+batch+1);
+        for (proc=0; proc<Num_procs; proc++) {
+          dest = (my_ID+proc)%Num_procs;
+          shmem_put64(&recvBucket[(size_t)my_ID*bucket_size], sendBucket[dest],
+                      sizeSendBucket[dest], dest);
+          shmem_int_p(&recvCount[my_ID], sizeSendBucket[dest], dest);
+          shmem_fence();
+          shmem_int_p(&recvFlag[my_ID], epoch, dest);
+        }
+
+        /* wait for all signals, then apply the updates locally                    */
+        for (proc=0; proc<Num_procs; proc++) {
+          shmem_int_wait_until(&recvFlag[proc], SHMEM_CMP_EQ, epoch);
+          for (j=0; j<recvCount[proc]; j++) {
+            index = recvBucket[(size_t)proc*bucket_size+j] & (loctablesize-1);
+            Table[index] ^= recvBucket[(size_t)proc*bucket_size+j];
+          }
+        }
+
+        /* no PE may refill a receive buffer before its owner has drained it       */
+        shmem_barrier_all();
+      }
+    }
+  }
+
+  if (my_ID == root) random_time = wtime() - random_time;
+
+  /* verification test */
+  loc_error[0] = 0;
+  for(i=0;i<loctablesize;i++) {
+    if(Table[i] != (u64Int) (i + loctablesize*my_ID)) {
+#if VERBOSE
+      printf("ERROR: Table["FSTR64U"]="FSTR64U" on PE %d\n",i,Table[i],my_ID);
+#endif
+      loc_error[0]++;
+    }
+  }
+
+  if (loc_error[0] != 0) {
+    printf("ERROR: number of incorrect table elements on PE %d = "FSTR64U"\n",
+           my_ID, loc_error[0]);
+  }
+
+  shmem_barrier_all();
+#ifdef LONG_IS_64BITS
+  shmem_long_sum_to_all(tot_error, loc_error, 1, 0, 0, Num_procs, pWrk, pSync_reduce);
+#else
+  shmem_longlong_sum_to_all(tot_error, loc_error, 1, 0, 0, Num_procs, pWrk, pSync_reduce);
+#endif
+
+  if (my_ID==root) {
+    if (!(*tot_error)) {
+      printf("Solution validates\n");
+      printf("Rate (GUPS/s): %lf, Time (s): %lf\n",
+             1.e-9*(nupdate*Num_procs)/random_time, random_time);
+    }
+    else {
+      printf("Total number of incorrect table elements: "FSTR64U"\n", *tot_error);
+    }
+  }
+
+  prk_shmem_finalize();
+  exit(EXIT_SUCCESS);
+}
+
+/* Utility routine to start random number generator at nth step                    */
+u64Int PRK_starts(s64Int n)
+{
+  int i, j;
+  u64Int m2[64];
+  u64Int temp, ran;
+
+  while (n < 0) n += PERIOD;
+  while (n > PERIOD) n -= PERIOD;
+  if (n == 0) return 0x1;
+
+  temp = 0x1;
+  for (i=0; i<64; i++) {
+    m2[i] = temp;
+    temp = (temp << 1) ^ ((s64Int) temp < 0 ? POLY : 0);
+    temp = (temp << 1) ^ ((s64Int) temp < 0 ? POLY : 0);
+  }
+
+  for (i=62; i>=0; i--)
+    if ((n >> i) & 1)
+      break;
+
+  ran = 0x2;
+  while (i > 0) {
+    temp = 0;
+    for (j=0; j<64; j++)
+      if ((unsigned int)((ran >> j) & 1))
+        temp ^= m2[j];
+    ran = temp;
+    i -= 1;
+    if ((n >> i) & 1)
+      ran = (ran << 1) ^ ((s64Int) ran < 0 ? POLY : 0);
+  }
+
+  return ran;
+}
+
+/* utility routine that tests whether an integer is a power of two                 */
+int poweroftwo(int n) {
+  int log2n = 0;
+
+  while ((1<<log2n)<n) log2n++;
+  if (1<<log2n != n) return (-1);
+  else               return (log2n);
+}
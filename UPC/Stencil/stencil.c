@@ -95,6 +95,8 @@ typedef shared [] local_shared_block *local_shared_block_ptrs;
 typedef local_shared_block *private_shared_block_ptrs;
 
 shared [1] double norms[THREADS];
+shared [1] long local_accesses[THREADS];  /* grid words a thread touches locally  */
+shared [1] long remote_accesses[THREADS]; /* halo words a thread fetches remotely */
 shared [1] local_shared_block_ptrs in_arrays[THREADS];
 shared [1] local_shared_block_ptrs out_arrays[THREADS];
 
@@ -394,22 +396,23 @@ int main(int argc, char ** argv) {
         upc_memget(&in_array_private[y][startx], &private_in_arrays[peer][y][startx], transfer_size);
       }
     }
-    /* LEFT */
+    /* LEFT; the halo is contiguous in x, so fetch each row in bulk rather
+       than one shared-pointer dereference per word                          */
     if(my_IDx != 0){
       int peer = my_IDy * Num_procsx + my_IDx - 1;
       for (int y=starty; y<endy; y++) {
-        for (int x=startx - RADIUS; x<startx; x++) {
-          in_array_private[y][x] = private_in_arrays[peer][y][x];
-        }
+        upc_memget(&in_array_private[y][startx - RADIUS],
+                   &private_in_arrays[peer][y][startx - RADIUS],
+                   RADIUS * sizeof(DTYPE));
       }
     }
     /* RIGHT*/
     if(my_IDx != Num_procsx - 1){
       int peer = my_IDy * Num_procsx + my_IDx + 1;
       for (int y=starty; y<endy; y++) {
-        for (int x=endx; x<endx + RADIUS; x++) {
-          in_array_private[y][x] = private_in_arrays[peer][y][x];
-        }
+        upc_memget(&in_array_private[y][endx],
+                   &private_in_arrays[peer][y][endx],
+                   RADIUS * sizeof(DTYPE));
       }
     }
 
@@ -439,6 +442,19 @@ int main(int argc, char ** argv) {
   stencil_time = wtime() - stencil_time;
   times[MYTHREAD] = stencil_time;
 
+  /* tally grid accesses per iteration: every stencil application reads
+     stencil_size input words and updates one output word locally; the only
+     remote traffic is the halo words fetched from the four neighbors       */
+  long local_words = (long)(endx - startx) * (long)(endy - starty)
+                   * (long)(stencil_size + 1);
+  long remote_words = 0;
+  if(my_IDy != 0)              remote_words += (long)RADIUS * (endx - startx);
+  if(my_IDy != Num_procsy - 1) remote_words += (long)RADIUS * (endx - startx);
+  if(my_IDx != 0)              remote_words += (long)RADIUS * (endy - starty);
+  if(my_IDx != Num_procsx - 1) remote_words += (long)RADIUS * (endy - starty);
+  local_accesses[MYTHREAD]  = local_words;
+  remote_accesses[MYTHREAD] = remote_words;
+
   upc_barrier;
 
   // Compute max_time
@@ -486,6 +502,15 @@ int main(int argc, char ** argv) {
 #endif
     }
 
+    long total_local = 0, total_remote = 0;
+    for(int i=0; i<THREADS; i++){
+      total_local  += local_accesses[i];
+      total_remote += remote_accesses[i];
+    }
+    printf("Local accesses/iteration  = %ld words\n", total_local);
+    printf("Remote accesses/iteration = %ld words (%lf%%)\n", total_remote,
+           100.0*(double)total_remote/(double)(total_local+total_remote));
+
     flops = (DTYPE) (2*stencil_size+1) * f_active_points;
     avgtime = max_time/iterations;
     printf("Rate (MFlops/s): "FSTR"  Avg time (s): %lf\n",
@@ -0,0 +1,114 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+      * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*******************************************************************
+
+NAME:      MPI_rank_stats
+
+PURPOSE:   Report the distribution of per-rank times of the timed
+           kernel section, and name the slowest ranks and the nodes
+           they ran on, so a slow DIMM or a throttled socket shows
+           up in the benchmark output itself instead of requiring a
+           separate forensic run.
+
+           The report is disabled by default; setting environment
+           variable PRK_RANK_STATS=<k> prints the min/median/max of
+           the per-rank times plus the k slowest ranks.  Collective
+           calls to MPI_Gather are made only when enabled, so the
+           default cost is a getenv.
+
+HISTORY:   Written August 2026.
+
+*******************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mpi.h>
+
+static int compare_doubles(const void *a, const void *b)
+{
+  const double da = *(const double *)a;
+  const double db = *(const double *)b;
+  return (da > db) - (da < db);
+}
+
+void prk_report_rank_stats(double local_time, MPI_Comm comm)
+{
+  const char *e = getenv("PRK_RANK_STATS");
+  int topk, np, me, root=0, i, k, namelen;
+  double *times=NULL, *sorted=NULL;
+  char *names=NULL, myname[MPI_MAX_PROCESSOR_NAME];
+
+  if (!e) return;
+  topk = atoi(e);
+  if (topk < 1) return;
+
+  MPI_Comm_size(comm, &np);
+  MPI_Comm_rank(comm, &me);
+  if (topk > np) topk = np;
+
+  memset(myname, 0, sizeof(myname));
+  MPI_Get_processor_name(myname, &namelen);
+  if (me == root) {
+    times  = (double *) malloc(np*sizeof(double));
+    sorted = (double *) malloc(np*sizeof(double));
+    names  = (char *)   malloc((size_t)np*MPI_MAX_PROCESSOR_NAME);
+    if (!times || !sorted || !names) {
+      printf("ERROR: could not allocate space for rank statistics\n");
+      MPI_Abort(comm, 66);
+    }
+  }
+  MPI_Gather(&local_time, 1, MPI_DOUBLE, times, 1, MPI_DOUBLE, root, comm);
+  MPI_Gather(myname, MPI_MAX_PROCESSOR_NAME, MPI_CHAR,
+             names,  MPI_MAX_PROCESSOR_NAME, MPI_CHAR, root, comm);
+
+  if (me == root) {
+    memcpy(sorted, times, np*sizeof(double));
+    qsort(sorted, np, sizeof(double), compare_doubles);
+    printf("Rank time (s): min %lf p50 %lf max %lf imbalance (max/p50) %lf\n",
+           sorted[0], sorted[np/2], sorted[np-1],
+           sorted[np/2] > 0.0 ? sorted[np-1]/sorted[np/2] : 0.0);
+    printf("Slowest ranks:");
+    for (k=0; k<topk; k++) {
+      int slow = 0;
+      for (i=1; i<np; i++) if (times[i] > times[slow]) slow = i;
+      printf(" %d (%s, %lf s)", slow, names+(size_t)slow*MPI_MAX_PROCESSOR_NAME,
+             times[slow]);
+      times[slow] = -1.0; /* exclude from the next pass                     */
+    }
+    printf("\n");
+    free(names);
+    free(sorted);
+    free(times);
+  }
+}
@@ -0,0 +1,181 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+      * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*******************************************************************
+
+NAME:      MPI_remap
+
+PURPOSE:   Node-aware rank remapping for the MPI kernels. The default
+           rank order places consecutive ranks on the same node only
+           if the launcher happens to do so; with a 2D rank grid even
+           that does not make grid neighbors node neighbors. These
+           routines discover which ranks share a node (through
+           MPI_Comm_split_type) and fold the rank grid so that the
+           ranks of each node form a compact sub-block of the grid,
+           which minimizes the number of halo exchanges that cross
+           the network. Remapping is requested by setting the
+           environment variable PRK_TOPOLOGY_REMAP to a nonzero
+           value; when it is not requested, or when the rank grid
+           cannot be folded (non-uniform node population, or node and
+           grid factorizations that do not match), the communicator
+           is a plain duplicate and the rank order is unchanged.
+
+HISTORY:   Written 2020.
+
+*******************************************************************/
+
+#include <par-res-kern_general.h>
+#include <par-res-kern_mpi.h>
+
+#if MPI_VERSION >= 3
+/* Identify each node by the lowest global rank it hosts. Returns the
+   gathered array of node leaders (to be released by the caller with
+   prk_free), plus the caller's leader and position within the node  */
+static int *node_leaders(MPI_Comm comm, int *my_leader,
+                         int *node_rank, int *node_size)
+{
+  MPI_Comm nodecomm;
+  int my_ID, Num_procs, *leaders;
+
+  MPI_Comm_rank(comm, &my_ID);
+  MPI_Comm_size(comm, &Num_procs);
+
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+                      &nodecomm);
+  MPI_Comm_rank(nodecomm, node_rank);
+  MPI_Comm_size(nodecomm, node_size);
+  *my_leader = my_ID;
+  MPI_Allreduce(MPI_IN_PLACE, my_leader, 1, MPI_INT, MPI_MIN, nodecomm);
+  MPI_Comm_free(&nodecomm);
+
+  leaders = (int *) prk_malloc(Num_procs*sizeof(int));
+  if (!leaders) MPI_Abort(comm, 666);
+  MPI_Allgather(my_leader, 1, MPI_INT, leaders, 1, MPI_INT, comm);
+  return leaders;
+}
+#endif
+
+/* Return a communicator in which the ranks of an npx x npy rank grid
+   (row major, rank = y*npx + x) are renumbered so that co-located
+   ranks occupy a compact sub-block of the grid. A 1D decomposition
+   passes npy = 1. See the header comment for when the rank order is
+   left unchanged                                                    */
+MPI_Comm prk_node_aware_comm(MPI_Comm comm, int npx, int npy)
+{
+  MPI_Comm newcomm;
+  int my_ID;
+  char *envar = getenv("PRK_TOPOLOGY_REMAP");
+
+  MPI_Comm_rank(comm, &my_ID);
+
+  if (!envar || atoi(envar) == 0) {
+    MPI_Comm_dup(comm, &newcomm);
+    return newcomm;
+  }
+
+#if MPI_VERSION >= 3
+  int Num_procs, my_leader, node_rank, node_size, *leaders;
+  int node_id=0, num_nodes=0, minsize, maxsize;
+
+  MPI_Comm_size(comm, &Num_procs);
+  leaders = node_leaders(comm, &my_leader, &node_rank, &node_size);
+
+  /* number nodes in increasing order of their leader's rank        */
+  for (int i=0; i<Num_procs; i++) {
+    if (leaders[i] == i) {       /* rank i leads its node           */
+      if (i < my_leader) node_id++;
+      num_nodes++;
+    }
+  }
+  prk_free(leaders);
+
+  /* the folding below requires a uniform node population           */
+  minsize = maxsize = node_size;
+  MPI_Allreduce(MPI_IN_PLACE, &minsize, 1, MPI_INT, MPI_MIN, comm);
+  MPI_Allreduce(MPI_IN_PLACE, &maxsize, 1, MPI_INT, MPI_MAX, comm);
+
+  /* factor the node count into a grid of nodes, closest to square,
+     such that each node covers a whole tile of the rank grid       */
+  int nodes_x=0, nodes_y=0;
+  if (minsize == maxsize) {
+    for (int ny=1; ny<=num_nodes; ny++) {
+      if (num_nodes%ny) continue;
+      int nx = num_nodes/ny;
+      if (npx%nx || npy%ny)                 continue;
+      if ((npx/nx)*(npy/ny) != node_size)   continue;
+      if (nodes_x==0 || ABS(nx-ny) < ABS(nodes_x-nodes_y)) {
+        nodes_x = nx; nodes_y = ny;
+      }
+    }
+  }
+
+  if (nodes_x == 0) {
+    if (my_ID == 0)
+      printf("WARNING: cannot fold %dx%d rank grid onto %d node(s) of %d rank(s); keeping default rank order\n",
+             npx, npy, num_nodes, maxsize);
+    MPI_Comm_dup(comm, &newcomm);
+    return newcomm;
+  }
+
+  /* place the ranks of each node in a compact tilex x tiley
+     sub-block of the rank grid, so grid neighbors are node
+     neighbors; ties in the new rank cannot occur                   */
+  int tilex = npx/nodes_x, tiley = npy/nodes_y;
+  int gx = (node_id%nodes_x)*tilex + node_rank%tilex;
+  int gy = (node_id/nodes_x)*tiley + node_rank/tilex;
+  MPI_Comm_split(comm, 0, gy*npx+gx, &newcomm);
+  return newcomm;
+#else
+  if (my_ID == 0)
+    printf("WARNING: topology remapping requires MPI-3; keeping default rank order\n");
+  MPI_Comm_dup(comm, &newcomm);
+  return newcomm;
+#endif
+}
+
+/* Return how many of the listed communication partners of the
+   calling rank live on a different node; all ranks of comm must
+   participate. Without MPI-3 node discovery the answer is zero     */
+int prk_count_offnode(MPI_Comm comm, int nbrs[], int num_nbrs)
+{
+#if MPI_VERSION >= 3
+  int my_leader, node_rank, node_size, count=0;
+  int *leaders = node_leaders(comm, &my_leader, &node_rank, &node_size);
+
+  for (int i=0; i<num_nbrs; i++)
+    if (leaders[nbrs[i]] != my_leader) count++;
+  prk_free(leaders);
+  return count;
+#else
+  return 0;
+#endif
+}
@@ -0,0 +1,186 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+      * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*******************************************************************
+
+NAME:      prk_counters
+
+PURPOSE:   Read a configurable perf-event set around the timed region
+           of the C kernels and print per-iteration rates, so runs on
+           systems without external profilers still show whether a
+           regression is compute or memory bound.  See
+           include/prk_counters.h for the calling convention.
+
+HISTORY:   Written 2020.
+
+*******************************************************************/
+
+/* for syscall() under strict -std= modes                          */
+#define _GNU_SOURCE
+
+#include <par-res-kern_general.h>
+#include "prk_counters.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define PRK_HAVE_PERF_EVENT 1
+#endif
+
+#define PRK_COUNTERS_MAX 8
+
+static int       num_counters = -1; /* -1: not yet initialized */
+
+#if defined(PRK_HAVE_PERF_EVENT)
+
+static int       counter_fd[PRK_COUNTERS_MAX];
+static long long counter_value[PRK_COUNTERS_MAX];
+static char      counter_name[PRK_COUNTERS_MAX][32];
+
+struct prk_event_map {
+  const char *name;
+  uint32_t    type;
+  uint64_t    config;
+};
+
+static const struct prk_event_map known_events[] = {
+  { "cycles",           PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES          },
+  { "instructions",     PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS        },
+  { "cache-references", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES    },
+  { "cache-misses",     PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES        },
+  { "branches",         PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS },
+  { "branch-misses",    PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES       },
+  { "page-faults",      PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS         },
+};
+
+static int prk_open_event(uint32_t type, uint64_t config)
+{
+  struct perf_event_attr pe;
+  memset(&pe, 0, sizeof(pe));
+  pe.type           = type;
+  pe.size           = sizeof(pe);
+  pe.config         = config;
+  pe.disabled       = 1;
+  pe.exclude_kernel = 1;
+  pe.exclude_hv     = 1;
+  return syscall(SYS_perf_event_open, &pe, 0, -1, -1, 0);
+}
+
+#endif /* PRK_HAVE_PERF_EVENT */
+
+static void prk_counters_init(void)
+{
+  num_counters = 0;
+#if defined(PRK_HAVE_PERF_EVENT)
+  const char *e = getenv("PRK_COUNTERS");
+  if (e == NULL) return;
+
+  char list[256];
+  if (!strcmp(e,"1") || !strcmp(e,"default")) {
+    strncpy(list, "cycles,instructions,cache-misses", sizeof(list)-1);
+  }
+  else {
+    strncpy(list, e, sizeof(list)-1);
+  }
+  list[sizeof(list)-1] = '\0';
+
+  char *save = NULL;
+  for (char *tok = strtok_r(list, ",", &save);
+       tok != NULL && num_counters < PRK_COUNTERS_MAX;
+       tok = strtok_r(NULL, ",", &save)) {
+    int found = 0;
+    for (size_t i=0; i<sizeof(known_events)/sizeof(known_events[0]); i++) {
+      if (!strcmp(tok, known_events[i].name)) {
+        found = 1;
+        int fd = prk_open_event(known_events[i].type, known_events[i].config);
+        if (fd >= 0) {
+          counter_fd[num_counters] = fd;
+          strncpy(counter_name[num_counters], known_events[i].name,
+                  sizeof(counter_name[0])-1);
+          counter_name[num_counters][sizeof(counter_name[0])-1] = '\0';
+          num_counters++;
+        }
+        else {
+          printf("WARNING: could not open perf event %s\n", tok);
+        }
+        break;
+      }
+    }
+    if (!found) printf("WARNING: unknown perf event %s\n", tok);
+  }
+#endif
+}
+
+void prk_counters_start(void)
+{
+  if (num_counters < 0) prk_counters_init();
+#if defined(PRK_HAVE_PERF_EVENT)
+  for (int i=0; i<num_counters; i++) {
+    ioctl(counter_fd[i], PERF_EVENT_IOC_RESET,  0);
+    ioctl(counter_fd[i], PERF_EVENT_IOC_ENABLE, 0);
+  }
+#endif
+}
+
+void prk_counters_stop(void)
+{
+#if defined(PRK_HAVE_PERF_EVENT)
+  for (int i=0; i<num_counters; i++) {
+    ioctl(counter_fd[i], PERF_EVENT_IOC_DISABLE, 0);
+    if (read(counter_fd[i], &counter_value[i], sizeof(long long)) !=
+        sizeof(long long)) {
+      counter_value[i] = -1;
+    }
+  }
+#endif
+}
+
+void prk_counters_report(int iterations)
+{
+#if defined(PRK_HAVE_PERF_EVENT)
+  if (num_counters <= 0) return;
+  long long cycles = -1, instructions = -1;
+  printf("Performance counters, calling thread, per iteration:\n");
+  for (int i=0; i<num_counters; i++) {
+    printf("  %-18s %13.4e\n", counter_name[i],
+           (double)counter_value[i]/(double)iterations);
+    if (!strcmp(counter_name[i], "cycles"))       cycles       = counter_value[i];
+    if (!strcmp(counter_name[i], "instructions")) instructions = counter_value[i];
+  }
+  if (cycles > 0 && instructions > 0) {
+    printf("  %-18s %13.2f\n", "IPC",
+           (double)instructions/(double)cycles);
+  }
+#endif
+}
@@ -0,0 +1,152 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+      * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*******************************************************************
+
+NAME:      prk_energy
+
+PURPOSE:   Sample RAPL package energy and average core frequency
+           around the timed region of the C kernels and print J, W,
+           GHz and rate-per-watt next to the rate output.  See
+           include/prk_energy.h for the calling convention.
+
+HISTORY:   Written 2020.
+
+*******************************************************************/
+
+#include <par-res-kern_general.h>
+#include "prk_energy.h"
+
+#define PRK_ENERGY_MAX_PACKAGES 16
+
+static int    num_packages = -1; /* -1: not yet initialized */
+static double max_range_uj[PRK_ENERGY_MAX_PACKAGES];
+static double start_uj[PRK_ENERGY_MAX_PACKAGES];
+static double start_time, seconds;
+static double joules;
+static double start_khz, stop_khz;
+
+/* current energy_uj reading of one package, negative on failure      */
+static double prk_energy_read_uj(int package)
+{
+  char path[128];
+  snprintf(path, sizeof(path),
+           "/sys/class/powercap/intel-rapl:%d/energy_uj", package);
+  FILE *f = fopen(path, "r");
+  if (f == NULL) return -1.0;
+  double uj = -1.0;
+  if (fscanf(f, "%lf", &uj) != 1) uj = -1.0;
+  fclose(f);
+  return uj;
+}
+
+/* average scaling_cur_freq over all cpus in kHz, zero on failure     */
+static double prk_energy_read_khz(void)
+{
+  double sum = 0.0;
+  int    cpus = 0;
+  for (int cpu = 0; ; cpu++) {
+    char path[128];
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_cur_freq", cpu);
+    FILE *f = fopen(path, "r");
+    if (f == NULL) break;
+    double khz;
+    if (fscanf(f, "%lf", &khz) == 1) {
+      sum += khz;
+      cpus++;
+    }
+    fclose(f);
+  }
+  return (cpus > 0) ? sum/cpus : 0.0;
+}
+
+static void prk_energy_init(void)
+{
+  num_packages = 0;
+  const char *e = getenv("PRK_ENERGY");
+  if (e == NULL || atoi(e) == 0) return;
+
+  for (int p = 0; p < PRK_ENERGY_MAX_PACKAGES; p++) {
+    if (prk_energy_read_uj(p) < 0.0) break;
+    char path[128];
+    snprintf(path, sizeof(path),
+             "/sys/class/powercap/intel-rapl:%d/max_energy_range_uj", p);
+    FILE *f = fopen(path, "r");
+    max_range_uj[p] = 0.0;
+    if (f != NULL) {
+      if (fscanf(f, "%lf", &max_range_uj[p]) != 1) max_range_uj[p] = 0.0;
+      fclose(f);
+    }
+    num_packages++;
+  }
+  if (num_packages == 0) {
+    printf("WARNING: PRK_ENERGY set but no RAPL packages found\n");
+  }
+}
+
+void prk_energy_start(void)
+{
+  if (num_packages < 0) prk_energy_init();
+  if (num_packages == 0) return;
+  for (int p = 0; p < num_packages; p++) {
+    start_uj[p] = prk_energy_read_uj(p);
+  }
+  start_khz  = prk_energy_read_khz();
+  start_time = wtime();
+}
+
+void prk_energy_stop(void)
+{
+  if (num_packages <= 0) return;
+  seconds  = wtime() - start_time;
+  stop_khz = prk_energy_read_khz();
+  joules   = 0.0;
+  for (int p = 0; p < num_packages; p++) {
+    double delta = prk_energy_read_uj(p) - start_uj[p];
+    /* the RAPL counter wraps at max_energy_range_uj                  */
+    if (delta < 0.0) delta += max_range_uj[p];
+    joules += 1.0e-6*delta;
+  }
+}
+
+void prk_energy_report(double rate, const char *unit)
+{
+  if (num_packages <= 0 || seconds <= 0.0) return;
+  printf("Energy (J): %lf  Average power (W): %lf", joules, joules/seconds);
+  double ghz = 1.0e-6*0.5*(start_khz+stop_khz);
+  if (ghz > 0.0) printf("  Average frequency (GHz): %lf", ghz);
+  printf("\n");
+  if (joules > 0.0) {
+    printf("%s/W: %lf\n", unit, rate/(joules/seconds));
+  }
+}
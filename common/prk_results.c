@@ -0,0 +1,154 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without 
+modification, are permitted provided that the following conditions 
+are met:
+
+* Redistributions of source code must retain the above copyright 
+      notice, this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above 
+      copyright notice, this list of conditions and the following 
+      disclaimer in the documentation and/or other materials provided 
+      with the distribution.
+      * Neither the name of Intel Corporation nor the names of its 
+      contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS 
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, 
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*******************************************************************
+
+NAME:      prk_results
+
+PURPOSE:   Emit benchmark parameters and timings as one JSON or CSV
+           record, so fleet automation does not have to parse the
+           free-text stdout of each kernel.  See include/prk_results.h
+           for the calling convention.
+
+HISTORY:   Written 2020.
+
+*******************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "prk_results.h"
+
+#define PRK_RESULTS_MAX_KV    64
+#define PRK_RESULTS_MAX_ITERS 65536
+
+static char   kernel_name[64];
+static int    format; /* 0 = disabled, 1 = json, 2 = csv */
+static int    num_kv;
+static char   kv_key[PRK_RESULTS_MAX_KV][64];
+static char   kv_val[PRK_RESULTS_MAX_KV][64];
+static int    kv_is_string[PRK_RESULTS_MAX_KV];
+static int    num_iters;
+static double iter_time[PRK_RESULTS_MAX_ITERS];
+
+void prk_results_begin(const char *kernel)
+{
+  const char *temp = getenv("PRK_RESULTS");
+  format = 0;
+  if (temp) {
+    if (!strcmp(temp,"json")) format = 1;
+    if (!strcmp(temp,"csv"))  format = 2;
+  }
+  if (!format) return;
+  strncpy(kernel_name, kernel, sizeof(kernel_name)-1);
+  kernel_name[sizeof(kernel_name)-1] = '\0';
+  num_kv = 0;
+  num_iters = 0;
+}
+
+static void prk_results_kv(const char *key, const char *value, int is_string)
+{
+  if (!format || num_kv >= PRK_RESULTS_MAX_KV) return;
+  strncpy(kv_key[num_kv], key,   sizeof(kv_key[0])-1);
+  strncpy(kv_val[num_kv], value, sizeof(kv_val[0])-1);
+  kv_key[num_kv][sizeof(kv_key[0])-1] = '\0';
+  kv_val[num_kv][sizeof(kv_val[0])-1] = '\0';
+  kv_is_string[num_kv] = is_string;
+  num_kv++;
+}
+
+void prk_results_kv_long(const char *key, long value)
+{
+  char buf[64];
+  if (!format) return;
+  snprintf(buf, sizeof(buf), "%ld", value);
+  prk_results_kv(key, buf, 0);
+}
+
+void prk_results_kv_double(const char *key, double value)
+{
+  char buf[64];
+  if (!format) return;
+  snprintf(buf, sizeof(buf), "%.10g", value);
+  prk_results_kv(key, buf, 0);
+}
+
+void prk_results_kv_string(const char *key, const char *value)
+{
+  prk_results_kv(key, value, 1);
+}
+
+void prk_results_iteration(double seconds)
+{
+  if (!format || num_iters >= PRK_RESULTS_MAX_ITERS) return;
+  iter_time[num_iters++] = seconds;
+}
+
+void prk_results_emit(void)
+{
+  FILE *out = stdout;
+  const char *path;
+  int i;
+
+  if (!format) return;
+  path = getenv("PRK_RESULTS_FILE");
+  if (path) {
+    out = fopen(path, "a");
+    if (!out) out = stdout;
+  }
+
+  if (format == 1) {
+    fprintf(out, "{\"kernel\":\"%s\"", kernel_name);
+    for (i=0; i<num_kv; i++) {
+      if (kv_is_string[i]) fprintf(out, ",\"%s\":\"%s\"", kv_key[i], kv_val[i]);
+      else                 fprintf(out, ",\"%s\":%s",     kv_key[i], kv_val[i]);
+    }
+    fprintf(out, ",\"iteration_times\":[");
+    for (i=0; i<num_iters; i++) {
+      fprintf(out, "%s%.10g", (i ? "," : ""), iter_time[i]);
+    }
+    fprintf(out, "]}\n");
+  }
+  else {
+    fprintf(out, "kernel,%s", kernel_name);
+    for (i=0; i<num_kv; i++) {
+      fprintf(out, ",%s,%s", kv_key[i], kv_val[i]);
+    }
+    for (i=0; i<num_iters; i++) {
+      fprintf(out, ",%.10g", iter_time[i]);
+    }
+    fprintf(out, "\n");
+  }
+
+  if (out != stdout) fclose(out);
+}
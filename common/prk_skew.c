@@ -0,0 +1,142 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+      * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*******************************************************************
+
+NAME:      prk_skew
+
+PURPOSE:   Inject a per-rank, per-iteration busy-wait compute delay
+           drawn from a configurable distribution, so the collective
+           kernels can measure how well a collective absorbs
+           realistic straggler noise.  See include/prk_skew.h for
+           the calling convention.
+
+HISTORY:   Written 2020.
+
+*******************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "prk_skew.h"
+
+extern double wtime(void);
+
+static int         enabled;
+static int         dist;        /* 0=uniform, 1=gauss, 2=straggler       */
+static int         scale_usec;
+static uint64_t    lcg_state;
+static const char  *dist_names[] = {"uniform", "gauss", "straggler"};
+
+/* same multiplier/increment as POSIX drand48                            */
+static double lcg_next(void)
+{
+  lcg_state = lcg_state*6364136223846793005ULL + 1442695040888963407ULL;
+  return (double)(lcg_state >> 11)/9007199254740992.0;
+}
+
+void prk_skew_init(int my_rank)
+{
+  const char *temp = getenv("PRK_SKEW");
+  enabled = (temp != NULL && temp[0] != '\0');
+  if (!enabled) return;
+
+  const char *colon = strchr(temp, ':');
+  if (colon == NULL) {
+    /* bare number means uniform                                         */
+    dist = 0;
+    scale_usec = atoi(temp);
+  }
+  else {
+    if      (!strncmp(temp, "uniform",   colon-temp)) dist = 0;
+    else if (!strncmp(temp, "gauss",     colon-temp)) dist = 1;
+    else if (!strncmp(temp, "straggler", colon-temp)) dist = 2;
+    else {
+      if (my_rank == 0) printf("Skew: unknown distribution in PRK_SKEW=%s; injection disabled\n", temp);
+      enabled = 0;
+      return;
+    }
+    scale_usec = atoi(colon+1);
+  }
+  if (scale_usec <= 0) {
+    if (my_rank == 0) printf("Skew: non-positive scale in PRK_SKEW=%s; injection disabled\n", temp);
+    enabled = 0;
+    return;
+  }
+  /* deterministic per-rank stream, decorrelated by a large odd stride   */
+  lcg_state = 0x9E3779B97F4A7C15ULL*(uint64_t)(my_rank+1);
+}
+
+int prk_skew_active(void)
+{
+  return enabled;
+}
+
+const char *prk_skew_name(void)
+{
+  return enabled ? dist_names[dist] : "none";
+}
+
+int prk_skew_scale(void)
+{
+  return enabled ? scale_usec : 0;
+}
+
+double prk_skew_inject(void)
+{
+  if (!enabled) return 0.0;
+
+  double delay, scale = scale_usec*1.e-6;
+  switch (dist) {
+  case 0:  delay = scale*lcg_next();
+           break;
+  case 1:  /* Box-Muller; mean scale/2, sigma scale/6, clamped to range  */
+           {
+             double u1 = lcg_next(), u2 = lcg_next();
+             if (u1 < 1.e-300) u1 = 1.e-300;
+             delay = 0.5*scale + (scale/6.0)*sqrt(-2.0*log(u1))*cos(6.283185307179586*u2);
+             if (delay < 0.0)   delay = 0.0;
+             if (delay > scale) delay = scale;
+           }
+           break;
+  default: delay = (lcg_next() < 0.05) ? scale : 0.0;
+           break;
+  }
+
+  /* busy-wait to model compute, rather than releasing the CPU           */
+  double start = wtime();
+  while (wtime() - start < delay) ;
+  return wtime() - start;
+}
@@ -0,0 +1,145 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+      * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*******************************************************************
+
+NAME:      prk_trace
+
+PURPOSE:   Record begin/end times of the compute and exchange phases
+           of a kernel in a preallocated per-rank buffer and dump them
+           as Chrome trace JSON, so a phase timeline can be inspected
+           without a full MPI tracing tool.  See include/prk_trace.h
+           for the calling convention.
+
+HISTORY:   Written 2020.
+
+*******************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "prk_trace.h"
+
+#define PRK_TRACE_DEFAULT_EVENTS 65536
+
+extern double wtime(void);
+
+static int         enabled;
+static int         rank;
+static int         capacity;
+static int         num_events;
+static long        dropped;
+static double      t_zero;      /* trace epoch, set at init              */
+static double      t_begin;     /* begin time of the open section        */
+static const char  **ev_name;   /* string literals only, not copied      */
+static double      *ev_start;
+static double      *ev_stop;
+
+void prk_trace_init(int my_rank)
+{
+  const char *temp = getenv("PRK_TRACE");
+  enabled = (temp != NULL && atoi(temp) != 0);
+  if (!enabled) return;
+
+  rank = my_rank;
+  capacity = PRK_TRACE_DEFAULT_EVENTS;
+  temp = getenv("PRK_TRACE_EVENTS");
+  if (temp != NULL && atoi(temp) > 0) capacity = atoi(temp);
+
+  ev_name  = (const char **) malloc(capacity*sizeof(char *));
+  ev_start = (double *)      malloc(capacity*sizeof(double));
+  ev_stop  = (double *)      malloc(capacity*sizeof(double));
+  if (!ev_name || !ev_start || !ev_stop) {
+    if (rank == 0) printf("Trace: could not allocate event buffer; tracing disabled\n");
+    free(ev_name); free(ev_start); free(ev_stop);
+    enabled = 0;
+    return;
+  }
+  num_events = 0;
+  dropped    = 0;
+  t_zero     = wtime();
+}
+
+void prk_trace_begin(void)
+{
+  if (!enabled) return;
+  t_begin = wtime();
+}
+
+void prk_trace_end(const char *name)
+{
+  if (!enabled) return;
+  if (num_events >= capacity) {
+    dropped++;
+    return;
+  }
+  ev_name[num_events]  = name;
+  ev_start[num_events] = t_begin;
+  ev_stop[num_events]  = wtime();
+  num_events++;
+}
+
+void prk_trace_finalize(void)
+{
+  if (!enabled) return;
+
+  const char *prefix = getenv("PRK_TRACE_FILE");
+  if (prefix == NULL) prefix = "prk_trace";
+  char path[512];
+  snprintf(path, sizeof(path), "%s.%d.json", prefix, rank);
+
+  FILE *fp = fopen(path, "w");
+  if (fp == NULL) {
+    printf("Trace: rank %d could not open %s for writing\n", rank, path);
+  }
+  else {
+    /* complete ("X") events, time stamps and durations in microseconds
+       relative to this rank's init; the rank becomes the Chrome pid so
+       concatenated per-rank files show one row per rank               */
+    fprintf(fp, "[\n");
+    for (int i=0; i<num_events; i++) {
+      fprintf(fp, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f}",
+              i ? ",\n" : "", ev_name[i], rank,
+              (ev_start[i]-t_zero)*1.e6, (ev_stop[i]-ev_start[i])*1.e6);
+    }
+    fprintf(fp, "\n]\n");
+    fclose(fp);
+  }
+  if (rank == 0) {
+    printf("Trace: %d events per rank written to %s.<rank>.json\n", num_events, prefix);
+    if (dropped > 0)
+      printf("Trace: event buffer full, %ld events dropped; raise PRK_TRACE_EVENTS\n", dropped);
+  }
+
+  free(ev_name); free(ev_start); free(ev_stop);
+  enabled = 0;
+}
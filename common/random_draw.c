@@ -43,6 +43,9 @@ Functions: LCG_next:      a new pseudo-randon number
            LCG_init:      initialize the generator
            LCG_jump:      jump ahead into a sequence of pseudo-random numbers
            random_draw:
+           random_draw_batch: fill a buffer with draws, vectorizably
+           CBRNG_*, random_draw_cb, random_draw_batch_cb: counter-based
+           (Philox-style) equivalents with O(1) jump-ahead
 
 Notes:     LCG_init must be called by each thread or rank before any jump 
            into a sequence of pseudo-random numbers is made
@@ -189,3 +192,171 @@ uint64_t random_draw(double mu, random_draw_t *parm)
   }
 
 }
+
+/* Fill draws[0:n-1] with exactly the values that n successive calls of random_draw
+   with the same mu would produce, but vectorizably. Each draw consumes two LCG
+   sequence elements; the serial recurrence is split into 2*LCG_BATCH strided
+   substreams (the LCG composed with itself k times is again an LCG), which are
+   independent and advance in a SIMD-friendly loop. Substream j holds sequence
+   element j of the current block, so outputs appear in sequential order               */
+void random_draw_batch(double mu, uint64_t n, uint64_t *draws, random_draw_t *parm)
+{
+  const double   two_pi      = 2.0*3.14159265358979323846;
+  const uint64_t rand_max    = ULLONG_MAX;
+  const double   rand_div    = 1.0/ULLONG_MAX;
+  const uint64_t denominator = UINT_MAX;
+  const int      stride      = 2*LCG_BATCH;
+
+  uint64_t  s[2*LCG_BATCH];   /* current sequence element of each substream           */
+  uint64_t  A_stride, C_stride, numerator, block, nblocks, i;
+  double    u0, u1, sigma;
+  int       j;
+
+  nblocks = n/LCG_BATCH;
+  if (nblocks) {
+    /* seed the substreams with consecutive sequence elements and compute the
+       multiplier and increment that advance each substream by a full stride          */
+    s[0] = LCG_a*parm->LCG_seed + LCG_c;
+    for (j=1; j<stride; j++) s[j] = LCG_a*s[j-1] + LCG_c;
+    A_stride = 1; C_stride = 0;
+    for (j=0; j<stride; j++) {
+      C_stride = LCG_a*C_stride + LCG_c;
+      A_stride *= LCG_a;
+    }
+
+    sigma     = mu*0.15;
+    numerator = (uint32_t) (mu*(double)denominator);
+
+    for (block=0; block<nblocks; block++) {
+      if (mu>=1.0) {
+        for (j=0; j<LCG_BATCH; j++) {
+          u0 = (s[2*j]   % rand_max) * rand_div;
+          u1 = (s[2*j+1] % rand_max) * rand_div;
+          draws[block*LCG_BATCH+j] =
+            (uint64_t) (sqrt(-2.0*log(u0)) * cos(two_pi*u1) * sigma + mu+0.5);
+        }
+      }
+      else {
+        for (j=0; j<LCG_BATCH; j++)
+          draws[block*LCG_BATCH+j] = (uint64_t) ((s[2*j+1]%denominator) <= numerator);
+      }
+      /* the state of the generator is the newest sequence element consumed            */
+      parm->LCG_seed = s[stride-1];
+      for (j=0; j<stride; j++) s[j] = A_stride*s[j] + C_stride;
+    }
+  }
+
+  /* clean up the remainder with the scalar generator                                  */
+  for (i=nblocks*LCG_BATCH; i<n; i++) draws[i] = random_draw(mu, parm);
+}
+
+/*************************************************************************************
+Counter-based generator. This is Philox2x64-10 (Salmon et al., SC'11): ten rounds
+of a multiply-xor bijection keyed by a Weyl sequence. The value at position n of
+the sequence is a pure function of (n, key), so any rank, thread, or lane can jump
+to its position in constant time and generate its subsequence with no communication
+and no serial recurrence. The draw functions mirror random_draw/random_draw_batch:
+two sequence elements are consumed per draw
+*************************************************************************************/
+
+static const uint64_t PHILOX_M      = 0xD2B74407B1CE6E93ULL;
+static const uint64_t PHILOX_W      = 0x9E3779B97F4A7C15ULL; /* Weyl constant       */
+static const uint64_t CBRNG_key_init= 27182818285ULL;     /* same seed as the LCG   */
+
+static void mulhilo64(uint64_t a, uint64_t b, uint64_t *hi, uint64_t *lo) {
+#ifdef __SIZEOF_INT128__
+  __uint128_t product = (__uint128_t)a * b;
+  *hi = (uint64_t)(product>>64);
+  *lo = (uint64_t)product;
+#else
+  /* 32x32 bit partial products for compilers without a 128-bit integer type         */
+  uint64_t a_lo = (uint32_t)a, a_hi = a>>32, b_lo = (uint32_t)b, b_hi = b>>32;
+  uint64_t p0 = a_lo*b_lo, p1 = a_lo*b_hi, p2 = a_hi*b_lo, p3 = a_hi*b_hi;
+  uint64_t carry = ((p0>>32) + (uint32_t)p1 + (uint32_t)p2)>>32;
+  *hi = p3 + (p1>>32) + (p2>>32) + carry;
+  *lo = p0 + (p1<<32) + (p2<<32);
+#endif
+}
+
+/* value of the sequence at the given counter position                                */
+static uint64_t philox2x64(uint64_t counter, uint64_t key) {
+  uint64_t x0 = counter, x1 = 0, hi, lo;
+  int      round;
+
+  for (round=0; round<10; round++) {
+    mulhilo64(PHILOX_M, x0, &hi, &lo);
+    x0 = hi ^ key ^ x1;
+    x1 = lo;
+    key += PHILOX_W;
+  }
+  return x0;
+}
+
+void CBRNG_init(counter_rng_t *parm) {
+  parm->counter = 0;
+  parm->key     = CBRNG_key_init;
+}
+
+uint64_t CBRNG_next(uint64_t bound, counter_rng_t *parm) {
+  return (philox2x64(parm->counter++, parm->key) % bound);
+}
+
+/* position the generator at element m of its sequence; constant time, in contrast
+   with LCG_jump, and independent of any other rank's position                        */
+void CBRNG_jump(uint64_t m, counter_rng_t *parm) {
+  parm->counter = m;
+}
+
+uint64_t random_draw_cb(double mu, counter_rng_t *parm)
+{
+  const double   two_pi      = 2.0*3.14159265358979323846;
+  const uint64_t rand_max    = ULLONG_MAX;
+  const double   rand_div    = 1.0/ULLONG_MAX;
+  const uint64_t denominator = UINT_MAX;
+
+  double         u0, u1, sigma;
+  uint64_t       numerator, i1;
+
+  if (mu>=1.0) {
+    /* set std dev equal to 15% of average; ensures result will never be negative     */
+    sigma = mu*0.15;
+    u0 = CBRNG_next(rand_max, parm) * rand_div;
+    u1 = CBRNG_next(rand_max, parm) * rand_div;
+    return (uint64_t) (sqrt(-2.0*log(u0)) * cos(two_pi*u1) * sigma + mu+0.5);
+  }
+  else {
+    /* we need to pick two integers whose quotient approximates mu                    */
+    numerator = (uint32_t) (mu*(double)denominator);
+    CBRNG_next(denominator, parm); /* don't use value, but keep draws two elements wide */
+    i1 = CBRNG_next(denominator, parm);
+    return ((uint64_t)(i1<=numerator));
+  }
+}
+
+/* every output depends only on its own counter value, so this loop vectorizes
+   and parallelizes with no setup or carried state at all                             */
+void random_draw_batch_cb(double mu, uint64_t n, uint64_t *draws, counter_rng_t *parm)
+{
+  const double   two_pi      = 2.0*3.14159265358979323846;
+  const uint64_t rand_max    = ULLONG_MAX;
+  const double   rand_div    = 1.0/ULLONG_MAX;
+  const uint64_t denominator = UINT_MAX;
+
+  double         u0, u1, sigma;
+  uint64_t       numerator, i, base = parm->counter;
+
+  if (mu>=1.0) {
+    sigma = mu*0.15;
+    for (i=0; i<n; i++) {
+      u0 = (philox2x64(base+2*i,   parm->key) % rand_max) * rand_div;
+      u1 = (philox2x64(base+2*i+1, parm->key) % rand_max) * rand_div;
+      draws[i] = (uint64_t) (sqrt(-2.0*log(u0)) * cos(two_pi*u1) * sigma + mu+0.5);
+    }
+  }
+  else {
+    numerator = (uint32_t) (mu*(double)denominator);
+    for (i=0; i<n; i++)
+      draws[i] = (uint64_t) ((philox2x64(base+2*i+1, parm->key) % denominator) <= numerator);
+  }
+  parm->counter = base + 2*n;
+}
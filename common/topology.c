@@ -54,13 +54,25 @@ History:   Written by Jeff Hammond, August 2015.
 
 ****************************************************************/
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+  #define _GNU_SOURCE /* for sched_setaffinity, sched_getcpu, gethostname */
+#endif
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #if defined(__CRAYXC)
 #elif defined(MPI)
   #include "mpi.h"
 #else
   #include <unistd.h>
+  #include <limits.h>
+  #ifndef HOST_NAME_MAX
+    #define HOST_NAME_MAX 256
+  #endif
+#endif
+#if defined(__linux__)
+  #include <sched.h>
+  #include <unistd.h>
 #endif
 
 
@@ -96,9 +108,148 @@ void print_topology(FILE * output, int label)
     {
         /* see http://linux.die.net/man/2/gethostname */
         char procname[HOST_NAME_MAX];
-        gethostname(&procname,HOST_NAME_MAX);
+        gethostname(procname,HOST_NAME_MAX);
         fprintf(output,"%d: POSIX host name =  %s\n", label, procname);
     }
 #endif
     return;
 }
+
+/****************************************************************
+
+Name:      prk_affinity_init, prk_affinity_pin, prk_affinity_cpu
+
+Purpose:   Topology-aware thread pinning for the shared-memory
+           kernels, so a run is self-describing and reproducibly
+           placed regardless of what OMP_PLACES the operator set.
+
+Arguments: prk_affinity_init takes the placement policy:
+           "core"   = one hardware thread per physical core across
+                      all sockets before any SMT sibling is used,
+           "socket" = fill all cores (and then SMT siblings) of a
+                      socket before moving to the next,
+           "none"   = leave placement to the runtime.
+           prk_affinity_pin takes the logical thread number and
+           binds the calling thread to the cpu that the policy
+           assigns to it.
+
+Returns:   prk_affinity_init returns the number of cpus detected,
+           or 0 if pinning is disabled or unsupported; in that case
+           prk_affinity_pin is a no-op.  prk_affinity_cpu returns
+           the cpu the calling thread is executing on, or -1.
+
+Notes:     Topology is read from sysfs, so this works on any Linux
+           without admin rights; elsewhere the layer degrades to
+           no-ops and the kernels report placement as unbound.
+
+History:   Written August 2026.
+
+****************************************************************/
+
+#if defined(__linux__)
+
+#define PRK_AFFINITY_MAX_CPUS 4096
+
+typedef struct {
+    int cpu;
+    int package;
+    int core;
+    int smt;     /* rank among hardware threads of the same core */
+} prk_cpu_info;
+
+static prk_cpu_info prk_cpu_map[PRK_AFFINITY_MAX_CPUS];
+static int prk_affinity_ncpus  = 0;
+static int prk_affinity_socket = 0;
+
+static int prk_read_topology_leaf(int cpu, const char * leaf)
+{
+    char path[128];
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu%d/topology/%s", cpu, leaf);
+    FILE * f = fopen(path,"r");
+    if (f==NULL) return -1;
+    int value = -1;
+    if (fscanf(f,"%d",&value) != 1) value = -1;
+    fclose(f);
+    return value;
+}
+
+static int prk_cpu_compare(const void * x, const void * y)
+{
+    const prk_cpu_info * a = (const prk_cpu_info *) x;
+    const prk_cpu_info * b = (const prk_cpu_info *) y;
+    /* core-first: exhaust physical cores everywhere before SMT;
+       socket-first: exhaust a package before moving on */
+    int ka = prk_affinity_socket ? (a->package*1000000 + a->smt*1000 + a->core)
+                                 : (a->smt*1000000 + a->package*1000 + a->core);
+    int kb = prk_affinity_socket ? (b->package*1000000 + b->smt*1000 + b->core)
+                                 : (b->smt*1000000 + b->package*1000 + b->core);
+    if (ka != kb) return (ka < kb) ? -1 : 1;
+    return (a->cpu < b->cpu) ? -1 : 1;
+}
+
+int prk_affinity_init(const char * policy)
+{
+    if (policy==NULL || strcmp(policy,"none")==0) return 0;
+    if (strcmp(policy,"core")!=0 && strcmp(policy,"socket")!=0) {
+        fprintf(stderr,"WARNING: unknown affinity policy %s; not pinning\n", policy);
+        return 0;
+    }
+    prk_affinity_socket = (strcmp(policy,"socket")==0);
+
+    long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (ncpus < 1) return 0;
+    if (ncpus > PRK_AFFINITY_MAX_CPUS) ncpus = PRK_AFFINITY_MAX_CPUS;
+
+    for (int cpu=0; cpu<ncpus; cpu++) {
+        prk_cpu_map[cpu].cpu     = cpu;
+        prk_cpu_map[cpu].package = prk_read_topology_leaf(cpu,"physical_package_id");
+        prk_cpu_map[cpu].core    = prk_read_topology_leaf(cpu,"core_id");
+        if (prk_cpu_map[cpu].package < 0 || prk_cpu_map[cpu].core < 0) return 0;
+        int smt = 0;
+        for (int prev=0; prev<cpu; prev++) {
+            if (prk_cpu_map[prev].package == prk_cpu_map[cpu].package &&
+                prk_cpu_map[prev].core    == prk_cpu_map[cpu].core) smt++;
+        }
+        prk_cpu_map[cpu].smt = smt;
+    }
+    qsort(prk_cpu_map, ncpus, sizeof(prk_cpu_info), prk_cpu_compare);
+    prk_affinity_ncpus = (int) ncpus;
+    return prk_affinity_ncpus;
+}
+
+void prk_affinity_pin(int thread)
+{
+    if (prk_affinity_ncpus < 1 || thread < 0) return;
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CPU_SET(prk_cpu_map[thread%prk_affinity_ncpus].cpu, &mask);
+    sched_setaffinity(0, sizeof(mask), &mask);
+}
+
+int prk_affinity_cpu(void)
+{
+    return sched_getcpu();
+}
+
+#else /* !__linux__ */
+
+int prk_affinity_init(const char * policy)
+{
+    if (policy!=NULL && strcmp(policy,"none")!=0) {
+        fprintf(stderr,"WARNING: thread pinning not supported on this OS\n");
+    }
+    return 0;
+}
+
+void prk_affinity_pin(int thread)
+{
+    return;
+}
+
+int prk_affinity_cpu(void)
+{
+    return -1;
+}
+
+#endif
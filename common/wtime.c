@@ -55,37 +55,187 @@ Notes:     This function uses two structures defined in the UNIX
 History:   Written by Tim Mattson, Dec 1, 1988
            Modified by Rob van der Wijngaart, May 2006, to change
            default clock to the Unix system clock.
+           - Added clock-source selection (PRK_CLOCK), measured
+             resolution/overhead, and optional startup report
 
 ****************************************************************/
 
+/* clock_gettime and nanosleep require POSIX.1b                          */
+#if !defined(_POSIX_C_SOURCE) || (_POSIX_C_SOURCE < 200112L)
+  #undef  _POSIX_C_SOURCE
+  #define _POSIX_C_SOURCE 200112L
+#endif
+
 #include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
 #if defined(_OPENMP)
   #include <omp.h>
 #elif defined(MPI)
   #include "mpi.h"
+#endif
+#define  USEC_TO_SEC   1.0e-6    /* to convert microsecs to secs */
+#define  NSEC_TO_SEC   1.0e-9    /* to convert nanosecs  to secs */
+
+/* The default ("native") clock is what this file has always used:
+   omp_get_wtime, MPI_Wtime, or gettimeofday, depending on the build.
+   gettimeofday has microsecond granularity, which quantizes very short
+   iterations; PRK_CLOCK selects an alternative at run time:
+     gettimeofday   the classic Unix clock
+     monotonic      clock_gettime(CLOCK_MONOTONIC)
+     monotonic_raw  clock_gettime(CLOCK_MONOTONIC_RAW), immune to NTP slew
+     rdtsc          the x86 time stamp counter, calibrated at startup
+   PRK_CLOCK_REPORT=1 prints the selected source and its measured
+   resolution and call overhead on first use                             */
+#define PRK_CLK_NATIVE        0
+#define PRK_CLK_GETTIMEOFDAY  1
+#define PRK_CLK_MONOTONIC     2
+#define PRK_CLK_MONOTONIC_RAW 3
+#define PRK_CLK_RDTSC         4
+
+static int    clock_source = -1;
+static double tsc_scale;         /* seconds per TSC tick                 */
+static unsigned long long tsc_base; /* TSC reading at calibration        */
+
+double wtime(void);
+double wtime_resolution(void);
+double wtime_overhead(void);
+
+static void select_clock(void) {
+  char *envar = getenv("PRK_CLOCK");
+  const char *name = "native";
+
+  clock_source = PRK_CLK_NATIVE;
+  if (envar) {
+    if      (!strcmp(envar, "native"))        clock_source = PRK_CLK_NATIVE;
+    else if (!strcmp(envar, "gettimeofday"))  clock_source = PRK_CLK_GETTIMEOFDAY;
+    else if (!strcmp(envar, "monotonic"))     clock_source = PRK_CLK_MONOTONIC;
+    else if (!strcmp(envar, "monotonic_raw")) {
+#if defined(CLOCK_MONOTONIC_RAW)
+      clock_source = PRK_CLK_MONOTONIC_RAW;
 #else
-  #include <sys/time.h>
-  #define  USEC_TO_SEC   1.0e-6    /* to convert microsecs to secs */
+      fprintf(stderr, "wtime: CLOCK_MONOTONIC_RAW not available, using CLOCK_MONOTONIC\n");
+      clock_source = PRK_CLK_MONOTONIC;
 #endif
-
+    }
+    else if (!strcmp(envar, "rdtsc")) {
+#if defined(__x86_64__) || defined(__i386__)
+      /* calibrate the TSC frequency against CLOCK_MONOTONIC over 5 ms  */
+      struct timespec t0, t1, nap = {0, 5000000};
+      unsigned long long c0, c1;
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+      c0 = __builtin_ia32_rdtsc();
+      nanosleep(&nap, NULL);
+      clock_gettime(CLOCK_MONOTONIC, &t1);
+      c1 = __builtin_ia32_rdtsc();
+      tsc_scale = ((double)(t1.tv_sec-t0.tv_sec) +
+                   (double)(t1.tv_nsec-t0.tv_nsec)*NSEC_TO_SEC)/(double)(c1-c0);
+      tsc_base  = c0;
+      clock_source = PRK_CLK_RDTSC;
+#else
+      fprintf(stderr, "wtime: rdtsc not available on this platform, using native clock\n");
+#endif
+    }
+    else fprintf(stderr, "wtime: unknown PRK_CLOCK value %s ignored\n", envar);
+    name = envar;
+  }
+
+  if (getenv("PRK_CLOCK_REPORT")) {
+    printf("Timer source         = %s\n", name);
+    printf("Timer resolution (s) = %.3e\n", wtime_resolution());
+    printf("Timer overhead (s)   = %.3e\n", wtime_overhead());
+  }
+}
 
 double wtime() {
   double time_seconds;
 
-#if defined(_OPENMP)
-  time_seconds = omp_get_wtime();
+  if (clock_source < 0) select_clock();
 
+  switch (clock_source) {
+  case PRK_CLK_MONOTONIC:
+#if defined(CLOCK_MONOTONIC_RAW)
+  case PRK_CLK_MONOTONIC_RAW:
+#endif
+    {
+      struct timespec ts;
+      clock_gettime(
+#if defined(CLOCK_MONOTONIC_RAW)
+                    (clock_source == PRK_CLK_MONOTONIC_RAW) ?
+                    CLOCK_MONOTONIC_RAW :
+#endif
+                    CLOCK_MONOTONIC, &ts);
+      time_seconds  = (double) ts.tv_sec;
+      time_seconds += (double) ts.tv_nsec * NSEC_TO_SEC;
+    }
+    break;
+#if defined(__x86_64__) || defined(__i386__)
+  case PRK_CLK_RDTSC:
+    time_seconds = (double)(__builtin_ia32_rdtsc()-tsc_base)*tsc_scale;
+    break;
+#endif
+  case PRK_CLK_GETTIMEOFDAY:
+    {
+      struct timeval time_data; /* seconds since 0 GMT */
+      gettimeofday(&time_data,NULL);
+      time_seconds  = (double) time_data.tv_sec;
+      time_seconds += (double) time_data.tv_usec * USEC_TO_SEC;
+    }
+    break;
+  default:
+#if defined(_OPENMP)
+    time_seconds = omp_get_wtime();
 #elif defined(MPI)
-  time_seconds = MPI_Wtime();
-
+    time_seconds = MPI_Wtime();
 #else
-  struct timeval  time_data; /* seconds since 0 GMT */
-   
-  gettimeofday(&time_data,NULL);
-   
-  time_seconds  = (double) time_data.tv_sec;
-  time_seconds += (double) time_data.tv_usec * USEC_TO_SEC;
+    {
+      struct timeval time_data; /* seconds since 0 GMT */
+      gettimeofday(&time_data,NULL);
+      time_seconds  = (double) time_data.tv_sec;
+      time_seconds += (double) time_data.tv_usec * USEC_TO_SEC;
+    }
 #endif
+    break;
+  }
 
   return time_seconds;
 }
+
+/* measured resolution of the selected clock: the smallest positive
+   difference between consecutive readings, minimized over many trials.
+   Kernels whose average iteration time approaches this cannot report
+   meaningful rates                                                      */
+double wtime_resolution(void) {
+  static double resolution = 0.0;
+
+  if (resolution == 0.0) {
+    for (int trial=0; trial<100; trial++) {
+      double t0 = wtime(), t1;
+      long   spin;
+      for (spin=0; spin<1000000; spin++) {
+        t1 = wtime();
+        if (t1 > t0) break;
+      }
+      if (spin == 1000000) continue;
+      if (resolution == 0.0 || t1-t0 < resolution) resolution = t1-t0;
+    }
+    /* a clock that never advanced is broken; report its tick as huge   */
+    if (resolution == 0.0) resolution = 1.0;
+  }
+  return resolution;
+}
+
+/* measured cost of one wtime() call                                     */
+double wtime_overhead(void) {
+  static double overhead = 0.0;
+
+  if (overhead == 0.0) {
+    const int calls = 100000;
+    double t0 = wtime();
+    for (int i=0; i<calls; i++) (void) wtime();
+    overhead = (wtime()-t0)/calls;
+  }
+  return overhead;
+}
@@ -0,0 +1,140 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+* Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Dispatch-target pool for the indirect branching modes of the Branch
+   kernel.  Every function performs the identical update as the taken
+   and non-taken paths of the no_vector mode, so the verification total
+   is unchanged; the functions exist only to occupy distinct
+   branch-target-buffer entries.  noinline keeps the compiler from
+   collapsing the indirect calls into direct ones.
+   Include after par-res-kern_general.h (for RESTRICT).                  */
+
+#ifndef PRK_BRANCH_H
+#define PRK_BRANCH_H
+
+#define BRANCH_MAX_TABLE 64
+
+typedef void (*branch_func_t)(int * RESTRICT, int * RESTRICT, int, int);
+
+#define BRANCH_DEFUN(n) \
+static void __attribute__((noinline)) branch_func_##n \
+  (int * RESTRICT v, int * RESTRICT idx, int i, int aux) \
+{                                                        \
+  if (aux>0) v[i] -= 2*v[idx[i]];                        \
+  else       v[i] -= 2*aux;                              \
+}
+
+BRANCH_DEFUN(0)
+BRANCH_DEFUN(1)
+BRANCH_DEFUN(2)
+BRANCH_DEFUN(3)
+BRANCH_DEFUN(4)
+BRANCH_DEFUN(5)
+BRANCH_DEFUN(6)
+BRANCH_DEFUN(7)
+BRANCH_DEFUN(8)
+BRANCH_DEFUN(9)
+BRANCH_DEFUN(10)
+BRANCH_DEFUN(11)
+BRANCH_DEFUN(12)
+BRANCH_DEFUN(13)
+BRANCH_DEFUN(14)
+BRANCH_DEFUN(15)
+BRANCH_DEFUN(16)
+BRANCH_DEFUN(17)
+BRANCH_DEFUN(18)
+BRANCH_DEFUN(19)
+BRANCH_DEFUN(20)
+BRANCH_DEFUN(21)
+BRANCH_DEFUN(22)
+BRANCH_DEFUN(23)
+BRANCH_DEFUN(24)
+BRANCH_DEFUN(25)
+BRANCH_DEFUN(26)
+BRANCH_DEFUN(27)
+BRANCH_DEFUN(28)
+BRANCH_DEFUN(29)
+BRANCH_DEFUN(30)
+BRANCH_DEFUN(31)
+BRANCH_DEFUN(32)
+BRANCH_DEFUN(33)
+BRANCH_DEFUN(34)
+BRANCH_DEFUN(35)
+BRANCH_DEFUN(36)
+BRANCH_DEFUN(37)
+BRANCH_DEFUN(38)
+BRANCH_DEFUN(39)
+BRANCH_DEFUN(40)
+BRANCH_DEFUN(41)
+BRANCH_DEFUN(42)
+BRANCH_DEFUN(43)
+BRANCH_DEFUN(44)
+BRANCH_DEFUN(45)
+BRANCH_DEFUN(46)
+BRANCH_DEFUN(47)
+BRANCH_DEFUN(48)
+BRANCH_DEFUN(49)
+BRANCH_DEFUN(50)
+BRANCH_DEFUN(51)
+BRANCH_DEFUN(52)
+BRANCH_DEFUN(53)
+BRANCH_DEFUN(54)
+BRANCH_DEFUN(55)
+BRANCH_DEFUN(56)
+BRANCH_DEFUN(57)
+BRANCH_DEFUN(58)
+BRANCH_DEFUN(59)
+BRANCH_DEFUN(60)
+BRANCH_DEFUN(61)
+BRANCH_DEFUN(62)
+BRANCH_DEFUN(63)
+
+/* the branch-free no_vector update; the without-branches pass calls this
+   through a direct call, so neither the branch nor the dispatch is present   */
+static void __attribute__((noinline)) branch_func_fixed(int * RESTRICT v,
+                                      int * RESTRICT idx, int i, int aux)
+{
+  v[i] -= (v[idx[i]] + aux);
+}
+
+static branch_func_t const branch_table[BRANCH_MAX_TABLE] = {
+  branch_func_0, branch_func_1, branch_func_2, branch_func_3, branch_func_4, branch_func_5, branch_func_6, branch_func_7,
+  branch_func_8, branch_func_9, branch_func_10, branch_func_11, branch_func_12, branch_func_13, branch_func_14, branch_func_15,
+  branch_func_16, branch_func_17, branch_func_18, branch_func_19, branch_func_20, branch_func_21, branch_func_22, branch_func_23,
+  branch_func_24, branch_func_25, branch_func_26, branch_func_27, branch_func_28, branch_func_29, branch_func_30, branch_func_31,
+  branch_func_32, branch_func_33, branch_func_34, branch_func_35, branch_func_36, branch_func_37, branch_func_38, branch_func_39,
+  branch_func_40, branch_func_41, branch_func_42, branch_func_43, branch_func_44, branch_func_45, branch_func_46, branch_func_47,
+  branch_func_48, branch_func_49, branch_func_50, branch_func_51, branch_func_52, branch_func_53, branch_func_54, branch_func_55,
+  branch_func_56, branch_func_57, branch_func_58, branch_func_59, branch_func_60, branch_func_61, branch_func_62, branch_func_63
+};
+
+#endif /* PRK_BRANCH_H */
@@ -86,6 +86,8 @@ POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 extern double wtime(void);
+extern double wtime_resolution(void);
+extern double wtime_overhead(void);
 
 /*  We cannot use C11 aligned_alloc because of this GCC 5.3.0 bug:
  *  https://gcc.gnu.org/bugzilla/show_bug.cgi?id=69680 */
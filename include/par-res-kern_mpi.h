@@ -56,7 +56,7 @@ POSSIBILITY OF SUCH DAMAGE.
 /* We should set an attribute that indicates we need to free memory
  * when using this so that the MPI_Win_free does not create a
  * double-free situation when paired with a real MPI_Win_create call. */
-int PRK_Win_allocate(MPI_Aint size, int disp_unit, MPI_Info info,
+static inline int PRK_Win_allocate(MPI_Aint size, int disp_unit, MPI_Info info,
                      MPI_Comm comm, void * baseptr, MPI_Win * win)
 {
 #if MPI_VERSION < 3
@@ -75,7 +75,7 @@ int PRK_Win_allocate(MPI_Aint size, int disp_unit, MPI_Info info,
 #endif
 }
 
-int PRK_Win_free(MPI_Win * win)
+static inline int PRK_Win_free(MPI_Win * win)
 {
     int rc = MPI_SUCCESS;
 #if MPI_VERSION < 3
@@ -141,4 +141,14 @@ int PRK_Win_free(MPI_Win * win)
 
 extern void bail_out(int);
 
+/* node-aware rank remapping (common/MPI_remap.c); enabled with
+ * environment variable PRK_TOPOLOGY_REMAP */
+extern MPI_Comm prk_node_aware_comm(MPI_Comm comm, int npx, int npy);
+extern int      prk_count_offnode(MPI_Comm comm, int nbrs[], int num_nbrs);
+
+/* per-rank time distribution and slowest-rank report
+ * (common/MPI_rank_stats.c); enabled with environment variable
+ * PRK_RANK_STATS=<k>, which names the k slowest ranks */
+extern void prk_report_rank_stats(double local_time, MPI_Comm comm);
+
 #endif /* PRK_MPI_H */
@@ -99,4 +99,9 @@ int omp_test_lock(omp_lock_t * l)
 
 extern void bail_out(int);
 
+/* topology-aware thread pinning; see common/topology.c */
+extern int  prk_affinity_init(const char *);
+extern void prk_affinity_pin(int);
+extern int  prk_affinity_cpu(void);
+
 #endif /* PRK_OMP_H */
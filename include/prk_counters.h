@@ -0,0 +1,52 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+      * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Optional perf-event counter layer shared by the C kernels.  A kernel
+   brackets its existing timed region with prk_counters_start() and
+   prk_counters_stop() and calls prk_counters_report() next to its rate
+   output.  The event set comes from PRK_COUNTERS: either a
+   comma-separated list (cycles, instructions, cache-references,
+   cache-misses, branches, branch-misses, page-faults) or 1 for the
+   default of cycles,instructions,cache-misses.  Counts cover the
+   calling thread/rank, which under a static schedule is representative
+   of the others.  Every call is a no-op when PRK_COUNTERS is unset or
+   the platform has no perf_event support, so default output does not
+   change.                                                             */
+
+#ifndef PRK_COUNTERS_H
+#define PRK_COUNTERS_H
+
+extern void prk_counters_start(void);
+extern void prk_counters_stop(void);
+extern void prk_counters_report(int iterations);
+
+#endif /* PRK_COUNTERS_H */
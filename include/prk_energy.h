@@ -0,0 +1,51 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+      * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Optional energy and frequency layer shared by the C kernels.  A
+   kernel brackets its existing timed region with prk_energy_start()
+   and prk_energy_stop() and calls prk_energy_report() next to its rate
+   output, passing the rate it just printed; the report adds joules,
+   average watts, average core frequency, and rate-per-watt, so a
+   thermally throttled node fails qualification visibly instead of just
+   looking slow.  Package energy comes from the RAPL powercap sysfs
+   interface and frequency from cpufreq.  Every call is a no-op when
+   PRK_ENERGY is unset or the files are unavailable (non-Linux systems,
+   restricted /sys), so default output does not change.               */
+
+#ifndef PRK_ENERGY_H
+#define PRK_ENERGY_H
+
+extern void prk_energy_start(void);
+extern void prk_energy_stop(void);
+extern void prk_energy_report(double rate, const char *unit);
+
+#endif /* PRK_ENERGY_H */
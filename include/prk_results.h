@@ -0,0 +1,51 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without 
+modification, are permitted provided that the following conditions 
+are met:
+
+* Redistributions of source code must retain the above copyright 
+      notice, this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above 
+      copyright notice, this list of conditions and the following 
+      disclaimer in the documentation and/or other materials provided 
+      with the distribution.
+      * Neither the name of Intel Corporation nor the names of its 
+      contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS 
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, 
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Machine-readable results emitter shared by the C kernels.  A kernel
+   calls prk_results_begin() once, records its parameters and final
+   figures with the kv functions, feeds per-iteration times to
+   prk_results_iteration(), and prk_results_emit() appends one JSON or
+   CSV record.  Controlled by PRK_RESULTS=json|csv and (optionally)
+   PRK_RESULTS_FILE; every call is a no-op when PRK_RESULTS is unset,
+   so default output does not change.                                  */
+
+#ifndef PRK_RESULTS_H
+#define PRK_RESULTS_H
+
+extern void prk_results_begin(const char *kernel);
+extern void prk_results_kv_long(const char *key, long value);
+extern void prk_results_kv_double(const char *key, double value);
+extern void prk_results_kv_string(const char *key, const char *value);
+extern void prk_results_iteration(double seconds);
+extern void prk_results_emit(void);
+
+#endif /* PRK_RESULTS_H */
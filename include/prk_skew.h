@@ -0,0 +1,56 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+      * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Controlled load-imbalance injector for the collective kernels.  A
+   kernel calls prk_skew_init() with its rank, and in skew mode draws
+   one busy-wait compute delay per iteration with prk_skew_inject()
+   just before its collective, so the collective has realistic
+   straggler noise to absorb.  The delay distribution comes from
+   PRK_SKEW=<dist>:<scale>, with scale in microseconds and dist one of
+     uniform    delay drawn from U[0,scale]
+     gauss      normal with mean scale/2 and sigma scale/6, clamped
+                to [0,scale]
+     straggler  zero, except a scale-long delay with 5% probability
+   Each rank draws from its own deterministic stream, so runs are
+   repeatable.  Every call is a no-op (and prk_skew_active() is false)
+   when PRK_SKEW is unset, so default behavior does not change.      */
+
+#ifndef PRK_SKEW_H
+#define PRK_SKEW_H
+
+extern void   prk_skew_init(int my_rank);
+extern int    prk_skew_active(void);
+extern double prk_skew_inject(void);
+extern const char *prk_skew_name(void);
+extern int    prk_skew_scale(void);
+
+#endif /* PRK_SKEW_H */
@@ -0,0 +1,55 @@
+/*
+Copyright (c) 2013, Intel Corporation
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+* Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+      * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+      * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Optional phase tracer shared by the C kernels.  A kernel calls
+   prk_trace_init() with its rank once the communicator is settled,
+   brackets its compute/exchange sections with prk_trace_begin() and
+   prk_trace_end(), and calls prk_trace_finalize() before MPI_Finalize.
+   Events go into a preallocated per-rank buffer (no allocation or I/O
+   inside the timed region) and are dumped as one Chrome trace JSON
+   file per rank, prk_trace.<rank>.json, loadable in chrome://tracing
+   or Perfetto; concatenating the per-rank arrays gives one timeline
+   for the whole job.  Sections must not nest, and events must be
+   recorded from one thread per rank.  Controlled by PRK_TRACE=1, with
+   PRK_TRACE_EVENTS overriding the buffer capacity (default 65536) and
+   PRK_TRACE_FILE the file prefix.  Every call is a no-op when
+   PRK_TRACE is unset, so default output does not change.            */
+
+#ifndef PRK_TRACE_H
+#define PRK_TRACE_H
+
+extern void prk_trace_init(int my_rank);
+extern void prk_trace_begin(void);
+extern void prk_trace_end(const char *name);
+extern void prk_trace_finalize(void);
+
+#endif /* PRK_TRACE_H */
@@ -37,15 +37,34 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #define NMAX 64
 
+/* number of independent LCG substreams used by the batched generator; must be
+   a power of two no larger than the widest SIMD register over lane width       */
+#define LCG_BATCH 16
+
 typedef struct {
   uint64_t  LCG_seed;
   uint64_t  LCG_A[NMAX];
 } random_draw_t;
- 
+
+/* counter-based (Philox-style) generator: the value at any position in the
+   sequence is a pure function of counter and key, so jumping is O(1) and
+   every rank, thread, or lane can generate its subsequence independently      */
+typedef struct {
+  uint64_t  counter;
+  uint64_t  key;
+} counter_rng_t;
+
 extern void     LCG_init(random_draw_t *);
 extern uint64_t LCG_next(uint64_t, random_draw_t *);
 extern void     LCG_get_chunk(uint64_t *, uint64_t *, int, int, uint64_t);
 extern void     LCG_jump(uint64_t, uint64_t, random_draw_t *);
 extern uint64_t random_draw(double, random_draw_t *);
+extern void     random_draw_batch(double, uint64_t, uint64_t *, random_draw_t *);
+
+extern void     CBRNG_init(counter_rng_t *);
+extern uint64_t CBRNG_next(uint64_t, counter_rng_t *);
+extern void     CBRNG_jump(uint64_t, counter_rng_t *);
+extern uint64_t random_draw_cb(double, counter_rng_t *);
+extern void     random_draw_batch_cb(double, uint64_t, uint64_t *, counter_rng_t *);
 
 #endif /* RANDOM_DRAW_H */
@@ -0,0 +1,38 @@
+# Small MPI1 run matrix for scripts/runmatrix; the counterpart of the
+# fixed list in scripts/small/runmpi1, but swept over rank counts.
+# Run from the top-level directory:
+#     scripts/runmatrix scripts/small/matrix-mpi1.spec
+
+[branch]
+command = mpirun -np {ranks} MPI1/Branch/branch 10 1000 {type}
+ranks   = 1 2 4
+type    = vector_go vector_stop no_vector ins_heavy
+
+[dgemm]
+command = mpirun -np {ranks} MPI1/DGEMM/dgemm 10 500 {block} 1
+ranks   = 1 2 4
+block   = 32 64
+
+[nstream]
+command = mpirun -np {ranks} MPI1/Nstream/nstream 10 {length} 0
+ranks   = 1 2 4
+length  = 2000000 20000000
+
+[sparse]
+command = mpirun -np {ranks} MPI1/Sparse/sparse 10 10 4
+ranks   = 1 2 4
+
+[stencil]
+command = mpirun -np {ranks} MPI1/Stencil/stencil 10 {n}
+ranks   = 1 2 4
+n       = 1000 2000
+
+[p2p]
+command = mpirun -np {ranks} MPI1/Synch_p2p/p2p 10 {mn} {mn}
+ranks   = 1 2 4
+mn      = 1000 2000
+
+[transpose]
+command = mpirun -np {ranks} MPI1/Transpose/transpose 10 2000 {tile}
+ranks   = 1 2 4
+tile    = 0 64
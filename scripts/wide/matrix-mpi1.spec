@@ -0,0 +1,36 @@
+# Wide MPI1 run matrix for scripts/runmatrix; the counterpart of the
+# fixed list in scripts/wide/runmpi1, with large footprints swept over
+# rank counts.  Run from the top-level directory:
+#     scripts/runmatrix scripts/wide/matrix-mpi1.spec
+
+[dgemm]
+command = mpirun -np {ranks} MPI1/DGEMM/dgemm 1 -50000 32 1
+ranks   = 1 2
+
+[nstream]
+command = mpirun -np {ranks} MPI1/Nstream/nstream 1 2000000000 0
+ranks   = 1 2
+
+[reduce]
+command = mpirun -np {ranks} MPI1/Reduce/reduce 1 2000000000
+ranks   = 1 2
+
+[sparse]
+command = mpirun -np {ranks} MPI1/Sparse/sparse 1 13 7
+ranks   = 1 2
+
+[stencil]
+command = mpirun -np {ranks} MPI1/Stencil/stencil 1 50000
+ranks   = 1 2
+
+[global]
+command = mpirun -np {ranks} MPI1/Synch_global/global 1 2000000000
+ranks   = 1 2
+
+[p2p]
+command = mpirun -np {ranks} MPI1/Synch_p2p/p2p 1 70000 70000
+ranks   = 1 2
+
+[transpose]
+command = mpirun -np {ranks} MPI1/Transpose/transpose 1 50000 64
+ranks   = 1 2
@@ -148,7 +148,8 @@ case "$PRK_TARGET" in
         echo "EXTRA_CLIBS=-lm -lpthread" >> common/make.defs
 
         # C11 without external parallelism
-        ${MAKE} -C $PRK_TARGET_PATH nstream p2p stencil transpose p2p-hyperplane
+        ${MAKE} -C $PRK_TARGET_PATH latency nstream p2p stencil transpose p2p-hyperplane
+        $PRK_TARGET_PATH/latency         10 65536
         $PRK_TARGET_PATH/nstream         10 16777216 32
         $PRK_TARGET_PATH/p2p             10 1024 1024
         $PRK_TARGET_PATH/p2p             10 1024 1024 100 100
@@ -730,16 +731,30 @@ case "$PRK_TARGET" in
         esac
 
         # Serial
-        ${MAKE} -C ${PRK_TARGET_PATH} p2p p2p-innerloop stencil transpose nstream dgemm
+        ${MAKE} -C ${PRK_TARGET_PATH} p2p p2p-innerloop stencil transpose nstream latency gather dgemm
         $PRK_TARGET_PATH/p2p               10 1024 1024
         $PRK_TARGET_PATH/p2p-innerloop     10 1024
         $PRK_TARGET_PATH/stencil           10 1000
+        $PRK_TARGET_PATH/stencil           10 1000 32 star 2 1 fp32
+        $PRK_TARGET_PATH/stencil           10 1000 32 star 2 1 fp32acc64
         $PRK_TARGET_PATH/transpose         10 1024 1
         $PRK_TARGET_PATH/transpose         10 1024 32
         $PRK_TARGET_PATH/nstream           10 16777216
+        $PRK_TARGET_PATH/latency           10 65536
+        $PRK_TARGET_PATH/latency           10 4096 4096
+        $PRK_TARGET_PATH/nstream           10 16777216 0 DOT
+        $PRK_TARGET_PATH/nstream           10 16777216 0 TRIAD8
+        $PRK_TARGET_PATH/gather            10 16777216
+        $PRK_TARGET_PATH/gather            10 16777216 64
+        $PRK_TARGET_PATH/gather            10 16777216 1 8192
+        $PRK_TARGET_PATH/gather            10 16777216 1 8192 scatter
         $PRK_TARGET_PATH/dgemm             10 400 400 # untiled
         $PRK_TARGET_PATH/dgemm             10 400 32
 
+        # In-process suite runner
+        ${MAKE} -C ${PRK_TARGET_PATH} suite
+        $PRK_TARGET_PATH/suite nstream 10 16777216 : transpose 10 1024 32 : stencil 10 1000 : p2p 10 1024 1024 : dgemm 10 400 32
+
         # Pretty
         ${MAKE} -C ${PRK_TARGET_PATH} stencil-pretty transpose-pretty nstream-pretty dgemm-pretty
         #$PRK_TARGET_PATH/p2p-pretty          10 1024 1024
@@ -751,7 +766,7 @@ case "$PRK_TARGET" in
 
         # OpenMP host
         ${MAKE} -C ${PRK_TARGET_PATH} p2p-tasks-openmp p2p-innerloop-openmp stencil-openmp transpose-openmp \
-                                   nstream-openmp dgemm-openmp
+                                   nstream-openmp gather-openmp dgemm-openmp
         export OMP_NUM_THREADS=2
         $PRK_TARGET_PATH/p2p-tasks-openmp     10 1024 1024
         $PRK_TARGET_PATH/p2p-innerloop-openmp 10 1024
@@ -760,6 +775,8 @@ case "$PRK_TARGET" in
         $PRK_TARGET_PATH/transpose-openmp     10 1024 1
         $PRK_TARGET_PATH/transpose-openmp     10 1024 32
         $PRK_TARGET_PATH/nstream-openmp       10 16777216
+        $PRK_TARGET_PATH/gather-openmp        10 16777216 1 8192
+        $PRK_TARGET_PATH/gather-openmp        10 16777216 64 0 scatter
         $PRK_TARGET_PATH/dgemm-openmp         10 400 400 # untiled
         $PRK_TARGET_PATH/dgemm-openmp         10 400 32
 
@@ -832,6 +849,10 @@ case "$PRK_TARGET" in
         $PRK_TARGET_PATH/DGEMM/dgemm              $OMP_NUM_THREADS 10 1024 32
         $PRK_TARGET_PATH/Synch_global/global      $OMP_NUM_THREADS 10 16384
         $PRK_TARGET_PATH/Refcount/refcount        $OMP_NUM_THREADS 16777216 1024
+        $PRK_TARGET_PATH/Contention/contention    $OMP_NUM_THREADS 1000000 fetchadd shared
+        $PRK_TARGET_PATH/Contention/contention    $OMP_NUM_THREADS 1000000 cas shared
+        $PRK_TARGET_PATH/Contention/contention    $OMP_NUM_THREADS 1000000 backoff shared
+        $PRK_TARGET_PATH/Contention/contention    $OMP_NUM_THREADS 1000000 fetchadd private
         $PRK_TARGET_PATH/PIC/pic                  $OMP_NUM_THREADS 10 1000 1000000 1 2 GEOMETRIC 0.99
         $PRK_TARGET_PATH/PIC/pic                  $OMP_NUM_THREADS 10 1000 1000000 0 1 SINUSOIDAL
         $PRK_TARGET_PATH/PIC/pic                  $OMP_NUM_THREADS 10 1000 1000000 1 0 LINEAR 1.0 3.0
@@ -900,6 +921,9 @@ case "$PRK_TARGET" in
         $PRK_RUN $PRK_TARGET_PATH/DGEMM/dgemm         10 1024 32 1
         $PRK_RUN $PRK_TARGET_PATH/Random/random       32 20
         $PRK_RUN $PRK_TARGET_PATH/Synch_global/global 10 16384
+        $PRK_RUN $PRK_TARGET_PATH/Synch_global/global 10 16384 iallreduce
+        $PRK_RUN $PRK_TARGET_PATH/Synch_global/global 10 16384 dissemination
+        $PRK_RUN $PRK_TARGET_PATH/Synch_global/global 10 16384 rma
         $PRK_RUN $PRK_TARGET_PATH/PIC-static/pic      10 1000 1000000 1 2 GEOMETRIC 0.99
         $PRK_RUN $PRK_TARGET_PATH/PIC-static/pic      10 1000 1000000 0 1 SINUSOIDAL
         $PRK_RUN $PRK_TARGET_PATH/PIC-static/pic      10 1000 1000000 1 0 LINEAR 1.0 3.0
@@ -930,6 +954,9 @@ case "$PRK_TARGET" in
         $PRK_RUN $PRK_TARGET_PATH/Synch_p2p/p2p       10 1024 1024
         $PRK_RUN $PRK_TARGET_PATH/Stencil/stencil     10 1000
         $PRK_RUN $PRK_TARGET_PATH/Transpose/transpose 10 1024 32
+        $PRK_RUN $PRK_TARGET_PATH/AMR/amr             10 1000 100 2 2 1 5 FINE_GRAIN
+        $PRK_RUN $PRK_TARGET_PATH/AMR/amr             10 1000 100 2 2 1 5 HIGH_WATER
+        $PRK_RUN $PRK_TARGET_PATH/AMR/amr             10 1000 100 2 2 1 5 NO_TALK
 
         echo "MPI+MPI"
         ${MAKE} allmpishm
@@ -939,6 +966,7 @@ case "$PRK_TARGET" in
         export PRK_MPISHM_RANKS=$(($PRK_MPI_PROCS/2))
         $PRK_RUN $PRK_TARGET_PATH/Synch_p2p/p2p                         10 1024 1024
         $PRK_RUN $PRK_TARGET_PATH/Stencil/stencil     $PRK_MPISHM_RANKS 10 1000
+        $PRK_RUN $PRK_TARGET_PATH/Stencil/stencil     $PRK_MPISHM_RANKS 10 1000 DIRECT
         $PRK_RUN $PRK_TARGET_PATH/Transpose/transpose $PRK_MPISHM_RANKS 10 1024 32
         ;;
     allshmem)
@@ -955,6 +983,8 @@ case "$PRK_TARGET" in
         $PRK_LAUNCHER -n $PRK_SHMEM_PROCS $PRK_TARGET_PATH/Synch_p2p/p2p       10 1024 1024
         $PRK_LAUNCHER -n $PRK_SHMEM_PROCS $PRK_TARGET_PATH/Stencil/stencil     10 1000
         $PRK_LAUNCHER -n $PRK_SHMEM_PROCS $PRK_TARGET_PATH/Transpose/transpose 10 1024 32
+        $PRK_LAUNCHER -n $PRK_SHMEM_PROCS $PRK_TARGET_PATH/Random/random       32 20
+        $PRK_LAUNCHER -n $PRK_SHMEM_PROCS $PRK_TARGET_PATH/Random/random       32 20 4096
         ;;
     allupc)
         echo "UPC"